@@ -1,6 +1,7 @@
 package com.jetbrains.cef.remote;
 
 import com.jetbrains.cef.remote.thrift_codegen.ClientHandlers;
+import com.jetbrains.cef.remote.thrift_codegen.ServerMetrics;
 import org.apache.thrift.TException;
 import org.apache.thrift.server.TServer;
 import org.apache.thrift.server.TThreadPoolServer;
@@ -18,6 +19,9 @@ import java.util.concurrent.atomic.AtomicLong;
 
 public class CefServer {
     private static final boolean CONNECT_AS_SLAVE = Utils.getBoolean("JCEF_CONNECT_AS_SLAVE");
+    // Every backward connection from server is served by separate thread (server can open several
+    // connections per client, see --backward-connections)
+    private static final int CLIENT_HANDLERS_MAX_THREADS = Utils.getInteger("JCEF_CLIENT_HANDLERS_MAX_THREADS", 32);
 
     private static final CefServer INSTANCE = CefApp.isRemoteEnabled() ? new CefServer() : null;
 
@@ -89,6 +93,15 @@ public class CefServer {
         return "unknown(not connected)";
     }
 
+    /**
+     * Returns latency metrics of server methods and client callbacks (or null when not connected).
+     */
+    public static ServerMetrics getMetrics() {
+        if (CefApp.isRemoteEnabled() && INSTANCE.myIsConnected)
+            return INSTANCE.myRpc.execObj(r->r.metrics());
+        return null;
+    }
+
     private boolean connect(Runnable onContextInitialized) {
         myClientHandlersImpl.setOnContextInitialized(() -> {
             myIsContextInitialized = true;
@@ -119,7 +132,10 @@ public class CefServer {
 
             ClientHandlers.Processor processor = new ClientHandlers.Processor(myClientHandlersImpl);
             TThreadPoolServer.Args serverArgs = new TThreadPoolServer.Args(myClientHandlersTransport)
-                .processor(processor).executorService(new ThreadPoolExecutor(2, 10, 60L, TimeUnit.SECONDS, new SynchronousQueue(), new ThreadFactory() {
+                .processor(processor)
+                .transportFactory(ThriftTransport.createTransportFactory())
+                .protocolFactory(ThriftTransport.createProtocolFactory())
+                .executorService(new ThreadPoolExecutor(2, CLIENT_HANDLERS_MAX_THREADS, 60L, TimeUnit.SECONDS, new SynchronousQueue(), new ThreadFactory() {
                     final AtomicLong count = new AtomicLong();
                     public Thread newThread(Runnable r) {
                         final String name = String.format("CefHandlers-execution-%d", this.count.getAndIncrement());
@@ -185,7 +201,10 @@ public class CefServer {
 
         ClientHandlers.Processor processor = new ClientHandlers.Processor(new ClientHandlersDummy());
         TThreadPoolServer.Args serverArgs = new TThreadPoolServer.Args(transport)
-                .processor(processor).executorService(new ThreadPoolExecutor(2, 10, 60L, TimeUnit.SECONDS, new SynchronousQueue(), new ThreadFactory() {
+                .processor(processor)
+                .transportFactory(ThriftTransport.createTransportFactory())
+                .protocolFactory(ThriftTransport.createProtocolFactory())
+                .executorService(new ThreadPoolExecutor(2, CLIENT_HANDLERS_MAX_THREADS, 60L, TimeUnit.SECONDS, new SynchronousQueue(), new ThreadFactory() {
                     final AtomicLong count = new AtomicLong();
                     public Thread newThread(Runnable r) {
                         final String name = String.format("CefHandlers(dummy)-execution-%d", this.count.getAndIncrement());
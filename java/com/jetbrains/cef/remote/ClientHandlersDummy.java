@@ -43,6 +43,11 @@ public class ClientHandlersDummy implements ClientHandlers.Iface{
 
     }
 
+    @Override
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) throws TException {
+
+    }
+
     @Override
     public boolean LifeSpanHandler_OnBeforePopup(int bid, String url, String frameName, boolean gesture) throws TException {
         return false;
@@ -218,6 +223,11 @@ public class ClientHandlersDummy implements ClientHandlers.Iface{
         return null;
     }
 
+    @Override
+    public ResponseData ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, RObject callback, String sharedMemName, long sharedMemHandle) throws TException {
+        return null;
+    }
+
     @Override
     public void ResourceHandler_Cancel(int resourceHandler) throws TException {
 
@@ -11,6 +11,7 @@ import com.jetbrains.cef.remote.thrift_codegen.Rect;
 import com.jetbrains.cef.remote.thrift_codegen.ScreenInfo;
 import org.apache.thrift.TException;
 import org.cef.CefSettings;
+import org.cef.browser.CefBrowser;
 import org.cef.browser.CefFrame;
 import org.cef.callback.CefAuthCallback;
 import org.cef.callback.CefCallback;
@@ -27,6 +28,9 @@ import java.util.Arrays;
 import java.util.Date;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.BiFunction;
+import java.util.function.Consumer;
 
 //
 // Service for rpc from native to java
@@ -85,7 +89,7 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
     //
 
     private static final Rect INVALID_RECT = new Rect(0,0,-1,-1);
-    private static final Point INVALID_POINT = new Point(Integer.MIN_VALUE, Integer.MIN_VALUE);
+    static final Point INVALID_POINT = new Point(Integer.MIN_VALUE, Integer.MIN_VALUE);
     private static final ScreenInfo INVALID_SCREENINFO = new ScreenInfo(-1, -1, -1, false, new Rect(), new Rect());
 
     // NOTE: assume getRenderHandler() != null always
@@ -96,6 +100,10 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
         if (browser == null) return INVALID_RECT;
         CefRenderHandler rh = browser.getRenderHandler();
         if (rh == null) return INVALID_RECT;
+        return getViewRect(browser, rh);
+    }
+
+    static Rect getViewRect(RemoteBrowser browser, CefRenderHandler rh) {
         Rectangle rect = rh.getViewRect(browser);
         return new Rect(rect.x, rect.y, rect.width, rect.height);
     }
@@ -106,6 +114,10 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
         if (browser == null) return INVALID_SCREENINFO;
         CefRenderHandler rh = browser.getRenderHandler();
         if (rh == null) return INVALID_SCREENINFO;
+        return getScreenInfo(browser, rh);
+    }
+
+    static ScreenInfo getScreenInfo(RemoteBrowser browser, CefRenderHandler rh) {
         CefScreenInfo csi = new CefScreenInfo();
         boolean success = rh.getScreenInfo(browser, csi);
         return success ?
@@ -125,8 +137,12 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
         if (browser == null) return INVALID_POINT;
         CefRenderHandler rh = browser.getRenderHandler();
         if (rh == null) return INVALID_POINT;
+        return getScreenPoint(browser, rh, viewX, viewY);
+    }
+
+    static Point getScreenPoint(RemoteBrowser browser, CefRenderHandler rh, int viewX, int viewY) {
         java.awt.Point res = rh.getScreenPoint(browser, new java.awt.Point(viewX, viewY));
-        return new Point(res.x, res.y);
+        return res == null ? INVALID_POINT : new Point(res.x, res.y);
     }
 
     @Override
@@ -138,6 +154,46 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
         ((CefNativeRenderHandler)rh).onPaintWithSharedMem(browser, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height);
     }
 
+    @Override
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) {
+        RemoteBrowser browser = getRemoteBrowser(bid);
+        if (browser == null) return;
+        CefRenderHandler rh = browser.getRenderHandler();
+        if (rh == null) return;
+        CefNativeRenderHandler nrh = (CefNativeRenderHandler)rh;
+        if (acquiresFramesItself(nrh)) {
+            nrh.onPaintWithSharedMem(browser, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+            return;
+        }
+
+        // Legacy handler reads the buffer without acquiring it, so hold the frame while it's called (server
+        // doesn't reuse acquired buffer) and pass parameters of the frame that is actually stored in the buffer.
+        withSharedMem(myPaintSharedMem, sharedMemName, sharedMemHandle, SharedMemory.WithRaster::new, mem -> {
+            SharedMemory.WithRaster raster = (SharedMemory.WithRaster)mem;
+            if (!raster.tryAcquireFrame())
+                return; // frame was dropped, its dirty rects will be passed with the next one
+            try {
+                nrh.onPaintWithSharedMem(browser, popup, raster.getDirtyRectsCount(), sharedMemName, sharedMemHandle, raster.getWidth(), raster.getHeight());
+            } finally {
+                raster.release();
+            }
+        });
+    }
+
+    private static final Map<Class<?>, Boolean> ourAcquiresFramesItself = new ConcurrentHashMap<>();
+
+    // Returns true when handler overrides onPaintWithSharedMem with frameSeq (such handlers acquire frames themselves).
+    private static boolean acquiresFramesItself(CefNativeRenderHandler rh) {
+        return ourAcquiresFramesItself.computeIfAbsent(rh.getClass(), cls -> {
+            try {
+                return cls.getMethod("onPaintWithSharedMem", CefBrowser.class, boolean.class, int.class, String.class,
+                        long.class, int.class, int.class, long.class).getDeclaringClass() != CefNativeRenderHandler.class;
+            } catch (NoSuchMethodException e) {
+                return false;
+            }
+        });
+    }
+
     //
     // CefLifeSpanHandler
     //
@@ -688,7 +744,7 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
     public ResponseData ResourceHandler_ReadResponse(int resourceHandler, int bytes_to_read, RObject callback) throws TException {
         if (bytes_to_read <= 0) return new ResponseData();
         if (bytes_to_read > 256*1024)
-            CefLog.Error("ResourceHandler_ReadResponse: too much bytes to read %d. Need to implement via shared memory.", bytes_to_read);
+            CefLog.Error("ResourceHandler_ReadResponse: too much bytes to read %d. Use CEF_SERVER_RESPONSE_READ_SHARED_MEM.", bytes_to_read);
 
         RemoteResourceHandler rrh = RemoteResourceHandler.FACTORY.find(resourceHandler);
         if (rrh == null) return null;
@@ -706,6 +762,95 @@ public class ClientHandlersImpl implements ClientHandlers.Iface {
         return result;
     }
 
+    @Override
+    public ResponseData ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, RObject callback, String sharedMemName, long sharedMemHandle) throws TException {
+        if (bytes_to_read <= 0) return new ResponseData();
+
+        RemoteResourceHandler rrh = RemoteResourceHandler.FACTORY.find(resourceHandler);
+        if (rrh == null) return null;
+
+        CefCallback cb = new RemoteCallback(myService, callback);
+
+        IntRef bytesRead = new IntRef();
+        final boolean continueRead;
+        final int read;
+        if (rrh.getDelegate() instanceof CefDirectResourceHandler) {
+            // Handler writes straight into the shared buffer of server.
+            CefDirectResourceHandler handler = (CefDirectResourceHandler)rrh.getDelegate();
+            boolean[] continueRef = new boolean[1];
+            withSharedMem(sharedMemName, sharedMemHandle, bytes_to_read,
+                    buffer -> continueRef[0] = handler.readResponse(buffer, bytes_to_read, bytesRead, cb));
+            continueRead = continueRef[0];
+            read = Math.min(bytesRead.get(), bytes_to_read);
+        } else {
+            byte[] buf = rrh.getReadBuffer(bytes_to_read);
+            continueRead = rrh.getDelegate().readResponse(buf, bytes_to_read, bytesRead, cb);
+            read = Math.min(bytesRead.get(), bytes_to_read);
+            if (read > 0)
+                withSharedMem(sharedMemName, sharedMemHandle, read, buffer -> buffer.put(buf, 0, read));
+        }
+        ResponseData result = new ResponseData();
+        result.setContinueRead(continueRead);
+        result.setBytes_read(read);
+        return result;
+    }
+
+    // Server uses single response buffer per thread and replaces it only when bigger one is necessary (raster
+    // buffers are replaced only when browser grows or closes), so unused segments are closed after timeout.
+    private static final long SHARED_MEM_TIMEOUT_MS = 60*1000;
+    private final Map<String, PinnedSharedMem> myResponseSharedMem = new ConcurrentHashMap<>();
+    private final Map<String, PinnedSharedMem> myPaintSharedMem = new ConcurrentHashMap<>();
+
+    // Segment with count of its users: handlers are called outside of the monitor, so sweep skips
+    // the segments that are in use instead of waiting for them.
+    private static class PinnedSharedMem {
+        final SharedMemory mem;
+        int users = 0;
+
+        PinnedSharedMem(SharedMemory mem) { this.mem = mem; }
+    }
+
+    private void withSharedMem(String sharedMemName, long sharedMemHandle, int len, Consumer<ByteBuffer> consumer) {
+        withSharedMem(myResponseSharedMem, sharedMemName, sharedMemHandle, SharedMemory::new, mem -> consumer.accept(mem.wrap(len)));
+    }
+
+    private static void withSharedMem(Map<String, PinnedSharedMem> cache, String sharedMemName, long sharedMemHandle,
+                                      BiFunction<String, Long, SharedMemory> opener, Consumer<SharedMemory> consumer) {
+        final long nowMs = System.currentTimeMillis();
+        // Restarted server can create segment with the same name (the old one is already unlinked), so handle is
+        // a part of the key.
+        final String key = sharedMemName + ':' + sharedMemHandle;
+        PinnedSharedMem pinned;
+        while (true) {
+            pinned = cache.computeIfAbsent(key, k -> new PinnedSharedMem(opener.apply(sharedMemName, sharedMemHandle)));
+            synchronized (pinned) {
+                if (pinned.mem.isClosed())
+                    continue; // was closed by timeout, open again
+                pinned.users++;
+                pinned.mem.lasUsedMs = nowMs;
+                break;
+            }
+        }
+
+        try {
+            consumer.accept(pinned.mem);
+        } finally {
+            synchronized (pinned) {
+                pinned.users--;
+                pinned.mem.lasUsedMs = System.currentTimeMillis();
+            }
+        }
+
+        cache.values().removeIf(m -> {
+            synchronized (m) {
+                if (m.users > 0 || nowMs - m.mem.lasUsedMs < SHARED_MEM_TIMEOUT_MS)
+                    return false;
+                m.mem.close();
+                return true;
+            }
+        });
+    }
+
     @Override
     public void ResourceHandler_Cancel(int resourceHandler) throws TException {
         RemoteResourceHandler rrh = RemoteResourceHandler.FACTORY.find(resourceHandler);
@@ -310,8 +310,49 @@ public class NativeServerManager {
         if (serverLog != null && !serverLog.isEmpty()) {
             CefLog.Debug("\tLog file %s", serverLog);
             builder.command().add(String.format("--logfile=%s", serverLog.trim()));
+            if (Utils.getBoolean("CEF_SERVER_LOG_BINARY"))
+                builder.command().add("--log-binary");
         }
+        if (Utils.getBoolean("CEF_SERVER_LOG_SYNC"))
+            builder.command().add("--log-sync");
+        if (Utils.getBoolean("CEF_SERVER_METRICS_DUMP"))
+            builder.command().add("--metrics-dump");
+        final String serverMode = ThriftTransport.getServerMode();
+        if (!serverMode.equals("threaded")) {
+            CefLog.Debug("\tServer mode %s", serverMode);
+            builder.command().add(String.format("--server-mode=%s", serverMode));
+        }
+        // Workers of nonblocking server (limit concurrently executed calls, not connections)
+        final int serverWorkers = Utils.getInteger("CEF_SERVER_WORKERS", -1);
+        if (serverWorkers > 0)
+            builder.command().add(String.format("--server-workers=%d", serverWorkers));
+        if (ThriftTransport.isCompact())
+            builder.command().add("--protocol=compact");
+        if (ThriftTransport.isFramed())
+            builder.command().add("--transport=framed");
+        final int transportBufferSize = Utils.getInteger("CEF_SERVER_TRANSPORT_BUFFER_SIZE", -1);
+        if (transportBufferSize > 0)
+            builder.command().add(String.format("--transport-buffer-size=%d", transportBufferSize));
         builder.command().add(String.format("--params=%s", paramsPath));
+        if (Utils.getBoolean("CEF_SERVER_PAINT_DIRTY_RECTS_ONLY", true)) {
+            CefLog.Debug("\tRaster will be transferred by dirty rects");
+            builder.command().add("--paint-dirty-rects-only");
+        }
+        final int paintBuffers = Utils.getInteger("CEF_SERVER_PAINT_BUFFERS", -1);
+        if (paintBuffers > 0)
+            builder.command().add(String.format("--paint-buffers=%d", paintBuffers));
+        if (Utils.getBoolean("CEF_SERVER_PAINT_BACKPRESSURE"))
+            builder.command().add("--paint-backpressure");
+        if (Utils.getBoolean("CEF_SERVER_PAINT_SYNC"))
+            builder.command().add("--paint-sync");
+        final int backwardConnections = Utils.getInteger("CEF_SERVER_BACKWARD_CONNECTIONS", -1);
+        if (backwardConnections > 0)
+            builder.command().add(String.format("--backward-connections=%d", backwardConnections));
+        if (Utils.getBoolean("CEF_SERVER_RESPONSE_READ_SHARED_MEM", true))
+            builder.command().add("--response-read-shared-mem");
+        final int inputCoalesceMs = Utils.getInteger("CEF_SERVER_INPUT_COALESCE_MS", -1);
+        if (inputCoalesceMs >= 0)
+            builder.command().add(String.format("--input-coalesce-ms=%d", inputCoalesceMs));
         builder.redirectOutput(ProcessBuilder.Redirect.INHERIT);
         builder.redirectError(ProcessBuilder.Redirect.INHERIT);
         try {
@@ -1,6 +1,10 @@
 package com.jetbrains.cef.remote;
 
+import com.jetbrains.cef.remote.network.ResourceRules;
 import com.jetbrains.cef.remote.thrift_codegen.RObject;
+import com.jetbrains.cef.remote.thrift_codegen.Rect;
+import com.jetbrains.cef.remote.thrift_codegen.ResourceRule;
+import com.jetbrains.cef.remote.thrift_codegen.ScreenInfo;
 import org.cef.CefClient;
 import org.cef.browser.CefBrowser;
 import org.cef.browser.CefDevToolsClient;
@@ -48,6 +52,9 @@ public class RemoteBrowser implements CefBrowser {
 
     private final List<Runnable> myDelayedActions = new ArrayList<>();
     private int myFrameRate = 30; // just for cache
+    private volatile ResourceRules myResourceRules;
+    // Screen location of the view is cached by server only when embedder tracks its moves (see updateViewGeometry)
+    private volatile boolean myIsViewLocationTracked = false;
 
     public RemoteBrowser(RpcExecutor service, RemoteClient owner, CefClient cefClient, String url) {
         myService = service;
@@ -106,6 +113,10 @@ public class RemoteBrowser implements CefBrowser {
             CefLog.Debug("Registered bid %d with handlers: %s", myBid, RemoteClient.HandlerMasks.toString(hmask));
             // At current point new bid is registered so java-handlers calls will be dispatched correctly.
             // We can't start creation earlier because for example onAfterCreated can be called before new bid is registered.
+            if (myRender != null)
+                pushViewGeometry();
+            if (myResourceRules != null)
+                pushResourceRules();
             myService.exec((s)-> s.startBrowserCreation(myBid, myUrl));
 
             synchronized (myDelayedActions) {
@@ -522,18 +533,71 @@ public class RemoteBrowser implements CefBrowser {
             return;
 
         execIfBid(()->{
+            pushViewGeometry();
             myService.exec((s)->{
                 s.Browser_WasResized(myBid);
             });
         }, "wasResized");
     }
 
+    /**
+     * Sends actual view rect, screen info and screen location of the view to server, so it can answer
+     * CefRenderHandler requests (GetViewRect, GetScreenInfo, GetScreenPoint) without calls to client.
+     * Resize and screen changes are pushed automatically. Screen location isn't cached by server until this
+     * method is called: after that embedder must call it every time the view is moved on screen (including
+     * moves of its ancestors), otherwise GetScreenPoint will return stale values.
+     */
+    public void updateViewGeometry() {
+        if (myIsClosing)
+            return;
+
+        myIsViewLocationTracked = true;
+        execIfBid(this::pushViewGeometry, "updateViewGeometry");
+    }
+
+    private void pushViewGeometry() {
+        CefRenderHandler rh = getRenderHandler();
+        if (rh == null)
+            return;
+        Rect viewRect = ClientHandlersImpl.getViewRect(this, rh);
+        ScreenInfo screenInfo = ClientHandlersImpl.getScreenInfo(this, rh);
+        // Invalid points aren't cached, so server will request them from client.
+        com.jetbrains.cef.remote.thrift_codegen.Point pt0 = myIsViewLocationTracked ?
+                ClientHandlersImpl.getScreenPoint(this, rh, 0, 0) : ClientHandlersImpl.INVALID_POINT;
+        com.jetbrains.cef.remote.thrift_codegen.Point pt100 = myIsViewLocationTracked ?
+                ClientHandlersImpl.getScreenPoint(this, rh, 100, 100) : ClientHandlersImpl.INVALID_POINT;
+        myService.exec((s)->{
+            s.Browser_SetViewGeometry(myBid, viewRect, screenInfo, pt0, pt100);
+        });
+    }
+
+    /**
+     * Sets rules that are evaluated by server for every resource request, so most of the requests can be
+     * handled without calls of CefRequestHandler (null or empty rules disables evaluation).
+     */
+    public void setResourceRules(ResourceRules rules) {
+        myResourceRules = rules;
+        if (myIsClosing || myBid < 0)
+            return; // will be pushed before browser creation
+
+        pushResourceRules();
+    }
+
+    private void pushResourceRules() {
+        ResourceRules rules = myResourceRules;
+        List<ResourceRule> list = rules == null ? new ArrayList<>() : new ArrayList<>(rules.getRules());
+        myService.exec((s)->{
+            s.Browser_SetResourceRules(myBid, list);
+        });
+    }
+
     @Override
     public void notifyScreenInfoChanged() {
         if (myIsClosing)
             return;
 
         execIfBid(()->{
+            pushViewGeometry();
             myService.exec((s)->{
                 s.Browser_NotifyScreenInfoChanged(myBid);
             });
@@ -6,8 +6,6 @@ import org.cef.misc.CefLog;
 
 import java.io.PrintWriter;
 import java.io.StringWriter;
-import java.util.HashMap;
-import java.util.Map;
 
 // 1. Direct inheritors represent remote java peer for native server object that
 // valid only in current method context.
@@ -19,13 +17,10 @@ import java.util.Map;
 public abstract class RemoteServerObjectLocal {
     protected final int myId;
     protected final RpcExecutor myServer;
-    protected final Map<String, String> myCache = new HashMap<>();
 
     public RemoteServerObjectLocal(RpcExecutor server, RObject robj) {
         myId = robj.objId;
         myServer = server;
-        if (robj.objInfo != null)
-            myCache.putAll(robj.objInfo);
     }
 
     public abstract void flush();
@@ -35,9 +30,6 @@ public abstract class RemoteServerObjectLocal {
     //
 
     protected RObject thriftId() { return new RObject(myId); }
-    protected RObject thriftIdWithCache() {
-        return new RObject(myId).setObjInfo(myCache);
-    }
 
     protected void onThriftException(TException e) {
         CefLog.Error("thrift exception '%s'", e.getMessage());
@@ -45,44 +37,4 @@ public abstract class RemoteServerObjectLocal {
         e.printStackTrace(new PrintWriter(sw));
         CefLog.Error(sw.getBuffer().toString());
     }
-
-    protected long getLongVal(String key) {
-        return getLongVal(key, 0);
-    }
-    protected long getLongVal(String key, long def) {
-        String sval = myCache.get(key);
-        if (sval == null || sval.isEmpty())
-            return def;
-        try {
-            return Long.parseLong(sval);
-        } catch (NumberFormatException e) {
-            CefLog.Error("not long value: %s -> %s", key, sval);
-        }
-        return def;
-    }
-
-    protected boolean getBoolVal(String key) {
-        return getBoolVal(key, false);
-    }
-    protected boolean getBoolVal(String key, boolean def) {
-        String sval = myCache.get(key);
-        if (sval == null || sval.isEmpty())
-            return def;
-        try {
-            return Boolean.parseBoolean(sval);
-        } catch (NumberFormatException e) {
-            CefLog.Error("not bool value: %s -> %s", key, sval);
-        }
-        return def;
-    }
-
-    protected void setStrVal(String key, String value) {
-        if (value == null || value.isEmpty())
-            myCache.remove(key);
-        else
-            myCache.put(key, value);
-    }
-    protected void setLongVal(String key, long value) {
-        myCache.put(key, String.valueOf(value));
-    }
 }
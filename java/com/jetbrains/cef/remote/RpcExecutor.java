@@ -2,7 +2,6 @@ package com.jetbrains.cef.remote;
 
 import com.jetbrains.cef.remote.thrift_codegen.Server;
 import org.apache.thrift.TException;
-import org.apache.thrift.protocol.TBinaryProtocol;
 import org.apache.thrift.protocol.TProtocol;
 import org.apache.thrift.transport.TSocket;
 import org.apache.thrift.transport.TTransport;
@@ -30,9 +29,9 @@ public class RpcExecutor {
 
     private void initTcp(int port) throws TTransportException {
         try {
-            myTransport = new TSocket("localhost", port);
+            myTransport = ThriftTransport.wrapTransport(new TSocket("localhost", port));
             myTransport.open();
-            myProtocol = new TBinaryProtocol(myTransport);
+            myProtocol = ThriftTransport.createProtocol(myTransport);
             myServer = new Server.Client(myProtocol);
         } catch (TTransportException e) {
             myTransport = null;
@@ -41,8 +40,8 @@ public class RpcExecutor {
     }
 
     private void initPipe(String pipeName) throws TTransportException {
-        myTransport = ThriftTransport.openPipeTransport(pipeName);
-        myProtocol = new TBinaryProtocol(myTransport);
+        myTransport = ThriftTransport.wrapTransport(ThriftTransport.openPipeTransport(pipeName));
+        myProtocol = ThriftTransport.createProtocol(myTransport);
         myServer = new Server.Client(myProtocol);
     }
 
@@ -71,6 +70,9 @@ public class RpcExecutor {
                     myServer.connectTcp(ThriftTransport.getJavaHandlersPort(), asMaster) :
                     myServer.connect(ThriftTransport.getJavaHandlersPipe(), asMaster);
         } catch (TException e) {
+            // Wire format isn't negotiated, so the first call fails when it differs from cef_server's one.
+            CefLog.Error("Can't connect to cef_server (%s), probably wire format mismatch: client uses %s, cef_server must be started with the same --protocol and --transport.",
+                    e.getMessage(), ThriftTransport.describeWireFormat());
             onThriftException(e);
         }
         return -1;
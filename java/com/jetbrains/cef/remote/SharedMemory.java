@@ -14,8 +14,10 @@ public class SharedMemory {
     final private long mySegment;
     final private long myPtr;
     private volatile boolean myClosed = false;
+    private volatile Thread myLockOwner; // thread that acquired frame via deprecated lock()
 
-    final private long myMutex;
+    // Lock-free state of the buffer (see SharedBufferSlot.h)
+    final private long mySlot;
 
     static {
         loadDynamicLib();
@@ -38,15 +40,56 @@ public class SharedMemory {
         this.mySegment = openSharedSegment(sharedMemName);
         this.myPtr = getPointer(mySegment, boostHandle);
 
-        myMutex = openSharedMutex(sharedMemName);
+        this.mySlot = findSlot(mySegment);
     }
 
+    /**
+     * Acquires published frame for reading. Returns false when the frame was dropped by server (overwritten
+     * by newer one), in this case dirty rects of dropped frame will be passed with the next frame.
+     */
+    public boolean tryAcquire() {
+        return tryAcquireSlot(mySlot);
+    }
+
+    public void release() {
+        releaseSlot(mySlot);
+    }
+
+    /**
+     * Returns sequence number of the frame stored in this buffer.
+     */
+    public long getSeq() {
+        return getSlotSeq(mySlot);
+    }
+
+    /**
+     * Reads parameters of the frame stored in this buffer: width, height and dirty rects count.
+     * Must be called after successful tryAcquire.
+     */
+    public void readFrameInfo(int[] info) {
+        readSlotFrame(mySlot, info);
+    }
+
+    /**
+     * @deprecated use {@link #tryAcquire()} and call {@link #release()} only when it succeeded. This method doesn't
+     * wait: when the frame can't be acquired (it was dropped or is held by caller of the handler) the buffer is
+     * read without ownership, as before.
+     */
+    @Deprecated
     public void lock() {
-        lockSharedMutex(myMutex);
+        if (tryAcquire())
+            myLockOwner = Thread.currentThread();
     }
 
+    /**
+     * @deprecated see {@link #lock()}. Releases the frame only when it was acquired by lock() of this thread.
+     */
+    @Deprecated
     public void unlock() {
-        unlockSharedMutex(myMutex);
+        if (myLockOwner != Thread.currentThread())
+            return;
+        myLockOwner = null;
+        release();
     }
 
     public long getPtr() {
@@ -61,7 +104,6 @@ public class SharedMemory {
             return;
         myClosed = true;
         closeSharedSegment(mySegment);
-        closeSharedMutex(myMutex);
     }
 
     public ByteBuffer wrap(int size) {
@@ -96,6 +138,21 @@ public class SharedMemory {
             super(sharedMemName, boostHandle);
         }
 
+        /**
+         * Acquires published frame and loads its parameters (they may differ from paint notification
+         * when the notified frame was dropped and buffer already contains newer one).
+         */
+        public boolean tryAcquireFrame() {
+            if (!tryAcquire())
+                return false;
+            int[] info = new int[3];
+            readFrameInfo(info);
+            myWidth = info[0];
+            myHeight = info[1];
+            myDirtyRectsCount = info[2];
+            return true;
+        }
+
         public ByteBuffer wrapRaster() {
             return wrapNativeMem(getPtr(), myWidth * myHeight * 4);
         }
@@ -137,8 +194,9 @@ public class SharedMemory {
     private static native long getPointer(long segment, long handle);
     private static native void closeSharedSegment(long segment);
 
-    private static native long openSharedMutex(String uid);
-    private static native void lockSharedMutex(long mutex);
-    private static native void unlockSharedMutex(long mutex);
-    private static native void closeSharedMutex(long mutex);
+    private static native long findSlot(long segment);
+    private static native boolean tryAcquireSlot(long slot);
+    private static native void releaseSlot(long slot);
+    private static native long getSlotSeq(long slot);
+    private static native void readSlotFrame(long slot, int[] info);
 }
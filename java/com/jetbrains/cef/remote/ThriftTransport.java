@@ -1,6 +1,11 @@
 package com.jetbrains.cef.remote;
 
+import org.apache.thrift.protocol.TBinaryProtocol;
+import org.apache.thrift.protocol.TCompactProtocol;
+import org.apache.thrift.protocol.TProtocol;
+import org.apache.thrift.protocol.TProtocolFactory;
 import org.apache.thrift.transport.*;
+import org.apache.thrift.transport.layered.TFramedTransport;
 import org.cef.OS;
 import org.cef.misc.CefLog;
 import org.cef.misc.Utils;
@@ -31,6 +36,17 @@ public class ThriftTransport {
     }
 
     static boolean isTcp() { return Utils.getBoolean("CEF_SERVER_USE_TCP"); }
+    // Server mode: "threaded" (default) or "nonblocking" (see --server-mode of cef_server)
+    static String getServerMode() { return Utils.getString("CEF_SERVER_MODE", "threaded"); }
+    // Wire format of both channels (must be the same as in cef_server, see --protocol and --transport).
+    static boolean isCompact() { return "compact".equals(Utils.getString("CEF_SERVER_PROTOCOL", "binary")); }
+    // Nonblocking server reads whole frames, so it always uses framed transport.
+    static boolean isFramed() {
+        return "framed".equals(Utils.getString("CEF_SERVER_TRANSPORT", "buffered")) || "nonblocking".equals(getServerMode());
+    }
+    static String describeWireFormat() {
+        return String.format("%s protocol, %s transport", isCompact() ? "compact" : "binary", isFramed() ? "framed" : "buffered");
+    }
     static int getServerPort() {
         if (PORT_CEF_SERVER == -1) {
             PORT_CEF_SERVER = findFreePort();
@@ -135,6 +151,22 @@ public class ThriftTransport {
         };
     }
 
+    static TTransport wrapTransport(TTransport transport) throws TTransportException {
+        return isFramed() ? new TFramedTransport(transport) : transport;
+    }
+
+    static TProtocol createProtocol(TTransport transport) {
+        return isCompact() ? new TCompactProtocol(transport) : new TBinaryProtocol(transport);
+    }
+
+    static TTransportFactory createTransportFactory() {
+        return isFramed() ? new TFramedTransport.Factory() : new TTransportFactory();
+    }
+
+    static TProtocolFactory createProtocolFactory() {
+        return isCompact() ? new TCompactProtocol.Factory() : new TBinaryProtocol.Factory();
+    }
+
     public static TIOStreamTransport openPipeTransport(String pipeName) throws TTransportException {
         try {
             InputStream is;
@@ -4,7 +4,7 @@ import com.jetbrains.cef.remote.RpcExecutor;
 import com.jetbrains.cef.remote.RemoteServerObjectLocal;
 import com.jetbrains.cef.remote.thrift_codegen.PostData;
 import com.jetbrains.cef.remote.thrift_codegen.RObject;
-import org.cef.misc.CefLog;
+import com.jetbrains.cef.remote.thrift_codegen.RequestInfo;
 import org.cef.network.CefPostData;
 import org.cef.network.CefRequest;
 
@@ -17,45 +17,65 @@ import java.util.Map;
 // moment all requests from java to native will return errors (or default values).
 // Java object will be destroyed via usual gc.
 public class RemoteRequestImpl extends RemoteServerObjectLocal {
+    private final RequestInfo myInfo;
+    // Modified fields only, sent to server in flush()
+    private final RequestInfo myChanges = new RequestInfo();
+    private boolean myIsModified = false;
+
     public RemoteRequestImpl(RpcExecutor server, RObject request) {
         super(server, request);
+        myInfo = request.isSetRequestInfo() ? request.getRequestInfo() : new RequestInfo();
     }
 
     public void flush() {
+        if (!myIsModified)
+            return;
+        myIsModified = false;
+        RObject robj = thriftId().setRequestInfo(myChanges.deepCopy());
+        myChanges.clear();
         myServer.exec((s)->{
-            s.Request_Update(thriftIdWithCache());
+            s.Request_Update(robj);
         });
     }
 
-    public long getIdentifier() { return getLongVal("Identifier"); }
+    public long getIdentifier() { return myInfo.identifier; }
 
-    public boolean isReadOnly() { return getBoolVal("IsReadOnly"); }
+    public boolean isReadOnly() { return myInfo.isReadOnly; }
 
-    public String getURL() { return myCache.get("URL"); }
+    public String getURL() { return myInfo.url; }
 
-    public void setURL(String url) { setStrVal("URL", url); }
+    public void setURL(String url) {
+        myInfo.setUrl(url);
+        myChanges.setUrl(url);
+        myIsModified = true;
+    }
 
-    public String getMethod() { return myCache.get("Method"); }
+    public String getMethod() { return myInfo.method; }
 
-    public void setMethod(String method) { setStrVal("Method", method); }
+    public void setMethod(String method) {
+        myInfo.setMethod(method);
+        myChanges.setMethod(method);
+        myIsModified = true;
+    }
 
     public void setReferrer(String url, CefRequest.ReferrerPolicy policy) {
-        setStrVal("ReferrerURL", url);
-        setStrVal("ReferrerPolicy", policy.name());
+        final int cefPolicy = policy2int(policy);
+        myInfo.setReferrerUrl(url);
+        myInfo.setReferrerPolicy(cefPolicy);
+        myChanges.setReferrerUrl(url);
+        myChanges.setReferrerPolicy(cefPolicy);
+        myIsModified = true;
     }
 
-    public String getReferrerURL() { return myCache.get("ReferrerURL"); }
+    public String getReferrerURL() { return myInfo.referrerUrl; }
 
     public CefRequest.ReferrerPolicy getReferrerPolicy() {
-        String sval = myCache.get("ReferrerPolicy");
-        if (sval != null && !sval.isEmpty()) {
-            try {
-                return CefRequest.ReferrerPolicy.valueOf(sval);
-            } catch (IllegalArgumentException e) {
-                CefLog.Error("getReferrerPolicy: ", e.getMessage());
-            }
-        }
-        return null;// probably REFERRER_POLICY_DEFAULT ?
+        if (!myInfo.isSetReferrerPolicy())
+            return null;
+        // NOTE: REFERRER_POLICY_DEFAULT is the first java constant and it's the alias of cef value 0
+        CefRequest.ReferrerPolicy[] values = CefRequest.ReferrerPolicy.values();
+        final int index = myInfo.referrerPolicy + 1;
+        return index > 0 && index < values.length ? values[index] : null;
     }
 
     public CefPostData getPostData() {
@@ -99,34 +119,37 @@ public class RemoteRequestImpl extends RemoteServerObjectLocal {
         });
     }
 
-    public int getFlags() { return (int)getLongVal("Flags"); }
+    public int getFlags() { return myInfo.flags; }
 
-    public void setFlags(int flags) { setLongVal("Flags", flags); }
+    public void setFlags(int flags) {
+        myInfo.setFlags(flags);
+        myChanges.setFlags(flags);
+        myIsModified = true;
+    }
 
-    public String getFirstPartyForCookies() { return myCache.get("FirstPartyForCookies"); }
+    public String getFirstPartyForCookies() { return myInfo.firstPartyForCookies; }
 
-    public void setFirstPartyForCookies(String url) { setStrVal("FirstPartyForCookies", url); }
+    public void setFirstPartyForCookies(String url) {
+        myInfo.setFirstPartyForCookies(url);
+        myChanges.setFirstPartyForCookies(url);
+        myIsModified = true;
+    }
 
     public CefRequest.ResourceType getResourceType() {
-        String sval = myCache.get("ResourceType");
-        if (sval != null && !sval.isEmpty()) {
-            try {
-                return CefRequest.ResourceType.valueOf(sval);
-            } catch (IllegalArgumentException e) {
-                CefLog.Error("getResourceType: ", e.getMessage());
-            }
-        }
-        return null;
+        if (!myInfo.isSetResourceType())
+            return null;
+        CefRequest.ResourceType[] values = CefRequest.ResourceType.values();
+        final int index = myInfo.resourceType;
+        return index >= 0 && index < values.length ? values[index] : null;
     }
 
     public CefRequest.TransitionType getTransitionType() {
-        String sval = myCache.get("TransitionType");
-        if (sval != null && !sval.isEmpty()) {
-            try {
-                return CefRequest.TransitionType.valueOf(sval);
-            } catch (IllegalArgumentException e) {
-                CefLog.Error("getTransitionType: ", e.getMessage());
-            }
+        if (!myInfo.isSetTransitionType())
+            return null;
+        final int source = myInfo.transitionType & 0xFF;
+        for (CefRequest.TransitionType tt : CefRequest.TransitionType.values()) {
+            if (tt.getSource() == source)
+                return tt;
         }
         return null;
     }
@@ -134,6 +157,12 @@ public class RemoteRequestImpl extends RemoteServerObjectLocal {
     @Override
     public String toString() {
         // TODO: use return CefRequest.toString(this) after debugging
-        return myCache.toString();
+        return myInfo.toString();
+    }
+
+    private static int policy2int(CefRequest.ReferrerPolicy policy) {
+        if (policy == null || policy == CefRequest.ReferrerPolicy.REFERRER_POLICY_DEFAULT)
+            return 0;
+        return policy.ordinal() - 1;
     }
 }
@@ -14,5 +14,14 @@ public class RemoteResourceHandler extends RemoteJavaObject<CefResourceHandler>
         return FACTORY.create((index)->new RemoteResourceHandler(index, delegate));
     }
 
+    private byte[] myReadBuffer;
+
     private RemoteResourceHandler(int id, CefResourceHandler delegate) { super(id, delegate); }
+
+    // Reading is performed sequentially (on server IO thread), so buffer can be reused.
+    public byte[] getReadBuffer(int size) {
+        if (myReadBuffer == null || myReadBuffer.length < size)
+            myReadBuffer = new byte[size];
+        return myReadBuffer;
+    }
 }
@@ -3,8 +3,8 @@ package com.jetbrains.cef.remote.network;
 import com.jetbrains.cef.remote.RpcExecutor;
 import com.jetbrains.cef.remote.RemoteServerObjectLocal;
 import com.jetbrains.cef.remote.thrift_codegen.RObject;
+import com.jetbrains.cef.remote.thrift_codegen.ResponseInfo;
 import org.cef.handler.CefLoadHandler;
-import org.cef.misc.CefLog;
 
 import java.util.Map;
 
@@ -15,45 +15,63 @@ import java.util.Map;
 // moment all requests from java to native will return errors (or default values).
 // Java object will be destroyed via usual gc.
 public class RemoteResponseImpl extends RemoteServerObjectLocal {
+    private final ResponseInfo myInfo;
+    // Modified fields only, sent to server in flush()
+    private final ResponseInfo myChanges = new ResponseInfo();
+    private boolean myIsModified = false;
+
     public RemoteResponseImpl(RpcExecutor server, RObject resp) {
         super(server, resp);
+        myInfo = resp.isSetResponseInfo() ? resp.getResponseInfo() : new ResponseInfo();
     }
 
     public void flush() {
+        if (!myIsModified)
+            return;
+        myIsModified = false;
+        RObject robj = thriftId().setResponseInfo(myChanges.deepCopy());
+        myChanges.clear();
         myServer.exec((s)->{
-            s.Response_Update(thriftIdWithCache());
+            s.Response_Update(robj);
         });
     }
 
-    public boolean isReadOnly() { return getBoolVal("IsReadOnly"); }
+    public boolean isReadOnly() { return myInfo.isReadOnly; }
 
     public CefLoadHandler.ErrorCode getError() {
-        String sval = myCache.get("Error");
-        if (sval != null && !sval.isEmpty()) {
-            try {
-                return CefLoadHandler.ErrorCode.valueOf(sval);
-            } catch (IllegalArgumentException e) {
-                CefLog.Error("getError: ", e.getMessage());
-            }
-        }
-        return CefLoadHandler.ErrorCode.ERR_NONE;
+        CefLoadHandler.ErrorCode result = myInfo.isSetError() ? CefLoadHandler.ErrorCode.findByCode(myInfo.error) : null;
+        return result != null ? result : CefLoadHandler.ErrorCode.ERR_NONE;
     }
 
     public void setError(CefLoadHandler.ErrorCode errorCode) {
-        setLongVal("Error", errorCode.getCode());
+        myInfo.setError(errorCode.getCode());
+        myChanges.setError(errorCode.getCode());
+        myIsModified = true;
     }
 
-    public int getStatus() { return (int)getLongVal("Status"); }
+    public int getStatus() { return myInfo.status; }
 
-    public void setStatus(int status) { setLongVal("Status", status); }
+    public void setStatus(int status) {
+        myInfo.setStatus(status);
+        myChanges.setStatus(status);
+        myIsModified = true;
+    }
 
-    public String getStatusText() { return myCache.get("StatusText"); }
+    public String getStatusText() { return myInfo.statusText; }
 
-    public void setStatusText(String statusText) { setStrVal("StatusText", statusText); }
+    public void setStatusText(String statusText) {
+        myInfo.setStatusText(statusText);
+        myChanges.setStatusText(statusText);
+        myIsModified = true;
+    }
 
-    public String getMimeType() { return myCache.get("MimeType"); }
+    public String getMimeType() { return myInfo.mimeType; }
 
-    public void setMimeType(String mimeType) { setStrVal("MimeType", mimeType); }
+    public void setMimeType(String mimeType) {
+        myInfo.setMimeType(mimeType);
+        myChanges.setMimeType(mimeType);
+        myIsModified = true;
+    }
 
     public String getHeaderByName(String name) {
         return myServer.execObj((s)-> s.Response_GetHeaderByName(thriftId(), name));
@@ -78,6 +96,6 @@ public class RemoteResponseImpl extends RemoteServerObjectLocal {
     @Override
     public String toString() {
         // TODO: use return CefResponse.toString(this) after debugging
-        return myCache.toString();
+        return myInfo.toString();
     }
 }
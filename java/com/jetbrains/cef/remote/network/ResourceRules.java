@@ -0,0 +1,31 @@
+package com.jetbrains.cef.remote.network;
+
+import com.jetbrains.cef.remote.thrift_codegen.ResourceRule;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * Declarative rules for resource requests. Rules are evaluated by server (the first matching rule is applied),
+ * so only requests that match CALL_CLIENT rules (or don't match any rule) are passed to CefRequestHandler.
+ * Url patterns support wildcards: '*' - any substring, '?' - any char.
+ */
+public class ResourceRules {
+    // Must be synchronized with ResourceRules::Action (remote/network/ResourceRules.h)
+    public static final int CALL_CLIENT = 0;    // pass request to java handlers
+    public static final int DEFAULT = 1;        // default handling, java isn't called
+    public static final int CANCEL = 2;         // cancel request
+    public static final int BLOCK_COOKIES = 3;  // default handling without sending and saving cookies
+
+    private final List<ResourceRule> myRules = new ArrayList<>();
+
+    public ResourceRules add(String urlPattern, int action) {
+        myRules.add(new ResourceRule(urlPattern, action));
+        return this;
+    }
+
+    public List<ResourceRule> getRules() {
+        return Collections.unmodifiableList(myRules);
+    }
+}
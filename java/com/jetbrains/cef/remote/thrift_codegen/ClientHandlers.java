@@ -17,14 +17,16 @@ public class ClientHandlers {
 
     public void AppHandler_OnContextInitialized() throws org.apache.thrift.TException;
 
-    public Rect RenderHandler_GetViewRect(int bid) throws org.apache.thrift.TException;
+    public com.jetbrains.cef.remote.thrift_codegen.Rect RenderHandler_GetViewRect(int bid) throws org.apache.thrift.TException;
 
-    public ScreenInfo RenderHandler_GetScreenInfo(int bid) throws org.apache.thrift.TException;
+    public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo RenderHandler_GetScreenInfo(int bid) throws org.apache.thrift.TException;
 
-    public Point RenderHandler_GetScreenPoint(int bid, int viewX, int viewY) throws org.apache.thrift.TException;
+    public com.jetbrains.cef.remote.thrift_codegen.Point RenderHandler_GetScreenPoint(int bid, int viewX, int viewY) throws org.apache.thrift.TException;
 
     public void RenderHandler_OnPaint(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height) throws org.apache.thrift.TException;
 
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) throws org.apache.thrift.TException;
+
     public boolean LifeSpanHandler_OnBeforePopup(int bid, java.lang.String url, java.lang.String frameName, boolean gesture) throws org.apache.thrift.TException;
 
     public void LifeSpanHandler_OnAfterCreated(int bid, int nativeBrowserIdentifier) throws org.apache.thrift.TException;
@@ -95,6 +97,8 @@ public class ClientHandlers {
 
     public com.jetbrains.cef.remote.thrift_codegen.ResponseData ResourceHandler_ReadResponse(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback) throws org.apache.thrift.TException;
 
+    public com.jetbrains.cef.remote.thrift_codegen.ResponseData ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle) throws org.apache.thrift.TException;
+
     public void ResourceHandler_Cancel(int resourceHandler) throws org.apache.thrift.TException;
 
     public java.lang.String ResourceRequestHandler_OnResourceRedirect(int rrHandler, int bid, com.jetbrains.cef.remote.thrift_codegen.RObject request, com.jetbrains.cef.remote.thrift_codegen.RObject response, java.lang.String new_url) throws org.apache.thrift.TException;
@@ -121,14 +125,16 @@ public class ClientHandlers {
 
     public void AppHandler_OnContextInitialized(org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
-    public void RenderHandler_GetViewRect(int bid, org.apache.thrift.async.AsyncMethodCallback<Rect> resultHandler) throws org.apache.thrift.TException;
+    public void RenderHandler_GetViewRect(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect> resultHandler) throws org.apache.thrift.TException;
 
-    public void RenderHandler_GetScreenInfo(int bid, org.apache.thrift.async.AsyncMethodCallback<ScreenInfo> resultHandler) throws org.apache.thrift.TException;
+    public void RenderHandler_GetScreenInfo(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> resultHandler) throws org.apache.thrift.TException;
 
-    public void RenderHandler_GetScreenPoint(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<Point> resultHandler) throws org.apache.thrift.TException;
+    public void RenderHandler_GetScreenPoint(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point> resultHandler) throws org.apache.thrift.TException;
 
     public void RenderHandler_OnPaint(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
+
     public void LifeSpanHandler_OnBeforePopup(int bid, java.lang.String url, java.lang.String frameName, boolean gesture, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException;
 
     public void LifeSpanHandler_OnAfterCreated(int bid, int nativeBrowserIdentifier, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
@@ -199,6 +205,8 @@ public class ClientHandlers {
 
     public void ResourceHandler_ReadResponse(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> resultHandler) throws org.apache.thrift.TException;
 
+    public void ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> resultHandler) throws org.apache.thrift.TException;
+
     public void ResourceHandler_Cancel(int resourceHandler, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
     public void ResourceRequestHandler_OnResourceRedirect(int rrHandler, int bid, com.jetbrains.cef.remote.thrift_codegen.RObject request, com.jetbrains.cef.remote.thrift_codegen.RObject response, java.lang.String new_url, org.apache.thrift.async.AsyncMethodCallback<java.lang.String> resultHandler) throws org.apache.thrift.TException;
@@ -288,7 +296,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public Rect RenderHandler_GetViewRect(int bid) throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.Rect RenderHandler_GetViewRect(int bid) throws org.apache.thrift.TException
     {
       send_RenderHandler_GetViewRect(bid);
       return recv_RenderHandler_GetViewRect();
@@ -301,7 +309,7 @@ public class ClientHandlers {
       sendBase("RenderHandler_GetViewRect", args);
     }
 
-    public Rect recv_RenderHandler_GetViewRect() throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.Rect recv_RenderHandler_GetViewRect() throws org.apache.thrift.TException
     {
       RenderHandler_GetViewRect_result result = new RenderHandler_GetViewRect_result();
       receiveBase(result, "RenderHandler_GetViewRect");
@@ -312,7 +320,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public ScreenInfo RenderHandler_GetScreenInfo(int bid) throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo RenderHandler_GetScreenInfo(int bid) throws org.apache.thrift.TException
     {
       send_RenderHandler_GetScreenInfo(bid);
       return recv_RenderHandler_GetScreenInfo();
@@ -325,7 +333,7 @@ public class ClientHandlers {
       sendBase("RenderHandler_GetScreenInfo", args);
     }
 
-    public ScreenInfo recv_RenderHandler_GetScreenInfo() throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo recv_RenderHandler_GetScreenInfo() throws org.apache.thrift.TException
     {
       RenderHandler_GetScreenInfo_result result = new RenderHandler_GetScreenInfo_result();
       receiveBase(result, "RenderHandler_GetScreenInfo");
@@ -336,7 +344,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public Point RenderHandler_GetScreenPoint(int bid, int viewX, int viewY) throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.Point RenderHandler_GetScreenPoint(int bid, int viewX, int viewY) throws org.apache.thrift.TException
     {
       send_RenderHandler_GetScreenPoint(bid, viewX, viewY);
       return recv_RenderHandler_GetScreenPoint();
@@ -351,7 +359,7 @@ public class ClientHandlers {
       sendBase("RenderHandler_GetScreenPoint", args);
     }
 
-    public Point recv_RenderHandler_GetScreenPoint() throws org.apache.thrift.TException
+    public com.jetbrains.cef.remote.thrift_codegen.Point recv_RenderHandler_GetScreenPoint() throws org.apache.thrift.TException
     {
       RenderHandler_GetScreenPoint_result result = new RenderHandler_GetScreenPoint_result();
       receiveBase(result, "RenderHandler_GetScreenPoint");
@@ -388,6 +396,26 @@ public class ClientHandlers {
       return;
     }
 
+    @Override
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) throws org.apache.thrift.TException
+    {
+      send_RenderHandler_OnPaintAsync(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+    }
+
+    public void send_RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) throws org.apache.thrift.TException
+    {
+      RenderHandler_OnPaintAsync_args args = new RenderHandler_OnPaintAsync_args();
+      args.setBid(bid);
+      args.setPopup(popup);
+      args.setDirtyRectsCount(dirtyRectsCount);
+      args.setSharedMemName(sharedMemName);
+      args.setSharedMemHandle(sharedMemHandle);
+      args.setWidth(width);
+      args.setHeight(height);
+      args.setFrameSeq(frameSeq);
+      sendBaseOneway("RenderHandler_OnPaintAsync", args);
+    }
+
     @Override
     public boolean LifeSpanHandler_OnBeforePopup(int bid, java.lang.String url, java.lang.String frameName, boolean gesture) throws org.apache.thrift.TException
     {
@@ -1126,6 +1154,34 @@ public class ClientHandlers {
       throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "ResourceHandler_ReadResponse failed: unknown result");
     }
 
+    @Override
+    public com.jetbrains.cef.remote.thrift_codegen.ResponseData ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle) throws org.apache.thrift.TException
+    {
+      send_ResourceHandler_ReadResponseShared(resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle);
+      return recv_ResourceHandler_ReadResponseShared();
+    }
+
+    public void send_ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle) throws org.apache.thrift.TException
+    {
+      ResourceHandler_ReadResponseShared_args args = new ResourceHandler_ReadResponseShared_args();
+      args.setResourceHandler(resourceHandler);
+      args.setBytes_to_read(bytes_to_read);
+      args.setCallback(callback);
+      args.setSharedMemName(sharedMemName);
+      args.setSharedMemHandle(sharedMemHandle);
+      sendBase("ResourceHandler_ReadResponseShared", args);
+    }
+
+    public com.jetbrains.cef.remote.thrift_codegen.ResponseData recv_ResourceHandler_ReadResponseShared() throws org.apache.thrift.TException
+    {
+      ResourceHandler_ReadResponseShared_result result = new ResourceHandler_ReadResponseShared_result();
+      receiveBase(result, "ResourceHandler_ReadResponseShared");
+      if (result.isSetSuccess()) {
+        return result.success;
+      }
+      throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "ResourceHandler_ReadResponseShared failed: unknown result");
+    }
+
     @Override
     public void ResourceHandler_Cancel(int resourceHandler) throws org.apache.thrift.TException
     {
@@ -1423,16 +1479,16 @@ public class ClientHandlers {
     }
 
     @Override
-    public void RenderHandler_GetViewRect(int bid, org.apache.thrift.async.AsyncMethodCallback<Rect> resultHandler) throws org.apache.thrift.TException {
+    public void RenderHandler_GetViewRect(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect> resultHandler) throws org.apache.thrift.TException {
       checkReady();
       RenderHandler_GetViewRect_call method_call = new RenderHandler_GetViewRect_call(bid, resultHandler, this, ___protocolFactory, ___transport);
       this.___currentMethod = method_call;
       ___manager.call(method_call);
     }
 
-    public static class RenderHandler_GetViewRect_call extends org.apache.thrift.async.TAsyncMethodCall<Rect> {
+    public static class RenderHandler_GetViewRect_call extends org.apache.thrift.async.TAsyncMethodCall<com.jetbrains.cef.remote.thrift_codegen.Rect> {
       private int bid;
-      public RenderHandler_GetViewRect_call(int bid, org.apache.thrift.async.AsyncMethodCallback<Rect> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+      public RenderHandler_GetViewRect_call(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
         super(client, protocolFactory, transport, resultHandler, false);
         this.bid = bid;
       }
@@ -1447,7 +1503,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public Rect getResult() throws org.apache.thrift.TException {
+      public com.jetbrains.cef.remote.thrift_codegen.Rect getResult() throws org.apache.thrift.TException {
         if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
           throw new java.lang.IllegalStateException("Method call not finished!");
         }
@@ -1458,16 +1514,16 @@ public class ClientHandlers {
     }
 
     @Override
-    public void RenderHandler_GetScreenInfo(int bid, org.apache.thrift.async.AsyncMethodCallback<ScreenInfo> resultHandler) throws org.apache.thrift.TException {
+    public void RenderHandler_GetScreenInfo(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> resultHandler) throws org.apache.thrift.TException {
       checkReady();
       RenderHandler_GetScreenInfo_call method_call = new RenderHandler_GetScreenInfo_call(bid, resultHandler, this, ___protocolFactory, ___transport);
       this.___currentMethod = method_call;
       ___manager.call(method_call);
     }
 
-    public static class RenderHandler_GetScreenInfo_call extends org.apache.thrift.async.TAsyncMethodCall<ScreenInfo> {
+    public static class RenderHandler_GetScreenInfo_call extends org.apache.thrift.async.TAsyncMethodCall<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> {
       private int bid;
-      public RenderHandler_GetScreenInfo_call(int bid, org.apache.thrift.async.AsyncMethodCallback<ScreenInfo> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+      public RenderHandler_GetScreenInfo_call(int bid, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
         super(client, protocolFactory, transport, resultHandler, false);
         this.bid = bid;
       }
@@ -1482,7 +1538,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public ScreenInfo getResult() throws org.apache.thrift.TException {
+      public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo getResult() throws org.apache.thrift.TException {
         if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
           throw new java.lang.IllegalStateException("Method call not finished!");
         }
@@ -1493,18 +1549,18 @@ public class ClientHandlers {
     }
 
     @Override
-    public void RenderHandler_GetScreenPoint(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<Point> resultHandler) throws org.apache.thrift.TException {
+    public void RenderHandler_GetScreenPoint(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point> resultHandler) throws org.apache.thrift.TException {
       checkReady();
       RenderHandler_GetScreenPoint_call method_call = new RenderHandler_GetScreenPoint_call(bid, viewX, viewY, resultHandler, this, ___protocolFactory, ___transport);
       this.___currentMethod = method_call;
       ___manager.call(method_call);
     }
 
-    public static class RenderHandler_GetScreenPoint_call extends org.apache.thrift.async.TAsyncMethodCall<Point> {
+    public static class RenderHandler_GetScreenPoint_call extends org.apache.thrift.async.TAsyncMethodCall<com.jetbrains.cef.remote.thrift_codegen.Point> {
       private int bid;
       private int viewX;
       private int viewY;
-      public RenderHandler_GetScreenPoint_call(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<Point> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+      public RenderHandler_GetScreenPoint_call(int bid, int viewX, int viewY, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
         super(client, protocolFactory, transport, resultHandler, false);
         this.bid = bid;
         this.viewX = viewX;
@@ -1523,7 +1579,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public Point getResult() throws org.apache.thrift.TException {
+      public com.jetbrains.cef.remote.thrift_codegen.Point getResult() throws org.apache.thrift.TException {
         if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
           throw new java.lang.IllegalStateException("Method call not finished!");
         }
@@ -1587,6 +1643,62 @@ public class ClientHandlers {
       }
     }
 
+    @Override
+    public void RenderHandler_OnPaintAsync(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      RenderHandler_OnPaintAsync_call method_call = new RenderHandler_OnPaintAsync_call(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class RenderHandler_OnPaintAsync_call extends org.apache.thrift.async.TAsyncMethodCall<Void> {
+      private int bid;
+      private boolean popup;
+      private int dirtyRectsCount;
+      private java.lang.String sharedMemName;
+      private long sharedMemHandle;
+      private int width;
+      private int height;
+      private long frameSeq;
+      public RenderHandler_OnPaintAsync_call(int bid, boolean popup, int dirtyRectsCount, java.lang.String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, true);
+        this.bid = bid;
+        this.popup = popup;
+        this.dirtyRectsCount = dirtyRectsCount;
+        this.sharedMemName = sharedMemName;
+        this.sharedMemHandle = sharedMemHandle;
+        this.width = width;
+        this.height = height;
+        this.frameSeq = frameSeq;
+      }
+
+      @Override
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("RenderHandler_OnPaintAsync", org.apache.thrift.protocol.TMessageType.ONEWAY, 0));
+        RenderHandler_OnPaintAsync_args args = new RenderHandler_OnPaintAsync_args();
+        args.setBid(bid);
+        args.setPopup(popup);
+        args.setDirtyRectsCount(dirtyRectsCount);
+        args.setSharedMemName(sharedMemName);
+        args.setSharedMemHandle(sharedMemHandle);
+        args.setWidth(width);
+        args.setHeight(height);
+        args.setFrameSeq(frameSeq);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      @Override
+      public Void getResult() throws org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new java.lang.IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return null;
+      }
+    }
+
     @Override
     public void LifeSpanHandler_OnBeforePopup(int bid, java.lang.String url, java.lang.String frameName, boolean gesture, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
       checkReady();
@@ -3001,6 +3113,53 @@ public class ClientHandlers {
       }
     }
 
+    @Override
+    public void ResourceHandler_ReadResponseShared(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      ResourceHandler_ReadResponseShared_call method_call = new ResourceHandler_ReadResponseShared_call(resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class ResourceHandler_ReadResponseShared_call extends org.apache.thrift.async.TAsyncMethodCall<com.jetbrains.cef.remote.thrift_codegen.ResponseData> {
+      private int resourceHandler;
+      private int bytes_to_read;
+      private com.jetbrains.cef.remote.thrift_codegen.RObject callback;
+      private java.lang.String sharedMemName;
+      private long sharedMemHandle;
+      public ResourceHandler_ReadResponseShared_call(int resourceHandler, int bytes_to_read, com.jetbrains.cef.remote.thrift_codegen.RObject callback, java.lang.String sharedMemName, long sharedMemHandle, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, false);
+        this.resourceHandler = resourceHandler;
+        this.bytes_to_read = bytes_to_read;
+        this.callback = callback;
+        this.sharedMemName = sharedMemName;
+        this.sharedMemHandle = sharedMemHandle;
+      }
+
+      @Override
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("ResourceHandler_ReadResponseShared", org.apache.thrift.protocol.TMessageType.CALL, 0));
+        ResourceHandler_ReadResponseShared_args args = new ResourceHandler_ReadResponseShared_args();
+        args.setResourceHandler(resourceHandler);
+        args.setBytes_to_read(bytes_to_read);
+        args.setCallback(callback);
+        args.setSharedMemName(sharedMemName);
+        args.setSharedMemHandle(sharedMemHandle);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      @Override
+      public com.jetbrains.cef.remote.thrift_codegen.ResponseData getResult() throws org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new java.lang.IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return (new Client(prot)).recv_ResourceHandler_ReadResponseShared();
+      }
+    }
+
     @Override
     public void ResourceHandler_Cancel(int resourceHandler, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
       checkReady();
@@ -3368,6 +3527,7 @@ public class ClientHandlers {
       processMap.put("RenderHandler_GetScreenInfo", new RenderHandler_GetScreenInfo());
       processMap.put("RenderHandler_GetScreenPoint", new RenderHandler_GetScreenPoint());
       processMap.put("RenderHandler_OnPaint", new RenderHandler_OnPaint());
+      processMap.put("RenderHandler_OnPaintAsync", new RenderHandler_OnPaintAsync());
       processMap.put("LifeSpanHandler_OnBeforePopup", new LifeSpanHandler_OnBeforePopup());
       processMap.put("LifeSpanHandler_OnAfterCreated", new LifeSpanHandler_OnAfterCreated());
       processMap.put("LifeSpanHandler_DoClose", new LifeSpanHandler_DoClose());
@@ -3403,6 +3563,7 @@ public class ClientHandlers {
       processMap.put("ResourceHandler_ProcessRequest", new ResourceHandler_ProcessRequest());
       processMap.put("ResourceHandler_GetResponseHeaders", new ResourceHandler_GetResponseHeaders());
       processMap.put("ResourceHandler_ReadResponse", new ResourceHandler_ReadResponse());
+      processMap.put("ResourceHandler_ReadResponseShared", new ResourceHandler_ReadResponseShared());
       processMap.put("ResourceHandler_Cancel", new ResourceHandler_Cancel());
       processMap.put("ResourceRequestHandler_OnResourceRedirect", new ResourceRequestHandler_OnResourceRedirect());
       processMap.put("ResourceRequestHandler_OnResourceResponse", new ResourceRequestHandler_OnResourceResponse());
@@ -3609,6 +3770,33 @@ public class ClientHandlers {
       }
     }
 
+    public static class RenderHandler_OnPaintAsync<I extends Iface> extends org.apache.thrift.ProcessFunction<I, RenderHandler_OnPaintAsync_args> {
+      public RenderHandler_OnPaintAsync() {
+        super("RenderHandler_OnPaintAsync");
+      }
+
+      @Override
+      public RenderHandler_OnPaintAsync_args getEmptyArgsInstance() {
+        return new RenderHandler_OnPaintAsync_args();
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      protected boolean rethrowUnhandledExceptions() {
+        return false;
+      }
+
+      @Override
+      public org.apache.thrift.TBase getResult(I iface, RenderHandler_OnPaintAsync_args args) throws org.apache.thrift.TException {
+        iface.RenderHandler_OnPaintAsync(args.bid, args.popup, args.dirtyRectsCount, args.sharedMemName, args.sharedMemHandle, args.width, args.height, args.frameSeq);
+        return null;
+      }
+    }
+
     public static class LifeSpanHandler_OnBeforePopup<I extends Iface> extends org.apache.thrift.ProcessFunction<I, LifeSpanHandler_OnBeforePopup_args> {
       public LifeSpanHandler_OnBeforePopup() {
         super("LifeSpanHandler_OnBeforePopup");
@@ -4589,6 +4777,34 @@ public class ClientHandlers {
       }
     }
 
+    public static class ResourceHandler_ReadResponseShared<I extends Iface> extends org.apache.thrift.ProcessFunction<I, ResourceHandler_ReadResponseShared_args> {
+      public ResourceHandler_ReadResponseShared() {
+        super("ResourceHandler_ReadResponseShared");
+      }
+
+      @Override
+      public ResourceHandler_ReadResponseShared_args getEmptyArgsInstance() {
+        return new ResourceHandler_ReadResponseShared_args();
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      protected boolean rethrowUnhandledExceptions() {
+        return false;
+      }
+
+      @Override
+      public ResourceHandler_ReadResponseShared_result getResult(I iface, ResourceHandler_ReadResponseShared_args args) throws org.apache.thrift.TException {
+        ResourceHandler_ReadResponseShared_result result = new ResourceHandler_ReadResponseShared_result();
+        result.success = iface.ResourceHandler_ReadResponseShared(args.resourceHandler, args.bytes_to_read, args.callback, args.sharedMemName, args.sharedMemHandle);
+        return result;
+      }
+    }
+
     public static class ResourceHandler_Cancel<I extends Iface> extends org.apache.thrift.ProcessFunction<I, ResourceHandler_Cancel_args> {
       public ResourceHandler_Cancel() {
         super("ResourceHandler_Cancel");
@@ -4833,6 +5049,7 @@ public class ClientHandlers {
       processMap.put("RenderHandler_GetScreenInfo", new RenderHandler_GetScreenInfo());
       processMap.put("RenderHandler_GetScreenPoint", new RenderHandler_GetScreenPoint());
       processMap.put("RenderHandler_OnPaint", new RenderHandler_OnPaint());
+      processMap.put("RenderHandler_OnPaintAsync", new RenderHandler_OnPaintAsync());
       processMap.put("LifeSpanHandler_OnBeforePopup", new LifeSpanHandler_OnBeforePopup());
       processMap.put("LifeSpanHandler_OnAfterCreated", new LifeSpanHandler_OnAfterCreated());
       processMap.put("LifeSpanHandler_DoClose", new LifeSpanHandler_DoClose());
@@ -4868,6 +5085,7 @@ public class ClientHandlers {
       processMap.put("ResourceHandler_ProcessRequest", new ResourceHandler_ProcessRequest());
       processMap.put("ResourceHandler_GetResponseHeaders", new ResourceHandler_GetResponseHeaders());
       processMap.put("ResourceHandler_ReadResponse", new ResourceHandler_ReadResponse());
+      processMap.put("ResourceHandler_ReadResponseShared", new ResourceHandler_ReadResponseShared());
       processMap.put("ResourceHandler_Cancel", new ResourceHandler_Cancel());
       processMap.put("ResourceRequestHandler_OnResourceRedirect", new ResourceRequestHandler_OnResourceRedirect());
       processMap.put("ResourceRequestHandler_OnResourceResponse", new ResourceRequestHandler_OnResourceResponse());
@@ -5027,7 +5245,7 @@ public class ClientHandlers {
       }
     }
 
-    public static class RenderHandler_GetViewRect<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetViewRect_args, Rect> {
+    public static class RenderHandler_GetViewRect<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetViewRect_args, com.jetbrains.cef.remote.thrift_codegen.Rect> {
       public RenderHandler_GetViewRect() {
         super("RenderHandler_GetViewRect");
       }
@@ -5038,11 +5256,11 @@ public class ClientHandlers {
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<Rect> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<Rect>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect>() { 
           @Override
-          public void onComplete(Rect o) {
+          public void onComplete(com.jetbrains.cef.remote.thrift_codegen.Rect o) {
             RenderHandler_GetViewRect_result result = new RenderHandler_GetViewRect_result();
             result.success = o;
             try {
@@ -5089,12 +5307,12 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, RenderHandler_GetViewRect_args args, org.apache.thrift.async.AsyncMethodCallback<Rect> resultHandler) throws org.apache.thrift.TException {
+      public void start(I iface, RenderHandler_GetViewRect_args args, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Rect> resultHandler) throws org.apache.thrift.TException {
         iface.RenderHandler_GetViewRect(args.bid,resultHandler);
       }
     }
 
-    public static class RenderHandler_GetScreenInfo<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetScreenInfo_args, ScreenInfo> {
+    public static class RenderHandler_GetScreenInfo<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetScreenInfo_args, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> {
       public RenderHandler_GetScreenInfo() {
         super("RenderHandler_GetScreenInfo");
       }
@@ -5105,11 +5323,11 @@ public class ClientHandlers {
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<ScreenInfo> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<ScreenInfo>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo>() { 
           @Override
-          public void onComplete(ScreenInfo o) {
+          public void onComplete(com.jetbrains.cef.remote.thrift_codegen.ScreenInfo o) {
             RenderHandler_GetScreenInfo_result result = new RenderHandler_GetScreenInfo_result();
             result.success = o;
             try {
@@ -5156,12 +5374,12 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, RenderHandler_GetScreenInfo_args args, org.apache.thrift.async.AsyncMethodCallback<ScreenInfo> resultHandler) throws org.apache.thrift.TException {
+      public void start(I iface, RenderHandler_GetScreenInfo_args args, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ScreenInfo> resultHandler) throws org.apache.thrift.TException {
         iface.RenderHandler_GetScreenInfo(args.bid,resultHandler);
       }
     }
 
-    public static class RenderHandler_GetScreenPoint<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetScreenPoint_args, Point> {
+    public static class RenderHandler_GetScreenPoint<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_GetScreenPoint_args, com.jetbrains.cef.remote.thrift_codegen.Point> {
       public RenderHandler_GetScreenPoint() {
         super("RenderHandler_GetScreenPoint");
       }
@@ -5172,11 +5390,11 @@ public class ClientHandlers {
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<Point> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<Point>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point>() { 
           @Override
-          public void onComplete(Point o) {
+          public void onComplete(com.jetbrains.cef.remote.thrift_codegen.Point o) {
             RenderHandler_GetScreenPoint_result result = new RenderHandler_GetScreenPoint_result();
             result.success = o;
             try {
@@ -5223,7 +5441,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, RenderHandler_GetScreenPoint_args args, org.apache.thrift.async.AsyncMethodCallback<Point> resultHandler) throws org.apache.thrift.TException {
+      public void start(I iface, RenderHandler_GetScreenPoint_args args, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.Point> resultHandler) throws org.apache.thrift.TException {
         iface.RenderHandler_GetScreenPoint(args.bid, args.viewX, args.viewY,resultHandler);
       }
     }
@@ -5294,82 +5512,14 @@ public class ClientHandlers {
       }
     }
 
-    public static class LifeSpanHandler_OnBeforePopup<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnBeforePopup_args, java.lang.Boolean> {
-      public LifeSpanHandler_OnBeforePopup() {
-        super("LifeSpanHandler_OnBeforePopup");
+    public static class RenderHandler_OnPaintAsync<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, RenderHandler_OnPaintAsync_args, Void> {
+      public RenderHandler_OnPaintAsync() {
+        super("RenderHandler_OnPaintAsync");
       }
 
       @Override
-      public LifeSpanHandler_OnBeforePopup_args getEmptyArgsInstance() {
-        return new LifeSpanHandler_OnBeforePopup_args();
-      }
-
-      @Override
-      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
-        final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
-          @Override
-          public void onComplete(java.lang.Boolean o) {
-            LifeSpanHandler_OnBeforePopup_result result = new LifeSpanHandler_OnBeforePopup_result();
-            result.success = o;
-            result.setSuccessIsSet(true);
-            try {
-              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
-            } catch (org.apache.thrift.transport.TTransportException e) {
-              _LOGGER.error("TTransportException writing to internal frame buffer", e);
-              fb.close();
-            } catch (java.lang.Exception e) {
-              _LOGGER.error("Exception writing to internal frame buffer", e);
-              onError(e);
-            }
-          }
-          @Override
-          public void onError(java.lang.Exception e) {
-            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
-            org.apache.thrift.TSerializable msg;
-            LifeSpanHandler_OnBeforePopup_result result = new LifeSpanHandler_OnBeforePopup_result();
-            if (e instanceof org.apache.thrift.transport.TTransportException) {
-              _LOGGER.error("TTransportException inside handler", e);
-              fb.close();
-              return;
-            } else if (e instanceof org.apache.thrift.TApplicationException) {
-              _LOGGER.error("TApplicationException inside handler", e);
-              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
-              msg = (org.apache.thrift.TApplicationException)e;
-            } else {
-              _LOGGER.error("Exception inside handler", e);
-              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
-              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
-            }
-            try {
-              fcall.sendResponse(fb,msg,msgType,seqid);
-            } catch (java.lang.Exception ex) {
-              _LOGGER.error("Exception writing to internal frame buffer", ex);
-              fb.close();
-            }
-          }
-        };
-      }
-
-      @Override
-      protected boolean isOneway() {
-        return false;
-      }
-
-      @Override
-      public void start(I iface, LifeSpanHandler_OnBeforePopup_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
-        iface.LifeSpanHandler_OnBeforePopup(args.bid, args.url, args.frameName, args.gesture,resultHandler);
-      }
-    }
-
-    public static class LifeSpanHandler_OnAfterCreated<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnAfterCreated_args, Void> {
-      public LifeSpanHandler_OnAfterCreated() {
-        super("LifeSpanHandler_OnAfterCreated");
-      }
-
-      @Override
-      public LifeSpanHandler_OnAfterCreated_args getEmptyArgsInstance() {
-        return new LifeSpanHandler_OnAfterCreated_args();
+      public RenderHandler_OnPaintAsync_args getEmptyArgsInstance() {
+        return new RenderHandler_OnPaintAsync_args();
       }
 
       @Override
@@ -5397,19 +5547,19 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, LifeSpanHandler_OnAfterCreated_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
-        iface.LifeSpanHandler_OnAfterCreated(args.bid, args.nativeBrowserIdentifier,resultHandler);
+      public void start(I iface, RenderHandler_OnPaintAsync_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.RenderHandler_OnPaintAsync(args.bid, args.popup, args.dirtyRectsCount, args.sharedMemName, args.sharedMemHandle, args.width, args.height, args.frameSeq,resultHandler);
       }
     }
 
-    public static class LifeSpanHandler_DoClose<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_DoClose_args, java.lang.Boolean> {
-      public LifeSpanHandler_DoClose() {
-        super("LifeSpanHandler_DoClose");
+    public static class LifeSpanHandler_OnBeforePopup<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnBeforePopup_args, java.lang.Boolean> {
+      public LifeSpanHandler_OnBeforePopup() {
+        super("LifeSpanHandler_OnBeforePopup");
       }
 
       @Override
-      public LifeSpanHandler_DoClose_args getEmptyArgsInstance() {
-        return new LifeSpanHandler_DoClose_args();
+      public LifeSpanHandler_OnBeforePopup_args getEmptyArgsInstance() {
+        return new LifeSpanHandler_OnBeforePopup_args();
       }
 
       @Override
@@ -5418,7 +5568,7 @@ public class ClientHandlers {
         return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
           @Override
           public void onComplete(java.lang.Boolean o) {
-            LifeSpanHandler_DoClose_result result = new LifeSpanHandler_DoClose_result();
+            LifeSpanHandler_OnBeforePopup_result result = new LifeSpanHandler_OnBeforePopup_result();
             result.success = o;
             result.setSuccessIsSet(true);
             try {
@@ -5435,7 +5585,7 @@ public class ClientHandlers {
           public void onError(java.lang.Exception e) {
             byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
             org.apache.thrift.TSerializable msg;
-            LifeSpanHandler_DoClose_result result = new LifeSpanHandler_DoClose_result();
+            LifeSpanHandler_OnBeforePopup_result result = new LifeSpanHandler_OnBeforePopup_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
@@ -5465,19 +5615,127 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, LifeSpanHandler_DoClose_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
-        iface.LifeSpanHandler_DoClose(args.bid,resultHandler);
+      public void start(I iface, LifeSpanHandler_OnBeforePopup_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
+        iface.LifeSpanHandler_OnBeforePopup(args.bid, args.url, args.frameName, args.gesture,resultHandler);
       }
     }
 
-    public static class LifeSpanHandler_OnBeforeClose<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnBeforeClose_args, Void> {
-      public LifeSpanHandler_OnBeforeClose() {
-        super("LifeSpanHandler_OnBeforeClose");
+    public static class LifeSpanHandler_OnAfterCreated<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnAfterCreated_args, Void> {
+      public LifeSpanHandler_OnAfterCreated() {
+        super("LifeSpanHandler_OnAfterCreated");
       }
 
       @Override
-      public LifeSpanHandler_OnBeforeClose_args getEmptyArgsInstance() {
-        return new LifeSpanHandler_OnBeforeClose_args();
+      public LifeSpanHandler_OnAfterCreated_args getEmptyArgsInstance() {
+        return new LifeSpanHandler_OnAfterCreated_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
+          @Override
+          public void onComplete(Void o) {
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+            } else {
+              _LOGGER.error("Exception inside oneway handler", e);
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      public void start(I iface, LifeSpanHandler_OnAfterCreated_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.LifeSpanHandler_OnAfterCreated(args.bid, args.nativeBrowserIdentifier,resultHandler);
+      }
+    }
+
+    public static class LifeSpanHandler_DoClose<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_DoClose_args, java.lang.Boolean> {
+      public LifeSpanHandler_DoClose() {
+        super("LifeSpanHandler_DoClose");
+      }
+
+      @Override
+      public LifeSpanHandler_DoClose_args getEmptyArgsInstance() {
+        return new LifeSpanHandler_DoClose_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
+          @Override
+          public void onComplete(java.lang.Boolean o) {
+            LifeSpanHandler_DoClose_result result = new LifeSpanHandler_DoClose_result();
+            result.success = o;
+            result.setSuccessIsSet(true);
+            try {
+              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
+            } catch (org.apache.thrift.transport.TTransportException e) {
+              _LOGGER.error("TTransportException writing to internal frame buffer", e);
+              fb.close();
+            } catch (java.lang.Exception e) {
+              _LOGGER.error("Exception writing to internal frame buffer", e);
+              onError(e);
+            }
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
+            org.apache.thrift.TSerializable msg;
+            LifeSpanHandler_DoClose_result result = new LifeSpanHandler_DoClose_result();
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+              return;
+            } else if (e instanceof org.apache.thrift.TApplicationException) {
+              _LOGGER.error("TApplicationException inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = (org.apache.thrift.TApplicationException)e;
+            } else {
+              _LOGGER.error("Exception inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
+            }
+            try {
+              fcall.sendResponse(fb,msg,msgType,seqid);
+            } catch (java.lang.Exception ex) {
+              _LOGGER.error("Exception writing to internal frame buffer", ex);
+              fb.close();
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      public void start(I iface, LifeSpanHandler_DoClose_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
+        iface.LifeSpanHandler_DoClose(args.bid,resultHandler);
+      }
+    }
+
+    public static class LifeSpanHandler_OnBeforeClose<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, LifeSpanHandler_OnBeforeClose_args, Void> {
+      public LifeSpanHandler_OnBeforeClose() {
+        super("LifeSpanHandler_OnBeforeClose");
+      }
+
+      @Override
+      public LifeSpanHandler_OnBeforeClose_args getEmptyArgsInstance() {
+        return new LifeSpanHandler_OnBeforeClose_args();
       }
 
       @Override
@@ -7249,63 +7507,23 @@ public class ClientHandlers {
       }
     }
 
-    public static class ResourceHandler_Cancel<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceHandler_Cancel_args, Void> {
-      public ResourceHandler_Cancel() {
-        super("ResourceHandler_Cancel");
-      }
-
-      @Override
-      public ResourceHandler_Cancel_args getEmptyArgsInstance() {
-        return new ResourceHandler_Cancel_args();
-      }
-
-      @Override
-      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
-        final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
-          @Override
-          public void onComplete(Void o) {
-          }
-          @Override
-          public void onError(java.lang.Exception e) {
-            if (e instanceof org.apache.thrift.transport.TTransportException) {
-              _LOGGER.error("TTransportException inside handler", e);
-              fb.close();
-            } else {
-              _LOGGER.error("Exception inside oneway handler", e);
-            }
-          }
-        };
-      }
-
-      @Override
-      protected boolean isOneway() {
-        return true;
-      }
-
-      @Override
-      public void start(I iface, ResourceHandler_Cancel_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
-        iface.ResourceHandler_Cancel(args.resourceHandler,resultHandler);
-      }
-    }
-
-    public static class ResourceRequestHandler_OnResourceRedirect<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceRedirect_args, java.lang.String> {
-      public ResourceRequestHandler_OnResourceRedirect() {
-        super("ResourceRequestHandler_OnResourceRedirect");
+    public static class ResourceHandler_ReadResponseShared<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceHandler_ReadResponseShared_args, com.jetbrains.cef.remote.thrift_codegen.ResponseData> {
+      public ResourceHandler_ReadResponseShared() {
+        super("ResourceHandler_ReadResponseShared");
       }
 
       @Override
-      public ResourceRequestHandler_OnResourceRedirect_args getEmptyArgsInstance() {
-        return new ResourceRequestHandler_OnResourceRedirect_args();
+      public ResourceHandler_ReadResponseShared_args getEmptyArgsInstance() {
+        return new ResourceHandler_ReadResponseShared_args();
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<java.lang.String> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.String>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData>() { 
           @Override
-          public void onComplete(java.lang.String o) {
-            ResourceRequestHandler_OnResourceRedirect_result result = new ResourceRequestHandler_OnResourceRedirect_result();
+          public void onComplete(com.jetbrains.cef.remote.thrift_codegen.ResponseData o) {
+            ResourceHandler_ReadResponseShared_result result = new ResourceHandler_ReadResponseShared_result();
             result.success = o;
             try {
               fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
@@ -7321,7 +7539,7 @@ public class ClientHandlers {
           public void onError(java.lang.Exception e) {
             byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
             org.apache.thrift.TSerializable msg;
-            ResourceRequestHandler_OnResourceRedirect_result result = new ResourceRequestHandler_OnResourceRedirect_result();
+            ResourceHandler_ReadResponseShared_result result = new ResourceHandler_ReadResponseShared_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
@@ -7351,63 +7569,35 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, ResourceRequestHandler_OnResourceRedirect_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.String> resultHandler) throws org.apache.thrift.TException {
-        iface.ResourceRequestHandler_OnResourceRedirect(args.rrHandler, args.bid, args.request, args.response, args.new_url,resultHandler);
+      public void start(I iface, ResourceHandler_ReadResponseShared_args args, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ResponseData> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceHandler_ReadResponseShared(args.resourceHandler, args.bytes_to_read, args.callback, args.sharedMemName, args.sharedMemHandle,resultHandler);
       }
     }
 
-    public static class ResourceRequestHandler_OnResourceResponse<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceResponse_args, java.lang.Boolean> {
-      public ResourceRequestHandler_OnResourceResponse() {
-        super("ResourceRequestHandler_OnResourceResponse");
+    public static class ResourceHandler_Cancel<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceHandler_Cancel_args, Void> {
+      public ResourceHandler_Cancel() {
+        super("ResourceHandler_Cancel");
       }
 
       @Override
-      public ResourceRequestHandler_OnResourceResponse_args getEmptyArgsInstance() {
-        return new ResourceRequestHandler_OnResourceResponse_args();
+      public ResourceHandler_Cancel_args getEmptyArgsInstance() {
+        return new ResourceHandler_Cancel_args();
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
           @Override
-          public void onComplete(java.lang.Boolean o) {
-            ResourceRequestHandler_OnResourceResponse_result result = new ResourceRequestHandler_OnResourceResponse_result();
-            result.success = o;
-            result.setSuccessIsSet(true);
-            try {
-              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
-            } catch (org.apache.thrift.transport.TTransportException e) {
-              _LOGGER.error("TTransportException writing to internal frame buffer", e);
-              fb.close();
-            } catch (java.lang.Exception e) {
-              _LOGGER.error("Exception writing to internal frame buffer", e);
-              onError(e);
-            }
+          public void onComplete(Void o) {
           }
           @Override
           public void onError(java.lang.Exception e) {
-            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
-            org.apache.thrift.TSerializable msg;
-            ResourceRequestHandler_OnResourceResponse_result result = new ResourceRequestHandler_OnResourceResponse_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
-              return;
-            } else if (e instanceof org.apache.thrift.TApplicationException) {
-              _LOGGER.error("TApplicationException inside handler", e);
-              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
-              msg = (org.apache.thrift.TApplicationException)e;
             } else {
-              _LOGGER.error("Exception inside handler", e);
-              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
-              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
-            }
-            try {
-              fcall.sendResponse(fb,msg,msgType,seqid);
-            } catch (java.lang.Exception ex) {
-              _LOGGER.error("Exception writing to internal frame buffer", ex);
-              fb.close();
+              _LOGGER.error("Exception inside oneway handler", e);
             }
           }
         };
@@ -7415,32 +7605,33 @@ public class ClientHandlers {
 
       @Override
       protected boolean isOneway() {
-        return false;
+        return true;
       }
 
       @Override
-      public void start(I iface, ResourceRequestHandler_OnResourceResponse_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
-        iface.ResourceRequestHandler_OnResourceResponse(args.rrHandler, args.bid, args.request, args.response,resultHandler);
+      public void start(I iface, ResourceHandler_Cancel_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceHandler_Cancel(args.resourceHandler,resultHandler);
       }
     }
 
-    public static class ResourceRequestHandler_OnResourceLoadComplete<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceLoadComplete_args, Void> {
-      public ResourceRequestHandler_OnResourceLoadComplete() {
-        super("ResourceRequestHandler_OnResourceLoadComplete");
+    public static class ResourceRequestHandler_OnResourceRedirect<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceRedirect_args, java.lang.String> {
+      public ResourceRequestHandler_OnResourceRedirect() {
+        super("ResourceRequestHandler_OnResourceRedirect");
       }
 
       @Override
-      public ResourceRequestHandler_OnResourceLoadComplete_args getEmptyArgsInstance() {
-        return new ResourceRequestHandler_OnResourceLoadComplete_args();
+      public ResourceRequestHandler_OnResourceRedirect_args getEmptyArgsInstance() {
+        return new ResourceRequestHandler_OnResourceRedirect_args();
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<java.lang.String> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.String>() { 
           @Override
-          public void onComplete(Void o) {
-            ResourceRequestHandler_OnResourceLoadComplete_result result = new ResourceRequestHandler_OnResourceLoadComplete_result();
+          public void onComplete(java.lang.String o) {
+            ResourceRequestHandler_OnResourceRedirect_result result = new ResourceRequestHandler_OnResourceRedirect_result();
+            result.success = o;
             try {
               fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
             } catch (org.apache.thrift.transport.TTransportException e) {
@@ -7455,7 +7646,7 @@ public class ClientHandlers {
           public void onError(java.lang.Exception e) {
             byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
             org.apache.thrift.TSerializable msg;
-            ResourceRequestHandler_OnResourceLoadComplete_result result = new ResourceRequestHandler_OnResourceLoadComplete_result();
+            ResourceRequestHandler_OnResourceRedirect_result result = new ResourceRequestHandler_OnResourceRedirect_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
@@ -7485,19 +7676,19 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, ResourceRequestHandler_OnResourceLoadComplete_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
-        iface.ResourceRequestHandler_OnResourceLoadComplete(args.rrHandler, args.bid, args.request, args.response, args.status, args.receivedContentLength,resultHandler);
+      public void start(I iface, ResourceRequestHandler_OnResourceRedirect_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.String> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceRequestHandler_OnResourceRedirect(args.rrHandler, args.bid, args.request, args.response, args.new_url,resultHandler);
       }
     }
 
-    public static class ResourceRequestHandler_OnProtocolExecution<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnProtocolExecution_args, java.lang.Boolean> {
-      public ResourceRequestHandler_OnProtocolExecution() {
-        super("ResourceRequestHandler_OnProtocolExecution");
+    public static class ResourceRequestHandler_OnResourceResponse<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceResponse_args, java.lang.Boolean> {
+      public ResourceRequestHandler_OnResourceResponse() {
+        super("ResourceRequestHandler_OnResourceResponse");
       }
 
       @Override
-      public ResourceRequestHandler_OnProtocolExecution_args getEmptyArgsInstance() {
-        return new ResourceRequestHandler_OnProtocolExecution_args();
+      public ResourceRequestHandler_OnResourceResponse_args getEmptyArgsInstance() {
+        return new ResourceRequestHandler_OnResourceResponse_args();
       }
 
       @Override
@@ -7506,7 +7697,7 @@ public class ClientHandlers {
         return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
           @Override
           public void onComplete(java.lang.Boolean o) {
-            ResourceRequestHandler_OnProtocolExecution_result result = new ResourceRequestHandler_OnProtocolExecution_result();
+            ResourceRequestHandler_OnResourceResponse_result result = new ResourceRequestHandler_OnResourceResponse_result();
             result.success = o;
             result.setSuccessIsSet(true);
             try {
@@ -7523,7 +7714,7 @@ public class ClientHandlers {
           public void onError(java.lang.Exception e) {
             byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
             org.apache.thrift.TSerializable msg;
-            ResourceRequestHandler_OnProtocolExecution_result result = new ResourceRequestHandler_OnProtocolExecution_result();
+            ResourceRequestHandler_OnResourceResponse_result result = new ResourceRequestHandler_OnResourceResponse_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
@@ -7553,30 +7744,28 @@ public class ClientHandlers {
       }
 
       @Override
-      public void start(I iface, ResourceRequestHandler_OnProtocolExecution_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
-        iface.ResourceRequestHandler_OnProtocolExecution(args.rrHandler, args.bid, args.request, args.allowOsExecution,resultHandler);
+      public void start(I iface, ResourceRequestHandler_OnResourceResponse_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceRequestHandler_OnResourceResponse(args.rrHandler, args.bid, args.request, args.response,resultHandler);
       }
     }
 
-    public static class MessageRouterHandler_onQuery<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, MessageRouterHandler_onQuery_args, java.lang.Boolean> {
-      public MessageRouterHandler_onQuery() {
-        super("MessageRouterHandler_onQuery");
+    public static class ResourceRequestHandler_OnResourceLoadComplete<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnResourceLoadComplete_args, Void> {
+      public ResourceRequestHandler_OnResourceLoadComplete() {
+        super("ResourceRequestHandler_OnResourceLoadComplete");
       }
 
       @Override
-      public MessageRouterHandler_onQuery_args getEmptyArgsInstance() {
-        return new MessageRouterHandler_onQuery_args();
+      public ResourceRequestHandler_OnResourceLoadComplete_args getEmptyArgsInstance() {
+        return new ResourceRequestHandler_OnResourceLoadComplete_args();
       }
 
       @Override
-      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
         final org.apache.thrift.AsyncProcessFunction fcall = this;
-        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
+        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
           @Override
-          public void onComplete(java.lang.Boolean o) {
-            MessageRouterHandler_onQuery_result result = new MessageRouterHandler_onQuery_result();
-            result.success = o;
-            result.setSuccessIsSet(true);
+          public void onComplete(Void o) {
+            ResourceRequestHandler_OnResourceLoadComplete_result result = new ResourceRequestHandler_OnResourceLoadComplete_result();
             try {
               fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
             } catch (org.apache.thrift.transport.TTransportException e) {
@@ -7591,7 +7780,143 @@ public class ClientHandlers {
           public void onError(java.lang.Exception e) {
             byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
             org.apache.thrift.TSerializable msg;
-            MessageRouterHandler_onQuery_result result = new MessageRouterHandler_onQuery_result();
+            ResourceRequestHandler_OnResourceLoadComplete_result result = new ResourceRequestHandler_OnResourceLoadComplete_result();
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+              return;
+            } else if (e instanceof org.apache.thrift.TApplicationException) {
+              _LOGGER.error("TApplicationException inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = (org.apache.thrift.TApplicationException)e;
+            } else {
+              _LOGGER.error("Exception inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
+            }
+            try {
+              fcall.sendResponse(fb,msg,msgType,seqid);
+            } catch (java.lang.Exception ex) {
+              _LOGGER.error("Exception writing to internal frame buffer", ex);
+              fb.close();
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      public void start(I iface, ResourceRequestHandler_OnResourceLoadComplete_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceRequestHandler_OnResourceLoadComplete(args.rrHandler, args.bid, args.request, args.response, args.status, args.receivedContentLength,resultHandler);
+      }
+    }
+
+    public static class ResourceRequestHandler_OnProtocolExecution<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, ResourceRequestHandler_OnProtocolExecution_args, java.lang.Boolean> {
+      public ResourceRequestHandler_OnProtocolExecution() {
+        super("ResourceRequestHandler_OnProtocolExecution");
+      }
+
+      @Override
+      public ResourceRequestHandler_OnProtocolExecution_args getEmptyArgsInstance() {
+        return new ResourceRequestHandler_OnProtocolExecution_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
+          @Override
+          public void onComplete(java.lang.Boolean o) {
+            ResourceRequestHandler_OnProtocolExecution_result result = new ResourceRequestHandler_OnProtocolExecution_result();
+            result.success = o;
+            result.setSuccessIsSet(true);
+            try {
+              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
+            } catch (org.apache.thrift.transport.TTransportException e) {
+              _LOGGER.error("TTransportException writing to internal frame buffer", e);
+              fb.close();
+            } catch (java.lang.Exception e) {
+              _LOGGER.error("Exception writing to internal frame buffer", e);
+              onError(e);
+            }
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
+            org.apache.thrift.TSerializable msg;
+            ResourceRequestHandler_OnProtocolExecution_result result = new ResourceRequestHandler_OnProtocolExecution_result();
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+              return;
+            } else if (e instanceof org.apache.thrift.TApplicationException) {
+              _LOGGER.error("TApplicationException inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = (org.apache.thrift.TApplicationException)e;
+            } else {
+              _LOGGER.error("Exception inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
+            }
+            try {
+              fcall.sendResponse(fb,msg,msgType,seqid);
+            } catch (java.lang.Exception ex) {
+              _LOGGER.error("Exception writing to internal frame buffer", ex);
+              fb.close();
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      public void start(I iface, ResourceRequestHandler_OnProtocolExecution_args args, org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> resultHandler) throws org.apache.thrift.TException {
+        iface.ResourceRequestHandler_OnProtocolExecution(args.rrHandler, args.bid, args.request, args.allowOsExecution,resultHandler);
+      }
+    }
+
+    public static class MessageRouterHandler_onQuery<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, MessageRouterHandler_onQuery_args, java.lang.Boolean> {
+      public MessageRouterHandler_onQuery() {
+        super("MessageRouterHandler_onQuery");
+      }
+
+      @Override
+      public MessageRouterHandler_onQuery_args getEmptyArgsInstance() {
+        return new MessageRouterHandler_onQuery_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<java.lang.Boolean>() { 
+          @Override
+          public void onComplete(java.lang.Boolean o) {
+            MessageRouterHandler_onQuery_result result = new MessageRouterHandler_onQuery_result();
+            result.success = o;
+            result.setSuccessIsSet(true);
+            try {
+              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
+            } catch (org.apache.thrift.transport.TTransportException e) {
+              _LOGGER.error("TTransportException writing to internal frame buffer", e);
+              fb.close();
+            } catch (java.lang.Exception e) {
+              _LOGGER.error("Exception writing to internal frame buffer", e);
+              onError(e);
+            }
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
+            org.apache.thrift.TSerializable msg;
+            MessageRouterHandler_onQuery_result result = new MessageRouterHandler_onQuery_result();
             if (e instanceof org.apache.thrift.transport.TTransportException) {
               _LOGGER.error("TTransportException inside handler", e);
               fb.close();
@@ -9377,7 +9702,7 @@ public class ClientHandlers {
     private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RenderHandler_GetViewRect_resultStandardSchemeFactory();
     private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RenderHandler_GetViewRect_resultTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable Rect success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Rect success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -9446,7 +9771,7 @@ public class ClientHandlers {
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Rect.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.Rect.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
       org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RenderHandler_GetViewRect_result.class, metaDataMap);
     }
@@ -9455,7 +9780,7 @@ public class ClientHandlers {
     }
 
     public RenderHandler_GetViewRect_result(
-      Rect success)
+      com.jetbrains.cef.remote.thrift_codegen.Rect success)
     {
       this();
       this.success = success;
@@ -9466,7 +9791,7 @@ public class ClientHandlers {
      */
     public RenderHandler_GetViewRect_result(RenderHandler_GetViewRect_result other) {
       if (other.isSetSuccess()) {
-        this.success = new Rect(other.success);
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.Rect(other.success);
       }
     }
 
@@ -9481,11 +9806,11 @@ public class ClientHandlers {
     }
 
     @org.apache.thrift.annotation.Nullable
-    public Rect getSuccess() {
+    public com.jetbrains.cef.remote.thrift_codegen.Rect getSuccess() {
       return this.success;
     }
 
-    public RenderHandler_GetViewRect_result setSuccess(@org.apache.thrift.annotation.Nullable Rect success) {
+    public RenderHandler_GetViewRect_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Rect success) {
       this.success = success;
       return this;
     }
@@ -9512,7 +9837,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((Rect)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.Rect)value);
         }
         break;
 
@@ -9678,7 +10003,7 @@ public class ClientHandlers {
           switch (schemeField.id) {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new Rect();
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.Rect();
                 struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
@@ -9739,7 +10064,7 @@ public class ClientHandlers {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = new Rect();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.Rect();
           struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
@@ -10134,7 +10459,7 @@ public class ClientHandlers {
     private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RenderHandler_GetScreenInfo_resultStandardSchemeFactory();
     private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RenderHandler_GetScreenInfo_resultTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable ScreenInfo success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ScreenInfo success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -10203,7 +10528,7 @@ public class ClientHandlers {
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ScreenInfo.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
       org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RenderHandler_GetScreenInfo_result.class, metaDataMap);
     }
@@ -10212,7 +10537,7 @@ public class ClientHandlers {
     }
 
     public RenderHandler_GetScreenInfo_result(
-      ScreenInfo success)
+      com.jetbrains.cef.remote.thrift_codegen.ScreenInfo success)
     {
       this();
       this.success = success;
@@ -10223,7 +10548,7 @@ public class ClientHandlers {
      */
     public RenderHandler_GetScreenInfo_result(RenderHandler_GetScreenInfo_result other) {
       if (other.isSetSuccess()) {
-        this.success = new ScreenInfo(other.success);
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo(other.success);
       }
     }
 
@@ -10238,11 +10563,11 @@ public class ClientHandlers {
     }
 
     @org.apache.thrift.annotation.Nullable
-    public ScreenInfo getSuccess() {
+    public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo getSuccess() {
       return this.success;
     }
 
-    public RenderHandler_GetScreenInfo_result setSuccess(@org.apache.thrift.annotation.Nullable ScreenInfo success) {
+    public RenderHandler_GetScreenInfo_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ScreenInfo success) {
       this.success = success;
       return this;
     }
@@ -10269,7 +10594,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((ScreenInfo)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.ScreenInfo)value);
         }
         break;
 
@@ -10435,7 +10760,7 @@ public class ClientHandlers {
           switch (schemeField.id) {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new ScreenInfo();
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo();
                 struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
@@ -10496,7 +10821,7 @@ public class ClientHandlers {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = new ScreenInfo();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo();
           struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
@@ -11083,7 +11408,7 @@ public class ClientHandlers {
     private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RenderHandler_GetScreenPoint_resultStandardSchemeFactory();
     private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RenderHandler_GetScreenPoint_resultTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable Point success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -11152,7 +11477,7 @@ public class ClientHandlers {
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Point.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.Point.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
       org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RenderHandler_GetScreenPoint_result.class, metaDataMap);
     }
@@ -11161,7 +11486,7 @@ public class ClientHandlers {
     }
 
     public RenderHandler_GetScreenPoint_result(
-      Point success)
+      com.jetbrains.cef.remote.thrift_codegen.Point success)
     {
       this();
       this.success = success;
@@ -11172,7 +11497,7 @@ public class ClientHandlers {
      */
     public RenderHandler_GetScreenPoint_result(RenderHandler_GetScreenPoint_result other) {
       if (other.isSetSuccess()) {
-        this.success = new Point(other.success);
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.Point(other.success);
       }
     }
 
@@ -11187,11 +11512,11 @@ public class ClientHandlers {
     }
 
     @org.apache.thrift.annotation.Nullable
-    public Point getSuccess() {
+    public com.jetbrains.cef.remote.thrift_codegen.Point getSuccess() {
       return this.success;
     }
 
-    public RenderHandler_GetScreenPoint_result setSuccess(@org.apache.thrift.annotation.Nullable Point success) {
+    public RenderHandler_GetScreenPoint_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point success) {
       this.success = success;
       return this;
     }
@@ -11218,7 +11543,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((Point)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.Point)value);
         }
         break;
 
@@ -11384,7 +11709,7 @@ public class ClientHandlers {
           switch (schemeField.id) {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new Point();
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.Point();
                 struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
@@ -11445,7 +11770,7 @@ public class ClientHandlers {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = new Point();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.Point();
           struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
@@ -12682,28 +13007,40 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_OnBeforePopup_args implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforePopup_args, LifeSpanHandler_OnBeforePopup_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforePopup_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforePopup_args");
+  public static class RenderHandler_OnPaintAsync_args implements org.apache.thrift.TBase<RenderHandler_OnPaintAsync_args, RenderHandler_OnPaintAsync_args._Fields>, java.io.Serializable, Cloneable, Comparable<RenderHandler_OnPaintAsync_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("RenderHandler_OnPaintAsync_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
-    private static final org.apache.thrift.protocol.TField FRAME_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("frameName", org.apache.thrift.protocol.TType.STRING, (short)3);
-    private static final org.apache.thrift.protocol.TField GESTURE_FIELD_DESC = new org.apache.thrift.protocol.TField("gesture", org.apache.thrift.protocol.TType.BOOL, (short)4);
+    private static final org.apache.thrift.protocol.TField POPUP_FIELD_DESC = new org.apache.thrift.protocol.TField("popup", org.apache.thrift.protocol.TType.BOOL, (short)2);
+    private static final org.apache.thrift.protocol.TField DIRTY_RECTS_COUNT_FIELD_DESC = new org.apache.thrift.protocol.TField("dirtyRectsCount", org.apache.thrift.protocol.TType.I32, (short)3);
+    private static final org.apache.thrift.protocol.TField SHARED_MEM_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("sharedMemName", org.apache.thrift.protocol.TType.STRING, (short)4);
+    private static final org.apache.thrift.protocol.TField SHARED_MEM_HANDLE_FIELD_DESC = new org.apache.thrift.protocol.TField("sharedMemHandle", org.apache.thrift.protocol.TType.I64, (short)5);
+    private static final org.apache.thrift.protocol.TField WIDTH_FIELD_DESC = new org.apache.thrift.protocol.TField("width", org.apache.thrift.protocol.TType.I32, (short)6);
+    private static final org.apache.thrift.protocol.TField HEIGHT_FIELD_DESC = new org.apache.thrift.protocol.TField("height", org.apache.thrift.protocol.TType.I32, (short)7);
+    private static final org.apache.thrift.protocol.TField FRAME_SEQ_FIELD_DESC = new org.apache.thrift.protocol.TField("frameSeq", org.apache.thrift.protocol.TType.I64, (short)8);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RenderHandler_OnPaintAsync_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RenderHandler_OnPaintAsync_argsTupleSchemeFactory();
 
     public int bid; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String frameName; // required
-    public boolean gesture; // required
+    public boolean popup; // required
+    public int dirtyRectsCount; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String sharedMemName; // required
+    public long sharedMemHandle; // required
+    public int width; // required
+    public int height; // required
+    public long frameSeq; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
       BID((short)1, "bid"),
-      URL((short)2, "url"),
-      FRAME_NAME((short)3, "frameName"),
-      GESTURE((short)4, "gesture");
+      POPUP((short)2, "popup"),
+      DIRTY_RECTS_COUNT((short)3, "dirtyRectsCount"),
+      SHARED_MEM_NAME((short)4, "sharedMemName"),
+      SHARED_MEM_HANDLE((short)5, "sharedMemHandle"),
+      WIDTH((short)6, "width"),
+      HEIGHT((short)7, "height"),
+      FRAME_SEQ((short)8, "frameSeq");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -12721,12 +13058,20 @@ public class ClientHandlers {
         switch(fieldId) {
           case 1: // BID
             return BID;
-          case 2: // URL
-            return URL;
-          case 3: // FRAME_NAME
-            return FRAME_NAME;
-          case 4: // GESTURE
-            return GESTURE;
+          case 2: // POPUP
+            return POPUP;
+          case 3: // DIRTY_RECTS_COUNT
+            return DIRTY_RECTS_COUNT;
+          case 4: // SHARED_MEM_NAME
+            return SHARED_MEM_NAME;
+          case 5: // SHARED_MEM_HANDLE
+            return SHARED_MEM_HANDLE;
+          case 6: // WIDTH
+            return WIDTH;
+          case 7: // HEIGHT
+            return HEIGHT;
+          case 8: // FRAME_SEQ
+            return FRAME_SEQ;
           default:
             return null;
         }
@@ -12771,76 +13116,113 @@ public class ClientHandlers {
 
     // isset id assignments
     private static final int __BID_ISSET_ID = 0;
-    private static final int __GESTURE_ISSET_ID = 1;
+    private static final int __POPUP_ISSET_ID = 1;
+    private static final int __DIRTYRECTSCOUNT_ISSET_ID = 2;
+    private static final int __SHAREDMEMHANDLE_ISSET_ID = 3;
+    private static final int __WIDTH_ISSET_ID = 4;
+    private static final int __HEIGHT_ISSET_ID = 5;
+    private static final int __FRAMESEQ_ISSET_ID = 6;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
-      tmpMap.put(_Fields.FRAME_NAME, new org.apache.thrift.meta_data.FieldMetaData("frameName", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
-      tmpMap.put(_Fields.GESTURE, new org.apache.thrift.meta_data.FieldMetaData("gesture", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.POPUP, new org.apache.thrift.meta_data.FieldMetaData("popup", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+      tmpMap.put(_Fields.DIRTY_RECTS_COUNT, new org.apache.thrift.meta_data.FieldMetaData("dirtyRectsCount", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SHARED_MEM_NAME, new org.apache.thrift.meta_data.FieldMetaData("sharedMemName", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.SHARED_MEM_HANDLE, new org.apache.thrift.meta_data.FieldMetaData("sharedMemHandle", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+      tmpMap.put(_Fields.WIDTH, new org.apache.thrift.meta_data.FieldMetaData("width", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.HEIGHT, new org.apache.thrift.meta_data.FieldMetaData("height", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.FRAME_SEQ, new org.apache.thrift.meta_data.FieldMetaData("frameSeq", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforePopup_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RenderHandler_OnPaintAsync_args.class, metaDataMap);
     }
 
-    public LifeSpanHandler_OnBeforePopup_args() {
+    public RenderHandler_OnPaintAsync_args() {
     }
 
-    public LifeSpanHandler_OnBeforePopup_args(
+    public RenderHandler_OnPaintAsync_args(
       int bid,
-      java.lang.String url,
-      java.lang.String frameName,
-      boolean gesture)
+      boolean popup,
+      int dirtyRectsCount,
+      java.lang.String sharedMemName,
+      long sharedMemHandle,
+      int width,
+      int height,
+      long frameSeq)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
-      this.url = url;
-      this.frameName = frameName;
-      this.gesture = gesture;
-      setGestureIsSet(true);
+      this.popup = popup;
+      setPopupIsSet(true);
+      this.dirtyRectsCount = dirtyRectsCount;
+      setDirtyRectsCountIsSet(true);
+      this.sharedMemName = sharedMemName;
+      this.sharedMemHandle = sharedMemHandle;
+      setSharedMemHandleIsSet(true);
+      this.width = width;
+      setWidthIsSet(true);
+      this.height = height;
+      setHeightIsSet(true);
+      this.frameSeq = frameSeq;
+      setFrameSeqIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_OnBeforePopup_args(LifeSpanHandler_OnBeforePopup_args other) {
+    public RenderHandler_OnPaintAsync_args(RenderHandler_OnPaintAsync_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
-      if (other.isSetUrl()) {
-        this.url = other.url;
-      }
-      if (other.isSetFrameName()) {
-        this.frameName = other.frameName;
+      this.popup = other.popup;
+      this.dirtyRectsCount = other.dirtyRectsCount;
+      if (other.isSetSharedMemName()) {
+        this.sharedMemName = other.sharedMemName;
       }
-      this.gesture = other.gesture;
+      this.sharedMemHandle = other.sharedMemHandle;
+      this.width = other.width;
+      this.height = other.height;
+      this.frameSeq = other.frameSeq;
     }
 
     @Override
-    public LifeSpanHandler_OnBeforePopup_args deepCopy() {
-      return new LifeSpanHandler_OnBeforePopup_args(this);
+    public RenderHandler_OnPaintAsync_args deepCopy() {
+      return new RenderHandler_OnPaintAsync_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
-      this.url = null;
-      this.frameName = null;
-      setGestureIsSet(false);
-      this.gesture = false;
+      setPopupIsSet(false);
+      this.popup = false;
+      setDirtyRectsCountIsSet(false);
+      this.dirtyRectsCount = 0;
+      this.sharedMemName = null;
+      setSharedMemHandleIsSet(false);
+      this.sharedMemHandle = 0;
+      setWidthIsSet(false);
+      this.width = 0;
+      setHeightIsSet(false);
+      this.height = 0;
+      setFrameSeqIsSet(false);
+      this.frameSeq = 0;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public LifeSpanHandler_OnBeforePopup_args setBid(int bid) {
+    public RenderHandler_OnPaintAsync_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -12859,77 +13241,167 @@ public class ClientHandlers {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getUrl() {
-      return this.url;
+    public boolean isPopup() {
+      return this.popup;
     }
 
-    public LifeSpanHandler_OnBeforePopup_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
-      this.url = url;
+    public RenderHandler_OnPaintAsync_args setPopup(boolean popup) {
+      this.popup = popup;
+      setPopupIsSet(true);
       return this;
     }
 
-    public void unsetUrl() {
-      this.url = null;
+    public void unsetPopup() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __POPUP_ISSET_ID);
     }
 
-    /** Returns true if field url is set (has been assigned a value) and false otherwise */
-    public boolean isSetUrl() {
-      return this.url != null;
+    /** Returns true if field popup is set (has been assigned a value) and false otherwise */
+    public boolean isSetPopup() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __POPUP_ISSET_ID);
     }
 
-    public void setUrlIsSet(boolean value) {
-      if (!value) {
-        this.url = null;
-      }
+    public void setPopupIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __POPUP_ISSET_ID, value);
+    }
+
+    public int getDirtyRectsCount() {
+      return this.dirtyRectsCount;
+    }
+
+    public RenderHandler_OnPaintAsync_args setDirtyRectsCount(int dirtyRectsCount) {
+      this.dirtyRectsCount = dirtyRectsCount;
+      setDirtyRectsCountIsSet(true);
+      return this;
+    }
+
+    public void unsetDirtyRectsCount() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __DIRTYRECTSCOUNT_ISSET_ID);
+    }
+
+    /** Returns true if field dirtyRectsCount is set (has been assigned a value) and false otherwise */
+    public boolean isSetDirtyRectsCount() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __DIRTYRECTSCOUNT_ISSET_ID);
+    }
+
+    public void setDirtyRectsCountIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __DIRTYRECTSCOUNT_ISSET_ID, value);
     }
 
     @org.apache.thrift.annotation.Nullable
-    public java.lang.String getFrameName() {
-      return this.frameName;
+    public java.lang.String getSharedMemName() {
+      return this.sharedMemName;
     }
 
-    public LifeSpanHandler_OnBeforePopup_args setFrameName(@org.apache.thrift.annotation.Nullable java.lang.String frameName) {
-      this.frameName = frameName;
+    public RenderHandler_OnPaintAsync_args setSharedMemName(@org.apache.thrift.annotation.Nullable java.lang.String sharedMemName) {
+      this.sharedMemName = sharedMemName;
       return this;
     }
 
-    public void unsetFrameName() {
-      this.frameName = null;
+    public void unsetSharedMemName() {
+      this.sharedMemName = null;
     }
 
-    /** Returns true if field frameName is set (has been assigned a value) and false otherwise */
-    public boolean isSetFrameName() {
-      return this.frameName != null;
+    /** Returns true if field sharedMemName is set (has been assigned a value) and false otherwise */
+    public boolean isSetSharedMemName() {
+      return this.sharedMemName != null;
     }
 
-    public void setFrameNameIsSet(boolean value) {
+    public void setSharedMemNameIsSet(boolean value) {
       if (!value) {
-        this.frameName = null;
+        this.sharedMemName = null;
       }
     }
 
-    public boolean isGesture() {
-      return this.gesture;
+    public long getSharedMemHandle() {
+      return this.sharedMemHandle;
     }
 
-    public LifeSpanHandler_OnBeforePopup_args setGesture(boolean gesture) {
-      this.gesture = gesture;
-      setGestureIsSet(true);
+    public RenderHandler_OnPaintAsync_args setSharedMemHandle(long sharedMemHandle) {
+      this.sharedMemHandle = sharedMemHandle;
+      setSharedMemHandleIsSet(true);
       return this;
     }
 
-    public void unsetGesture() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __GESTURE_ISSET_ID);
+    public void unsetSharedMemHandle() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID);
     }
 
-    /** Returns true if field gesture is set (has been assigned a value) and false otherwise */
-    public boolean isSetGesture() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __GESTURE_ISSET_ID);
+    /** Returns true if field sharedMemHandle is set (has been assigned a value) and false otherwise */
+    public boolean isSetSharedMemHandle() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID);
     }
 
-    public void setGestureIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __GESTURE_ISSET_ID, value);
+    public void setSharedMemHandleIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID, value);
+    }
+
+    public int getWidth() {
+      return this.width;
+    }
+
+    public RenderHandler_OnPaintAsync_args setWidth(int width) {
+      this.width = width;
+      setWidthIsSet(true);
+      return this;
+    }
+
+    public void unsetWidth() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __WIDTH_ISSET_ID);
+    }
+
+    /** Returns true if field width is set (has been assigned a value) and false otherwise */
+    public boolean isSetWidth() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __WIDTH_ISSET_ID);
+    }
+
+    public void setWidthIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __WIDTH_ISSET_ID, value);
+    }
+
+    public int getHeight() {
+      return this.height;
+    }
+
+    public RenderHandler_OnPaintAsync_args setHeight(int height) {
+      this.height = height;
+      setHeightIsSet(true);
+      return this;
+    }
+
+    public void unsetHeight() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __HEIGHT_ISSET_ID);
+    }
+
+    /** Returns true if field height is set (has been assigned a value) and false otherwise */
+    public boolean isSetHeight() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __HEIGHT_ISSET_ID);
+    }
+
+    public void setHeightIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __HEIGHT_ISSET_ID, value);
+    }
+
+    public long getFrameSeq() {
+      return this.frameSeq;
+    }
+
+    public RenderHandler_OnPaintAsync_args setFrameSeq(long frameSeq) {
+      this.frameSeq = frameSeq;
+      setFrameSeqIsSet(true);
+      return this;
+    }
+
+    public void unsetFrameSeq() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FRAMESEQ_ISSET_ID);
+    }
+
+    /** Returns true if field frameSeq is set (has been assigned a value) and false otherwise */
+    public boolean isSetFrameSeq() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FRAMESEQ_ISSET_ID);
+    }
+
+    public void setFrameSeqIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FRAMESEQ_ISSET_ID, value);
     }
 
     @Override
@@ -12943,27 +13415,59 @@ public class ClientHandlers {
         }
         break;
 
-      case URL:
+      case POPUP:
         if (value == null) {
-          unsetUrl();
+          unsetPopup();
         } else {
-          setUrl((java.lang.String)value);
+          setPopup((java.lang.Boolean)value);
         }
         break;
 
-      case FRAME_NAME:
+      case DIRTY_RECTS_COUNT:
         if (value == null) {
-          unsetFrameName();
+          unsetDirtyRectsCount();
         } else {
-          setFrameName((java.lang.String)value);
+          setDirtyRectsCount((java.lang.Integer)value);
         }
         break;
 
-      case GESTURE:
+      case SHARED_MEM_NAME:
         if (value == null) {
-          unsetGesture();
+          unsetSharedMemName();
         } else {
-          setGesture((java.lang.Boolean)value);
+          setSharedMemName((java.lang.String)value);
+        }
+        break;
+
+      case SHARED_MEM_HANDLE:
+        if (value == null) {
+          unsetSharedMemHandle();
+        } else {
+          setSharedMemHandle((java.lang.Long)value);
+        }
+        break;
+
+      case WIDTH:
+        if (value == null) {
+          unsetWidth();
+        } else {
+          setWidth((java.lang.Integer)value);
+        }
+        break;
+
+      case HEIGHT:
+        if (value == null) {
+          unsetHeight();
+        } else {
+          setHeight((java.lang.Integer)value);
+        }
+        break;
+
+      case FRAME_SEQ:
+        if (value == null) {
+          unsetFrameSeq();
+        } else {
+          setFrameSeq((java.lang.Long)value);
         }
         break;
 
@@ -12977,14 +13481,26 @@ public class ClientHandlers {
       case BID:
         return getBid();
 
-      case URL:
-        return getUrl();
+      case POPUP:
+        return isPopup();
 
-      case FRAME_NAME:
-        return getFrameName();
+      case DIRTY_RECTS_COUNT:
+        return getDirtyRectsCount();
 
-      case GESTURE:
-        return isGesture();
+      case SHARED_MEM_NAME:
+        return getSharedMemName();
+
+      case SHARED_MEM_HANDLE:
+        return getSharedMemHandle();
+
+      case WIDTH:
+        return getWidth();
+
+      case HEIGHT:
+        return getHeight();
+
+      case FRAME_SEQ:
+        return getFrameSeq();
 
       }
       throw new java.lang.IllegalStateException();
@@ -13000,24 +13516,32 @@ public class ClientHandlers {
       switch (field) {
       case BID:
         return isSetBid();
-      case URL:
-        return isSetUrl();
-      case FRAME_NAME:
-        return isSetFrameName();
-      case GESTURE:
-        return isSetGesture();
+      case POPUP:
+        return isSetPopup();
+      case DIRTY_RECTS_COUNT:
+        return isSetDirtyRectsCount();
+      case SHARED_MEM_NAME:
+        return isSetSharedMemName();
+      case SHARED_MEM_HANDLE:
+        return isSetSharedMemHandle();
+      case WIDTH:
+        return isSetWidth();
+      case HEIGHT:
+        return isSetHeight();
+      case FRAME_SEQ:
+        return isSetFrameSeq();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_OnBeforePopup_args)
-        return this.equals((LifeSpanHandler_OnBeforePopup_args)that);
+      if (that instanceof RenderHandler_OnPaintAsync_args)
+        return this.equals((RenderHandler_OnPaintAsync_args)that);
       return false;
     }
 
-    public boolean equals(LifeSpanHandler_OnBeforePopup_args that) {
+    public boolean equals(RenderHandler_OnPaintAsync_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -13032,30 +13556,66 @@ public class ClientHandlers {
           return false;
       }
 
-      boolean this_present_url = true && this.isSetUrl();
-      boolean that_present_url = true && that.isSetUrl();
-      if (this_present_url || that_present_url) {
-        if (!(this_present_url && that_present_url))
+      boolean this_present_popup = true;
+      boolean that_present_popup = true;
+      if (this_present_popup || that_present_popup) {
+        if (!(this_present_popup && that_present_popup))
           return false;
-        if (!this.url.equals(that.url))
+        if (this.popup != that.popup)
           return false;
       }
 
-      boolean this_present_frameName = true && this.isSetFrameName();
-      boolean that_present_frameName = true && that.isSetFrameName();
-      if (this_present_frameName || that_present_frameName) {
-        if (!(this_present_frameName && that_present_frameName))
+      boolean this_present_dirtyRectsCount = true;
+      boolean that_present_dirtyRectsCount = true;
+      if (this_present_dirtyRectsCount || that_present_dirtyRectsCount) {
+        if (!(this_present_dirtyRectsCount && that_present_dirtyRectsCount))
           return false;
-        if (!this.frameName.equals(that.frameName))
+        if (this.dirtyRectsCount != that.dirtyRectsCount)
           return false;
       }
 
-      boolean this_present_gesture = true;
-      boolean that_present_gesture = true;
-      if (this_present_gesture || that_present_gesture) {
-        if (!(this_present_gesture && that_present_gesture))
+      boolean this_present_sharedMemName = true && this.isSetSharedMemName();
+      boolean that_present_sharedMemName = true && that.isSetSharedMemName();
+      if (this_present_sharedMemName || that_present_sharedMemName) {
+        if (!(this_present_sharedMemName && that_present_sharedMemName))
           return false;
-        if (this.gesture != that.gesture)
+        if (!this.sharedMemName.equals(that.sharedMemName))
+          return false;
+      }
+
+      boolean this_present_sharedMemHandle = true;
+      boolean that_present_sharedMemHandle = true;
+      if (this_present_sharedMemHandle || that_present_sharedMemHandle) {
+        if (!(this_present_sharedMemHandle && that_present_sharedMemHandle))
+          return false;
+        if (this.sharedMemHandle != that.sharedMemHandle)
+          return false;
+      }
+
+      boolean this_present_width = true;
+      boolean that_present_width = true;
+      if (this_present_width || that_present_width) {
+        if (!(this_present_width && that_present_width))
+          return false;
+        if (this.width != that.width)
+          return false;
+      }
+
+      boolean this_present_height = true;
+      boolean that_present_height = true;
+      if (this_present_height || that_present_height) {
+        if (!(this_present_height && that_present_height))
+          return false;
+        if (this.height != that.height)
+          return false;
+      }
+
+      boolean this_present_frameSeq = true;
+      boolean that_present_frameSeq = true;
+      if (this_present_frameSeq || that_present_frameSeq) {
+        if (!(this_present_frameSeq && that_present_frameSeq))
+          return false;
+        if (this.frameSeq != that.frameSeq)
           return false;
       }
 
@@ -13068,21 +13628,27 @@ public class ClientHandlers {
 
       hashCode = hashCode * 8191 + bid;
 
-      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
-      if (isSetUrl())
-        hashCode = hashCode * 8191 + url.hashCode();
+      hashCode = hashCode * 8191 + ((popup) ? 131071 : 524287);
 
-      hashCode = hashCode * 8191 + ((isSetFrameName()) ? 131071 : 524287);
-      if (isSetFrameName())
-        hashCode = hashCode * 8191 + frameName.hashCode();
+      hashCode = hashCode * 8191 + dirtyRectsCount;
 
-      hashCode = hashCode * 8191 + ((gesture) ? 131071 : 524287);
+      hashCode = hashCode * 8191 + ((isSetSharedMemName()) ? 131071 : 524287);
+      if (isSetSharedMemName())
+        hashCode = hashCode * 8191 + sharedMemName.hashCode();
+
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(sharedMemHandle);
+
+      hashCode = hashCode * 8191 + width;
+
+      hashCode = hashCode * 8191 + height;
+
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(frameSeq);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_OnBeforePopup_args other) {
+    public int compareTo(RenderHandler_OnPaintAsync_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -13099,32 +13665,72 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      lastComparison = java.lang.Boolean.compare(isSetPopup(), other.isSetPopup());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetUrl()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+      if (isSetPopup()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.popup, other.popup);
         if (lastComparison != 0) {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetFrameName(), other.isSetFrameName());
+      lastComparison = java.lang.Boolean.compare(isSetDirtyRectsCount(), other.isSetDirtyRectsCount());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetFrameName()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.frameName, other.frameName);
+      if (isSetDirtyRectsCount()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.dirtyRectsCount, other.dirtyRectsCount);
         if (lastComparison != 0) {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetGesture(), other.isSetGesture());
+      lastComparison = java.lang.Boolean.compare(isSetSharedMemName(), other.isSetSharedMemName());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetGesture()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.gesture, other.gesture);
+      if (isSetSharedMemName()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.sharedMemName, other.sharedMemName);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetSharedMemHandle(), other.isSetSharedMemHandle());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSharedMemHandle()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.sharedMemHandle, other.sharedMemHandle);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetWidth(), other.isSetWidth());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetWidth()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.width, other.width);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetHeight(), other.isSetHeight());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetHeight()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.height, other.height);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetFrameSeq(), other.isSetFrameSeq());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetFrameSeq()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.frameSeq, other.frameSeq);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -13150,31 +13756,43 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforePopup_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("RenderHandler_OnPaintAsync_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("url:");
-      if (this.url == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.url);
-      }
+      sb.append("popup:");
+      sb.append(this.popup);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("frameName:");
-      if (this.frameName == null) {
+      sb.append("dirtyRectsCount:");
+      sb.append(this.dirtyRectsCount);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("sharedMemName:");
+      if (this.sharedMemName == null) {
         sb.append("null");
       } else {
-        sb.append(this.frameName);
+        sb.append(this.sharedMemName);
       }
       first = false;
       if (!first) sb.append(", ");
-      sb.append("gesture:");
-      sb.append(this.gesture);
+      sb.append("sharedMemHandle:");
+      sb.append(this.sharedMemHandle);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("width:");
+      sb.append(this.width);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("height:");
+      sb.append(this.height);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("frameSeq:");
+      sb.append(this.frameSeq);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -13203,17 +13821,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class RenderHandler_OnPaintAsync_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnBeforePopup_argsStandardScheme getScheme() {
-        return new LifeSpanHandler_OnBeforePopup_argsStandardScheme();
+      public RenderHandler_OnPaintAsync_argsStandardScheme getScheme() {
+        return new RenderHandler_OnPaintAsync_argsStandardScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnBeforePopup_args> {
+    private static class RenderHandler_OnPaintAsync_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<RenderHandler_OnPaintAsync_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, RenderHandler_OnPaintAsync_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -13231,26 +13849,58 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // URL
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.url = iprot.readString();
-                struct.setUrlIsSet(true);
+            case 2: // POPUP
+              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+                struct.popup = iprot.readBool();
+                struct.setPopupIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 3: // FRAME_NAME
+            case 3: // DIRTY_RECTS_COUNT
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.dirtyRectsCount = iprot.readI32();
+                struct.setDirtyRectsCountIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 4: // SHARED_MEM_NAME
               if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.frameName = iprot.readString();
-                struct.setFrameNameIsSet(true);
+                struct.sharedMemName = iprot.readString();
+                struct.setSharedMemNameIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 4: // GESTURE
-              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
-                struct.gesture = iprot.readBool();
-                struct.setGestureIsSet(true);
+            case 5: // SHARED_MEM_HANDLE
+              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+                struct.sharedMemHandle = iprot.readI64();
+                struct.setSharedMemHandleIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 6: // WIDTH
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.width = iprot.readI32();
+                struct.setWidthIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 7: // HEIGHT
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.height = iprot.readI32();
+                struct.setHeightIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 8: // FRAME_SEQ
+              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+                struct.frameSeq = iprot.readI64();
+                struct.setFrameSeqIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -13267,25 +13917,35 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, RenderHandler_OnPaintAsync_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
-        if (struct.url != null) {
-          oprot.writeFieldBegin(URL_FIELD_DESC);
-          oprot.writeString(struct.url);
-          oprot.writeFieldEnd();
-        }
-        if (struct.frameName != null) {
-          oprot.writeFieldBegin(FRAME_NAME_FIELD_DESC);
-          oprot.writeString(struct.frameName);
+        oprot.writeFieldBegin(POPUP_FIELD_DESC);
+        oprot.writeBool(struct.popup);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(DIRTY_RECTS_COUNT_FIELD_DESC);
+        oprot.writeI32(struct.dirtyRectsCount);
+        oprot.writeFieldEnd();
+        if (struct.sharedMemName != null) {
+          oprot.writeFieldBegin(SHARED_MEM_NAME_FIELD_DESC);
+          oprot.writeString(struct.sharedMemName);
           oprot.writeFieldEnd();
         }
-        oprot.writeFieldBegin(GESTURE_FIELD_DESC);
-        oprot.writeBool(struct.gesture);
+        oprot.writeFieldBegin(SHARED_MEM_HANDLE_FIELD_DESC);
+        oprot.writeI64(struct.sharedMemHandle);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(WIDTH_FIELD_DESC);
+        oprot.writeI32(struct.width);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(HEIGHT_FIELD_DESC);
+        oprot.writeI32(struct.height);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(FRAME_SEQ_FIELD_DESC);
+        oprot.writeI64(struct.frameSeq);
         oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
@@ -13293,65 +13953,105 @@ public class ClientHandlers {
 
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class RenderHandler_OnPaintAsync_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnBeforePopup_argsTupleScheme getScheme() {
-        return new LifeSpanHandler_OnBeforePopup_argsTupleScheme();
+      public RenderHandler_OnPaintAsync_argsTupleScheme getScheme() {
+        return new RenderHandler_OnPaintAsync_argsTupleScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnBeforePopup_args> {
+    private static class RenderHandler_OnPaintAsync_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<RenderHandler_OnPaintAsync_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, RenderHandler_OnPaintAsync_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        if (struct.isSetUrl()) {
+        if (struct.isSetPopup()) {
           optionals.set(1);
         }
-        if (struct.isSetFrameName()) {
+        if (struct.isSetDirtyRectsCount()) {
           optionals.set(2);
         }
-        if (struct.isSetGesture()) {
+        if (struct.isSetSharedMemName()) {
           optionals.set(3);
         }
-        oprot.writeBitSet(optionals, 4);
+        if (struct.isSetSharedMemHandle()) {
+          optionals.set(4);
+        }
+        if (struct.isSetWidth()) {
+          optionals.set(5);
+        }
+        if (struct.isSetHeight()) {
+          optionals.set(6);
+        }
+        if (struct.isSetFrameSeq()) {
+          optionals.set(7);
+        }
+        oprot.writeBitSet(optionals, 8);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
-        if (struct.isSetUrl()) {
-          oprot.writeString(struct.url);
+        if (struct.isSetPopup()) {
+          oprot.writeBool(struct.popup);
         }
-        if (struct.isSetFrameName()) {
-          oprot.writeString(struct.frameName);
+        if (struct.isSetDirtyRectsCount()) {
+          oprot.writeI32(struct.dirtyRectsCount);
         }
-        if (struct.isSetGesture()) {
-          oprot.writeBool(struct.gesture);
+        if (struct.isSetSharedMemName()) {
+          oprot.writeString(struct.sharedMemName);
+        }
+        if (struct.isSetSharedMemHandle()) {
+          oprot.writeI64(struct.sharedMemHandle);
+        }
+        if (struct.isSetWidth()) {
+          oprot.writeI32(struct.width);
+        }
+        if (struct.isSetHeight()) {
+          oprot.writeI32(struct.height);
+        }
+        if (struct.isSetFrameSeq()) {
+          oprot.writeI64(struct.frameSeq);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, RenderHandler_OnPaintAsync_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(4);
+        java.util.BitSet incoming = iprot.readBitSet(8);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
         if (incoming.get(1)) {
-          struct.url = iprot.readString();
-          struct.setUrlIsSet(true);
+          struct.popup = iprot.readBool();
+          struct.setPopupIsSet(true);
         }
         if (incoming.get(2)) {
-          struct.frameName = iprot.readString();
-          struct.setFrameNameIsSet(true);
+          struct.dirtyRectsCount = iprot.readI32();
+          struct.setDirtyRectsCountIsSet(true);
         }
         if (incoming.get(3)) {
-          struct.gesture = iprot.readBool();
-          struct.setGestureIsSet(true);
+          struct.sharedMemName = iprot.readString();
+          struct.setSharedMemNameIsSet(true);
+        }
+        if (incoming.get(4)) {
+          struct.sharedMemHandle = iprot.readI64();
+          struct.setSharedMemHandleIsSet(true);
+        }
+        if (incoming.get(5)) {
+          struct.width = iprot.readI32();
+          struct.setWidthIsSet(true);
+        }
+        if (incoming.get(6)) {
+          struct.height = iprot.readI32();
+          struct.setHeightIsSet(true);
+        }
+        if (incoming.get(7)) {
+          struct.frameSeq = iprot.readI64();
+          struct.setFrameSeqIsSet(true);
         }
       }
     }
@@ -13362,19 +14062,28 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_OnBeforePopup_result implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforePopup_result, LifeSpanHandler_OnBeforePopup_result._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforePopup_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforePopup_result");
+  public static class LifeSpanHandler_OnBeforePopup_args implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforePopup_args, LifeSpanHandler_OnBeforePopup_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforePopup_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforePopup_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
+    private static final org.apache.thrift.protocol.TField FRAME_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("frameName", org.apache.thrift.protocol.TType.STRING, (short)3);
+    private static final org.apache.thrift.protocol.TField GESTURE_FIELD_DESC = new org.apache.thrift.protocol.TField("gesture", org.apache.thrift.protocol.TType.BOOL, (short)4);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_argsTupleSchemeFactory();
 
-    public boolean success; // required
+    public int bid; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String frameName; // required
+    public boolean gesture; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+      BID((short)1, "bid"),
+      URL((short)2, "url"),
+      FRAME_NAME((short)3, "frameName"),
+      GESTURE((short)4, "gesture");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -13390,8 +14099,14 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
+          case 1: // BID
+            return BID;
+          case 2: // URL
+            return URL;
+          case 3: // FRAME_NAME
+            return FRAME_NAME;
+          case 4: // GESTURE
+            return GESTURE;
           default:
             return null;
         }
@@ -13435,157 +14150,361 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
+    private static final int __BID_ISSET_ID = 0;
+    private static final int __GESTURE_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.FRAME_NAME, new org.apache.thrift.meta_data.FieldMetaData("frameName", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.GESTURE, new org.apache.thrift.meta_data.FieldMetaData("gesture", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforePopup_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforePopup_args.class, metaDataMap);
     }
 
-    public LifeSpanHandler_OnBeforePopup_result() {
+    public LifeSpanHandler_OnBeforePopup_args() {
     }
 
-    public LifeSpanHandler_OnBeforePopup_result(
-      boolean success)
+    public LifeSpanHandler_OnBeforePopup_args(
+      int bid,
+      java.lang.String url,
+      java.lang.String frameName,
+      boolean gesture)
     {
       this();
-      this.success = success;
-      setSuccessIsSet(true);
+      this.bid = bid;
+      setBidIsSet(true);
+      this.url = url;
+      this.frameName = frameName;
+      this.gesture = gesture;
+      setGestureIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_OnBeforePopup_result(LifeSpanHandler_OnBeforePopup_result other) {
+    public LifeSpanHandler_OnBeforePopup_args(LifeSpanHandler_OnBeforePopup_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.success = other.success;
+      this.bid = other.bid;
+      if (other.isSetUrl()) {
+        this.url = other.url;
+      }
+      if (other.isSetFrameName()) {
+        this.frameName = other.frameName;
+      }
+      this.gesture = other.gesture;
     }
 
     @Override
-    public LifeSpanHandler_OnBeforePopup_result deepCopy() {
-      return new LifeSpanHandler_OnBeforePopup_result(this);
+    public LifeSpanHandler_OnBeforePopup_args deepCopy() {
+      return new LifeSpanHandler_OnBeforePopup_args(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = false;
+      setBidIsSet(false);
+      this.bid = 0;
+      this.url = null;
+      this.frameName = null;
+      setGestureIsSet(false);
+      this.gesture = false;
     }
 
-    public boolean isSuccess() {
-      return this.success;
+    public int getBid() {
+      return this.bid;
     }
 
-    public LifeSpanHandler_OnBeforePopup_result setSuccess(boolean success) {
-      this.success = success;
-      setSuccessIsSet(true);
+    public LifeSpanHandler_OnBeforePopup_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
       return this;
     }
 
-    public void unsetSuccess() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    public void setSuccessIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
-    @Override
-    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
-      switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((java.lang.Boolean)value);
-        }
-        break;
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getUrl() {
+      return this.url;
+    }
 
-      }
+    public LifeSpanHandler_OnBeforePopup_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
+      this.url = url;
+      return this;
     }
 
-    @org.apache.thrift.annotation.Nullable
-    @Override
-    public java.lang.Object getFieldValue(_Fields field) {
-      switch (field) {
-      case SUCCESS:
-        return isSuccess();
+    public void unsetUrl() {
+      this.url = null;
+    }
 
-      }
-      throw new java.lang.IllegalStateException();
+    /** Returns true if field url is set (has been assigned a value) and false otherwise */
+    public boolean isSetUrl() {
+      return this.url != null;
     }
 
-    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
-    @Override
-    public boolean isSet(_Fields field) {
-      if (field == null) {
-        throw new java.lang.IllegalArgumentException();
+    public void setUrlIsSet(boolean value) {
+      if (!value) {
+        this.url = null;
       }
+    }
 
-      switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
-      }
-      throw new java.lang.IllegalStateException();
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getFrameName() {
+      return this.frameName;
     }
 
-    @Override
-    public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_OnBeforePopup_result)
-        return this.equals((LifeSpanHandler_OnBeforePopup_result)that);
-      return false;
+    public LifeSpanHandler_OnBeforePopup_args setFrameName(@org.apache.thrift.annotation.Nullable java.lang.String frameName) {
+      this.frameName = frameName;
+      return this;
     }
 
-    public boolean equals(LifeSpanHandler_OnBeforePopup_result that) {
-      if (that == null)
-        return false;
-      if (this == that)
-        return true;
+    public void unsetFrameName() {
+      this.frameName = null;
+    }
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
+    /** Returns true if field frameName is set (has been assigned a value) and false otherwise */
+    public boolean isSetFrameName() {
+      return this.frameName != null;
+    }
+
+    public void setFrameNameIsSet(boolean value) {
+      if (!value) {
+        this.frameName = null;
       }
+    }
 
-      return true;
+    public boolean isGesture() {
+      return this.gesture;
+    }
+
+    public LifeSpanHandler_OnBeforePopup_args setGesture(boolean gesture) {
+      this.gesture = gesture;
+      setGestureIsSet(true);
+      return this;
+    }
+
+    public void unsetGesture() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __GESTURE_ISSET_ID);
+    }
+
+    /** Returns true if field gesture is set (has been assigned a value) and false otherwise */
+    public boolean isSetGesture() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __GESTURE_ISSET_ID);
+    }
+
+    public void setGestureIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __GESTURE_ISSET_ID, value);
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      case URL:
+        if (value == null) {
+          unsetUrl();
+        } else {
+          setUrl((java.lang.String)value);
+        }
+        break;
+
+      case FRAME_NAME:
+        if (value == null) {
+          unsetFrameName();
+        } else {
+          setFrameName((java.lang.String)value);
+        }
+        break;
+
+      case GESTURE:
+        if (value == null) {
+          unsetGesture();
+        } else {
+          setGesture((java.lang.Boolean)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case BID:
+        return getBid();
+
+      case URL:
+        return getUrl();
+
+      case FRAME_NAME:
+        return getFrameName();
+
+      case GESTURE:
+        return isGesture();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case BID:
+        return isSetBid();
+      case URL:
+        return isSetUrl();
+      case FRAME_NAME:
+        return isSetFrameName();
+      case GESTURE:
+        return isSetGesture();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof LifeSpanHandler_OnBeforePopup_args)
+        return this.equals((LifeSpanHandler_OnBeforePopup_args)that);
+      return false;
+    }
+
+    public boolean equals(LifeSpanHandler_OnBeforePopup_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      boolean this_present_url = true && this.isSetUrl();
+      boolean that_present_url = true && that.isSetUrl();
+      if (this_present_url || that_present_url) {
+        if (!(this_present_url && that_present_url))
+          return false;
+        if (!this.url.equals(that.url))
+          return false;
+      }
+
+      boolean this_present_frameName = true && this.isSetFrameName();
+      boolean that_present_frameName = true && that.isSetFrameName();
+      if (this_present_frameName || that_present_frameName) {
+        if (!(this_present_frameName && that_present_frameName))
+          return false;
+        if (!this.frameName.equals(that.frameName))
+          return false;
+      }
+
+      boolean this_present_gesture = true;
+      boolean that_present_gesture = true;
+      if (this_present_gesture || that_present_gesture) {
+        if (!(this_present_gesture && that_present_gesture))
+          return false;
+        if (this.gesture != that.gesture)
+          return false;
+      }
+
+      return true;
     }
 
     @Override
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
+      hashCode = hashCode * 8191 + bid;
+
+      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
+      if (isSetUrl())
+        hashCode = hashCode * 8191 + url.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetFrameName()) ? 131071 : 524287);
+      if (isSetFrameName())
+        hashCode = hashCode * 8191 + frameName.hashCode();
+
+      hashCode = hashCode * 8191 + ((gesture) ? 131071 : 524287);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_OnBeforePopup_result other) {
+    public int compareTo(LifeSpanHandler_OnBeforePopup_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetUrl()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetFrameName(), other.isSetFrameName());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetFrameName()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.frameName, other.frameName);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetGesture(), other.isSetGesture());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetGesture()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.gesture, other.gesture);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -13604,17 +14523,38 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforePopup_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforePopup_args(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("url:");
+      if (this.url == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.url);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("frameName:");
+      if (this.frameName == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.frameName);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("gesture:");
+      sb.append(this.gesture);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -13643,17 +14583,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnBeforePopup_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnBeforePopup_resultStandardScheme getScheme() {
-        return new LifeSpanHandler_OnBeforePopup_resultStandardScheme();
+      public LifeSpanHandler_OnBeforePopup_argsStandardScheme getScheme() {
+        return new LifeSpanHandler_OnBeforePopup_argsStandardScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnBeforePopup_result> {
+    private static class LifeSpanHandler_OnBeforePopup_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnBeforePopup_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -13663,10 +14603,34 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // URL
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.url = iprot.readString();
+                struct.setUrlIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // FRAME_NAME
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.frameName = iprot.readString();
+                struct.setFrameNameIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 4: // GESTURE
               if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
-                struct.success = iprot.readBool();
-                struct.setSuccessIsSet(true);
+                struct.gesture = iprot.readBool();
+                struct.setGestureIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -13683,50 +14647,91 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.isSetSuccess()) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeBool(struct.success);
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        if (struct.url != null) {
+          oprot.writeFieldBegin(URL_FIELD_DESC);
+          oprot.writeString(struct.url);
+          oprot.writeFieldEnd();
+        }
+        if (struct.frameName != null) {
+          oprot.writeFieldBegin(FRAME_NAME_FIELD_DESC);
+          oprot.writeString(struct.frameName);
           oprot.writeFieldEnd();
         }
+        oprot.writeFieldBegin(GESTURE_FIELD_DESC);
+        oprot.writeBool(struct.gesture);
+        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnBeforePopup_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnBeforePopup_resultTupleScheme getScheme() {
-        return new LifeSpanHandler_OnBeforePopup_resultTupleScheme();
+      public LifeSpanHandler_OnBeforePopup_argsTupleScheme getScheme() {
+        return new LifeSpanHandler_OnBeforePopup_argsTupleScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnBeforePopup_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnBeforePopup_result> {
+    private static class LifeSpanHandler_OnBeforePopup_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnBeforePopup_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetBid()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          oprot.writeBool(struct.success);
+        if (struct.isSetUrl()) {
+          optionals.set(1);
+        }
+        if (struct.isSetFrameName()) {
+          optionals.set(2);
+        }
+        if (struct.isSetGesture()) {
+          optionals.set(3);
+        }
+        oprot.writeBitSet(optionals, 4);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+        if (struct.isSetUrl()) {
+          oprot.writeString(struct.url);
+        }
+        if (struct.isSetFrameName()) {
+          oprot.writeString(struct.frameName);
+        }
+        if (struct.isSetGesture()) {
+          oprot.writeBool(struct.gesture);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(4);
         if (incoming.get(0)) {
-          struct.success = iprot.readBool();
-          struct.setSuccessIsSet(true);
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.url = iprot.readString();
+          struct.setUrlIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.frameName = iprot.readString();
+          struct.setFrameNameIsSet(true);
+        }
+        if (incoming.get(3)) {
+          struct.gesture = iprot.readBool();
+          struct.setGestureIsSet(true);
         }
       }
     }
@@ -13737,22 +14742,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_OnAfterCreated_args implements org.apache.thrift.TBase<LifeSpanHandler_OnAfterCreated_args, LifeSpanHandler_OnAfterCreated_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnAfterCreated_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnAfterCreated_args");
+  public static class LifeSpanHandler_OnBeforePopup_result implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforePopup_result, LifeSpanHandler_OnBeforePopup_result._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforePopup_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforePopup_result");
 
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField NATIVE_BROWSER_IDENTIFIER_FIELD_DESC = new org.apache.thrift.protocol.TField("nativeBrowserIdentifier", org.apache.thrift.protocol.TType.I32, (short)2);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnAfterCreated_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnAfterCreated_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforePopup_resultTupleSchemeFactory();
 
-    public int bid; // required
-    public int nativeBrowserIdentifier; // required
+    public boolean success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid"),
-      NATIVE_BROWSER_IDENTIFIER((short)2, "nativeBrowserIdentifier");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -13768,10 +14770,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // BID
-            return BID;
-          case 2: // NATIVE_BROWSER_IDENTIFIER
-            return NATIVE_BROWSER_IDENTIFIER;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -13815,118 +14815,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __BID_ISSET_ID = 0;
-    private static final int __NATIVEBROWSERIDENTIFIER_ISSET_ID = 1;
+    private static final int __SUCCESS_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.NATIVE_BROWSER_IDENTIFIER, new org.apache.thrift.meta_data.FieldMetaData("nativeBrowserIdentifier", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnAfterCreated_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforePopup_result.class, metaDataMap);
     }
 
-    public LifeSpanHandler_OnAfterCreated_args() {
+    public LifeSpanHandler_OnBeforePopup_result() {
     }
 
-    public LifeSpanHandler_OnAfterCreated_args(
-      int bid,
-      int nativeBrowserIdentifier)
+    public LifeSpanHandler_OnBeforePopup_result(
+      boolean success)
     {
       this();
-      this.bid = bid;
-      setBidIsSet(true);
-      this.nativeBrowserIdentifier = nativeBrowserIdentifier;
-      setNativeBrowserIdentifierIsSet(true);
+      this.success = success;
+      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_OnAfterCreated_args(LifeSpanHandler_OnAfterCreated_args other) {
+    public LifeSpanHandler_OnBeforePopup_result(LifeSpanHandler_OnBeforePopup_result other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.bid = other.bid;
-      this.nativeBrowserIdentifier = other.nativeBrowserIdentifier;
+      this.success = other.success;
     }
 
     @Override
-    public LifeSpanHandler_OnAfterCreated_args deepCopy() {
-      return new LifeSpanHandler_OnAfterCreated_args(this);
+    public LifeSpanHandler_OnBeforePopup_result deepCopy() {
+      return new LifeSpanHandler_OnBeforePopup_result(this);
     }
 
     @Override
     public void clear() {
-      setBidIsSet(false);
-      this.bid = 0;
-      setNativeBrowserIdentifierIsSet(false);
-      this.nativeBrowserIdentifier = 0;
-    }
-
-    public int getBid() {
-      return this.bid;
-    }
-
-    public LifeSpanHandler_OnAfterCreated_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
-      return this;
-    }
-
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+      setSuccessIsSet(false);
+      this.success = false;
     }
 
-    public int getNativeBrowserIdentifier() {
-      return this.nativeBrowserIdentifier;
+    public boolean isSuccess() {
+      return this.success;
     }
 
-    public LifeSpanHandler_OnAfterCreated_args setNativeBrowserIdentifier(int nativeBrowserIdentifier) {
-      this.nativeBrowserIdentifier = nativeBrowserIdentifier;
-      setNativeBrowserIdentifierIsSet(true);
+    public LifeSpanHandler_OnBeforePopup_result setSuccess(boolean success) {
+      this.success = success;
+      setSuccessIsSet(true);
       return this;
     }
 
-    public void unsetNativeBrowserIdentifier() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID);
+    public void unsetSuccess() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    /** Returns true if field nativeBrowserIdentifier is set (has been assigned a value) and false otherwise */
-    public boolean isSetNativeBrowserIdentifier() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    public void setNativeBrowserIdentifierIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case BID:
-        if (value == null) {
-          unsetBid();
-        } else {
-          setBid((java.lang.Integer)value);
-        }
-        break;
-
-      case NATIVE_BROWSER_IDENTIFIER:
+      case SUCCESS:
         if (value == null) {
-          unsetNativeBrowserIdentifier();
+          unsetSuccess();
         } else {
-          setNativeBrowserIdentifier((java.lang.Integer)value);
+          setSuccess((java.lang.Boolean)value);
         }
         break;
 
@@ -13937,11 +14897,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case BID:
-        return getBid();
-
-      case NATIVE_BROWSER_IDENTIFIER:
-        return getNativeBrowserIdentifier();
+      case SUCCESS:
+        return isSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -13955,42 +14912,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case BID:
-        return isSetBid();
-      case NATIVE_BROWSER_IDENTIFIER:
-        return isSetNativeBrowserIdentifier();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_OnAfterCreated_args)
-        return this.equals((LifeSpanHandler_OnAfterCreated_args)that);
+      if (that instanceof LifeSpanHandler_OnBeforePopup_result)
+        return this.equals((LifeSpanHandler_OnBeforePopup_result)that);
       return false;
     }
 
-    public boolean equals(LifeSpanHandler_OnAfterCreated_args that) {
+    public boolean equals(LifeSpanHandler_OnBeforePopup_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
-          return false;
-        if (this.bid != that.bid)
-          return false;
-      }
-
-      boolean this_present_nativeBrowserIdentifier = true;
-      boolean that_present_nativeBrowserIdentifier = true;
-      if (this_present_nativeBrowserIdentifier || that_present_nativeBrowserIdentifier) {
-        if (!(this_present_nativeBrowserIdentifier && that_present_nativeBrowserIdentifier))
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.nativeBrowserIdentifier != that.nativeBrowserIdentifier)
+        if (this.success != that.success)
           return false;
       }
 
@@ -14001,37 +14947,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + bid;
-
-      hashCode = hashCode * 8191 + nativeBrowserIdentifier;
+      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_OnAfterCreated_args other) {
+    public int compareTo(LifeSpanHandler_OnBeforePopup_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetNativeBrowserIdentifier(), other.isSetNativeBrowserIdentifier());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetNativeBrowserIdentifier()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.nativeBrowserIdentifier, other.nativeBrowserIdentifier);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -14050,22 +14984,17 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnAfterCreated_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforePopup_result(");
       boolean first = true;
 
-      sb.append("bid:");
-      sb.append(this.bid);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("nativeBrowserIdentifier:");
-      sb.append(this.nativeBrowserIdentifier);
+      sb.append("success:");
+      sb.append(this.success);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -14094,17 +15023,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class LifeSpanHandler_OnAfterCreated_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnBeforePopup_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnAfterCreated_argsStandardScheme getScheme() {
-        return new LifeSpanHandler_OnAfterCreated_argsStandardScheme();
+      public LifeSpanHandler_OnBeforePopup_resultStandardScheme getScheme() {
+        return new LifeSpanHandler_OnBeforePopup_resultStandardScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnAfterCreated_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnAfterCreated_args> {
+    private static class LifeSpanHandler_OnBeforePopup_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnBeforePopup_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -14114,18 +15043,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // BID
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.bid = iprot.readI32();
-                struct.setBidIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 2: // NATIVE_BROWSER_IDENTIFIER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.nativeBrowserIdentifier = iprot.readI32();
-                struct.setNativeBrowserIdentifierIsSet(true);
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+                struct.success = iprot.readBool();
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -14142,61 +15063,50 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(BID_FIELD_DESC);
-        oprot.writeI32(struct.bid);
-        oprot.writeFieldEnd();
-        oprot.writeFieldBegin(NATIVE_BROWSER_IDENTIFIER_FIELD_DESC);
-        oprot.writeI32(struct.nativeBrowserIdentifier);
-        oprot.writeFieldEnd();
+        if (struct.isSetSuccess()) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeBool(struct.success);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class LifeSpanHandler_OnAfterCreated_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnBeforePopup_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_OnAfterCreated_argsTupleScheme getScheme() {
-        return new LifeSpanHandler_OnAfterCreated_argsTupleScheme();
+      public LifeSpanHandler_OnBeforePopup_resultTupleScheme getScheme() {
+        return new LifeSpanHandler_OnBeforePopup_resultTupleScheme();
       }
     }
 
-    private static class LifeSpanHandler_OnAfterCreated_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnAfterCreated_args> {
+    private static class LifeSpanHandler_OnBeforePopup_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnBeforePopup_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetBid()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
-        if (struct.isSetNativeBrowserIdentifier()) {
-          optionals.set(1);
-        }
-        oprot.writeBitSet(optionals, 2);
-        if (struct.isSetBid()) {
-          oprot.writeI32(struct.bid);
-        }
-        if (struct.isSetNativeBrowserIdentifier()) {
-          oprot.writeI32(struct.nativeBrowserIdentifier);
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetSuccess()) {
+          oprot.writeBool(struct.success);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnBeforePopup_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(2);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.bid = iprot.readI32();
-          struct.setBidIsSet(true);
-        }
-        if (incoming.get(1)) {
-          struct.nativeBrowserIdentifier = iprot.readI32();
-          struct.setNativeBrowserIdentifierIsSet(true);
+          struct.success = iprot.readBool();
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -14207,19 +15117,22 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_DoClose_args implements org.apache.thrift.TBase<LifeSpanHandler_DoClose_args, LifeSpanHandler_DoClose_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_DoClose_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_DoClose_args");
+  public static class LifeSpanHandler_OnAfterCreated_args implements org.apache.thrift.TBase<LifeSpanHandler_OnAfterCreated_args, LifeSpanHandler_OnAfterCreated_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnAfterCreated_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnAfterCreated_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField NATIVE_BROWSER_IDENTIFIER_FIELD_DESC = new org.apache.thrift.protocol.TField("nativeBrowserIdentifier", org.apache.thrift.protocol.TType.I32, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_DoClose_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_DoClose_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnAfterCreated_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnAfterCreated_argsTupleSchemeFactory();
 
     public int bid; // required
+    public int nativeBrowserIdentifier; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      BID((short)1, "bid"),
+      NATIVE_BROWSER_IDENTIFIER((short)2, "nativeBrowserIdentifier");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -14237,6 +15150,8 @@ public class ClientHandlers {
         switch(fieldId) {
           case 1: // BID
             return BID;
+          case 2: // NATIVE_BROWSER_IDENTIFIER
+            return NATIVE_BROWSER_IDENTIFIER;
           default:
             return null;
         }
@@ -14281,51 +15196,60 @@ public class ClientHandlers {
 
     // isset id assignments
     private static final int __BID_ISSET_ID = 0;
+    private static final int __NATIVEBROWSERIDENTIFIER_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.NATIVE_BROWSER_IDENTIFIER, new org.apache.thrift.meta_data.FieldMetaData("nativeBrowserIdentifier", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_DoClose_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnAfterCreated_args.class, metaDataMap);
     }
 
-    public LifeSpanHandler_DoClose_args() {
+    public LifeSpanHandler_OnAfterCreated_args() {
     }
 
-    public LifeSpanHandler_DoClose_args(
-      int bid)
+    public LifeSpanHandler_OnAfterCreated_args(
+      int bid,
+      int nativeBrowserIdentifier)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
+      this.nativeBrowserIdentifier = nativeBrowserIdentifier;
+      setNativeBrowserIdentifierIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_DoClose_args(LifeSpanHandler_DoClose_args other) {
+    public LifeSpanHandler_OnAfterCreated_args(LifeSpanHandler_OnAfterCreated_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
+      this.nativeBrowserIdentifier = other.nativeBrowserIdentifier;
     }
 
     @Override
-    public LifeSpanHandler_DoClose_args deepCopy() {
-      return new LifeSpanHandler_DoClose_args(this);
+    public LifeSpanHandler_OnAfterCreated_args deepCopy() {
+      return new LifeSpanHandler_OnAfterCreated_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
+      setNativeBrowserIdentifierIsSet(false);
+      this.nativeBrowserIdentifier = 0;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public LifeSpanHandler_DoClose_args setBid(int bid) {
+    public LifeSpanHandler_OnAfterCreated_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -14344,6 +15268,29 @@ public class ClientHandlers {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
+    public int getNativeBrowserIdentifier() {
+      return this.nativeBrowserIdentifier;
+    }
+
+    public LifeSpanHandler_OnAfterCreated_args setNativeBrowserIdentifier(int nativeBrowserIdentifier) {
+      this.nativeBrowserIdentifier = nativeBrowserIdentifier;
+      setNativeBrowserIdentifierIsSet(true);
+      return this;
+    }
+
+    public void unsetNativeBrowserIdentifier() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID);
+    }
+
+    /** Returns true if field nativeBrowserIdentifier is set (has been assigned a value) and false otherwise */
+    public boolean isSetNativeBrowserIdentifier() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID);
+    }
+
+    public void setNativeBrowserIdentifierIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __NATIVEBROWSERIDENTIFIER_ISSET_ID, value);
+    }
+
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -14355,6 +15302,14 @@ public class ClientHandlers {
         }
         break;
 
+      case NATIVE_BROWSER_IDENTIFIER:
+        if (value == null) {
+          unsetNativeBrowserIdentifier();
+        } else {
+          setNativeBrowserIdentifier((java.lang.Integer)value);
+        }
+        break;
+
       }
     }
 
@@ -14365,6 +15320,9 @@ public class ClientHandlers {
       case BID:
         return getBid();
 
+      case NATIVE_BROWSER_IDENTIFIER:
+        return getNativeBrowserIdentifier();
+
       }
       throw new java.lang.IllegalStateException();
     }
@@ -14379,18 +15337,20 @@ public class ClientHandlers {
       switch (field) {
       case BID:
         return isSetBid();
+      case NATIVE_BROWSER_IDENTIFIER:
+        return isSetNativeBrowserIdentifier();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_DoClose_args)
-        return this.equals((LifeSpanHandler_DoClose_args)that);
+      if (that instanceof LifeSpanHandler_OnAfterCreated_args)
+        return this.equals((LifeSpanHandler_OnAfterCreated_args)that);
       return false;
     }
 
-    public boolean equals(LifeSpanHandler_DoClose_args that) {
+    public boolean equals(LifeSpanHandler_OnAfterCreated_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -14405,6 +15365,15 @@ public class ClientHandlers {
           return false;
       }
 
+      boolean this_present_nativeBrowserIdentifier = true;
+      boolean that_present_nativeBrowserIdentifier = true;
+      if (this_present_nativeBrowserIdentifier || that_present_nativeBrowserIdentifier) {
+        if (!(this_present_nativeBrowserIdentifier && that_present_nativeBrowserIdentifier))
+          return false;
+        if (this.nativeBrowserIdentifier != that.nativeBrowserIdentifier)
+          return false;
+      }
+
       return true;
     }
 
@@ -14414,11 +15383,13 @@ public class ClientHandlers {
 
       hashCode = hashCode * 8191 + bid;
 
+      hashCode = hashCode * 8191 + nativeBrowserIdentifier;
+
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_DoClose_args other) {
+    public int compareTo(LifeSpanHandler_OnAfterCreated_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -14435,6 +15406,16 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetNativeBrowserIdentifier(), other.isSetNativeBrowserIdentifier());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetNativeBrowserIdentifier()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.nativeBrowserIdentifier, other.nativeBrowserIdentifier);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -14456,12 +15437,16 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_DoClose_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnAfterCreated_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("nativeBrowserIdentifier:");
+      sb.append(this.nativeBrowserIdentifier);
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -14489,17 +15474,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class LifeSpanHandler_DoClose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnAfterCreated_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_DoClose_argsStandardScheme getScheme() {
-        return new LifeSpanHandler_DoClose_argsStandardScheme();
+      public LifeSpanHandler_OnAfterCreated_argsStandardScheme getScheme() {
+        return new LifeSpanHandler_OnAfterCreated_argsStandardScheme();
       }
     }
 
-    private static class LifeSpanHandler_DoClose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_DoClose_args> {
+    private static class LifeSpanHandler_OnAfterCreated_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_OnAfterCreated_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -14517,6 +15502,14 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
+            case 2: // NATIVE_BROWSER_IDENTIFIER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.nativeBrowserIdentifier = iprot.readI32();
+                struct.setNativeBrowserIdentifierIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -14529,49 +15522,62 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
+        oprot.writeFieldBegin(NATIVE_BROWSER_IDENTIFIER_FIELD_DESC);
+        oprot.writeI32(struct.nativeBrowserIdentifier);
+        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class LifeSpanHandler_DoClose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_OnAfterCreated_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_DoClose_argsTupleScheme getScheme() {
-        return new LifeSpanHandler_DoClose_argsTupleScheme();
+      public LifeSpanHandler_OnAfterCreated_argsTupleScheme getScheme() {
+        return new LifeSpanHandler_OnAfterCreated_argsTupleScheme();
       }
     }
 
-    private static class LifeSpanHandler_DoClose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_DoClose_args> {
+    private static class LifeSpanHandler_OnAfterCreated_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_OnAfterCreated_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetNativeBrowserIdentifier()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
+        if (struct.isSetNativeBrowserIdentifier()) {
+          oprot.writeI32(struct.nativeBrowserIdentifier);
+        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_OnAfterCreated_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
+        if (incoming.get(1)) {
+          struct.nativeBrowserIdentifier = iprot.readI32();
+          struct.setNativeBrowserIdentifierIsSet(true);
+        }
       }
     }
 
@@ -14581,19 +15587,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_DoClose_result implements org.apache.thrift.TBase<LifeSpanHandler_DoClose_result, LifeSpanHandler_DoClose_result._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_DoClose_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_DoClose_result");
+  public static class LifeSpanHandler_DoClose_args implements org.apache.thrift.TBase<LifeSpanHandler_DoClose_args, LifeSpanHandler_DoClose_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_DoClose_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_DoClose_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_DoClose_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_DoClose_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_DoClose_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_DoClose_argsTupleSchemeFactory();
 
-    public boolean success; // required
+    public int bid; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+      BID((short)1, "bid");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -14609,8 +15615,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
+          case 1: // BID
+            return BID;
           default:
             return null;
         }
@@ -14654,78 +15660,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
+    private static final int __BID_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_DoClose_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_DoClose_args.class, metaDataMap);
     }
 
-    public LifeSpanHandler_DoClose_result() {
+    public LifeSpanHandler_DoClose_args() {
     }
 
-    public LifeSpanHandler_DoClose_result(
-      boolean success)
+    public LifeSpanHandler_DoClose_args(
+      int bid)
     {
       this();
-      this.success = success;
-      setSuccessIsSet(true);
+      this.bid = bid;
+      setBidIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_DoClose_result(LifeSpanHandler_DoClose_result other) {
+    public LifeSpanHandler_DoClose_args(LifeSpanHandler_DoClose_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.success = other.success;
+      this.bid = other.bid;
     }
 
     @Override
-    public LifeSpanHandler_DoClose_result deepCopy() {
-      return new LifeSpanHandler_DoClose_result(this);
+    public LifeSpanHandler_DoClose_args deepCopy() {
+      return new LifeSpanHandler_DoClose_args(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = false;
+      setBidIsSet(false);
+      this.bid = 0;
     }
 
-    public boolean isSuccess() {
-      return this.success;
+    public int getBid() {
+      return this.bid;
     }
 
-    public LifeSpanHandler_DoClose_result setSuccess(boolean success) {
-      this.success = success;
-      setSuccessIsSet(true);
+    public LifeSpanHandler_DoClose_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
       return this;
     }
 
-    public void unsetSuccess() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    public void setSuccessIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
+      case BID:
         if (value == null) {
-          unsetSuccess();
+          unsetBid();
         } else {
-          setSuccess((java.lang.Boolean)value);
+          setBid((java.lang.Integer)value);
         }
         break;
 
@@ -14736,8 +15742,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return isSuccess();
+      case BID:
+        return getBid();
 
       }
       throw new java.lang.IllegalStateException();
@@ -14751,31 +15757,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
+      case BID:
+        return isSetBid();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_DoClose_result)
-        return this.equals((LifeSpanHandler_DoClose_result)that);
+      if (that instanceof LifeSpanHandler_DoClose_args)
+        return this.equals((LifeSpanHandler_DoClose_args)that);
       return false;
     }
 
-    public boolean equals(LifeSpanHandler_DoClose_result that) {
+    public boolean equals(LifeSpanHandler_DoClose_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
           return false;
-        if (this.success != that.success)
+        if (this.bid != that.bid)
           return false;
       }
 
@@ -14786,25 +15792,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
+      hashCode = hashCode * 8191 + bid;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_DoClose_result other) {
+    public int compareTo(LifeSpanHandler_DoClose_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -14823,17 +15829,18 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_DoClose_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_DoClose_args(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
+      sb.append("bid:");
+      sb.append(this.bid);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -14862,17 +15869,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class LifeSpanHandler_DoClose_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_DoClose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_DoClose_resultStandardScheme getScheme() {
-        return new LifeSpanHandler_DoClose_resultStandardScheme();
+      public LifeSpanHandler_DoClose_argsStandardScheme getScheme() {
+        return new LifeSpanHandler_DoClose_argsStandardScheme();
       }
     }
 
-    private static class LifeSpanHandler_DoClose_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_DoClose_result> {
+    private static class LifeSpanHandler_DoClose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_DoClose_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -14882,10 +15889,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
-                struct.success = iprot.readBool();
-                struct.setSuccessIsSet(true);
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -14902,50 +15909,48 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.isSetSuccess()) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeBool(struct.success);
-          oprot.writeFieldEnd();
-        }
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class LifeSpanHandler_DoClose_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class LifeSpanHandler_DoClose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public LifeSpanHandler_DoClose_resultTupleScheme getScheme() {
-        return new LifeSpanHandler_DoClose_resultTupleScheme();
+      public LifeSpanHandler_DoClose_argsTupleScheme getScheme() {
+        return new LifeSpanHandler_DoClose_argsTupleScheme();
       }
     }
 
-    private static class LifeSpanHandler_DoClose_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_DoClose_result> {
+    private static class LifeSpanHandler_DoClose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_DoClose_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetBid()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          oprot.writeBool(struct.success);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = iprot.readBool();
-          struct.setSuccessIsSet(true);
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
         }
       }
     }
@@ -14956,19 +15961,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class LifeSpanHandler_OnBeforeClose_args implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforeClose_args, LifeSpanHandler_OnBeforeClose_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforeClose_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforeClose_args");
+  public static class LifeSpanHandler_DoClose_result implements org.apache.thrift.TBase<LifeSpanHandler_DoClose_result, LifeSpanHandler_DoClose_result._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_DoClose_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_DoClose_result");
 
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforeClose_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforeClose_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_DoClose_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_DoClose_resultTupleSchemeFactory();
 
-    public int bid; // required
+    public boolean success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -14984,8 +15989,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // BID
-            return BID;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -15029,78 +16034,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __BID_ISSET_ID = 0;
+    private static final int __SUCCESS_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforeClose_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_DoClose_result.class, metaDataMap);
     }
 
-    public LifeSpanHandler_OnBeforeClose_args() {
+    public LifeSpanHandler_DoClose_result() {
     }
 
-    public LifeSpanHandler_OnBeforeClose_args(
-      int bid)
+    public LifeSpanHandler_DoClose_result(
+      boolean success)
     {
       this();
-      this.bid = bid;
-      setBidIsSet(true);
+      this.success = success;
+      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public LifeSpanHandler_OnBeforeClose_args(LifeSpanHandler_OnBeforeClose_args other) {
+    public LifeSpanHandler_DoClose_result(LifeSpanHandler_DoClose_result other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.bid = other.bid;
+      this.success = other.success;
     }
 
     @Override
-    public LifeSpanHandler_OnBeforeClose_args deepCopy() {
-      return new LifeSpanHandler_OnBeforeClose_args(this);
+    public LifeSpanHandler_DoClose_result deepCopy() {
+      return new LifeSpanHandler_DoClose_result(this);
     }
 
     @Override
     public void clear() {
-      setBidIsSet(false);
-      this.bid = 0;
+      setSuccessIsSet(false);
+      this.success = false;
     }
 
-    public int getBid() {
-      return this.bid;
+    public boolean isSuccess() {
+      return this.success;
     }
 
-    public LifeSpanHandler_OnBeforeClose_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
+    public LifeSpanHandler_DoClose_result setSuccess(boolean success) {
+      this.success = success;
+      setSuccessIsSet(true);
       return this;
     }
 
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    public void unsetSuccess() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case BID:
+      case SUCCESS:
         if (value == null) {
-          unsetBid();
+          unsetSuccess();
         } else {
-          setBid((java.lang.Integer)value);
+          setSuccess((java.lang.Boolean)value);
         }
         break;
 
@@ -15111,8 +16116,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case BID:
-        return getBid();
+      case SUCCESS:
+        return isSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -15126,31 +16131,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case BID:
-        return isSetBid();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof LifeSpanHandler_OnBeforeClose_args)
-        return this.equals((LifeSpanHandler_OnBeforeClose_args)that);
+      if (that instanceof LifeSpanHandler_DoClose_result)
+        return this.equals((LifeSpanHandler_DoClose_result)that);
       return false;
     }
 
-    public boolean equals(LifeSpanHandler_OnBeforeClose_args that) {
+    public boolean equals(LifeSpanHandler_DoClose_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.bid != that.bid)
+        if (this.success != that.success)
           return false;
       }
 
@@ -15161,25 +16166,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + bid;
+      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(LifeSpanHandler_OnBeforeClose_args other) {
+    public int compareTo(LifeSpanHandler_DoClose_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -15198,18 +16203,393 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforeClose_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_DoClose_result(");
       boolean first = true;
 
-      sb.append("bid:");
-      sb.append(this.bid);
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class LifeSpanHandler_DoClose_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public LifeSpanHandler_DoClose_resultStandardScheme getScheme() {
+        return new LifeSpanHandler_DoClose_resultStandardScheme();
+      }
+    }
+
+    private static class LifeSpanHandler_DoClose_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<LifeSpanHandler_DoClose_result> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+                struct.success = iprot.readBool();
+                struct.setSuccessIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        if (struct.isSetSuccess()) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeBool(struct.success);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class LifeSpanHandler_DoClose_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public LifeSpanHandler_DoClose_resultTupleScheme getScheme() {
+        return new LifeSpanHandler_DoClose_resultTupleScheme();
+      }
+    }
+
+    private static class LifeSpanHandler_DoClose_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<LifeSpanHandler_DoClose_result> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetSuccess()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetSuccess()) {
+          oprot.writeBool(struct.success);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, LifeSpanHandler_DoClose_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.success = iprot.readBool();
+          struct.setSuccessIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class LifeSpanHandler_OnBeforeClose_args implements org.apache.thrift.TBase<LifeSpanHandler_OnBeforeClose_args, LifeSpanHandler_OnBeforeClose_args._Fields>, java.io.Serializable, Cloneable, Comparable<LifeSpanHandler_OnBeforeClose_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("LifeSpanHandler_OnBeforeClose_args");
+
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new LifeSpanHandler_OnBeforeClose_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new LifeSpanHandler_OnBeforeClose_argsTupleSchemeFactory();
+
+    public int bid; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      BID((short)1, "bid");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // BID
+            return BID;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __BID_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(LifeSpanHandler_OnBeforeClose_args.class, metaDataMap);
+    }
+
+    public LifeSpanHandler_OnBeforeClose_args() {
+    }
+
+    public LifeSpanHandler_OnBeforeClose_args(
+      int bid)
+    {
+      this();
+      this.bid = bid;
+      setBidIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public LifeSpanHandler_OnBeforeClose_args(LifeSpanHandler_OnBeforeClose_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.bid = other.bid;
+    }
+
+    @Override
+    public LifeSpanHandler_OnBeforeClose_args deepCopy() {
+      return new LifeSpanHandler_OnBeforeClose_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setBidIsSet(false);
+      this.bid = 0;
+    }
+
+    public int getBid() {
+      return this.bid;
+    }
+
+    public LifeSpanHandler_OnBeforeClose_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
+    }
+
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case BID:
+        return getBid();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case BID:
+        return isSetBid();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof LifeSpanHandler_OnBeforeClose_args)
+        return this.equals((LifeSpanHandler_OnBeforeClose_args)that);
+      return false;
+    }
+
+    public boolean equals(LifeSpanHandler_OnBeforeClose_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + bid;
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(LifeSpanHandler_OnBeforeClose_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+    }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("LifeSpanHandler_OnBeforeClose_args(");
+      boolean first = true;
+
+      sb.append("bid:");
+      sb.append(this.bid);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -30455,84 +31835,933 @@ public class ClientHandlers {
         return _thriftId;
       }
 
-      @Override
-      public java.lang.String getFieldName() {
-        return _fieldName;
-      }
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RequestHandler_GetResourceRequestHandler_result.class, metaDataMap);
+    }
+
+    public RequestHandler_GetResourceRequestHandler_result() {
+    }
+
+    public RequestHandler_GetResourceRequestHandler_result(
+      com.jetbrains.cef.remote.thrift_codegen.RObject success)
+    {
+      this();
+      this.success = success;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public RequestHandler_GetResourceRequestHandler_result(RequestHandler_GetResourceRequestHandler_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
+      }
+    }
+
+    @Override
+    public RequestHandler_GetResourceRequestHandler_result deepCopy() {
+      return new RequestHandler_GetResourceRequestHandler_result(this);
+    }
+
+    @Override
+    public void clear() {
+      this.success = null;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
+      return this.success;
+    }
+
+    public RequestHandler_GetResourceRequestHandler_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
+      this.success = success;
+      return this;
+    }
+
+    public void unsetSuccess() {
+      this.success = null;
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return this.success != null;
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case SUCCESS:
+        return getSuccess();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof RequestHandler_GetResourceRequestHandler_result)
+        return this.equals((RequestHandler_GetResourceRequestHandler_result)that);
+      return false;
+    }
+
+    public boolean equals(RequestHandler_GetResourceRequestHandler_result that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (!this.success.equals(that.success))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(RequestHandler_GetResourceRequestHandler_result other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+      }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("RequestHandler_GetResourceRequestHandler_result(");
+      boolean first = true;
+
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+      if (success != null) {
+        success.validate();
+      }
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class RequestHandler_GetResourceRequestHandler_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public RequestHandler_GetResourceRequestHandler_resultStandardScheme getScheme() {
+        return new RequestHandler_GetResourceRequestHandler_resultStandardScheme();
+      }
+    }
+
+    private static class RequestHandler_GetResourceRequestHandler_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<RequestHandler_GetResourceRequestHandler_result> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.success.read(iprot);
+                struct.setSuccessIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        if (struct.success != null) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          struct.success.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class RequestHandler_GetResourceRequestHandler_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public RequestHandler_GetResourceRequestHandler_resultTupleScheme getScheme() {
+        return new RequestHandler_GetResourceRequestHandler_resultTupleScheme();
+      }
+    }
+
+    private static class RequestHandler_GetResourceRequestHandler_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<RequestHandler_GetResourceRequestHandler_result> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetSuccess()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetSuccess()) {
+          struct.success.write(oprot);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.success.read(iprot);
+          struct.setSuccessIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class ResourceRequestHandler_Dispose_args implements org.apache.thrift.TBase<ResourceRequestHandler_Dispose_args, ResourceRequestHandler_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_Dispose_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_Dispose_args");
+
+    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_Dispose_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_Dispose_argsTupleSchemeFactory();
+
+    public int rrHandler; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      RR_HANDLER((short)1, "rrHandler");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // RR_HANDLER
+            return RR_HANDLER;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __RRHANDLER_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_Dispose_args.class, metaDataMap);
+    }
+
+    public ResourceRequestHandler_Dispose_args() {
+    }
+
+    public ResourceRequestHandler_Dispose_args(
+      int rrHandler)
+    {
+      this();
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public ResourceRequestHandler_Dispose_args(ResourceRequestHandler_Dispose_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.rrHandler = other.rrHandler;
+    }
+
+    @Override
+    public ResourceRequestHandler_Dispose_args deepCopy() {
+      return new ResourceRequestHandler_Dispose_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setRrHandlerIsSet(false);
+      this.rrHandler = 0;
+    }
+
+    public int getRrHandler() {
+      return this.rrHandler;
+    }
+
+    public ResourceRequestHandler_Dispose_args setRrHandler(int rrHandler) {
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
+      return this;
+    }
+
+    public void unsetRrHandler() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
+    }
+
+    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
+    public boolean isSetRrHandler() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
+    }
+
+    public void setRrHandlerIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case RR_HANDLER:
+        if (value == null) {
+          unsetRrHandler();
+        } else {
+          setRrHandler((java.lang.Integer)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case RR_HANDLER:
+        return getRrHandler();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case RR_HANDLER:
+        return isSetRrHandler();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof ResourceRequestHandler_Dispose_args)
+        return this.equals((ResourceRequestHandler_Dispose_args)that);
+      return false;
+    }
+
+    public boolean equals(ResourceRequestHandler_Dispose_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_rrHandler = true;
+      boolean that_present_rrHandler = true;
+      if (this_present_rrHandler || that_present_rrHandler) {
+        if (!(this_present_rrHandler && that_present_rrHandler))
+          return false;
+        if (this.rrHandler != that.rrHandler)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + rrHandler;
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(ResourceRequestHandler_Dispose_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetRrHandler()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+    }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_Dispose_args(");
+      boolean first = true;
+
+      sb.append("rrHandler:");
+      sb.append(this.rrHandler);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class ResourceRequestHandler_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public ResourceRequestHandler_Dispose_argsStandardScheme getScheme() {
+        return new ResourceRequestHandler_Dispose_argsStandardScheme();
+      }
+    }
+
+    private static class ResourceRequestHandler_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_Dispose_args> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 1: // RR_HANDLER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.rrHandler = iprot.readI32();
+                struct.setRrHandlerIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
+        oprot.writeI32(struct.rrHandler);
+        oprot.writeFieldEnd();
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class ResourceRequestHandler_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public ResourceRequestHandler_Dispose_argsTupleScheme getScheme() {
+        return new ResourceRequestHandler_Dispose_argsTupleScheme();
+      }
+    }
+
+    private static class ResourceRequestHandler_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_Dispose_args> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetRrHandler()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetRrHandler()) {
+          oprot.writeI32(struct.rrHandler);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.rrHandler = iprot.readI32();
+          struct.setRrHandlerIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class ResourceRequestHandler_GetCookieAccessFilter_args implements org.apache.thrift.TBase<ResourceRequestHandler_GetCookieAccessFilter_args, ResourceRequestHandler_GetCookieAccessFilter_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetCookieAccessFilter_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetCookieAccessFilter_args");
+
+    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
+    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_argsTupleSchemeFactory();
+
+    public int rrHandler; // required
+    public int bid; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      RR_HANDLER((short)1, "rrHandler"),
+      BID((short)2, "bid"),
+      REQUEST((short)3, "request");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // RR_HANDLER
+            return RR_HANDLER;
+          case 2: // BID
+            return BID;
+          case 3: // REQUEST
+            return REQUEST;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __RRHANDLER_ISSET_ID = 0;
+    private static final int __BID_ISSET_ID = 1;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetCookieAccessFilter_args.class, metaDataMap);
+    }
+
+    public ResourceRequestHandler_GetCookieAccessFilter_args() {
+    }
+
+    public ResourceRequestHandler_GetCookieAccessFilter_args(
+      int rrHandler,
+      int bid,
+      com.jetbrains.cef.remote.thrift_codegen.RObject request)
+    {
+      this();
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
+      this.bid = bid;
+      setBidIsSet(true);
+      this.request = request;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public ResourceRequestHandler_GetCookieAccessFilter_args(ResourceRequestHandler_GetCookieAccessFilter_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.rrHandler = other.rrHandler;
+      this.bid = other.bid;
+      if (other.isSetRequest()) {
+        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
+      }
+    }
+
+    @Override
+    public ResourceRequestHandler_GetCookieAccessFilter_args deepCopy() {
+      return new ResourceRequestHandler_GetCookieAccessFilter_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setRrHandlerIsSet(false);
+      this.rrHandler = 0;
+      setBidIsSet(false);
+      this.bid = 0;
+      this.request = null;
+    }
+
+    public int getRrHandler() {
+      return this.rrHandler;
+    }
+
+    public ResourceRequestHandler_GetCookieAccessFilter_args setRrHandler(int rrHandler) {
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
+      return this;
+    }
+
+    public void unsetRrHandler() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
     }
 
-    // isset id assignments
-    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
-    static {
-      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
-      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RequestHandler_GetResourceRequestHandler_result.class, metaDataMap);
+    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
+    public boolean isSetRrHandler() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
     }
 
-    public RequestHandler_GetResourceRequestHandler_result() {
+    public void setRrHandlerIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
     }
 
-    public RequestHandler_GetResourceRequestHandler_result(
-      com.jetbrains.cef.remote.thrift_codegen.RObject success)
-    {
-      this();
-      this.success = success;
+    public int getBid() {
+      return this.bid;
     }
 
-    /**
-     * Performs a deep copy on <i>other</i>.
-     */
-    public RequestHandler_GetResourceRequestHandler_result(RequestHandler_GetResourceRequestHandler_result other) {
-      if (other.isSetSuccess()) {
-        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
-      }
+    public ResourceRequestHandler_GetCookieAccessFilter_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
     }
 
-    @Override
-    public RequestHandler_GetResourceRequestHandler_result deepCopy() {
-      return new RequestHandler_GetResourceRequestHandler_result(this);
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    @Override
-    public void clear() {
-      this.success = null;
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
-      return this.success;
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
+      return this.request;
     }
 
-    public RequestHandler_GetResourceRequestHandler_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
-      this.success = success;
+    public ResourceRequestHandler_GetCookieAccessFilter_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+      this.request = request;
       return this;
     }
 
-    public void unsetSuccess() {
-      this.success = null;
+    public void unsetRequest() {
+      this.request = null;
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return this.success != null;
+    /** Returns true if field request is set (has been assigned a value) and false otherwise */
+    public boolean isSetRequest() {
+      return this.request != null;
     }
 
-    public void setSuccessIsSet(boolean value) {
+    public void setRequestIsSet(boolean value) {
       if (!value) {
-        this.success = null;
+        this.request = null;
       }
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
+      case RR_HANDLER:
         if (value == null) {
-          unsetSuccess();
+          unsetRrHandler();
         } else {
-          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setRrHandler((java.lang.Integer)value);
+        }
+        break;
+
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      case REQUEST:
+        if (value == null) {
+          unsetRequest();
+        } else {
+          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -30543,8 +32772,14 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
+      case RR_HANDLER:
+        return getRrHandler();
+
+      case BID:
+        return getBid();
+
+      case REQUEST:
+        return getRequest();
 
       }
       throw new java.lang.IllegalStateException();
@@ -30558,31 +32793,53 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
+      case RR_HANDLER:
+        return isSetRrHandler();
+      case BID:
+        return isSetBid();
+      case REQUEST:
+        return isSetRequest();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof RequestHandler_GetResourceRequestHandler_result)
-        return this.equals((RequestHandler_GetResourceRequestHandler_result)that);
+      if (that instanceof ResourceRequestHandler_GetCookieAccessFilter_args)
+        return this.equals((ResourceRequestHandler_GetCookieAccessFilter_args)that);
       return false;
     }
 
-    public boolean equals(RequestHandler_GetResourceRequestHandler_result that) {
+    public boolean equals(ResourceRequestHandler_GetCookieAccessFilter_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true && this.isSetSuccess();
-      boolean that_present_success = true && that.isSetSuccess();
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
+      boolean this_present_rrHandler = true;
+      boolean that_present_rrHandler = true;
+      if (this_present_rrHandler || that_present_rrHandler) {
+        if (!(this_present_rrHandler && that_present_rrHandler))
           return false;
-        if (!this.success.equals(that.success))
+        if (this.rrHandler != that.rrHandler)
+          return false;
+      }
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      boolean this_present_request = true && this.isSetRequest();
+      boolean that_present_request = true && that.isSetRequest();
+      if (this_present_request || that_present_request) {
+        if (!(this_present_request && that_present_request))
+          return false;
+        if (!this.request.equals(that.request))
           return false;
       }
 
@@ -30593,27 +32850,51 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
-      if (isSetSuccess())
-        hashCode = hashCode * 8191 + success.hashCode();
+      hashCode = hashCode * 8191 + rrHandler;
+
+      hashCode = hashCode * 8191 + bid;
+
+      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
+      if (isSetRequest())
+        hashCode = hashCode * 8191 + request.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(RequestHandler_GetResourceRequestHandler_result other) {
+    public int compareTo(ResourceRequestHandler_GetCookieAccessFilter_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetRrHandler()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetRequest()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -30632,20 +32913,29 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("RequestHandler_GetResourceRequestHandler_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetCookieAccessFilter_args(");
       boolean first = true;
 
-      sb.append("success:");
-      if (this.success == null) {
+      sb.append("rrHandler:");
+      sb.append(this.rrHandler);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("request:");
+      if (this.request == null) {
         sb.append("null");
       } else {
-        sb.append(this.success);
+        sb.append(this.request);
       }
       first = false;
       sb.append(")");
@@ -30655,8 +32945,8 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (success != null) {
-        success.validate();
+      if (request != null) {
+        request.validate();
       }
     }
 
@@ -30670,23 +32960,25 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class RequestHandler_GetResourceRequestHandler_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public RequestHandler_GetResourceRequestHandler_resultStandardScheme getScheme() {
-        return new RequestHandler_GetResourceRequestHandler_resultStandardScheme();
+      public ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme getScheme() {
+        return new ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme();
       }
     }
 
-    private static class RequestHandler_GetResourceRequestHandler_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<RequestHandler_GetResourceRequestHandler_result> {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetCookieAccessFilter_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -30696,11 +32988,27 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
+            case 1: // RR_HANDLER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.rrHandler = iprot.readI32();
+                struct.setRrHandlerIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // REQUEST
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.success.read(iprot);
-                struct.setSuccessIsSet(true);
+                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.request.read(iprot);
+                struct.setRequestIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -30717,13 +33025,19 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.success != null) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          struct.success.write(oprot);
+        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
+        oprot.writeI32(struct.rrHandler);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        if (struct.request != null) {
+          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
+          struct.request.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -30732,36 +33046,56 @@ public class ClientHandlers {
 
     }
 
-    private static class RequestHandler_GetResourceRequestHandler_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public RequestHandler_GetResourceRequestHandler_resultTupleScheme getScheme() {
-        return new RequestHandler_GetResourceRequestHandler_resultTupleScheme();
+      public ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme getScheme() {
+        return new ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme();
       }
     }
 
-    private static class RequestHandler_GetResourceRequestHandler_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<RequestHandler_GetResourceRequestHandler_result> {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetCookieAccessFilter_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetRrHandler()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          struct.success.write(oprot);
+        if (struct.isSetBid()) {
+          optionals.set(1);
+        }
+        if (struct.isSetRequest()) {
+          optionals.set(2);
+        }
+        oprot.writeBitSet(optionals, 3);
+        if (struct.isSetRrHandler()) {
+          oprot.writeI32(struct.rrHandler);
+        }
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+        if (struct.isSetRequest()) {
+          struct.request.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, RequestHandler_GetResourceRequestHandler_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(3);
         if (incoming.get(0)) {
-          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.success.read(iprot);
-          struct.setSuccessIsSet(true);
+          struct.rrHandler = iprot.readI32();
+          struct.setRrHandlerIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.request.read(iprot);
+          struct.setRequestIsSet(true);
         }
       }
     }
@@ -30772,19 +33106,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_Dispose_args implements org.apache.thrift.TBase<ResourceRequestHandler_Dispose_args, ResourceRequestHandler_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_Dispose_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_Dispose_args");
+  public static class ResourceRequestHandler_GetCookieAccessFilter_result implements org.apache.thrift.TBase<ResourceRequestHandler_GetCookieAccessFilter_result, ResourceRequestHandler_GetCookieAccessFilter_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetCookieAccessFilter_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetCookieAccessFilter_result");
 
-    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_Dispose_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_Dispose_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_resultTupleSchemeFactory();
 
-    public int rrHandler; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      RR_HANDLER((short)1, "rrHandler");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -30800,8 +33134,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // RR_HANDLER
-            return RR_HANDLER;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -30845,78 +33179,77 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __RRHANDLER_ISSET_ID = 0;
-    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_Dispose_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetCookieAccessFilter_result.class, metaDataMap);
     }
 
-    public ResourceRequestHandler_Dispose_args() {
+    public ResourceRequestHandler_GetCookieAccessFilter_result() {
     }
 
-    public ResourceRequestHandler_Dispose_args(
-      int rrHandler)
+    public ResourceRequestHandler_GetCookieAccessFilter_result(
+      com.jetbrains.cef.remote.thrift_codegen.RObject success)
     {
       this();
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
+      this.success = success;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceRequestHandler_Dispose_args(ResourceRequestHandler_Dispose_args other) {
-      __isset_bitfield = other.__isset_bitfield;
-      this.rrHandler = other.rrHandler;
+    public ResourceRequestHandler_GetCookieAccessFilter_result(ResourceRequestHandler_GetCookieAccessFilter_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
+      }
     }
 
     @Override
-    public ResourceRequestHandler_Dispose_args deepCopy() {
-      return new ResourceRequestHandler_Dispose_args(this);
+    public ResourceRequestHandler_GetCookieAccessFilter_result deepCopy() {
+      return new ResourceRequestHandler_GetCookieAccessFilter_result(this);
     }
 
     @Override
     public void clear() {
-      setRrHandlerIsSet(false);
-      this.rrHandler = 0;
+      this.success = null;
     }
 
-    public int getRrHandler() {
-      return this.rrHandler;
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
+      return this.success;
     }
 
-    public ResourceRequestHandler_Dispose_args setRrHandler(int rrHandler) {
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
+    public ResourceRequestHandler_GetCookieAccessFilter_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
+      this.success = success;
       return this;
     }
 
-    public void unsetRrHandler() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
+    public void unsetSuccess() {
+      this.success = null;
     }
 
-    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
-    public boolean isSetRrHandler() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return this.success != null;
     }
 
-    public void setRrHandlerIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case RR_HANDLER:
+      case SUCCESS:
         if (value == null) {
-          unsetRrHandler();
+          unsetSuccess();
         } else {
-          setRrHandler((java.lang.Integer)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -30927,8 +33260,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case RR_HANDLER:
-        return getRrHandler();
+      case SUCCESS:
+        return getSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -30942,31 +33275,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case RR_HANDLER:
-        return isSetRrHandler();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_Dispose_args)
-        return this.equals((ResourceRequestHandler_Dispose_args)that);
+      if (that instanceof ResourceRequestHandler_GetCookieAccessFilter_result)
+        return this.equals((ResourceRequestHandler_GetCookieAccessFilter_result)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_Dispose_args that) {
+    public boolean equals(ResourceRequestHandler_GetCookieAccessFilter_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_rrHandler = true;
-      boolean that_present_rrHandler = true;
-      if (this_present_rrHandler || that_present_rrHandler) {
-        if (!(this_present_rrHandler && that_present_rrHandler))
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.rrHandler != that.rrHandler)
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -30977,25 +33310,27 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + rrHandler;
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_Dispose_args other) {
+    public int compareTo(ResourceRequestHandler_GetCookieAccessFilter_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetRrHandler()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -31014,18 +33349,21 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_Dispose_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetCookieAccessFilter_result(");
       boolean first = true;
 
-      sb.append("rrHandler:");
-      sb.append(this.rrHandler);
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -31034,6 +33372,9 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
+      if (success != null) {
+        success.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -31046,25 +33387,23 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class ResourceRequestHandler_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_Dispose_argsStandardScheme getScheme() {
-        return new ResourceRequestHandler_Dispose_argsStandardScheme();
+      public ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme getScheme() {
+        return new ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_Dispose_args> {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetCookieAccessFilter_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -31074,10 +33413,11 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // RR_HANDLER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.rrHandler = iprot.readI32();
-                struct.setRrHandlerIsSet(true);
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.success.read(iprot);
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -31094,48 +33434,51 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
-        oprot.writeI32(struct.rrHandler);
-        oprot.writeFieldEnd();
+        if (struct.success != null) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          struct.success.write(oprot);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class ResourceRequestHandler_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_Dispose_argsTupleScheme getScheme() {
-        return new ResourceRequestHandler_Dispose_argsTupleScheme();
+      public ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme getScheme() {
+        return new ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_Dispose_args> {
+    private static class ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetCookieAccessFilter_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetRrHandler()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetRrHandler()) {
-          oprot.writeI32(struct.rrHandler);
+        if (struct.isSetSuccess()) {
+          struct.success.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.rrHandler = iprot.readI32();
-          struct.setRrHandlerIsSet(true);
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.success.read(iprot);
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -31146,25 +33489,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_GetCookieAccessFilter_args implements org.apache.thrift.TBase<ResourceRequestHandler_GetCookieAccessFilter_args, ResourceRequestHandler_GetCookieAccessFilter_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetCookieAccessFilter_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetCookieAccessFilter_args");
-
-    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
-    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+  public static class CookieAccessFilter_Dispose_args implements org.apache.thrift.TBase<CookieAccessFilter_Dispose_args, CookieAccessFilter_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_Dispose_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_Dispose_args");
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_argsTupleSchemeFactory();
+    private static final org.apache.thrift.protocol.TField FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("filter", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    public int rrHandler; // required
-    public int bid; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_Dispose_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_Dispose_argsTupleSchemeFactory();
+
+    public int filter; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      RR_HANDLER((short)1, "rrHandler"),
-      BID((short)2, "bid"),
-      REQUEST((short)3, "request");
+      FILTER((short)1, "filter");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -31180,12 +33517,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // RR_HANDLER
-            return RR_HANDLER;
-          case 2: // BID
-            return BID;
-          case 3: // REQUEST
-            return REQUEST;
+          case 1: // FILTER
+            return FILTER;
           default:
             return null;
         }
@@ -31229,159 +33562,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __RRHANDLER_ISSET_ID = 0;
-    private static final int __BID_ISSET_ID = 1;
+    private static final int __FILTER_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.FILTER, new org.apache.thrift.meta_data.FieldMetaData("filter", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetCookieAccessFilter_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_Dispose_args.class, metaDataMap);
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_args() {
+    public CookieAccessFilter_Dispose_args() {
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_args(
-      int rrHandler,
-      int bid,
-      com.jetbrains.cef.remote.thrift_codegen.RObject request)
+    public CookieAccessFilter_Dispose_args(
+      int filter)
     {
       this();
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
-      this.bid = bid;
-      setBidIsSet(true);
-      this.request = request;
+      this.filter = filter;
+      setFilterIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceRequestHandler_GetCookieAccessFilter_args(ResourceRequestHandler_GetCookieAccessFilter_args other) {
+    public CookieAccessFilter_Dispose_args(CookieAccessFilter_Dispose_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.rrHandler = other.rrHandler;
-      this.bid = other.bid;
-      if (other.isSetRequest()) {
-        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
-      }
+      this.filter = other.filter;
     }
 
     @Override
-    public ResourceRequestHandler_GetCookieAccessFilter_args deepCopy() {
-      return new ResourceRequestHandler_GetCookieAccessFilter_args(this);
+    public CookieAccessFilter_Dispose_args deepCopy() {
+      return new CookieAccessFilter_Dispose_args(this);
     }
 
     @Override
     public void clear() {
-      setRrHandlerIsSet(false);
-      this.rrHandler = 0;
-      setBidIsSet(false);
-      this.bid = 0;
-      this.request = null;
-    }
-
-    public int getRrHandler() {
-      return this.rrHandler;
-    }
-
-    public ResourceRequestHandler_GetCookieAccessFilter_args setRrHandler(int rrHandler) {
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
-      return this;
-    }
-
-    public void unsetRrHandler() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
-    }
-
-    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
-    public boolean isSetRrHandler() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
-    }
-
-    public void setRrHandlerIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
-    }
-
-    public int getBid() {
-      return this.bid;
-    }
-
-    public ResourceRequestHandler_GetCookieAccessFilter_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
-      return this;
-    }
-
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+      setFilterIsSet(false);
+      this.filter = 0;
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
-      return this.request;
+    public int getFilter() {
+      return this.filter;
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
-      this.request = request;
+    public CookieAccessFilter_Dispose_args setFilter(int filter) {
+      this.filter = filter;
+      setFilterIsSet(true);
       return this;
     }
 
-    public void unsetRequest() {
-      this.request = null;
+    public void unsetFilter() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FILTER_ISSET_ID);
     }
 
-    /** Returns true if field request is set (has been assigned a value) and false otherwise */
-    public boolean isSetRequest() {
-      return this.request != null;
+    /** Returns true if field filter is set (has been assigned a value) and false otherwise */
+    public boolean isSetFilter() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FILTER_ISSET_ID);
     }
 
-    public void setRequestIsSet(boolean value) {
-      if (!value) {
-        this.request = null;
-      }
+    public void setFilterIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FILTER_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case RR_HANDLER:
-        if (value == null) {
-          unsetRrHandler();
-        } else {
-          setRrHandler((java.lang.Integer)value);
-        }
-        break;
-
-      case BID:
-        if (value == null) {
-          unsetBid();
-        } else {
-          setBid((java.lang.Integer)value);
-        }
-        break;
-
-      case REQUEST:
+      case FILTER:
         if (value == null) {
-          unsetRequest();
+          unsetFilter();
         } else {
-          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setFilter((java.lang.Integer)value);
         }
         break;
 
@@ -31392,14 +33644,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case RR_HANDLER:
-        return getRrHandler();
-
-      case BID:
-        return getBid();
-
-      case REQUEST:
-        return getRequest();
+      case FILTER:
+        return getFilter();
 
       }
       throw new java.lang.IllegalStateException();
@@ -31413,53 +33659,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case RR_HANDLER:
-        return isSetRrHandler();
-      case BID:
-        return isSetBid();
-      case REQUEST:
-        return isSetRequest();
+      case FILTER:
+        return isSetFilter();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_GetCookieAccessFilter_args)
-        return this.equals((ResourceRequestHandler_GetCookieAccessFilter_args)that);
+      if (that instanceof CookieAccessFilter_Dispose_args)
+        return this.equals((CookieAccessFilter_Dispose_args)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_GetCookieAccessFilter_args that) {
+    public boolean equals(CookieAccessFilter_Dispose_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_rrHandler = true;
-      boolean that_present_rrHandler = true;
-      if (this_present_rrHandler || that_present_rrHandler) {
-        if (!(this_present_rrHandler && that_present_rrHandler))
-          return false;
-        if (this.rrHandler != that.rrHandler)
-          return false;
-      }
-
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
-          return false;
-        if (this.bid != that.bid)
-          return false;
-      }
-
-      boolean this_present_request = true && this.isSetRequest();
-      boolean that_present_request = true && that.isSetRequest();
-      if (this_present_request || that_present_request) {
-        if (!(this_present_request && that_present_request))
+      boolean this_present_filter = true;
+      boolean that_present_filter = true;
+      if (this_present_filter || that_present_filter) {
+        if (!(this_present_filter && that_present_filter))
           return false;
-        if (!this.request.equals(that.request))
+        if (this.filter != that.filter)
           return false;
       }
 
@@ -31470,51 +33694,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + rrHandler;
-
-      hashCode = hashCode * 8191 + bid;
-
-      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
-      if (isSetRequest())
-        hashCode = hashCode * 8191 + request.hashCode();
+      hashCode = hashCode * 8191 + filter;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_GetCookieAccessFilter_args other) {
+    public int compareTo(CookieAccessFilter_Dispose_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetRrHandler()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
+      lastComparison = java.lang.Boolean.compare(isSetFilter(), other.isSetFilter());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetRequest()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
+      if (isSetFilter()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.filter, other.filter);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -31540,23 +33738,11 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetCookieAccessFilter_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_Dispose_args(");
       boolean first = true;
 
-      sb.append("rrHandler:");
-      sb.append(this.rrHandler);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("bid:");
-      sb.append(this.bid);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("request:");
-      if (this.request == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.request);
-      }
+      sb.append("filter:");
+      sb.append(this.filter);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -31565,9 +33751,6 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (request != null) {
-        request.validate();
-      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -31588,17 +33771,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme getScheme() {
-        return new ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme();
+      public CookieAccessFilter_Dispose_argsStandardScheme getScheme() {
+        return new CookieAccessFilter_Dispose_argsStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetCookieAccessFilter_args> {
+    private static class CookieAccessFilter_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_Dispose_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -31608,27 +33791,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // RR_HANDLER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.rrHandler = iprot.readI32();
-                struct.setRrHandlerIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 2: // BID
+            case 1: // FILTER
               if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.bid = iprot.readI32();
-                struct.setBidIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 3: // REQUEST
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.request.read(iprot);
-                struct.setRequestIsSet(true);
+                struct.filter = iprot.readI32();
+                struct.setFilterIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -31645,77 +33811,48 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
-        oprot.writeI32(struct.rrHandler);
-        oprot.writeFieldEnd();
-        oprot.writeFieldBegin(BID_FIELD_DESC);
-        oprot.writeI32(struct.bid);
+        oprot.writeFieldBegin(FILTER_FIELD_DESC);
+        oprot.writeI32(struct.filter);
         oprot.writeFieldEnd();
-        if (struct.request != null) {
-          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
-          struct.request.write(oprot);
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme getScheme() {
-        return new ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme();
+      public CookieAccessFilter_Dispose_argsTupleScheme getScheme() {
+        return new CookieAccessFilter_Dispose_argsTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetCookieAccessFilter_args> {
+    private static class CookieAccessFilter_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_Dispose_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetRrHandler()) {
+        if (struct.isSetFilter()) {
           optionals.set(0);
         }
-        if (struct.isSetBid()) {
-          optionals.set(1);
-        }
-        if (struct.isSetRequest()) {
-          optionals.set(2);
-        }
-        oprot.writeBitSet(optionals, 3);
-        if (struct.isSetRrHandler()) {
-          oprot.writeI32(struct.rrHandler);
-        }
-        if (struct.isSetBid()) {
-          oprot.writeI32(struct.bid);
-        }
-        if (struct.isSetRequest()) {
-          struct.request.write(oprot);
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetFilter()) {
+          oprot.writeI32(struct.filter);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(3);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.rrHandler = iprot.readI32();
-          struct.setRrHandlerIsSet(true);
-        }
-        if (incoming.get(1)) {
-          struct.bid = iprot.readI32();
-          struct.setBidIsSet(true);
-        }
-        if (incoming.get(2)) {
-          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.request.read(iprot);
-          struct.setRequestIsSet(true);
+          struct.filter = iprot.readI32();
+          struct.setFilterIsSet(true);
         }
       }
     }
@@ -31726,19 +33863,28 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_GetCookieAccessFilter_result implements org.apache.thrift.TBase<ResourceRequestHandler_GetCookieAccessFilter_result, ResourceRequestHandler_GetCookieAccessFilter_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetCookieAccessFilter_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetCookieAccessFilter_result");
+  public static class CookieAccessFilter_CanSendCookie_args implements org.apache.thrift.TBase<CookieAccessFilter_CanSendCookie_args, CookieAccessFilter_CanSendCookie_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSendCookie_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSendCookie_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
+    private static final org.apache.thrift.protocol.TField FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("filter", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
+    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField COOKIE_FIELD_DESC = new org.apache.thrift.protocol.TField("cookie", org.apache.thrift.protocol.TType.LIST, (short)4);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetCookieAccessFilter_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_argsTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success; // required
+    public int filter; // required
+    public int bid; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+    public @org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+      FILTER((short)1, "filter"),
+      BID((short)2, "bid"),
+      REQUEST((short)3, "request"),
+      COOKIE((short)4, "cookie");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -31754,8 +33900,14 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
+          case 1: // FILTER
+            return FILTER;
+          case 2: // BID
+            return BID;
+          case 3: // REQUEST
+            return REQUEST;
+          case 4: // COOKIE
+            return COOKIE;
           default:
             return null;
         }
@@ -31799,77 +33951,218 @@ public class ClientHandlers {
     }
 
     // isset id assignments
+    private static final int __FILTER_ISSET_ID = 0;
+    private static final int __BID_ISSET_ID = 1;
+    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.FILTER, new org.apache.thrift.meta_data.FieldMetaData("filter", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      tmpMap.put(_Fields.COOKIE, new org.apache.thrift.meta_data.FieldMetaData("cookie", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+              new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING))));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetCookieAccessFilter_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSendCookie_args.class, metaDataMap);
+    }
+
+    public CookieAccessFilter_CanSendCookie_args() {
+    }
+
+    public CookieAccessFilter_CanSendCookie_args(
+      int filter,
+      int bid,
+      com.jetbrains.cef.remote.thrift_codegen.RObject request,
+      java.util.List<java.lang.String> cookie)
+    {
+      this();
+      this.filter = filter;
+      setFilterIsSet(true);
+      this.bid = bid;
+      setBidIsSet(true);
+      this.request = request;
+      this.cookie = cookie;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public CookieAccessFilter_CanSendCookie_args(CookieAccessFilter_CanSendCookie_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.filter = other.filter;
+      this.bid = other.bid;
+      if (other.isSetRequest()) {
+        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
+      }
+      if (other.isSetCookie()) {
+        java.util.List<java.lang.String> __this__cookie = new java.util.ArrayList<java.lang.String>(other.cookie);
+        this.cookie = __this__cookie;
+      }
+    }
+
+    @Override
+    public CookieAccessFilter_CanSendCookie_args deepCopy() {
+      return new CookieAccessFilter_CanSendCookie_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setFilterIsSet(false);
+      this.filter = 0;
+      setBidIsSet(false);
+      this.bid = 0;
+      this.request = null;
+      this.cookie = null;
+    }
+
+    public int getFilter() {
+      return this.filter;
+    }
+
+    public CookieAccessFilter_CanSendCookie_args setFilter(int filter) {
+      this.filter = filter;
+      setFilterIsSet(true);
+      return this;
+    }
+
+    public void unsetFilter() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FILTER_ISSET_ID);
+    }
+
+    /** Returns true if field filter is set (has been assigned a value) and false otherwise */
+    public boolean isSetFilter() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FILTER_ISSET_ID);
+    }
+
+    public void setFilterIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FILTER_ISSET_ID, value);
+    }
+
+    public int getBid() {
+      return this.bid;
+    }
+
+    public CookieAccessFilter_CanSendCookie_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
+    }
+
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
+      return this.request;
+    }
+
+    public CookieAccessFilter_CanSendCookie_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+      this.request = request;
+      return this;
+    }
+
+    public void unsetRequest() {
+      this.request = null;
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_result() {
+    /** Returns true if field request is set (has been assigned a value) and false otherwise */
+    public boolean isSetRequest() {
+      return this.request != null;
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_result(
-      com.jetbrains.cef.remote.thrift_codegen.RObject success)
-    {
-      this();
-      this.success = success;
+    public void setRequestIsSet(boolean value) {
+      if (!value) {
+        this.request = null;
+      }
     }
 
-    /**
-     * Performs a deep copy on <i>other</i>.
-     */
-    public ResourceRequestHandler_GetCookieAccessFilter_result(ResourceRequestHandler_GetCookieAccessFilter_result other) {
-      if (other.isSetSuccess()) {
-        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
-      }
+    public int getCookieSize() {
+      return (this.cookie == null) ? 0 : this.cookie.size();
     }
 
-    @Override
-    public ResourceRequestHandler_GetCookieAccessFilter_result deepCopy() {
-      return new ResourceRequestHandler_GetCookieAccessFilter_result(this);
+    @org.apache.thrift.annotation.Nullable
+    public java.util.Iterator<java.lang.String> getCookieIterator() {
+      return (this.cookie == null) ? null : this.cookie.iterator();
     }
 
-    @Override
-    public void clear() {
-      this.success = null;
+    public void addToCookie(java.lang.String elem) {
+      if (this.cookie == null) {
+        this.cookie = new java.util.ArrayList<java.lang.String>();
+      }
+      this.cookie.add(elem);
     }
 
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
-      return this.success;
+    public java.util.List<java.lang.String> getCookie() {
+      return this.cookie;
     }
 
-    public ResourceRequestHandler_GetCookieAccessFilter_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
-      this.success = success;
+    public CookieAccessFilter_CanSendCookie_args setCookie(@org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie) {
+      this.cookie = cookie;
       return this;
     }
 
-    public void unsetSuccess() {
-      this.success = null;
+    public void unsetCookie() {
+      this.cookie = null;
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return this.success != null;
+    /** Returns true if field cookie is set (has been assigned a value) and false otherwise */
+    public boolean isSetCookie() {
+      return this.cookie != null;
     }
 
-    public void setSuccessIsSet(boolean value) {
+    public void setCookieIsSet(boolean value) {
       if (!value) {
-        this.success = null;
+        this.cookie = null;
       }
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
+      case FILTER:
         if (value == null) {
-          unsetSuccess();
+          unsetFilter();
         } else {
-          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setFilter((java.lang.Integer)value);
+        }
+        break;
+
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      case REQUEST:
+        if (value == null) {
+          unsetRequest();
+        } else {
+          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+        }
+        break;
+
+      case COOKIE:
+        if (value == null) {
+          unsetCookie();
+        } else {
+          setCookie((java.util.List<java.lang.String>)value);
         }
         break;
 
@@ -31880,8 +34173,17 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
+      case FILTER:
+        return getFilter();
+
+      case BID:
+        return getBid();
+
+      case REQUEST:
+        return getRequest();
+
+      case COOKIE:
+        return getCookie();
 
       }
       throw new java.lang.IllegalStateException();
@@ -31895,31 +34197,64 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
+      case FILTER:
+        return isSetFilter();
+      case BID:
+        return isSetBid();
+      case REQUEST:
+        return isSetRequest();
+      case COOKIE:
+        return isSetCookie();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_GetCookieAccessFilter_result)
-        return this.equals((ResourceRequestHandler_GetCookieAccessFilter_result)that);
+      if (that instanceof CookieAccessFilter_CanSendCookie_args)
+        return this.equals((CookieAccessFilter_CanSendCookie_args)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_GetCookieAccessFilter_result that) {
+    public boolean equals(CookieAccessFilter_CanSendCookie_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true && this.isSetSuccess();
-      boolean that_present_success = true && that.isSetSuccess();
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
+      boolean this_present_filter = true;
+      boolean that_present_filter = true;
+      if (this_present_filter || that_present_filter) {
+        if (!(this_present_filter && that_present_filter))
           return false;
-        if (!this.success.equals(that.success))
+        if (this.filter != that.filter)
+          return false;
+      }
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      boolean this_present_request = true && this.isSetRequest();
+      boolean that_present_request = true && that.isSetRequest();
+      if (this_present_request || that_present_request) {
+        if (!(this_present_request && that_present_request))
+          return false;
+        if (!this.request.equals(that.request))
+          return false;
+      }
+
+      boolean this_present_cookie = true && this.isSetCookie();
+      boolean that_present_cookie = true && that.isSetCookie();
+      if (this_present_cookie || that_present_cookie) {
+        if (!(this_present_cookie && that_present_cookie))
+          return false;
+        if (!this.cookie.equals(that.cookie))
           return false;
       }
 
@@ -31930,27 +34265,65 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
-      if (isSetSuccess())
-        hashCode = hashCode * 8191 + success.hashCode();
+      hashCode = hashCode * 8191 + filter;
+
+      hashCode = hashCode * 8191 + bid;
+
+      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
+      if (isSetRequest())
+        hashCode = hashCode * 8191 + request.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetCookie()) ? 131071 : 524287);
+      if (isSetCookie())
+        hashCode = hashCode * 8191 + cookie.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_GetCookieAccessFilter_result other) {
+    public int compareTo(CookieAccessFilter_CanSendCookie_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetFilter(), other.isSetFilter());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetFilter()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.filter, other.filter);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetRequest()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetCookie(), other.isSetCookie());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetCookie()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.cookie, other.cookie);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -31969,20 +34342,37 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetCookieAccessFilter_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSendCookie_args(");
       boolean first = true;
 
-      sb.append("success:");
-      if (this.success == null) {
+      sb.append("filter:");
+      sb.append(this.filter);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("request:");
+      if (this.request == null) {
         sb.append("null");
       } else {
-        sb.append(this.success);
+        sb.append(this.request);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("cookie:");
+      if (this.cookie == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.cookie);
       }
       first = false;
       sb.append(")");
@@ -31992,8 +34382,8 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (success != null) {
-        success.validate();
+      if (request != null) {
+        request.validate();
       }
     }
 
@@ -32007,23 +34397,25 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSendCookie_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme getScheme() {
-        return new ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme();
+      public CookieAccessFilter_CanSendCookie_argsStandardScheme getScheme() {
+        return new CookieAccessFilter_CanSendCookie_argsStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetCookieAccessFilter_result> {
+    private static class CookieAccessFilter_CanSendCookie_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSendCookie_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -32033,11 +34425,45 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
+            case 1: // FILTER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.filter = iprot.readI32();
+                struct.setFilterIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // REQUEST
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.success.read(iprot);
-                struct.setSuccessIsSet(true);
+                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.request.read(iprot);
+                struct.setRequestIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 4: // COOKIE
+              if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+                {
+                  org.apache.thrift.protocol.TList _list0 = iprot.readListBegin();
+                  struct.cookie = new java.util.ArrayList<java.lang.String>(_list0.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _elem1;
+                  for (int _i2 = 0; _i2 < _list0.size; ++_i2)
+                  {
+                    _elem1 = iprot.readString();
+                    struct.cookie.add(_elem1);
+                  }
+                  iprot.readListEnd();
+                }
+                struct.setCookieIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -32054,13 +34480,31 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.success != null) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          struct.success.write(oprot);
+        oprot.writeFieldBegin(FILTER_FIELD_DESC);
+        oprot.writeI32(struct.filter);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        if (struct.request != null) {
+          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
+          struct.request.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        if (struct.cookie != null) {
+          oprot.writeFieldBegin(COOKIE_FIELD_DESC);
+          {
+            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, struct.cookie.size()));
+            for (java.lang.String _iter3 : struct.cookie)
+            {
+              oprot.writeString(_iter3);
+            }
+            oprot.writeListEnd();
+          }
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -32069,36 +34513,81 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSendCookie_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme getScheme() {
-        return new ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme();
+      public CookieAccessFilter_CanSendCookie_argsTupleScheme getScheme() {
+        return new CookieAccessFilter_CanSendCookie_argsTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetCookieAccessFilter_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetCookieAccessFilter_result> {
+    private static class CookieAccessFilter_CanSendCookie_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSendCookie_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetFilter()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          struct.success.write(oprot);
+        if (struct.isSetBid()) {
+          optionals.set(1);
+        }
+        if (struct.isSetRequest()) {
+          optionals.set(2);
+        }
+        if (struct.isSetCookie()) {
+          optionals.set(3);
+        }
+        oprot.writeBitSet(optionals, 4);
+        if (struct.isSetFilter()) {
+          oprot.writeI32(struct.filter);
+        }
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+        if (struct.isSetRequest()) {
+          struct.request.write(oprot);
+        }
+        if (struct.isSetCookie()) {
+          {
+            oprot.writeI32(struct.cookie.size());
+            for (java.lang.String _iter4 : struct.cookie)
+            {
+              oprot.writeString(_iter4);
+            }
+          }
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetCookieAccessFilter_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(4);
         if (incoming.get(0)) {
-          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.success.read(iprot);
-          struct.setSuccessIsSet(true);
+          struct.filter = iprot.readI32();
+          struct.setFilterIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.request.read(iprot);
+          struct.setRequestIsSet(true);
+        }
+        if (incoming.get(3)) {
+          {
+            org.apache.thrift.protocol.TList _list5 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRING);
+            struct.cookie = new java.util.ArrayList<java.lang.String>(_list5.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _elem6;
+            for (int _i7 = 0; _i7 < _list5.size; ++_i7)
+            {
+              _elem6 = iprot.readString();
+              struct.cookie.add(_elem6);
+            }
+          }
+          struct.setCookieIsSet(true);
         }
       }
     }
@@ -32109,19 +34598,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class CookieAccessFilter_Dispose_args implements org.apache.thrift.TBase<CookieAccessFilter_Dispose_args, CookieAccessFilter_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_Dispose_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_Dispose_args");
+  public static class CookieAccessFilter_CanSendCookie_result implements org.apache.thrift.TBase<CookieAccessFilter_CanSendCookie_result, CookieAccessFilter_CanSendCookie_result._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSendCookie_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSendCookie_result");
 
-    private static final org.apache.thrift.protocol.TField FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("filter", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_Dispose_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_Dispose_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_resultTupleSchemeFactory();
 
-    public int filter; // required
+    public boolean success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      FILTER((short)1, "filter");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -32137,8 +34626,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // FILTER
-            return FILTER;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -32182,78 +34671,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __FILTER_ISSET_ID = 0;
+    private static final int __SUCCESS_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.FILTER, new org.apache.thrift.meta_data.FieldMetaData("filter", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_Dispose_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSendCookie_result.class, metaDataMap);
     }
 
-    public CookieAccessFilter_Dispose_args() {
+    public CookieAccessFilter_CanSendCookie_result() {
     }
 
-    public CookieAccessFilter_Dispose_args(
-      int filter)
+    public CookieAccessFilter_CanSendCookie_result(
+      boolean success)
     {
       this();
-      this.filter = filter;
-      setFilterIsSet(true);
+      this.success = success;
+      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public CookieAccessFilter_Dispose_args(CookieAccessFilter_Dispose_args other) {
+    public CookieAccessFilter_CanSendCookie_result(CookieAccessFilter_CanSendCookie_result other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.filter = other.filter;
+      this.success = other.success;
     }
 
     @Override
-    public CookieAccessFilter_Dispose_args deepCopy() {
-      return new CookieAccessFilter_Dispose_args(this);
+    public CookieAccessFilter_CanSendCookie_result deepCopy() {
+      return new CookieAccessFilter_CanSendCookie_result(this);
     }
 
     @Override
     public void clear() {
-      setFilterIsSet(false);
-      this.filter = 0;
+      setSuccessIsSet(false);
+      this.success = false;
     }
 
-    public int getFilter() {
-      return this.filter;
+    public boolean isSuccess() {
+      return this.success;
     }
 
-    public CookieAccessFilter_Dispose_args setFilter(int filter) {
-      this.filter = filter;
-      setFilterIsSet(true);
+    public CookieAccessFilter_CanSendCookie_result setSuccess(boolean success) {
+      this.success = success;
+      setSuccessIsSet(true);
       return this;
     }
 
-    public void unsetFilter() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FILTER_ISSET_ID);
+    public void unsetSuccess() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    /** Returns true if field filter is set (has been assigned a value) and false otherwise */
-    public boolean isSetFilter() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FILTER_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    public void setFilterIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FILTER_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case FILTER:
+      case SUCCESS:
         if (value == null) {
-          unsetFilter();
+          unsetSuccess();
         } else {
-          setFilter((java.lang.Integer)value);
+          setSuccess((java.lang.Boolean)value);
         }
         break;
 
@@ -32264,8 +34753,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case FILTER:
-        return getFilter();
+      case SUCCESS:
+        return isSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -32279,31 +34768,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case FILTER:
-        return isSetFilter();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof CookieAccessFilter_Dispose_args)
-        return this.equals((CookieAccessFilter_Dispose_args)that);
+      if (that instanceof CookieAccessFilter_CanSendCookie_result)
+        return this.equals((CookieAccessFilter_CanSendCookie_result)that);
       return false;
     }
 
-    public boolean equals(CookieAccessFilter_Dispose_args that) {
+    public boolean equals(CookieAccessFilter_CanSendCookie_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_filter = true;
-      boolean that_present_filter = true;
-      if (this_present_filter || that_present_filter) {
-        if (!(this_present_filter && that_present_filter))
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.filter != that.filter)
+        if (this.success != that.success)
           return false;
       }
 
@@ -32314,25 +34803,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + filter;
+      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(CookieAccessFilter_Dispose_args other) {
+    public int compareTo(CookieAccessFilter_CanSendCookie_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetFilter(), other.isSetFilter());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetFilter()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.filter, other.filter);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -32351,18 +34840,17 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_Dispose_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSendCookie_result(");
       boolean first = true;
 
-      sb.append("filter:");
-      sb.append(this.filter);
+      sb.append("success:");
+      sb.append(this.success);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -32391,17 +34879,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class CookieAccessFilter_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSendCookie_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_Dispose_argsStandardScheme getScheme() {
-        return new CookieAccessFilter_Dispose_argsStandardScheme();
+      public CookieAccessFilter_CanSendCookie_resultStandardScheme getScheme() {
+        return new CookieAccessFilter_CanSendCookie_resultStandardScheme();
       }
     }
 
-    private static class CookieAccessFilter_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_Dispose_args> {
+    private static class CookieAccessFilter_CanSendCookie_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSendCookie_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -32411,10 +34899,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // FILTER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.filter = iprot.readI32();
-                struct.setFilterIsSet(true);
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+                struct.success = iprot.readBool();
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -32431,48 +34919,50 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(FILTER_FIELD_DESC);
-        oprot.writeI32(struct.filter);
-        oprot.writeFieldEnd();
+        if (struct.isSetSuccess()) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeBool(struct.success);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class CookieAccessFilter_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSendCookie_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_Dispose_argsTupleScheme getScheme() {
-        return new CookieAccessFilter_Dispose_argsTupleScheme();
+      public CookieAccessFilter_CanSendCookie_resultTupleScheme getScheme() {
+        return new CookieAccessFilter_CanSendCookie_resultTupleScheme();
       }
     }
 
-    private static class CookieAccessFilter_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_Dispose_args> {
+    private static class CookieAccessFilter_CanSendCookie_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSendCookie_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetFilter()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetFilter()) {
-          oprot.writeI32(struct.filter);
+        if (struct.isSetSuccess()) {
+          oprot.writeBool(struct.success);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.filter = iprot.readI32();
-          struct.setFilterIsSet(true);
+          struct.success = iprot.readBool();
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -32483,20 +34973,22 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class CookieAccessFilter_CanSendCookie_args implements org.apache.thrift.TBase<CookieAccessFilter_CanSendCookie_args, CookieAccessFilter_CanSendCookie_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSendCookie_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSendCookie_args");
+  public static class CookieAccessFilter_CanSaveCookie_args implements org.apache.thrift.TBase<CookieAccessFilter_CanSaveCookie_args, CookieAccessFilter_CanSaveCookie_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSaveCookie_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSaveCookie_args");
 
     private static final org.apache.thrift.protocol.TField FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("filter", org.apache.thrift.protocol.TType.I32, (short)1);
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
     private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
-    private static final org.apache.thrift.protocol.TField COOKIE_FIELD_DESC = new org.apache.thrift.protocol.TField("cookie", org.apache.thrift.protocol.TType.LIST, (short)4);
+    private static final org.apache.thrift.protocol.TField RESPONSE_FIELD_DESC = new org.apache.thrift.protocol.TField("response", org.apache.thrift.protocol.TType.STRUCT, (short)4);
+    private static final org.apache.thrift.protocol.TField COOKIE_FIELD_DESC = new org.apache.thrift.protocol.TField("cookie", org.apache.thrift.protocol.TType.LIST, (short)5);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_argsTupleSchemeFactory();
 
     public int filter; // required
     public int bid; // required
     public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response; // required
     public @org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -32504,7 +34996,8 @@ public class ClientHandlers {
       FILTER((short)1, "filter"),
       BID((short)2, "bid"),
       REQUEST((short)3, "request"),
-      COOKIE((short)4, "cookie");
+      RESPONSE((short)4, "response"),
+      COOKIE((short)5, "cookie");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -32526,7 +35019,9 @@ public class ClientHandlers {
             return BID;
           case 3: // REQUEST
             return REQUEST;
-          case 4: // COOKIE
+          case 4: // RESPONSE
+            return RESPONSE;
+          case 5: // COOKIE
             return COOKIE;
           default:
             return null;
@@ -32583,20 +35078,23 @@ public class ClientHandlers {
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      tmpMap.put(_Fields.RESPONSE, new org.apache.thrift.meta_data.FieldMetaData("response", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       tmpMap.put(_Fields.COOKIE, new org.apache.thrift.meta_data.FieldMetaData("cookie", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
               new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING))));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSendCookie_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSaveCookie_args.class, metaDataMap);
     }
 
-    public CookieAccessFilter_CanSendCookie_args() {
+    public CookieAccessFilter_CanSaveCookie_args() {
     }
 
-    public CookieAccessFilter_CanSendCookie_args(
+    public CookieAccessFilter_CanSaveCookie_args(
       int filter,
       int bid,
       com.jetbrains.cef.remote.thrift_codegen.RObject request,
+      com.jetbrains.cef.remote.thrift_codegen.RObject response,
       java.util.List<java.lang.String> cookie)
     {
       this();
@@ -32605,19 +35103,23 @@ public class ClientHandlers {
       this.bid = bid;
       setBidIsSet(true);
       this.request = request;
+      this.response = response;
       this.cookie = cookie;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public CookieAccessFilter_CanSendCookie_args(CookieAccessFilter_CanSendCookie_args other) {
+    public CookieAccessFilter_CanSaveCookie_args(CookieAccessFilter_CanSaveCookie_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.filter = other.filter;
       this.bid = other.bid;
       if (other.isSetRequest()) {
         this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
       }
+      if (other.isSetResponse()) {
+        this.response = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.response);
+      }
       if (other.isSetCookie()) {
         java.util.List<java.lang.String> __this__cookie = new java.util.ArrayList<java.lang.String>(other.cookie);
         this.cookie = __this__cookie;
@@ -32625,8 +35127,8 @@ public class ClientHandlers {
     }
 
     @Override
-    public CookieAccessFilter_CanSendCookie_args deepCopy() {
-      return new CookieAccessFilter_CanSendCookie_args(this);
+    public CookieAccessFilter_CanSaveCookie_args deepCopy() {
+      return new CookieAccessFilter_CanSaveCookie_args(this);
     }
 
     @Override
@@ -32636,6 +35138,7 @@ public class ClientHandlers {
       setBidIsSet(false);
       this.bid = 0;
       this.request = null;
+      this.response = null;
       this.cookie = null;
     }
 
@@ -32643,7 +35146,7 @@ public class ClientHandlers {
       return this.filter;
     }
 
-    public CookieAccessFilter_CanSendCookie_args setFilter(int filter) {
+    public CookieAccessFilter_CanSaveCookie_args setFilter(int filter) {
       this.filter = filter;
       setFilterIsSet(true);
       return this;
@@ -32666,7 +35169,7 @@ public class ClientHandlers {
       return this.bid;
     }
 
-    public CookieAccessFilter_CanSendCookie_args setBid(int bid) {
+    public CookieAccessFilter_CanSaveCookie_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -32690,7 +35193,7 @@ public class ClientHandlers {
       return this.request;
     }
 
-    public CookieAccessFilter_CanSendCookie_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+    public CookieAccessFilter_CanSaveCookie_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
       this.request = request;
       return this;
     }
@@ -32710,6 +35213,31 @@ public class ClientHandlers {
       }
     }
 
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getResponse() {
+      return this.response;
+    }
+
+    public CookieAccessFilter_CanSaveCookie_args setResponse(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response) {
+      this.response = response;
+      return this;
+    }
+
+    public void unsetResponse() {
+      this.response = null;
+    }
+
+    /** Returns true if field response is set (has been assigned a value) and false otherwise */
+    public boolean isSetResponse() {
+      return this.response != null;
+    }
+
+    public void setResponseIsSet(boolean value) {
+      if (!value) {
+        this.response = null;
+      }
+    }
+
     public int getCookieSize() {
       return (this.cookie == null) ? 0 : this.cookie.size();
     }
@@ -32731,7 +35259,7 @@ public class ClientHandlers {
       return this.cookie;
     }
 
-    public CookieAccessFilter_CanSendCookie_args setCookie(@org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie) {
+    public CookieAccessFilter_CanSaveCookie_args setCookie(@org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie) {
       this.cookie = cookie;
       return this;
     }
@@ -32778,6 +35306,14 @@ public class ClientHandlers {
         }
         break;
 
+      case RESPONSE:
+        if (value == null) {
+          unsetResponse();
+        } else {
+          setResponse((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+        }
+        break;
+
       case COOKIE:
         if (value == null) {
           unsetCookie();
@@ -32802,6 +35338,9 @@ public class ClientHandlers {
       case REQUEST:
         return getRequest();
 
+      case RESPONSE:
+        return getResponse();
+
       case COOKIE:
         return getCookie();
 
@@ -32823,6 +35362,8 @@ public class ClientHandlers {
         return isSetBid();
       case REQUEST:
         return isSetRequest();
+      case RESPONSE:
+        return isSetResponse();
       case COOKIE:
         return isSetCookie();
       }
@@ -32831,12 +35372,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof CookieAccessFilter_CanSendCookie_args)
-        return this.equals((CookieAccessFilter_CanSendCookie_args)that);
+      if (that instanceof CookieAccessFilter_CanSaveCookie_args)
+        return this.equals((CookieAccessFilter_CanSaveCookie_args)that);
       return false;
     }
 
-    public boolean equals(CookieAccessFilter_CanSendCookie_args that) {
+    public boolean equals(CookieAccessFilter_CanSaveCookie_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -32869,6 +35410,15 @@ public class ClientHandlers {
           return false;
       }
 
+      boolean this_present_response = true && this.isSetResponse();
+      boolean that_present_response = true && that.isSetResponse();
+      if (this_present_response || that_present_response) {
+        if (!(this_present_response && that_present_response))
+          return false;
+        if (!this.response.equals(that.response))
+          return false;
+      }
+
       boolean this_present_cookie = true && this.isSetCookie();
       boolean that_present_cookie = true && that.isSetCookie();
       if (this_present_cookie || that_present_cookie) {
@@ -32893,6 +35443,10 @@ public class ClientHandlers {
       if (isSetRequest())
         hashCode = hashCode * 8191 + request.hashCode();
 
+      hashCode = hashCode * 8191 + ((isSetResponse()) ? 131071 : 524287);
+      if (isSetResponse())
+        hashCode = hashCode * 8191 + response.hashCode();
+
       hashCode = hashCode * 8191 + ((isSetCookie()) ? 131071 : 524287);
       if (isSetCookie())
         hashCode = hashCode * 8191 + cookie.hashCode();
@@ -32901,7 +35455,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(CookieAccessFilter_CanSendCookie_args other) {
+    public int compareTo(CookieAccessFilter_CanSaveCookie_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -32938,6 +35492,16 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetResponse(), other.isSetResponse());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetResponse()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.response, other.response);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       lastComparison = java.lang.Boolean.compare(isSetCookie(), other.isSetCookie());
       if (lastComparison != 0) {
         return lastComparison;
@@ -32969,7 +35533,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSendCookie_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSaveCookie_args(");
       boolean first = true;
 
       sb.append("filter:");
@@ -32988,6 +35552,14 @@ public class ClientHandlers {
       }
       first = false;
       if (!first) sb.append(", ");
+      sb.append("response:");
+      if (this.response == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.response);
+      }
+      first = false;
+      if (!first) sb.append(", ");
       sb.append("cookie:");
       if (this.cookie == null) {
         sb.append("null");
@@ -33005,6 +35577,9 @@ public class ClientHandlers {
       if (request != null) {
         request.validate();
       }
+      if (response != null) {
+        response.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -33025,17 +35600,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSaveCookie_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSendCookie_argsStandardScheme getScheme() {
-        return new CookieAccessFilter_CanSendCookie_argsStandardScheme();
+      public CookieAccessFilter_CanSaveCookie_argsStandardScheme getScheme() {
+        return new CookieAccessFilter_CanSaveCookie_argsStandardScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSendCookie_args> {
+    private static class CookieAccessFilter_CanSaveCookie_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSaveCookie_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -33070,16 +35645,25 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 4: // COOKIE
+            case 4: // RESPONSE
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.response.read(iprot);
+                struct.setResponseIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 5: // COOKIE
               if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
                 {
-                  org.apache.thrift.protocol.TList _list0 = iprot.readListBegin();
-                  struct.cookie = new java.util.ArrayList<java.lang.String>(_list0.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _elem1;
-                  for (int _i2 = 0; _i2 < _list0.size; ++_i2)
+                  org.apache.thrift.protocol.TList _list8 = iprot.readListBegin();
+                  struct.cookie = new java.util.ArrayList<java.lang.String>(_list8.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _elem9;
+                  for (int _i10 = 0; _i10 < _list8.size; ++_i10)
                   {
-                    _elem1 = iprot.readString();
-                    struct.cookie.add(_elem1);
+                    _elem9 = iprot.readString();
+                    struct.cookie.add(_elem9);
                   }
                   iprot.readListEnd();
                 }
@@ -33100,7 +35684,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -33115,13 +35699,18 @@ public class ClientHandlers {
           struct.request.write(oprot);
           oprot.writeFieldEnd();
         }
+        if (struct.response != null) {
+          oprot.writeFieldBegin(RESPONSE_FIELD_DESC);
+          struct.response.write(oprot);
+          oprot.writeFieldEnd();
+        }
         if (struct.cookie != null) {
           oprot.writeFieldBegin(COOKIE_FIELD_DESC);
           {
             oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, struct.cookie.size()));
-            for (java.lang.String _iter3 : struct.cookie)
+            for (java.lang.String _iter11 : struct.cookie)
             {
-              oprot.writeString(_iter3);
+              oprot.writeString(_iter11);
             }
             oprot.writeListEnd();
           }
@@ -33133,17 +35722,17 @@ public class ClientHandlers {
 
     }
 
-    private static class CookieAccessFilter_CanSendCookie_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSaveCookie_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSendCookie_argsTupleScheme getScheme() {
-        return new CookieAccessFilter_CanSendCookie_argsTupleScheme();
+      public CookieAccessFilter_CanSaveCookie_argsTupleScheme getScheme() {
+        return new CookieAccessFilter_CanSaveCookie_argsTupleScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSendCookie_args> {
+    private static class CookieAccessFilter_CanSaveCookie_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSaveCookie_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetFilter()) {
@@ -33155,10 +35744,13 @@ public class ClientHandlers {
         if (struct.isSetRequest()) {
           optionals.set(2);
         }
-        if (struct.isSetCookie()) {
+        if (struct.isSetResponse()) {
           optionals.set(3);
         }
-        oprot.writeBitSet(optionals, 4);
+        if (struct.isSetCookie()) {
+          optionals.set(4);
+        }
+        oprot.writeBitSet(optionals, 5);
         if (struct.isSetFilter()) {
           oprot.writeI32(struct.filter);
         }
@@ -33168,21 +35760,24 @@ public class ClientHandlers {
         if (struct.isSetRequest()) {
           struct.request.write(oprot);
         }
+        if (struct.isSetResponse()) {
+          struct.response.write(oprot);
+        }
         if (struct.isSetCookie()) {
           {
             oprot.writeI32(struct.cookie.size());
-            for (java.lang.String _iter4 : struct.cookie)
+            for (java.lang.String _iter12 : struct.cookie)
             {
-              oprot.writeString(_iter4);
+              oprot.writeString(_iter12);
             }
           }
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(4);
+        java.util.BitSet incoming = iprot.readBitSet(5);
         if (incoming.get(0)) {
           struct.filter = iprot.readI32();
           struct.setFilterIsSet(true);
@@ -33197,14 +35792,19 @@ public class ClientHandlers {
           struct.setRequestIsSet(true);
         }
         if (incoming.get(3)) {
+          struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.response.read(iprot);
+          struct.setResponseIsSet(true);
+        }
+        if (incoming.get(4)) {
           {
-            org.apache.thrift.protocol.TList _list5 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRING);
-            struct.cookie = new java.util.ArrayList<java.lang.String>(_list5.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _elem6;
-            for (int _i7 = 0; _i7 < _list5.size; ++_i7)
+            org.apache.thrift.protocol.TList _list13 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRING);
+            struct.cookie = new java.util.ArrayList<java.lang.String>(_list13.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _elem14;
+            for (int _i15 = 0; _i15 < _list13.size; ++_i15)
             {
-              _elem6 = iprot.readString();
-              struct.cookie.add(_elem6);
+              _elem14 = iprot.readString();
+              struct.cookie.add(_elem14);
             }
           }
           struct.setCookieIsSet(true);
@@ -33218,13 +35818,13 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class CookieAccessFilter_CanSendCookie_result implements org.apache.thrift.TBase<CookieAccessFilter_CanSendCookie_result, CookieAccessFilter_CanSendCookie_result._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSendCookie_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSendCookie_result");
+  public static class CookieAccessFilter_CanSaveCookie_result implements org.apache.thrift.TBase<CookieAccessFilter_CanSaveCookie_result, CookieAccessFilter_CanSaveCookie_result._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSaveCookie_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSaveCookie_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSendCookie_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_resultTupleSchemeFactory();
 
     public boolean success; // required
 
@@ -33299,13 +35899,13 @@ public class ClientHandlers {
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSendCookie_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSaveCookie_result.class, metaDataMap);
     }
 
-    public CookieAccessFilter_CanSendCookie_result() {
+    public CookieAccessFilter_CanSaveCookie_result() {
     }
 
-    public CookieAccessFilter_CanSendCookie_result(
+    public CookieAccessFilter_CanSaveCookie_result(
       boolean success)
     {
       this();
@@ -33316,14 +35916,14 @@ public class ClientHandlers {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public CookieAccessFilter_CanSendCookie_result(CookieAccessFilter_CanSendCookie_result other) {
+    public CookieAccessFilter_CanSaveCookie_result(CookieAccessFilter_CanSaveCookie_result other) {
       __isset_bitfield = other.__isset_bitfield;
       this.success = other.success;
     }
 
     @Override
-    public CookieAccessFilter_CanSendCookie_result deepCopy() {
-      return new CookieAccessFilter_CanSendCookie_result(this);
+    public CookieAccessFilter_CanSaveCookie_result deepCopy() {
+      return new CookieAccessFilter_CanSaveCookie_result(this);
     }
 
     @Override
@@ -33336,7 +35936,7 @@ public class ClientHandlers {
       return this.success;
     }
 
-    public CookieAccessFilter_CanSendCookie_result setSuccess(boolean success) {
+    public CookieAccessFilter_CanSaveCookie_result setSuccess(boolean success) {
       this.success = success;
       setSuccessIsSet(true);
       return this;
@@ -33396,12 +35996,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof CookieAccessFilter_CanSendCookie_result)
-        return this.equals((CookieAccessFilter_CanSendCookie_result)that);
+      if (that instanceof CookieAccessFilter_CanSaveCookie_result)
+        return this.equals((CookieAccessFilter_CanSaveCookie_result)that);
       return false;
     }
 
-    public boolean equals(CookieAccessFilter_CanSendCookie_result that) {
+    public boolean equals(CookieAccessFilter_CanSaveCookie_result that) {
       if (that == null)
         return false;
       if (this == that)
@@ -33429,7 +36029,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(CookieAccessFilter_CanSendCookie_result other) {
+    public int compareTo(CookieAccessFilter_CanSaveCookie_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -33466,7 +36066,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSendCookie_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSaveCookie_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -33499,17 +36099,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSaveCookie_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSendCookie_resultStandardScheme getScheme() {
-        return new CookieAccessFilter_CanSendCookie_resultStandardScheme();
+      public CookieAccessFilter_CanSaveCookie_resultStandardScheme getScheme() {
+        return new CookieAccessFilter_CanSaveCookie_resultStandardScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSendCookie_result> {
+    private static class CookieAccessFilter_CanSaveCookie_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSaveCookie_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -33539,7 +36139,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -33554,17 +36154,17 @@ public class ClientHandlers {
 
     }
 
-    private static class CookieAccessFilter_CanSendCookie_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class CookieAccessFilter_CanSaveCookie_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSendCookie_resultTupleScheme getScheme() {
-        return new CookieAccessFilter_CanSendCookie_resultTupleScheme();
+      public CookieAccessFilter_CanSaveCookie_resultTupleScheme getScheme() {
+        return new CookieAccessFilter_CanSaveCookie_resultTupleScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSendCookie_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSendCookie_result> {
+    private static class CookieAccessFilter_CanSaveCookie_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSaveCookie_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -33577,7 +36177,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSendCookie_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -33593,31 +36193,25 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class CookieAccessFilter_CanSaveCookie_args implements org.apache.thrift.TBase<CookieAccessFilter_CanSaveCookie_args, CookieAccessFilter_CanSaveCookie_args._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSaveCookie_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSaveCookie_args");
+  public static class ResourceRequestHandler_OnBeforeResourceLoad_args implements org.apache.thrift.TBase<ResourceRequestHandler_OnBeforeResourceLoad_args, ResourceRequestHandler_OnBeforeResourceLoad_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_OnBeforeResourceLoad_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_OnBeforeResourceLoad_args");
 
-    private static final org.apache.thrift.protocol.TField FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("filter", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
     private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
-    private static final org.apache.thrift.protocol.TField RESPONSE_FIELD_DESC = new org.apache.thrift.protocol.TField("response", org.apache.thrift.protocol.TType.STRUCT, (short)4);
-    private static final org.apache.thrift.protocol.TField COOKIE_FIELD_DESC = new org.apache.thrift.protocol.TField("cookie", org.apache.thrift.protocol.TType.LIST, (short)5);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_argsTupleSchemeFactory();
 
-    public int filter; // required
+    public int rrHandler; // required
     public int bid; // required
     public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response; // required
-    public @org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      FILTER((short)1, "filter"),
+      RR_HANDLER((short)1, "rrHandler"),
       BID((short)2, "bid"),
-      REQUEST((short)3, "request"),
-      RESPONSE((short)4, "response"),
-      COOKIE((short)5, "cookie");
+      REQUEST((short)3, "request");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -33633,16 +36227,12 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // FILTER
-            return FILTER;
+          case 1: // RR_HANDLER
+            return RR_HANDLER;
           case 2: // BID
             return BID;
           case 3: // REQUEST
             return REQUEST;
-          case 4: // RESPONSE
-            return RESPONSE;
-          case 5: // COOKIE
-            return COOKIE;
           default:
             return null;
         }
@@ -33686,110 +36276,92 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __FILTER_ISSET_ID = 0;
+    private static final int __RRHANDLER_ISSET_ID = 0;
     private static final int __BID_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.FILTER, new org.apache.thrift.meta_data.FieldMetaData("filter", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
-      tmpMap.put(_Fields.RESPONSE, new org.apache.thrift.meta_data.FieldMetaData("response", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
-      tmpMap.put(_Fields.COOKIE, new org.apache.thrift.meta_data.FieldMetaData("cookie", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
-              new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING))));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSaveCookie_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_OnBeforeResourceLoad_args.class, metaDataMap);
     }
 
-    public CookieAccessFilter_CanSaveCookie_args() {
+    public ResourceRequestHandler_OnBeforeResourceLoad_args() {
     }
 
-    public CookieAccessFilter_CanSaveCookie_args(
-      int filter,
+    public ResourceRequestHandler_OnBeforeResourceLoad_args(
+      int rrHandler,
       int bid,
-      com.jetbrains.cef.remote.thrift_codegen.RObject request,
-      com.jetbrains.cef.remote.thrift_codegen.RObject response,
-      java.util.List<java.lang.String> cookie)
+      com.jetbrains.cef.remote.thrift_codegen.RObject request)
     {
       this();
-      this.filter = filter;
-      setFilterIsSet(true);
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
       this.bid = bid;
       setBidIsSet(true);
       this.request = request;
-      this.response = response;
-      this.cookie = cookie;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public CookieAccessFilter_CanSaveCookie_args(CookieAccessFilter_CanSaveCookie_args other) {
+    public ResourceRequestHandler_OnBeforeResourceLoad_args(ResourceRequestHandler_OnBeforeResourceLoad_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.filter = other.filter;
+      this.rrHandler = other.rrHandler;
       this.bid = other.bid;
       if (other.isSetRequest()) {
         this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
       }
-      if (other.isSetResponse()) {
-        this.response = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.response);
-      }
-      if (other.isSetCookie()) {
-        java.util.List<java.lang.String> __this__cookie = new java.util.ArrayList<java.lang.String>(other.cookie);
-        this.cookie = __this__cookie;
-      }
     }
 
     @Override
-    public CookieAccessFilter_CanSaveCookie_args deepCopy() {
-      return new CookieAccessFilter_CanSaveCookie_args(this);
+    public ResourceRequestHandler_OnBeforeResourceLoad_args deepCopy() {
+      return new ResourceRequestHandler_OnBeforeResourceLoad_args(this);
     }
 
     @Override
     public void clear() {
-      setFilterIsSet(false);
-      this.filter = 0;
+      setRrHandlerIsSet(false);
+      this.rrHandler = 0;
       setBidIsSet(false);
       this.bid = 0;
       this.request = null;
-      this.response = null;
-      this.cookie = null;
     }
 
-    public int getFilter() {
-      return this.filter;
+    public int getRrHandler() {
+      return this.rrHandler;
     }
 
-    public CookieAccessFilter_CanSaveCookie_args setFilter(int filter) {
-      this.filter = filter;
-      setFilterIsSet(true);
+    public ResourceRequestHandler_OnBeforeResourceLoad_args setRrHandler(int rrHandler) {
+      this.rrHandler = rrHandler;
+      setRrHandlerIsSet(true);
       return this;
     }
 
-    public void unsetFilter() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FILTER_ISSET_ID);
+    public void unsetRrHandler() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
     }
 
-    /** Returns true if field filter is set (has been assigned a value) and false otherwise */
-    public boolean isSetFilter() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FILTER_ISSET_ID);
+    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
+    public boolean isSetRrHandler() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
     }
 
-    public void setFilterIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FILTER_ISSET_ID, value);
+    public void setRrHandlerIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public CookieAccessFilter_CanSaveCookie_args setBid(int bid) {
+    public ResourceRequestHandler_OnBeforeResourceLoad_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -33813,7 +36385,7 @@ public class ClientHandlers {
       return this.request;
     }
 
-    public CookieAccessFilter_CanSaveCookie_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+    public ResourceRequestHandler_OnBeforeResourceLoad_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
       this.request = request;
       return this;
     }
@@ -33833,80 +36405,14 @@ public class ClientHandlers {
       }
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getResponse() {
-      return this.response;
-    }
-
-    public CookieAccessFilter_CanSaveCookie_args setResponse(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response) {
-      this.response = response;
-      return this;
-    }
-
-    public void unsetResponse() {
-      this.response = null;
-    }
-
-    /** Returns true if field response is set (has been assigned a value) and false otherwise */
-    public boolean isSetResponse() {
-      return this.response != null;
-    }
-
-    public void setResponseIsSet(boolean value) {
-      if (!value) {
-        this.response = null;
-      }
-    }
-
-    public int getCookieSize() {
-      return (this.cookie == null) ? 0 : this.cookie.size();
-    }
-
-    @org.apache.thrift.annotation.Nullable
-    public java.util.Iterator<java.lang.String> getCookieIterator() {
-      return (this.cookie == null) ? null : this.cookie.iterator();
-    }
-
-    public void addToCookie(java.lang.String elem) {
-      if (this.cookie == null) {
-        this.cookie = new java.util.ArrayList<java.lang.String>();
-      }
-      this.cookie.add(elem);
-    }
-
-    @org.apache.thrift.annotation.Nullable
-    public java.util.List<java.lang.String> getCookie() {
-      return this.cookie;
-    }
-
-    public CookieAccessFilter_CanSaveCookie_args setCookie(@org.apache.thrift.annotation.Nullable java.util.List<java.lang.String> cookie) {
-      this.cookie = cookie;
-      return this;
-    }
-
-    public void unsetCookie() {
-      this.cookie = null;
-    }
-
-    /** Returns true if field cookie is set (has been assigned a value) and false otherwise */
-    public boolean isSetCookie() {
-      return this.cookie != null;
-    }
-
-    public void setCookieIsSet(boolean value) {
-      if (!value) {
-        this.cookie = null;
-      }
-    }
-
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case FILTER:
+      case RR_HANDLER:
         if (value == null) {
-          unsetFilter();
+          unsetRrHandler();
         } else {
-          setFilter((java.lang.Integer)value);
+          setRrHandler((java.lang.Integer)value);
         }
         break;
 
@@ -33926,22 +36432,6 @@ public class ClientHandlers {
         }
         break;
 
-      case RESPONSE:
-        if (value == null) {
-          unsetResponse();
-        } else {
-          setResponse((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
-        }
-        break;
-
-      case COOKIE:
-        if (value == null) {
-          unsetCookie();
-        } else {
-          setCookie((java.util.List<java.lang.String>)value);
-        }
-        break;
-
       }
     }
 
@@ -33949,8 +36439,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case FILTER:
-        return getFilter();
+      case RR_HANDLER:
+        return getRrHandler();
 
       case BID:
         return getBid();
@@ -33958,12 +36448,6 @@ public class ClientHandlers {
       case REQUEST:
         return getRequest();
 
-      case RESPONSE:
-        return getResponse();
-
-      case COOKIE:
-        return getCookie();
-
       }
       throw new java.lang.IllegalStateException();
     }
@@ -33976,39 +36460,35 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case FILTER:
-        return isSetFilter();
+      case RR_HANDLER:
+        return isSetRrHandler();
       case BID:
         return isSetBid();
       case REQUEST:
         return isSetRequest();
-      case RESPONSE:
-        return isSetResponse();
-      case COOKIE:
-        return isSetCookie();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof CookieAccessFilter_CanSaveCookie_args)
-        return this.equals((CookieAccessFilter_CanSaveCookie_args)that);
+      if (that instanceof ResourceRequestHandler_OnBeforeResourceLoad_args)
+        return this.equals((ResourceRequestHandler_OnBeforeResourceLoad_args)that);
       return false;
     }
 
-    public boolean equals(CookieAccessFilter_CanSaveCookie_args that) {
+    public boolean equals(ResourceRequestHandler_OnBeforeResourceLoad_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_filter = true;
-      boolean that_present_filter = true;
-      if (this_present_filter || that_present_filter) {
-        if (!(this_present_filter && that_present_filter))
+      boolean this_present_rrHandler = true;
+      boolean that_present_rrHandler = true;
+      if (this_present_rrHandler || that_present_rrHandler) {
+        if (!(this_present_rrHandler && that_present_rrHandler))
           return false;
-        if (this.filter != that.filter)
+        if (this.rrHandler != that.rrHandler)
           return false;
       }
 
@@ -34030,24 +36510,6 @@ public class ClientHandlers {
           return false;
       }
 
-      boolean this_present_response = true && this.isSetResponse();
-      boolean that_present_response = true && that.isSetResponse();
-      if (this_present_response || that_present_response) {
-        if (!(this_present_response && that_present_response))
-          return false;
-        if (!this.response.equals(that.response))
-          return false;
-      }
-
-      boolean this_present_cookie = true && this.isSetCookie();
-      boolean that_present_cookie = true && that.isSetCookie();
-      if (this_present_cookie || that_present_cookie) {
-        if (!(this_present_cookie && that_present_cookie))
-          return false;
-        if (!this.cookie.equals(that.cookie))
-          return false;
-      }
-
       return true;
     }
 
@@ -34055,7 +36517,7 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + filter;
+      hashCode = hashCode * 8191 + rrHandler;
 
       hashCode = hashCode * 8191 + bid;
 
@@ -34063,31 +36525,23 @@ public class ClientHandlers {
       if (isSetRequest())
         hashCode = hashCode * 8191 + request.hashCode();
 
-      hashCode = hashCode * 8191 + ((isSetResponse()) ? 131071 : 524287);
-      if (isSetResponse())
-        hashCode = hashCode * 8191 + response.hashCode();
-
-      hashCode = hashCode * 8191 + ((isSetCookie()) ? 131071 : 524287);
-      if (isSetCookie())
-        hashCode = hashCode * 8191 + cookie.hashCode();
-
       return hashCode;
     }
 
     @Override
-    public int compareTo(CookieAccessFilter_CanSaveCookie_args other) {
+    public int compareTo(ResourceRequestHandler_OnBeforeResourceLoad_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetFilter(), other.isSetFilter());
+      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetFilter()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.filter, other.filter);
+      if (isSetRrHandler()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -34112,26 +36566,6 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetResponse(), other.isSetResponse());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetResponse()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.response, other.response);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetCookie(), other.isSetCookie());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetCookie()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.cookie, other.cookie);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       return 0;
     }
 
@@ -34153,11 +36587,11 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSaveCookie_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_OnBeforeResourceLoad_args(");
       boolean first = true;
 
-      sb.append("filter:");
-      sb.append(this.filter);
+      sb.append("rrHandler:");
+      sb.append(this.rrHandler);
       first = false;
       if (!first) sb.append(", ");
       sb.append("bid:");
@@ -34171,22 +36605,6 @@ public class ClientHandlers {
         sb.append(this.request);
       }
       first = false;
-      if (!first) sb.append(", ");
-      sb.append("response:");
-      if (this.response == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.response);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("cookie:");
-      if (this.cookie == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.cookie);
-      }
-      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -34197,9 +36615,6 @@ public class ClientHandlers {
       if (request != null) {
         request.validate();
       }
-      if (response != null) {
-        response.validate();
-      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -34220,17 +36635,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSaveCookie_argsStandardScheme getScheme() {
-        return new CookieAccessFilter_CanSaveCookie_argsStandardScheme();
+      public ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme getScheme() {
+        return new ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSaveCookie_args> {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_OnBeforeResourceLoad_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -34240,10 +36655,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // FILTER
+            case 1: // RR_HANDLER
               if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.filter = iprot.readI32();
-                struct.setFilterIsSet(true);
+                struct.rrHandler = iprot.readI32();
+                struct.setRrHandlerIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -34265,33 +36680,6 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 4: // RESPONSE
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.response.read(iprot);
-                struct.setResponseIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 5: // COOKIE
-              if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
-                {
-                  org.apache.thrift.protocol.TList _list8 = iprot.readListBegin();
-                  struct.cookie = new java.util.ArrayList<java.lang.String>(_list8.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _elem9;
-                  for (int _i10 = 0; _i10 < _list8.size; ++_i10)
-                  {
-                    _elem9 = iprot.readString();
-                    struct.cookie.add(_elem9);
-                  }
-                  iprot.readListEnd();
-                }
-                struct.setCookieIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -34304,12 +36692,12 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(FILTER_FIELD_DESC);
-        oprot.writeI32(struct.filter);
+        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
+        oprot.writeI32(struct.rrHandler);
         oprot.writeFieldEnd();
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
@@ -34319,43 +36707,26 @@ public class ClientHandlers {
           struct.request.write(oprot);
           oprot.writeFieldEnd();
         }
-        if (struct.response != null) {
-          oprot.writeFieldBegin(RESPONSE_FIELD_DESC);
-          struct.response.write(oprot);
-          oprot.writeFieldEnd();
-        }
-        if (struct.cookie != null) {
-          oprot.writeFieldBegin(COOKIE_FIELD_DESC);
-          {
-            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, struct.cookie.size()));
-            for (java.lang.String _iter11 : struct.cookie)
-            {
-              oprot.writeString(_iter11);
-            }
-            oprot.writeListEnd();
-          }
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSaveCookie_argsTupleScheme getScheme() {
-        return new CookieAccessFilter_CanSaveCookie_argsTupleScheme();
+      public ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme getScheme() {
+        return new ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSaveCookie_args> {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_OnBeforeResourceLoad_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetFilter()) {
+        if (struct.isSetRrHandler()) {
           optionals.set(0);
         }
         if (struct.isSetBid()) {
@@ -34364,15 +36735,9 @@ public class ClientHandlers {
         if (struct.isSetRequest()) {
           optionals.set(2);
         }
-        if (struct.isSetResponse()) {
-          optionals.set(3);
-        }
-        if (struct.isSetCookie()) {
-          optionals.set(4);
-        }
-        oprot.writeBitSet(optionals, 5);
-        if (struct.isSetFilter()) {
-          oprot.writeI32(struct.filter);
+        oprot.writeBitSet(optionals, 3);
+        if (struct.isSetRrHandler()) {
+          oprot.writeI32(struct.rrHandler);
         }
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
@@ -34380,27 +36745,15 @@ public class ClientHandlers {
         if (struct.isSetRequest()) {
           struct.request.write(oprot);
         }
-        if (struct.isSetResponse()) {
-          struct.response.write(oprot);
-        }
-        if (struct.isSetCookie()) {
-          {
-            oprot.writeI32(struct.cookie.size());
-            for (java.lang.String _iter12 : struct.cookie)
-            {
-              oprot.writeString(_iter12);
-            }
-          }
-        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(5);
+        java.util.BitSet incoming = iprot.readBitSet(3);
         if (incoming.get(0)) {
-          struct.filter = iprot.readI32();
-          struct.setFilterIsSet(true);
+          struct.rrHandler = iprot.readI32();
+          struct.setRrHandlerIsSet(true);
         }
         if (incoming.get(1)) {
           struct.bid = iprot.readI32();
@@ -34411,24 +36764,6 @@ public class ClientHandlers {
           struct.request.read(iprot);
           struct.setRequestIsSet(true);
         }
-        if (incoming.get(3)) {
-          struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.response.read(iprot);
-          struct.setResponseIsSet(true);
-        }
-        if (incoming.get(4)) {
-          {
-            org.apache.thrift.protocol.TList _list13 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRING);
-            struct.cookie = new java.util.ArrayList<java.lang.String>(_list13.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _elem14;
-            for (int _i15 = 0; _i15 < _list13.size; ++_i15)
-            {
-              _elem14 = iprot.readString();
-              struct.cookie.add(_elem14);
-            }
-          }
-          struct.setCookieIsSet(true);
-        }
       }
     }
 
@@ -34438,13 +36773,13 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class CookieAccessFilter_CanSaveCookie_result implements org.apache.thrift.TBase<CookieAccessFilter_CanSaveCookie_result, CookieAccessFilter_CanSaveCookie_result._Fields>, java.io.Serializable, Cloneable, Comparable<CookieAccessFilter_CanSaveCookie_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("CookieAccessFilter_CanSaveCookie_result");
+  public static class ResourceRequestHandler_OnBeforeResourceLoad_result implements org.apache.thrift.TBase<ResourceRequestHandler_OnBeforeResourceLoad_result, ResourceRequestHandler_OnBeforeResourceLoad_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_OnBeforeResourceLoad_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_OnBeforeResourceLoad_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new CookieAccessFilter_CanSaveCookie_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_resultTupleSchemeFactory();
 
     public boolean success; // required
 
@@ -34519,13 +36854,13 @@ public class ClientHandlers {
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(CookieAccessFilter_CanSaveCookie_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_OnBeforeResourceLoad_result.class, metaDataMap);
     }
 
-    public CookieAccessFilter_CanSaveCookie_result() {
+    public ResourceRequestHandler_OnBeforeResourceLoad_result() {
     }
 
-    public CookieAccessFilter_CanSaveCookie_result(
+    public ResourceRequestHandler_OnBeforeResourceLoad_result(
       boolean success)
     {
       this();
@@ -34536,14 +36871,14 @@ public class ClientHandlers {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public CookieAccessFilter_CanSaveCookie_result(CookieAccessFilter_CanSaveCookie_result other) {
+    public ResourceRequestHandler_OnBeforeResourceLoad_result(ResourceRequestHandler_OnBeforeResourceLoad_result other) {
       __isset_bitfield = other.__isset_bitfield;
       this.success = other.success;
     }
 
     @Override
-    public CookieAccessFilter_CanSaveCookie_result deepCopy() {
-      return new CookieAccessFilter_CanSaveCookie_result(this);
+    public ResourceRequestHandler_OnBeforeResourceLoad_result deepCopy() {
+      return new ResourceRequestHandler_OnBeforeResourceLoad_result(this);
     }
 
     @Override
@@ -34556,7 +36891,7 @@ public class ClientHandlers {
       return this.success;
     }
 
-    public CookieAccessFilter_CanSaveCookie_result setSuccess(boolean success) {
+    public ResourceRequestHandler_OnBeforeResourceLoad_result setSuccess(boolean success) {
       this.success = success;
       setSuccessIsSet(true);
       return this;
@@ -34616,12 +36951,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof CookieAccessFilter_CanSaveCookie_result)
-        return this.equals((CookieAccessFilter_CanSaveCookie_result)that);
+      if (that instanceof ResourceRequestHandler_OnBeforeResourceLoad_result)
+        return this.equals((ResourceRequestHandler_OnBeforeResourceLoad_result)that);
       return false;
     }
 
-    public boolean equals(CookieAccessFilter_CanSaveCookie_result that) {
+    public boolean equals(ResourceRequestHandler_OnBeforeResourceLoad_result that) {
       if (that == null)
         return false;
       if (this == that)
@@ -34649,7 +36984,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(CookieAccessFilter_CanSaveCookie_result other) {
+    public int compareTo(ResourceRequestHandler_OnBeforeResourceLoad_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -34686,7 +37021,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("CookieAccessFilter_CanSaveCookie_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_OnBeforeResourceLoad_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -34719,17 +37054,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSaveCookie_resultStandardScheme getScheme() {
-        return new CookieAccessFilter_CanSaveCookie_resultStandardScheme();
+      public ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme getScheme() {
+        return new ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<CookieAccessFilter_CanSaveCookie_result> {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_OnBeforeResourceLoad_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -34759,7 +37094,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -34774,17 +37109,17 @@ public class ClientHandlers {
 
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public CookieAccessFilter_CanSaveCookie_resultTupleScheme getScheme() {
-        return new CookieAccessFilter_CanSaveCookie_resultTupleScheme();
+      public ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme getScheme() {
+        return new ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme();
       }
     }
 
-    private static class CookieAccessFilter_CanSaveCookie_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<CookieAccessFilter_CanSaveCookie_result> {
+    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_OnBeforeResourceLoad_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -34797,7 +37132,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, CookieAccessFilter_CanSaveCookie_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -34813,15 +37148,15 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_OnBeforeResourceLoad_args implements org.apache.thrift.TBase<ResourceRequestHandler_OnBeforeResourceLoad_args, ResourceRequestHandler_OnBeforeResourceLoad_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_OnBeforeResourceLoad_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_OnBeforeResourceLoad_args");
+  public static class ResourceRequestHandler_GetResourceHandler_args implements org.apache.thrift.TBase<ResourceRequestHandler_GetResourceHandler_args, ResourceRequestHandler_GetResourceHandler_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetResourceHandler_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetResourceHandler_args");
 
     private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
     private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_argsTupleSchemeFactory();
 
     public int rrHandler; // required
     public int bid; // required
@@ -34909,13 +37244,13 @@ public class ClientHandlers {
       tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_OnBeforeResourceLoad_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetResourceHandler_args.class, metaDataMap);
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_args() {
+    public ResourceRequestHandler_GetResourceHandler_args() {
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_args(
+    public ResourceRequestHandler_GetResourceHandler_args(
       int rrHandler,
       int bid,
       com.jetbrains.cef.remote.thrift_codegen.RObject request)
@@ -34931,7 +37266,7 @@ public class ClientHandlers {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceRequestHandler_OnBeforeResourceLoad_args(ResourceRequestHandler_OnBeforeResourceLoad_args other) {
+    public ResourceRequestHandler_GetResourceHandler_args(ResourceRequestHandler_GetResourceHandler_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.rrHandler = other.rrHandler;
       this.bid = other.bid;
@@ -34941,8 +37276,8 @@ public class ClientHandlers {
     }
 
     @Override
-    public ResourceRequestHandler_OnBeforeResourceLoad_args deepCopy() {
-      return new ResourceRequestHandler_OnBeforeResourceLoad_args(this);
+    public ResourceRequestHandler_GetResourceHandler_args deepCopy() {
+      return new ResourceRequestHandler_GetResourceHandler_args(this);
     }
 
     @Override
@@ -34958,7 +37293,7 @@ public class ClientHandlers {
       return this.rrHandler;
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_args setRrHandler(int rrHandler) {
+    public ResourceRequestHandler_GetResourceHandler_args setRrHandler(int rrHandler) {
       this.rrHandler = rrHandler;
       setRrHandlerIsSet(true);
       return this;
@@ -34981,7 +37316,7 @@ public class ClientHandlers {
       return this.bid;
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_args setBid(int bid) {
+    public ResourceRequestHandler_GetResourceHandler_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -35005,7 +37340,7 @@ public class ClientHandlers {
       return this.request;
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+    public ResourceRequestHandler_GetResourceHandler_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
       this.request = request;
       return this;
     }
@@ -35092,12 +37427,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_OnBeforeResourceLoad_args)
-        return this.equals((ResourceRequestHandler_OnBeforeResourceLoad_args)that);
+      if (that instanceof ResourceRequestHandler_GetResourceHandler_args)
+        return this.equals((ResourceRequestHandler_GetResourceHandler_args)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_OnBeforeResourceLoad_args that) {
+    public boolean equals(ResourceRequestHandler_GetResourceHandler_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -35149,7 +37484,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_OnBeforeResourceLoad_args other) {
+    public int compareTo(ResourceRequestHandler_GetResourceHandler_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -35207,7 +37542,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_OnBeforeResourceLoad_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetResourceHandler_args(");
       boolean first = true;
 
       sb.append("rrHandler:");
@@ -35255,17 +37590,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetResourceHandler_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme getScheme() {
-        return new ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme();
+      public ResourceRequestHandler_GetResourceHandler_argsStandardScheme getScheme() {
+        return new ResourceRequestHandler_GetResourceHandler_argsStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_OnBeforeResourceLoad_args> {
+    private static class ResourceRequestHandler_GetResourceHandler_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetResourceHandler_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -35312,7 +37647,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -35333,17 +37668,17 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetResourceHandler_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme getScheme() {
-        return new ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme();
+      public ResourceRequestHandler_GetResourceHandler_argsTupleScheme getScheme() {
+        return new ResourceRequestHandler_GetResourceHandler_argsTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_OnBeforeResourceLoad_args> {
+    private static class ResourceRequestHandler_GetResourceHandler_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetResourceHandler_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetRrHandler()) {
@@ -35368,7 +37703,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(3);
         if (incoming.get(0)) {
@@ -35393,15 +37728,15 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_OnBeforeResourceLoad_result implements org.apache.thrift.TBase<ResourceRequestHandler_OnBeforeResourceLoad_result, ResourceRequestHandler_OnBeforeResourceLoad_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_OnBeforeResourceLoad_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_OnBeforeResourceLoad_result");
+  public static class ResourceRequestHandler_GetResourceHandler_result implements org.apache.thrift.TBase<ResourceRequestHandler_GetResourceHandler_result, ResourceRequestHandler_GetResourceHandler_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetResourceHandler_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetResourceHandler_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_OnBeforeResourceLoad_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_resultTupleSchemeFactory();
 
-    public boolean success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -35466,68 +37801,67 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_OnBeforeResourceLoad_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetResourceHandler_result.class, metaDataMap);
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_result() {
+    public ResourceRequestHandler_GetResourceHandler_result() {
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_result(
-      boolean success)
+    public ResourceRequestHandler_GetResourceHandler_result(
+      com.jetbrains.cef.remote.thrift_codegen.RObject success)
     {
       this();
       this.success = success;
-      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceRequestHandler_OnBeforeResourceLoad_result(ResourceRequestHandler_OnBeforeResourceLoad_result other) {
-      __isset_bitfield = other.__isset_bitfield;
-      this.success = other.success;
+    public ResourceRequestHandler_GetResourceHandler_result(ResourceRequestHandler_GetResourceHandler_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
+      }
     }
 
     @Override
-    public ResourceRequestHandler_OnBeforeResourceLoad_result deepCopy() {
-      return new ResourceRequestHandler_OnBeforeResourceLoad_result(this);
+    public ResourceRequestHandler_GetResourceHandler_result deepCopy() {
+      return new ResourceRequestHandler_GetResourceHandler_result(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = false;
+      this.success = null;
     }
 
-    public boolean isSuccess() {
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
       return this.success;
     }
 
-    public ResourceRequestHandler_OnBeforeResourceLoad_result setSuccess(boolean success) {
+    public ResourceRequestHandler_GetResourceHandler_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
       this.success = success;
-      setSuccessIsSet(true);
       return this;
     }
 
     public void unsetSuccess() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+      this.success = null;
     }
 
     /** Returns true if field success is set (has been assigned a value) and false otherwise */
     public boolean isSetSuccess() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+      return this.success != null;
     }
 
     public void setSuccessIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
+      if (!value) {
+        this.success = null;
+      }
     }
 
     @Override
@@ -35537,7 +37871,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((java.lang.Boolean)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -35549,7 +37883,7 @@ public class ClientHandlers {
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
       case SUCCESS:
-        return isSuccess();
+        return getSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -35571,23 +37905,23 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_OnBeforeResourceLoad_result)
-        return this.equals((ResourceRequestHandler_OnBeforeResourceLoad_result)that);
+      if (that instanceof ResourceRequestHandler_GetResourceHandler_result)
+        return this.equals((ResourceRequestHandler_GetResourceHandler_result)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_OnBeforeResourceLoad_result that) {
+    public boolean equals(ResourceRequestHandler_GetResourceHandler_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (this.success != that.success)
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -35598,13 +37932,15 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_OnBeforeResourceLoad_result other) {
+    public int compareTo(ResourceRequestHandler_GetResourceHandler_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -35641,11 +37977,15 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_OnBeforeResourceLoad_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetResourceHandler_result(");
       boolean first = true;
 
       sb.append("success:");
-      sb.append(this.success);
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -35654,6 +37994,9 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
+      if (success != null) {
+        success.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -35666,25 +38009,23 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetResourceHandler_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme getScheme() {
-        return new ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme();
+      public ResourceRequestHandler_GetResourceHandler_resultStandardScheme getScheme() {
+        return new ResourceRequestHandler_GetResourceHandler_resultStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_OnBeforeResourceLoad_result> {
+    private static class ResourceRequestHandler_GetResourceHandler_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetResourceHandler_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -35695,8 +38036,9 @@ public class ClientHandlers {
           }
           switch (schemeField.id) {
             case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
-                struct.success = iprot.readBool();
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
@@ -35714,13 +38056,13 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.isSetSuccess()) {
+        if (struct.success != null) {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeBool(struct.success);
+          struct.success.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -35729,17 +38071,17 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceRequestHandler_GetResourceHandler_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme getScheme() {
-        return new ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme();
+      public ResourceRequestHandler_GetResourceHandler_resultTupleScheme getScheme() {
+        return new ResourceRequestHandler_GetResourceHandler_resultTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_OnBeforeResourceLoad_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_OnBeforeResourceLoad_result> {
+    private static class ResourceRequestHandler_GetResourceHandler_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetResourceHandler_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -35747,16 +38089,17 @@ public class ClientHandlers {
         }
         oprot.writeBitSet(optionals, 1);
         if (struct.isSetSuccess()) {
-          oprot.writeBool(struct.success);
+          struct.success.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_OnBeforeResourceLoad_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = iprot.readBool();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
       }
@@ -35768,25 +38111,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_GetResourceHandler_args implements org.apache.thrift.TBase<ResourceRequestHandler_GetResourceHandler_args, ResourceRequestHandler_GetResourceHandler_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetResourceHandler_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetResourceHandler_args");
+  public static class ResourceHandler_Dispose_args implements org.apache.thrift.TBase<ResourceHandler_Dispose_args, ResourceHandler_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_Dispose_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_Dispose_args");
 
-    private static final org.apache.thrift.protocol.TField RR_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("rrHandler", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)2);
-    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_Dispose_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_Dispose_argsTupleSchemeFactory();
 
-    public int rrHandler; // required
-    public int bid; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+    public int resourceHandler; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      RR_HANDLER((short)1, "rrHandler"),
-      BID((short)2, "bid"),
-      REQUEST((short)3, "request");
+      RESOURCE_HANDLER((short)1, "resourceHandler");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -35802,12 +38139,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // RR_HANDLER
-            return RR_HANDLER;
-          case 2: // BID
-            return BID;
-          case 3: // REQUEST
-            return REQUEST;
+          case 1: // RESOURCE_HANDLER
+            return RESOURCE_HANDLER;
           default:
             return null;
         }
@@ -35851,159 +38184,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __RRHANDLER_ISSET_ID = 0;
-    private static final int __BID_ISSET_ID = 1;
+    private static final int __RESOURCEHANDLER_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.RR_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("rrHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.RESOURCE_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("resourceHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetResourceHandler_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_Dispose_args.class, metaDataMap);
     }
 
-    public ResourceRequestHandler_GetResourceHandler_args() {
+    public ResourceHandler_Dispose_args() {
     }
 
-    public ResourceRequestHandler_GetResourceHandler_args(
-      int rrHandler,
-      int bid,
-      com.jetbrains.cef.remote.thrift_codegen.RObject request)
+    public ResourceHandler_Dispose_args(
+      int resourceHandler)
     {
       this();
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
-      this.bid = bid;
-      setBidIsSet(true);
-      this.request = request;
+      this.resourceHandler = resourceHandler;
+      setResourceHandlerIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceRequestHandler_GetResourceHandler_args(ResourceRequestHandler_GetResourceHandler_args other) {
+    public ResourceHandler_Dispose_args(ResourceHandler_Dispose_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.rrHandler = other.rrHandler;
-      this.bid = other.bid;
-      if (other.isSetRequest()) {
-        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
-      }
+      this.resourceHandler = other.resourceHandler;
     }
 
     @Override
-    public ResourceRequestHandler_GetResourceHandler_args deepCopy() {
-      return new ResourceRequestHandler_GetResourceHandler_args(this);
+    public ResourceHandler_Dispose_args deepCopy() {
+      return new ResourceHandler_Dispose_args(this);
     }
 
     @Override
     public void clear() {
-      setRrHandlerIsSet(false);
-      this.rrHandler = 0;
-      setBidIsSet(false);
-      this.bid = 0;
-      this.request = null;
-    }
-
-    public int getRrHandler() {
-      return this.rrHandler;
-    }
-
-    public ResourceRequestHandler_GetResourceHandler_args setRrHandler(int rrHandler) {
-      this.rrHandler = rrHandler;
-      setRrHandlerIsSet(true);
-      return this;
-    }
-
-    public void unsetRrHandler() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
-    }
-
-    /** Returns true if field rrHandler is set (has been assigned a value) and false otherwise */
-    public boolean isSetRrHandler() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RRHANDLER_ISSET_ID);
-    }
-
-    public void setRrHandlerIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RRHANDLER_ISSET_ID, value);
-    }
-
-    public int getBid() {
-      return this.bid;
-    }
-
-    public ResourceRequestHandler_GetResourceHandler_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
-      return this;
-    }
-
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
-    }
-
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+      setResourceHandlerIsSet(false);
+      this.resourceHandler = 0;
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
-      return this.request;
+    public int getResourceHandler() {
+      return this.resourceHandler;
     }
 
-    public ResourceRequestHandler_GetResourceHandler_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
-      this.request = request;
+    public ResourceHandler_Dispose_args setResourceHandler(int resourceHandler) {
+      this.resourceHandler = resourceHandler;
+      setResourceHandlerIsSet(true);
       return this;
     }
 
-    public void unsetRequest() {
-      this.request = null;
+    public void unsetResourceHandler() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
     }
 
-    /** Returns true if field request is set (has been assigned a value) and false otherwise */
-    public boolean isSetRequest() {
-      return this.request != null;
+    /** Returns true if field resourceHandler is set (has been assigned a value) and false otherwise */
+    public boolean isSetResourceHandler() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
     }
 
-    public void setRequestIsSet(boolean value) {
-      if (!value) {
-        this.request = null;
-      }
+    public void setResourceHandlerIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case RR_HANDLER:
-        if (value == null) {
-          unsetRrHandler();
-        } else {
-          setRrHandler((java.lang.Integer)value);
-        }
-        break;
-
-      case BID:
-        if (value == null) {
-          unsetBid();
-        } else {
-          setBid((java.lang.Integer)value);
-        }
-        break;
-
-      case REQUEST:
+      case RESOURCE_HANDLER:
         if (value == null) {
-          unsetRequest();
+          unsetResourceHandler();
         } else {
-          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setResourceHandler((java.lang.Integer)value);
         }
         break;
 
@@ -36014,14 +38266,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case RR_HANDLER:
-        return getRrHandler();
-
-      case BID:
-        return getBid();
-
-      case REQUEST:
-        return getRequest();
+      case RESOURCE_HANDLER:
+        return getResourceHandler();
 
       }
       throw new java.lang.IllegalStateException();
@@ -36035,53 +38281,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case RR_HANDLER:
-        return isSetRrHandler();
-      case BID:
-        return isSetBid();
-      case REQUEST:
-        return isSetRequest();
+      case RESOURCE_HANDLER:
+        return isSetResourceHandler();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_GetResourceHandler_args)
-        return this.equals((ResourceRequestHandler_GetResourceHandler_args)that);
+      if (that instanceof ResourceHandler_Dispose_args)
+        return this.equals((ResourceHandler_Dispose_args)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_GetResourceHandler_args that) {
+    public boolean equals(ResourceHandler_Dispose_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_rrHandler = true;
-      boolean that_present_rrHandler = true;
-      if (this_present_rrHandler || that_present_rrHandler) {
-        if (!(this_present_rrHandler && that_present_rrHandler))
-          return false;
-        if (this.rrHandler != that.rrHandler)
-          return false;
-      }
-
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
-          return false;
-        if (this.bid != that.bid)
-          return false;
-      }
-
-      boolean this_present_request = true && this.isSetRequest();
-      boolean that_present_request = true && that.isSetRequest();
-      if (this_present_request || that_present_request) {
-        if (!(this_present_request && that_present_request))
+      boolean this_present_resourceHandler = true;
+      boolean that_present_resourceHandler = true;
+      if (this_present_resourceHandler || that_present_resourceHandler) {
+        if (!(this_present_resourceHandler && that_present_resourceHandler))
           return false;
-        if (!this.request.equals(that.request))
+        if (this.resourceHandler != that.resourceHandler)
           return false;
       }
 
@@ -36092,51 +38316,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + rrHandler;
-
-      hashCode = hashCode * 8191 + bid;
-
-      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
-      if (isSetRequest())
-        hashCode = hashCode * 8191 + request.hashCode();
+      hashCode = hashCode * 8191 + resourceHandler;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_GetResourceHandler_args other) {
+    public int compareTo(ResourceHandler_Dispose_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetRrHandler(), other.isSetRrHandler());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetRrHandler()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rrHandler, other.rrHandler);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
+      lastComparison = java.lang.Boolean.compare(isSetResourceHandler(), other.isSetResourceHandler());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetRequest()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
+      if (isSetResourceHandler()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.resourceHandler, other.resourceHandler);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -36162,23 +38360,11 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetResourceHandler_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_Dispose_args(");
       boolean first = true;
 
-      sb.append("rrHandler:");
-      sb.append(this.rrHandler);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("bid:");
-      sb.append(this.bid);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("request:");
-      if (this.request == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.request);
-      }
+      sb.append("resourceHandler:");
+      sb.append(this.resourceHandler);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -36187,9 +38373,6 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (request != null) {
-        request.validate();
-      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -36210,17 +38393,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetResourceHandler_argsStandardScheme getScheme() {
-        return new ResourceRequestHandler_GetResourceHandler_argsStandardScheme();
+      public ResourceHandler_Dispose_argsStandardScheme getScheme() {
+        return new ResourceHandler_Dispose_argsStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetResourceHandler_args> {
+    private static class ResourceHandler_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_Dispose_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -36230,27 +38413,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // RR_HANDLER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.rrHandler = iprot.readI32();
-                struct.setRrHandlerIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 2: // BID
+            case 1: // RESOURCE_HANDLER
               if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.bid = iprot.readI32();
-                struct.setBidIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 3: // REQUEST
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.request.read(iprot);
-                struct.setRequestIsSet(true);
+                struct.resourceHandler = iprot.readI32();
+                struct.setResourceHandlerIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -36267,77 +38433,48 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(RR_HANDLER_FIELD_DESC);
-        oprot.writeI32(struct.rrHandler);
-        oprot.writeFieldEnd();
-        oprot.writeFieldBegin(BID_FIELD_DESC);
-        oprot.writeI32(struct.bid);
+        oprot.writeFieldBegin(RESOURCE_HANDLER_FIELD_DESC);
+        oprot.writeI32(struct.resourceHandler);
         oprot.writeFieldEnd();
-        if (struct.request != null) {
-          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
-          struct.request.write(oprot);
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetResourceHandler_argsTupleScheme getScheme() {
-        return new ResourceRequestHandler_GetResourceHandler_argsTupleScheme();
+      public ResourceHandler_Dispose_argsTupleScheme getScheme() {
+        return new ResourceHandler_Dispose_argsTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetResourceHandler_args> {
+    private static class ResourceHandler_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_Dispose_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetRrHandler()) {
+        if (struct.isSetResourceHandler()) {
           optionals.set(0);
         }
-        if (struct.isSetBid()) {
-          optionals.set(1);
-        }
-        if (struct.isSetRequest()) {
-          optionals.set(2);
-        }
-        oprot.writeBitSet(optionals, 3);
-        if (struct.isSetRrHandler()) {
-          oprot.writeI32(struct.rrHandler);
-        }
-        if (struct.isSetBid()) {
-          oprot.writeI32(struct.bid);
-        }
-        if (struct.isSetRequest()) {
-          struct.request.write(oprot);
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetResourceHandler()) {
+          oprot.writeI32(struct.resourceHandler);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(3);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.rrHandler = iprot.readI32();
-          struct.setRrHandlerIsSet(true);
-        }
-        if (incoming.get(1)) {
-          struct.bid = iprot.readI32();
-          struct.setBidIsSet(true);
-        }
-        if (incoming.get(2)) {
-          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.request.read(iprot);
-          struct.setRequestIsSet(true);
+          struct.resourceHandler = iprot.readI32();
+          struct.setResourceHandlerIsSet(true);
         }
       }
     }
@@ -36348,19 +38485,25 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceRequestHandler_GetResourceHandler_result implements org.apache.thrift.TBase<ResourceRequestHandler_GetResourceHandler_result, ResourceRequestHandler_GetResourceHandler_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRequestHandler_GetResourceHandler_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRequestHandler_GetResourceHandler_result");
+  public static class ResourceHandler_ProcessRequest_args implements org.apache.thrift.TBase<ResourceHandler_ProcessRequest_args, ResourceHandler_ProcessRequest_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ProcessRequest_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ProcessRequest_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
+    private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)2);
+    private static final org.apache.thrift.protocol.TField CALLBACK_FIELD_DESC = new org.apache.thrift.protocol.TField("callback", org.apache.thrift.protocol.TType.STRUCT, (short)3);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRequestHandler_GetResourceHandler_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_argsTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success; // required
+    public int resourceHandler; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+      RESOURCE_HANDLER((short)1, "resourceHandler"),
+      REQUEST((short)2, "request"),
+      CALLBACK((short)3, "callback");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -36376,8 +38519,12 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
+          case 1: // RESOURCE_HANDLER
+            return RESOURCE_HANDLER;
+          case 2: // REQUEST
+            return REQUEST;
+          case 3: // CALLBACK
+            return CALLBACK;
           default:
             return null;
         }
@@ -36420,78 +38567,161 @@ public class ClientHandlers {
       }
     }
 
-    // isset id assignments
-    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
-    static {
-      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
-      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRequestHandler_GetResourceHandler_result.class, metaDataMap);
+    // isset id assignments
+    private static final int __RESOURCEHANDLER_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.RESOURCE_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("resourceHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      tmpMap.put(_Fields.CALLBACK, new org.apache.thrift.meta_data.FieldMetaData("callback", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ProcessRequest_args.class, metaDataMap);
+    }
+
+    public ResourceHandler_ProcessRequest_args() {
+    }
+
+    public ResourceHandler_ProcessRequest_args(
+      int resourceHandler,
+      com.jetbrains.cef.remote.thrift_codegen.RObject request,
+      com.jetbrains.cef.remote.thrift_codegen.RObject callback)
+    {
+      this();
+      this.resourceHandler = resourceHandler;
+      setResourceHandlerIsSet(true);
+      this.request = request;
+      this.callback = callback;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public ResourceHandler_ProcessRequest_args(ResourceHandler_ProcessRequest_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.resourceHandler = other.resourceHandler;
+      if (other.isSetRequest()) {
+        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
+      }
+      if (other.isSetCallback()) {
+        this.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.callback);
+      }
+    }
+
+    @Override
+    public ResourceHandler_ProcessRequest_args deepCopy() {
+      return new ResourceHandler_ProcessRequest_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setResourceHandlerIsSet(false);
+      this.resourceHandler = 0;
+      this.request = null;
+      this.callback = null;
+    }
+
+    public int getResourceHandler() {
+      return this.resourceHandler;
+    }
+
+    public ResourceHandler_ProcessRequest_args setResourceHandler(int resourceHandler) {
+      this.resourceHandler = resourceHandler;
+      setResourceHandlerIsSet(true);
+      return this;
+    }
+
+    public void unsetResourceHandler() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
+    }
+
+    /** Returns true if field resourceHandler is set (has been assigned a value) and false otherwise */
+    public boolean isSetResourceHandler() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
     }
 
-    public ResourceRequestHandler_GetResourceHandler_result() {
+    public void setResourceHandlerIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID, value);
     }
 
-    public ResourceRequestHandler_GetResourceHandler_result(
-      com.jetbrains.cef.remote.thrift_codegen.RObject success)
-    {
-      this();
-      this.success = success;
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
+      return this.request;
     }
 
-    /**
-     * Performs a deep copy on <i>other</i>.
-     */
-    public ResourceRequestHandler_GetResourceHandler_result(ResourceRequestHandler_GetResourceHandler_result other) {
-      if (other.isSetSuccess()) {
-        this.success = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.success);
-      }
+    public ResourceHandler_ProcessRequest_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
+      this.request = request;
+      return this;
     }
 
-    @Override
-    public ResourceRequestHandler_GetResourceHandler_result deepCopy() {
-      return new ResourceRequestHandler_GetResourceHandler_result(this);
+    public void unsetRequest() {
+      this.request = null;
     }
 
-    @Override
-    public void clear() {
-      this.success = null;
+    /** Returns true if field request is set (has been assigned a value) and false otherwise */
+    public boolean isSetRequest() {
+      return this.request != null;
+    }
+
+    public void setRequestIsSet(boolean value) {
+      if (!value) {
+        this.request = null;
+      }
     }
 
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getSuccess() {
-      return this.success;
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getCallback() {
+      return this.callback;
     }
 
-    public ResourceRequestHandler_GetResourceHandler_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject success) {
-      this.success = success;
+    public ResourceHandler_ProcessRequest_args setCallback(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback) {
+      this.callback = callback;
       return this;
     }
 
-    public void unsetSuccess() {
-      this.success = null;
+    public void unsetCallback() {
+      this.callback = null;
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return this.success != null;
+    /** Returns true if field callback is set (has been assigned a value) and false otherwise */
+    public boolean isSetCallback() {
+      return this.callback != null;
     }
 
-    public void setSuccessIsSet(boolean value) {
+    public void setCallbackIsSet(boolean value) {
       if (!value) {
-        this.success = null;
+        this.callback = null;
       }
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
+      case RESOURCE_HANDLER:
         if (value == null) {
-          unsetSuccess();
+          unsetResourceHandler();
         } else {
-          setSuccess((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setResourceHandler((java.lang.Integer)value);
+        }
+        break;
+
+      case REQUEST:
+        if (value == null) {
+          unsetRequest();
+        } else {
+          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+        }
+        break;
+
+      case CALLBACK:
+        if (value == null) {
+          unsetCallback();
+        } else {
+          setCallback((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -36502,8 +38732,14 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
+      case RESOURCE_HANDLER:
+        return getResourceHandler();
+
+      case REQUEST:
+        return getRequest();
+
+      case CALLBACK:
+        return getCallback();
 
       }
       throw new java.lang.IllegalStateException();
@@ -36517,31 +38753,53 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
+      case RESOURCE_HANDLER:
+        return isSetResourceHandler();
+      case REQUEST:
+        return isSetRequest();
+      case CALLBACK:
+        return isSetCallback();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceRequestHandler_GetResourceHandler_result)
-        return this.equals((ResourceRequestHandler_GetResourceHandler_result)that);
+      if (that instanceof ResourceHandler_ProcessRequest_args)
+        return this.equals((ResourceHandler_ProcessRequest_args)that);
       return false;
     }
 
-    public boolean equals(ResourceRequestHandler_GetResourceHandler_result that) {
+    public boolean equals(ResourceHandler_ProcessRequest_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true && this.isSetSuccess();
-      boolean that_present_success = true && that.isSetSuccess();
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
+      boolean this_present_resourceHandler = true;
+      boolean that_present_resourceHandler = true;
+      if (this_present_resourceHandler || that_present_resourceHandler) {
+        if (!(this_present_resourceHandler && that_present_resourceHandler))
           return false;
-        if (!this.success.equals(that.success))
+        if (this.resourceHandler != that.resourceHandler)
+          return false;
+      }
+
+      boolean this_present_request = true && this.isSetRequest();
+      boolean that_present_request = true && that.isSetRequest();
+      if (this_present_request || that_present_request) {
+        if (!(this_present_request && that_present_request))
+          return false;
+        if (!this.request.equals(that.request))
+          return false;
+      }
+
+      boolean this_present_callback = true && this.isSetCallback();
+      boolean that_present_callback = true && that.isSetCallback();
+      if (this_present_callback || that_present_callback) {
+        if (!(this_present_callback && that_present_callback))
+          return false;
+        if (!this.callback.equals(that.callback))
           return false;
       }
 
@@ -36552,27 +38810,53 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
-      if (isSetSuccess())
-        hashCode = hashCode * 8191 + success.hashCode();
+      hashCode = hashCode * 8191 + resourceHandler;
+
+      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
+      if (isSetRequest())
+        hashCode = hashCode * 8191 + request.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetCallback()) ? 131071 : 524287);
+      if (isSetCallback())
+        hashCode = hashCode * 8191 + callback.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceRequestHandler_GetResourceHandler_result other) {
+    public int compareTo(ResourceHandler_ProcessRequest_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetResourceHandler(), other.isSetResourceHandler());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetResourceHandler()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.resourceHandler, other.resourceHandler);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetRequest()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetCallback(), other.isSetCallback());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetCallback()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.callback, other.callback);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -36591,20 +38875,33 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRequestHandler_GetResourceHandler_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ProcessRequest_args(");
       boolean first = true;
 
-      sb.append("success:");
-      if (this.success == null) {
+      sb.append("resourceHandler:");
+      sb.append(this.resourceHandler);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("request:");
+      if (this.request == null) {
         sb.append("null");
       } else {
-        sb.append(this.success);
+        sb.append(this.request);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("callback:");
+      if (this.callback == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.callback);
       }
       first = false;
       sb.append(")");
@@ -36614,8 +38911,11 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (success != null) {
-        success.validate();
+      if (request != null) {
+        request.validate();
+      }
+      if (callback != null) {
+        callback.validate();
       }
     }
 
@@ -36629,23 +38929,25 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ProcessRequest_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetResourceHandler_resultStandardScheme getScheme() {
-        return new ResourceRequestHandler_GetResourceHandler_resultStandardScheme();
+      public ResourceHandler_ProcessRequest_argsStandardScheme getScheme() {
+        return new ResourceHandler_ProcessRequest_argsStandardScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRequestHandler_GetResourceHandler_result> {
+    private static class ResourceHandler_ProcessRequest_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ProcessRequest_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -36655,11 +38957,28 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
+            case 1: // RESOURCE_HANDLER
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.resourceHandler = iprot.readI32();
+                struct.setResourceHandlerIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // REQUEST
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.success.read(iprot);
-                struct.setSuccessIsSet(true);
+                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.request.read(iprot);
+                struct.setRequestIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // CALLBACK
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.callback.read(iprot);
+                struct.setCallbackIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -36676,13 +38995,21 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.success != null) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          struct.success.write(oprot);
+        oprot.writeFieldBegin(RESOURCE_HANDLER_FIELD_DESC);
+        oprot.writeI32(struct.resourceHandler);
+        oprot.writeFieldEnd();
+        if (struct.request != null) {
+          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
+          struct.request.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        if (struct.callback != null) {
+          oprot.writeFieldBegin(CALLBACK_FIELD_DESC);
+          struct.callback.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -36691,36 +39018,57 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ProcessRequest_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceRequestHandler_GetResourceHandler_resultTupleScheme getScheme() {
-        return new ResourceRequestHandler_GetResourceHandler_resultTupleScheme();
+      public ResourceHandler_ProcessRequest_argsTupleScheme getScheme() {
+        return new ResourceHandler_ProcessRequest_argsTupleScheme();
       }
     }
 
-    private static class ResourceRequestHandler_GetResourceHandler_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRequestHandler_GetResourceHandler_result> {
+    private static class ResourceHandler_ProcessRequest_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ProcessRequest_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetResourceHandler()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          struct.success.write(oprot);
+        if (struct.isSetRequest()) {
+          optionals.set(1);
+        }
+        if (struct.isSetCallback()) {
+          optionals.set(2);
+        }
+        oprot.writeBitSet(optionals, 3);
+        if (struct.isSetResourceHandler()) {
+          oprot.writeI32(struct.resourceHandler);
+        }
+        if (struct.isSetRequest()) {
+          struct.request.write(oprot);
+        }
+        if (struct.isSetCallback()) {
+          struct.callback.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRequestHandler_GetResourceHandler_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(3);
         if (incoming.get(0)) {
-          struct.success = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.success.read(iprot);
-          struct.setSuccessIsSet(true);
+          struct.resourceHandler = iprot.readI32();
+          struct.setResourceHandlerIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.request.read(iprot);
+          struct.setRequestIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.callback.read(iprot);
+          struct.setCallbackIsSet(true);
         }
       }
     }
@@ -36731,19 +39079,19 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_Dispose_args implements org.apache.thrift.TBase<ResourceHandler_Dispose_args, ResourceHandler_Dispose_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_Dispose_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_Dispose_args");
+  public static class ResourceHandler_ProcessRequest_result implements org.apache.thrift.TBase<ResourceHandler_ProcessRequest_result, ResourceHandler_ProcessRequest_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ProcessRequest_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ProcessRequest_result");
 
-    private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_Dispose_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_Dispose_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_resultTupleSchemeFactory();
 
-    public int resourceHandler; // required
+    public boolean success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      RESOURCE_HANDLER((short)1, "resourceHandler");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -36759,8 +39107,8 @@ public class ClientHandlers {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // RESOURCE_HANDLER
-            return RESOURCE_HANDLER;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -36804,78 +39152,78 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __RESOURCEHANDLER_ISSET_ID = 0;
+    private static final int __SUCCESS_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.RESOURCE_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("resourceHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_Dispose_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ProcessRequest_result.class, metaDataMap);
     }
 
-    public ResourceHandler_Dispose_args() {
+    public ResourceHandler_ProcessRequest_result() {
     }
 
-    public ResourceHandler_Dispose_args(
-      int resourceHandler)
+    public ResourceHandler_ProcessRequest_result(
+      boolean success)
     {
       this();
-      this.resourceHandler = resourceHandler;
-      setResourceHandlerIsSet(true);
+      this.success = success;
+      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_Dispose_args(ResourceHandler_Dispose_args other) {
+    public ResourceHandler_ProcessRequest_result(ResourceHandler_ProcessRequest_result other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.resourceHandler = other.resourceHandler;
+      this.success = other.success;
     }
 
     @Override
-    public ResourceHandler_Dispose_args deepCopy() {
-      return new ResourceHandler_Dispose_args(this);
+    public ResourceHandler_ProcessRequest_result deepCopy() {
+      return new ResourceHandler_ProcessRequest_result(this);
     }
 
     @Override
     public void clear() {
-      setResourceHandlerIsSet(false);
-      this.resourceHandler = 0;
+      setSuccessIsSet(false);
+      this.success = false;
     }
 
-    public int getResourceHandler() {
-      return this.resourceHandler;
+    public boolean isSuccess() {
+      return this.success;
     }
 
-    public ResourceHandler_Dispose_args setResourceHandler(int resourceHandler) {
-      this.resourceHandler = resourceHandler;
-      setResourceHandlerIsSet(true);
+    public ResourceHandler_ProcessRequest_result setSuccess(boolean success) {
+      this.success = success;
+      setSuccessIsSet(true);
       return this;
     }
 
-    public void unsetResourceHandler() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
+    public void unsetSuccess() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    /** Returns true if field resourceHandler is set (has been assigned a value) and false otherwise */
-    public boolean isSetResourceHandler() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    public void setResourceHandlerIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case RESOURCE_HANDLER:
+      case SUCCESS:
         if (value == null) {
-          unsetResourceHandler();
+          unsetSuccess();
         } else {
-          setResourceHandler((java.lang.Integer)value);
+          setSuccess((java.lang.Boolean)value);
         }
         break;
 
@@ -36886,8 +39234,8 @@ public class ClientHandlers {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case RESOURCE_HANDLER:
-        return getResourceHandler();
+      case SUCCESS:
+        return isSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -36901,31 +39249,31 @@ public class ClientHandlers {
       }
 
       switch (field) {
-      case RESOURCE_HANDLER:
-        return isSetResourceHandler();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_Dispose_args)
-        return this.equals((ResourceHandler_Dispose_args)that);
+      if (that instanceof ResourceHandler_ProcessRequest_result)
+        return this.equals((ResourceHandler_ProcessRequest_result)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_Dispose_args that) {
+    public boolean equals(ResourceHandler_ProcessRequest_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_resourceHandler = true;
-      boolean that_present_resourceHandler = true;
-      if (this_present_resourceHandler || that_present_resourceHandler) {
-        if (!(this_present_resourceHandler && that_present_resourceHandler))
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.resourceHandler != that.resourceHandler)
+        if (this.success != that.success)
           return false;
       }
 
@@ -36936,25 +39284,25 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + resourceHandler;
+      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceHandler_Dispose_args other) {
+    public int compareTo(ResourceHandler_ProcessRequest_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetResourceHandler(), other.isSetResourceHandler());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetResourceHandler()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.resourceHandler, other.resourceHandler);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -36973,18 +39321,17 @@ public class ClientHandlers {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_Dispose_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ProcessRequest_result(");
       boolean first = true;
 
-      sb.append("resourceHandler:");
-      sb.append(this.resourceHandler);
+      sb.append("success:");
+      sb.append(this.success);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -37013,17 +39360,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_Dispose_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ProcessRequest_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_Dispose_argsStandardScheme getScheme() {
-        return new ResourceHandler_Dispose_argsStandardScheme();
+      public ResourceHandler_ProcessRequest_resultStandardScheme getScheme() {
+        return new ResourceHandler_ProcessRequest_resultStandardScheme();
       }
     }
 
-    private static class ResourceHandler_Dispose_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_Dispose_args> {
+    private static class ResourceHandler_ProcessRequest_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ProcessRequest_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -37033,10 +39380,10 @@ public class ClientHandlers {
             break;
           }
           switch (schemeField.id) {
-            case 1: // RESOURCE_HANDLER
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.resourceHandler = iprot.readI32();
-                struct.setResourceHandlerIsSet(true);
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+                struct.success = iprot.readBool();
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -37053,48 +39400,50 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(RESOURCE_HANDLER_FIELD_DESC);
-        oprot.writeI32(struct.resourceHandler);
-        oprot.writeFieldEnd();
+        if (struct.isSetSuccess()) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeBool(struct.success);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class ResourceHandler_Dispose_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ProcessRequest_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_Dispose_argsTupleScheme getScheme() {
-        return new ResourceHandler_Dispose_argsTupleScheme();
+      public ResourceHandler_ProcessRequest_resultTupleScheme getScheme() {
+        return new ResourceHandler_ProcessRequest_resultTupleScheme();
       }
     }
 
-    private static class ResourceHandler_Dispose_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_Dispose_args> {
+    private static class ResourceHandler_ProcessRequest_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ProcessRequest_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetResourceHandler()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetResourceHandler()) {
-          oprot.writeI32(struct.resourceHandler);
+        if (struct.isSetSuccess()) {
+          oprot.writeBool(struct.success);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_Dispose_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.resourceHandler = iprot.readI32();
-          struct.setResourceHandlerIsSet(true);
+          struct.success = iprot.readBool();
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -37105,25 +39454,22 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_ProcessRequest_args implements org.apache.thrift.TBase<ResourceHandler_ProcessRequest_args, ResourceHandler_ProcessRequest_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ProcessRequest_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ProcessRequest_args");
+  public static class ResourceHandler_GetResponseHeaders_args implements org.apache.thrift.TBase<ResourceHandler_GetResponseHeaders_args, ResourceHandler_GetResponseHeaders_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_GetResponseHeaders_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_GetResponseHeaders_args");
 
     private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField REQUEST_FIELD_DESC = new org.apache.thrift.protocol.TField("request", org.apache.thrift.protocol.TType.STRUCT, (short)2);
-    private static final org.apache.thrift.protocol.TField CALLBACK_FIELD_DESC = new org.apache.thrift.protocol.TField("callback", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField RESPONSE_FIELD_DESC = new org.apache.thrift.protocol.TField("response", org.apache.thrift.protocol.TType.STRUCT, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_argsTupleSchemeFactory();
 
     public int resourceHandler; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
       RESOURCE_HANDLER((short)1, "resourceHandler"),
-      REQUEST((short)2, "request"),
-      CALLBACK((short)3, "callback");
+      RESPONSE((short)2, "response");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -37141,10 +39487,8 @@ public class ClientHandlers {
         switch(fieldId) {
           case 1: // RESOURCE_HANDLER
             return RESOURCE_HANDLER;
-          case 2: // REQUEST
-            return REQUEST;
-          case 3: // CALLBACK
-            return CALLBACK;
+          case 2: // RESPONSE
+            return RESPONSE;
           default:
             return null;
         }
@@ -37195,61 +39539,53 @@ public class ClientHandlers {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.RESOURCE_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("resourceHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.REQUEST, new org.apache.thrift.meta_data.FieldMetaData("request", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
-      tmpMap.put(_Fields.CALLBACK, new org.apache.thrift.meta_data.FieldMetaData("callback", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.RESPONSE, new org.apache.thrift.meta_data.FieldMetaData("response", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ProcessRequest_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_GetResponseHeaders_args.class, metaDataMap);
     }
 
-    public ResourceHandler_ProcessRequest_args() {
+    public ResourceHandler_GetResponseHeaders_args() {
     }
 
-    public ResourceHandler_ProcessRequest_args(
+    public ResourceHandler_GetResponseHeaders_args(
       int resourceHandler,
-      com.jetbrains.cef.remote.thrift_codegen.RObject request,
-      com.jetbrains.cef.remote.thrift_codegen.RObject callback)
+      com.jetbrains.cef.remote.thrift_codegen.RObject response)
     {
       this();
       this.resourceHandler = resourceHandler;
       setResourceHandlerIsSet(true);
-      this.request = request;
-      this.callback = callback;
+      this.response = response;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_ProcessRequest_args(ResourceHandler_ProcessRequest_args other) {
+    public ResourceHandler_GetResponseHeaders_args(ResourceHandler_GetResponseHeaders_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.resourceHandler = other.resourceHandler;
-      if (other.isSetRequest()) {
-        this.request = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.request);
-      }
-      if (other.isSetCallback()) {
-        this.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.callback);
+      if (other.isSetResponse()) {
+        this.response = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.response);
       }
     }
 
     @Override
-    public ResourceHandler_ProcessRequest_args deepCopy() {
-      return new ResourceHandler_ProcessRequest_args(this);
+    public ResourceHandler_GetResponseHeaders_args deepCopy() {
+      return new ResourceHandler_GetResponseHeaders_args(this);
     }
 
     @Override
     public void clear() {
       setResourceHandlerIsSet(false);
       this.resourceHandler = 0;
-      this.request = null;
-      this.callback = null;
+      this.response = null;
     }
 
     public int getResourceHandler() {
       return this.resourceHandler;
     }
 
-    public ResourceHandler_ProcessRequest_args setResourceHandler(int resourceHandler) {
+    public ResourceHandler_GetResponseHeaders_args setResourceHandler(int resourceHandler) {
       this.resourceHandler = resourceHandler;
       setResourceHandlerIsSet(true);
       return this;
@@ -37269,52 +39605,27 @@ public class ClientHandlers {
     }
 
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getRequest() {
-      return this.request;
-    }
-
-    public ResourceHandler_ProcessRequest_args setRequest(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject request) {
-      this.request = request;
-      return this;
-    }
-
-    public void unsetRequest() {
-      this.request = null;
-    }
-
-    /** Returns true if field request is set (has been assigned a value) and false otherwise */
-    public boolean isSetRequest() {
-      return this.request != null;
-    }
-
-    public void setRequestIsSet(boolean value) {
-      if (!value) {
-        this.request = null;
-      }
-    }
-
-    @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getCallback() {
-      return this.callback;
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getResponse() {
+      return this.response;
     }
 
-    public ResourceHandler_ProcessRequest_args setCallback(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback) {
-      this.callback = callback;
+    public ResourceHandler_GetResponseHeaders_args setResponse(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response) {
+      this.response = response;
       return this;
     }
 
-    public void unsetCallback() {
-      this.callback = null;
+    public void unsetResponse() {
+      this.response = null;
     }
 
-    /** Returns true if field callback is set (has been assigned a value) and false otherwise */
-    public boolean isSetCallback() {
-      return this.callback != null;
+    /** Returns true if field response is set (has been assigned a value) and false otherwise */
+    public boolean isSetResponse() {
+      return this.response != null;
     }
 
-    public void setCallbackIsSet(boolean value) {
+    public void setResponseIsSet(boolean value) {
       if (!value) {
-        this.callback = null;
+        this.response = null;
       }
     }
 
@@ -37329,19 +39640,11 @@ public class ClientHandlers {
         }
         break;
 
-      case REQUEST:
-        if (value == null) {
-          unsetRequest();
-        } else {
-          setRequest((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
-        }
-        break;
-
-      case CALLBACK:
+      case RESPONSE:
         if (value == null) {
-          unsetCallback();
+          unsetResponse();
         } else {
-          setCallback((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setResponse((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -37355,11 +39658,8 @@ public class ClientHandlers {
       case RESOURCE_HANDLER:
         return getResourceHandler();
 
-      case REQUEST:
-        return getRequest();
-
-      case CALLBACK:
-        return getCallback();
+      case RESPONSE:
+        return getResponse();
 
       }
       throw new java.lang.IllegalStateException();
@@ -37375,22 +39675,20 @@ public class ClientHandlers {
       switch (field) {
       case RESOURCE_HANDLER:
         return isSetResourceHandler();
-      case REQUEST:
-        return isSetRequest();
-      case CALLBACK:
-        return isSetCallback();
+      case RESPONSE:
+        return isSetResponse();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_ProcessRequest_args)
-        return this.equals((ResourceHandler_ProcessRequest_args)that);
+      if (that instanceof ResourceHandler_GetResponseHeaders_args)
+        return this.equals((ResourceHandler_GetResponseHeaders_args)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_ProcessRequest_args that) {
+    public boolean equals(ResourceHandler_GetResponseHeaders_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -37405,21 +39703,12 @@ public class ClientHandlers {
           return false;
       }
 
-      boolean this_present_request = true && this.isSetRequest();
-      boolean that_present_request = true && that.isSetRequest();
-      if (this_present_request || that_present_request) {
-        if (!(this_present_request && that_present_request))
-          return false;
-        if (!this.request.equals(that.request))
-          return false;
-      }
-
-      boolean this_present_callback = true && this.isSetCallback();
-      boolean that_present_callback = true && that.isSetCallback();
-      if (this_present_callback || that_present_callback) {
-        if (!(this_present_callback && that_present_callback))
+      boolean this_present_response = true && this.isSetResponse();
+      boolean that_present_response = true && that.isSetResponse();
+      if (this_present_response || that_present_response) {
+        if (!(this_present_response && that_present_response))
           return false;
-        if (!this.callback.equals(that.callback))
+        if (!this.response.equals(that.response))
           return false;
       }
 
@@ -37432,19 +39721,15 @@ public class ClientHandlers {
 
       hashCode = hashCode * 8191 + resourceHandler;
 
-      hashCode = hashCode * 8191 + ((isSetRequest()) ? 131071 : 524287);
-      if (isSetRequest())
-        hashCode = hashCode * 8191 + request.hashCode();
-
-      hashCode = hashCode * 8191 + ((isSetCallback()) ? 131071 : 524287);
-      if (isSetCallback())
-        hashCode = hashCode * 8191 + callback.hashCode();
+      hashCode = hashCode * 8191 + ((isSetResponse()) ? 131071 : 524287);
+      if (isSetResponse())
+        hashCode = hashCode * 8191 + response.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceHandler_ProcessRequest_args other) {
+    public int compareTo(ResourceHandler_GetResponseHeaders_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -37461,22 +39746,12 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetRequest(), other.isSetRequest());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetRequest()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.request, other.request);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetCallback(), other.isSetCallback());
+      lastComparison = java.lang.Boolean.compare(isSetResponse(), other.isSetResponse());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetCallback()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.callback, other.callback);
+      if (isSetResponse()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.response, other.response);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -37502,26 +39777,18 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ProcessRequest_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_GetResponseHeaders_args(");
       boolean first = true;
 
       sb.append("resourceHandler:");
       sb.append(this.resourceHandler);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("request:");
-      if (this.request == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.request);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("callback:");
-      if (this.callback == null) {
+      sb.append("response:");
+      if (this.response == null) {
         sb.append("null");
       } else {
-        sb.append(this.callback);
+        sb.append(this.response);
       }
       first = false;
       sb.append(")");
@@ -37531,11 +39798,8 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (request != null) {
-        request.validate();
-      }
-      if (callback != null) {
-        callback.validate();
+      if (response != null) {
+        response.validate();
       }
     }
 
@@ -37557,17 +39821,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_GetResponseHeaders_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ProcessRequest_argsStandardScheme getScheme() {
-        return new ResourceHandler_ProcessRequest_argsStandardScheme();
+      public ResourceHandler_GetResponseHeaders_argsStandardScheme getScheme() {
+        return new ResourceHandler_GetResponseHeaders_argsStandardScheme();
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ProcessRequest_args> {
+    private static class ResourceHandler_GetResponseHeaders_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_GetResponseHeaders_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -37585,20 +39849,11 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // REQUEST
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.request.read(iprot);
-                struct.setRequestIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 3: // CALLBACK
+            case 2: // RESPONSE
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.callback.read(iprot);
-                struct.setCallbackIsSet(true);
+                struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.response.read(iprot);
+                struct.setResponseIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -37615,21 +39870,16 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(RESOURCE_HANDLER_FIELD_DESC);
         oprot.writeI32(struct.resourceHandler);
         oprot.writeFieldEnd();
-        if (struct.request != null) {
-          oprot.writeFieldBegin(REQUEST_FIELD_DESC);
-          struct.request.write(oprot);
-          oprot.writeFieldEnd();
-        }
-        if (struct.callback != null) {
-          oprot.writeFieldBegin(CALLBACK_FIELD_DESC);
-          struct.callback.write(oprot);
+        if (struct.response != null) {
+          oprot.writeFieldBegin(RESPONSE_FIELD_DESC);
+          struct.response.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -37638,57 +39888,46 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceHandler_ProcessRequest_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_GetResponseHeaders_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ProcessRequest_argsTupleScheme getScheme() {
-        return new ResourceHandler_ProcessRequest_argsTupleScheme();
+      public ResourceHandler_GetResponseHeaders_argsTupleScheme getScheme() {
+        return new ResourceHandler_GetResponseHeaders_argsTupleScheme();
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ProcessRequest_args> {
+    private static class ResourceHandler_GetResponseHeaders_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_GetResponseHeaders_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetResourceHandler()) {
           optionals.set(0);
         }
-        if (struct.isSetRequest()) {
+        if (struct.isSetResponse()) {
           optionals.set(1);
         }
-        if (struct.isSetCallback()) {
-          optionals.set(2);
-        }
-        oprot.writeBitSet(optionals, 3);
+        oprot.writeBitSet(optionals, 2);
         if (struct.isSetResourceHandler()) {
           oprot.writeI32(struct.resourceHandler);
         }
-        if (struct.isSetRequest()) {
-          struct.request.write(oprot);
-        }
-        if (struct.isSetCallback()) {
-          struct.callback.write(oprot);
+        if (struct.isSetResponse()) {
+          struct.response.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(3);
+        java.util.BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           struct.resourceHandler = iprot.readI32();
           struct.setResourceHandlerIsSet(true);
         }
         if (incoming.get(1)) {
-          struct.request = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.request.read(iprot);
-          struct.setRequestIsSet(true);
-        }
-        if (incoming.get(2)) {
-          struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.callback.read(iprot);
-          struct.setCallbackIsSet(true);
+          struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.response.read(iprot);
+          struct.setResponseIsSet(true);
         }
       }
     }
@@ -37699,15 +39938,15 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_ProcessRequest_result implements org.apache.thrift.TBase<ResourceHandler_ProcessRequest_result, ResourceHandler_ProcessRequest_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ProcessRequest_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ProcessRequest_result");
+  public static class ResourceHandler_GetResponseHeaders_result implements org.apache.thrift.TBase<ResourceHandler_GetResponseHeaders_result, ResourceHandler_GetResponseHeaders_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_GetResponseHeaders_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_GetResponseHeaders_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ProcessRequest_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_resultTupleSchemeFactory();
 
-    public boolean success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -37772,68 +40011,67 @@ public class ClientHandlers {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ProcessRequest_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_GetResponseHeaders_result.class, metaDataMap);
     }
 
-    public ResourceHandler_ProcessRequest_result() {
+    public ResourceHandler_GetResponseHeaders_result() {
     }
 
-    public ResourceHandler_ProcessRequest_result(
-      boolean success)
+    public ResourceHandler_GetResponseHeaders_result(
+      com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success)
     {
       this();
       this.success = success;
-      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_ProcessRequest_result(ResourceHandler_ProcessRequest_result other) {
-      __isset_bitfield = other.__isset_bitfield;
-      this.success = other.success;
+    public ResourceHandler_GetResponseHeaders_result(ResourceHandler_GetResponseHeaders_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders(other.success);
+      }
     }
 
     @Override
-    public ResourceHandler_ProcessRequest_result deepCopy() {
-      return new ResourceHandler_ProcessRequest_result(this);
+    public ResourceHandler_GetResponseHeaders_result deepCopy() {
+      return new ResourceHandler_GetResponseHeaders_result(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = false;
+      this.success = null;
     }
 
-    public boolean isSuccess() {
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders getSuccess() {
       return this.success;
     }
 
-    public ResourceHandler_ProcessRequest_result setSuccess(boolean success) {
+    public ResourceHandler_GetResponseHeaders_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success) {
       this.success = success;
-      setSuccessIsSet(true);
       return this;
     }
 
     public void unsetSuccess() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+      this.success = null;
     }
 
     /** Returns true if field success is set (has been assigned a value) and false otherwise */
     public boolean isSetSuccess() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
+      return this.success != null;
     }
 
     public void setSuccessIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
+      if (!value) {
+        this.success = null;
+      }
     }
 
     @Override
@@ -37843,7 +40081,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((java.lang.Boolean)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders)value);
         }
         break;
 
@@ -37855,7 +40093,7 @@ public class ClientHandlers {
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
       case SUCCESS:
-        return isSuccess();
+        return getSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -37877,23 +40115,23 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_ProcessRequest_result)
-        return this.equals((ResourceHandler_ProcessRequest_result)that);
+      if (that instanceof ResourceHandler_GetResponseHeaders_result)
+        return this.equals((ResourceHandler_GetResponseHeaders_result)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_ProcessRequest_result that) {
+    public boolean equals(ResourceHandler_GetResponseHeaders_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (this.success != that.success)
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -37904,13 +40142,15 @@ public class ClientHandlers {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((success) ? 131071 : 524287);
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceHandler_ProcessRequest_result other) {
+    public int compareTo(ResourceHandler_GetResponseHeaders_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -37947,11 +40187,15 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ProcessRequest_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_GetResponseHeaders_result(");
       boolean first = true;
 
       sb.append("success:");
-      sb.append(this.success);
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -37960,6 +40204,9 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
+      if (success != null) {
+        success.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -37972,25 +40219,23 @@ public class ClientHandlers {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_GetResponseHeaders_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ProcessRequest_resultStandardScheme getScheme() {
-        return new ResourceHandler_ProcessRequest_resultStandardScheme();
+      public ResourceHandler_GetResponseHeaders_resultStandardScheme getScheme() {
+        return new ResourceHandler_GetResponseHeaders_resultStandardScheme();
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ProcessRequest_result> {
+    private static class ResourceHandler_GetResponseHeaders_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_GetResponseHeaders_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38001,8 +40246,9 @@ public class ClientHandlers {
           }
           switch (schemeField.id) {
             case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
-                struct.success = iprot.readBool();
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders();
+                struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
@@ -38020,13 +40266,13 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.isSetSuccess()) {
+        if (struct.success != null) {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeBool(struct.success);
+          struct.success.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -38035,17 +40281,17 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceHandler_ProcessRequest_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_GetResponseHeaders_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ProcessRequest_resultTupleScheme getScheme() {
-        return new ResourceHandler_ProcessRequest_resultTupleScheme();
+      public ResourceHandler_GetResponseHeaders_resultTupleScheme getScheme() {
+        return new ResourceHandler_GetResponseHeaders_resultTupleScheme();
       }
     }
 
-    private static class ResourceHandler_ProcessRequest_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ProcessRequest_result> {
+    private static class ResourceHandler_GetResponseHeaders_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_GetResponseHeaders_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -38053,16 +40299,17 @@ public class ClientHandlers {
         }
         oprot.writeBitSet(optionals, 1);
         if (struct.isSetSuccess()) {
-          oprot.writeBool(struct.success);
+          struct.success.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ProcessRequest_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = iprot.readBool();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders();
+          struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
       }
@@ -38074,22 +40321,25 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_GetResponseHeaders_args implements org.apache.thrift.TBase<ResourceHandler_GetResponseHeaders_args, ResourceHandler_GetResponseHeaders_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_GetResponseHeaders_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_GetResponseHeaders_args");
+  public static class ResourceHandler_ReadResponse_args implements org.apache.thrift.TBase<ResourceHandler_ReadResponse_args, ResourceHandler_ReadResponse_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponse_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponse_args");
 
     private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField RESPONSE_FIELD_DESC = new org.apache.thrift.protocol.TField("response", org.apache.thrift.protocol.TType.STRUCT, (short)2);
+    private static final org.apache.thrift.protocol.TField BYTES_TO_READ_FIELD_DESC = new org.apache.thrift.protocol.TField("bytes_to_read", org.apache.thrift.protocol.TType.I32, (short)2);
+    private static final org.apache.thrift.protocol.TField CALLBACK_FIELD_DESC = new org.apache.thrift.protocol.TField("callback", org.apache.thrift.protocol.TType.STRUCT, (short)3);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponse_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponse_argsTupleSchemeFactory();
 
     public int resourceHandler; // required
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response; // required
+    public int bytes_to_read; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
       RESOURCE_HANDLER((short)1, "resourceHandler"),
-      RESPONSE((short)2, "response");
+      BYTES_TO_READ((short)2, "bytes_to_read"),
+      CALLBACK((short)3, "callback");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -38107,8 +40357,10 @@ public class ClientHandlers {
         switch(fieldId) {
           case 1: // RESOURCE_HANDLER
             return RESOURCE_HANDLER;
-          case 2: // RESPONSE
-            return RESPONSE;
+          case 2: // BYTES_TO_READ
+            return BYTES_TO_READ;
+          case 3: // CALLBACK
+            return CALLBACK;
           default:
             return null;
         }
@@ -38153,59 +40405,68 @@ public class ClientHandlers {
 
     // isset id assignments
     private static final int __RESOURCEHANDLER_ISSET_ID = 0;
+    private static final int __BYTES_TO_READ_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.RESOURCE_HANDLER, new org.apache.thrift.meta_data.FieldMetaData("resourceHandler", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.RESPONSE, new org.apache.thrift.meta_data.FieldMetaData("response", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.BYTES_TO_READ, new org.apache.thrift.meta_data.FieldMetaData("bytes_to_read", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.CALLBACK, new org.apache.thrift.meta_data.FieldMetaData("callback", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_GetResponseHeaders_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponse_args.class, metaDataMap);
     }
 
-    public ResourceHandler_GetResponseHeaders_args() {
+    public ResourceHandler_ReadResponse_args() {
     }
 
-    public ResourceHandler_GetResponseHeaders_args(
+    public ResourceHandler_ReadResponse_args(
       int resourceHandler,
-      com.jetbrains.cef.remote.thrift_codegen.RObject response)
+      int bytes_to_read,
+      com.jetbrains.cef.remote.thrift_codegen.RObject callback)
     {
       this();
       this.resourceHandler = resourceHandler;
       setResourceHandlerIsSet(true);
-      this.response = response;
+      this.bytes_to_read = bytes_to_read;
+      setBytes_to_readIsSet(true);
+      this.callback = callback;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_GetResponseHeaders_args(ResourceHandler_GetResponseHeaders_args other) {
+    public ResourceHandler_ReadResponse_args(ResourceHandler_ReadResponse_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.resourceHandler = other.resourceHandler;
-      if (other.isSetResponse()) {
-        this.response = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.response);
+      this.bytes_to_read = other.bytes_to_read;
+      if (other.isSetCallback()) {
+        this.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.callback);
       }
     }
 
     @Override
-    public ResourceHandler_GetResponseHeaders_args deepCopy() {
-      return new ResourceHandler_GetResponseHeaders_args(this);
+    public ResourceHandler_ReadResponse_args deepCopy() {
+      return new ResourceHandler_ReadResponse_args(this);
     }
 
     @Override
     public void clear() {
       setResourceHandlerIsSet(false);
       this.resourceHandler = 0;
-      this.response = null;
+      setBytes_to_readIsSet(false);
+      this.bytes_to_read = 0;
+      this.callback = null;
     }
 
     public int getResourceHandler() {
       return this.resourceHandler;
     }
 
-    public ResourceHandler_GetResponseHeaders_args setResourceHandler(int resourceHandler) {
+    public ResourceHandler_ReadResponse_args setResourceHandler(int resourceHandler) {
       this.resourceHandler = resourceHandler;
       setResourceHandlerIsSet(true);
       return this;
@@ -38224,28 +40485,51 @@ public class ClientHandlers {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RESOURCEHANDLER_ISSET_ID, value);
     }
 
+    public int getBytes_to_read() {
+      return this.bytes_to_read;
+    }
+
+    public ResourceHandler_ReadResponse_args setBytes_to_read(int bytes_to_read) {
+      this.bytes_to_read = bytes_to_read;
+      setBytes_to_readIsSet(true);
+      return this;
+    }
+
+    public void unsetBytes_to_read() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BYTES_TO_READ_ISSET_ID);
+    }
+
+    /** Returns true if field bytes_to_read is set (has been assigned a value) and false otherwise */
+    public boolean isSetBytes_to_read() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BYTES_TO_READ_ISSET_ID);
+    }
+
+    public void setBytes_to_readIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BYTES_TO_READ_ISSET_ID, value);
+    }
+
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.RObject getResponse() {
-      return this.response;
+    public com.jetbrains.cef.remote.thrift_codegen.RObject getCallback() {
+      return this.callback;
     }
 
-    public ResourceHandler_GetResponseHeaders_args setResponse(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject response) {
-      this.response = response;
+    public ResourceHandler_ReadResponse_args setCallback(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback) {
+      this.callback = callback;
       return this;
     }
 
-    public void unsetResponse() {
-      this.response = null;
+    public void unsetCallback() {
+      this.callback = null;
     }
 
-    /** Returns true if field response is set (has been assigned a value) and false otherwise */
-    public boolean isSetResponse() {
-      return this.response != null;
+    /** Returns true if field callback is set (has been assigned a value) and false otherwise */
+    public boolean isSetCallback() {
+      return this.callback != null;
     }
 
-    public void setResponseIsSet(boolean value) {
+    public void setCallbackIsSet(boolean value) {
       if (!value) {
-        this.response = null;
+        this.callback = null;
       }
     }
 
@@ -38260,11 +40544,19 @@ public class ClientHandlers {
         }
         break;
 
-      case RESPONSE:
+      case BYTES_TO_READ:
         if (value == null) {
-          unsetResponse();
+          unsetBytes_to_read();
         } else {
-          setResponse((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
+          setBytes_to_read((java.lang.Integer)value);
+        }
+        break;
+
+      case CALLBACK:
+        if (value == null) {
+          unsetCallback();
+        } else {
+          setCallback((com.jetbrains.cef.remote.thrift_codegen.RObject)value);
         }
         break;
 
@@ -38278,8 +40570,11 @@ public class ClientHandlers {
       case RESOURCE_HANDLER:
         return getResourceHandler();
 
-      case RESPONSE:
-        return getResponse();
+      case BYTES_TO_READ:
+        return getBytes_to_read();
+
+      case CALLBACK:
+        return getCallback();
 
       }
       throw new java.lang.IllegalStateException();
@@ -38295,20 +40590,22 @@ public class ClientHandlers {
       switch (field) {
       case RESOURCE_HANDLER:
         return isSetResourceHandler();
-      case RESPONSE:
-        return isSetResponse();
+      case BYTES_TO_READ:
+        return isSetBytes_to_read();
+      case CALLBACK:
+        return isSetCallback();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_GetResponseHeaders_args)
-        return this.equals((ResourceHandler_GetResponseHeaders_args)that);
+      if (that instanceof ResourceHandler_ReadResponse_args)
+        return this.equals((ResourceHandler_ReadResponse_args)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_GetResponseHeaders_args that) {
+    public boolean equals(ResourceHandler_ReadResponse_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -38323,12 +40620,21 @@ public class ClientHandlers {
           return false;
       }
 
-      boolean this_present_response = true && this.isSetResponse();
-      boolean that_present_response = true && that.isSetResponse();
-      if (this_present_response || that_present_response) {
-        if (!(this_present_response && that_present_response))
+      boolean this_present_bytes_to_read = true;
+      boolean that_present_bytes_to_read = true;
+      if (this_present_bytes_to_read || that_present_bytes_to_read) {
+        if (!(this_present_bytes_to_read && that_present_bytes_to_read))
           return false;
-        if (!this.response.equals(that.response))
+        if (this.bytes_to_read != that.bytes_to_read)
+          return false;
+      }
+
+      boolean this_present_callback = true && this.isSetCallback();
+      boolean that_present_callback = true && that.isSetCallback();
+      if (this_present_callback || that_present_callback) {
+        if (!(this_present_callback && that_present_callback))
+          return false;
+        if (!this.callback.equals(that.callback))
           return false;
       }
 
@@ -38341,15 +40647,17 @@ public class ClientHandlers {
 
       hashCode = hashCode * 8191 + resourceHandler;
 
-      hashCode = hashCode * 8191 + ((isSetResponse()) ? 131071 : 524287);
-      if (isSetResponse())
-        hashCode = hashCode * 8191 + response.hashCode();
+      hashCode = hashCode * 8191 + bytes_to_read;
+
+      hashCode = hashCode * 8191 + ((isSetCallback()) ? 131071 : 524287);
+      if (isSetCallback())
+        hashCode = hashCode * 8191 + callback.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceHandler_GetResponseHeaders_args other) {
+    public int compareTo(ResourceHandler_ReadResponse_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -38366,12 +40674,22 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetResponse(), other.isSetResponse());
+      lastComparison = java.lang.Boolean.compare(isSetBytes_to_read(), other.isSetBytes_to_read());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetResponse()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.response, other.response);
+      if (isSetBytes_to_read()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bytes_to_read, other.bytes_to_read);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetCallback(), other.isSetCallback());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetCallback()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.callback, other.callback);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -38397,18 +40715,22 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_GetResponseHeaders_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponse_args(");
       boolean first = true;
 
       sb.append("resourceHandler:");
       sb.append(this.resourceHandler);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("response:");
-      if (this.response == null) {
+      sb.append("bytes_to_read:");
+      sb.append(this.bytes_to_read);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("callback:");
+      if (this.callback == null) {
         sb.append("null");
       } else {
-        sb.append(this.response);
+        sb.append(this.callback);
       }
       first = false;
       sb.append(")");
@@ -38418,8 +40740,8 @@ public class ClientHandlers {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
-      if (response != null) {
-        response.validate();
+      if (callback != null) {
+        callback.validate();
       }
     }
 
@@ -38441,17 +40763,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponse_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_GetResponseHeaders_argsStandardScheme getScheme() {
-        return new ResourceHandler_GetResponseHeaders_argsStandardScheme();
+      public ResourceHandler_ReadResponse_argsStandardScheme getScheme() {
+        return new ResourceHandler_ReadResponse_argsStandardScheme();
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_GetResponseHeaders_args> {
+    private static class ResourceHandler_ReadResponse_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponse_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38469,11 +40791,19 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // RESPONSE
+            case 2: // BYTES_TO_READ
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bytes_to_read = iprot.readI32();
+                struct.setBytes_to_readIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // CALLBACK
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-                struct.response.read(iprot);
-                struct.setResponseIsSet(true);
+                struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+                struct.callback.read(iprot);
+                struct.setCallbackIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -38490,16 +40820,19 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(RESOURCE_HANDLER_FIELD_DESC);
         oprot.writeI32(struct.resourceHandler);
         oprot.writeFieldEnd();
-        if (struct.response != null) {
-          oprot.writeFieldBegin(RESPONSE_FIELD_DESC);
-          struct.response.write(oprot);
+        oprot.writeFieldBegin(BYTES_TO_READ_FIELD_DESC);
+        oprot.writeI32(struct.bytes_to_read);
+        oprot.writeFieldEnd();
+        if (struct.callback != null) {
+          oprot.writeFieldBegin(CALLBACK_FIELD_DESC);
+          struct.callback.write(oprot);
           oprot.writeFieldEnd();
         }
         oprot.writeFieldStop();
@@ -38508,46 +40841,56 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceHandler_GetResponseHeaders_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponse_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_GetResponseHeaders_argsTupleScheme getScheme() {
-        return new ResourceHandler_GetResponseHeaders_argsTupleScheme();
+      public ResourceHandler_ReadResponse_argsTupleScheme getScheme() {
+        return new ResourceHandler_ReadResponse_argsTupleScheme();
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_GetResponseHeaders_args> {
+    private static class ResourceHandler_ReadResponse_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponse_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetResourceHandler()) {
           optionals.set(0);
         }
-        if (struct.isSetResponse()) {
+        if (struct.isSetBytes_to_read()) {
           optionals.set(1);
         }
-        oprot.writeBitSet(optionals, 2);
+        if (struct.isSetCallback()) {
+          optionals.set(2);
+        }
+        oprot.writeBitSet(optionals, 3);
         if (struct.isSetResourceHandler()) {
           oprot.writeI32(struct.resourceHandler);
         }
-        if (struct.isSetResponse()) {
-          struct.response.write(oprot);
+        if (struct.isSetBytes_to_read()) {
+          oprot.writeI32(struct.bytes_to_read);
+        }
+        if (struct.isSetCallback()) {
+          struct.callback.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(2);
+        java.util.BitSet incoming = iprot.readBitSet(3);
         if (incoming.get(0)) {
           struct.resourceHandler = iprot.readI32();
           struct.setResourceHandlerIsSet(true);
         }
         if (incoming.get(1)) {
-          struct.response = new com.jetbrains.cef.remote.thrift_codegen.RObject();
-          struct.response.read(iprot);
-          struct.setResponseIsSet(true);
+          struct.bytes_to_read = iprot.readI32();
+          struct.setBytes_to_readIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject();
+          struct.callback.read(iprot);
+          struct.setCallbackIsSet(true);
         }
       }
     }
@@ -38558,15 +40901,15 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_GetResponseHeaders_result implements org.apache.thrift.TBase<ResourceHandler_GetResponseHeaders_result, ResourceHandler_GetResponseHeaders_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_GetResponseHeaders_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_GetResponseHeaders_result");
+  public static class ResourceHandler_ReadResponse_result implements org.apache.thrift.TBase<ResourceHandler_ReadResponse_result, ResourceHandler_ReadResponse_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponse_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponse_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_GetResponseHeaders_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponse_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponse_resultTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseData success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -38635,16 +40978,16 @@ public class ClientHandlers {
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ResponseData.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_GetResponseHeaders_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponse_result.class, metaDataMap);
     }
 
-    public ResourceHandler_GetResponseHeaders_result() {
+    public ResourceHandler_ReadResponse_result() {
     }
 
-    public ResourceHandler_GetResponseHeaders_result(
-      com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success)
+    public ResourceHandler_ReadResponse_result(
+      com.jetbrains.cef.remote.thrift_codegen.ResponseData success)
     {
       this();
       this.success = success;
@@ -38653,15 +40996,15 @@ public class ClientHandlers {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_GetResponseHeaders_result(ResourceHandler_GetResponseHeaders_result other) {
+    public ResourceHandler_ReadResponse_result(ResourceHandler_ReadResponse_result other) {
       if (other.isSetSuccess()) {
-        this.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders(other.success);
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseData(other.success);
       }
     }
 
     @Override
-    public ResourceHandler_GetResponseHeaders_result deepCopy() {
-      return new ResourceHandler_GetResponseHeaders_result(this);
+    public ResourceHandler_ReadResponse_result deepCopy() {
+      return new ResourceHandler_ReadResponse_result(this);
     }
 
     @Override
@@ -38670,11 +41013,11 @@ public class ClientHandlers {
     }
 
     @org.apache.thrift.annotation.Nullable
-    public com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders getSuccess() {
+    public com.jetbrains.cef.remote.thrift_codegen.ResponseData getSuccess() {
       return this.success;
     }
 
-    public ResourceHandler_GetResponseHeaders_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders success) {
+    public ResourceHandler_ReadResponse_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseData success) {
       this.success = success;
       return this;
     }
@@ -38701,7 +41044,7 @@ public class ClientHandlers {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.ResponseData)value);
         }
         break;
 
@@ -38735,12 +41078,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_GetResponseHeaders_result)
-        return this.equals((ResourceHandler_GetResponseHeaders_result)that);
+      if (that instanceof ResourceHandler_ReadResponse_result)
+        return this.equals((ResourceHandler_ReadResponse_result)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_GetResponseHeaders_result that) {
+    public boolean equals(ResourceHandler_ReadResponse_result that) {
       if (that == null)
         return false;
       if (this == that)
@@ -38770,7 +41113,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(ResourceHandler_GetResponseHeaders_result other) {
+    public int compareTo(ResourceHandler_ReadResponse_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -38807,7 +41150,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_GetResponseHeaders_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponse_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -38845,17 +41188,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponse_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_GetResponseHeaders_resultStandardScheme getScheme() {
-        return new ResourceHandler_GetResponseHeaders_resultStandardScheme();
+      public ResourceHandler_ReadResponse_resultStandardScheme getScheme() {
+        return new ResourceHandler_ReadResponse_resultStandardScheme();
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_GetResponseHeaders_result> {
+    private static class ResourceHandler_ReadResponse_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponse_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -38867,7 +41210,7 @@ public class ClientHandlers {
           switch (schemeField.id) {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
-                struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders();
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseData();
                 struct.success.read(iprot);
                 struct.setSuccessIsSet(true);
               } else { 
@@ -38886,7 +41229,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -38901,17 +41244,17 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceHandler_GetResponseHeaders_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponse_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_GetResponseHeaders_resultTupleScheme getScheme() {
-        return new ResourceHandler_GetResponseHeaders_resultTupleScheme();
+      public ResourceHandler_ReadResponse_resultTupleScheme getScheme() {
+        return new ResourceHandler_ReadResponse_resultTupleScheme();
       }
     }
 
-    private static class ResourceHandler_GetResponseHeaders_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_GetResponseHeaders_result> {
+    private static class ResourceHandler_ReadResponse_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponse_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -38924,11 +41267,11 @@ public class ClientHandlers {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_GetResponseHeaders_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseHeaders();
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseData();
           struct.success.read(iprot);
           struct.setSuccessIsSet(true);
         }
@@ -38941,25 +41284,31 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_ReadResponse_args implements org.apache.thrift.TBase<ResourceHandler_ReadResponse_args, ResourceHandler_ReadResponse_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponse_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponse_args");
+  public static class ResourceHandler_ReadResponseShared_args implements org.apache.thrift.TBase<ResourceHandler_ReadResponseShared_args, ResourceHandler_ReadResponseShared_args._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponseShared_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponseShared_args");
 
     private static final org.apache.thrift.protocol.TField RESOURCE_HANDLER_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceHandler", org.apache.thrift.protocol.TType.I32, (short)1);
     private static final org.apache.thrift.protocol.TField BYTES_TO_READ_FIELD_DESC = new org.apache.thrift.protocol.TField("bytes_to_read", org.apache.thrift.protocol.TType.I32, (short)2);
     private static final org.apache.thrift.protocol.TField CALLBACK_FIELD_DESC = new org.apache.thrift.protocol.TField("callback", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField SHARED_MEM_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("sharedMemName", org.apache.thrift.protocol.TType.STRING, (short)4);
+    private static final org.apache.thrift.protocol.TField SHARED_MEM_HANDLE_FIELD_DESC = new org.apache.thrift.protocol.TField("sharedMemHandle", org.apache.thrift.protocol.TType.I64, (short)5);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponse_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponse_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponseShared_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponseShared_argsTupleSchemeFactory();
 
     public int resourceHandler; // required
     public int bytes_to_read; // required
     public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String sharedMemName; // required
+    public long sharedMemHandle; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
       RESOURCE_HANDLER((short)1, "resourceHandler"),
       BYTES_TO_READ((short)2, "bytes_to_read"),
-      CALLBACK((short)3, "callback");
+      CALLBACK((short)3, "callback"),
+      SHARED_MEM_NAME((short)4, "sharedMemName"),
+      SHARED_MEM_HANDLE((short)5, "sharedMemHandle");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -38981,6 +41330,10 @@ public class ClientHandlers {
             return BYTES_TO_READ;
           case 3: // CALLBACK
             return CALLBACK;
+          case 4: // SHARED_MEM_NAME
+            return SHARED_MEM_NAME;
+          case 5: // SHARED_MEM_HANDLE
+            return SHARED_MEM_HANDLE;
           default:
             return null;
         }
@@ -39026,6 +41379,7 @@ public class ClientHandlers {
     // isset id assignments
     private static final int __RESOURCEHANDLER_ISSET_ID = 0;
     private static final int __BYTES_TO_READ_ISSET_ID = 1;
+    private static final int __SHAREDMEMHANDLE_ISSET_ID = 2;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
@@ -39036,17 +41390,23 @@ public class ClientHandlers {
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       tmpMap.put(_Fields.CALLBACK, new org.apache.thrift.meta_data.FieldMetaData("callback", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.RObject.class)));
+      tmpMap.put(_Fields.SHARED_MEM_NAME, new org.apache.thrift.meta_data.FieldMetaData("sharedMemName", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.SHARED_MEM_HANDLE, new org.apache.thrift.meta_data.FieldMetaData("sharedMemHandle", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponse_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponseShared_args.class, metaDataMap);
     }
 
-    public ResourceHandler_ReadResponse_args() {
+    public ResourceHandler_ReadResponseShared_args() {
     }
 
-    public ResourceHandler_ReadResponse_args(
+    public ResourceHandler_ReadResponseShared_args(
       int resourceHandler,
       int bytes_to_read,
-      com.jetbrains.cef.remote.thrift_codegen.RObject callback)
+      com.jetbrains.cef.remote.thrift_codegen.RObject callback,
+      java.lang.String sharedMemName,
+      long sharedMemHandle)
     {
       this();
       this.resourceHandler = resourceHandler;
@@ -39054,23 +41414,30 @@ public class ClientHandlers {
       this.bytes_to_read = bytes_to_read;
       setBytes_to_readIsSet(true);
       this.callback = callback;
+      this.sharedMemName = sharedMemName;
+      this.sharedMemHandle = sharedMemHandle;
+      setSharedMemHandleIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_ReadResponse_args(ResourceHandler_ReadResponse_args other) {
+    public ResourceHandler_ReadResponseShared_args(ResourceHandler_ReadResponseShared_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.resourceHandler = other.resourceHandler;
       this.bytes_to_read = other.bytes_to_read;
       if (other.isSetCallback()) {
         this.callback = new com.jetbrains.cef.remote.thrift_codegen.RObject(other.callback);
       }
+      if (other.isSetSharedMemName()) {
+        this.sharedMemName = other.sharedMemName;
+      }
+      this.sharedMemHandle = other.sharedMemHandle;
     }
 
     @Override
-    public ResourceHandler_ReadResponse_args deepCopy() {
-      return new ResourceHandler_ReadResponse_args(this);
+    public ResourceHandler_ReadResponseShared_args deepCopy() {
+      return new ResourceHandler_ReadResponseShared_args(this);
     }
 
     @Override
@@ -39080,13 +41447,16 @@ public class ClientHandlers {
       setBytes_to_readIsSet(false);
       this.bytes_to_read = 0;
       this.callback = null;
+      this.sharedMemName = null;
+      setSharedMemHandleIsSet(false);
+      this.sharedMemHandle = 0;
     }
 
     public int getResourceHandler() {
       return this.resourceHandler;
     }
 
-    public ResourceHandler_ReadResponse_args setResourceHandler(int resourceHandler) {
+    public ResourceHandler_ReadResponseShared_args setResourceHandler(int resourceHandler) {
       this.resourceHandler = resourceHandler;
       setResourceHandlerIsSet(true);
       return this;
@@ -39109,7 +41479,7 @@ public class ClientHandlers {
       return this.bytes_to_read;
     }
 
-    public ResourceHandler_ReadResponse_args setBytes_to_read(int bytes_to_read) {
+    public ResourceHandler_ReadResponseShared_args setBytes_to_read(int bytes_to_read) {
       this.bytes_to_read = bytes_to_read;
       setBytes_to_readIsSet(true);
       return this;
@@ -39133,7 +41503,7 @@ public class ClientHandlers {
       return this.callback;
     }
 
-    public ResourceHandler_ReadResponse_args setCallback(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback) {
+    public ResourceHandler_ReadResponseShared_args setCallback(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.RObject callback) {
       this.callback = callback;
       return this;
     }
@@ -39153,6 +41523,54 @@ public class ClientHandlers {
       }
     }
 
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getSharedMemName() {
+      return this.sharedMemName;
+    }
+
+    public ResourceHandler_ReadResponseShared_args setSharedMemName(@org.apache.thrift.annotation.Nullable java.lang.String sharedMemName) {
+      this.sharedMemName = sharedMemName;
+      return this;
+    }
+
+    public void unsetSharedMemName() {
+      this.sharedMemName = null;
+    }
+
+    /** Returns true if field sharedMemName is set (has been assigned a value) and false otherwise */
+    public boolean isSetSharedMemName() {
+      return this.sharedMemName != null;
+    }
+
+    public void setSharedMemNameIsSet(boolean value) {
+      if (!value) {
+        this.sharedMemName = null;
+      }
+    }
+
+    public long getSharedMemHandle() {
+      return this.sharedMemHandle;
+    }
+
+    public ResourceHandler_ReadResponseShared_args setSharedMemHandle(long sharedMemHandle) {
+      this.sharedMemHandle = sharedMemHandle;
+      setSharedMemHandleIsSet(true);
+      return this;
+    }
+
+    public void unsetSharedMemHandle() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID);
+    }
+
+    /** Returns true if field sharedMemHandle is set (has been assigned a value) and false otherwise */
+    public boolean isSetSharedMemHandle() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID);
+    }
+
+    public void setSharedMemHandleIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SHAREDMEMHANDLE_ISSET_ID, value);
+    }
+
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -39180,6 +41598,22 @@ public class ClientHandlers {
         }
         break;
 
+      case SHARED_MEM_NAME:
+        if (value == null) {
+          unsetSharedMemName();
+        } else {
+          setSharedMemName((java.lang.String)value);
+        }
+        break;
+
+      case SHARED_MEM_HANDLE:
+        if (value == null) {
+          unsetSharedMemHandle();
+        } else {
+          setSharedMemHandle((java.lang.Long)value);
+        }
+        break;
+
       }
     }
 
@@ -39196,6 +41630,12 @@ public class ClientHandlers {
       case CALLBACK:
         return getCallback();
 
+      case SHARED_MEM_NAME:
+        return getSharedMemName();
+
+      case SHARED_MEM_HANDLE:
+        return getSharedMemHandle();
+
       }
       throw new java.lang.IllegalStateException();
     }
@@ -39214,18 +41654,22 @@ public class ClientHandlers {
         return isSetBytes_to_read();
       case CALLBACK:
         return isSetCallback();
+      case SHARED_MEM_NAME:
+        return isSetSharedMemName();
+      case SHARED_MEM_HANDLE:
+        return isSetSharedMemHandle();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_ReadResponse_args)
-        return this.equals((ResourceHandler_ReadResponse_args)that);
+      if (that instanceof ResourceHandler_ReadResponseShared_args)
+        return this.equals((ResourceHandler_ReadResponseShared_args)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_ReadResponse_args that) {
+    public boolean equals(ResourceHandler_ReadResponseShared_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -39258,6 +41702,24 @@ public class ClientHandlers {
           return false;
       }
 
+      boolean this_present_sharedMemName = true && this.isSetSharedMemName();
+      boolean that_present_sharedMemName = true && that.isSetSharedMemName();
+      if (this_present_sharedMemName || that_present_sharedMemName) {
+        if (!(this_present_sharedMemName && that_present_sharedMemName))
+          return false;
+        if (!this.sharedMemName.equals(that.sharedMemName))
+          return false;
+      }
+
+      boolean this_present_sharedMemHandle = true;
+      boolean that_present_sharedMemHandle = true;
+      if (this_present_sharedMemHandle || that_present_sharedMemHandle) {
+        if (!(this_present_sharedMemHandle && that_present_sharedMemHandle))
+          return false;
+        if (this.sharedMemHandle != that.sharedMemHandle)
+          return false;
+      }
+
       return true;
     }
 
@@ -39273,11 +41735,17 @@ public class ClientHandlers {
       if (isSetCallback())
         hashCode = hashCode * 8191 + callback.hashCode();
 
+      hashCode = hashCode * 8191 + ((isSetSharedMemName()) ? 131071 : 524287);
+      if (isSetSharedMemName())
+        hashCode = hashCode * 8191 + sharedMemName.hashCode();
+
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(sharedMemHandle);
+
       return hashCode;
     }
 
     @Override
-    public int compareTo(ResourceHandler_ReadResponse_args other) {
+    public int compareTo(ResourceHandler_ReadResponseShared_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -39314,6 +41782,26 @@ public class ClientHandlers {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetSharedMemName(), other.isSetSharedMemName());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSharedMemName()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.sharedMemName, other.sharedMemName);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetSharedMemHandle(), other.isSetSharedMemHandle());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSharedMemHandle()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.sharedMemHandle, other.sharedMemHandle);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -39335,7 +41823,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponse_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponseShared_args(");
       boolean first = true;
 
       sb.append("resourceHandler:");
@@ -39353,6 +41841,18 @@ public class ClientHandlers {
         sb.append(this.callback);
       }
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("sharedMemName:");
+      if (this.sharedMemName == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.sharedMemName);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("sharedMemHandle:");
+      sb.append(this.sharedMemHandle);
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -39383,17 +41883,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_ReadResponse_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponseShared_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ReadResponse_argsStandardScheme getScheme() {
-        return new ResourceHandler_ReadResponse_argsStandardScheme();
+      public ResourceHandler_ReadResponseShared_argsStandardScheme getScheme() {
+        return new ResourceHandler_ReadResponseShared_argsStandardScheme();
       }
     }
 
-    private static class ResourceHandler_ReadResponse_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponse_args> {
+    private static class ResourceHandler_ReadResponseShared_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponseShared_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponseShared_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -39428,6 +41928,22 @@ public class ClientHandlers {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
+            case 4: // SHARED_MEM_NAME
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.sharedMemName = iprot.readString();
+                struct.setSharedMemNameIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 5: // SHARED_MEM_HANDLE
+              if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+                struct.sharedMemHandle = iprot.readI64();
+                struct.setSharedMemHandleIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -39440,7 +41956,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponseShared_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -39455,23 +41971,31 @@ public class ClientHandlers {
           struct.callback.write(oprot);
           oprot.writeFieldEnd();
         }
+        if (struct.sharedMemName != null) {
+          oprot.writeFieldBegin(SHARED_MEM_NAME_FIELD_DESC);
+          oprot.writeString(struct.sharedMemName);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldBegin(SHARED_MEM_HANDLE_FIELD_DESC);
+        oprot.writeI64(struct.sharedMemHandle);
+        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class ResourceHandler_ReadResponse_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponseShared_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ReadResponse_argsTupleScheme getScheme() {
-        return new ResourceHandler_ReadResponse_argsTupleScheme();
+      public ResourceHandler_ReadResponseShared_argsTupleScheme getScheme() {
+        return new ResourceHandler_ReadResponseShared_argsTupleScheme();
       }
     }
 
-    private static class ResourceHandler_ReadResponse_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponse_args> {
+    private static class ResourceHandler_ReadResponseShared_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponseShared_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponseShared_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetResourceHandler()) {
@@ -39483,7 +42007,13 @@ public class ClientHandlers {
         if (struct.isSetCallback()) {
           optionals.set(2);
         }
-        oprot.writeBitSet(optionals, 3);
+        if (struct.isSetSharedMemName()) {
+          optionals.set(3);
+        }
+        if (struct.isSetSharedMemHandle()) {
+          optionals.set(4);
+        }
+        oprot.writeBitSet(optionals, 5);
         if (struct.isSetResourceHandler()) {
           oprot.writeI32(struct.resourceHandler);
         }
@@ -39493,12 +42023,18 @@ public class ClientHandlers {
         if (struct.isSetCallback()) {
           struct.callback.write(oprot);
         }
+        if (struct.isSetSharedMemName()) {
+          oprot.writeString(struct.sharedMemName);
+        }
+        if (struct.isSetSharedMemHandle()) {
+          oprot.writeI64(struct.sharedMemHandle);
+        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponseShared_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(3);
+        java.util.BitSet incoming = iprot.readBitSet(5);
         if (incoming.get(0)) {
           struct.resourceHandler = iprot.readI32();
           struct.setResourceHandlerIsSet(true);
@@ -39512,6 +42048,14 @@ public class ClientHandlers {
           struct.callback.read(iprot);
           struct.setCallbackIsSet(true);
         }
+        if (incoming.get(3)) {
+          struct.sharedMemName = iprot.readString();
+          struct.setSharedMemNameIsSet(true);
+        }
+        if (incoming.get(4)) {
+          struct.sharedMemHandle = iprot.readI64();
+          struct.setSharedMemHandleIsSet(true);
+        }
       }
     }
 
@@ -39521,13 +42065,13 @@ public class ClientHandlers {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class ResourceHandler_ReadResponse_result implements org.apache.thrift.TBase<ResourceHandler_ReadResponse_result, ResourceHandler_ReadResponse_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponse_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponse_result");
+  public static class ResourceHandler_ReadResponseShared_result implements org.apache.thrift.TBase<ResourceHandler_ReadResponseShared_result, ResourceHandler_ReadResponseShared_result._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceHandler_ReadResponseShared_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceHandler_ReadResponseShared_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponse_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponse_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceHandler_ReadResponseShared_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceHandler_ReadResponseShared_resultTupleSchemeFactory();
 
     public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseData success; // required
 
@@ -39600,13 +42144,13 @@ public class ClientHandlers {
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ResponseData.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponse_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceHandler_ReadResponseShared_result.class, metaDataMap);
     }
 
-    public ResourceHandler_ReadResponse_result() {
+    public ResourceHandler_ReadResponseShared_result() {
     }
 
-    public ResourceHandler_ReadResponse_result(
+    public ResourceHandler_ReadResponseShared_result(
       com.jetbrains.cef.remote.thrift_codegen.ResponseData success)
     {
       this();
@@ -39616,15 +42160,15 @@ public class ClientHandlers {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public ResourceHandler_ReadResponse_result(ResourceHandler_ReadResponse_result other) {
+    public ResourceHandler_ReadResponseShared_result(ResourceHandler_ReadResponseShared_result other) {
       if (other.isSetSuccess()) {
         this.success = new com.jetbrains.cef.remote.thrift_codegen.ResponseData(other.success);
       }
     }
 
     @Override
-    public ResourceHandler_ReadResponse_result deepCopy() {
-      return new ResourceHandler_ReadResponse_result(this);
+    public ResourceHandler_ReadResponseShared_result deepCopy() {
+      return new ResourceHandler_ReadResponseShared_result(this);
     }
 
     @Override
@@ -39637,7 +42181,7 @@ public class ClientHandlers {
       return this.success;
     }
 
-    public ResourceHandler_ReadResponse_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseData success) {
+    public ResourceHandler_ReadResponseShared_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResponseData success) {
       this.success = success;
       return this;
     }
@@ -39698,12 +42242,12 @@ public class ClientHandlers {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof ResourceHandler_ReadResponse_result)
-        return this.equals((ResourceHandler_ReadResponse_result)that);
+      if (that instanceof ResourceHandler_ReadResponseShared_result)
+        return this.equals((ResourceHandler_ReadResponseShared_result)that);
       return false;
     }
 
-    public boolean equals(ResourceHandler_ReadResponse_result that) {
+    public boolean equals(ResourceHandler_ReadResponseShared_result that) {
       if (that == null)
         return false;
       if (this == that)
@@ -39733,7 +42277,7 @@ public class ClientHandlers {
     }
 
     @Override
-    public int compareTo(ResourceHandler_ReadResponse_result other) {
+    public int compareTo(ResourceHandler_ReadResponseShared_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -39770,7 +42314,7 @@ public class ClientHandlers {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponse_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceHandler_ReadResponseShared_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -39808,17 +42352,17 @@ public class ClientHandlers {
       }
     }
 
-    private static class ResourceHandler_ReadResponse_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponseShared_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ReadResponse_resultStandardScheme getScheme() {
-        return new ResourceHandler_ReadResponse_resultStandardScheme();
+      public ResourceHandler_ReadResponseShared_resultStandardScheme getScheme() {
+        return new ResourceHandler_ReadResponseShared_resultStandardScheme();
       }
     }
 
-    private static class ResourceHandler_ReadResponse_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponse_result> {
+    private static class ResourceHandler_ReadResponseShared_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceHandler_ReadResponseShared_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceHandler_ReadResponseShared_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -39849,7 +42393,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceHandler_ReadResponseShared_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -39864,17 +42408,17 @@ public class ClientHandlers {
 
     }
 
-    private static class ResourceHandler_ReadResponse_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class ResourceHandler_ReadResponseShared_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public ResourceHandler_ReadResponse_resultTupleScheme getScheme() {
-        return new ResourceHandler_ReadResponse_resultTupleScheme();
+      public ResourceHandler_ReadResponseShared_resultTupleScheme getScheme() {
+        return new ResourceHandler_ReadResponseShared_resultTupleScheme();
       }
     }
 
-    private static class ResourceHandler_ReadResponse_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponse_result> {
+    private static class ResourceHandler_ReadResponseShared_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceHandler_ReadResponseShared_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponseShared_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetSuccess()) {
@@ -39887,7 +42431,7 @@ public class ClientHandlers {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponse_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, ResourceHandler_ReadResponseShared_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
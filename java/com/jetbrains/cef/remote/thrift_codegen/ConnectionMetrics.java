@@ -0,0 +1,748 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class ConnectionMetrics implements org.apache.thrift.TBase<ConnectionMetrics, ConnectionMetrics._Fields>, java.io.Serializable, Cloneable, Comparable<ConnectionMetrics> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ConnectionMetrics");
+
+  private static final org.apache.thrift.protocol.TField ID_FIELD_DESC = new org.apache.thrift.protocol.TField("id", org.apache.thrift.protocol.TType.I32, (short)1);
+  private static final org.apache.thrift.protocol.TField CALLS_FIELD_DESC = new org.apache.thrift.protocol.TField("calls", org.apache.thrift.protocol.TType.I64, (short)2);
+  private static final org.apache.thrift.protocol.TField BYTES_IN_FIELD_DESC = new org.apache.thrift.protocol.TField("bytesIn", org.apache.thrift.protocol.TType.I64, (short)3);
+  private static final org.apache.thrift.protocol.TField BYTES_OUT_FIELD_DESC = new org.apache.thrift.protocol.TField("bytesOut", org.apache.thrift.protocol.TType.I64, (short)4);
+  private static final org.apache.thrift.protocol.TField AGE_MS_FIELD_DESC = new org.apache.thrift.protocol.TField("ageMs", org.apache.thrift.protocol.TType.I64, (short)5);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ConnectionMetricsStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ConnectionMetricsTupleSchemeFactory();
+
+  public int id; // required
+  public long calls; // required
+  public long bytesIn; // required
+  public long bytesOut; // required
+  public long ageMs; // required
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    ID((short)1, "id"),
+    CALLS((short)2, "calls"),
+    BYTES_IN((short)3, "bytesIn"),
+    BYTES_OUT((short)4, "bytesOut"),
+    AGE_MS((short)5, "ageMs");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // ID
+          return ID;
+        case 2: // CALLS
+          return CALLS;
+        case 3: // BYTES_IN
+          return BYTES_IN;
+        case 4: // BYTES_OUT
+          return BYTES_OUT;
+        case 5: // AGE_MS
+          return AGE_MS;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __ID_ISSET_ID = 0;
+  private static final int __CALLS_ISSET_ID = 1;
+  private static final int __BYTESIN_ISSET_ID = 2;
+  private static final int __BYTESOUT_ISSET_ID = 3;
+  private static final int __AGEMS_ISSET_ID = 4;
+  private byte __isset_bitfield = 0;
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.ID, new org.apache.thrift.meta_data.FieldMetaData("id", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.CALLS, new org.apache.thrift.meta_data.FieldMetaData("calls", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.BYTES_IN, new org.apache.thrift.meta_data.FieldMetaData("bytesIn", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.BYTES_OUT, new org.apache.thrift.meta_data.FieldMetaData("bytesOut", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.AGE_MS, new org.apache.thrift.meta_data.FieldMetaData("ageMs", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ConnectionMetrics.class, metaDataMap);
+  }
+
+  public ConnectionMetrics() {
+  }
+
+  public ConnectionMetrics(
+    int id,
+    long calls,
+    long bytesIn,
+    long bytesOut,
+    long ageMs)
+  {
+    this();
+    this.id = id;
+    setIdIsSet(true);
+    this.calls = calls;
+    setCallsIsSet(true);
+    this.bytesIn = bytesIn;
+    setBytesInIsSet(true);
+    this.bytesOut = bytesOut;
+    setBytesOutIsSet(true);
+    this.ageMs = ageMs;
+    setAgeMsIsSet(true);
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public ConnectionMetrics(ConnectionMetrics other) {
+    __isset_bitfield = other.__isset_bitfield;
+    this.id = other.id;
+    this.calls = other.calls;
+    this.bytesIn = other.bytesIn;
+    this.bytesOut = other.bytesOut;
+    this.ageMs = other.ageMs;
+  }
+
+  @Override
+  public ConnectionMetrics deepCopy() {
+    return new ConnectionMetrics(this);
+  }
+
+  @Override
+  public void clear() {
+    setIdIsSet(false);
+    this.id = 0;
+    setCallsIsSet(false);
+    this.calls = 0;
+    setBytesInIsSet(false);
+    this.bytesIn = 0;
+    setBytesOutIsSet(false);
+    this.bytesOut = 0;
+    setAgeMsIsSet(false);
+    this.ageMs = 0;
+  }
+
+  public int getId() {
+    return this.id;
+  }
+
+  public ConnectionMetrics setId(int id) {
+    this.id = id;
+    setIdIsSet(true);
+    return this;
+  }
+
+  public void unsetId() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ID_ISSET_ID);
+  }
+
+  /** Returns true if field id is set (has been assigned a value) and false otherwise */
+  public boolean isSetId() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ID_ISSET_ID);
+  }
+
+  public void setIdIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ID_ISSET_ID, value);
+  }
+
+  public long getCalls() {
+    return this.calls;
+  }
+
+  public ConnectionMetrics setCalls(long calls) {
+    this.calls = calls;
+    setCallsIsSet(true);
+    return this;
+  }
+
+  public void unsetCalls() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __CALLS_ISSET_ID);
+  }
+
+  /** Returns true if field calls is set (has been assigned a value) and false otherwise */
+  public boolean isSetCalls() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __CALLS_ISSET_ID);
+  }
+
+  public void setCallsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __CALLS_ISSET_ID, value);
+  }
+
+  public long getBytesIn() {
+    return this.bytesIn;
+  }
+
+  public ConnectionMetrics setBytesIn(long bytesIn) {
+    this.bytesIn = bytesIn;
+    setBytesInIsSet(true);
+    return this;
+  }
+
+  public void unsetBytesIn() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BYTESIN_ISSET_ID);
+  }
+
+  /** Returns true if field bytesIn is set (has been assigned a value) and false otherwise */
+  public boolean isSetBytesIn() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BYTESIN_ISSET_ID);
+  }
+
+  public void setBytesInIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BYTESIN_ISSET_ID, value);
+  }
+
+  public long getBytesOut() {
+    return this.bytesOut;
+  }
+
+  public ConnectionMetrics setBytesOut(long bytesOut) {
+    this.bytesOut = bytesOut;
+    setBytesOutIsSet(true);
+    return this;
+  }
+
+  public void unsetBytesOut() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BYTESOUT_ISSET_ID);
+  }
+
+  /** Returns true if field bytesOut is set (has been assigned a value) and false otherwise */
+  public boolean isSetBytesOut() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BYTESOUT_ISSET_ID);
+  }
+
+  public void setBytesOutIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BYTESOUT_ISSET_ID, value);
+  }
+
+  public long getAgeMs() {
+    return this.ageMs;
+  }
+
+  public ConnectionMetrics setAgeMs(long ageMs) {
+    this.ageMs = ageMs;
+    setAgeMsIsSet(true);
+    return this;
+  }
+
+  public void unsetAgeMs() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __AGEMS_ISSET_ID);
+  }
+
+  /** Returns true if field ageMs is set (has been assigned a value) and false otherwise */
+  public boolean isSetAgeMs() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __AGEMS_ISSET_ID);
+  }
+
+  public void setAgeMsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __AGEMS_ISSET_ID, value);
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case ID:
+      if (value == null) {
+        unsetId();
+      } else {
+        setId((java.lang.Integer)value);
+      }
+      break;
+
+    case CALLS:
+      if (value == null) {
+        unsetCalls();
+      } else {
+        setCalls((java.lang.Long)value);
+      }
+      break;
+
+    case BYTES_IN:
+      if (value == null) {
+        unsetBytesIn();
+      } else {
+        setBytesIn((java.lang.Long)value);
+      }
+      break;
+
+    case BYTES_OUT:
+      if (value == null) {
+        unsetBytesOut();
+      } else {
+        setBytesOut((java.lang.Long)value);
+      }
+      break;
+
+    case AGE_MS:
+      if (value == null) {
+        unsetAgeMs();
+      } else {
+        setAgeMs((java.lang.Long)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case ID:
+      return getId();
+
+    case CALLS:
+      return getCalls();
+
+    case BYTES_IN:
+      return getBytesIn();
+
+    case BYTES_OUT:
+      return getBytesOut();
+
+    case AGE_MS:
+      return getAgeMs();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case ID:
+      return isSetId();
+    case CALLS:
+      return isSetCalls();
+    case BYTES_IN:
+      return isSetBytesIn();
+    case BYTES_OUT:
+      return isSetBytesOut();
+    case AGE_MS:
+      return isSetAgeMs();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof ConnectionMetrics)
+      return this.equals((ConnectionMetrics)that);
+    return false;
+  }
+
+  public boolean equals(ConnectionMetrics that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_id = true;
+    boolean that_present_id = true;
+    if (this_present_id || that_present_id) {
+      if (!(this_present_id && that_present_id))
+        return false;
+      if (this.id != that.id)
+        return false;
+    }
+
+    boolean this_present_calls = true;
+    boolean that_present_calls = true;
+    if (this_present_calls || that_present_calls) {
+      if (!(this_present_calls && that_present_calls))
+        return false;
+      if (this.calls != that.calls)
+        return false;
+    }
+
+    boolean this_present_bytesIn = true;
+    boolean that_present_bytesIn = true;
+    if (this_present_bytesIn || that_present_bytesIn) {
+      if (!(this_present_bytesIn && that_present_bytesIn))
+        return false;
+      if (this.bytesIn != that.bytesIn)
+        return false;
+    }
+
+    boolean this_present_bytesOut = true;
+    boolean that_present_bytesOut = true;
+    if (this_present_bytesOut || that_present_bytesOut) {
+      if (!(this_present_bytesOut && that_present_bytesOut))
+        return false;
+      if (this.bytesOut != that.bytesOut)
+        return false;
+    }
+
+    boolean this_present_ageMs = true;
+    boolean that_present_ageMs = true;
+    if (this_present_ageMs || that_present_ageMs) {
+      if (!(this_present_ageMs && that_present_ageMs))
+        return false;
+      if (this.ageMs != that.ageMs)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + id;
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(calls);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(bytesIn);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(bytesOut);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(ageMs);
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(ConnectionMetrics other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetId(), other.isSetId());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetId()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.id, other.id);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetCalls(), other.isSetCalls());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetCalls()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.calls, other.calls);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetBytesIn(), other.isSetBytesIn());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetBytesIn()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bytesIn, other.bytesIn);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetBytesOut(), other.isSetBytesOut());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetBytesOut()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bytesOut, other.bytesOut);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetAgeMs(), other.isSetAgeMs());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetAgeMs()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.ageMs, other.ageMs);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("ConnectionMetrics(");
+    boolean first = true;
+
+    sb.append("id:");
+    sb.append(this.id);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("calls:");
+    sb.append(this.calls);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("bytesIn:");
+    sb.append(this.bytesIn);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("bytesOut:");
+    sb.append(this.bytesOut);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("ageMs:");
+    sb.append(this.ageMs);
+    first = false;
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    // alas, we cannot check 'id' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'calls' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'bytesIn' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'bytesOut' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'ageMs' because it's a primitive and you chose the non-beans generator.
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bitfield = 0;
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class ConnectionMetricsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ConnectionMetricsStandardScheme getScheme() {
+      return new ConnectionMetricsStandardScheme();
+    }
+  }
+
+  private static class ConnectionMetricsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ConnectionMetrics> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, ConnectionMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // ID
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.id = iprot.readI32();
+              struct.setIdIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // CALLS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.calls = iprot.readI64();
+              struct.setCallsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 3: // BYTES_IN
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.bytesIn = iprot.readI64();
+              struct.setBytesInIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 4: // BYTES_OUT
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.bytesOut = iprot.readI64();
+              struct.setBytesOutIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 5: // AGE_MS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.ageMs = iprot.readI64();
+              struct.setAgeMsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      if (!struct.isSetId()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'id' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetCalls()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'calls' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetBytesIn()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'bytesIn' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetBytesOut()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'bytesOut' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetAgeMs()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'ageMs' was not found in serialized data! Struct: " + toString());
+      }
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, ConnectionMetrics struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      oprot.writeFieldBegin(ID_FIELD_DESC);
+      oprot.writeI32(struct.id);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(CALLS_FIELD_DESC);
+      oprot.writeI64(struct.calls);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(BYTES_IN_FIELD_DESC);
+      oprot.writeI64(struct.bytesIn);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(BYTES_OUT_FIELD_DESC);
+      oprot.writeI64(struct.bytesOut);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(AGE_MS_FIELD_DESC);
+      oprot.writeI64(struct.ageMs);
+      oprot.writeFieldEnd();
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class ConnectionMetricsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ConnectionMetricsTupleScheme getScheme() {
+      return new ConnectionMetricsTupleScheme();
+    }
+  }
+
+  private static class ConnectionMetricsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ConnectionMetrics> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, ConnectionMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      oprot.writeI32(struct.id);
+      oprot.writeI64(struct.calls);
+      oprot.writeI64(struct.bytesIn);
+      oprot.writeI64(struct.bytesOut);
+      oprot.writeI64(struct.ageMs);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, ConnectionMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      struct.id = iprot.readI32();
+      struct.setIdIsSet(true);
+      struct.calls = iprot.readI64();
+      struct.setCallsIsSet(true);
+      struct.bytesIn = iprot.readI64();
+      struct.setBytesInIsSet(true);
+      struct.bytesOut = iprot.readI64();
+      struct.setBytesOutIsSet(true);
+      struct.ageMs = iprot.readI64();
+      struct.setAgeMsIsSet(true);
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
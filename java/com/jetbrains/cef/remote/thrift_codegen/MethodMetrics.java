@@ -0,0 +1,1435 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class MethodMetrics implements org.apache.thrift.TBase<MethodMetrics, MethodMetrics._Fields>, java.io.Serializable, Cloneable, Comparable<MethodMetrics> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("MethodMetrics");
+
+  private static final org.apache.thrift.protocol.TField NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("name", org.apache.thrift.protocol.TType.STRING, (short)1);
+  private static final org.apache.thrift.protocol.TField CALLS_FIELD_DESC = new org.apache.thrift.protocol.TField("calls", org.apache.thrift.protocol.TType.I64, (short)2);
+  private static final org.apache.thrift.protocol.TField ERRORS_FIELD_DESC = new org.apache.thrift.protocol.TField("errors", org.apache.thrift.protocol.TType.I64, (short)3);
+  private static final org.apache.thrift.protocol.TField TOTAL_US_FIELD_DESC = new org.apache.thrift.protocol.TField("totalUs", org.apache.thrift.protocol.TType.I64, (short)4);
+  private static final org.apache.thrift.protocol.TField MAX_US_FIELD_DESC = new org.apache.thrift.protocol.TField("maxUs", org.apache.thrift.protocol.TType.I64, (short)5);
+  private static final org.apache.thrift.protocol.TField P50_US_FIELD_DESC = new org.apache.thrift.protocol.TField("p50Us", org.apache.thrift.protocol.TType.I64, (short)6);
+  private static final org.apache.thrift.protocol.TField P99_US_FIELD_DESC = new org.apache.thrift.protocol.TField("p99Us", org.apache.thrift.protocol.TType.I64, (short)7);
+  private static final org.apache.thrift.protocol.TField P999_US_FIELD_DESC = new org.apache.thrift.protocol.TField("p999Us", org.apache.thrift.protocol.TType.I64, (short)8);
+  private static final org.apache.thrift.protocol.TField BYTES_IN_FIELD_DESC = new org.apache.thrift.protocol.TField("bytesIn", org.apache.thrift.protocol.TType.I64, (short)9);
+  private static final org.apache.thrift.protocol.TField BYTES_OUT_FIELD_DESC = new org.apache.thrift.protocol.TField("bytesOut", org.apache.thrift.protocol.TType.I64, (short)10);
+  private static final org.apache.thrift.protocol.TField IN_FLIGHT_FIELD_DESC = new org.apache.thrift.protocol.TField("inFlight", org.apache.thrift.protocol.TType.I32, (short)11);
+  private static final org.apache.thrift.protocol.TField MAX_IN_FLIGHT_FIELD_DESC = new org.apache.thrift.protocol.TField("maxInFlight", org.apache.thrift.protocol.TType.I32, (short)12);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new MethodMetricsStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new MethodMetricsTupleSchemeFactory();
+
+  public @org.apache.thrift.annotation.Nullable java.lang.String name; // required
+  public long calls; // required
+  public long errors; // required
+  public long totalUs; // required
+  public long maxUs; // required
+  public long p50Us; // required
+  public long p99Us; // required
+  public long p999Us; // required
+  public long bytesIn; // optional
+  public long bytesOut; // optional
+  public int inFlight; // optional
+  public int maxInFlight; // optional
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    NAME((short)1, "name"),
+    CALLS((short)2, "calls"),
+    ERRORS((short)3, "errors"),
+    TOTAL_US((short)4, "totalUs"),
+    MAX_US((short)5, "maxUs"),
+    P50_US((short)6, "p50Us"),
+    P99_US((short)7, "p99Us"),
+    P999_US((short)8, "p999Us"),
+    BYTES_IN((short)9, "bytesIn"),
+    BYTES_OUT((short)10, "bytesOut"),
+    IN_FLIGHT((short)11, "inFlight"),
+    MAX_IN_FLIGHT((short)12, "maxInFlight");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // NAME
+          return NAME;
+        case 2: // CALLS
+          return CALLS;
+        case 3: // ERRORS
+          return ERRORS;
+        case 4: // TOTAL_US
+          return TOTAL_US;
+        case 5: // MAX_US
+          return MAX_US;
+        case 6: // P50_US
+          return P50_US;
+        case 7: // P99_US
+          return P99_US;
+        case 8: // P999_US
+          return P999_US;
+        case 9: // BYTES_IN
+          return BYTES_IN;
+        case 10: // BYTES_OUT
+          return BYTES_OUT;
+        case 11: // IN_FLIGHT
+          return IN_FLIGHT;
+        case 12: // MAX_IN_FLIGHT
+          return MAX_IN_FLIGHT;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __CALLS_ISSET_ID = 0;
+  private static final int __ERRORS_ISSET_ID = 1;
+  private static final int __TOTALUS_ISSET_ID = 2;
+  private static final int __MAXUS_ISSET_ID = 3;
+  private static final int __P50US_ISSET_ID = 4;
+  private static final int __P99US_ISSET_ID = 5;
+  private static final int __P999US_ISSET_ID = 6;
+  private static final int __BYTESIN_ISSET_ID = 7;
+  private static final int __BYTESOUT_ISSET_ID = 8;
+  private static final int __INFLIGHT_ISSET_ID = 9;
+  private static final int __MAXINFLIGHT_ISSET_ID = 10;
+  private short __isset_bitfield = 0;
+  private static final _Fields optionals[] = {_Fields.BYTES_IN,_Fields.BYTES_OUT,_Fields.IN_FLIGHT,_Fields.MAX_IN_FLIGHT};
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.NAME, new org.apache.thrift.meta_data.FieldMetaData("name", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.CALLS, new org.apache.thrift.meta_data.FieldMetaData("calls", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.ERRORS, new org.apache.thrift.meta_data.FieldMetaData("errors", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.TOTAL_US, new org.apache.thrift.meta_data.FieldMetaData("totalUs", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.MAX_US, new org.apache.thrift.meta_data.FieldMetaData("maxUs", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.P50_US, new org.apache.thrift.meta_data.FieldMetaData("p50Us", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.P99_US, new org.apache.thrift.meta_data.FieldMetaData("p99Us", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.P999_US, new org.apache.thrift.meta_data.FieldMetaData("p999Us", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.BYTES_IN, new org.apache.thrift.meta_data.FieldMetaData("bytesIn", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.BYTES_OUT, new org.apache.thrift.meta_data.FieldMetaData("bytesOut", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.IN_FLIGHT, new org.apache.thrift.meta_data.FieldMetaData("inFlight", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.MAX_IN_FLIGHT, new org.apache.thrift.meta_data.FieldMetaData("maxInFlight", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(MethodMetrics.class, metaDataMap);
+  }
+
+  public MethodMetrics() {
+  }
+
+  public MethodMetrics(
+    java.lang.String name,
+    long calls,
+    long errors,
+    long totalUs,
+    long maxUs,
+    long p50Us,
+    long p99Us,
+    long p999Us)
+  {
+    this();
+    this.name = name;
+    this.calls = calls;
+    setCallsIsSet(true);
+    this.errors = errors;
+    setErrorsIsSet(true);
+    this.totalUs = totalUs;
+    setTotalUsIsSet(true);
+    this.maxUs = maxUs;
+    setMaxUsIsSet(true);
+    this.p50Us = p50Us;
+    setP50UsIsSet(true);
+    this.p99Us = p99Us;
+    setP99UsIsSet(true);
+    this.p999Us = p999Us;
+    setP999UsIsSet(true);
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public MethodMetrics(MethodMetrics other) {
+    __isset_bitfield = other.__isset_bitfield;
+    if (other.isSetName()) {
+      this.name = other.name;
+    }
+    this.calls = other.calls;
+    this.errors = other.errors;
+    this.totalUs = other.totalUs;
+    this.maxUs = other.maxUs;
+    this.p50Us = other.p50Us;
+    this.p99Us = other.p99Us;
+    this.p999Us = other.p999Us;
+    this.bytesIn = other.bytesIn;
+    this.bytesOut = other.bytesOut;
+    this.inFlight = other.inFlight;
+    this.maxInFlight = other.maxInFlight;
+  }
+
+  @Override
+  public MethodMetrics deepCopy() {
+    return new MethodMetrics(this);
+  }
+
+  @Override
+  public void clear() {
+    this.name = null;
+    setCallsIsSet(false);
+    this.calls = 0;
+    setErrorsIsSet(false);
+    this.errors = 0;
+    setTotalUsIsSet(false);
+    this.totalUs = 0;
+    setMaxUsIsSet(false);
+    this.maxUs = 0;
+    setP50UsIsSet(false);
+    this.p50Us = 0;
+    setP99UsIsSet(false);
+    this.p99Us = 0;
+    setP999UsIsSet(false);
+    this.p999Us = 0;
+    setBytesInIsSet(false);
+    this.bytesIn = 0;
+    setBytesOutIsSet(false);
+    this.bytesOut = 0;
+    setInFlightIsSet(false);
+    this.inFlight = 0;
+    setMaxInFlightIsSet(false);
+    this.maxInFlight = 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getName() {
+    return this.name;
+  }
+
+  public MethodMetrics setName(@org.apache.thrift.annotation.Nullable java.lang.String name) {
+    this.name = name;
+    return this;
+  }
+
+  public void unsetName() {
+    this.name = null;
+  }
+
+  /** Returns true if field name is set (has been assigned a value) and false otherwise */
+  public boolean isSetName() {
+    return this.name != null;
+  }
+
+  public void setNameIsSet(boolean value) {
+    if (!value) {
+      this.name = null;
+    }
+  }
+
+  public long getCalls() {
+    return this.calls;
+  }
+
+  public MethodMetrics setCalls(long calls) {
+    this.calls = calls;
+    setCallsIsSet(true);
+    return this;
+  }
+
+  public void unsetCalls() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __CALLS_ISSET_ID);
+  }
+
+  /** Returns true if field calls is set (has been assigned a value) and false otherwise */
+  public boolean isSetCalls() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __CALLS_ISSET_ID);
+  }
+
+  public void setCallsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __CALLS_ISSET_ID, value);
+  }
+
+  public long getErrors() {
+    return this.errors;
+  }
+
+  public MethodMetrics setErrors(long errors) {
+    this.errors = errors;
+    setErrorsIsSet(true);
+    return this;
+  }
+
+  public void unsetErrors() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ERRORS_ISSET_ID);
+  }
+
+  /** Returns true if field errors is set (has been assigned a value) and false otherwise */
+  public boolean isSetErrors() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ERRORS_ISSET_ID);
+  }
+
+  public void setErrorsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ERRORS_ISSET_ID, value);
+  }
+
+  public long getTotalUs() {
+    return this.totalUs;
+  }
+
+  public MethodMetrics setTotalUs(long totalUs) {
+    this.totalUs = totalUs;
+    setTotalUsIsSet(true);
+    return this;
+  }
+
+  public void unsetTotalUs() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __TOTALUS_ISSET_ID);
+  }
+
+  /** Returns true if field totalUs is set (has been assigned a value) and false otherwise */
+  public boolean isSetTotalUs() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __TOTALUS_ISSET_ID);
+  }
+
+  public void setTotalUsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __TOTALUS_ISSET_ID, value);
+  }
+
+  public long getMaxUs() {
+    return this.maxUs;
+  }
+
+  public MethodMetrics setMaxUs(long maxUs) {
+    this.maxUs = maxUs;
+    setMaxUsIsSet(true);
+    return this;
+  }
+
+  public void unsetMaxUs() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __MAXUS_ISSET_ID);
+  }
+
+  /** Returns true if field maxUs is set (has been assigned a value) and false otherwise */
+  public boolean isSetMaxUs() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __MAXUS_ISSET_ID);
+  }
+
+  public void setMaxUsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __MAXUS_ISSET_ID, value);
+  }
+
+  public long getP50Us() {
+    return this.p50Us;
+  }
+
+  public MethodMetrics setP50Us(long p50Us) {
+    this.p50Us = p50Us;
+    setP50UsIsSet(true);
+    return this;
+  }
+
+  public void unsetP50Us() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __P50US_ISSET_ID);
+  }
+
+  /** Returns true if field p50Us is set (has been assigned a value) and false otherwise */
+  public boolean isSetP50Us() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __P50US_ISSET_ID);
+  }
+
+  public void setP50UsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __P50US_ISSET_ID, value);
+  }
+
+  public long getP99Us() {
+    return this.p99Us;
+  }
+
+  public MethodMetrics setP99Us(long p99Us) {
+    this.p99Us = p99Us;
+    setP99UsIsSet(true);
+    return this;
+  }
+
+  public void unsetP99Us() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __P99US_ISSET_ID);
+  }
+
+  /** Returns true if field p99Us is set (has been assigned a value) and false otherwise */
+  public boolean isSetP99Us() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __P99US_ISSET_ID);
+  }
+
+  public void setP99UsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __P99US_ISSET_ID, value);
+  }
+
+  public long getP999Us() {
+    return this.p999Us;
+  }
+
+  public MethodMetrics setP999Us(long p999Us) {
+    this.p999Us = p999Us;
+    setP999UsIsSet(true);
+    return this;
+  }
+
+  public void unsetP999Us() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __P999US_ISSET_ID);
+  }
+
+  /** Returns true if field p999Us is set (has been assigned a value) and false otherwise */
+  public boolean isSetP999Us() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __P999US_ISSET_ID);
+  }
+
+  public void setP999UsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __P999US_ISSET_ID, value);
+  }
+
+  public long getBytesIn() {
+    return this.bytesIn;
+  }
+
+  public MethodMetrics setBytesIn(long bytesIn) {
+    this.bytesIn = bytesIn;
+    setBytesInIsSet(true);
+    return this;
+  }
+
+  public void unsetBytesIn() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BYTESIN_ISSET_ID);
+  }
+
+  /** Returns true if field bytesIn is set (has been assigned a value) and false otherwise */
+  public boolean isSetBytesIn() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BYTESIN_ISSET_ID);
+  }
+
+  public void setBytesInIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BYTESIN_ISSET_ID, value);
+  }
+
+  public long getBytesOut() {
+    return this.bytesOut;
+  }
+
+  public MethodMetrics setBytesOut(long bytesOut) {
+    this.bytesOut = bytesOut;
+    setBytesOutIsSet(true);
+    return this;
+  }
+
+  public void unsetBytesOut() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BYTESOUT_ISSET_ID);
+  }
+
+  /** Returns true if field bytesOut is set (has been assigned a value) and false otherwise */
+  public boolean isSetBytesOut() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BYTESOUT_ISSET_ID);
+  }
+
+  public void setBytesOutIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BYTESOUT_ISSET_ID, value);
+  }
+
+  public int getInFlight() {
+    return this.inFlight;
+  }
+
+  public MethodMetrics setInFlight(int inFlight) {
+    this.inFlight = inFlight;
+    setInFlightIsSet(true);
+    return this;
+  }
+
+  public void unsetInFlight() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __INFLIGHT_ISSET_ID);
+  }
+
+  /** Returns true if field inFlight is set (has been assigned a value) and false otherwise */
+  public boolean isSetInFlight() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __INFLIGHT_ISSET_ID);
+  }
+
+  public void setInFlightIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __INFLIGHT_ISSET_ID, value);
+  }
+
+  public int getMaxInFlight() {
+    return this.maxInFlight;
+  }
+
+  public MethodMetrics setMaxInFlight(int maxInFlight) {
+    this.maxInFlight = maxInFlight;
+    setMaxInFlightIsSet(true);
+    return this;
+  }
+
+  public void unsetMaxInFlight() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __MAXINFLIGHT_ISSET_ID);
+  }
+
+  /** Returns true if field maxInFlight is set (has been assigned a value) and false otherwise */
+  public boolean isSetMaxInFlight() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __MAXINFLIGHT_ISSET_ID);
+  }
+
+  public void setMaxInFlightIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __MAXINFLIGHT_ISSET_ID, value);
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case NAME:
+      if (value == null) {
+        unsetName();
+      } else {
+        setName((java.lang.String)value);
+      }
+      break;
+
+    case CALLS:
+      if (value == null) {
+        unsetCalls();
+      } else {
+        setCalls((java.lang.Long)value);
+      }
+      break;
+
+    case ERRORS:
+      if (value == null) {
+        unsetErrors();
+      } else {
+        setErrors((java.lang.Long)value);
+      }
+      break;
+
+    case TOTAL_US:
+      if (value == null) {
+        unsetTotalUs();
+      } else {
+        setTotalUs((java.lang.Long)value);
+      }
+      break;
+
+    case MAX_US:
+      if (value == null) {
+        unsetMaxUs();
+      } else {
+        setMaxUs((java.lang.Long)value);
+      }
+      break;
+
+    case P50_US:
+      if (value == null) {
+        unsetP50Us();
+      } else {
+        setP50Us((java.lang.Long)value);
+      }
+      break;
+
+    case P99_US:
+      if (value == null) {
+        unsetP99Us();
+      } else {
+        setP99Us((java.lang.Long)value);
+      }
+      break;
+
+    case P999_US:
+      if (value == null) {
+        unsetP999Us();
+      } else {
+        setP999Us((java.lang.Long)value);
+      }
+      break;
+
+    case BYTES_IN:
+      if (value == null) {
+        unsetBytesIn();
+      } else {
+        setBytesIn((java.lang.Long)value);
+      }
+      break;
+
+    case BYTES_OUT:
+      if (value == null) {
+        unsetBytesOut();
+      } else {
+        setBytesOut((java.lang.Long)value);
+      }
+      break;
+
+    case IN_FLIGHT:
+      if (value == null) {
+        unsetInFlight();
+      } else {
+        setInFlight((java.lang.Integer)value);
+      }
+      break;
+
+    case MAX_IN_FLIGHT:
+      if (value == null) {
+        unsetMaxInFlight();
+      } else {
+        setMaxInFlight((java.lang.Integer)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case NAME:
+      return getName();
+
+    case CALLS:
+      return getCalls();
+
+    case ERRORS:
+      return getErrors();
+
+    case TOTAL_US:
+      return getTotalUs();
+
+    case MAX_US:
+      return getMaxUs();
+
+    case P50_US:
+      return getP50Us();
+
+    case P99_US:
+      return getP99Us();
+
+    case P999_US:
+      return getP999Us();
+
+    case BYTES_IN:
+      return getBytesIn();
+
+    case BYTES_OUT:
+      return getBytesOut();
+
+    case IN_FLIGHT:
+      return getInFlight();
+
+    case MAX_IN_FLIGHT:
+      return getMaxInFlight();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case NAME:
+      return isSetName();
+    case CALLS:
+      return isSetCalls();
+    case ERRORS:
+      return isSetErrors();
+    case TOTAL_US:
+      return isSetTotalUs();
+    case MAX_US:
+      return isSetMaxUs();
+    case P50_US:
+      return isSetP50Us();
+    case P99_US:
+      return isSetP99Us();
+    case P999_US:
+      return isSetP999Us();
+    case BYTES_IN:
+      return isSetBytesIn();
+    case BYTES_OUT:
+      return isSetBytesOut();
+    case IN_FLIGHT:
+      return isSetInFlight();
+    case MAX_IN_FLIGHT:
+      return isSetMaxInFlight();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof MethodMetrics)
+      return this.equals((MethodMetrics)that);
+    return false;
+  }
+
+  public boolean equals(MethodMetrics that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_name = true && this.isSetName();
+    boolean that_present_name = true && that.isSetName();
+    if (this_present_name || that_present_name) {
+      if (!(this_present_name && that_present_name))
+        return false;
+      if (!this.name.equals(that.name))
+        return false;
+    }
+
+    boolean this_present_calls = true;
+    boolean that_present_calls = true;
+    if (this_present_calls || that_present_calls) {
+      if (!(this_present_calls && that_present_calls))
+        return false;
+      if (this.calls != that.calls)
+        return false;
+    }
+
+    boolean this_present_errors = true;
+    boolean that_present_errors = true;
+    if (this_present_errors || that_present_errors) {
+      if (!(this_present_errors && that_present_errors))
+        return false;
+      if (this.errors != that.errors)
+        return false;
+    }
+
+    boolean this_present_totalUs = true;
+    boolean that_present_totalUs = true;
+    if (this_present_totalUs || that_present_totalUs) {
+      if (!(this_present_totalUs && that_present_totalUs))
+        return false;
+      if (this.totalUs != that.totalUs)
+        return false;
+    }
+
+    boolean this_present_maxUs = true;
+    boolean that_present_maxUs = true;
+    if (this_present_maxUs || that_present_maxUs) {
+      if (!(this_present_maxUs && that_present_maxUs))
+        return false;
+      if (this.maxUs != that.maxUs)
+        return false;
+    }
+
+    boolean this_present_p50Us = true;
+    boolean that_present_p50Us = true;
+    if (this_present_p50Us || that_present_p50Us) {
+      if (!(this_present_p50Us && that_present_p50Us))
+        return false;
+      if (this.p50Us != that.p50Us)
+        return false;
+    }
+
+    boolean this_present_p99Us = true;
+    boolean that_present_p99Us = true;
+    if (this_present_p99Us || that_present_p99Us) {
+      if (!(this_present_p99Us && that_present_p99Us))
+        return false;
+      if (this.p99Us != that.p99Us)
+        return false;
+    }
+
+    boolean this_present_p999Us = true;
+    boolean that_present_p999Us = true;
+    if (this_present_p999Us || that_present_p999Us) {
+      if (!(this_present_p999Us && that_present_p999Us))
+        return false;
+      if (this.p999Us != that.p999Us)
+        return false;
+    }
+
+    boolean this_present_bytesIn = true && this.isSetBytesIn();
+    boolean that_present_bytesIn = true && that.isSetBytesIn();
+    if (this_present_bytesIn || that_present_bytesIn) {
+      if (!(this_present_bytesIn && that_present_bytesIn))
+        return false;
+      if (this.bytesIn != that.bytesIn)
+        return false;
+    }
+
+    boolean this_present_bytesOut = true && this.isSetBytesOut();
+    boolean that_present_bytesOut = true && that.isSetBytesOut();
+    if (this_present_bytesOut || that_present_bytesOut) {
+      if (!(this_present_bytesOut && that_present_bytesOut))
+        return false;
+      if (this.bytesOut != that.bytesOut)
+        return false;
+    }
+
+    boolean this_present_inFlight = true && this.isSetInFlight();
+    boolean that_present_inFlight = true && that.isSetInFlight();
+    if (this_present_inFlight || that_present_inFlight) {
+      if (!(this_present_inFlight && that_present_inFlight))
+        return false;
+      if (this.inFlight != that.inFlight)
+        return false;
+    }
+
+    boolean this_present_maxInFlight = true && this.isSetMaxInFlight();
+    boolean that_present_maxInFlight = true && that.isSetMaxInFlight();
+    if (this_present_maxInFlight || that_present_maxInFlight) {
+      if (!(this_present_maxInFlight && that_present_maxInFlight))
+        return false;
+      if (this.maxInFlight != that.maxInFlight)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + ((isSetName()) ? 131071 : 524287);
+    if (isSetName())
+      hashCode = hashCode * 8191 + name.hashCode();
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(calls);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(errors);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(totalUs);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(maxUs);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(p50Us);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(p99Us);
+
+    hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(p999Us);
+
+    hashCode = hashCode * 8191 + ((isSetBytesIn()) ? 131071 : 524287);
+    if (isSetBytesIn())
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(bytesIn);
+
+    hashCode = hashCode * 8191 + ((isSetBytesOut()) ? 131071 : 524287);
+    if (isSetBytesOut())
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(bytesOut);
+
+    hashCode = hashCode * 8191 + ((isSetInFlight()) ? 131071 : 524287);
+    if (isSetInFlight())
+      hashCode = hashCode * 8191 + inFlight;
+
+    hashCode = hashCode * 8191 + ((isSetMaxInFlight()) ? 131071 : 524287);
+    if (isSetMaxInFlight())
+      hashCode = hashCode * 8191 + maxInFlight;
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(MethodMetrics other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetName(), other.isSetName());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetName()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.name, other.name);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetCalls(), other.isSetCalls());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetCalls()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.calls, other.calls);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetErrors(), other.isSetErrors());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetErrors()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.errors, other.errors);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetTotalUs(), other.isSetTotalUs());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetTotalUs()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.totalUs, other.totalUs);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetMaxUs(), other.isSetMaxUs());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetMaxUs()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.maxUs, other.maxUs);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetP50Us(), other.isSetP50Us());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetP50Us()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.p50Us, other.p50Us);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetP99Us(), other.isSetP99Us());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetP99Us()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.p99Us, other.p99Us);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetP999Us(), other.isSetP999Us());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetP999Us()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.p999Us, other.p999Us);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetBytesIn(), other.isSetBytesIn());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetBytesIn()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bytesIn, other.bytesIn);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetBytesOut(), other.isSetBytesOut());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetBytesOut()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bytesOut, other.bytesOut);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetInFlight(), other.isSetInFlight());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetInFlight()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.inFlight, other.inFlight);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetMaxInFlight(), other.isSetMaxInFlight());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetMaxInFlight()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.maxInFlight, other.maxInFlight);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("MethodMetrics(");
+    boolean first = true;
+
+    sb.append("name:");
+    if (this.name == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.name);
+    }
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("calls:");
+    sb.append(this.calls);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("errors:");
+    sb.append(this.errors);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("totalUs:");
+    sb.append(this.totalUs);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("maxUs:");
+    sb.append(this.maxUs);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("p50Us:");
+    sb.append(this.p50Us);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("p99Us:");
+    sb.append(this.p99Us);
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("p999Us:");
+    sb.append(this.p999Us);
+    first = false;
+    if (isSetBytesIn()) {
+      if (!first) sb.append(", ");
+      sb.append("bytesIn:");
+      sb.append(this.bytesIn);
+      first = false;
+    }
+    if (isSetBytesOut()) {
+      if (!first) sb.append(", ");
+      sb.append("bytesOut:");
+      sb.append(this.bytesOut);
+      first = false;
+    }
+    if (isSetInFlight()) {
+      if (!first) sb.append(", ");
+      sb.append("inFlight:");
+      sb.append(this.inFlight);
+      first = false;
+    }
+    if (isSetMaxInFlight()) {
+      if (!first) sb.append(", ");
+      sb.append("maxInFlight:");
+      sb.append(this.maxInFlight);
+      first = false;
+    }
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    if (name == null) {
+      throw new org.apache.thrift.protocol.TProtocolException("Required field 'name' was not present! Struct: " + toString());
+    }
+    // alas, we cannot check 'calls' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'errors' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'totalUs' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'maxUs' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'p50Us' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'p99Us' because it's a primitive and you chose the non-beans generator.
+    // alas, we cannot check 'p999Us' because it's a primitive and you chose the non-beans generator.
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bitfield = 0;
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class MethodMetricsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public MethodMetricsStandardScheme getScheme() {
+      return new MethodMetricsStandardScheme();
+    }
+  }
+
+  private static class MethodMetricsStandardScheme extends org.apache.thrift.scheme.StandardScheme<MethodMetrics> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, MethodMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // NAME
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.name = iprot.readString();
+              struct.setNameIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // CALLS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.calls = iprot.readI64();
+              struct.setCallsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 3: // ERRORS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.errors = iprot.readI64();
+              struct.setErrorsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 4: // TOTAL_US
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.totalUs = iprot.readI64();
+              struct.setTotalUsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 5: // MAX_US
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.maxUs = iprot.readI64();
+              struct.setMaxUsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 6: // P50_US
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.p50Us = iprot.readI64();
+              struct.setP50UsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 7: // P99_US
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.p99Us = iprot.readI64();
+              struct.setP99UsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 8: // P999_US
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.p999Us = iprot.readI64();
+              struct.setP999UsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 9: // BYTES_IN
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.bytesIn = iprot.readI64();
+              struct.setBytesInIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 10: // BYTES_OUT
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.bytesOut = iprot.readI64();
+              struct.setBytesOutIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 11: // IN_FLIGHT
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.inFlight = iprot.readI32();
+              struct.setInFlightIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 12: // MAX_IN_FLIGHT
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.maxInFlight = iprot.readI32();
+              struct.setMaxInFlightIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      if (!struct.isSetCalls()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'calls' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetErrors()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'errors' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetTotalUs()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'totalUs' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetMaxUs()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'maxUs' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetP50Us()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'p50Us' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetP99Us()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'p99Us' was not found in serialized data! Struct: " + toString());
+      }
+      if (!struct.isSetP999Us()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'p999Us' was not found in serialized data! Struct: " + toString());
+      }
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, MethodMetrics struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (struct.name != null) {
+        oprot.writeFieldBegin(NAME_FIELD_DESC);
+        oprot.writeString(struct.name);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldBegin(CALLS_FIELD_DESC);
+      oprot.writeI64(struct.calls);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(ERRORS_FIELD_DESC);
+      oprot.writeI64(struct.errors);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(TOTAL_US_FIELD_DESC);
+      oprot.writeI64(struct.totalUs);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(MAX_US_FIELD_DESC);
+      oprot.writeI64(struct.maxUs);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(P50_US_FIELD_DESC);
+      oprot.writeI64(struct.p50Us);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(P99_US_FIELD_DESC);
+      oprot.writeI64(struct.p99Us);
+      oprot.writeFieldEnd();
+      oprot.writeFieldBegin(P999_US_FIELD_DESC);
+      oprot.writeI64(struct.p999Us);
+      oprot.writeFieldEnd();
+      if (struct.isSetBytesIn()) {
+        oprot.writeFieldBegin(BYTES_IN_FIELD_DESC);
+        oprot.writeI64(struct.bytesIn);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetBytesOut()) {
+        oprot.writeFieldBegin(BYTES_OUT_FIELD_DESC);
+        oprot.writeI64(struct.bytesOut);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetInFlight()) {
+        oprot.writeFieldBegin(IN_FLIGHT_FIELD_DESC);
+        oprot.writeI32(struct.inFlight);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetMaxInFlight()) {
+        oprot.writeFieldBegin(MAX_IN_FLIGHT_FIELD_DESC);
+        oprot.writeI32(struct.maxInFlight);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class MethodMetricsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public MethodMetricsTupleScheme getScheme() {
+      return new MethodMetricsTupleScheme();
+    }
+  }
+
+  private static class MethodMetricsTupleScheme extends org.apache.thrift.scheme.TupleScheme<MethodMetrics> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, MethodMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      oprot.writeString(struct.name);
+      oprot.writeI64(struct.calls);
+      oprot.writeI64(struct.errors);
+      oprot.writeI64(struct.totalUs);
+      oprot.writeI64(struct.maxUs);
+      oprot.writeI64(struct.p50Us);
+      oprot.writeI64(struct.p99Us);
+      oprot.writeI64(struct.p999Us);
+      java.util.BitSet optionals = new java.util.BitSet();
+      if (struct.isSetBytesIn()) {
+        optionals.set(0);
+      }
+      if (struct.isSetBytesOut()) {
+        optionals.set(1);
+      }
+      if (struct.isSetInFlight()) {
+        optionals.set(2);
+      }
+      if (struct.isSetMaxInFlight()) {
+        optionals.set(3);
+      }
+      oprot.writeBitSet(optionals, 4);
+      if (struct.isSetBytesIn()) {
+        oprot.writeI64(struct.bytesIn);
+      }
+      if (struct.isSetBytesOut()) {
+        oprot.writeI64(struct.bytesOut);
+      }
+      if (struct.isSetInFlight()) {
+        oprot.writeI32(struct.inFlight);
+      }
+      if (struct.isSetMaxInFlight()) {
+        oprot.writeI32(struct.maxInFlight);
+      }
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, MethodMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      struct.name = iprot.readString();
+      struct.setNameIsSet(true);
+      struct.calls = iprot.readI64();
+      struct.setCallsIsSet(true);
+      struct.errors = iprot.readI64();
+      struct.setErrorsIsSet(true);
+      struct.totalUs = iprot.readI64();
+      struct.setTotalUsIsSet(true);
+      struct.maxUs = iprot.readI64();
+      struct.setMaxUsIsSet(true);
+      struct.p50Us = iprot.readI64();
+      struct.setP50UsIsSet(true);
+      struct.p99Us = iprot.readI64();
+      struct.setP99UsIsSet(true);
+      struct.p999Us = iprot.readI64();
+      struct.setP999UsIsSet(true);
+      java.util.BitSet incoming = iprot.readBitSet(4);
+      if (incoming.get(0)) {
+        struct.bytesIn = iprot.readI64();
+        struct.setBytesInIsSet(true);
+      }
+      if (incoming.get(1)) {
+        struct.bytesOut = iprot.readI64();
+        struct.setBytesOutIsSet(true);
+      }
+      if (incoming.get(2)) {
+        struct.inFlight = iprot.readI32();
+        struct.setInFlightIsSet(true);
+      }
+      if (incoming.get(3)) {
+        struct.maxInFlight = iprot.readI32();
+        struct.setMaxInFlightIsSet(true);
+      }
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
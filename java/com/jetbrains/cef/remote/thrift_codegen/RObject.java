@@ -13,6 +13,8 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
   private static final org.apache.thrift.protocol.TField OBJ_ID_FIELD_DESC = new org.apache.thrift.protocol.TField("objId", org.apache.thrift.protocol.TType.I32, (short)1);
   private static final org.apache.thrift.protocol.TField FLAGS_FIELD_DESC = new org.apache.thrift.protocol.TField("flags", org.apache.thrift.protocol.TType.I32, (short)2);
   private static final org.apache.thrift.protocol.TField OBJ_INFO_FIELD_DESC = new org.apache.thrift.protocol.TField("objInfo", org.apache.thrift.protocol.TType.MAP, (short)3);
+  private static final org.apache.thrift.protocol.TField REQUEST_INFO_FIELD_DESC = new org.apache.thrift.protocol.TField("requestInfo", org.apache.thrift.protocol.TType.STRUCT, (short)4);
+  private static final org.apache.thrift.protocol.TField RESPONSE_INFO_FIELD_DESC = new org.apache.thrift.protocol.TField("responseInfo", org.apache.thrift.protocol.TType.STRUCT, (short)5);
 
   private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RObjectStandardSchemeFactory();
   private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RObjectTupleSchemeFactory();
@@ -20,12 +22,16 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
   public int objId; // required
   public int flags; // optional
   public @org.apache.thrift.annotation.Nullable java.util.Map<java.lang.String,java.lang.String> objInfo; // optional
+  public @org.apache.thrift.annotation.Nullable RequestInfo requestInfo; // optional
+  public @org.apache.thrift.annotation.Nullable ResponseInfo responseInfo; // optional
 
   /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
   public enum _Fields implements org.apache.thrift.TFieldIdEnum {
     OBJ_ID((short)1, "objId"),
     FLAGS((short)2, "flags"),
-    OBJ_INFO((short)3, "objInfo");
+    OBJ_INFO((short)3, "objInfo"),
+    REQUEST_INFO((short)4, "requestInfo"),
+    RESPONSE_INFO((short)5, "responseInfo");
 
     private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -47,6 +53,10 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
           return FLAGS;
         case 3: // OBJ_INFO
           return OBJ_INFO;
+        case 4: // REQUEST_INFO
+          return REQUEST_INFO;
+        case 5: // RESPONSE_INFO
+          return RESPONSE_INFO;
         default:
           return null;
       }
@@ -93,7 +103,7 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
   private static final int __OBJID_ISSET_ID = 0;
   private static final int __FLAGS_ISSET_ID = 1;
   private byte __isset_bitfield = 0;
-  private static final _Fields optionals[] = {_Fields.FLAGS,_Fields.OBJ_INFO};
+  private static final _Fields optionals[] = {_Fields.FLAGS,_Fields.OBJ_INFO,_Fields.REQUEST_INFO,_Fields.RESPONSE_INFO};
   public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
   static {
     java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
@@ -105,6 +115,10 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
         new org.apache.thrift.meta_data.MapMetaData(org.apache.thrift.protocol.TType.MAP, 
             new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING), 
             new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING))));
+    tmpMap.put(_Fields.REQUEST_INFO, new org.apache.thrift.meta_data.FieldMetaData("requestInfo", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, RequestInfo.class)));
+    tmpMap.put(_Fields.RESPONSE_INFO, new org.apache.thrift.meta_data.FieldMetaData("responseInfo", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ResponseInfo.class)));
     metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
     org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RObject.class, metaDataMap);
   }
@@ -131,6 +145,12 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       java.util.Map<java.lang.String,java.lang.String> __this__objInfo = new java.util.HashMap<java.lang.String,java.lang.String>(other.objInfo);
       this.objInfo = __this__objInfo;
     }
+    if (other.isSetRequestInfo()) {
+      this.requestInfo = new RequestInfo(other.requestInfo);
+    }
+    if (other.isSetResponseInfo()) {
+      this.responseInfo = new ResponseInfo(other.responseInfo);
+    }
   }
 
   @Override
@@ -145,6 +165,8 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
     setFlagsIsSet(false);
     this.flags = 0;
     this.objInfo = null;
+    this.requestInfo = null;
+    this.responseInfo = null;
   }
 
   public int getObjId() {
@@ -229,6 +251,56 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
     }
   }
 
+  @org.apache.thrift.annotation.Nullable
+  public RequestInfo getRequestInfo() {
+    return this.requestInfo;
+  }
+
+  public RObject setRequestInfo(@org.apache.thrift.annotation.Nullable RequestInfo requestInfo) {
+    this.requestInfo = requestInfo;
+    return this;
+  }
+
+  public void unsetRequestInfo() {
+    this.requestInfo = null;
+  }
+
+  /** Returns true if field requestInfo is set (has been assigned a value) and false otherwise */
+  public boolean isSetRequestInfo() {
+    return this.requestInfo != null;
+  }
+
+  public void setRequestInfoIsSet(boolean value) {
+    if (!value) {
+      this.requestInfo = null;
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public ResponseInfo getResponseInfo() {
+    return this.responseInfo;
+  }
+
+  public RObject setResponseInfo(@org.apache.thrift.annotation.Nullable ResponseInfo responseInfo) {
+    this.responseInfo = responseInfo;
+    return this;
+  }
+
+  public void unsetResponseInfo() {
+    this.responseInfo = null;
+  }
+
+  /** Returns true if field responseInfo is set (has been assigned a value) and false otherwise */
+  public boolean isSetResponseInfo() {
+    return this.responseInfo != null;
+  }
+
+  public void setResponseInfoIsSet(boolean value) {
+    if (!value) {
+      this.responseInfo = null;
+    }
+  }
+
   @Override
   public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
     switch (field) {
@@ -256,6 +328,22 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       }
       break;
 
+    case REQUEST_INFO:
+      if (value == null) {
+        unsetRequestInfo();
+      } else {
+        setRequestInfo((RequestInfo)value);
+      }
+      break;
+
+    case RESPONSE_INFO:
+      if (value == null) {
+        unsetResponseInfo();
+      } else {
+        setResponseInfo((ResponseInfo)value);
+      }
+      break;
+
     }
   }
 
@@ -272,6 +360,12 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
     case OBJ_INFO:
       return getObjInfo();
 
+    case REQUEST_INFO:
+      return getRequestInfo();
+
+    case RESPONSE_INFO:
+      return getResponseInfo();
+
     }
     throw new java.lang.IllegalStateException();
   }
@@ -290,6 +384,10 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       return isSetFlags();
     case OBJ_INFO:
       return isSetObjInfo();
+    case REQUEST_INFO:
+      return isSetRequestInfo();
+    case RESPONSE_INFO:
+      return isSetResponseInfo();
     }
     throw new java.lang.IllegalStateException();
   }
@@ -334,6 +432,24 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
         return false;
     }
 
+    boolean this_present_requestInfo = true && this.isSetRequestInfo();
+    boolean that_present_requestInfo = true && that.isSetRequestInfo();
+    if (this_present_requestInfo || that_present_requestInfo) {
+      if (!(this_present_requestInfo && that_present_requestInfo))
+        return false;
+      if (!this.requestInfo.equals(that.requestInfo))
+        return false;
+    }
+
+    boolean this_present_responseInfo = true && this.isSetResponseInfo();
+    boolean that_present_responseInfo = true && that.isSetResponseInfo();
+    if (this_present_responseInfo || that_present_responseInfo) {
+      if (!(this_present_responseInfo && that_present_responseInfo))
+        return false;
+      if (!this.responseInfo.equals(that.responseInfo))
+        return false;
+    }
+
     return true;
   }
 
@@ -351,6 +467,14 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
     if (isSetObjInfo())
       hashCode = hashCode * 8191 + objInfo.hashCode();
 
+    hashCode = hashCode * 8191 + ((isSetRequestInfo()) ? 131071 : 524287);
+    if (isSetRequestInfo())
+      hashCode = hashCode * 8191 + requestInfo.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetResponseInfo()) ? 131071 : 524287);
+    if (isSetResponseInfo())
+      hashCode = hashCode * 8191 + responseInfo.hashCode();
+
     return hashCode;
   }
 
@@ -392,6 +516,26 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
         return lastComparison;
       }
     }
+    lastComparison = java.lang.Boolean.compare(isSetRequestInfo(), other.isSetRequestInfo());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetRequestInfo()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.requestInfo, other.requestInfo);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetResponseInfo(), other.isSetResponseInfo());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetResponseInfo()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.responseInfo, other.responseInfo);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
     return 0;
   }
 
@@ -435,6 +579,26 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       }
       first = false;
     }
+    if (isSetRequestInfo()) {
+      if (!first) sb.append(", ");
+      sb.append("requestInfo:");
+      if (this.requestInfo == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.requestInfo);
+      }
+      first = false;
+    }
+    if (isSetResponseInfo()) {
+      if (!first) sb.append(", ");
+      sb.append("responseInfo:");
+      if (this.responseInfo == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.responseInfo);
+      }
+      first = false;
+    }
     sb.append(")");
     return sb.toString();
   }
@@ -443,6 +607,12 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
     // check for required fields
     // alas, we cannot check 'objId' because it's a primitive and you chose the non-beans generator.
     // check for sub-struct validity
+    if (requestInfo != null) {
+      requestInfo.validate();
+    }
+    if (responseInfo != null) {
+      responseInfo.validate();
+    }
   }
 
   private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -519,6 +689,24 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
             }
             break;
+          case 4: // REQUEST_INFO
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+              struct.requestInfo = new RequestInfo();
+              struct.requestInfo.read(iprot);
+              struct.setRequestInfoIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 5: // RESPONSE_INFO
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+              struct.responseInfo = new ResponseInfo();
+              struct.responseInfo.read(iprot);
+              struct.setResponseInfoIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
           default:
             org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
         }
@@ -561,6 +749,20 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
           oprot.writeFieldEnd();
         }
       }
+      if (struct.requestInfo != null) {
+        if (struct.isSetRequestInfo()) {
+          oprot.writeFieldBegin(REQUEST_INFO_FIELD_DESC);
+          struct.requestInfo.write(oprot);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.responseInfo != null) {
+        if (struct.isSetResponseInfo()) {
+          oprot.writeFieldBegin(RESPONSE_INFO_FIELD_DESC);
+          struct.responseInfo.write(oprot);
+          oprot.writeFieldEnd();
+        }
+      }
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
@@ -587,7 +789,13 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       if (struct.isSetObjInfo()) {
         optionals.set(1);
       }
-      oprot.writeBitSet(optionals, 2);
+      if (struct.isSetRequestInfo()) {
+        optionals.set(2);
+      }
+      if (struct.isSetResponseInfo()) {
+        optionals.set(3);
+      }
+      oprot.writeBitSet(optionals, 4);
       if (struct.isSetFlags()) {
         oprot.writeI32(struct.flags);
       }
@@ -601,6 +809,12 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
           }
         }
       }
+      if (struct.isSetRequestInfo()) {
+        struct.requestInfo.write(oprot);
+      }
+      if (struct.isSetResponseInfo()) {
+        struct.responseInfo.write(oprot);
+      }
     }
 
     @Override
@@ -608,7 +822,7 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
       org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
       struct.objId = iprot.readI32();
       struct.setObjIdIsSet(true);
-      java.util.BitSet incoming = iprot.readBitSet(2);
+      java.util.BitSet incoming = iprot.readBitSet(4);
       if (incoming.get(0)) {
         struct.flags = iprot.readI32();
         struct.setFlagsIsSet(true);
@@ -628,6 +842,16 @@ public class RObject implements org.apache.thrift.TBase<RObject, RObject._Fields
         }
         struct.setObjInfoIsSet(true);
       }
+      if (incoming.get(2)) {
+        struct.requestInfo = new RequestInfo();
+        struct.requestInfo.read(iprot);
+        struct.setRequestInfoIsSet(true);
+      }
+      if (incoming.get(3)) {
+        struct.responseInfo = new ResponseInfo();
+        struct.responseInfo.read(iprot);
+        struct.setResponseInfoIsSet(true);
+      }
     }
   }
 
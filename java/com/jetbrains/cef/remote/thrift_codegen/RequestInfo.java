@@ -0,0 +1,1304 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class RequestInfo implements org.apache.thrift.TBase<RequestInfo, RequestInfo._Fields>, java.io.Serializable, Cloneable, Comparable<RequestInfo> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("RequestInfo");
+
+  private static final org.apache.thrift.protocol.TField IDENTIFIER_FIELD_DESC = new org.apache.thrift.protocol.TField("identifier", org.apache.thrift.protocol.TType.I64, (short)1);
+  private static final org.apache.thrift.protocol.TField IS_READ_ONLY_FIELD_DESC = new org.apache.thrift.protocol.TField("isReadOnly", org.apache.thrift.protocol.TType.BOOL, (short)2);
+  private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)3);
+  private static final org.apache.thrift.protocol.TField METHOD_FIELD_DESC = new org.apache.thrift.protocol.TField("method", org.apache.thrift.protocol.TType.STRING, (short)4);
+  private static final org.apache.thrift.protocol.TField REFERRER_URL_FIELD_DESC = new org.apache.thrift.protocol.TField("referrerUrl", org.apache.thrift.protocol.TType.STRING, (short)5);
+  private static final org.apache.thrift.protocol.TField REFERRER_POLICY_FIELD_DESC = new org.apache.thrift.protocol.TField("referrerPolicy", org.apache.thrift.protocol.TType.I32, (short)6);
+  private static final org.apache.thrift.protocol.TField FLAGS_FIELD_DESC = new org.apache.thrift.protocol.TField("flags", org.apache.thrift.protocol.TType.I32, (short)7);
+  private static final org.apache.thrift.protocol.TField FIRST_PARTY_FOR_COOKIES_FIELD_DESC = new org.apache.thrift.protocol.TField("firstPartyForCookies", org.apache.thrift.protocol.TType.STRING, (short)8);
+  private static final org.apache.thrift.protocol.TField RESOURCE_TYPE_FIELD_DESC = new org.apache.thrift.protocol.TField("resourceType", org.apache.thrift.protocol.TType.I32, (short)9);
+  private static final org.apache.thrift.protocol.TField TRANSITION_TYPE_FIELD_DESC = new org.apache.thrift.protocol.TField("transitionType", org.apache.thrift.protocol.TType.I32, (short)10);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new RequestInfoStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new RequestInfoTupleSchemeFactory();
+
+  public long identifier; // optional
+  public boolean isReadOnly; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String url; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String method; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String referrerUrl; // optional
+  public int referrerPolicy; // optional
+  public int flags; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String firstPartyForCookies; // optional
+  public int resourceType; // optional
+  public int transitionType; // optional
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    IDENTIFIER((short)1, "identifier"),
+    IS_READ_ONLY((short)2, "isReadOnly"),
+    URL((short)3, "url"),
+    METHOD((short)4, "method"),
+    REFERRER_URL((short)5, "referrerUrl"),
+    REFERRER_POLICY((short)6, "referrerPolicy"),
+    FLAGS((short)7, "flags"),
+    FIRST_PARTY_FOR_COOKIES((short)8, "firstPartyForCookies"),
+    RESOURCE_TYPE((short)9, "resourceType"),
+    TRANSITION_TYPE((short)10, "transitionType");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // IDENTIFIER
+          return IDENTIFIER;
+        case 2: // IS_READ_ONLY
+          return IS_READ_ONLY;
+        case 3: // URL
+          return URL;
+        case 4: // METHOD
+          return METHOD;
+        case 5: // REFERRER_URL
+          return REFERRER_URL;
+        case 6: // REFERRER_POLICY
+          return REFERRER_POLICY;
+        case 7: // FLAGS
+          return FLAGS;
+        case 8: // FIRST_PARTY_FOR_COOKIES
+          return FIRST_PARTY_FOR_COOKIES;
+        case 9: // RESOURCE_TYPE
+          return RESOURCE_TYPE;
+        case 10: // TRANSITION_TYPE
+          return TRANSITION_TYPE;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __IDENTIFIER_ISSET_ID = 0;
+  private static final int __ISREADONLY_ISSET_ID = 1;
+  private static final int __REFERRERPOLICY_ISSET_ID = 2;
+  private static final int __FLAGS_ISSET_ID = 3;
+  private static final int __RESOURCETYPE_ISSET_ID = 4;
+  private static final int __TRANSITIONTYPE_ISSET_ID = 5;
+  private byte __isset_bitfield = 0;
+  private static final _Fields optionals[] = {_Fields.IDENTIFIER,_Fields.IS_READ_ONLY,_Fields.URL,_Fields.METHOD,_Fields.REFERRER_URL,_Fields.REFERRER_POLICY,_Fields.FLAGS,_Fields.FIRST_PARTY_FOR_COOKIES,_Fields.RESOURCE_TYPE,_Fields.TRANSITION_TYPE};
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.IDENTIFIER, new org.apache.thrift.meta_data.FieldMetaData("identifier", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64)));
+    tmpMap.put(_Fields.IS_READ_ONLY, new org.apache.thrift.meta_data.FieldMetaData("isReadOnly", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+    tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.METHOD, new org.apache.thrift.meta_data.FieldMetaData("method", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.REFERRER_URL, new org.apache.thrift.meta_data.FieldMetaData("referrerUrl", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.REFERRER_POLICY, new org.apache.thrift.meta_data.FieldMetaData("referrerPolicy", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.FLAGS, new org.apache.thrift.meta_data.FieldMetaData("flags", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.FIRST_PARTY_FOR_COOKIES, new org.apache.thrift.meta_data.FieldMetaData("firstPartyForCookies", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.RESOURCE_TYPE, new org.apache.thrift.meta_data.FieldMetaData("resourceType", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.TRANSITION_TYPE, new org.apache.thrift.meta_data.FieldMetaData("transitionType", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(RequestInfo.class, metaDataMap);
+  }
+
+  public RequestInfo() {
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public RequestInfo(RequestInfo other) {
+    __isset_bitfield = other.__isset_bitfield;
+    this.identifier = other.identifier;
+    this.isReadOnly = other.isReadOnly;
+    if (other.isSetUrl()) {
+      this.url = other.url;
+    }
+    if (other.isSetMethod()) {
+      this.method = other.method;
+    }
+    if (other.isSetReferrerUrl()) {
+      this.referrerUrl = other.referrerUrl;
+    }
+    this.referrerPolicy = other.referrerPolicy;
+    this.flags = other.flags;
+    if (other.isSetFirstPartyForCookies()) {
+      this.firstPartyForCookies = other.firstPartyForCookies;
+    }
+    this.resourceType = other.resourceType;
+    this.transitionType = other.transitionType;
+  }
+
+  @Override
+  public RequestInfo deepCopy() {
+    return new RequestInfo(this);
+  }
+
+  @Override
+  public void clear() {
+    setIdentifierIsSet(false);
+    this.identifier = 0;
+    setIsReadOnlyIsSet(false);
+    this.isReadOnly = false;
+    this.url = null;
+    this.method = null;
+    this.referrerUrl = null;
+    setReferrerPolicyIsSet(false);
+    this.referrerPolicy = 0;
+    setFlagsIsSet(false);
+    this.flags = 0;
+    this.firstPartyForCookies = null;
+    setResourceTypeIsSet(false);
+    this.resourceType = 0;
+    setTransitionTypeIsSet(false);
+    this.transitionType = 0;
+  }
+
+  public long getIdentifier() {
+    return this.identifier;
+  }
+
+  public RequestInfo setIdentifier(long identifier) {
+    this.identifier = identifier;
+    setIdentifierIsSet(true);
+    return this;
+  }
+
+  public void unsetIdentifier() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __IDENTIFIER_ISSET_ID);
+  }
+
+  /** Returns true if field identifier is set (has been assigned a value) and false otherwise */
+  public boolean isSetIdentifier() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __IDENTIFIER_ISSET_ID);
+  }
+
+  public void setIdentifierIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __IDENTIFIER_ISSET_ID, value);
+  }
+
+  public boolean isIsReadOnly() {
+    return this.isReadOnly;
+  }
+
+  public RequestInfo setIsReadOnly(boolean isReadOnly) {
+    this.isReadOnly = isReadOnly;
+    setIsReadOnlyIsSet(true);
+    return this;
+  }
+
+  public void unsetIsReadOnly() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ISREADONLY_ISSET_ID);
+  }
+
+  /** Returns true if field isReadOnly is set (has been assigned a value) and false otherwise */
+  public boolean isSetIsReadOnly() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ISREADONLY_ISSET_ID);
+  }
+
+  public void setIsReadOnlyIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ISREADONLY_ISSET_ID, value);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getUrl() {
+    return this.url;
+  }
+
+  public RequestInfo setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
+    this.url = url;
+    return this;
+  }
+
+  public void unsetUrl() {
+    this.url = null;
+  }
+
+  /** Returns true if field url is set (has been assigned a value) and false otherwise */
+  public boolean isSetUrl() {
+    return this.url != null;
+  }
+
+  public void setUrlIsSet(boolean value) {
+    if (!value) {
+      this.url = null;
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getMethod() {
+    return this.method;
+  }
+
+  public RequestInfo setMethod(@org.apache.thrift.annotation.Nullable java.lang.String method) {
+    this.method = method;
+    return this;
+  }
+
+  public void unsetMethod() {
+    this.method = null;
+  }
+
+  /** Returns true if field method is set (has been assigned a value) and false otherwise */
+  public boolean isSetMethod() {
+    return this.method != null;
+  }
+
+  public void setMethodIsSet(boolean value) {
+    if (!value) {
+      this.method = null;
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getReferrerUrl() {
+    return this.referrerUrl;
+  }
+
+  public RequestInfo setReferrerUrl(@org.apache.thrift.annotation.Nullable java.lang.String referrerUrl) {
+    this.referrerUrl = referrerUrl;
+    return this;
+  }
+
+  public void unsetReferrerUrl() {
+    this.referrerUrl = null;
+  }
+
+  /** Returns true if field referrerUrl is set (has been assigned a value) and false otherwise */
+  public boolean isSetReferrerUrl() {
+    return this.referrerUrl != null;
+  }
+
+  public void setReferrerUrlIsSet(boolean value) {
+    if (!value) {
+      this.referrerUrl = null;
+    }
+  }
+
+  public int getReferrerPolicy() {
+    return this.referrerPolicy;
+  }
+
+  public RequestInfo setReferrerPolicy(int referrerPolicy) {
+    this.referrerPolicy = referrerPolicy;
+    setReferrerPolicyIsSet(true);
+    return this;
+  }
+
+  public void unsetReferrerPolicy() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __REFERRERPOLICY_ISSET_ID);
+  }
+
+  /** Returns true if field referrerPolicy is set (has been assigned a value) and false otherwise */
+  public boolean isSetReferrerPolicy() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __REFERRERPOLICY_ISSET_ID);
+  }
+
+  public void setReferrerPolicyIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __REFERRERPOLICY_ISSET_ID, value);
+  }
+
+  public int getFlags() {
+    return this.flags;
+  }
+
+  public RequestInfo setFlags(int flags) {
+    this.flags = flags;
+    setFlagsIsSet(true);
+    return this;
+  }
+
+  public void unsetFlags() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __FLAGS_ISSET_ID);
+  }
+
+  /** Returns true if field flags is set (has been assigned a value) and false otherwise */
+  public boolean isSetFlags() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __FLAGS_ISSET_ID);
+  }
+
+  public void setFlagsIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __FLAGS_ISSET_ID, value);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getFirstPartyForCookies() {
+    return this.firstPartyForCookies;
+  }
+
+  public RequestInfo setFirstPartyForCookies(@org.apache.thrift.annotation.Nullable java.lang.String firstPartyForCookies) {
+    this.firstPartyForCookies = firstPartyForCookies;
+    return this;
+  }
+
+  public void unsetFirstPartyForCookies() {
+    this.firstPartyForCookies = null;
+  }
+
+  /** Returns true if field firstPartyForCookies is set (has been assigned a value) and false otherwise */
+  public boolean isSetFirstPartyForCookies() {
+    return this.firstPartyForCookies != null;
+  }
+
+  public void setFirstPartyForCookiesIsSet(boolean value) {
+    if (!value) {
+      this.firstPartyForCookies = null;
+    }
+  }
+
+  public int getResourceType() {
+    return this.resourceType;
+  }
+
+  public RequestInfo setResourceType(int resourceType) {
+    this.resourceType = resourceType;
+    setResourceTypeIsSet(true);
+    return this;
+  }
+
+  public void unsetResourceType() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __RESOURCETYPE_ISSET_ID);
+  }
+
+  /** Returns true if field resourceType is set (has been assigned a value) and false otherwise */
+  public boolean isSetResourceType() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __RESOURCETYPE_ISSET_ID);
+  }
+
+  public void setResourceTypeIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __RESOURCETYPE_ISSET_ID, value);
+  }
+
+  public int getTransitionType() {
+    return this.transitionType;
+  }
+
+  public RequestInfo setTransitionType(int transitionType) {
+    this.transitionType = transitionType;
+    setTransitionTypeIsSet(true);
+    return this;
+  }
+
+  public void unsetTransitionType() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __TRANSITIONTYPE_ISSET_ID);
+  }
+
+  /** Returns true if field transitionType is set (has been assigned a value) and false otherwise */
+  public boolean isSetTransitionType() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __TRANSITIONTYPE_ISSET_ID);
+  }
+
+  public void setTransitionTypeIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __TRANSITIONTYPE_ISSET_ID, value);
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case IDENTIFIER:
+      if (value == null) {
+        unsetIdentifier();
+      } else {
+        setIdentifier((java.lang.Long)value);
+      }
+      break;
+
+    case IS_READ_ONLY:
+      if (value == null) {
+        unsetIsReadOnly();
+      } else {
+        setIsReadOnly((java.lang.Boolean)value);
+      }
+      break;
+
+    case URL:
+      if (value == null) {
+        unsetUrl();
+      } else {
+        setUrl((java.lang.String)value);
+      }
+      break;
+
+    case METHOD:
+      if (value == null) {
+        unsetMethod();
+      } else {
+        setMethod((java.lang.String)value);
+      }
+      break;
+
+    case REFERRER_URL:
+      if (value == null) {
+        unsetReferrerUrl();
+      } else {
+        setReferrerUrl((java.lang.String)value);
+      }
+      break;
+
+    case REFERRER_POLICY:
+      if (value == null) {
+        unsetReferrerPolicy();
+      } else {
+        setReferrerPolicy((java.lang.Integer)value);
+      }
+      break;
+
+    case FLAGS:
+      if (value == null) {
+        unsetFlags();
+      } else {
+        setFlags((java.lang.Integer)value);
+      }
+      break;
+
+    case FIRST_PARTY_FOR_COOKIES:
+      if (value == null) {
+        unsetFirstPartyForCookies();
+      } else {
+        setFirstPartyForCookies((java.lang.String)value);
+      }
+      break;
+
+    case RESOURCE_TYPE:
+      if (value == null) {
+        unsetResourceType();
+      } else {
+        setResourceType((java.lang.Integer)value);
+      }
+      break;
+
+    case TRANSITION_TYPE:
+      if (value == null) {
+        unsetTransitionType();
+      } else {
+        setTransitionType((java.lang.Integer)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case IDENTIFIER:
+      return getIdentifier();
+
+    case IS_READ_ONLY:
+      return isIsReadOnly();
+
+    case URL:
+      return getUrl();
+
+    case METHOD:
+      return getMethod();
+
+    case REFERRER_URL:
+      return getReferrerUrl();
+
+    case REFERRER_POLICY:
+      return getReferrerPolicy();
+
+    case FLAGS:
+      return getFlags();
+
+    case FIRST_PARTY_FOR_COOKIES:
+      return getFirstPartyForCookies();
+
+    case RESOURCE_TYPE:
+      return getResourceType();
+
+    case TRANSITION_TYPE:
+      return getTransitionType();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case IDENTIFIER:
+      return isSetIdentifier();
+    case IS_READ_ONLY:
+      return isSetIsReadOnly();
+    case URL:
+      return isSetUrl();
+    case METHOD:
+      return isSetMethod();
+    case REFERRER_URL:
+      return isSetReferrerUrl();
+    case REFERRER_POLICY:
+      return isSetReferrerPolicy();
+    case FLAGS:
+      return isSetFlags();
+    case FIRST_PARTY_FOR_COOKIES:
+      return isSetFirstPartyForCookies();
+    case RESOURCE_TYPE:
+      return isSetResourceType();
+    case TRANSITION_TYPE:
+      return isSetTransitionType();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof RequestInfo)
+      return this.equals((RequestInfo)that);
+    return false;
+  }
+
+  public boolean equals(RequestInfo that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_identifier = true && this.isSetIdentifier();
+    boolean that_present_identifier = true && that.isSetIdentifier();
+    if (this_present_identifier || that_present_identifier) {
+      if (!(this_present_identifier && that_present_identifier))
+        return false;
+      if (this.identifier != that.identifier)
+        return false;
+    }
+
+    boolean this_present_isReadOnly = true && this.isSetIsReadOnly();
+    boolean that_present_isReadOnly = true && that.isSetIsReadOnly();
+    if (this_present_isReadOnly || that_present_isReadOnly) {
+      if (!(this_present_isReadOnly && that_present_isReadOnly))
+        return false;
+      if (this.isReadOnly != that.isReadOnly)
+        return false;
+    }
+
+    boolean this_present_url = true && this.isSetUrl();
+    boolean that_present_url = true && that.isSetUrl();
+    if (this_present_url || that_present_url) {
+      if (!(this_present_url && that_present_url))
+        return false;
+      if (!this.url.equals(that.url))
+        return false;
+    }
+
+    boolean this_present_method = true && this.isSetMethod();
+    boolean that_present_method = true && that.isSetMethod();
+    if (this_present_method || that_present_method) {
+      if (!(this_present_method && that_present_method))
+        return false;
+      if (!this.method.equals(that.method))
+        return false;
+    }
+
+    boolean this_present_referrerUrl = true && this.isSetReferrerUrl();
+    boolean that_present_referrerUrl = true && that.isSetReferrerUrl();
+    if (this_present_referrerUrl || that_present_referrerUrl) {
+      if (!(this_present_referrerUrl && that_present_referrerUrl))
+        return false;
+      if (!this.referrerUrl.equals(that.referrerUrl))
+        return false;
+    }
+
+    boolean this_present_referrerPolicy = true && this.isSetReferrerPolicy();
+    boolean that_present_referrerPolicy = true && that.isSetReferrerPolicy();
+    if (this_present_referrerPolicy || that_present_referrerPolicy) {
+      if (!(this_present_referrerPolicy && that_present_referrerPolicy))
+        return false;
+      if (this.referrerPolicy != that.referrerPolicy)
+        return false;
+    }
+
+    boolean this_present_flags = true && this.isSetFlags();
+    boolean that_present_flags = true && that.isSetFlags();
+    if (this_present_flags || that_present_flags) {
+      if (!(this_present_flags && that_present_flags))
+        return false;
+      if (this.flags != that.flags)
+        return false;
+    }
+
+    boolean this_present_firstPartyForCookies = true && this.isSetFirstPartyForCookies();
+    boolean that_present_firstPartyForCookies = true && that.isSetFirstPartyForCookies();
+    if (this_present_firstPartyForCookies || that_present_firstPartyForCookies) {
+      if (!(this_present_firstPartyForCookies && that_present_firstPartyForCookies))
+        return false;
+      if (!this.firstPartyForCookies.equals(that.firstPartyForCookies))
+        return false;
+    }
+
+    boolean this_present_resourceType = true && this.isSetResourceType();
+    boolean that_present_resourceType = true && that.isSetResourceType();
+    if (this_present_resourceType || that_present_resourceType) {
+      if (!(this_present_resourceType && that_present_resourceType))
+        return false;
+      if (this.resourceType != that.resourceType)
+        return false;
+    }
+
+    boolean this_present_transitionType = true && this.isSetTransitionType();
+    boolean that_present_transitionType = true && that.isSetTransitionType();
+    if (this_present_transitionType || that_present_transitionType) {
+      if (!(this_present_transitionType && that_present_transitionType))
+        return false;
+      if (this.transitionType != that.transitionType)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + ((isSetIdentifier()) ? 131071 : 524287);
+    if (isSetIdentifier())
+      hashCode = hashCode * 8191 + org.apache.thrift.TBaseHelper.hashCode(identifier);
+
+    hashCode = hashCode * 8191 + ((isSetIsReadOnly()) ? 131071 : 524287);
+    if (isSetIsReadOnly())
+      hashCode = hashCode * 8191 + ((isReadOnly) ? 131071 : 524287);
+
+    hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
+    if (isSetUrl())
+      hashCode = hashCode * 8191 + url.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetMethod()) ? 131071 : 524287);
+    if (isSetMethod())
+      hashCode = hashCode * 8191 + method.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetReferrerUrl()) ? 131071 : 524287);
+    if (isSetReferrerUrl())
+      hashCode = hashCode * 8191 + referrerUrl.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetReferrerPolicy()) ? 131071 : 524287);
+    if (isSetReferrerPolicy())
+      hashCode = hashCode * 8191 + referrerPolicy;
+
+    hashCode = hashCode * 8191 + ((isSetFlags()) ? 131071 : 524287);
+    if (isSetFlags())
+      hashCode = hashCode * 8191 + flags;
+
+    hashCode = hashCode * 8191 + ((isSetFirstPartyForCookies()) ? 131071 : 524287);
+    if (isSetFirstPartyForCookies())
+      hashCode = hashCode * 8191 + firstPartyForCookies.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetResourceType()) ? 131071 : 524287);
+    if (isSetResourceType())
+      hashCode = hashCode * 8191 + resourceType;
+
+    hashCode = hashCode * 8191 + ((isSetTransitionType()) ? 131071 : 524287);
+    if (isSetTransitionType())
+      hashCode = hashCode * 8191 + transitionType;
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(RequestInfo other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetIdentifier(), other.isSetIdentifier());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetIdentifier()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.identifier, other.identifier);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetIsReadOnly(), other.isSetIsReadOnly());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetIsReadOnly()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.isReadOnly, other.isReadOnly);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetUrl()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetMethod(), other.isSetMethod());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetMethod()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.method, other.method);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetReferrerUrl(), other.isSetReferrerUrl());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetReferrerUrl()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.referrerUrl, other.referrerUrl);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetReferrerPolicy(), other.isSetReferrerPolicy());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetReferrerPolicy()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.referrerPolicy, other.referrerPolicy);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetFlags(), other.isSetFlags());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetFlags()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.flags, other.flags);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetFirstPartyForCookies(), other.isSetFirstPartyForCookies());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetFirstPartyForCookies()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.firstPartyForCookies, other.firstPartyForCookies);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetResourceType(), other.isSetResourceType());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetResourceType()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.resourceType, other.resourceType);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetTransitionType(), other.isSetTransitionType());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetTransitionType()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.transitionType, other.transitionType);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("RequestInfo(");
+    boolean first = true;
+
+    if (isSetIdentifier()) {
+      sb.append("identifier:");
+      sb.append(this.identifier);
+      first = false;
+    }
+    if (isSetIsReadOnly()) {
+      if (!first) sb.append(", ");
+      sb.append("isReadOnly:");
+      sb.append(this.isReadOnly);
+      first = false;
+    }
+    if (isSetUrl()) {
+      if (!first) sb.append(", ");
+      sb.append("url:");
+      if (this.url == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.url);
+      }
+      first = false;
+    }
+    if (isSetMethod()) {
+      if (!first) sb.append(", ");
+      sb.append("method:");
+      if (this.method == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.method);
+      }
+      first = false;
+    }
+    if (isSetReferrerUrl()) {
+      if (!first) sb.append(", ");
+      sb.append("referrerUrl:");
+      if (this.referrerUrl == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.referrerUrl);
+      }
+      first = false;
+    }
+    if (isSetReferrerPolicy()) {
+      if (!first) sb.append(", ");
+      sb.append("referrerPolicy:");
+      sb.append(this.referrerPolicy);
+      first = false;
+    }
+    if (isSetFlags()) {
+      if (!first) sb.append(", ");
+      sb.append("flags:");
+      sb.append(this.flags);
+      first = false;
+    }
+    if (isSetFirstPartyForCookies()) {
+      if (!first) sb.append(", ");
+      sb.append("firstPartyForCookies:");
+      if (this.firstPartyForCookies == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.firstPartyForCookies);
+      }
+      first = false;
+    }
+    if (isSetResourceType()) {
+      if (!first) sb.append(", ");
+      sb.append("resourceType:");
+      sb.append(this.resourceType);
+      first = false;
+    }
+    if (isSetTransitionType()) {
+      if (!first) sb.append(", ");
+      sb.append("transitionType:");
+      sb.append(this.transitionType);
+      first = false;
+    }
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bitfield = 0;
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class RequestInfoStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public RequestInfoStandardScheme getScheme() {
+      return new RequestInfoStandardScheme();
+    }
+  }
+
+  private static class RequestInfoStandardScheme extends org.apache.thrift.scheme.StandardScheme<RequestInfo> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, RequestInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // IDENTIFIER
+            if (schemeField.type == org.apache.thrift.protocol.TType.I64) {
+              struct.identifier = iprot.readI64();
+              struct.setIdentifierIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // IS_READ_ONLY
+            if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+              struct.isReadOnly = iprot.readBool();
+              struct.setIsReadOnlyIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 3: // URL
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.url = iprot.readString();
+              struct.setUrlIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 4: // METHOD
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.method = iprot.readString();
+              struct.setMethodIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 5: // REFERRER_URL
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.referrerUrl = iprot.readString();
+              struct.setReferrerUrlIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 6: // REFERRER_POLICY
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.referrerPolicy = iprot.readI32();
+              struct.setReferrerPolicyIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 7: // FLAGS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.flags = iprot.readI32();
+              struct.setFlagsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 8: // FIRST_PARTY_FOR_COOKIES
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.firstPartyForCookies = iprot.readString();
+              struct.setFirstPartyForCookiesIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 9: // RESOURCE_TYPE
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.resourceType = iprot.readI32();
+              struct.setResourceTypeIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 10: // TRANSITION_TYPE
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.transitionType = iprot.readI32();
+              struct.setTransitionTypeIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, RequestInfo struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (struct.isSetIdentifier()) {
+        oprot.writeFieldBegin(IDENTIFIER_FIELD_DESC);
+        oprot.writeI64(struct.identifier);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetIsReadOnly()) {
+        oprot.writeFieldBegin(IS_READ_ONLY_FIELD_DESC);
+        oprot.writeBool(struct.isReadOnly);
+        oprot.writeFieldEnd();
+      }
+      if (struct.url != null) {
+        if (struct.isSetUrl()) {
+          oprot.writeFieldBegin(URL_FIELD_DESC);
+          oprot.writeString(struct.url);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.method != null) {
+        if (struct.isSetMethod()) {
+          oprot.writeFieldBegin(METHOD_FIELD_DESC);
+          oprot.writeString(struct.method);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.referrerUrl != null) {
+        if (struct.isSetReferrerUrl()) {
+          oprot.writeFieldBegin(REFERRER_URL_FIELD_DESC);
+          oprot.writeString(struct.referrerUrl);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.isSetReferrerPolicy()) {
+        oprot.writeFieldBegin(REFERRER_POLICY_FIELD_DESC);
+        oprot.writeI32(struct.referrerPolicy);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetFlags()) {
+        oprot.writeFieldBegin(FLAGS_FIELD_DESC);
+        oprot.writeI32(struct.flags);
+        oprot.writeFieldEnd();
+      }
+      if (struct.firstPartyForCookies != null) {
+        if (struct.isSetFirstPartyForCookies()) {
+          oprot.writeFieldBegin(FIRST_PARTY_FOR_COOKIES_FIELD_DESC);
+          oprot.writeString(struct.firstPartyForCookies);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.isSetResourceType()) {
+        oprot.writeFieldBegin(RESOURCE_TYPE_FIELD_DESC);
+        oprot.writeI32(struct.resourceType);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetTransitionType()) {
+        oprot.writeFieldBegin(TRANSITION_TYPE_FIELD_DESC);
+        oprot.writeI32(struct.transitionType);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class RequestInfoTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public RequestInfoTupleScheme getScheme() {
+      return new RequestInfoTupleScheme();
+    }
+  }
+
+  private static class RequestInfoTupleScheme extends org.apache.thrift.scheme.TupleScheme<RequestInfo> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, RequestInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet optionals = new java.util.BitSet();
+      if (struct.isSetIdentifier()) {
+        optionals.set(0);
+      }
+      if (struct.isSetIsReadOnly()) {
+        optionals.set(1);
+      }
+      if (struct.isSetUrl()) {
+        optionals.set(2);
+      }
+      if (struct.isSetMethod()) {
+        optionals.set(3);
+      }
+      if (struct.isSetReferrerUrl()) {
+        optionals.set(4);
+      }
+      if (struct.isSetReferrerPolicy()) {
+        optionals.set(5);
+      }
+      if (struct.isSetFlags()) {
+        optionals.set(6);
+      }
+      if (struct.isSetFirstPartyForCookies()) {
+        optionals.set(7);
+      }
+      if (struct.isSetResourceType()) {
+        optionals.set(8);
+      }
+      if (struct.isSetTransitionType()) {
+        optionals.set(9);
+      }
+      oprot.writeBitSet(optionals, 10);
+      if (struct.isSetIdentifier()) {
+        oprot.writeI64(struct.identifier);
+      }
+      if (struct.isSetIsReadOnly()) {
+        oprot.writeBool(struct.isReadOnly);
+      }
+      if (struct.isSetUrl()) {
+        oprot.writeString(struct.url);
+      }
+      if (struct.isSetMethod()) {
+        oprot.writeString(struct.method);
+      }
+      if (struct.isSetReferrerUrl()) {
+        oprot.writeString(struct.referrerUrl);
+      }
+      if (struct.isSetReferrerPolicy()) {
+        oprot.writeI32(struct.referrerPolicy);
+      }
+      if (struct.isSetFlags()) {
+        oprot.writeI32(struct.flags);
+      }
+      if (struct.isSetFirstPartyForCookies()) {
+        oprot.writeString(struct.firstPartyForCookies);
+      }
+      if (struct.isSetResourceType()) {
+        oprot.writeI32(struct.resourceType);
+      }
+      if (struct.isSetTransitionType()) {
+        oprot.writeI32(struct.transitionType);
+      }
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, RequestInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet incoming = iprot.readBitSet(10);
+      if (incoming.get(0)) {
+        struct.identifier = iprot.readI64();
+        struct.setIdentifierIsSet(true);
+      }
+      if (incoming.get(1)) {
+        struct.isReadOnly = iprot.readBool();
+        struct.setIsReadOnlyIsSet(true);
+      }
+      if (incoming.get(2)) {
+        struct.url = iprot.readString();
+        struct.setUrlIsSet(true);
+      }
+      if (incoming.get(3)) {
+        struct.method = iprot.readString();
+        struct.setMethodIsSet(true);
+      }
+      if (incoming.get(4)) {
+        struct.referrerUrl = iprot.readString();
+        struct.setReferrerUrlIsSet(true);
+      }
+      if (incoming.get(5)) {
+        struct.referrerPolicy = iprot.readI32();
+        struct.setReferrerPolicyIsSet(true);
+      }
+      if (incoming.get(6)) {
+        struct.flags = iprot.readI32();
+        struct.setFlagsIsSet(true);
+      }
+      if (incoming.get(7)) {
+        struct.firstPartyForCookies = iprot.readString();
+        struct.setFirstPartyForCookiesIsSet(true);
+      }
+      if (incoming.get(8)) {
+        struct.resourceType = iprot.readI32();
+        struct.setResourceTypeIsSet(true);
+      }
+      if (incoming.get(9)) {
+        struct.transitionType = iprot.readI32();
+        struct.setTransitionTypeIsSet(true);
+      }
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
@@ -0,0 +1,477 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class ResourceRule implements org.apache.thrift.TBase<ResourceRule, ResourceRule._Fields>, java.io.Serializable, Cloneable, Comparable<ResourceRule> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResourceRule");
+
+  private static final org.apache.thrift.protocol.TField URL_PATTERN_FIELD_DESC = new org.apache.thrift.protocol.TField("urlPattern", org.apache.thrift.protocol.TType.STRING, (short)1);
+  private static final org.apache.thrift.protocol.TField ACTION_FIELD_DESC = new org.apache.thrift.protocol.TField("action", org.apache.thrift.protocol.TType.I32, (short)2);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResourceRuleStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResourceRuleTupleSchemeFactory();
+
+  public @org.apache.thrift.annotation.Nullable java.lang.String urlPattern; // required
+  public int action; // required
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    URL_PATTERN((short)1, "urlPattern"),
+    ACTION((short)2, "action");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // URL_PATTERN
+          return URL_PATTERN;
+        case 2: // ACTION
+          return ACTION;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __ACTION_ISSET_ID = 0;
+  private byte __isset_bitfield = 0;
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.URL_PATTERN, new org.apache.thrift.meta_data.FieldMetaData("urlPattern", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.ACTION, new org.apache.thrift.meta_data.FieldMetaData("action", org.apache.thrift.TFieldRequirementType.REQUIRED, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResourceRule.class, metaDataMap);
+  }
+
+  public ResourceRule() {
+  }
+
+  public ResourceRule(
+    java.lang.String urlPattern,
+    int action)
+  {
+    this();
+    this.urlPattern = urlPattern;
+    this.action = action;
+    setActionIsSet(true);
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public ResourceRule(ResourceRule other) {
+    __isset_bitfield = other.__isset_bitfield;
+    if (other.isSetUrlPattern()) {
+      this.urlPattern = other.urlPattern;
+    }
+    this.action = other.action;
+  }
+
+  @Override
+  public ResourceRule deepCopy() {
+    return new ResourceRule(this);
+  }
+
+  @Override
+  public void clear() {
+    this.urlPattern = null;
+    setActionIsSet(false);
+    this.action = 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getUrlPattern() {
+    return this.urlPattern;
+  }
+
+  public ResourceRule setUrlPattern(@org.apache.thrift.annotation.Nullable java.lang.String urlPattern) {
+    this.urlPattern = urlPattern;
+    return this;
+  }
+
+  public void unsetUrlPattern() {
+    this.urlPattern = null;
+  }
+
+  /** Returns true if field urlPattern is set (has been assigned a value) and false otherwise */
+  public boolean isSetUrlPattern() {
+    return this.urlPattern != null;
+  }
+
+  public void setUrlPatternIsSet(boolean value) {
+    if (!value) {
+      this.urlPattern = null;
+    }
+  }
+
+  public int getAction() {
+    return this.action;
+  }
+
+  public ResourceRule setAction(int action) {
+    this.action = action;
+    setActionIsSet(true);
+    return this;
+  }
+
+  public void unsetAction() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ACTION_ISSET_ID);
+  }
+
+  /** Returns true if field action is set (has been assigned a value) and false otherwise */
+  public boolean isSetAction() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ACTION_ISSET_ID);
+  }
+
+  public void setActionIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ACTION_ISSET_ID, value);
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case URL_PATTERN:
+      if (value == null) {
+        unsetUrlPattern();
+      } else {
+        setUrlPattern((java.lang.String)value);
+      }
+      break;
+
+    case ACTION:
+      if (value == null) {
+        unsetAction();
+      } else {
+        setAction((java.lang.Integer)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case URL_PATTERN:
+      return getUrlPattern();
+
+    case ACTION:
+      return getAction();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case URL_PATTERN:
+      return isSetUrlPattern();
+    case ACTION:
+      return isSetAction();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof ResourceRule)
+      return this.equals((ResourceRule)that);
+    return false;
+  }
+
+  public boolean equals(ResourceRule that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_urlPattern = true && this.isSetUrlPattern();
+    boolean that_present_urlPattern = true && that.isSetUrlPattern();
+    if (this_present_urlPattern || that_present_urlPattern) {
+      if (!(this_present_urlPattern && that_present_urlPattern))
+        return false;
+      if (!this.urlPattern.equals(that.urlPattern))
+        return false;
+    }
+
+    boolean this_present_action = true;
+    boolean that_present_action = true;
+    if (this_present_action || that_present_action) {
+      if (!(this_present_action && that_present_action))
+        return false;
+      if (this.action != that.action)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + ((isSetUrlPattern()) ? 131071 : 524287);
+    if (isSetUrlPattern())
+      hashCode = hashCode * 8191 + urlPattern.hashCode();
+
+    hashCode = hashCode * 8191 + action;
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(ResourceRule other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetUrlPattern(), other.isSetUrlPattern());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetUrlPattern()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.urlPattern, other.urlPattern);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetAction(), other.isSetAction());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetAction()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.action, other.action);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("ResourceRule(");
+    boolean first = true;
+
+    sb.append("urlPattern:");
+    if (this.urlPattern == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.urlPattern);
+    }
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("action:");
+    sb.append(this.action);
+    first = false;
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    if (urlPattern == null) {
+      throw new org.apache.thrift.protocol.TProtocolException("Required field 'urlPattern' was not present! Struct: " + toString());
+    }
+    // alas, we cannot check 'action' because it's a primitive and you chose the non-beans generator.
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bitfield = 0;
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class ResourceRuleStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ResourceRuleStandardScheme getScheme() {
+      return new ResourceRuleStandardScheme();
+    }
+  }
+
+  private static class ResourceRuleStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResourceRule> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, ResourceRule struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // URL_PATTERN
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.urlPattern = iprot.readString();
+              struct.setUrlPatternIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // ACTION
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.action = iprot.readI32();
+              struct.setActionIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      if (!struct.isSetAction()) {
+        throw new org.apache.thrift.protocol.TProtocolException("Required field 'action' was not found in serialized data! Struct: " + toString());
+      }
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, ResourceRule struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (struct.urlPattern != null) {
+        oprot.writeFieldBegin(URL_PATTERN_FIELD_DESC);
+        oprot.writeString(struct.urlPattern);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldBegin(ACTION_FIELD_DESC);
+      oprot.writeI32(struct.action);
+      oprot.writeFieldEnd();
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class ResourceRuleTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ResourceRuleTupleScheme getScheme() {
+      return new ResourceRuleTupleScheme();
+    }
+  }
+
+  private static class ResourceRuleTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResourceRule> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, ResourceRule struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      oprot.writeString(struct.urlPattern);
+      oprot.writeI32(struct.action);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, ResourceRule struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      struct.urlPattern = iprot.readString();
+      struct.setUrlPatternIsSet(true);
+      struct.action = iprot.readI32();
+      struct.setActionIsSet(true);
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
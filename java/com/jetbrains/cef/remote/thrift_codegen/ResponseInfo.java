@@ -0,0 +1,793 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class ResponseInfo implements org.apache.thrift.TBase<ResponseInfo, ResponseInfo._Fields>, java.io.Serializable, Cloneable, Comparable<ResponseInfo> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ResponseInfo");
+
+  private static final org.apache.thrift.protocol.TField IS_READ_ONLY_FIELD_DESC = new org.apache.thrift.protocol.TField("isReadOnly", org.apache.thrift.protocol.TType.BOOL, (short)1);
+  private static final org.apache.thrift.protocol.TField STATUS_FIELD_DESC = new org.apache.thrift.protocol.TField("status", org.apache.thrift.protocol.TType.I32, (short)2);
+  private static final org.apache.thrift.protocol.TField STATUS_TEXT_FIELD_DESC = new org.apache.thrift.protocol.TField("statusText", org.apache.thrift.protocol.TType.STRING, (short)3);
+  private static final org.apache.thrift.protocol.TField MIME_TYPE_FIELD_DESC = new org.apache.thrift.protocol.TField("mimeType", org.apache.thrift.protocol.TType.STRING, (short)4);
+  private static final org.apache.thrift.protocol.TField ERROR_FIELD_DESC = new org.apache.thrift.protocol.TField("error", org.apache.thrift.protocol.TType.I32, (short)5);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ResponseInfoStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ResponseInfoTupleSchemeFactory();
+
+  public boolean isReadOnly; // optional
+  public int status; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String statusText; // optional
+  public @org.apache.thrift.annotation.Nullable java.lang.String mimeType; // optional
+  public int error; // optional
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    IS_READ_ONLY((short)1, "isReadOnly"),
+    STATUS((short)2, "status"),
+    STATUS_TEXT((short)3, "statusText"),
+    MIME_TYPE((short)4, "mimeType"),
+    ERROR((short)5, "error");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // IS_READ_ONLY
+          return IS_READ_ONLY;
+        case 2: // STATUS
+          return STATUS;
+        case 3: // STATUS_TEXT
+          return STATUS_TEXT;
+        case 4: // MIME_TYPE
+          return MIME_TYPE;
+        case 5: // ERROR
+          return ERROR;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __ISREADONLY_ISSET_ID = 0;
+  private static final int __STATUS_ISSET_ID = 1;
+  private static final int __ERROR_ISSET_ID = 2;
+  private byte __isset_bitfield = 0;
+  private static final _Fields optionals[] = {_Fields.IS_READ_ONLY,_Fields.STATUS,_Fields.STATUS_TEXT,_Fields.MIME_TYPE,_Fields.ERROR};
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.IS_READ_ONLY, new org.apache.thrift.meta_data.FieldMetaData("isReadOnly", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+    tmpMap.put(_Fields.STATUS, new org.apache.thrift.meta_data.FieldMetaData("status", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    tmpMap.put(_Fields.STATUS_TEXT, new org.apache.thrift.meta_data.FieldMetaData("statusText", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.MIME_TYPE, new org.apache.thrift.meta_data.FieldMetaData("mimeType", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.ERROR, new org.apache.thrift.meta_data.FieldMetaData("error", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ResponseInfo.class, metaDataMap);
+  }
+
+  public ResponseInfo() {
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public ResponseInfo(ResponseInfo other) {
+    __isset_bitfield = other.__isset_bitfield;
+    this.isReadOnly = other.isReadOnly;
+    this.status = other.status;
+    if (other.isSetStatusText()) {
+      this.statusText = other.statusText;
+    }
+    if (other.isSetMimeType()) {
+      this.mimeType = other.mimeType;
+    }
+    this.error = other.error;
+  }
+
+  @Override
+  public ResponseInfo deepCopy() {
+    return new ResponseInfo(this);
+  }
+
+  @Override
+  public void clear() {
+    setIsReadOnlyIsSet(false);
+    this.isReadOnly = false;
+    setStatusIsSet(false);
+    this.status = 0;
+    this.statusText = null;
+    this.mimeType = null;
+    setErrorIsSet(false);
+    this.error = 0;
+  }
+
+  public boolean isIsReadOnly() {
+    return this.isReadOnly;
+  }
+
+  public ResponseInfo setIsReadOnly(boolean isReadOnly) {
+    this.isReadOnly = isReadOnly;
+    setIsReadOnlyIsSet(true);
+    return this;
+  }
+
+  public void unsetIsReadOnly() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ISREADONLY_ISSET_ID);
+  }
+
+  /** Returns true if field isReadOnly is set (has been assigned a value) and false otherwise */
+  public boolean isSetIsReadOnly() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ISREADONLY_ISSET_ID);
+  }
+
+  public void setIsReadOnlyIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ISREADONLY_ISSET_ID, value);
+  }
+
+  public int getStatus() {
+    return this.status;
+  }
+
+  public ResponseInfo setStatus(int status) {
+    this.status = status;
+    setStatusIsSet(true);
+    return this;
+  }
+
+  public void unsetStatus() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __STATUS_ISSET_ID);
+  }
+
+  /** Returns true if field status is set (has been assigned a value) and false otherwise */
+  public boolean isSetStatus() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __STATUS_ISSET_ID);
+  }
+
+  public void setStatusIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __STATUS_ISSET_ID, value);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getStatusText() {
+    return this.statusText;
+  }
+
+  public ResponseInfo setStatusText(@org.apache.thrift.annotation.Nullable java.lang.String statusText) {
+    this.statusText = statusText;
+    return this;
+  }
+
+  public void unsetStatusText() {
+    this.statusText = null;
+  }
+
+  /** Returns true if field statusText is set (has been assigned a value) and false otherwise */
+  public boolean isSetStatusText() {
+    return this.statusText != null;
+  }
+
+  public void setStatusTextIsSet(boolean value) {
+    if (!value) {
+      this.statusText = null;
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.lang.String getMimeType() {
+    return this.mimeType;
+  }
+
+  public ResponseInfo setMimeType(@org.apache.thrift.annotation.Nullable java.lang.String mimeType) {
+    this.mimeType = mimeType;
+    return this;
+  }
+
+  public void unsetMimeType() {
+    this.mimeType = null;
+  }
+
+  /** Returns true if field mimeType is set (has been assigned a value) and false otherwise */
+  public boolean isSetMimeType() {
+    return this.mimeType != null;
+  }
+
+  public void setMimeTypeIsSet(boolean value) {
+    if (!value) {
+      this.mimeType = null;
+    }
+  }
+
+  public int getError() {
+    return this.error;
+  }
+
+  public ResponseInfo setError(int error) {
+    this.error = error;
+    setErrorIsSet(true);
+    return this;
+  }
+
+  public void unsetError() {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __ERROR_ISSET_ID);
+  }
+
+  /** Returns true if field error is set (has been assigned a value) and false otherwise */
+  public boolean isSetError() {
+    return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __ERROR_ISSET_ID);
+  }
+
+  public void setErrorIsSet(boolean value) {
+    __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __ERROR_ISSET_ID, value);
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case IS_READ_ONLY:
+      if (value == null) {
+        unsetIsReadOnly();
+      } else {
+        setIsReadOnly((java.lang.Boolean)value);
+      }
+      break;
+
+    case STATUS:
+      if (value == null) {
+        unsetStatus();
+      } else {
+        setStatus((java.lang.Integer)value);
+      }
+      break;
+
+    case STATUS_TEXT:
+      if (value == null) {
+        unsetStatusText();
+      } else {
+        setStatusText((java.lang.String)value);
+      }
+      break;
+
+    case MIME_TYPE:
+      if (value == null) {
+        unsetMimeType();
+      } else {
+        setMimeType((java.lang.String)value);
+      }
+      break;
+
+    case ERROR:
+      if (value == null) {
+        unsetError();
+      } else {
+        setError((java.lang.Integer)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case IS_READ_ONLY:
+      return isIsReadOnly();
+
+    case STATUS:
+      return getStatus();
+
+    case STATUS_TEXT:
+      return getStatusText();
+
+    case MIME_TYPE:
+      return getMimeType();
+
+    case ERROR:
+      return getError();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case IS_READ_ONLY:
+      return isSetIsReadOnly();
+    case STATUS:
+      return isSetStatus();
+    case STATUS_TEXT:
+      return isSetStatusText();
+    case MIME_TYPE:
+      return isSetMimeType();
+    case ERROR:
+      return isSetError();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof ResponseInfo)
+      return this.equals((ResponseInfo)that);
+    return false;
+  }
+
+  public boolean equals(ResponseInfo that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_isReadOnly = true && this.isSetIsReadOnly();
+    boolean that_present_isReadOnly = true && that.isSetIsReadOnly();
+    if (this_present_isReadOnly || that_present_isReadOnly) {
+      if (!(this_present_isReadOnly && that_present_isReadOnly))
+        return false;
+      if (this.isReadOnly != that.isReadOnly)
+        return false;
+    }
+
+    boolean this_present_status = true && this.isSetStatus();
+    boolean that_present_status = true && that.isSetStatus();
+    if (this_present_status || that_present_status) {
+      if (!(this_present_status && that_present_status))
+        return false;
+      if (this.status != that.status)
+        return false;
+    }
+
+    boolean this_present_statusText = true && this.isSetStatusText();
+    boolean that_present_statusText = true && that.isSetStatusText();
+    if (this_present_statusText || that_present_statusText) {
+      if (!(this_present_statusText && that_present_statusText))
+        return false;
+      if (!this.statusText.equals(that.statusText))
+        return false;
+    }
+
+    boolean this_present_mimeType = true && this.isSetMimeType();
+    boolean that_present_mimeType = true && that.isSetMimeType();
+    if (this_present_mimeType || that_present_mimeType) {
+      if (!(this_present_mimeType && that_present_mimeType))
+        return false;
+      if (!this.mimeType.equals(that.mimeType))
+        return false;
+    }
+
+    boolean this_present_error = true && this.isSetError();
+    boolean that_present_error = true && that.isSetError();
+    if (this_present_error || that_present_error) {
+      if (!(this_present_error && that_present_error))
+        return false;
+      if (this.error != that.error)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + ((isSetIsReadOnly()) ? 131071 : 524287);
+    if (isSetIsReadOnly())
+      hashCode = hashCode * 8191 + ((isReadOnly) ? 131071 : 524287);
+
+    hashCode = hashCode * 8191 + ((isSetStatus()) ? 131071 : 524287);
+    if (isSetStatus())
+      hashCode = hashCode * 8191 + status;
+
+    hashCode = hashCode * 8191 + ((isSetStatusText()) ? 131071 : 524287);
+    if (isSetStatusText())
+      hashCode = hashCode * 8191 + statusText.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetMimeType()) ? 131071 : 524287);
+    if (isSetMimeType())
+      hashCode = hashCode * 8191 + mimeType.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetError()) ? 131071 : 524287);
+    if (isSetError())
+      hashCode = hashCode * 8191 + error;
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(ResponseInfo other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetIsReadOnly(), other.isSetIsReadOnly());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetIsReadOnly()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.isReadOnly, other.isReadOnly);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetStatus(), other.isSetStatus());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetStatus()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.status, other.status);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetStatusText(), other.isSetStatusText());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetStatusText()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.statusText, other.statusText);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetMimeType(), other.isSetMimeType());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetMimeType()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.mimeType, other.mimeType);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetError(), other.isSetError());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetError()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.error, other.error);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("ResponseInfo(");
+    boolean first = true;
+
+    if (isSetIsReadOnly()) {
+      sb.append("isReadOnly:");
+      sb.append(this.isReadOnly);
+      first = false;
+    }
+    if (isSetStatus()) {
+      if (!first) sb.append(", ");
+      sb.append("status:");
+      sb.append(this.status);
+      first = false;
+    }
+    if (isSetStatusText()) {
+      if (!first) sb.append(", ");
+      sb.append("statusText:");
+      if (this.statusText == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.statusText);
+      }
+      first = false;
+    }
+    if (isSetMimeType()) {
+      if (!first) sb.append(", ");
+      sb.append("mimeType:");
+      if (this.mimeType == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.mimeType);
+      }
+      first = false;
+    }
+    if (isSetError()) {
+      if (!first) sb.append(", ");
+      sb.append("error:");
+      sb.append(this.error);
+      first = false;
+    }
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bitfield = 0;
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class ResponseInfoStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ResponseInfoStandardScheme getScheme() {
+      return new ResponseInfoStandardScheme();
+    }
+  }
+
+  private static class ResponseInfoStandardScheme extends org.apache.thrift.scheme.StandardScheme<ResponseInfo> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, ResponseInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // IS_READ_ONLY
+            if (schemeField.type == org.apache.thrift.protocol.TType.BOOL) {
+              struct.isReadOnly = iprot.readBool();
+              struct.setIsReadOnlyIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // STATUS
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.status = iprot.readI32();
+              struct.setStatusIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 3: // STATUS_TEXT
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.statusText = iprot.readString();
+              struct.setStatusTextIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 4: // MIME_TYPE
+            if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+              struct.mimeType = iprot.readString();
+              struct.setMimeTypeIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 5: // ERROR
+            if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+              struct.error = iprot.readI32();
+              struct.setErrorIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, ResponseInfo struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (struct.isSetIsReadOnly()) {
+        oprot.writeFieldBegin(IS_READ_ONLY_FIELD_DESC);
+        oprot.writeBool(struct.isReadOnly);
+        oprot.writeFieldEnd();
+      }
+      if (struct.isSetStatus()) {
+        oprot.writeFieldBegin(STATUS_FIELD_DESC);
+        oprot.writeI32(struct.status);
+        oprot.writeFieldEnd();
+      }
+      if (struct.statusText != null) {
+        if (struct.isSetStatusText()) {
+          oprot.writeFieldBegin(STATUS_TEXT_FIELD_DESC);
+          oprot.writeString(struct.statusText);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.mimeType != null) {
+        if (struct.isSetMimeType()) {
+          oprot.writeFieldBegin(MIME_TYPE_FIELD_DESC);
+          oprot.writeString(struct.mimeType);
+          oprot.writeFieldEnd();
+        }
+      }
+      if (struct.isSetError()) {
+        oprot.writeFieldBegin(ERROR_FIELD_DESC);
+        oprot.writeI32(struct.error);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class ResponseInfoTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ResponseInfoTupleScheme getScheme() {
+      return new ResponseInfoTupleScheme();
+    }
+  }
+
+  private static class ResponseInfoTupleScheme extends org.apache.thrift.scheme.TupleScheme<ResponseInfo> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, ResponseInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet optionals = new java.util.BitSet();
+      if (struct.isSetIsReadOnly()) {
+        optionals.set(0);
+      }
+      if (struct.isSetStatus()) {
+        optionals.set(1);
+      }
+      if (struct.isSetStatusText()) {
+        optionals.set(2);
+      }
+      if (struct.isSetMimeType()) {
+        optionals.set(3);
+      }
+      if (struct.isSetError()) {
+        optionals.set(4);
+      }
+      oprot.writeBitSet(optionals, 5);
+      if (struct.isSetIsReadOnly()) {
+        oprot.writeBool(struct.isReadOnly);
+      }
+      if (struct.isSetStatus()) {
+        oprot.writeI32(struct.status);
+      }
+      if (struct.isSetStatusText()) {
+        oprot.writeString(struct.statusText);
+      }
+      if (struct.isSetMimeType()) {
+        oprot.writeString(struct.mimeType);
+      }
+      if (struct.isSetError()) {
+        oprot.writeI32(struct.error);
+      }
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, ResponseInfo struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet incoming = iprot.readBitSet(5);
+      if (incoming.get(0)) {
+        struct.isReadOnly = iprot.readBool();
+        struct.setIsReadOnlyIsSet(true);
+      }
+      if (incoming.get(1)) {
+        struct.status = iprot.readI32();
+        struct.setStatusIsSet(true);
+      }
+      if (incoming.get(2)) {
+        struct.statusText = iprot.readString();
+        struct.setStatusTextIsSet(true);
+      }
+      if (incoming.get(3)) {
+        struct.mimeType = iprot.readString();
+        struct.setMimeTypeIsSet(true);
+      }
+      if (incoming.get(4)) {
+        struct.error = iprot.readI32();
+        struct.setErrorIsSet(true);
+      }
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
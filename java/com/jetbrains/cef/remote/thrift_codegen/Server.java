@@ -23,6 +23,8 @@ public class Server {
 
     public java.lang.String state() throws org.apache.thrift.TException;
 
+    public com.jetbrains.cef.remote.thrift_codegen.ServerMetrics metrics() throws org.apache.thrift.TException;
+
     public void stop() throws org.apache.thrift.TException;
 
     public int createBrowser(int cid, int handlersMask) throws org.apache.thrift.TException;
@@ -45,6 +47,10 @@ public class Server {
 
     public void Browser_NotifyScreenInfoChanged(int bid) throws org.apache.thrift.TException;
 
+    public void Browser_SetViewGeometry(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100) throws org.apache.thrift.TException;
+
+    public void Browser_SetResourceRules(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules) throws org.apache.thrift.TException;
+
     public void Browser_SendKeyEvent(int bid, int event_type, int modifiers, short key_char, long scanCode, int key_code) throws org.apache.thrift.TException;
 
     public void Browser_SendMouseEvent(int bid, int event_type, int x, int y, int modifiers, int click_count, int button) throws org.apache.thrift.TException;
@@ -165,6 +171,8 @@ public class Server {
 
     public void state(org.apache.thrift.async.AsyncMethodCallback<java.lang.String> resultHandler) throws org.apache.thrift.TException;
 
+    public void metrics(org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> resultHandler) throws org.apache.thrift.TException;
+
     public void stop(org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
     public void createBrowser(int cid, int handlersMask, org.apache.thrift.async.AsyncMethodCallback<java.lang.Integer> resultHandler) throws org.apache.thrift.TException;
@@ -187,6 +195,10 @@ public class Server {
 
     public void Browser_NotifyScreenInfoChanged(int bid, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
+    public void Browser_SetViewGeometry(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
+
+    public void Browser_SetResourceRules(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
+
     public void Browser_SendKeyEvent(int bid, int event_type, int modifiers, short key_char, long scanCode, int key_code, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
 
     public void Browser_SendMouseEvent(int bid, int event_type, int x, int y, int modifiers, int click_count, int button, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException;
@@ -448,6 +460,29 @@ public class Server {
       throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "state failed: unknown result");
     }
 
+    @Override
+    public com.jetbrains.cef.remote.thrift_codegen.ServerMetrics metrics() throws org.apache.thrift.TException
+    {
+      send_metrics();
+      return recv_metrics();
+    }
+
+    public void send_metrics() throws org.apache.thrift.TException
+    {
+      metrics_args args = new metrics_args();
+      sendBase("metrics", args);
+    }
+
+    public com.jetbrains.cef.remote.thrift_codegen.ServerMetrics recv_metrics() throws org.apache.thrift.TException
+    {
+      metrics_result result = new metrics_result();
+      receiveBase(result, "metrics");
+      if (result.isSetSuccess()) {
+        return result.success;
+      }
+      throw new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.MISSING_RESULT, "metrics failed: unknown result");
+    }
+
     @Override
     public void stop() throws org.apache.thrift.TException
     {
@@ -618,6 +653,37 @@ public class Server {
       sendBaseOneway("Browser_NotifyScreenInfoChanged", args);
     }
 
+    @Override
+    public void Browser_SetViewGeometry(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100) throws org.apache.thrift.TException
+    {
+      send_Browser_SetViewGeometry(bid, viewRect, screenInfo, screenPoint0, screenPoint100);
+    }
+
+    public void send_Browser_SetViewGeometry(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100) throws org.apache.thrift.TException
+    {
+      Browser_SetViewGeometry_args args = new Browser_SetViewGeometry_args();
+      args.setBid(bid);
+      args.setViewRect(viewRect);
+      args.setScreenInfo(screenInfo);
+      args.setScreenPoint0(screenPoint0);
+      args.setScreenPoint100(screenPoint100);
+      sendBaseOneway("Browser_SetViewGeometry", args);
+    }
+
+    @Override
+    public void Browser_SetResourceRules(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules) throws org.apache.thrift.TException
+    {
+      send_Browser_SetResourceRules(bid, rules);
+    }
+
+    public void send_Browser_SetResourceRules(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules) throws org.apache.thrift.TException
+    {
+      Browser_SetResourceRules_args args = new Browser_SetResourceRules_args();
+      args.setBid(bid);
+      args.setRules(rules);
+      sendBaseOneway("Browser_SetResourceRules", args);
+    }
+
     @Override
     public void Browser_SendKeyEvent(int bid, int event_type, int modifiers, short key_char, long scanCode, int key_code) throws org.apache.thrift.TException
     {
@@ -1827,6 +1893,38 @@ public class Server {
       }
     }
 
+    @Override
+    public void metrics(org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      metrics_call method_call = new metrics_call(resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class metrics_call extends org.apache.thrift.async.TAsyncMethodCall<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> {
+      public metrics_call(org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, false);
+      }
+
+      @Override
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("metrics", org.apache.thrift.protocol.TMessageType.CALL, 0));
+        metrics_args args = new metrics_args();
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      @Override
+      public com.jetbrains.cef.remote.thrift_codegen.ServerMetrics getResult() throws org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new java.lang.IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return (new Client(prot)).recv_metrics();
+      }
+    }
+
     @Override
     public void stop(org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
       checkReady();
@@ -2227,6 +2325,91 @@ public class Server {
       }
     }
 
+    @Override
+    public void Browser_SetViewGeometry(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      Browser_SetViewGeometry_call method_call = new Browser_SetViewGeometry_call(bid, viewRect, screenInfo, screenPoint0, screenPoint100, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class Browser_SetViewGeometry_call extends org.apache.thrift.async.TAsyncMethodCall<Void> {
+      private int bid;
+      private com.jetbrains.cef.remote.thrift_codegen.Rect viewRect;
+      private com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo;
+      private com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0;
+      private com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100;
+      public Browser_SetViewGeometry_call(int bid, com.jetbrains.cef.remote.thrift_codegen.Rect viewRect, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0, com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, true);
+        this.bid = bid;
+        this.viewRect = viewRect;
+        this.screenInfo = screenInfo;
+        this.screenPoint0 = screenPoint0;
+        this.screenPoint100 = screenPoint100;
+      }
+
+      @Override
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("Browser_SetViewGeometry", org.apache.thrift.protocol.TMessageType.ONEWAY, 0));
+        Browser_SetViewGeometry_args args = new Browser_SetViewGeometry_args();
+        args.setBid(bid);
+        args.setViewRect(viewRect);
+        args.setScreenInfo(screenInfo);
+        args.setScreenPoint0(screenPoint0);
+        args.setScreenPoint100(screenPoint100);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      @Override
+      public Void getResult() throws org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new java.lang.IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return null;
+      }
+    }
+
+    @Override
+    public void Browser_SetResourceRules(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      Browser_SetResourceRules_call method_call = new Browser_SetResourceRules_call(bid, rules, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class Browser_SetResourceRules_call extends org.apache.thrift.async.TAsyncMethodCall<Void> {
+      private int bid;
+      private java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules;
+      public Browser_SetResourceRules_call(int bid, java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, true);
+        this.bid = bid;
+        this.rules = rules;
+      }
+
+      @Override
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("Browser_SetResourceRules", org.apache.thrift.protocol.TMessageType.ONEWAY, 0));
+        Browser_SetResourceRules_args args = new Browser_SetResourceRules_args();
+        args.setBid(bid);
+        args.setRules(rules);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      @Override
+      public Void getResult() throws org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new java.lang.IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        return null;
+      }
+    }
+
     @Override
     public void Browser_SendKeyEvent(int bid, int event_type, int modifiers, short key_char, long scanCode, int key_code, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
       checkReady();
@@ -4250,6 +4433,7 @@ public class Server {
       processMap.put("echo", new echo());
       processMap.put("version", new version());
       processMap.put("state", new state());
+      processMap.put("metrics", new metrics());
       processMap.put("stop", new stop());
       processMap.put("createBrowser", new createBrowser());
       processMap.put("startBrowserCreation", new startBrowserCreation());
@@ -4261,6 +4445,8 @@ public class Server {
       processMap.put("Browser_ExecuteJavaScript", new Browser_ExecuteJavaScript());
       processMap.put("Browser_WasResized", new Browser_WasResized());
       processMap.put("Browser_NotifyScreenInfoChanged", new Browser_NotifyScreenInfoChanged());
+      processMap.put("Browser_SetViewGeometry", new Browser_SetViewGeometry());
+      processMap.put("Browser_SetResourceRules", new Browser_SetResourceRules());
       processMap.put("Browser_SendKeyEvent", new Browser_SendKeyEvent());
       processMap.put("Browser_SendMouseEvent", new Browser_SendMouseEvent());
       processMap.put("Browser_SendMouseWheelEvent", new Browser_SendMouseWheelEvent());
@@ -4485,6 +4671,34 @@ public class Server {
       }
     }
 
+    public static class metrics<I extends Iface> extends org.apache.thrift.ProcessFunction<I, metrics_args> {
+      public metrics() {
+        super("metrics");
+      }
+
+      @Override
+      public metrics_args getEmptyArgsInstance() {
+        return new metrics_args();
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      protected boolean rethrowUnhandledExceptions() {
+        return false;
+      }
+
+      @Override
+      public metrics_result getResult(I iface, metrics_args args) throws org.apache.thrift.TException {
+        metrics_result result = new metrics_result();
+        result.success = iface.metrics();
+        return result;
+      }
+    }
+
     public static class stop<I extends Iface> extends org.apache.thrift.ProcessFunction<I, stop_args> {
       public stop() {
         super("stop");
@@ -4785,6 +4999,60 @@ public class Server {
       }
     }
 
+    public static class Browser_SetViewGeometry<I extends Iface> extends org.apache.thrift.ProcessFunction<I, Browser_SetViewGeometry_args> {
+      public Browser_SetViewGeometry() {
+        super("Browser_SetViewGeometry");
+      }
+
+      @Override
+      public Browser_SetViewGeometry_args getEmptyArgsInstance() {
+        return new Browser_SetViewGeometry_args();
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      protected boolean rethrowUnhandledExceptions() {
+        return false;
+      }
+
+      @Override
+      public org.apache.thrift.TBase getResult(I iface, Browser_SetViewGeometry_args args) throws org.apache.thrift.TException {
+        iface.Browser_SetViewGeometry(args.bid, args.viewRect, args.screenInfo, args.screenPoint0, args.screenPoint100);
+        return null;
+      }
+    }
+
+    public static class Browser_SetResourceRules<I extends Iface> extends org.apache.thrift.ProcessFunction<I, Browser_SetResourceRules_args> {
+      public Browser_SetResourceRules() {
+        super("Browser_SetResourceRules");
+      }
+
+      @Override
+      public Browser_SetResourceRules_args getEmptyArgsInstance() {
+        return new Browser_SetResourceRules_args();
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      protected boolean rethrowUnhandledExceptions() {
+        return false;
+      }
+
+      @Override
+      public org.apache.thrift.TBase getResult(I iface, Browser_SetResourceRules_args args) throws org.apache.thrift.TException {
+        iface.Browser_SetResourceRules(args.bid, args.rules);
+        return null;
+      }
+    }
+
     public static class Browser_SendKeyEvent<I extends Iface> extends org.apache.thrift.ProcessFunction<I, Browser_SendKeyEvent_args> {
       public Browser_SendKeyEvent() {
         super("Browser_SendKeyEvent");
@@ -6241,6 +6509,7 @@ public class Server {
       processMap.put("echo", new echo());
       processMap.put("version", new version());
       processMap.put("state", new state());
+      processMap.put("metrics", new metrics());
       processMap.put("stop", new stop());
       processMap.put("createBrowser", new createBrowser());
       processMap.put("startBrowserCreation", new startBrowserCreation());
@@ -6252,6 +6521,8 @@ public class Server {
       processMap.put("Browser_ExecuteJavaScript", new Browser_ExecuteJavaScript());
       processMap.put("Browser_WasResized", new Browser_WasResized());
       processMap.put("Browser_NotifyScreenInfoChanged", new Browser_NotifyScreenInfoChanged());
+      processMap.put("Browser_SetViewGeometry", new Browser_SetViewGeometry());
+      processMap.put("Browser_SetResourceRules", new Browser_SetResourceRules());
       processMap.put("Browser_SendKeyEvent", new Browser_SendKeyEvent());
       processMap.put("Browser_SendMouseEvent", new Browser_SendMouseEvent());
       processMap.put("Browser_SendMouseWheelEvent", new Browser_SendMouseWheelEvent());
@@ -6684,6 +6955,73 @@ public class Server {
       }
     }
 
+    public static class metrics<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, metrics_args, com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> {
+      public metrics() {
+        super("metrics");
+      }
+
+      @Override
+      public metrics_args getEmptyArgsInstance() {
+        return new metrics_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics>() { 
+          @Override
+          public void onComplete(com.jetbrains.cef.remote.thrift_codegen.ServerMetrics o) {
+            metrics_result result = new metrics_result();
+            result.success = o;
+            try {
+              fcall.sendResponse(fb, result, org.apache.thrift.protocol.TMessageType.REPLY,seqid);
+            } catch (org.apache.thrift.transport.TTransportException e) {
+              _LOGGER.error("TTransportException writing to internal frame buffer", e);
+              fb.close();
+            } catch (java.lang.Exception e) {
+              _LOGGER.error("Exception writing to internal frame buffer", e);
+              onError(e);
+            }
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            byte msgType = org.apache.thrift.protocol.TMessageType.REPLY;
+            org.apache.thrift.TSerializable msg;
+            metrics_result result = new metrics_result();
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+              return;
+            } else if (e instanceof org.apache.thrift.TApplicationException) {
+              _LOGGER.error("TApplicationException inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = (org.apache.thrift.TApplicationException)e;
+            } else {
+              _LOGGER.error("Exception inside handler", e);
+              msgType = org.apache.thrift.protocol.TMessageType.EXCEPTION;
+              msg = new org.apache.thrift.TApplicationException(org.apache.thrift.TApplicationException.INTERNAL_ERROR, e.getMessage());
+            }
+            try {
+              fcall.sendResponse(fb,msg,msgType,seqid);
+            } catch (java.lang.Exception ex) {
+              _LOGGER.error("Exception writing to internal frame buffer", ex);
+              fb.close();
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return false;
+      }
+
+      @Override
+      public void start(I iface, metrics_args args, org.apache.thrift.async.AsyncMethodCallback<com.jetbrains.cef.remote.thrift_codegen.ServerMetrics> resultHandler) throws org.apache.thrift.TException {
+        iface.metrics(resultHandler);
+      }
+    }
+
     public static class stop<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, stop_args, Void> {
       public stop() {
         super("stop");
@@ -7179,6 +7517,86 @@ public class Server {
       }
     }
 
+    public static class Browser_SetViewGeometry<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, Browser_SetViewGeometry_args, Void> {
+      public Browser_SetViewGeometry() {
+        super("Browser_SetViewGeometry");
+      }
+
+      @Override
+      public Browser_SetViewGeometry_args getEmptyArgsInstance() {
+        return new Browser_SetViewGeometry_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
+          @Override
+          public void onComplete(Void o) {
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+            } else {
+              _LOGGER.error("Exception inside oneway handler", e);
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      public void start(I iface, Browser_SetViewGeometry_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.Browser_SetViewGeometry(args.bid, args.viewRect, args.screenInfo, args.screenPoint0, args.screenPoint100,resultHandler);
+      }
+    }
+
+    public static class Browser_SetResourceRules<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, Browser_SetResourceRules_args, Void> {
+      public Browser_SetResourceRules() {
+        super("Browser_SetResourceRules");
+      }
+
+      @Override
+      public Browser_SetResourceRules_args getEmptyArgsInstance() {
+        return new Browser_SetResourceRules_args();
+      }
+
+      @Override
+      public org.apache.thrift.async.AsyncMethodCallback<Void> getResultHandler(final org.apache.thrift.server.AbstractNonblockingServer.AsyncFrameBuffer fb, final int seqid) {
+        final org.apache.thrift.AsyncProcessFunction fcall = this;
+        return new org.apache.thrift.async.AsyncMethodCallback<Void>() { 
+          @Override
+          public void onComplete(Void o) {
+          }
+          @Override
+          public void onError(java.lang.Exception e) {
+            if (e instanceof org.apache.thrift.transport.TTransportException) {
+              _LOGGER.error("TTransportException inside handler", e);
+              fb.close();
+            } else {
+              _LOGGER.error("Exception inside oneway handler", e);
+            }
+          }
+        };
+      }
+
+      @Override
+      protected boolean isOneway() {
+        return true;
+      }
+
+      @Override
+      public void start(I iface, Browser_SetResourceRules_args args, org.apache.thrift.async.AsyncMethodCallback<Void> resultHandler) throws org.apache.thrift.TException {
+        iface.Browser_SetResourceRules(args.bid, args.rules,resultHandler);
+      }
+    }
+
     public static class Browser_SendKeyEvent<I extends AsyncIface> extends org.apache.thrift.AsyncProcessFunction<I, Browser_SendKeyEvent_args, Void> {
       public Browser_SendKeyEvent() {
         super("Browser_SendKeyEvent");
@@ -14081,12 +14499,12 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class stop_args implements org.apache.thrift.TBase<stop_args, stop_args._Fields>, java.io.Serializable, Cloneable, Comparable<stop_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("stop_args");
+  public static class metrics_args implements org.apache.thrift.TBase<metrics_args, metrics_args._Fields>, java.io.Serializable, Cloneable, Comparable<metrics_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("metrics_args");
 
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new stop_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new stop_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new metrics_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new metrics_argsTupleSchemeFactory();
 
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -14152,21 +14570,21 @@ public class Server {
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(stop_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(metrics_args.class, metaDataMap);
     }
 
-    public stop_args() {
+    public metrics_args() {
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public stop_args(stop_args other) {
+    public metrics_args(metrics_args other) {
     }
 
     @Override
-    public stop_args deepCopy() {
-      return new stop_args(this);
+    public metrics_args deepCopy() {
+      return new metrics_args(this);
     }
 
     @Override
@@ -14201,12 +14619,12 @@ public class Server {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof stop_args)
-        return this.equals((stop_args)that);
+      if (that instanceof metrics_args)
+        return this.equals((metrics_args)that);
       return false;
     }
 
-    public boolean equals(stop_args that) {
+    public boolean equals(metrics_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -14223,7 +14641,7 @@ public class Server {
     }
 
     @Override
-    public int compareTo(stop_args other) {
+    public int compareTo(metrics_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -14251,7 +14669,7 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("stop_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("metrics_args(");
       boolean first = true;
 
       sb.append(")");
@@ -14279,17 +14697,17 @@ public class Server {
       }
     }
 
-    private static class stop_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class metrics_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public stop_argsStandardScheme getScheme() {
-        return new stop_argsStandardScheme();
+      public metrics_argsStandardScheme getScheme() {
+        return new metrics_argsStandardScheme();
       }
     }
 
-    private static class stop_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<stop_args> {
+    private static class metrics_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<metrics_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, stop_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, metrics_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -14311,7 +14729,7 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, stop_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, metrics_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -14321,22 +14739,22 @@ public class Server {
 
     }
 
-    private static class stop_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class metrics_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public stop_argsTupleScheme getScheme() {
-        return new stop_argsTupleScheme();
+      public metrics_argsTupleScheme getScheme() {
+        return new metrics_argsTupleScheme();
       }
     }
 
-    private static class stop_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<stop_args> {
+    private static class metrics_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<metrics_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, stop_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, metrics_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, stop_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, metrics_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
       }
     }
@@ -14347,22 +14765,19 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class createBrowser_args implements org.apache.thrift.TBase<createBrowser_args, createBrowser_args._Fields>, java.io.Serializable, Cloneable, Comparable<createBrowser_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("createBrowser_args");
+  public static class metrics_result implements org.apache.thrift.TBase<metrics_result, metrics_result._Fields>, java.io.Serializable, Cloneable, Comparable<metrics_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("metrics_result");
 
-    private static final org.apache.thrift.protocol.TField CID_FIELD_DESC = new org.apache.thrift.protocol.TField("cid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField HANDLERS_MASK_FIELD_DESC = new org.apache.thrift.protocol.TField("handlersMask", org.apache.thrift.protocol.TType.I32, (short)2);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new createBrowser_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new createBrowser_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new metrics_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new metrics_resultTupleSchemeFactory();
 
-    public int cid; // required
-    public int handlersMask; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ServerMetrics success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      CID((short)1, "cid"),
-      HANDLERS_MASK((short)2, "handlersMask");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -14378,10 +14793,8 @@ public class Server {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // CID
-            return CID;
-          case 2: // HANDLERS_MASK
-            return HANDLERS_MASK;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -14425,118 +14838,77 @@ public class Server {
     }
 
     // isset id assignments
-    private static final int __CID_ISSET_ID = 0;
-    private static final int __HANDLERSMASK_ISSET_ID = 1;
-    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.CID, new org.apache.thrift.meta_data.FieldMetaData("cid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.HANDLERS_MASK, new org.apache.thrift.meta_data.FieldMetaData("handlersMask", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ServerMetrics.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(createBrowser_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(metrics_result.class, metaDataMap);
     }
 
-    public createBrowser_args() {
+    public metrics_result() {
     }
 
-    public createBrowser_args(
-      int cid,
-      int handlersMask)
+    public metrics_result(
+      com.jetbrains.cef.remote.thrift_codegen.ServerMetrics success)
     {
       this();
-      this.cid = cid;
-      setCidIsSet(true);
-      this.handlersMask = handlersMask;
-      setHandlersMaskIsSet(true);
+      this.success = success;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public createBrowser_args(createBrowser_args other) {
-      __isset_bitfield = other.__isset_bitfield;
-      this.cid = other.cid;
-      this.handlersMask = other.handlersMask;
+    public metrics_result(metrics_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new com.jetbrains.cef.remote.thrift_codegen.ServerMetrics(other.success);
+      }
     }
 
     @Override
-    public createBrowser_args deepCopy() {
-      return new createBrowser_args(this);
+    public metrics_result deepCopy() {
+      return new metrics_result(this);
     }
 
     @Override
     public void clear() {
-      setCidIsSet(false);
-      this.cid = 0;
-      setHandlersMaskIsSet(false);
-      this.handlersMask = 0;
-    }
-
-    public int getCid() {
-      return this.cid;
-    }
-
-    public createBrowser_args setCid(int cid) {
-      this.cid = cid;
-      setCidIsSet(true);
-      return this;
-    }
-
-    public void unsetCid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __CID_ISSET_ID);
-    }
-
-    /** Returns true if field cid is set (has been assigned a value) and false otherwise */
-    public boolean isSetCid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __CID_ISSET_ID);
-    }
-
-    public void setCidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __CID_ISSET_ID, value);
+      this.success = null;
     }
 
-    public int getHandlersMask() {
-      return this.handlersMask;
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.ServerMetrics getSuccess() {
+      return this.success;
     }
 
-    public createBrowser_args setHandlersMask(int handlersMask) {
-      this.handlersMask = handlersMask;
-      setHandlersMaskIsSet(true);
+    public metrics_result setSuccess(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ServerMetrics success) {
+      this.success = success;
       return this;
     }
 
-    public void unsetHandlersMask() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID);
+    public void unsetSuccess() {
+      this.success = null;
     }
 
-    /** Returns true if field handlersMask is set (has been assigned a value) and false otherwise */
-    public boolean isSetHandlersMask() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return this.success != null;
     }
 
-    public void setHandlersMaskIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case CID:
-        if (value == null) {
-          unsetCid();
-        } else {
-          setCid((java.lang.Integer)value);
-        }
-        break;
-
-      case HANDLERS_MASK:
+      case SUCCESS:
         if (value == null) {
-          unsetHandlersMask();
+          unsetSuccess();
         } else {
-          setHandlersMask((java.lang.Integer)value);
+          setSuccess((com.jetbrains.cef.remote.thrift_codegen.ServerMetrics)value);
         }
         break;
 
@@ -14547,11 +14919,8 @@ public class Server {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case CID:
-        return getCid();
-
-      case HANDLERS_MASK:
-        return getHandlersMask();
+      case SUCCESS:
+        return getSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -14565,42 +14934,31 @@ public class Server {
       }
 
       switch (field) {
-      case CID:
-        return isSetCid();
-      case HANDLERS_MASK:
-        return isSetHandlersMask();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof createBrowser_args)
-        return this.equals((createBrowser_args)that);
+      if (that instanceof metrics_result)
+        return this.equals((metrics_result)that);
       return false;
     }
 
-    public boolean equals(createBrowser_args that) {
+    public boolean equals(metrics_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_cid = true;
-      boolean that_present_cid = true;
-      if (this_present_cid || that_present_cid) {
-        if (!(this_present_cid && that_present_cid))
-          return false;
-        if (this.cid != that.cid)
-          return false;
-      }
-
-      boolean this_present_handlersMask = true;
-      boolean that_present_handlersMask = true;
-      if (this_present_handlersMask || that_present_handlersMask) {
-        if (!(this_present_handlersMask && that_present_handlersMask))
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.handlersMask != that.handlersMask)
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -14611,37 +14969,27 @@ public class Server {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + cid;
-
-      hashCode = hashCode * 8191 + handlersMask;
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(createBrowser_args other) {
+    public int compareTo(metrics_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetCid(), other.isSetCid());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetCid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.cid, other.cid);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetHandlersMask(), other.isSetHandlersMask());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetHandlersMask()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.handlersMask, other.handlersMask);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -14660,22 +15008,21 @@ public class Server {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("createBrowser_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("metrics_result(");
       boolean first = true;
 
-      sb.append("cid:");
-      sb.append(this.cid);
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("handlersMask:");
-      sb.append(this.handlersMask);
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -14684,6 +15031,9 @@ public class Server {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
+      if (success != null) {
+        success.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -14696,25 +15046,23 @@ public class Server {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class createBrowser_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class metrics_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public createBrowser_argsStandardScheme getScheme() {
-        return new createBrowser_argsStandardScheme();
+      public metrics_resultStandardScheme getScheme() {
+        return new metrics_resultStandardScheme();
       }
     }
 
-    private static class createBrowser_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<createBrowser_args> {
+    private static class metrics_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<metrics_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, createBrowser_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, metrics_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -14724,18 +15072,11 @@ public class Server {
             break;
           }
           switch (schemeField.id) {
-            case 1: // CID
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.cid = iprot.readI32();
-                struct.setCidIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 2: // HANDLERS_MASK
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.handlersMask = iprot.readI32();
-                struct.setHandlersMaskIsSet(true);
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.success = new com.jetbrains.cef.remote.thrift_codegen.ServerMetrics();
+                struct.success.read(iprot);
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -14752,61 +15093,51 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, createBrowser_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, metrics_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(CID_FIELD_DESC);
-        oprot.writeI32(struct.cid);
-        oprot.writeFieldEnd();
-        oprot.writeFieldBegin(HANDLERS_MASK_FIELD_DESC);
-        oprot.writeI32(struct.handlersMask);
-        oprot.writeFieldEnd();
+        if (struct.success != null) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          struct.success.write(oprot);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class createBrowser_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class metrics_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public createBrowser_argsTupleScheme getScheme() {
-        return new createBrowser_argsTupleScheme();
+      public metrics_resultTupleScheme getScheme() {
+        return new metrics_resultTupleScheme();
       }
     }
 
-    private static class createBrowser_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<createBrowser_args> {
+    private static class metrics_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<metrics_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, createBrowser_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, metrics_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetCid()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
-        if (struct.isSetHandlersMask()) {
-          optionals.set(1);
-        }
-        oprot.writeBitSet(optionals, 2);
-        if (struct.isSetCid()) {
-          oprot.writeI32(struct.cid);
-        }
-        if (struct.isSetHandlersMask()) {
-          oprot.writeI32(struct.handlersMask);
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetSuccess()) {
+          struct.success.write(oprot);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, createBrowser_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, metrics_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(2);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.cid = iprot.readI32();
-          struct.setCidIsSet(true);
-        }
-        if (incoming.get(1)) {
-          struct.handlersMask = iprot.readI32();
-          struct.setHandlersMaskIsSet(true);
+          struct.success = new com.jetbrains.cef.remote.thrift_codegen.ServerMetrics();
+          struct.success.read(iprot);
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -14817,19 +15148,17 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class createBrowser_result implements org.apache.thrift.TBase<createBrowser_result, createBrowser_result._Fields>, java.io.Serializable, Cloneable, Comparable<createBrowser_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("createBrowser_result");
+  public static class stop_args implements org.apache.thrift.TBase<stop_args, stop_args._Fields>, java.io.Serializable, Cloneable, Comparable<stop_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("stop_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I32, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new createBrowser_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new createBrowser_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new stop_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new stop_argsTupleSchemeFactory();
 
-    public int success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+;
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -14845,8 +15174,6 @@ public class Server {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
           default:
             return null;
         }
@@ -14888,83 +15215,34 @@ public class Server {
         return _fieldName;
       }
     }
-
-    // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(createBrowser_result.class, metaDataMap);
-    }
-
-    public createBrowser_result() {
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(stop_args.class, metaDataMap);
     }
 
-    public createBrowser_result(
-      int success)
-    {
-      this();
-      this.success = success;
-      setSuccessIsSet(true);
+    public stop_args() {
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public createBrowser_result(createBrowser_result other) {
-      __isset_bitfield = other.__isset_bitfield;
-      this.success = other.success;
+    public stop_args(stop_args other) {
     }
 
     @Override
-    public createBrowser_result deepCopy() {
-      return new createBrowser_result(this);
+    public stop_args deepCopy() {
+      return new stop_args(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = 0;
-    }
-
-    public int getSuccess() {
-      return this.success;
-    }
-
-    public createBrowser_result setSuccess(int success) {
-      this.success = success;
-      setSuccessIsSet(true);
-      return this;
-    }
-
-    public void unsetSuccess() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
-    }
-
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
-    }
-
-    public void setSuccessIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((java.lang.Integer)value);
-        }
-        break;
-
       }
     }
 
@@ -14972,9 +15250,6 @@ public class Server {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
-
       }
       throw new java.lang.IllegalStateException();
     }
@@ -14987,34 +15262,23 @@ public class Server {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof createBrowser_result)
-        return this.equals((createBrowser_result)that);
+      if (that instanceof stop_args)
+        return this.equals((stop_args)that);
       return false;
     }
 
-    public boolean equals(createBrowser_result that) {
+    public boolean equals(stop_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
-      }
-
       return true;
     }
 
@@ -15022,29 +15286,17 @@ public class Server {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + success;
-
       return hashCode;
     }
 
     @Override
-    public int compareTo(createBrowser_result other) {
+    public int compareTo(stop_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       return 0;
     }
 
@@ -15059,18 +15311,16 @@ public class Server {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("createBrowser_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("stop_args(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
-      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -15090,25 +15340,23 @@ public class Server {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class createBrowser_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class stop_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public createBrowser_resultStandardScheme getScheme() {
-        return new createBrowser_resultStandardScheme();
+      public stop_argsStandardScheme getScheme() {
+        return new stop_argsStandardScheme();
       }
     }
 
-    private static class createBrowser_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<createBrowser_result> {
+    private static class stop_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<stop_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, createBrowser_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, stop_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -15118,14 +15366,6 @@ public class Server {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.success = iprot.readI32();
-                struct.setSuccessIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -15138,51 +15378,33 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, createBrowser_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, stop_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.isSetSuccess()) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeI32(struct.success);
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class createBrowser_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class stop_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public createBrowser_resultTupleScheme getScheme() {
-        return new createBrowser_resultTupleScheme();
+      public stop_argsTupleScheme getScheme() {
+        return new stop_argsTupleScheme();
       }
     }
 
-    private static class createBrowser_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<createBrowser_result> {
+    private static class stop_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<stop_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, createBrowser_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, stop_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
-          optionals.set(0);
-        }
-        oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          oprot.writeI32(struct.success);
-        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, createBrowser_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, stop_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
-        if (incoming.get(0)) {
-          struct.success = iprot.readI32();
-          struct.setSuccessIsSet(true);
-        }
       }
     }
 
@@ -15192,22 +15414,22 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class startBrowserCreation_args implements org.apache.thrift.TBase<startBrowserCreation_args, startBrowserCreation_args._Fields>, java.io.Serializable, Cloneable, Comparable<startBrowserCreation_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("startBrowserCreation_args");
+  public static class createBrowser_args implements org.apache.thrift.TBase<createBrowser_args, createBrowser_args._Fields>, java.io.Serializable, Cloneable, Comparable<createBrowser_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("createBrowser_args");
 
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
+    private static final org.apache.thrift.protocol.TField CID_FIELD_DESC = new org.apache.thrift.protocol.TField("cid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField HANDLERS_MASK_FIELD_DESC = new org.apache.thrift.protocol.TField("handlersMask", org.apache.thrift.protocol.TType.I32, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new startBrowserCreation_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new startBrowserCreation_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new createBrowser_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new createBrowser_argsTupleSchemeFactory();
 
-    public int bid; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
+    public int cid; // required
+    public int handlersMask; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid"),
-      URL((short)2, "url");
+      CID((short)1, "cid"),
+      HANDLERS_MASK((short)2, "handlersMask");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -15223,10 +15445,10 @@ public class Server {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // BID
-            return BID;
-          case 2: // URL
-            return URL;
+          case 1: // CID
+            return CID;
+          case 2: // HANDLERS_MASK
+            return HANDLERS_MASK;
           default:
             return null;
         }
@@ -15270,119 +15492,118 @@ public class Server {
     }
 
     // isset id assignments
-    private static final int __BID_ISSET_ID = 0;
+    private static final int __CID_ISSET_ID = 0;
+    private static final int __HANDLERSMASK_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.CID, new org.apache.thrift.meta_data.FieldMetaData("cid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.HANDLERS_MASK, new org.apache.thrift.meta_data.FieldMetaData("handlersMask", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(startBrowserCreation_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(createBrowser_args.class, metaDataMap);
     }
 
-    public startBrowserCreation_args() {
+    public createBrowser_args() {
     }
 
-    public startBrowserCreation_args(
-      int bid,
-      java.lang.String url)
+    public createBrowser_args(
+      int cid,
+      int handlersMask)
     {
       this();
-      this.bid = bid;
-      setBidIsSet(true);
-      this.url = url;
+      this.cid = cid;
+      setCidIsSet(true);
+      this.handlersMask = handlersMask;
+      setHandlersMaskIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public startBrowserCreation_args(startBrowserCreation_args other) {
+    public createBrowser_args(createBrowser_args other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.bid = other.bid;
-      if (other.isSetUrl()) {
-        this.url = other.url;
-      }
+      this.cid = other.cid;
+      this.handlersMask = other.handlersMask;
     }
 
     @Override
-    public startBrowserCreation_args deepCopy() {
-      return new startBrowserCreation_args(this);
+    public createBrowser_args deepCopy() {
+      return new createBrowser_args(this);
     }
 
     @Override
     public void clear() {
-      setBidIsSet(false);
-      this.bid = 0;
-      this.url = null;
+      setCidIsSet(false);
+      this.cid = 0;
+      setHandlersMaskIsSet(false);
+      this.handlersMask = 0;
     }
 
-    public int getBid() {
-      return this.bid;
+    public int getCid() {
+      return this.cid;
     }
 
-    public startBrowserCreation_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
+    public createBrowser_args setCid(int cid) {
+      this.cid = cid;
+      setCidIsSet(true);
       return this;
     }
 
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    public void unsetCid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __CID_ISSET_ID);
     }
 
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    /** Returns true if field cid is set (has been assigned a value) and false otherwise */
+    public boolean isSetCid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __CID_ISSET_ID);
     }
 
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    public void setCidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __CID_ISSET_ID, value);
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getUrl() {
-      return this.url;
+    public int getHandlersMask() {
+      return this.handlersMask;
     }
 
-    public startBrowserCreation_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
-      this.url = url;
+    public createBrowser_args setHandlersMask(int handlersMask) {
+      this.handlersMask = handlersMask;
+      setHandlersMaskIsSet(true);
       return this;
     }
 
-    public void unsetUrl() {
-      this.url = null;
+    public void unsetHandlersMask() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID);
     }
 
-    /** Returns true if field url is set (has been assigned a value) and false otherwise */
-    public boolean isSetUrl() {
-      return this.url != null;
+    /** Returns true if field handlersMask is set (has been assigned a value) and false otherwise */
+    public boolean isSetHandlersMask() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID);
     }
 
-    public void setUrlIsSet(boolean value) {
-      if (!value) {
-        this.url = null;
-      }
+    public void setHandlersMaskIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __HANDLERSMASK_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case BID:
+      case CID:
         if (value == null) {
-          unsetBid();
+          unsetCid();
         } else {
-          setBid((java.lang.Integer)value);
+          setCid((java.lang.Integer)value);
         }
         break;
 
-      case URL:
+      case HANDLERS_MASK:
         if (value == null) {
-          unsetUrl();
+          unsetHandlersMask();
         } else {
-          setUrl((java.lang.String)value);
+          setHandlersMask((java.lang.Integer)value);
         }
         break;
 
@@ -15393,11 +15614,11 @@ public class Server {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case BID:
-        return getBid();
+      case CID:
+        return getCid();
 
-      case URL:
-        return getUrl();
+      case HANDLERS_MASK:
+        return getHandlersMask();
 
       }
       throw new java.lang.IllegalStateException();
@@ -15411,42 +15632,42 @@ public class Server {
       }
 
       switch (field) {
-      case BID:
-        return isSetBid();
-      case URL:
-        return isSetUrl();
+      case CID:
+        return isSetCid();
+      case HANDLERS_MASK:
+        return isSetHandlersMask();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof startBrowserCreation_args)
-        return this.equals((startBrowserCreation_args)that);
+      if (that instanceof createBrowser_args)
+        return this.equals((createBrowser_args)that);
       return false;
     }
 
-    public boolean equals(startBrowserCreation_args that) {
+    public boolean equals(createBrowser_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
+      boolean this_present_cid = true;
+      boolean that_present_cid = true;
+      if (this_present_cid || that_present_cid) {
+        if (!(this_present_cid && that_present_cid))
           return false;
-        if (this.bid != that.bid)
+        if (this.cid != that.cid)
           return false;
       }
 
-      boolean this_present_url = true && this.isSetUrl();
-      boolean that_present_url = true && that.isSetUrl();
-      if (this_present_url || that_present_url) {
-        if (!(this_present_url && that_present_url))
+      boolean this_present_handlersMask = true;
+      boolean that_present_handlersMask = true;
+      if (this_present_handlersMask || that_present_handlersMask) {
+        if (!(this_present_handlersMask && that_present_handlersMask))
           return false;
-        if (!this.url.equals(that.url))
+        if (this.handlersMask != that.handlersMask)
           return false;
       }
 
@@ -15457,39 +15678,37 @@ public class Server {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + bid;
+      hashCode = hashCode * 8191 + cid;
 
-      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
-      if (isSetUrl())
-        hashCode = hashCode * 8191 + url.hashCode();
+      hashCode = hashCode * 8191 + handlersMask;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(startBrowserCreation_args other) {
+    public int compareTo(createBrowser_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      lastComparison = java.lang.Boolean.compare(isSetCid(), other.isSetCid());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+      if (isSetCid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.cid, other.cid);
         if (lastComparison != 0) {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      lastComparison = java.lang.Boolean.compare(isSetHandlersMask(), other.isSetHandlersMask());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetUrl()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+      if (isSetHandlersMask()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.handlersMask, other.handlersMask);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -15515,19 +15734,15 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("startBrowserCreation_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("createBrowser_args(");
       boolean first = true;
 
-      sb.append("bid:");
-      sb.append(this.bid);
+      sb.append("cid:");
+      sb.append(this.cid);
       first = false;
       if (!first) sb.append(", ");
-      sb.append("url:");
-      if (this.url == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.url);
-      }
+      sb.append("handlersMask:");
+      sb.append(this.handlersMask);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -15556,17 +15771,17 @@ public class Server {
       }
     }
 
-    private static class startBrowserCreation_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class createBrowser_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public startBrowserCreation_argsStandardScheme getScheme() {
-        return new startBrowserCreation_argsStandardScheme();
+      public createBrowser_argsStandardScheme getScheme() {
+        return new createBrowser_argsStandardScheme();
       }
     }
 
-    private static class startBrowserCreation_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<startBrowserCreation_args> {
+    private static class createBrowser_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<createBrowser_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, createBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -15576,18 +15791,18 @@ public class Server {
             break;
           }
           switch (schemeField.id) {
-            case 1: // BID
+            case 1: // CID
               if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.bid = iprot.readI32();
-                struct.setBidIsSet(true);
+                struct.cid = iprot.readI32();
+                struct.setCidIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // URL
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.url = iprot.readString();
-                struct.setUrlIsSet(true);
+            case 2: // HANDLERS_MASK
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.handlersMask = iprot.readI32();
+                struct.setHandlersMaskIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -15604,63 +15819,61 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, createBrowser_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(BID_FIELD_DESC);
-        oprot.writeI32(struct.bid);
+        oprot.writeFieldBegin(CID_FIELD_DESC);
+        oprot.writeI32(struct.cid);
+        oprot.writeFieldEnd();
+        oprot.writeFieldBegin(HANDLERS_MASK_FIELD_DESC);
+        oprot.writeI32(struct.handlersMask);
         oprot.writeFieldEnd();
-        if (struct.url != null) {
-          oprot.writeFieldBegin(URL_FIELD_DESC);
-          oprot.writeString(struct.url);
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class startBrowserCreation_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class createBrowser_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public startBrowserCreation_argsTupleScheme getScheme() {
-        return new startBrowserCreation_argsTupleScheme();
+      public createBrowser_argsTupleScheme getScheme() {
+        return new createBrowser_argsTupleScheme();
       }
     }
 
-    private static class startBrowserCreation_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<startBrowserCreation_args> {
+    private static class createBrowser_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<createBrowser_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, createBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetBid()) {
+        if (struct.isSetCid()) {
           optionals.set(0);
         }
-        if (struct.isSetUrl()) {
+        if (struct.isSetHandlersMask()) {
           optionals.set(1);
         }
         oprot.writeBitSet(optionals, 2);
-        if (struct.isSetBid()) {
-          oprot.writeI32(struct.bid);
+        if (struct.isSetCid()) {
+          oprot.writeI32(struct.cid);
         }
-        if (struct.isSetUrl()) {
-          oprot.writeString(struct.url);
+        if (struct.isSetHandlersMask()) {
+          oprot.writeI32(struct.handlersMask);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, createBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
-          struct.bid = iprot.readI32();
-          struct.setBidIsSet(true);
+          struct.cid = iprot.readI32();
+          struct.setCidIsSet(true);
         }
         if (incoming.get(1)) {
-          struct.url = iprot.readString();
-          struct.setUrlIsSet(true);
+          struct.handlersMask = iprot.readI32();
+          struct.setHandlersMaskIsSet(true);
         }
       }
     }
@@ -15671,19 +15884,19 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class closeBrowser_args implements org.apache.thrift.TBase<closeBrowser_args, closeBrowser_args._Fields>, java.io.Serializable, Cloneable, Comparable<closeBrowser_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("closeBrowser_args");
+  public static class createBrowser_result implements org.apache.thrift.TBase<createBrowser_result, createBrowser_result._Fields>, java.io.Serializable, Cloneable, Comparable<createBrowser_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("createBrowser_result");
 
-    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I32, (short)0);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new closeBrowser_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new closeBrowser_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new createBrowser_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new createBrowser_resultTupleSchemeFactory();
 
-    public int bid; // required
+    public int success; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      SUCCESS((short)0, "success");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -15699,8 +15912,8 @@ public class Server {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // BID
-            return BID;
+          case 0: // SUCCESS
+            return SUCCESS;
           default:
             return null;
         }
@@ -15744,78 +15957,78 @@ public class Server {
     }
 
     // isset id assignments
-    private static final int __BID_ISSET_ID = 0;
+    private static final int __SUCCESS_ISSET_ID = 0;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(closeBrowser_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(createBrowser_result.class, metaDataMap);
     }
 
-    public closeBrowser_args() {
+    public createBrowser_result() {
     }
 
-    public closeBrowser_args(
-      int bid)
+    public createBrowser_result(
+      int success)
     {
       this();
-      this.bid = bid;
-      setBidIsSet(true);
+      this.success = success;
+      setSuccessIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public closeBrowser_args(closeBrowser_args other) {
+    public createBrowser_result(createBrowser_result other) {
       __isset_bitfield = other.__isset_bitfield;
-      this.bid = other.bid;
+      this.success = other.success;
     }
 
     @Override
-    public closeBrowser_args deepCopy() {
-      return new closeBrowser_args(this);
+    public createBrowser_result deepCopy() {
+      return new createBrowser_result(this);
     }
 
     @Override
     public void clear() {
-      setBidIsSet(false);
-      this.bid = 0;
+      setSuccessIsSet(false);
+      this.success = 0;
     }
 
-    public int getBid() {
-      return this.bid;
+    public int getSuccess() {
+      return this.success;
     }
 
-    public closeBrowser_args setBid(int bid) {
-      this.bid = bid;
-      setBidIsSet(true);
+    public createBrowser_result setSuccess(int success) {
+      this.success = success;
+      setSuccessIsSet(true);
       return this;
     }
 
-    public void unsetBid() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    public void unsetSuccess() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
-    public boolean isSetBid() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __SUCCESS_ISSET_ID);
     }
 
-    public void setBidIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    public void setSuccessIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __SUCCESS_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case BID:
+      case SUCCESS:
         if (value == null) {
-          unsetBid();
+          unsetSuccess();
         } else {
-          setBid((java.lang.Integer)value);
+          setSuccess((java.lang.Integer)value);
         }
         break;
 
@@ -15826,8 +16039,8 @@ public class Server {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case BID:
-        return getBid();
+      case SUCCESS:
+        return getSuccess();
 
       }
       throw new java.lang.IllegalStateException();
@@ -15841,31 +16054,31 @@ public class Server {
       }
 
       switch (field) {
-      case BID:
-        return isSetBid();
+      case SUCCESS:
+        return isSetSuccess();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof closeBrowser_args)
-        return this.equals((closeBrowser_args)that);
+      if (that instanceof createBrowser_result)
+        return this.equals((createBrowser_result)that);
       return false;
     }
 
-    public boolean equals(closeBrowser_args that) {
+    public boolean equals(createBrowser_result that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_bid = true;
-      boolean that_present_bid = true;
-      if (this_present_bid || that_present_bid) {
-        if (!(this_present_bid && that_present_bid))
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
           return false;
-        if (this.bid != that.bid)
+        if (this.success != that.success)
           return false;
       }
 
@@ -15876,25 +16089,25 @@ public class Server {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + bid;
+      hashCode = hashCode * 8191 + success;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(closeBrowser_args other) {
+    public int compareTo(createBrowser_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetBid()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -15913,18 +16126,17 @@ public class Server {
       scheme(iprot).read(iprot, this);
     }
 
-    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-    }
+      }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("closeBrowser_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("createBrowser_result(");
       boolean first = true;
 
-      sb.append("bid:");
-      sb.append(this.bid);
+      sb.append("success:");
+      sb.append(this.success);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -15953,17 +16165,17 @@ public class Server {
       }
     }
 
-    private static class closeBrowser_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class createBrowser_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public closeBrowser_argsStandardScheme getScheme() {
-        return new closeBrowser_argsStandardScheme();
+      public createBrowser_resultStandardScheme getScheme() {
+        return new createBrowser_resultStandardScheme();
       }
     }
 
-    private static class closeBrowser_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<closeBrowser_args> {
+    private static class createBrowser_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<createBrowser_result> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, closeBrowser_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, createBrowser_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -15973,10 +16185,10 @@ public class Server {
             break;
           }
           switch (schemeField.id) {
-            case 1: // BID
+            case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.bid = iprot.readI32();
-                struct.setBidIsSet(true);
+                struct.success = iprot.readI32();
+                struct.setSuccessIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -15993,48 +16205,50 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, closeBrowser_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, createBrowser_result struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        oprot.writeFieldBegin(BID_FIELD_DESC);
-        oprot.writeI32(struct.bid);
-        oprot.writeFieldEnd();
+        if (struct.isSetSuccess()) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeI32(struct.success);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class closeBrowser_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class createBrowser_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public closeBrowser_argsTupleScheme getScheme() {
-        return new closeBrowser_argsTupleScheme();
+      public createBrowser_resultTupleScheme getScheme() {
+        return new createBrowser_resultTupleScheme();
       }
     }
 
-    private static class closeBrowser_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<closeBrowser_args> {
+    private static class createBrowser_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<createBrowser_result> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, closeBrowser_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, createBrowser_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetBid()) {
+        if (struct.isSetSuccess()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetBid()) {
-          oprot.writeI32(struct.bid);
+        if (struct.isSetSuccess()) {
+          oprot.writeI32(struct.success);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, closeBrowser_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, createBrowser_result struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.bid = iprot.readI32();
-          struct.setBidIsSet(true);
+          struct.success = iprot.readI32();
+          struct.setSuccessIsSet(true);
         }
       }
     }
@@ -16045,19 +16259,22 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_Reload_args implements org.apache.thrift.TBase<Browser_Reload_args, Browser_Reload_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_Reload_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_Reload_args");
+  public static class startBrowserCreation_args implements org.apache.thrift.TBase<startBrowserCreation_args, startBrowserCreation_args._Fields>, java.io.Serializable, Cloneable, Comparable<startBrowserCreation_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("startBrowserCreation_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_Reload_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_Reload_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new startBrowserCreation_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new startBrowserCreation_argsTupleSchemeFactory();
 
     public int bid; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      BID((short)1, "bid"),
+      URL((short)2, "url");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -16075,6 +16292,8 @@ public class Server {
         switch(fieldId) {
           case 1: // BID
             return BID;
+          case 2: // URL
+            return URL;
           default:
             return null;
         }
@@ -16125,45 +16344,53 @@ public class Server {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_Reload_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(startBrowserCreation_args.class, metaDataMap);
     }
 
-    public Browser_Reload_args() {
+    public startBrowserCreation_args() {
     }
 
-    public Browser_Reload_args(
-      int bid)
+    public startBrowserCreation_args(
+      int bid,
+      java.lang.String url)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
+      this.url = url;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_Reload_args(Browser_Reload_args other) {
+    public startBrowserCreation_args(startBrowserCreation_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
+      if (other.isSetUrl()) {
+        this.url = other.url;
+      }
     }
 
     @Override
-    public Browser_Reload_args deepCopy() {
-      return new Browser_Reload_args(this);
+    public startBrowserCreation_args deepCopy() {
+      return new startBrowserCreation_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
+      this.url = null;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public Browser_Reload_args setBid(int bid) {
+    public startBrowserCreation_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -16182,6 +16409,31 @@ public class Server {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getUrl() {
+      return this.url;
+    }
+
+    public startBrowserCreation_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
+      this.url = url;
+      return this;
+    }
+
+    public void unsetUrl() {
+      this.url = null;
+    }
+
+    /** Returns true if field url is set (has been assigned a value) and false otherwise */
+    public boolean isSetUrl() {
+      return this.url != null;
+    }
+
+    public void setUrlIsSet(boolean value) {
+      if (!value) {
+        this.url = null;
+      }
+    }
+
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -16193,6 +16445,14 @@ public class Server {
         }
         break;
 
+      case URL:
+        if (value == null) {
+          unsetUrl();
+        } else {
+          setUrl((java.lang.String)value);
+        }
+        break;
+
       }
     }
 
@@ -16203,6 +16463,9 @@ public class Server {
       case BID:
         return getBid();
 
+      case URL:
+        return getUrl();
+
       }
       throw new java.lang.IllegalStateException();
     }
@@ -16217,18 +16480,20 @@ public class Server {
       switch (field) {
       case BID:
         return isSetBid();
+      case URL:
+        return isSetUrl();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_Reload_args)
-        return this.equals((Browser_Reload_args)that);
+      if (that instanceof startBrowserCreation_args)
+        return this.equals((startBrowserCreation_args)that);
       return false;
     }
 
-    public boolean equals(Browser_Reload_args that) {
+    public boolean equals(startBrowserCreation_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -16243,6 +16508,15 @@ public class Server {
           return false;
       }
 
+      boolean this_present_url = true && this.isSetUrl();
+      boolean that_present_url = true && that.isSetUrl();
+      if (this_present_url || that_present_url) {
+        if (!(this_present_url && that_present_url))
+          return false;
+        if (!this.url.equals(that.url))
+          return false;
+      }
+
       return true;
     }
 
@@ -16252,11 +16526,15 @@ public class Server {
 
       hashCode = hashCode * 8191 + bid;
 
+      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
+      if (isSetUrl())
+        hashCode = hashCode * 8191 + url.hashCode();
+
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_Reload_args other) {
+    public int compareTo(startBrowserCreation_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -16273,6 +16551,16 @@ public class Server {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetUrl()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -16294,12 +16582,20 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_Reload_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("startBrowserCreation_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("url:");
+      if (this.url == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.url);
+      }
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -16327,17 +16623,17 @@ public class Server {
       }
     }
 
-    private static class Browser_Reload_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class startBrowserCreation_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_Reload_argsStandardScheme getScheme() {
-        return new Browser_Reload_argsStandardScheme();
+      public startBrowserCreation_argsStandardScheme getScheme() {
+        return new startBrowserCreation_argsStandardScheme();
       }
     }
 
-    private static class Browser_Reload_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_Reload_args> {
+    private static class startBrowserCreation_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<startBrowserCreation_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_Reload_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -16355,6 +16651,14 @@ public class Server {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
+            case 2: // URL
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.url = iprot.readString();
+                struct.setUrlIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -16367,49 +16671,64 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_Reload_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
+        if (struct.url != null) {
+          oprot.writeFieldBegin(URL_FIELD_DESC);
+          oprot.writeString(struct.url);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_Reload_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class startBrowserCreation_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_Reload_argsTupleScheme getScheme() {
-        return new Browser_Reload_argsTupleScheme();
+      public startBrowserCreation_argsTupleScheme getScheme() {
+        return new startBrowserCreation_argsTupleScheme();
       }
     }
 
-    private static class Browser_Reload_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_Reload_args> {
+    private static class startBrowserCreation_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<startBrowserCreation_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_Reload_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetUrl()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
+        if (struct.isSetUrl()) {
+          oprot.writeString(struct.url);
+        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_Reload_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, startBrowserCreation_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
+        if (incoming.get(1)) {
+          struct.url = iprot.readString();
+          struct.setUrlIsSet(true);
+        }
       }
     }
 
@@ -16419,13 +16738,13 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_ReloadIgnoreCache_args implements org.apache.thrift.TBase<Browser_ReloadIgnoreCache_args, Browser_ReloadIgnoreCache_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_ReloadIgnoreCache_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_ReloadIgnoreCache_args");
+  public static class closeBrowser_args implements org.apache.thrift.TBase<closeBrowser_args, closeBrowser_args._Fields>, java.io.Serializable, Cloneable, Comparable<closeBrowser_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("closeBrowser_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_ReloadIgnoreCache_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_ReloadIgnoreCache_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new closeBrowser_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new closeBrowser_argsTupleSchemeFactory();
 
     public int bid; // required
 
@@ -16500,13 +16819,13 @@ public class Server {
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_ReloadIgnoreCache_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(closeBrowser_args.class, metaDataMap);
     }
 
-    public Browser_ReloadIgnoreCache_args() {
+    public closeBrowser_args() {
     }
 
-    public Browser_ReloadIgnoreCache_args(
+    public closeBrowser_args(
       int bid)
     {
       this();
@@ -16517,14 +16836,14 @@ public class Server {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_ReloadIgnoreCache_args(Browser_ReloadIgnoreCache_args other) {
+    public closeBrowser_args(closeBrowser_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
     }
 
     @Override
-    public Browser_ReloadIgnoreCache_args deepCopy() {
-      return new Browser_ReloadIgnoreCache_args(this);
+    public closeBrowser_args deepCopy() {
+      return new closeBrowser_args(this);
     }
 
     @Override
@@ -16537,7 +16856,7 @@ public class Server {
       return this.bid;
     }
 
-    public Browser_ReloadIgnoreCache_args setBid(int bid) {
+    public closeBrowser_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -16597,12 +16916,12 @@ public class Server {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_ReloadIgnoreCache_args)
-        return this.equals((Browser_ReloadIgnoreCache_args)that);
+      if (that instanceof closeBrowser_args)
+        return this.equals((closeBrowser_args)that);
       return false;
     }
 
-    public boolean equals(Browser_ReloadIgnoreCache_args that) {
+    public boolean equals(closeBrowser_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -16630,7 +16949,7 @@ public class Server {
     }
 
     @Override
-    public int compareTo(Browser_ReloadIgnoreCache_args other) {
+    public int compareTo(closeBrowser_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -16668,7 +16987,7 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_ReloadIgnoreCache_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("closeBrowser_args(");
       boolean first = true;
 
       sb.append("bid:");
@@ -16701,17 +17020,17 @@ public class Server {
       }
     }
 
-    private static class Browser_ReloadIgnoreCache_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class closeBrowser_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_ReloadIgnoreCache_argsStandardScheme getScheme() {
-        return new Browser_ReloadIgnoreCache_argsStandardScheme();
+      public closeBrowser_argsStandardScheme getScheme() {
+        return new closeBrowser_argsStandardScheme();
       }
     }
 
-    private static class Browser_ReloadIgnoreCache_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_ReloadIgnoreCache_args> {
+    private static class closeBrowser_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<closeBrowser_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, closeBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -16741,7 +17060,7 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, closeBrowser_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -16754,17 +17073,17 @@ public class Server {
 
     }
 
-    private static class Browser_ReloadIgnoreCache_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class closeBrowser_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_ReloadIgnoreCache_argsTupleScheme getScheme() {
-        return new Browser_ReloadIgnoreCache_argsTupleScheme();
+      public closeBrowser_argsTupleScheme getScheme() {
+        return new closeBrowser_argsTupleScheme();
       }
     }
 
-    private static class Browser_ReloadIgnoreCache_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_ReloadIgnoreCache_args> {
+    private static class closeBrowser_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<closeBrowser_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, closeBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
@@ -16777,7 +17096,7 @@ public class Server {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, closeBrowser_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -16793,22 +17112,19 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_LoadURL_args implements org.apache.thrift.TBase<Browser_LoadURL_args, Browser_LoadURL_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_LoadURL_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_LoadURL_args");
+  public static class Browser_Reload_args implements org.apache.thrift.TBase<Browser_Reload_args, Browser_Reload_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_Reload_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_Reload_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_LoadURL_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_LoadURL_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_Reload_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_Reload_argsTupleSchemeFactory();
 
     public int bid; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid"),
-      URL((short)2, "url");
+      BID((short)1, "bid");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -16826,8 +17142,6 @@ public class Server {
         switch(fieldId) {
           case 1: // BID
             return BID;
-          case 2: // URL
-            return URL;
           default:
             return null;
         }
@@ -16878,53 +17192,45 @@ public class Server {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_LoadURL_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_Reload_args.class, metaDataMap);
     }
 
-    public Browser_LoadURL_args() {
+    public Browser_Reload_args() {
     }
 
-    public Browser_LoadURL_args(
-      int bid,
-      java.lang.String url)
+    public Browser_Reload_args(
+      int bid)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
-      this.url = url;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_LoadURL_args(Browser_LoadURL_args other) {
+    public Browser_Reload_args(Browser_Reload_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
-      if (other.isSetUrl()) {
-        this.url = other.url;
-      }
     }
 
     @Override
-    public Browser_LoadURL_args deepCopy() {
-      return new Browser_LoadURL_args(this);
+    public Browser_Reload_args deepCopy() {
+      return new Browser_Reload_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
-      this.url = null;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public Browser_LoadURL_args setBid(int bid) {
+    public Browser_Reload_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -16943,31 +17249,6 @@ public class Server {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getUrl() {
-      return this.url;
-    }
-
-    public Browser_LoadURL_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
-      this.url = url;
-      return this;
-    }
-
-    public void unsetUrl() {
-      this.url = null;
-    }
-
-    /** Returns true if field url is set (has been assigned a value) and false otherwise */
-    public boolean isSetUrl() {
-      return this.url != null;
-    }
-
-    public void setUrlIsSet(boolean value) {
-      if (!value) {
-        this.url = null;
-      }
-    }
-
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -16979,14 +17260,6 @@ public class Server {
         }
         break;
 
-      case URL:
-        if (value == null) {
-          unsetUrl();
-        } else {
-          setUrl((java.lang.String)value);
-        }
-        break;
-
       }
     }
 
@@ -16997,9 +17270,6 @@ public class Server {
       case BID:
         return getBid();
 
-      case URL:
-        return getUrl();
-
       }
       throw new java.lang.IllegalStateException();
     }
@@ -17014,20 +17284,18 @@ public class Server {
       switch (field) {
       case BID:
         return isSetBid();
-      case URL:
-        return isSetUrl();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_LoadURL_args)
-        return this.equals((Browser_LoadURL_args)that);
+      if (that instanceof Browser_Reload_args)
+        return this.equals((Browser_Reload_args)that);
       return false;
     }
 
-    public boolean equals(Browser_LoadURL_args that) {
+    public boolean equals(Browser_Reload_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -17042,15 +17310,6 @@ public class Server {
           return false;
       }
 
-      boolean this_present_url = true && this.isSetUrl();
-      boolean that_present_url = true && that.isSetUrl();
-      if (this_present_url || that_present_url) {
-        if (!(this_present_url && that_present_url))
-          return false;
-        if (!this.url.equals(that.url))
-          return false;
-      }
-
       return true;
     }
 
@@ -17060,15 +17319,11 @@ public class Server {
 
       hashCode = hashCode * 8191 + bid;
 
-      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
-      if (isSetUrl())
-        hashCode = hashCode * 8191 + url.hashCode();
-
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_LoadURL_args other) {
+    public int compareTo(Browser_Reload_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -17085,16 +17340,6 @@ public class Server {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetUrl()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       return 0;
     }
 
@@ -17116,20 +17361,12 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_LoadURL_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_Reload_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
-      if (!first) sb.append(", ");
-      sb.append("url:");
-      if (this.url == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.url);
-      }
-      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -17157,17 +17394,17 @@ public class Server {
       }
     }
 
-    private static class Browser_LoadURL_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_Reload_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_LoadURL_argsStandardScheme getScheme() {
-        return new Browser_LoadURL_argsStandardScheme();
+      public Browser_Reload_argsStandardScheme getScheme() {
+        return new Browser_Reload_argsStandardScheme();
       }
     }
 
-    private static class Browser_LoadURL_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_LoadURL_args> {
+    private static class Browser_Reload_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_Reload_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_Reload_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -17185,14 +17422,6 @@ public class Server {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // URL
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.url = iprot.readString();
-                struct.setUrlIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -17205,64 +17434,49 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_Reload_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
-        if (struct.url != null) {
-          oprot.writeFieldBegin(URL_FIELD_DESC);
-          oprot.writeString(struct.url);
-          oprot.writeFieldEnd();
-        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_LoadURL_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_Reload_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_LoadURL_argsTupleScheme getScheme() {
-        return new Browser_LoadURL_argsTupleScheme();
+      public Browser_Reload_argsTupleScheme getScheme() {
+        return new Browser_Reload_argsTupleScheme();
       }
     }
 
-    private static class Browser_LoadURL_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_LoadURL_args> {
+    private static class Browser_Reload_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_Reload_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_Reload_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        if (struct.isSetUrl()) {
-          optionals.set(1);
-        }
-        oprot.writeBitSet(optionals, 2);
+        oprot.writeBitSet(optionals, 1);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
-        if (struct.isSetUrl()) {
-          oprot.writeString(struct.url);
-        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_Reload_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(2);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
-        if (incoming.get(1)) {
-          struct.url = iprot.readString();
-          struct.setUrlIsSet(true);
-        }
       }
     }
 
@@ -17272,13 +17486,13 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_GetURL_args implements org.apache.thrift.TBase<Browser_GetURL_args, Browser_GetURL_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_GetURL_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_GetURL_args");
+  public static class Browser_ReloadIgnoreCache_args implements org.apache.thrift.TBase<Browser_ReloadIgnoreCache_args, Browser_ReloadIgnoreCache_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_ReloadIgnoreCache_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_ReloadIgnoreCache_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_GetURL_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_GetURL_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_ReloadIgnoreCache_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_ReloadIgnoreCache_argsTupleSchemeFactory();
 
     public int bid; // required
 
@@ -17353,13 +17567,13 @@ public class Server {
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_GetURL_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_ReloadIgnoreCache_args.class, metaDataMap);
     }
 
-    public Browser_GetURL_args() {
+    public Browser_ReloadIgnoreCache_args() {
     }
 
-    public Browser_GetURL_args(
+    public Browser_ReloadIgnoreCache_args(
       int bid)
     {
       this();
@@ -17370,14 +17584,14 @@ public class Server {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_GetURL_args(Browser_GetURL_args other) {
+    public Browser_ReloadIgnoreCache_args(Browser_ReloadIgnoreCache_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
     }
 
     @Override
-    public Browser_GetURL_args deepCopy() {
-      return new Browser_GetURL_args(this);
+    public Browser_ReloadIgnoreCache_args deepCopy() {
+      return new Browser_ReloadIgnoreCache_args(this);
     }
 
     @Override
@@ -17390,7 +17604,7 @@ public class Server {
       return this.bid;
     }
 
-    public Browser_GetURL_args setBid(int bid) {
+    public Browser_ReloadIgnoreCache_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -17450,12 +17664,12 @@ public class Server {
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_GetURL_args)
-        return this.equals((Browser_GetURL_args)that);
+      if (that instanceof Browser_ReloadIgnoreCache_args)
+        return this.equals((Browser_ReloadIgnoreCache_args)that);
       return false;
     }
 
-    public boolean equals(Browser_GetURL_args that) {
+    public boolean equals(Browser_ReloadIgnoreCache_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -17483,7 +17697,7 @@ public class Server {
     }
 
     @Override
-    public int compareTo(Browser_GetURL_args other) {
+    public int compareTo(Browser_ReloadIgnoreCache_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -17521,7 +17735,7 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_GetURL_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_ReloadIgnoreCache_args(");
       boolean first = true;
 
       sb.append("bid:");
@@ -17554,17 +17768,17 @@ public class Server {
       }
     }
 
-    private static class Browser_GetURL_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_ReloadIgnoreCache_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_GetURL_argsStandardScheme getScheme() {
-        return new Browser_GetURL_argsStandardScheme();
+      public Browser_ReloadIgnoreCache_argsStandardScheme getScheme() {
+        return new Browser_ReloadIgnoreCache_argsStandardScheme();
       }
     }
 
-    private static class Browser_GetURL_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_GetURL_args> {
+    private static class Browser_ReloadIgnoreCache_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_ReloadIgnoreCache_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -17594,7 +17808,7 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
@@ -17607,17 +17821,17 @@ public class Server {
 
     }
 
-    private static class Browser_GetURL_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_ReloadIgnoreCache_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_GetURL_argsTupleScheme getScheme() {
-        return new Browser_GetURL_argsTupleScheme();
+      public Browser_ReloadIgnoreCache_argsTupleScheme getScheme() {
+        return new Browser_ReloadIgnoreCache_argsTupleScheme();
       }
     }
 
-    private static class Browser_GetURL_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_GetURL_args> {
+    private static class Browser_ReloadIgnoreCache_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_ReloadIgnoreCache_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
@@ -17630,7 +17844,7 @@ public class Server {
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_ReloadIgnoreCache_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
@@ -17646,19 +17860,22 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_GetURL_result implements org.apache.thrift.TBase<Browser_GetURL_result, Browser_GetURL_result._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_GetURL_result>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_GetURL_result");
+  public static class Browser_LoadURL_args implements org.apache.thrift.TBase<Browser_LoadURL_args, Browser_LoadURL_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_LoadURL_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_LoadURL_args");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRING, (short)0);
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_GetURL_resultStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_GetURL_resultTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_LoadURL_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_LoadURL_argsTupleSchemeFactory();
 
-    public @org.apache.thrift.annotation.Nullable java.lang.String success; // required
+    public int bid; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success");
+      BID((short)1, "bid"),
+      URL((short)2, "url");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -17674,8 +17891,10 @@ public class Server {
       @org.apache.thrift.annotation.Nullable
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
+          case 1: // BID
+            return BID;
+          case 2: // URL
+            return URL;
           default:
             return null;
         }
@@ -17719,77 +17938,1984 @@ public class Server {
     }
 
     // isset id assignments
+    private static final int __BID_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_GetURL_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_LoadURL_args.class, metaDataMap);
     }
 
-    public Browser_GetURL_result() {
+    public Browser_LoadURL_args() {
     }
 
-    public Browser_GetURL_result(
-      java.lang.String success)
+    public Browser_LoadURL_args(
+      int bid,
+      java.lang.String url)
     {
       this();
-      this.success = success;
+      this.bid = bid;
+      setBidIsSet(true);
+      this.url = url;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_GetURL_result(Browser_GetURL_result other) {
-      if (other.isSetSuccess()) {
-        this.success = other.success;
+    public Browser_LoadURL_args(Browser_LoadURL_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.bid = other.bid;
+      if (other.isSetUrl()) {
+        this.url = other.url;
       }
     }
 
     @Override
-    public Browser_GetURL_result deepCopy() {
-      return new Browser_GetURL_result(this);
+    public Browser_LoadURL_args deepCopy() {
+      return new Browser_LoadURL_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setBidIsSet(false);
+      this.bid = 0;
+      this.url = null;
+    }
+
+    public int getBid() {
+      return this.bid;
+    }
+
+    public Browser_LoadURL_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
+    }
+
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getUrl() {
+      return this.url;
+    }
+
+    public Browser_LoadURL_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
+      this.url = url;
+      return this;
+    }
+
+    public void unsetUrl() {
+      this.url = null;
+    }
+
+    /** Returns true if field url is set (has been assigned a value) and false otherwise */
+    public boolean isSetUrl() {
+      return this.url != null;
+    }
+
+    public void setUrlIsSet(boolean value) {
+      if (!value) {
+        this.url = null;
+      }
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      case URL:
+        if (value == null) {
+          unsetUrl();
+        } else {
+          setUrl((java.lang.String)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case BID:
+        return getBid();
+
+      case URL:
+        return getUrl();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case BID:
+        return isSetBid();
+      case URL:
+        return isSetUrl();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof Browser_LoadURL_args)
+        return this.equals((Browser_LoadURL_args)that);
+      return false;
+    }
+
+    public boolean equals(Browser_LoadURL_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      boolean this_present_url = true && this.isSetUrl();
+      boolean that_present_url = true && that.isSetUrl();
+      if (this_present_url || that_present_url) {
+        if (!(this_present_url && that_present_url))
+          return false;
+        if (!this.url.equals(that.url))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + bid;
+
+      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
+      if (isSetUrl())
+        hashCode = hashCode * 8191 + url.hashCode();
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(Browser_LoadURL_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetUrl()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+    }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_LoadURL_args(");
+      boolean first = true;
+
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("url:");
+      if (this.url == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.url);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class Browser_LoadURL_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_LoadURL_argsStandardScheme getScheme() {
+        return new Browser_LoadURL_argsStandardScheme();
+      }
+    }
+
+    private static class Browser_LoadURL_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_LoadURL_args> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // URL
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.url = iprot.readString();
+                struct.setUrlIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        if (struct.url != null) {
+          oprot.writeFieldBegin(URL_FIELD_DESC);
+          oprot.writeString(struct.url);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class Browser_LoadURL_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_LoadURL_argsTupleScheme getScheme() {
+        return new Browser_LoadURL_argsTupleScheme();
+      }
+    }
+
+    private static class Browser_LoadURL_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_LoadURL_args> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetBid()) {
+          optionals.set(0);
+        }
+        if (struct.isSetUrl()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+        if (struct.isSetUrl()) {
+          oprot.writeString(struct.url);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_LoadURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(2);
+        if (incoming.get(0)) {
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.url = iprot.readString();
+          struct.setUrlIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class Browser_GetURL_args implements org.apache.thrift.TBase<Browser_GetURL_args, Browser_GetURL_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_GetURL_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_GetURL_args");
+
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_GetURL_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_GetURL_argsTupleSchemeFactory();
+
+    public int bid; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      BID((short)1, "bid");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // BID
+            return BID;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __BID_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_GetURL_args.class, metaDataMap);
+    }
+
+    public Browser_GetURL_args() {
+    }
+
+    public Browser_GetURL_args(
+      int bid)
+    {
+      this();
+      this.bid = bid;
+      setBidIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public Browser_GetURL_args(Browser_GetURL_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.bid = other.bid;
+    }
+
+    @Override
+    public Browser_GetURL_args deepCopy() {
+      return new Browser_GetURL_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setBidIsSet(false);
+      this.bid = 0;
+    }
+
+    public int getBid() {
+      return this.bid;
+    }
+
+    public Browser_GetURL_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
+    }
+
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case BID:
+        return getBid();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case BID:
+        return isSetBid();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof Browser_GetURL_args)
+        return this.equals((Browser_GetURL_args)that);
+      return false;
+    }
+
+    public boolean equals(Browser_GetURL_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + bid;
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(Browser_GetURL_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+    }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_GetURL_args(");
+      boolean first = true;
+
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class Browser_GetURL_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_GetURL_argsStandardScheme getScheme() {
+        return new Browser_GetURL_argsStandardScheme();
+      }
+    }
+
+    private static class Browser_GetURL_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_GetURL_args> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class Browser_GetURL_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_GetURL_argsTupleScheme getScheme() {
+        return new Browser_GetURL_argsTupleScheme();
+      }
+    }
+
+    private static class Browser_GetURL_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_GetURL_args> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetBid()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class Browser_GetURL_result implements org.apache.thrift.TBase<Browser_GetURL_result, Browser_GetURL_result._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_GetURL_result>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_GetURL_result");
+
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRING, (short)0);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_GetURL_resultStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_GetURL_resultTupleSchemeFactory();
+
+    public @org.apache.thrift.annotation.Nullable java.lang.String success; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SUCCESS((short)0, "success");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 0: // SUCCESS
+            return SUCCESS;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_GetURL_result.class, metaDataMap);
+    }
+
+    public Browser_GetURL_result() {
+    }
+
+    public Browser_GetURL_result(
+      java.lang.String success)
+    {
+      this();
+      this.success = success;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public Browser_GetURL_result(Browser_GetURL_result other) {
+      if (other.isSetSuccess()) {
+        this.success = other.success;
+      }
+    }
+
+    @Override
+    public Browser_GetURL_result deepCopy() {
+      return new Browser_GetURL_result(this);
+    }
+
+    @Override
+    public void clear() {
+      this.success = null;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getSuccess() {
+      return this.success;
+    }
+
+    public Browser_GetURL_result setSuccess(@org.apache.thrift.annotation.Nullable java.lang.String success) {
+      this.success = success;
+      return this;
+    }
+
+    public void unsetSuccess() {
+      this.success = null;
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return this.success != null;
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      if (!value) {
+        this.success = null;
+      }
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((java.lang.String)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case SUCCESS:
+        return getSuccess();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof Browser_GetURL_result)
+        return this.equals((Browser_GetURL_result)that);
+      return false;
+    }
+
+    public boolean equals(Browser_GetURL_result that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (!this.success.equals(that.success))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
+      if (isSetSuccess())
+        hashCode = hashCode * 8191 + success.hashCode();
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(Browser_GetURL_result other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+      }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_GetURL_result(");
+      boolean first = true;
+
+      sb.append("success:");
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class Browser_GetURL_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_GetURL_resultStandardScheme getScheme() {
+        return new Browser_GetURL_resultStandardScheme();
+      }
+    }
+
+    private static class Browser_GetURL_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_GetURL_result> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 0: // SUCCESS
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.success = iprot.readString();
+                struct.setSuccessIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        if (struct.success != null) {
+          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+          oprot.writeString(struct.success);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class Browser_GetURL_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_GetURL_resultTupleScheme getScheme() {
+        return new Browser_GetURL_resultTupleScheme();
+      }
+    }
+
+    private static class Browser_GetURL_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_GetURL_result> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetSuccess()) {
+          optionals.set(0);
+        }
+        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetSuccess()) {
+          oprot.writeString(struct.success);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(1);
+        if (incoming.get(0)) {
+          struct.success = iprot.readString();
+          struct.setSuccessIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class Browser_ExecuteJavaScript_args implements org.apache.thrift.TBase<Browser_ExecuteJavaScript_args, Browser_ExecuteJavaScript_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_ExecuteJavaScript_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_ExecuteJavaScript_args");
+
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField CODE_FIELD_DESC = new org.apache.thrift.protocol.TField("code", org.apache.thrift.protocol.TType.STRING, (short)2);
+    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)3);
+    private static final org.apache.thrift.protocol.TField LINE_FIELD_DESC = new org.apache.thrift.protocol.TField("line", org.apache.thrift.protocol.TType.I32, (short)4);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_ExecuteJavaScript_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_ExecuteJavaScript_argsTupleSchemeFactory();
+
+    public int bid; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String code; // required
+    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
+    public int line; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      BID((short)1, "bid"),
+      CODE((short)2, "code"),
+      URL((short)3, "url"),
+      LINE((short)4, "line");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // BID
+            return BID;
+          case 2: // CODE
+            return CODE;
+          case 3: // URL
+            return URL;
+          case 4: // LINE
+            return LINE;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __BID_ISSET_ID = 0;
+    private static final int __LINE_ISSET_ID = 1;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.CODE, new org.apache.thrift.meta_data.FieldMetaData("code", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.LINE, new org.apache.thrift.meta_data.FieldMetaData("line", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_ExecuteJavaScript_args.class, metaDataMap);
+    }
+
+    public Browser_ExecuteJavaScript_args() {
+    }
+
+    public Browser_ExecuteJavaScript_args(
+      int bid,
+      java.lang.String code,
+      java.lang.String url,
+      int line)
+    {
+      this();
+      this.bid = bid;
+      setBidIsSet(true);
+      this.code = code;
+      this.url = url;
+      this.line = line;
+      setLineIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public Browser_ExecuteJavaScript_args(Browser_ExecuteJavaScript_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.bid = other.bid;
+      if (other.isSetCode()) {
+        this.code = other.code;
+      }
+      if (other.isSetUrl()) {
+        this.url = other.url;
+      }
+      this.line = other.line;
+    }
+
+    @Override
+    public Browser_ExecuteJavaScript_args deepCopy() {
+      return new Browser_ExecuteJavaScript_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setBidIsSet(false);
+      this.bid = 0;
+      this.code = null;
+      this.url = null;
+      setLineIsSet(false);
+      this.line = 0;
+    }
+
+    public int getBid() {
+      return this.bid;
+    }
+
+    public Browser_ExecuteJavaScript_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
+      return this;
+    }
+
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
+    }
+
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getCode() {
+      return this.code;
+    }
+
+    public Browser_ExecuteJavaScript_args setCode(@org.apache.thrift.annotation.Nullable java.lang.String code) {
+      this.code = code;
+      return this;
+    }
+
+    public void unsetCode() {
+      this.code = null;
+    }
+
+    /** Returns true if field code is set (has been assigned a value) and false otherwise */
+    public boolean isSetCode() {
+      return this.code != null;
+    }
+
+    public void setCodeIsSet(boolean value) {
+      if (!value) {
+        this.code = null;
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.lang.String getUrl() {
+      return this.url;
+    }
+
+    public Browser_ExecuteJavaScript_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
+      this.url = url;
+      return this;
+    }
+
+    public void unsetUrl() {
+      this.url = null;
+    }
+
+    /** Returns true if field url is set (has been assigned a value) and false otherwise */
+    public boolean isSetUrl() {
+      return this.url != null;
+    }
+
+    public void setUrlIsSet(boolean value) {
+      if (!value) {
+        this.url = null;
+      }
+    }
+
+    public int getLine() {
+      return this.line;
+    }
+
+    public Browser_ExecuteJavaScript_args setLine(int line) {
+      this.line = line;
+      setLineIsSet(true);
+      return this;
+    }
+
+    public void unsetLine() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __LINE_ISSET_ID);
+    }
+
+    /** Returns true if field line is set (has been assigned a value) and false otherwise */
+    public boolean isSetLine() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __LINE_ISSET_ID);
+    }
+
+    public void setLineIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __LINE_ISSET_ID, value);
+    }
+
+    @Override
+    public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+      switch (field) {
+      case BID:
+        if (value == null) {
+          unsetBid();
+        } else {
+          setBid((java.lang.Integer)value);
+        }
+        break;
+
+      case CODE:
+        if (value == null) {
+          unsetCode();
+        } else {
+          setCode((java.lang.String)value);
+        }
+        break;
+
+      case URL:
+        if (value == null) {
+          unsetUrl();
+        } else {
+          setUrl((java.lang.String)value);
+        }
+        break;
+
+      case LINE:
+        if (value == null) {
+          unsetLine();
+        } else {
+          setLine((java.lang.Integer)value);
+        }
+        break;
+
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public java.lang.Object getFieldValue(_Fields field) {
+      switch (field) {
+      case BID:
+        return getBid();
+
+      case CODE:
+        return getCode();
+
+      case URL:
+        return getUrl();
+
+      case LINE:
+        return getLine();
+
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    @Override
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new java.lang.IllegalArgumentException();
+      }
+
+      switch (field) {
+      case BID:
+        return isSetBid();
+      case CODE:
+        return isSetCode();
+      case URL:
+        return isSetUrl();
+      case LINE:
+        return isSetLine();
+      }
+      throw new java.lang.IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(java.lang.Object that) {
+      if (that instanceof Browser_ExecuteJavaScript_args)
+        return this.equals((Browser_ExecuteJavaScript_args)that);
+      return false;
+    }
+
+    public boolean equals(Browser_ExecuteJavaScript_args that) {
+      if (that == null)
+        return false;
+      if (this == that)
+        return true;
+
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
+          return false;
+        if (this.bid != that.bid)
+          return false;
+      }
+
+      boolean this_present_code = true && this.isSetCode();
+      boolean that_present_code = true && that.isSetCode();
+      if (this_present_code || that_present_code) {
+        if (!(this_present_code && that_present_code))
+          return false;
+        if (!this.code.equals(that.code))
+          return false;
+      }
+
+      boolean this_present_url = true && this.isSetUrl();
+      boolean that_present_url = true && that.isSetUrl();
+      if (this_present_url || that_present_url) {
+        if (!(this_present_url && that_present_url))
+          return false;
+        if (!this.url.equals(that.url))
+          return false;
+      }
+
+      boolean this_present_line = true;
+      boolean that_present_line = true;
+      if (this_present_line || that_present_line) {
+        if (!(this_present_line && that_present_line))
+          return false;
+        if (this.line != that.line)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      int hashCode = 1;
+
+      hashCode = hashCode * 8191 + bid;
+
+      hashCode = hashCode * 8191 + ((isSetCode()) ? 131071 : 524287);
+      if (isSetCode())
+        hashCode = hashCode * 8191 + code.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
+      if (isSetUrl())
+        hashCode = hashCode * 8191 + url.hashCode();
+
+      hashCode = hashCode * 8191 + line;
+
+      return hashCode;
+    }
+
+    @Override
+    public int compareTo(Browser_ExecuteJavaScript_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetCode(), other.isSetCode());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetCode()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.code, other.code);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetUrl()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetLine(), other.isSetLine());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetLine()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.line, other.line);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    @Override
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      scheme(iprot).read(iprot, this);
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      scheme(oprot).write(oprot, this);
+    }
+
+    @Override
+    public java.lang.String toString() {
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_ExecuteJavaScript_args(");
+      boolean first = true;
+
+      sb.append("bid:");
+      sb.append(this.bid);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("code:");
+      if (this.code == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.code);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("url:");
+      if (this.url == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.url);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("line:");
+      sb.append(this.line);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+      // check for sub-struct validity
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private static class Browser_ExecuteJavaScript_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_ExecuteJavaScript_argsStandardScheme getScheme() {
+        return new Browser_ExecuteJavaScript_argsStandardScheme();
+      }
+    }
+
+    private static class Browser_ExecuteJavaScript_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_ExecuteJavaScript_args> {
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TField schemeField;
+        iprot.readStructBegin();
+        while (true)
+        {
+          schemeField = iprot.readFieldBegin();
+          if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+            break;
+          }
+          switch (schemeField.id) {
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 2: // CODE
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.code = iprot.readString();
+                struct.setCodeIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // URL
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
+                struct.url = iprot.readString();
+                struct.setUrlIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 4: // LINE
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.line = iprot.readI32();
+                struct.setLineIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            default:
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+          }
+          iprot.readFieldEnd();
+        }
+        iprot.readStructEnd();
+
+        // check for required fields of primitive type, which can't be checked in the validate method
+        struct.validate();
+      }
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+        struct.validate();
+
+        oprot.writeStructBegin(STRUCT_DESC);
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
+        if (struct.code != null) {
+          oprot.writeFieldBegin(CODE_FIELD_DESC);
+          oprot.writeString(struct.code);
+          oprot.writeFieldEnd();
+        }
+        if (struct.url != null) {
+          oprot.writeFieldBegin(URL_FIELD_DESC);
+          oprot.writeString(struct.url);
+          oprot.writeFieldEnd();
+        }
+        oprot.writeFieldBegin(LINE_FIELD_DESC);
+        oprot.writeI32(struct.line);
+        oprot.writeFieldEnd();
+        oprot.writeFieldStop();
+        oprot.writeStructEnd();
+      }
+
+    }
+
+    private static class Browser_ExecuteJavaScript_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+      @Override
+      public Browser_ExecuteJavaScript_argsTupleScheme getScheme() {
+        return new Browser_ExecuteJavaScript_argsTupleScheme();
+      }
+    }
+
+    private static class Browser_ExecuteJavaScript_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_ExecuteJavaScript_args> {
+
+      @Override
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet optionals = new java.util.BitSet();
+        if (struct.isSetBid()) {
+          optionals.set(0);
+        }
+        if (struct.isSetCode()) {
+          optionals.set(1);
+        }
+        if (struct.isSetUrl()) {
+          optionals.set(2);
+        }
+        if (struct.isSetLine()) {
+          optionals.set(3);
+        }
+        oprot.writeBitSet(optionals, 4);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
+        }
+        if (struct.isSetCode()) {
+          oprot.writeString(struct.code);
+        }
+        if (struct.isSetUrl()) {
+          oprot.writeString(struct.url);
+        }
+        if (struct.isSetLine()) {
+          oprot.writeI32(struct.line);
+        }
+      }
+
+      @Override
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+        org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+        java.util.BitSet incoming = iprot.readBitSet(4);
+        if (incoming.get(0)) {
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
+        }
+        if (incoming.get(1)) {
+          struct.code = iprot.readString();
+          struct.setCodeIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.url = iprot.readString();
+          struct.setUrlIsSet(true);
+        }
+        if (incoming.get(3)) {
+          struct.line = iprot.readI32();
+          struct.setLineIsSet(true);
+        }
+      }
+    }
+
+    private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+      return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+    }
+  }
+
+  @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+  public static class Browser_WasResized_args implements org.apache.thrift.TBase<Browser_WasResized_args, Browser_WasResized_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_WasResized_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_WasResized_args");
+
+    private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_WasResized_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_WasResized_argsTupleSchemeFactory();
+
+    public int bid; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      BID((short)1, "bid");
+
+      private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+      static {
+        for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // BID
+            return BID;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      @org.apache.thrift.annotation.Nullable
+      public static _Fields findByName(java.lang.String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final java.lang.String _fieldName;
+
+      _Fields(short thriftId, java.lang.String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      @Override
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      @Override
+      public java.lang.String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __BID_ISSET_ID = 0;
+    private byte __isset_bitfield = 0;
+    public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_WasResized_args.class, metaDataMap);
+    }
+
+    public Browser_WasResized_args() {
+    }
+
+    public Browser_WasResized_args(
+      int bid)
+    {
+      this();
+      this.bid = bid;
+      setBidIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public Browser_WasResized_args(Browser_WasResized_args other) {
+      __isset_bitfield = other.__isset_bitfield;
+      this.bid = other.bid;
+    }
+
+    @Override
+    public Browser_WasResized_args deepCopy() {
+      return new Browser_WasResized_args(this);
     }
 
     @Override
     public void clear() {
-      this.success = null;
+      setBidIsSet(false);
+      this.bid = 0;
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getSuccess() {
-      return this.success;
+    public int getBid() {
+      return this.bid;
     }
 
-    public Browser_GetURL_result setSuccess(@org.apache.thrift.annotation.Nullable java.lang.String success) {
-      this.success = success;
+    public Browser_WasResized_args setBid(int bid) {
+      this.bid = bid;
+      setBidIsSet(true);
       return this;
     }
 
-    public void unsetSuccess() {
-      this.success = null;
+    public void unsetBid() {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return this.success != null;
+    /** Returns true if field bid is set (has been assigned a value) and false otherwise */
+    public boolean isSetBid() {
+      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __BID_ISSET_ID);
     }
 
-    public void setSuccessIsSet(boolean value) {
-      if (!value) {
-        this.success = null;
-      }
+    public void setBidIsSet(boolean value) {
+      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
-      case SUCCESS:
+      case BID:
         if (value == null) {
-          unsetSuccess();
+          unsetBid();
         } else {
-          setSuccess((java.lang.String)value);
+          setBid((java.lang.Integer)value);
         }
         break;
 
@@ -17800,8 +19926,8 @@ public class Server {
     @Override
     public java.lang.Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
+      case BID:
+        return getBid();
 
       }
       throw new java.lang.IllegalStateException();
@@ -17815,31 +19941,31 @@ public class Server {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
+      case BID:
+        return isSetBid();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_GetURL_result)
-        return this.equals((Browser_GetURL_result)that);
+      if (that instanceof Browser_WasResized_args)
+        return this.equals((Browser_WasResized_args)that);
       return false;
     }
 
-    public boolean equals(Browser_GetURL_result that) {
+    public boolean equals(Browser_WasResized_args that) {
       if (that == null)
         return false;
       if (this == that)
         return true;
 
-      boolean this_present_success = true && this.isSetSuccess();
-      boolean that_present_success = true && that.isSetSuccess();
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
+      boolean this_present_bid = true;
+      boolean that_present_bid = true;
+      if (this_present_bid || that_present_bid) {
+        if (!(this_present_bid && that_present_bid))
           return false;
-        if (!this.success.equals(that.success))
+        if (this.bid != that.bid)
           return false;
       }
 
@@ -17850,27 +19976,25 @@ public class Server {
     public int hashCode() {
       int hashCode = 1;
 
-      hashCode = hashCode * 8191 + ((isSetSuccess()) ? 131071 : 524287);
-      if (isSetSuccess())
-        hashCode = hashCode * 8191 + success.hashCode();
+      hashCode = hashCode * 8191 + bid;
 
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_GetURL_result other) {
+    public int compareTo(Browser_WasResized_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
 
-      lastComparison = java.lang.Boolean.compare(isSetSuccess(), other.isSetSuccess());
+      lastComparison = java.lang.Boolean.compare(isSetBid(), other.isSetBid());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, other.success);
+      if (isSetBid()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.bid, other.bid);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -17889,21 +20013,18 @@ public class Server {
       scheme(iprot).read(iprot, this);
     }
 
+    @Override
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       scheme(oprot).write(oprot, this);
-      }
+    }
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_GetURL_result(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_WasResized_args(");
       boolean first = true;
 
-      sb.append("success:");
-      if (this.success == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.success);
-      }
+      sb.append("bid:");
+      sb.append(this.bid);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -17924,23 +20045,25 @@ public class Server {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
       try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bitfield = 0;
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
       }
     }
 
-    private static class Browser_GetURL_resultStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_WasResized_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_GetURL_resultStandardScheme getScheme() {
-        return new Browser_GetURL_resultStandardScheme();
+      public Browser_WasResized_argsStandardScheme getScheme() {
+        return new Browser_WasResized_argsStandardScheme();
       }
     }
 
-    private static class Browser_GetURL_resultStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_GetURL_result> {
+    private static class Browser_WasResized_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_WasResized_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -17950,10 +20073,10 @@ public class Server {
             break;
           }
           switch (schemeField.id) {
-            case 0: // SUCCESS
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.success = iprot.readString();
-                struct.setSuccessIsSet(true);
+            case 1: // BID
+              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
+                struct.bid = iprot.readI32();
+                struct.setBidIsSet(true);
               } else { 
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
@@ -17970,50 +20093,48 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
-        if (struct.success != null) {
-          oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-          oprot.writeString(struct.success);
-          oprot.writeFieldEnd();
-        }
+        oprot.writeFieldBegin(BID_FIELD_DESC);
+        oprot.writeI32(struct.bid);
+        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_GetURL_resultTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_WasResized_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_GetURL_resultTupleScheme getScheme() {
-        return new Browser_GetURL_resultTupleScheme();
+      public Browser_WasResized_argsTupleScheme getScheme() {
+        return new Browser_WasResized_argsTupleScheme();
       }
     }
 
-    private static class Browser_GetURL_resultTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_GetURL_result> {
+    private static class Browser_WasResized_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_WasResized_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
-        if (struct.isSetSuccess()) {
+        if (struct.isSetBid()) {
           optionals.set(0);
         }
         oprot.writeBitSet(optionals, 1);
-        if (struct.isSetSuccess()) {
-          oprot.writeString(struct.success);
+        if (struct.isSetBid()) {
+          oprot.writeI32(struct.bid);
         }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_GetURL_result struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
-          struct.success = iprot.readString();
-          struct.setSuccessIsSet(true);
+          struct.bid = iprot.readI32();
+          struct.setBidIsSet(true);
         }
       }
     }
@@ -18024,28 +20145,19 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_ExecuteJavaScript_args implements org.apache.thrift.TBase<Browser_ExecuteJavaScript_args, Browser_ExecuteJavaScript_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_ExecuteJavaScript_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_ExecuteJavaScript_args");
+  public static class Browser_NotifyScreenInfoChanged_args implements org.apache.thrift.TBase<Browser_NotifyScreenInfoChanged_args, Browser_NotifyScreenInfoChanged_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_NotifyScreenInfoChanged_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_NotifyScreenInfoChanged_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
-    private static final org.apache.thrift.protocol.TField CODE_FIELD_DESC = new org.apache.thrift.protocol.TField("code", org.apache.thrift.protocol.TType.STRING, (short)2);
-    private static final org.apache.thrift.protocol.TField URL_FIELD_DESC = new org.apache.thrift.protocol.TField("url", org.apache.thrift.protocol.TType.STRING, (short)3);
-    private static final org.apache.thrift.protocol.TField LINE_FIELD_DESC = new org.apache.thrift.protocol.TField("line", org.apache.thrift.protocol.TType.I32, (short)4);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_ExecuteJavaScript_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_ExecuteJavaScript_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_NotifyScreenInfoChanged_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_NotifyScreenInfoChanged_argsTupleSchemeFactory();
 
     public int bid; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String code; // required
-    public @org.apache.thrift.annotation.Nullable java.lang.String url; // required
-    public int line; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid"),
-      CODE((short)2, "code"),
-      URL((short)3, "url"),
-      LINE((short)4, "line");
+      BID((short)1, "bid");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -18063,12 +20175,6 @@ public class Server {
         switch(fieldId) {
           case 1: // BID
             return BID;
-          case 2: // CODE
-            return CODE;
-          case 3: // URL
-            return URL;
-          case 4: // LINE
-            return LINE;
           default:
             return null;
         }
@@ -18113,76 +20219,51 @@ public class Server {
 
     // isset id assignments
     private static final int __BID_ISSET_ID = 0;
-    private static final int __LINE_ISSET_ID = 1;
     private byte __isset_bitfield = 0;
     public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
-      tmpMap.put(_Fields.CODE, new org.apache.thrift.meta_data.FieldMetaData("code", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
-      tmpMap.put(_Fields.URL, new org.apache.thrift.meta_data.FieldMetaData("url", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
-      tmpMap.put(_Fields.LINE, new org.apache.thrift.meta_data.FieldMetaData("line", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_ExecuteJavaScript_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_NotifyScreenInfoChanged_args.class, metaDataMap);
     }
 
-    public Browser_ExecuteJavaScript_args() {
+    public Browser_NotifyScreenInfoChanged_args() {
     }
 
-    public Browser_ExecuteJavaScript_args(
-      int bid,
-      java.lang.String code,
-      java.lang.String url,
-      int line)
+    public Browser_NotifyScreenInfoChanged_args(
+      int bid)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
-      this.code = code;
-      this.url = url;
-      this.line = line;
-      setLineIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_ExecuteJavaScript_args(Browser_ExecuteJavaScript_args other) {
+    public Browser_NotifyScreenInfoChanged_args(Browser_NotifyScreenInfoChanged_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
-      if (other.isSetCode()) {
-        this.code = other.code;
-      }
-      if (other.isSetUrl()) {
-        this.url = other.url;
-      }
-      this.line = other.line;
     }
 
     @Override
-    public Browser_ExecuteJavaScript_args deepCopy() {
-      return new Browser_ExecuteJavaScript_args(this);
+    public Browser_NotifyScreenInfoChanged_args deepCopy() {
+      return new Browser_NotifyScreenInfoChanged_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
-      this.code = null;
-      this.url = null;
-      setLineIsSet(false);
-      this.line = 0;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public Browser_ExecuteJavaScript_args setBid(int bid) {
+    public Browser_NotifyScreenInfoChanged_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -18201,79 +20282,6 @@ public class Server {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getCode() {
-      return this.code;
-    }
-
-    public Browser_ExecuteJavaScript_args setCode(@org.apache.thrift.annotation.Nullable java.lang.String code) {
-      this.code = code;
-      return this;
-    }
-
-    public void unsetCode() {
-      this.code = null;
-    }
-
-    /** Returns true if field code is set (has been assigned a value) and false otherwise */
-    public boolean isSetCode() {
-      return this.code != null;
-    }
-
-    public void setCodeIsSet(boolean value) {
-      if (!value) {
-        this.code = null;
-      }
-    }
-
-    @org.apache.thrift.annotation.Nullable
-    public java.lang.String getUrl() {
-      return this.url;
-    }
-
-    public Browser_ExecuteJavaScript_args setUrl(@org.apache.thrift.annotation.Nullable java.lang.String url) {
-      this.url = url;
-      return this;
-    }
-
-    public void unsetUrl() {
-      this.url = null;
-    }
-
-    /** Returns true if field url is set (has been assigned a value) and false otherwise */
-    public boolean isSetUrl() {
-      return this.url != null;
-    }
-
-    public void setUrlIsSet(boolean value) {
-      if (!value) {
-        this.url = null;
-      }
-    }
-
-    public int getLine() {
-      return this.line;
-    }
-
-    public Browser_ExecuteJavaScript_args setLine(int line) {
-      this.line = line;
-      setLineIsSet(true);
-      return this;
-    }
-
-    public void unsetLine() {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.clearBit(__isset_bitfield, __LINE_ISSET_ID);
-    }
-
-    /** Returns true if field line is set (has been assigned a value) and false otherwise */
-    public boolean isSetLine() {
-      return org.apache.thrift.EncodingUtils.testBit(__isset_bitfield, __LINE_ISSET_ID);
-    }
-
-    public void setLineIsSet(boolean value) {
-      __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __LINE_ISSET_ID, value);
-    }
-
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -18285,30 +20293,6 @@ public class Server {
         }
         break;
 
-      case CODE:
-        if (value == null) {
-          unsetCode();
-        } else {
-          setCode((java.lang.String)value);
-        }
-        break;
-
-      case URL:
-        if (value == null) {
-          unsetUrl();
-        } else {
-          setUrl((java.lang.String)value);
-        }
-        break;
-
-      case LINE:
-        if (value == null) {
-          unsetLine();
-        } else {
-          setLine((java.lang.Integer)value);
-        }
-        break;
-
       }
     }
 
@@ -18319,15 +20303,6 @@ public class Server {
       case BID:
         return getBid();
 
-      case CODE:
-        return getCode();
-
-      case URL:
-        return getUrl();
-
-      case LINE:
-        return getLine();
-
       }
       throw new java.lang.IllegalStateException();
     }
@@ -18342,24 +20317,18 @@ public class Server {
       switch (field) {
       case BID:
         return isSetBid();
-      case CODE:
-        return isSetCode();
-      case URL:
-        return isSetUrl();
-      case LINE:
-        return isSetLine();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_ExecuteJavaScript_args)
-        return this.equals((Browser_ExecuteJavaScript_args)that);
+      if (that instanceof Browser_NotifyScreenInfoChanged_args)
+        return this.equals((Browser_NotifyScreenInfoChanged_args)that);
       return false;
     }
 
-    public boolean equals(Browser_ExecuteJavaScript_args that) {
+    public boolean equals(Browser_NotifyScreenInfoChanged_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -18374,33 +20343,6 @@ public class Server {
           return false;
       }
 
-      boolean this_present_code = true && this.isSetCode();
-      boolean that_present_code = true && that.isSetCode();
-      if (this_present_code || that_present_code) {
-        if (!(this_present_code && that_present_code))
-          return false;
-        if (!this.code.equals(that.code))
-          return false;
-      }
-
-      boolean this_present_url = true && this.isSetUrl();
-      boolean that_present_url = true && that.isSetUrl();
-      if (this_present_url || that_present_url) {
-        if (!(this_present_url && that_present_url))
-          return false;
-        if (!this.url.equals(that.url))
-          return false;
-      }
-
-      boolean this_present_line = true;
-      boolean that_present_line = true;
-      if (this_present_line || that_present_line) {
-        if (!(this_present_line && that_present_line))
-          return false;
-        if (this.line != that.line)
-          return false;
-      }
-
       return true;
     }
 
@@ -18410,21 +20352,11 @@ public class Server {
 
       hashCode = hashCode * 8191 + bid;
 
-      hashCode = hashCode * 8191 + ((isSetCode()) ? 131071 : 524287);
-      if (isSetCode())
-        hashCode = hashCode * 8191 + code.hashCode();
-
-      hashCode = hashCode * 8191 + ((isSetUrl()) ? 131071 : 524287);
-      if (isSetUrl())
-        hashCode = hashCode * 8191 + url.hashCode();
-
-      hashCode = hashCode * 8191 + line;
-
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_ExecuteJavaScript_args other) {
+    public int compareTo(Browser_NotifyScreenInfoChanged_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -18441,36 +20373,6 @@ public class Server {
           return lastComparison;
         }
       }
-      lastComparison = java.lang.Boolean.compare(isSetCode(), other.isSetCode());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetCode()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.code, other.code);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetUrl(), other.isSetUrl());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetUrl()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.url, other.url);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
-      lastComparison = java.lang.Boolean.compare(isSetLine(), other.isSetLine());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetLine()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.line, other.line);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       return 0;
     }
 
@@ -18492,32 +20394,12 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_ExecuteJavaScript_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_NotifyScreenInfoChanged_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
-      if (!first) sb.append(", ");
-      sb.append("code:");
-      if (this.code == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.code);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("url:");
-      if (this.url == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.url);
-      }
-      first = false;
-      if (!first) sb.append(", ");
-      sb.append("line:");
-      sb.append(this.line);
-      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -18545,17 +20427,17 @@ public class Server {
       }
     }
 
-    private static class Browser_ExecuteJavaScript_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_NotifyScreenInfoChanged_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_ExecuteJavaScript_argsStandardScheme getScheme() {
-        return new Browser_ExecuteJavaScript_argsStandardScheme();
+      public Browser_NotifyScreenInfoChanged_argsStandardScheme getScheme() {
+        return new Browser_NotifyScreenInfoChanged_argsStandardScheme();
       }
     }
 
-    private static class Browser_ExecuteJavaScript_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_ExecuteJavaScript_args> {
+    private static class Browser_NotifyScreenInfoChanged_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_NotifyScreenInfoChanged_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -18573,30 +20455,6 @@ public class Server {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
-            case 2: // CODE
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.code = iprot.readString();
-                struct.setCodeIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 3: // URL
-              if (schemeField.type == org.apache.thrift.protocol.TType.STRING) {
-                struct.url = iprot.readString();
-                struct.setUrlIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
-            case 4: // LINE
-              if (schemeField.type == org.apache.thrift.protocol.TType.I32) {
-                struct.line = iprot.readI32();
-                struct.setLineIsSet(true);
-              } else { 
-                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
-              }
-              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -18609,92 +20467,49 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
-        if (struct.code != null) {
-          oprot.writeFieldBegin(CODE_FIELD_DESC);
-          oprot.writeString(struct.code);
-          oprot.writeFieldEnd();
-        }
-        if (struct.url != null) {
-          oprot.writeFieldBegin(URL_FIELD_DESC);
-          oprot.writeString(struct.url);
-          oprot.writeFieldEnd();
-        }
-        oprot.writeFieldBegin(LINE_FIELD_DESC);
-        oprot.writeI32(struct.line);
-        oprot.writeFieldEnd();
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_ExecuteJavaScript_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_NotifyScreenInfoChanged_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_ExecuteJavaScript_argsTupleScheme getScheme() {
-        return new Browser_ExecuteJavaScript_argsTupleScheme();
+      public Browser_NotifyScreenInfoChanged_argsTupleScheme getScheme() {
+        return new Browser_NotifyScreenInfoChanged_argsTupleScheme();
       }
     }
 
-    private static class Browser_ExecuteJavaScript_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_ExecuteJavaScript_args> {
+    private static class Browser_NotifyScreenInfoChanged_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_NotifyScreenInfoChanged_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        if (struct.isSetCode()) {
-          optionals.set(1);
-        }
-        if (struct.isSetUrl()) {
-          optionals.set(2);
-        }
-        if (struct.isSetLine()) {
-          optionals.set(3);
-        }
-        oprot.writeBitSet(optionals, 4);
+        oprot.writeBitSet(optionals, 1);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
-        if (struct.isSetCode()) {
-          oprot.writeString(struct.code);
-        }
-        if (struct.isSetUrl()) {
-          oprot.writeString(struct.url);
-        }
-        if (struct.isSetLine()) {
-          oprot.writeI32(struct.line);
-        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_ExecuteJavaScript_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(4);
+        java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
-        if (incoming.get(1)) {
-          struct.code = iprot.readString();
-          struct.setCodeIsSet(true);
-        }
-        if (incoming.get(2)) {
-          struct.url = iprot.readString();
-          struct.setUrlIsSet(true);
-        }
-        if (incoming.get(3)) {
-          struct.line = iprot.readI32();
-          struct.setLineIsSet(true);
-        }
       }
     }
 
@@ -18704,19 +20519,31 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_WasResized_args implements org.apache.thrift.TBase<Browser_WasResized_args, Browser_WasResized_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_WasResized_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_WasResized_args");
+  public static class Browser_SetViewGeometry_args implements org.apache.thrift.TBase<Browser_SetViewGeometry_args, Browser_SetViewGeometry_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_SetViewGeometry_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_SetViewGeometry_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField VIEW_RECT_FIELD_DESC = new org.apache.thrift.protocol.TField("viewRect", org.apache.thrift.protocol.TType.STRUCT, (short)2);
+    private static final org.apache.thrift.protocol.TField SCREEN_INFO_FIELD_DESC = new org.apache.thrift.protocol.TField("screenInfo", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField SCREEN_POINT0_FIELD_DESC = new org.apache.thrift.protocol.TField("screenPoint0", org.apache.thrift.protocol.TType.STRUCT, (short)4);
+    private static final org.apache.thrift.protocol.TField SCREEN_POINT100_FIELD_DESC = new org.apache.thrift.protocol.TField("screenPoint100", org.apache.thrift.protocol.TType.STRUCT, (short)5);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_WasResized_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_WasResized_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_SetViewGeometry_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_SetViewGeometry_argsTupleSchemeFactory();
 
     public int bid; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Rect viewRect; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0; // required
+    public @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      BID((short)1, "bid"),
+      VIEW_RECT((short)2, "viewRect"),
+      SCREEN_INFO((short)3, "screenInfo"),
+      SCREEN_POINT0((short)4, "screenPoint0"),
+      SCREEN_POINT100((short)5, "screenPoint100");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -18734,6 +20561,14 @@ public class Server {
         switch(fieldId) {
           case 1: // BID
             return BID;
+          case 2: // VIEW_RECT
+            return VIEW_RECT;
+          case 3: // SCREEN_INFO
+            return SCREEN_INFO;
+          case 4: // SCREEN_POINT0
+            return SCREEN_POINT0;
+          case 5: // SCREEN_POINT100
+            return SCREEN_POINT100;
           default:
             return null;
         }
@@ -18784,45 +20619,77 @@ public class Server {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.VIEW_RECT, new org.apache.thrift.meta_data.FieldMetaData("viewRect", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.Rect.class)));
+      tmpMap.put(_Fields.SCREEN_INFO, new org.apache.thrift.meta_data.FieldMetaData("screenInfo", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ScreenInfo.class)));
+      tmpMap.put(_Fields.SCREEN_POINT0, new org.apache.thrift.meta_data.FieldMetaData("screenPoint0", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.Point.class)));
+      tmpMap.put(_Fields.SCREEN_POINT100, new org.apache.thrift.meta_data.FieldMetaData("screenPoint100", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.Point.class)));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_WasResized_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_SetViewGeometry_args.class, metaDataMap);
     }
 
-    public Browser_WasResized_args() {
+    public Browser_SetViewGeometry_args() {
     }
 
-    public Browser_WasResized_args(
-      int bid)
+    public Browser_SetViewGeometry_args(
+      int bid,
+      com.jetbrains.cef.remote.thrift_codegen.Rect viewRect,
+      com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo,
+      com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0,
+      com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
+      this.viewRect = viewRect;
+      this.screenInfo = screenInfo;
+      this.screenPoint0 = screenPoint0;
+      this.screenPoint100 = screenPoint100;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_WasResized_args(Browser_WasResized_args other) {
+    public Browser_SetViewGeometry_args(Browser_SetViewGeometry_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
+      if (other.isSetViewRect()) {
+        this.viewRect = new com.jetbrains.cef.remote.thrift_codegen.Rect(other.viewRect);
+      }
+      if (other.isSetScreenInfo()) {
+        this.screenInfo = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo(other.screenInfo);
+      }
+      if (other.isSetScreenPoint0()) {
+        this.screenPoint0 = new com.jetbrains.cef.remote.thrift_codegen.Point(other.screenPoint0);
+      }
+      if (other.isSetScreenPoint100()) {
+        this.screenPoint100 = new com.jetbrains.cef.remote.thrift_codegen.Point(other.screenPoint100);
+      }
     }
 
     @Override
-    public Browser_WasResized_args deepCopy() {
-      return new Browser_WasResized_args(this);
+    public Browser_SetViewGeometry_args deepCopy() {
+      return new Browser_SetViewGeometry_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
+      this.viewRect = null;
+      this.screenInfo = null;
+      this.screenPoint0 = null;
+      this.screenPoint100 = null;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public Browser_WasResized_args setBid(int bid) {
+    public Browser_SetViewGeometry_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -18841,6 +20708,106 @@ public class Server {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.Rect getViewRect() {
+      return this.viewRect;
+    }
+
+    public Browser_SetViewGeometry_args setViewRect(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Rect viewRect) {
+      this.viewRect = viewRect;
+      return this;
+    }
+
+    public void unsetViewRect() {
+      this.viewRect = null;
+    }
+
+    /** Returns true if field viewRect is set (has been assigned a value) and false otherwise */
+    public boolean isSetViewRect() {
+      return this.viewRect != null;
+    }
+
+    public void setViewRectIsSet(boolean value) {
+      if (!value) {
+        this.viewRect = null;
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.ScreenInfo getScreenInfo() {
+      return this.screenInfo;
+    }
+
+    public Browser_SetViewGeometry_args setScreenInfo(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ScreenInfo screenInfo) {
+      this.screenInfo = screenInfo;
+      return this;
+    }
+
+    public void unsetScreenInfo() {
+      this.screenInfo = null;
+    }
+
+    /** Returns true if field screenInfo is set (has been assigned a value) and false otherwise */
+    public boolean isSetScreenInfo() {
+      return this.screenInfo != null;
+    }
+
+    public void setScreenInfoIsSet(boolean value) {
+      if (!value) {
+        this.screenInfo = null;
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.Point getScreenPoint0() {
+      return this.screenPoint0;
+    }
+
+    public Browser_SetViewGeometry_args setScreenPoint0(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point screenPoint0) {
+      this.screenPoint0 = screenPoint0;
+      return this;
+    }
+
+    public void unsetScreenPoint0() {
+      this.screenPoint0 = null;
+    }
+
+    /** Returns true if field screenPoint0 is set (has been assigned a value) and false otherwise */
+    public boolean isSetScreenPoint0() {
+      return this.screenPoint0 != null;
+    }
+
+    public void setScreenPoint0IsSet(boolean value) {
+      if (!value) {
+        this.screenPoint0 = null;
+      }
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public com.jetbrains.cef.remote.thrift_codegen.Point getScreenPoint100() {
+      return this.screenPoint100;
+    }
+
+    public Browser_SetViewGeometry_args setScreenPoint100(@org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.Point screenPoint100) {
+      this.screenPoint100 = screenPoint100;
+      return this;
+    }
+
+    public void unsetScreenPoint100() {
+      this.screenPoint100 = null;
+    }
+
+    /** Returns true if field screenPoint100 is set (has been assigned a value) and false otherwise */
+    public boolean isSetScreenPoint100() {
+      return this.screenPoint100 != null;
+    }
+
+    public void setScreenPoint100IsSet(boolean value) {
+      if (!value) {
+        this.screenPoint100 = null;
+      }
+    }
+
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -18852,6 +20819,38 @@ public class Server {
         }
         break;
 
+      case VIEW_RECT:
+        if (value == null) {
+          unsetViewRect();
+        } else {
+          setViewRect((com.jetbrains.cef.remote.thrift_codegen.Rect)value);
+        }
+        break;
+
+      case SCREEN_INFO:
+        if (value == null) {
+          unsetScreenInfo();
+        } else {
+          setScreenInfo((com.jetbrains.cef.remote.thrift_codegen.ScreenInfo)value);
+        }
+        break;
+
+      case SCREEN_POINT0:
+        if (value == null) {
+          unsetScreenPoint0();
+        } else {
+          setScreenPoint0((com.jetbrains.cef.remote.thrift_codegen.Point)value);
+        }
+        break;
+
+      case SCREEN_POINT100:
+        if (value == null) {
+          unsetScreenPoint100();
+        } else {
+          setScreenPoint100((com.jetbrains.cef.remote.thrift_codegen.Point)value);
+        }
+        break;
+
       }
     }
 
@@ -18862,6 +20861,18 @@ public class Server {
       case BID:
         return getBid();
 
+      case VIEW_RECT:
+        return getViewRect();
+
+      case SCREEN_INFO:
+        return getScreenInfo();
+
+      case SCREEN_POINT0:
+        return getScreenPoint0();
+
+      case SCREEN_POINT100:
+        return getScreenPoint100();
+
       }
       throw new java.lang.IllegalStateException();
     }
@@ -18876,18 +20887,26 @@ public class Server {
       switch (field) {
       case BID:
         return isSetBid();
+      case VIEW_RECT:
+        return isSetViewRect();
+      case SCREEN_INFO:
+        return isSetScreenInfo();
+      case SCREEN_POINT0:
+        return isSetScreenPoint0();
+      case SCREEN_POINT100:
+        return isSetScreenPoint100();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_WasResized_args)
-        return this.equals((Browser_WasResized_args)that);
+      if (that instanceof Browser_SetViewGeometry_args)
+        return this.equals((Browser_SetViewGeometry_args)that);
       return false;
     }
 
-    public boolean equals(Browser_WasResized_args that) {
+    public boolean equals(Browser_SetViewGeometry_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -18902,6 +20921,42 @@ public class Server {
           return false;
       }
 
+      boolean this_present_viewRect = true && this.isSetViewRect();
+      boolean that_present_viewRect = true && that.isSetViewRect();
+      if (this_present_viewRect || that_present_viewRect) {
+        if (!(this_present_viewRect && that_present_viewRect))
+          return false;
+        if (!this.viewRect.equals(that.viewRect))
+          return false;
+      }
+
+      boolean this_present_screenInfo = true && this.isSetScreenInfo();
+      boolean that_present_screenInfo = true && that.isSetScreenInfo();
+      if (this_present_screenInfo || that_present_screenInfo) {
+        if (!(this_present_screenInfo && that_present_screenInfo))
+          return false;
+        if (!this.screenInfo.equals(that.screenInfo))
+          return false;
+      }
+
+      boolean this_present_screenPoint0 = true && this.isSetScreenPoint0();
+      boolean that_present_screenPoint0 = true && that.isSetScreenPoint0();
+      if (this_present_screenPoint0 || that_present_screenPoint0) {
+        if (!(this_present_screenPoint0 && that_present_screenPoint0))
+          return false;
+        if (!this.screenPoint0.equals(that.screenPoint0))
+          return false;
+      }
+
+      boolean this_present_screenPoint100 = true && this.isSetScreenPoint100();
+      boolean that_present_screenPoint100 = true && that.isSetScreenPoint100();
+      if (this_present_screenPoint100 || that_present_screenPoint100) {
+        if (!(this_present_screenPoint100 && that_present_screenPoint100))
+          return false;
+        if (!this.screenPoint100.equals(that.screenPoint100))
+          return false;
+      }
+
       return true;
     }
 
@@ -18911,11 +20966,27 @@ public class Server {
 
       hashCode = hashCode * 8191 + bid;
 
+      hashCode = hashCode * 8191 + ((isSetViewRect()) ? 131071 : 524287);
+      if (isSetViewRect())
+        hashCode = hashCode * 8191 + viewRect.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetScreenInfo()) ? 131071 : 524287);
+      if (isSetScreenInfo())
+        hashCode = hashCode * 8191 + screenInfo.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetScreenPoint0()) ? 131071 : 524287);
+      if (isSetScreenPoint0())
+        hashCode = hashCode * 8191 + screenPoint0.hashCode();
+
+      hashCode = hashCode * 8191 + ((isSetScreenPoint100()) ? 131071 : 524287);
+      if (isSetScreenPoint100())
+        hashCode = hashCode * 8191 + screenPoint100.hashCode();
+
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_WasResized_args other) {
+    public int compareTo(Browser_SetViewGeometry_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -18932,6 +21003,46 @@ public class Server {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetViewRect(), other.isSetViewRect());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetViewRect()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.viewRect, other.viewRect);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetScreenInfo(), other.isSetScreenInfo());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetScreenInfo()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.screenInfo, other.screenInfo);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetScreenPoint0(), other.isSetScreenPoint0());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetScreenPoint0()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.screenPoint0, other.screenPoint0);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = java.lang.Boolean.compare(isSetScreenPoint100(), other.isSetScreenPoint100());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetScreenPoint100()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.screenPoint100, other.screenPoint100);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -18953,12 +21064,44 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_WasResized_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_SetViewGeometry_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("viewRect:");
+      if (this.viewRect == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.viewRect);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("screenInfo:");
+      if (this.screenInfo == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.screenInfo);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("screenPoint0:");
+      if (this.screenPoint0 == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.screenPoint0);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("screenPoint100:");
+      if (this.screenPoint100 == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.screenPoint100);
+      }
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -18966,6 +21109,18 @@ public class Server {
     public void validate() throws org.apache.thrift.TException {
       // check for required fields
       // check for sub-struct validity
+      if (viewRect != null) {
+        viewRect.validate();
+      }
+      if (screenInfo != null) {
+        screenInfo.validate();
+      }
+      if (screenPoint0 != null) {
+        screenPoint0.validate();
+      }
+      if (screenPoint100 != null) {
+        screenPoint100.validate();
+      }
     }
 
     private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
@@ -18986,17 +21141,17 @@ public class Server {
       }
     }
 
-    private static class Browser_WasResized_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_SetViewGeometry_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_WasResized_argsStandardScheme getScheme() {
-        return new Browser_WasResized_argsStandardScheme();
+      public Browser_SetViewGeometry_argsStandardScheme getScheme() {
+        return new Browser_SetViewGeometry_argsStandardScheme();
       }
     }
 
-    private static class Browser_WasResized_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_WasResized_args> {
+    private static class Browser_SetViewGeometry_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_SetViewGeometry_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_SetViewGeometry_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -19014,6 +21169,42 @@ public class Server {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
+            case 2: // VIEW_RECT
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.viewRect = new com.jetbrains.cef.remote.thrift_codegen.Rect();
+                struct.viewRect.read(iprot);
+                struct.setViewRectIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 3: // SCREEN_INFO
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.screenInfo = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo();
+                struct.screenInfo.read(iprot);
+                struct.setScreenInfoIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 4: // SCREEN_POINT0
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.screenPoint0 = new com.jetbrains.cef.remote.thrift_codegen.Point();
+                struct.screenPoint0.read(iprot);
+                struct.setScreenPoint0IsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
+            case 5: // SCREEN_POINT100
+              if (schemeField.type == org.apache.thrift.protocol.TType.STRUCT) {
+                struct.screenPoint100 = new com.jetbrains.cef.remote.thrift_codegen.Point();
+                struct.screenPoint100.read(iprot);
+                struct.setScreenPoint100IsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -19026,49 +21217,113 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_SetViewGeometry_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
+        if (struct.viewRect != null) {
+          oprot.writeFieldBegin(VIEW_RECT_FIELD_DESC);
+          struct.viewRect.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        if (struct.screenInfo != null) {
+          oprot.writeFieldBegin(SCREEN_INFO_FIELD_DESC);
+          struct.screenInfo.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        if (struct.screenPoint0 != null) {
+          oprot.writeFieldBegin(SCREEN_POINT0_FIELD_DESC);
+          struct.screenPoint0.write(oprot);
+          oprot.writeFieldEnd();
+        }
+        if (struct.screenPoint100 != null) {
+          oprot.writeFieldBegin(SCREEN_POINT100_FIELD_DESC);
+          struct.screenPoint100.write(oprot);
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_WasResized_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_SetViewGeometry_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_WasResized_argsTupleScheme getScheme() {
-        return new Browser_WasResized_argsTupleScheme();
+      public Browser_SetViewGeometry_argsTupleScheme getScheme() {
+        return new Browser_SetViewGeometry_argsTupleScheme();
       }
     }
 
-    private static class Browser_WasResized_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_WasResized_args> {
+    private static class Browser_SetViewGeometry_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_SetViewGeometry_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_SetViewGeometry_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetViewRect()) {
+          optionals.set(1);
+        }
+        if (struct.isSetScreenInfo()) {
+          optionals.set(2);
+        }
+        if (struct.isSetScreenPoint0()) {
+          optionals.set(3);
+        }
+        if (struct.isSetScreenPoint100()) {
+          optionals.set(4);
+        }
+        oprot.writeBitSet(optionals, 5);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
+        if (struct.isSetViewRect()) {
+          struct.viewRect.write(oprot);
+        }
+        if (struct.isSetScreenInfo()) {
+          struct.screenInfo.write(oprot);
+        }
+        if (struct.isSetScreenPoint0()) {
+          struct.screenPoint0.write(oprot);
+        }
+        if (struct.isSetScreenPoint100()) {
+          struct.screenPoint100.write(oprot);
+        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_WasResized_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_SetViewGeometry_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(5);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
+        if (incoming.get(1)) {
+          struct.viewRect = new com.jetbrains.cef.remote.thrift_codegen.Rect();
+          struct.viewRect.read(iprot);
+          struct.setViewRectIsSet(true);
+        }
+        if (incoming.get(2)) {
+          struct.screenInfo = new com.jetbrains.cef.remote.thrift_codegen.ScreenInfo();
+          struct.screenInfo.read(iprot);
+          struct.setScreenInfoIsSet(true);
+        }
+        if (incoming.get(3)) {
+          struct.screenPoint0 = new com.jetbrains.cef.remote.thrift_codegen.Point();
+          struct.screenPoint0.read(iprot);
+          struct.setScreenPoint0IsSet(true);
+        }
+        if (incoming.get(4)) {
+          struct.screenPoint100 = new com.jetbrains.cef.remote.thrift_codegen.Point();
+          struct.screenPoint100.read(iprot);
+          struct.setScreenPoint100IsSet(true);
+        }
       }
     }
 
@@ -19078,19 +21333,22 @@ public class Server {
   }
 
   @SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
-  public static class Browser_NotifyScreenInfoChanged_args implements org.apache.thrift.TBase<Browser_NotifyScreenInfoChanged_args, Browser_NotifyScreenInfoChanged_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_NotifyScreenInfoChanged_args>   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_NotifyScreenInfoChanged_args");
+  public static class Browser_SetResourceRules_args implements org.apache.thrift.TBase<Browser_SetResourceRules_args, Browser_SetResourceRules_args._Fields>, java.io.Serializable, Cloneable, Comparable<Browser_SetResourceRules_args>   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("Browser_SetResourceRules_args");
 
     private static final org.apache.thrift.protocol.TField BID_FIELD_DESC = new org.apache.thrift.protocol.TField("bid", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField RULES_FIELD_DESC = new org.apache.thrift.protocol.TField("rules", org.apache.thrift.protocol.TType.LIST, (short)2);
 
-    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_NotifyScreenInfoChanged_argsStandardSchemeFactory();
-    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_NotifyScreenInfoChanged_argsTupleSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new Browser_SetResourceRules_argsStandardSchemeFactory();
+    private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new Browser_SetResourceRules_argsTupleSchemeFactory();
 
     public int bid; // required
+    public @org.apache.thrift.annotation.Nullable java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      BID((short)1, "bid");
+      BID((short)1, "bid"),
+      RULES((short)2, "rules");
 
       private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
 
@@ -19108,6 +21366,8 @@ public class Server {
         switch(fieldId) {
           case 1: // BID
             return BID;
+          case 2: // RULES
+            return RULES;
           default:
             return null;
         }
@@ -19158,45 +21418,58 @@ public class Server {
       java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.BID, new org.apache.thrift.meta_data.FieldMetaData("bid", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.RULES, new org.apache.thrift.meta_data.FieldMetaData("rules", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+              new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, com.jetbrains.cef.remote.thrift_codegen.ResourceRule.class))));
       metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_NotifyScreenInfoChanged_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(Browser_SetResourceRules_args.class, metaDataMap);
     }
 
-    public Browser_NotifyScreenInfoChanged_args() {
+    public Browser_SetResourceRules_args() {
     }
 
-    public Browser_NotifyScreenInfoChanged_args(
-      int bid)
+    public Browser_SetResourceRules_args(
+      int bid,
+      java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules)
     {
       this();
       this.bid = bid;
       setBidIsSet(true);
+      this.rules = rules;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public Browser_NotifyScreenInfoChanged_args(Browser_NotifyScreenInfoChanged_args other) {
+    public Browser_SetResourceRules_args(Browser_SetResourceRules_args other) {
       __isset_bitfield = other.__isset_bitfield;
       this.bid = other.bid;
+      if (other.isSetRules()) {
+        java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> __this__rules = new java.util.ArrayList<com.jetbrains.cef.remote.thrift_codegen.ResourceRule>(other.rules.size());
+        for (com.jetbrains.cef.remote.thrift_codegen.ResourceRule other_element : other.rules) {
+          __this__rules.add(new com.jetbrains.cef.remote.thrift_codegen.ResourceRule(other_element));
+        }
+        this.rules = __this__rules;
+      }
     }
 
     @Override
-    public Browser_NotifyScreenInfoChanged_args deepCopy() {
-      return new Browser_NotifyScreenInfoChanged_args(this);
+    public Browser_SetResourceRules_args deepCopy() {
+      return new Browser_SetResourceRules_args(this);
     }
 
     @Override
     public void clear() {
       setBidIsSet(false);
       this.bid = 0;
+      this.rules = null;
     }
 
     public int getBid() {
       return this.bid;
     }
 
-    public Browser_NotifyScreenInfoChanged_args setBid(int bid) {
+    public Browser_SetResourceRules_args setBid(int bid) {
       this.bid = bid;
       setBidIsSet(true);
       return this;
@@ -19215,6 +21488,47 @@ public class Server {
       __isset_bitfield = org.apache.thrift.EncodingUtils.setBit(__isset_bitfield, __BID_ISSET_ID, value);
     }
 
+    public int getRulesSize() {
+      return (this.rules == null) ? 0 : this.rules.size();
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.util.Iterator<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> getRulesIterator() {
+      return (this.rules == null) ? null : this.rules.iterator();
+    }
+
+    public void addToRules(com.jetbrains.cef.remote.thrift_codegen.ResourceRule elem) {
+      if (this.rules == null) {
+        this.rules = new java.util.ArrayList<com.jetbrains.cef.remote.thrift_codegen.ResourceRule>();
+      }
+      this.rules.add(elem);
+    }
+
+    @org.apache.thrift.annotation.Nullable
+    public java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> getRules() {
+      return this.rules;
+    }
+
+    public Browser_SetResourceRules_args setRules(@org.apache.thrift.annotation.Nullable java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule> rules) {
+      this.rules = rules;
+      return this;
+    }
+
+    public void unsetRules() {
+      this.rules = null;
+    }
+
+    /** Returns true if field rules is set (has been assigned a value) and false otherwise */
+    public boolean isSetRules() {
+      return this.rules != null;
+    }
+
+    public void setRulesIsSet(boolean value) {
+      if (!value) {
+        this.rules = null;
+      }
+    }
+
     @Override
     public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
       switch (field) {
@@ -19226,6 +21540,14 @@ public class Server {
         }
         break;
 
+      case RULES:
+        if (value == null) {
+          unsetRules();
+        } else {
+          setRules((java.util.List<com.jetbrains.cef.remote.thrift_codegen.ResourceRule>)value);
+        }
+        break;
+
       }
     }
 
@@ -19236,6 +21558,9 @@ public class Server {
       case BID:
         return getBid();
 
+      case RULES:
+        return getRules();
+
       }
       throw new java.lang.IllegalStateException();
     }
@@ -19250,18 +21575,20 @@ public class Server {
       switch (field) {
       case BID:
         return isSetBid();
+      case RULES:
+        return isSetRules();
       }
       throw new java.lang.IllegalStateException();
     }
 
     @Override
     public boolean equals(java.lang.Object that) {
-      if (that instanceof Browser_NotifyScreenInfoChanged_args)
-        return this.equals((Browser_NotifyScreenInfoChanged_args)that);
+      if (that instanceof Browser_SetResourceRules_args)
+        return this.equals((Browser_SetResourceRules_args)that);
       return false;
     }
 
-    public boolean equals(Browser_NotifyScreenInfoChanged_args that) {
+    public boolean equals(Browser_SetResourceRules_args that) {
       if (that == null)
         return false;
       if (this == that)
@@ -19276,6 +21603,15 @@ public class Server {
           return false;
       }
 
+      boolean this_present_rules = true && this.isSetRules();
+      boolean that_present_rules = true && that.isSetRules();
+      if (this_present_rules || that_present_rules) {
+        if (!(this_present_rules && that_present_rules))
+          return false;
+        if (!this.rules.equals(that.rules))
+          return false;
+      }
+
       return true;
     }
 
@@ -19285,11 +21621,15 @@ public class Server {
 
       hashCode = hashCode * 8191 + bid;
 
+      hashCode = hashCode * 8191 + ((isSetRules()) ? 131071 : 524287);
+      if (isSetRules())
+        hashCode = hashCode * 8191 + rules.hashCode();
+
       return hashCode;
     }
 
     @Override
-    public int compareTo(Browser_NotifyScreenInfoChanged_args other) {
+    public int compareTo(Browser_SetResourceRules_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
@@ -19306,6 +21646,16 @@ public class Server {
           return lastComparison;
         }
       }
+      lastComparison = java.lang.Boolean.compare(isSetRules(), other.isSetRules());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetRules()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rules, other.rules);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -19327,12 +21677,20 @@ public class Server {
 
     @Override
     public java.lang.String toString() {
-      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_NotifyScreenInfoChanged_args(");
+      java.lang.StringBuilder sb = new java.lang.StringBuilder("Browser_SetResourceRules_args(");
       boolean first = true;
 
       sb.append("bid:");
       sb.append(this.bid);
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("rules:");
+      if (this.rules == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.rules);
+      }
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -19360,17 +21718,17 @@ public class Server {
       }
     }
 
-    private static class Browser_NotifyScreenInfoChanged_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_SetResourceRules_argsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_NotifyScreenInfoChanged_argsStandardScheme getScheme() {
-        return new Browser_NotifyScreenInfoChanged_argsStandardScheme();
+      public Browser_SetResourceRules_argsStandardScheme getScheme() {
+        return new Browser_SetResourceRules_argsStandardScheme();
       }
     }
 
-    private static class Browser_NotifyScreenInfoChanged_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_NotifyScreenInfoChanged_args> {
+    private static class Browser_SetResourceRules_argsStandardScheme extends org.apache.thrift.scheme.StandardScheme<Browser_SetResourceRules_args> {
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol iprot, Browser_SetResourceRules_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TField schemeField;
         iprot.readStructBegin();
         while (true)
@@ -19388,6 +21746,25 @@ public class Server {
                 org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
               }
               break;
+            case 2: // RULES
+              if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+                {
+                  org.apache.thrift.protocol.TList _list0 = iprot.readListBegin();
+                  struct.rules = new java.util.ArrayList<com.jetbrains.cef.remote.thrift_codegen.ResourceRule>(_list0.size);
+                  @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResourceRule _elem1;
+                  for (int _i2 = 0; _i2 < _list0.size; ++_i2)
+                  {
+                    _elem1 = new com.jetbrains.cef.remote.thrift_codegen.ResourceRule();
+                    _elem1.read(iprot);
+                    struct.rules.add(_elem1);
+                  }
+                  iprot.readListEnd();
+                }
+                struct.setRulesIsSet(true);
+              } else { 
+                org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+              }
+              break;
             default:
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
           }
@@ -19400,49 +21777,87 @@ public class Server {
       }
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol oprot, Browser_SetResourceRules_args struct) throws org.apache.thrift.TException {
         struct.validate();
 
         oprot.writeStructBegin(STRUCT_DESC);
         oprot.writeFieldBegin(BID_FIELD_DESC);
         oprot.writeI32(struct.bid);
         oprot.writeFieldEnd();
+        if (struct.rules != null) {
+          oprot.writeFieldBegin(RULES_FIELD_DESC);
+          {
+            oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.rules.size()));
+            for (com.jetbrains.cef.remote.thrift_codegen.ResourceRule _iter3 : struct.rules)
+            {
+              _iter3.write(oprot);
+            }
+            oprot.writeListEnd();
+          }
+          oprot.writeFieldEnd();
+        }
         oprot.writeFieldStop();
         oprot.writeStructEnd();
       }
 
     }
 
-    private static class Browser_NotifyScreenInfoChanged_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    private static class Browser_SetResourceRules_argsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
       @Override
-      public Browser_NotifyScreenInfoChanged_argsTupleScheme getScheme() {
-        return new Browser_NotifyScreenInfoChanged_argsTupleScheme();
+      public Browser_SetResourceRules_argsTupleScheme getScheme() {
+        return new Browser_SetResourceRules_argsTupleScheme();
       }
     }
 
-    private static class Browser_NotifyScreenInfoChanged_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_NotifyScreenInfoChanged_args> {
+    private static class Browser_SetResourceRules_argsTupleScheme extends org.apache.thrift.scheme.TupleScheme<Browser_SetResourceRules_args> {
 
       @Override
-      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
+      public void write(org.apache.thrift.protocol.TProtocol prot, Browser_SetResourceRules_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
         java.util.BitSet optionals = new java.util.BitSet();
         if (struct.isSetBid()) {
           optionals.set(0);
         }
-        oprot.writeBitSet(optionals, 1);
+        if (struct.isSetRules()) {
+          optionals.set(1);
+        }
+        oprot.writeBitSet(optionals, 2);
         if (struct.isSetBid()) {
           oprot.writeI32(struct.bid);
         }
+        if (struct.isSetRules()) {
+          {
+            oprot.writeI32(struct.rules.size());
+            for (com.jetbrains.cef.remote.thrift_codegen.ResourceRule _iter4 : struct.rules)
+            {
+              _iter4.write(oprot);
+            }
+          }
+        }
       }
 
       @Override
-      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_NotifyScreenInfoChanged_args struct) throws org.apache.thrift.TException {
+      public void read(org.apache.thrift.protocol.TProtocol prot, Browser_SetResourceRules_args struct) throws org.apache.thrift.TException {
         org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
-        java.util.BitSet incoming = iprot.readBitSet(1);
+        java.util.BitSet incoming = iprot.readBitSet(2);
         if (incoming.get(0)) {
           struct.bid = iprot.readI32();
           struct.setBidIsSet(true);
         }
+        if (incoming.get(1)) {
+          {
+            org.apache.thrift.protocol.TList _list5 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRUCT);
+            struct.rules = new java.util.ArrayList<com.jetbrains.cef.remote.thrift_codegen.ResourceRule>(_list5.size);
+            @org.apache.thrift.annotation.Nullable com.jetbrains.cef.remote.thrift_codegen.ResourceRule _elem6;
+            for (int _i7 = 0; _i7 < _list5.size; ++_i7)
+            {
+              _elem6 = new com.jetbrains.cef.remote.thrift_codegen.ResourceRule();
+              _elem6.read(iprot);
+              struct.rules.add(_elem6);
+            }
+          }
+          struct.setRulesIsSet(true);
+        }
       }
     }
 
@@ -38224,15 +40639,15 @@ public class Server {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
                 {
-                  org.apache.thrift.protocol.TMap _map0 = iprot.readMapBegin();
-                  struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map0.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _key1;
-                  @org.apache.thrift.annotation.Nullable java.lang.String _val2;
-                  for (int _i3 = 0; _i3 < _map0.size; ++_i3)
+                  org.apache.thrift.protocol.TMap _map8 = iprot.readMapBegin();
+                  struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map8.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _key9;
+                  @org.apache.thrift.annotation.Nullable java.lang.String _val10;
+                  for (int _i11 = 0; _i11 < _map8.size; ++_i11)
                   {
-                    _key1 = iprot.readString();
-                    _val2 = iprot.readString();
-                    struct.success.put(_key1, _val2);
+                    _key9 = iprot.readString();
+                    _val10 = iprot.readString();
+                    struct.success.put(_key9, _val10);
                   }
                   iprot.readMapEnd();
                 }
@@ -38261,10 +40676,10 @@ public class Server {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
           {
             oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING, struct.success.size()));
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter4 : struct.success.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter12 : struct.success.entrySet())
             {
-              oprot.writeString(_iter4.getKey());
-              oprot.writeString(_iter4.getValue());
+              oprot.writeString(_iter12.getKey());
+              oprot.writeString(_iter12.getValue());
             }
             oprot.writeMapEnd();
           }
@@ -38296,10 +40711,10 @@ public class Server {
         if (struct.isSetSuccess()) {
           {
             oprot.writeI32(struct.success.size());
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter5 : struct.success.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter13 : struct.success.entrySet())
             {
-              oprot.writeString(_iter5.getKey());
-              oprot.writeString(_iter5.getValue());
+              oprot.writeString(_iter13.getKey());
+              oprot.writeString(_iter13.getValue());
             }
           }
         }
@@ -38311,15 +40726,15 @@ public class Server {
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
           {
-            org.apache.thrift.protocol.TMap _map6 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
-            struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map6.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _key7;
-            @org.apache.thrift.annotation.Nullable java.lang.String _val8;
-            for (int _i9 = 0; _i9 < _map6.size; ++_i9)
+            org.apache.thrift.protocol.TMap _map14 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
+            struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map14.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _key15;
+            @org.apache.thrift.annotation.Nullable java.lang.String _val16;
+            for (int _i17 = 0; _i17 < _map14.size; ++_i17)
             {
-              _key7 = iprot.readString();
-              _val8 = iprot.readString();
-              struct.success.put(_key7, _val8);
+              _key15 = iprot.readString();
+              _val16 = iprot.readString();
+              struct.success.put(_key15, _val16);
             }
           }
           struct.setSuccessIsSet(true);
@@ -38749,15 +41164,15 @@ public class Server {
             case 2: // HEADER_MAP
               if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
                 {
-                  org.apache.thrift.protocol.TMap _map10 = iprot.readMapBegin();
-                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map10.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _key11;
-                  @org.apache.thrift.annotation.Nullable java.lang.String _val12;
-                  for (int _i13 = 0; _i13 < _map10.size; ++_i13)
+                  org.apache.thrift.protocol.TMap _map18 = iprot.readMapBegin();
+                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map18.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _key19;
+                  @org.apache.thrift.annotation.Nullable java.lang.String _val20;
+                  for (int _i21 = 0; _i21 < _map18.size; ++_i21)
                   {
-                    _key11 = iprot.readString();
-                    _val12 = iprot.readString();
-                    struct.headerMap.put(_key11, _val12);
+                    _key19 = iprot.readString();
+                    _val20 = iprot.readString();
+                    struct.headerMap.put(_key19, _val20);
                   }
                   iprot.readMapEnd();
                 }
@@ -38791,10 +41206,10 @@ public class Server {
           oprot.writeFieldBegin(HEADER_MAP_FIELD_DESC);
           {
             oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING, struct.headerMap.size()));
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter14 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter22 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter14.getKey());
-              oprot.writeString(_iter14.getValue());
+              oprot.writeString(_iter22.getKey());
+              oprot.writeString(_iter22.getValue());
             }
             oprot.writeMapEnd();
           }
@@ -38832,10 +41247,10 @@ public class Server {
         if (struct.isSetHeaderMap()) {
           {
             oprot.writeI32(struct.headerMap.size());
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter15 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter23 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter15.getKey());
-              oprot.writeString(_iter15.getValue());
+              oprot.writeString(_iter23.getKey());
+              oprot.writeString(_iter23.getValue());
             }
           }
         }
@@ -38852,15 +41267,15 @@ public class Server {
         }
         if (incoming.get(1)) {
           {
-            org.apache.thrift.protocol.TMap _map16 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
-            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map16.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _key17;
-            @org.apache.thrift.annotation.Nullable java.lang.String _val18;
-            for (int _i19 = 0; _i19 < _map16.size; ++_i19)
+            org.apache.thrift.protocol.TMap _map24 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
+            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map24.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _key25;
+            @org.apache.thrift.annotation.Nullable java.lang.String _val26;
+            for (int _i27 = 0; _i27 < _map24.size; ++_i27)
             {
-              _key17 = iprot.readString();
-              _val18 = iprot.readString();
-              struct.headerMap.put(_key17, _val18);
+              _key25 = iprot.readString();
+              _val26 = iprot.readString();
+              struct.headerMap.put(_key25, _val26);
             }
           }
           struct.setHeaderMapIsSet(true);
@@ -39829,15 +42244,15 @@ public class Server {
             case 5: // HEADER_MAP
               if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
                 {
-                  org.apache.thrift.protocol.TMap _map20 = iprot.readMapBegin();
-                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map20.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _key21;
-                  @org.apache.thrift.annotation.Nullable java.lang.String _val22;
-                  for (int _i23 = 0; _i23 < _map20.size; ++_i23)
+                  org.apache.thrift.protocol.TMap _map28 = iprot.readMapBegin();
+                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map28.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _key29;
+                  @org.apache.thrift.annotation.Nullable java.lang.String _val30;
+                  for (int _i31 = 0; _i31 < _map28.size; ++_i31)
                   {
-                    _key21 = iprot.readString();
-                    _val22 = iprot.readString();
-                    struct.headerMap.put(_key21, _val22);
+                    _key29 = iprot.readString();
+                    _val30 = iprot.readString();
+                    struct.headerMap.put(_key29, _val30);
                   }
                   iprot.readMapEnd();
                 }
@@ -39886,10 +42301,10 @@ public class Server {
           oprot.writeFieldBegin(HEADER_MAP_FIELD_DESC);
           {
             oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING, struct.headerMap.size()));
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter24 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter32 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter24.getKey());
-              oprot.writeString(_iter24.getValue());
+              oprot.writeString(_iter32.getKey());
+              oprot.writeString(_iter32.getValue());
             }
             oprot.writeMapEnd();
           }
@@ -39945,10 +42360,10 @@ public class Server {
         if (struct.isSetHeaderMap()) {
           {
             oprot.writeI32(struct.headerMap.size());
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter25 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter33 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter25.getKey());
-              oprot.writeString(_iter25.getValue());
+              oprot.writeString(_iter33.getKey());
+              oprot.writeString(_iter33.getValue());
             }
           }
         }
@@ -39978,15 +42393,15 @@ public class Server {
         }
         if (incoming.get(4)) {
           {
-            org.apache.thrift.protocol.TMap _map26 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
-            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map26.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _key27;
-            @org.apache.thrift.annotation.Nullable java.lang.String _val28;
-            for (int _i29 = 0; _i29 < _map26.size; ++_i29)
+            org.apache.thrift.protocol.TMap _map34 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
+            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map34.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _key35;
+            @org.apache.thrift.annotation.Nullable java.lang.String _val36;
+            for (int _i37 = 0; _i37 < _map34.size; ++_i37)
             {
-              _key27 = iprot.readString();
-              _val28 = iprot.readString();
-              struct.headerMap.put(_key27, _val28);
+              _key35 = iprot.readString();
+              _val36 = iprot.readString();
+              struct.headerMap.put(_key35, _val36);
             }
           }
           struct.setHeaderMapIsSet(true);
@@ -43445,15 +45860,15 @@ public class Server {
             case 0: // SUCCESS
               if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
                 {
-                  org.apache.thrift.protocol.TMap _map30 = iprot.readMapBegin();
-                  struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map30.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _key31;
-                  @org.apache.thrift.annotation.Nullable java.lang.String _val32;
-                  for (int _i33 = 0; _i33 < _map30.size; ++_i33)
+                  org.apache.thrift.protocol.TMap _map38 = iprot.readMapBegin();
+                  struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map38.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _key39;
+                  @org.apache.thrift.annotation.Nullable java.lang.String _val40;
+                  for (int _i41 = 0; _i41 < _map38.size; ++_i41)
                   {
-                    _key31 = iprot.readString();
-                    _val32 = iprot.readString();
-                    struct.success.put(_key31, _val32);
+                    _key39 = iprot.readString();
+                    _val40 = iprot.readString();
+                    struct.success.put(_key39, _val40);
                   }
                   iprot.readMapEnd();
                 }
@@ -43482,10 +45897,10 @@ public class Server {
           oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
           {
             oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING, struct.success.size()));
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter34 : struct.success.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter42 : struct.success.entrySet())
             {
-              oprot.writeString(_iter34.getKey());
-              oprot.writeString(_iter34.getValue());
+              oprot.writeString(_iter42.getKey());
+              oprot.writeString(_iter42.getValue());
             }
             oprot.writeMapEnd();
           }
@@ -43517,10 +45932,10 @@ public class Server {
         if (struct.isSetSuccess()) {
           {
             oprot.writeI32(struct.success.size());
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter35 : struct.success.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter43 : struct.success.entrySet())
             {
-              oprot.writeString(_iter35.getKey());
-              oprot.writeString(_iter35.getValue());
+              oprot.writeString(_iter43.getKey());
+              oprot.writeString(_iter43.getValue());
             }
           }
         }
@@ -43532,15 +45947,15 @@ public class Server {
         java.util.BitSet incoming = iprot.readBitSet(1);
         if (incoming.get(0)) {
           {
-            org.apache.thrift.protocol.TMap _map36 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
-            struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map36.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _key37;
-            @org.apache.thrift.annotation.Nullable java.lang.String _val38;
-            for (int _i39 = 0; _i39 < _map36.size; ++_i39)
+            org.apache.thrift.protocol.TMap _map44 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
+            struct.success = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map44.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _key45;
+            @org.apache.thrift.annotation.Nullable java.lang.String _val46;
+            for (int _i47 = 0; _i47 < _map44.size; ++_i47)
             {
-              _key37 = iprot.readString();
-              _val38 = iprot.readString();
-              struct.success.put(_key37, _val38);
+              _key45 = iprot.readString();
+              _val46 = iprot.readString();
+              struct.success.put(_key45, _val46);
             }
           }
           struct.setSuccessIsSet(true);
@@ -43970,15 +46385,15 @@ public class Server {
             case 2: // HEADER_MAP
               if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
                 {
-                  org.apache.thrift.protocol.TMap _map40 = iprot.readMapBegin();
-                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map40.size);
-                  @org.apache.thrift.annotation.Nullable java.lang.String _key41;
-                  @org.apache.thrift.annotation.Nullable java.lang.String _val42;
-                  for (int _i43 = 0; _i43 < _map40.size; ++_i43)
+                  org.apache.thrift.protocol.TMap _map48 = iprot.readMapBegin();
+                  struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map48.size);
+                  @org.apache.thrift.annotation.Nullable java.lang.String _key49;
+                  @org.apache.thrift.annotation.Nullable java.lang.String _val50;
+                  for (int _i51 = 0; _i51 < _map48.size; ++_i51)
                   {
-                    _key41 = iprot.readString();
-                    _val42 = iprot.readString();
-                    struct.headerMap.put(_key41, _val42);
+                    _key49 = iprot.readString();
+                    _val50 = iprot.readString();
+                    struct.headerMap.put(_key49, _val50);
                   }
                   iprot.readMapEnd();
                 }
@@ -44012,10 +46427,10 @@ public class Server {
           oprot.writeFieldBegin(HEADER_MAP_FIELD_DESC);
           {
             oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING, struct.headerMap.size()));
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter44 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter52 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter44.getKey());
-              oprot.writeString(_iter44.getValue());
+              oprot.writeString(_iter52.getKey());
+              oprot.writeString(_iter52.getValue());
             }
             oprot.writeMapEnd();
           }
@@ -44053,10 +46468,10 @@ public class Server {
         if (struct.isSetHeaderMap()) {
           {
             oprot.writeI32(struct.headerMap.size());
-            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter45 : struct.headerMap.entrySet())
+            for (java.util.Map.Entry<java.lang.String, java.lang.String> _iter53 : struct.headerMap.entrySet())
             {
-              oprot.writeString(_iter45.getKey());
-              oprot.writeString(_iter45.getValue());
+              oprot.writeString(_iter53.getKey());
+              oprot.writeString(_iter53.getValue());
             }
           }
         }
@@ -44073,15 +46488,15 @@ public class Server {
         }
         if (incoming.get(1)) {
           {
-            org.apache.thrift.protocol.TMap _map46 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
-            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map46.size);
-            @org.apache.thrift.annotation.Nullable java.lang.String _key47;
-            @org.apache.thrift.annotation.Nullable java.lang.String _val48;
-            for (int _i49 = 0; _i49 < _map46.size; ++_i49)
+            org.apache.thrift.protocol.TMap _map54 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.STRING); 
+            struct.headerMap = new java.util.HashMap<java.lang.String,java.lang.String>(2*_map54.size);
+            @org.apache.thrift.annotation.Nullable java.lang.String _key55;
+            @org.apache.thrift.annotation.Nullable java.lang.String _val56;
+            for (int _i57 = 0; _i57 < _map54.size; ++_i57)
             {
-              _key47 = iprot.readString();
-              _val48 = iprot.readString();
-              struct.headerMap.put(_key47, _val48);
+              _key55 = iprot.readString();
+              _val56 = iprot.readString();
+              struct.headerMap.put(_key55, _val56);
             }
           }
           struct.setHeaderMapIsSet(true);
@@ -0,0 +1,919 @@
+/**
+ * Autogenerated by Thrift Compiler (0.19.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ *  @generated
+ */
+package com.jetbrains.cef.remote.thrift_codegen;
+
+@SuppressWarnings({"cast", "rawtypes", "serial", "unchecked", "unused"})
+public class ServerMetrics implements org.apache.thrift.TBase<ServerMetrics, ServerMetrics._Fields>, java.io.Serializable, Cloneable, Comparable<ServerMetrics> {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("ServerMetrics");
+
+  private static final org.apache.thrift.protocol.TField SERVER_METHODS_FIELD_DESC = new org.apache.thrift.protocol.TField("serverMethods", org.apache.thrift.protocol.TType.LIST, (short)1);
+  private static final org.apache.thrift.protocol.TField CLIENT_CALLBACKS_FIELD_DESC = new org.apache.thrift.protocol.TField("clientCallbacks", org.apache.thrift.protocol.TType.LIST, (short)2);
+  private static final org.apache.thrift.protocol.TField COUNTERS_FIELD_DESC = new org.apache.thrift.protocol.TField("counters", org.apache.thrift.protocol.TType.MAP, (short)3);
+  private static final org.apache.thrift.protocol.TField CONNECTIONS_FIELD_DESC = new org.apache.thrift.protocol.TField("connections", org.apache.thrift.protocol.TType.LIST, (short)4);
+
+  private static final org.apache.thrift.scheme.SchemeFactory STANDARD_SCHEME_FACTORY = new ServerMetricsStandardSchemeFactory();
+  private static final org.apache.thrift.scheme.SchemeFactory TUPLE_SCHEME_FACTORY = new ServerMetricsTupleSchemeFactory();
+
+  public @org.apache.thrift.annotation.Nullable java.util.List<MethodMetrics> serverMethods; // required
+  public @org.apache.thrift.annotation.Nullable java.util.List<MethodMetrics> clientCallbacks; // required
+  public @org.apache.thrift.annotation.Nullable java.util.Map<java.lang.String,java.lang.Long> counters; // required
+  public @org.apache.thrift.annotation.Nullable java.util.List<ConnectionMetrics> connections; // required
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    SERVER_METHODS((short)1, "serverMethods"),
+    CLIENT_CALLBACKS((short)2, "clientCallbacks"),
+    COUNTERS((short)3, "counters"),
+    CONNECTIONS((short)4, "connections");
+
+    private static final java.util.Map<java.lang.String, _Fields> byName = new java.util.HashMap<java.lang.String, _Fields>();
+
+    static {
+      for (_Fields field : java.util.EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // SERVER_METHODS
+          return SERVER_METHODS;
+        case 2: // CLIENT_CALLBACKS
+          return CLIENT_CALLBACKS;
+        case 3: // COUNTERS
+          return COUNTERS;
+        case 4: // CONNECTIONS
+          return CONNECTIONS;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new java.lang.IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    @org.apache.thrift.annotation.Nullable
+    public static _Fields findByName(java.lang.String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final java.lang.String _fieldName;
+
+    _Fields(short thriftId, java.lang.String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    @Override
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    @Override
+    public java.lang.String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  public static final java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    java.util.Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new java.util.EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.SERVER_METHODS, new org.apache.thrift.meta_data.FieldMetaData("serverMethods", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+        new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+            new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, MethodMetrics.class))));
+    tmpMap.put(_Fields.CLIENT_CALLBACKS, new org.apache.thrift.meta_data.FieldMetaData("clientCallbacks", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+        new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+            new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, MethodMetrics.class))));
+    tmpMap.put(_Fields.COUNTERS, new org.apache.thrift.meta_data.FieldMetaData("counters", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+        new org.apache.thrift.meta_data.MapMetaData(org.apache.thrift.protocol.TType.MAP, 
+            new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING), 
+            new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64))));
+    tmpMap.put(_Fields.CONNECTIONS, new org.apache.thrift.meta_data.FieldMetaData("connections", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+        new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+            new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ConnectionMetrics.class))));
+    metaDataMap = java.util.Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(ServerMetrics.class, metaDataMap);
+  }
+
+  public ServerMetrics() {
+  }
+
+  public ServerMetrics(
+    java.util.List<MethodMetrics> serverMethods,
+    java.util.List<MethodMetrics> clientCallbacks,
+    java.util.Map<java.lang.String,java.lang.Long> counters,
+    java.util.List<ConnectionMetrics> connections)
+  {
+    this();
+    this.serverMethods = serverMethods;
+    this.clientCallbacks = clientCallbacks;
+    this.counters = counters;
+    this.connections = connections;
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public ServerMetrics(ServerMetrics other) {
+    if (other.isSetServerMethods()) {
+      java.util.List<MethodMetrics> __this__serverMethods = new java.util.ArrayList<MethodMetrics>(other.serverMethods.size());
+      for (MethodMetrics other_element : other.serverMethods) {
+        __this__serverMethods.add(new MethodMetrics(other_element));
+      }
+      this.serverMethods = __this__serverMethods;
+    }
+    if (other.isSetClientCallbacks()) {
+      java.util.List<MethodMetrics> __this__clientCallbacks = new java.util.ArrayList<MethodMetrics>(other.clientCallbacks.size());
+      for (MethodMetrics other_element : other.clientCallbacks) {
+        __this__clientCallbacks.add(new MethodMetrics(other_element));
+      }
+      this.clientCallbacks = __this__clientCallbacks;
+    }
+    if (other.isSetCounters()) {
+      java.util.Map<java.lang.String,java.lang.Long> __this__counters = new java.util.HashMap<java.lang.String,java.lang.Long>(other.counters);
+      this.counters = __this__counters;
+    }
+    if (other.isSetConnections()) {
+      java.util.List<ConnectionMetrics> __this__connections = new java.util.ArrayList<ConnectionMetrics>(other.connections.size());
+      for (ConnectionMetrics other_element : other.connections) {
+        __this__connections.add(new ConnectionMetrics(other_element));
+      }
+      this.connections = __this__connections;
+    }
+  }
+
+  @Override
+  public ServerMetrics deepCopy() {
+    return new ServerMetrics(this);
+  }
+
+  @Override
+  public void clear() {
+    this.serverMethods = null;
+    this.clientCallbacks = null;
+    this.counters = null;
+    this.connections = null;
+  }
+
+  public int getServerMethodsSize() {
+    return (this.serverMethods == null) ? 0 : this.serverMethods.size();
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.Iterator<MethodMetrics> getServerMethodsIterator() {
+    return (this.serverMethods == null) ? null : this.serverMethods.iterator();
+  }
+
+  public void addToServerMethods(MethodMetrics elem) {
+    if (this.serverMethods == null) {
+      this.serverMethods = new java.util.ArrayList<MethodMetrics>();
+    }
+    this.serverMethods.add(elem);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.List<MethodMetrics> getServerMethods() {
+    return this.serverMethods;
+  }
+
+  public ServerMetrics setServerMethods(@org.apache.thrift.annotation.Nullable java.util.List<MethodMetrics> serverMethods) {
+    this.serverMethods = serverMethods;
+    return this;
+  }
+
+  public void unsetServerMethods() {
+    this.serverMethods = null;
+  }
+
+  /** Returns true if field serverMethods is set (has been assigned a value) and false otherwise */
+  public boolean isSetServerMethods() {
+    return this.serverMethods != null;
+  }
+
+  public void setServerMethodsIsSet(boolean value) {
+    if (!value) {
+      this.serverMethods = null;
+    }
+  }
+
+  public int getClientCallbacksSize() {
+    return (this.clientCallbacks == null) ? 0 : this.clientCallbacks.size();
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.Iterator<MethodMetrics> getClientCallbacksIterator() {
+    return (this.clientCallbacks == null) ? null : this.clientCallbacks.iterator();
+  }
+
+  public void addToClientCallbacks(MethodMetrics elem) {
+    if (this.clientCallbacks == null) {
+      this.clientCallbacks = new java.util.ArrayList<MethodMetrics>();
+    }
+    this.clientCallbacks.add(elem);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.List<MethodMetrics> getClientCallbacks() {
+    return this.clientCallbacks;
+  }
+
+  public ServerMetrics setClientCallbacks(@org.apache.thrift.annotation.Nullable java.util.List<MethodMetrics> clientCallbacks) {
+    this.clientCallbacks = clientCallbacks;
+    return this;
+  }
+
+  public void unsetClientCallbacks() {
+    this.clientCallbacks = null;
+  }
+
+  /** Returns true if field clientCallbacks is set (has been assigned a value) and false otherwise */
+  public boolean isSetClientCallbacks() {
+    return this.clientCallbacks != null;
+  }
+
+  public void setClientCallbacksIsSet(boolean value) {
+    if (!value) {
+      this.clientCallbacks = null;
+    }
+  }
+
+  public int getCountersSize() {
+    return (this.counters == null) ? 0 : this.counters.size();
+  }
+
+  public void putToCounters(java.lang.String key, long val) {
+    if (this.counters == null) {
+      this.counters = new java.util.HashMap<java.lang.String,java.lang.Long>();
+    }
+    this.counters.put(key, val);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.Map<java.lang.String,java.lang.Long> getCounters() {
+    return this.counters;
+  }
+
+  public ServerMetrics setCounters(@org.apache.thrift.annotation.Nullable java.util.Map<java.lang.String,java.lang.Long> counters) {
+    this.counters = counters;
+    return this;
+  }
+
+  public void unsetCounters() {
+    this.counters = null;
+  }
+
+  /** Returns true if field counters is set (has been assigned a value) and false otherwise */
+  public boolean isSetCounters() {
+    return this.counters != null;
+  }
+
+  public void setCountersIsSet(boolean value) {
+    if (!value) {
+      this.counters = null;
+    }
+  }
+
+  public int getConnectionsSize() {
+    return (this.connections == null) ? 0 : this.connections.size();
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.Iterator<ConnectionMetrics> getConnectionsIterator() {
+    return (this.connections == null) ? null : this.connections.iterator();
+  }
+
+  public void addToConnections(ConnectionMetrics elem) {
+    if (this.connections == null) {
+      this.connections = new java.util.ArrayList<ConnectionMetrics>();
+    }
+    this.connections.add(elem);
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  public java.util.List<ConnectionMetrics> getConnections() {
+    return this.connections;
+  }
+
+  public ServerMetrics setConnections(@org.apache.thrift.annotation.Nullable java.util.List<ConnectionMetrics> connections) {
+    this.connections = connections;
+    return this;
+  }
+
+  public void unsetConnections() {
+    this.connections = null;
+  }
+
+  /** Returns true if field connections is set (has been assigned a value) and false otherwise */
+  public boolean isSetConnections() {
+    return this.connections != null;
+  }
+
+  public void setConnectionsIsSet(boolean value) {
+    if (!value) {
+      this.connections = null;
+    }
+  }
+
+  @Override
+  public void setFieldValue(_Fields field, @org.apache.thrift.annotation.Nullable java.lang.Object value) {
+    switch (field) {
+    case SERVER_METHODS:
+      if (value == null) {
+        unsetServerMethods();
+      } else {
+        setServerMethods((java.util.List<MethodMetrics>)value);
+      }
+      break;
+
+    case CLIENT_CALLBACKS:
+      if (value == null) {
+        unsetClientCallbacks();
+      } else {
+        setClientCallbacks((java.util.List<MethodMetrics>)value);
+      }
+      break;
+
+    case COUNTERS:
+      if (value == null) {
+        unsetCounters();
+      } else {
+        setCounters((java.util.Map<java.lang.String,java.lang.Long>)value);
+      }
+      break;
+
+    case CONNECTIONS:
+      if (value == null) {
+        unsetConnections();
+      } else {
+        setConnections((java.util.List<ConnectionMetrics>)value);
+      }
+      break;
+
+    }
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public java.lang.Object getFieldValue(_Fields field) {
+    switch (field) {
+    case SERVER_METHODS:
+      return getServerMethods();
+
+    case CLIENT_CALLBACKS:
+      return getClientCallbacks();
+
+    case COUNTERS:
+      return getCounters();
+
+    case CONNECTIONS:
+      return getConnections();
+
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  @Override
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new java.lang.IllegalArgumentException();
+    }
+
+    switch (field) {
+    case SERVER_METHODS:
+      return isSetServerMethods();
+    case CLIENT_CALLBACKS:
+      return isSetClientCallbacks();
+    case COUNTERS:
+      return isSetCounters();
+    case CONNECTIONS:
+      return isSetConnections();
+    }
+    throw new java.lang.IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(java.lang.Object that) {
+    if (that instanceof ServerMetrics)
+      return this.equals((ServerMetrics)that);
+    return false;
+  }
+
+  public boolean equals(ServerMetrics that) {
+    if (that == null)
+      return false;
+    if (this == that)
+      return true;
+
+    boolean this_present_serverMethods = true && this.isSetServerMethods();
+    boolean that_present_serverMethods = true && that.isSetServerMethods();
+    if (this_present_serverMethods || that_present_serverMethods) {
+      if (!(this_present_serverMethods && that_present_serverMethods))
+        return false;
+      if (!this.serverMethods.equals(that.serverMethods))
+        return false;
+    }
+
+    boolean this_present_clientCallbacks = true && this.isSetClientCallbacks();
+    boolean that_present_clientCallbacks = true && that.isSetClientCallbacks();
+    if (this_present_clientCallbacks || that_present_clientCallbacks) {
+      if (!(this_present_clientCallbacks && that_present_clientCallbacks))
+        return false;
+      if (!this.clientCallbacks.equals(that.clientCallbacks))
+        return false;
+    }
+
+    boolean this_present_counters = true && this.isSetCounters();
+    boolean that_present_counters = true && that.isSetCounters();
+    if (this_present_counters || that_present_counters) {
+      if (!(this_present_counters && that_present_counters))
+        return false;
+      if (!this.counters.equals(that.counters))
+        return false;
+    }
+
+    boolean this_present_connections = true && this.isSetConnections();
+    boolean that_present_connections = true && that.isSetConnections();
+    if (this_present_connections || that_present_connections) {
+      if (!(this_present_connections && that_present_connections))
+        return false;
+      if (!this.connections.equals(that.connections))
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    int hashCode = 1;
+
+    hashCode = hashCode * 8191 + ((isSetServerMethods()) ? 131071 : 524287);
+    if (isSetServerMethods())
+      hashCode = hashCode * 8191 + serverMethods.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetClientCallbacks()) ? 131071 : 524287);
+    if (isSetClientCallbacks())
+      hashCode = hashCode * 8191 + clientCallbacks.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetCounters()) ? 131071 : 524287);
+    if (isSetCounters())
+      hashCode = hashCode * 8191 + counters.hashCode();
+
+    hashCode = hashCode * 8191 + ((isSetConnections()) ? 131071 : 524287);
+    if (isSetConnections())
+      hashCode = hashCode * 8191 + connections.hashCode();
+
+    return hashCode;
+  }
+
+  @Override
+  public int compareTo(ServerMetrics other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+
+    lastComparison = java.lang.Boolean.compare(isSetServerMethods(), other.isSetServerMethods());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetServerMethods()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.serverMethods, other.serverMethods);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetClientCallbacks(), other.isSetClientCallbacks());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetClientCallbacks()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.clientCallbacks, other.clientCallbacks);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetCounters(), other.isSetCounters());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetCounters()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.counters, other.counters);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = java.lang.Boolean.compare(isSetConnections(), other.isSetConnections());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetConnections()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.connections, other.connections);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  @org.apache.thrift.annotation.Nullable
+  @Override
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  @Override
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    scheme(iprot).read(iprot, this);
+  }
+
+  @Override
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    scheme(oprot).write(oprot, this);
+  }
+
+  @Override
+  public java.lang.String toString() {
+    java.lang.StringBuilder sb = new java.lang.StringBuilder("ServerMetrics(");
+    boolean first = true;
+
+    sb.append("serverMethods:");
+    if (this.serverMethods == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.serverMethods);
+    }
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("clientCallbacks:");
+    if (this.clientCallbacks == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.clientCallbacks);
+    }
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("counters:");
+    if (this.counters == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.counters);
+    }
+    first = false;
+    if (!first) sb.append(", ");
+    sb.append("connections:");
+    if (this.connections == null) {
+      sb.append("null");
+    } else {
+      sb.append(this.connections);
+    }
+    first = false;
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+    // check for sub-struct validity
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, java.lang.ClassNotFoundException {
+    try {
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private static class ServerMetricsStandardSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ServerMetricsStandardScheme getScheme() {
+      return new ServerMetricsStandardScheme();
+    }
+  }
+
+  private static class ServerMetricsStandardScheme extends org.apache.thrift.scheme.StandardScheme<ServerMetrics> {
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol iprot, ServerMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField schemeField;
+      iprot.readStructBegin();
+      while (true)
+      {
+        schemeField = iprot.readFieldBegin();
+        if (schemeField.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (schemeField.id) {
+          case 1: // SERVER_METHODS
+            if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+              {
+                org.apache.thrift.protocol.TList _list18 = iprot.readListBegin();
+                struct.serverMethods = new java.util.ArrayList<MethodMetrics>(_list18.size);
+                @org.apache.thrift.annotation.Nullable MethodMetrics _elem19;
+                for (int _i20 = 0; _i20 < _list18.size; ++_i20)
+                {
+                  _elem19 = new MethodMetrics();
+                  _elem19.read(iprot);
+                  struct.serverMethods.add(_elem19);
+                }
+                iprot.readListEnd();
+              }
+              struct.setServerMethodsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 2: // CLIENT_CALLBACKS
+            if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+              {
+                org.apache.thrift.protocol.TList _list21 = iprot.readListBegin();
+                struct.clientCallbacks = new java.util.ArrayList<MethodMetrics>(_list21.size);
+                @org.apache.thrift.annotation.Nullable MethodMetrics _elem22;
+                for (int _i23 = 0; _i23 < _list21.size; ++_i23)
+                {
+                  _elem22 = new MethodMetrics();
+                  _elem22.read(iprot);
+                  struct.clientCallbacks.add(_elem22);
+                }
+                iprot.readListEnd();
+              }
+              struct.setClientCallbacksIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 3: // COUNTERS
+            if (schemeField.type == org.apache.thrift.protocol.TType.MAP) {
+              {
+                org.apache.thrift.protocol.TMap _map24 = iprot.readMapBegin();
+                struct.counters = new java.util.HashMap<java.lang.String,java.lang.Long>(2*_map24.size);
+                @org.apache.thrift.annotation.Nullable java.lang.String _key25;
+                long _val26;
+                for (int _i27 = 0; _i27 < _map24.size; ++_i27)
+                {
+                  _key25 = iprot.readString();
+                  _val26 = iprot.readI64();
+                  struct.counters.put(_key25, _val26);
+                }
+                iprot.readMapEnd();
+              }
+              struct.setCountersIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          case 4: // CONNECTIONS
+            if (schemeField.type == org.apache.thrift.protocol.TType.LIST) {
+              {
+                org.apache.thrift.protocol.TList _list28 = iprot.readListBegin();
+                struct.connections = new java.util.ArrayList<ConnectionMetrics>(_list28.size);
+                @org.apache.thrift.annotation.Nullable ConnectionMetrics _elem29;
+                for (int _i30 = 0; _i30 < _list28.size; ++_i30)
+                {
+                  _elem29 = new ConnectionMetrics();
+                  _elem29.read(iprot);
+                  struct.connections.add(_elem29);
+                }
+                iprot.readListEnd();
+              }
+              struct.setConnectionsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, schemeField.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      struct.validate();
+    }
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol oprot, ServerMetrics struct) throws org.apache.thrift.TException {
+      struct.validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      if (struct.serverMethods != null) {
+        oprot.writeFieldBegin(SERVER_METHODS_FIELD_DESC);
+        {
+          oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.serverMethods.size()));
+          for (MethodMetrics _iter31 : struct.serverMethods)
+          {
+            _iter31.write(oprot);
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+      if (struct.clientCallbacks != null) {
+        oprot.writeFieldBegin(CLIENT_CALLBACKS_FIELD_DESC);
+        {
+          oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.clientCallbacks.size()));
+          for (MethodMetrics _iter32 : struct.clientCallbacks)
+          {
+            _iter32.write(oprot);
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+      if (struct.counters != null) {
+        oprot.writeFieldBegin(COUNTERS_FIELD_DESC);
+        {
+          oprot.writeMapBegin(new org.apache.thrift.protocol.TMap(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.I64, struct.counters.size()));
+          for (java.util.Map.Entry<java.lang.String, java.lang.Long> _iter33 : struct.counters.entrySet())
+          {
+            oprot.writeString(_iter33.getKey());
+            oprot.writeI64(_iter33.getValue());
+          }
+          oprot.writeMapEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+      if (struct.connections != null) {
+        oprot.writeFieldBegin(CONNECTIONS_FIELD_DESC);
+        {
+          oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, struct.connections.size()));
+          for (ConnectionMetrics _iter34 : struct.connections)
+          {
+            _iter34.write(oprot);
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+  }
+
+  private static class ServerMetricsTupleSchemeFactory implements org.apache.thrift.scheme.SchemeFactory {
+    @Override
+    public ServerMetricsTupleScheme getScheme() {
+      return new ServerMetricsTupleScheme();
+    }
+  }
+
+  private static class ServerMetricsTupleScheme extends org.apache.thrift.scheme.TupleScheme<ServerMetrics> {
+
+    @Override
+    public void write(org.apache.thrift.protocol.TProtocol prot, ServerMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol oprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet optionals = new java.util.BitSet();
+      if (struct.isSetServerMethods()) {
+        optionals.set(0);
+      }
+      if (struct.isSetClientCallbacks()) {
+        optionals.set(1);
+      }
+      if (struct.isSetCounters()) {
+        optionals.set(2);
+      }
+      if (struct.isSetConnections()) {
+        optionals.set(3);
+      }
+      oprot.writeBitSet(optionals, 4);
+      if (struct.isSetServerMethods()) {
+        {
+          oprot.writeI32(struct.serverMethods.size());
+          for (MethodMetrics _iter35 : struct.serverMethods)
+          {
+            _iter35.write(oprot);
+          }
+        }
+      }
+      if (struct.isSetClientCallbacks()) {
+        {
+          oprot.writeI32(struct.clientCallbacks.size());
+          for (MethodMetrics _iter36 : struct.clientCallbacks)
+          {
+            _iter36.write(oprot);
+          }
+        }
+      }
+      if (struct.isSetCounters()) {
+        {
+          oprot.writeI32(struct.counters.size());
+          for (java.util.Map.Entry<java.lang.String, java.lang.Long> _iter37 : struct.counters.entrySet())
+          {
+            oprot.writeString(_iter37.getKey());
+            oprot.writeI64(_iter37.getValue());
+          }
+        }
+      }
+      if (struct.isSetConnections()) {
+        {
+          oprot.writeI32(struct.connections.size());
+          for (ConnectionMetrics _iter38 : struct.connections)
+          {
+            _iter38.write(oprot);
+          }
+        }
+      }
+    }
+
+    @Override
+    public void read(org.apache.thrift.protocol.TProtocol prot, ServerMetrics struct) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TTupleProtocol iprot = (org.apache.thrift.protocol.TTupleProtocol) prot;
+      java.util.BitSet incoming = iprot.readBitSet(4);
+      if (incoming.get(0)) {
+        {
+          org.apache.thrift.protocol.TList _list39 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRUCT);
+          struct.serverMethods = new java.util.ArrayList<MethodMetrics>(_list39.size);
+          @org.apache.thrift.annotation.Nullable MethodMetrics _elem40;
+          for (int _i41 = 0; _i41 < _list39.size; ++_i41)
+          {
+            _elem40 = new MethodMetrics();
+            _elem40.read(iprot);
+            struct.serverMethods.add(_elem40);
+          }
+        }
+        struct.setServerMethodsIsSet(true);
+      }
+      if (incoming.get(1)) {
+        {
+          org.apache.thrift.protocol.TList _list42 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRUCT);
+          struct.clientCallbacks = new java.util.ArrayList<MethodMetrics>(_list42.size);
+          @org.apache.thrift.annotation.Nullable MethodMetrics _elem43;
+          for (int _i44 = 0; _i44 < _list42.size; ++_i44)
+          {
+            _elem43 = new MethodMetrics();
+            _elem43.read(iprot);
+            struct.clientCallbacks.add(_elem43);
+          }
+        }
+        struct.setClientCallbacksIsSet(true);
+      }
+      if (incoming.get(2)) {
+        {
+          org.apache.thrift.protocol.TMap _map45 = iprot.readMapBegin(org.apache.thrift.protocol.TType.STRING, org.apache.thrift.protocol.TType.I64); 
+          struct.counters = new java.util.HashMap<java.lang.String,java.lang.Long>(2*_map45.size);
+          @org.apache.thrift.annotation.Nullable java.lang.String _key46;
+          long _val47;
+          for (int _i48 = 0; _i48 < _map45.size; ++_i48)
+          {
+            _key46 = iprot.readString();
+            _val47 = iprot.readI64();
+            struct.counters.put(_key46, _val47);
+          }
+        }
+        struct.setCountersIsSet(true);
+      }
+      if (incoming.get(3)) {
+        {
+          org.apache.thrift.protocol.TList _list49 = iprot.readListBegin(org.apache.thrift.protocol.TType.STRUCT);
+          struct.connections = new java.util.ArrayList<ConnectionMetrics>(_list49.size);
+          @org.apache.thrift.annotation.Nullable ConnectionMetrics _elem50;
+          for (int _i51 = 0; _i51 < _list49.size; ++_i51)
+          {
+            _elem50 = new ConnectionMetrics();
+            _elem50.read(iprot);
+            struct.connections.add(_elem50);
+          }
+        }
+        struct.setConnectionsIsSet(true);
+      }
+    }
+  }
+
+  private static <S extends org.apache.thrift.scheme.IScheme> S scheme(org.apache.thrift.protocol.TProtocol proto) {
+    return (org.apache.thrift.scheme.StandardScheme.class.equals(proto.getScheme()) ? STANDARD_SCHEME_FACTORY : TUPLE_SCHEME_FACTORY).getScheme();
+  }
+}
+
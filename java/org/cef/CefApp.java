@@ -5,6 +5,7 @@
 package org.cef;
 
 import com.jetbrains.cef.remote.CefServer;
+import com.jetbrains.cef.remote.thrift_codegen.ServerMetrics;
 import org.cef.callback.CefSchemeHandlerFactory;
 import org.cef.handler.CefAppHandler;
 import org.cef.handler.CefAppHandlerAdapter;
@@ -18,6 +19,7 @@ import java.awt.event.ActionListener;
 import java.lang.reflect.InvocationTargetException;
 import java.util.HashSet;
 import java.util.LinkedList;
+import java.util.Map;
 import java.util.concurrent.CompletableFuture;
 import java.util.concurrent.Executor;
 import java.util.concurrent.atomic.AtomicBoolean;
@@ -323,6 +325,44 @@ public class CefApp extends CefAppHandlerAdapter {
 
     public static final boolean isRemoteEnabled() { return IS_REMOTE_ENABLED; }
 
+    /**
+     * Returns process-wide counters of mouse input coalescing (see jcef.input.coalesce.ms):
+     * {merged moves, merged wheels, delivered events}. Returns null on error.
+     */
+    public static long[] getInputCoalescerCounters() {
+        if (IS_REMOTE_ENABLED) {
+            ServerMetrics metrics = CefServer.getMetrics();
+            if (metrics == null || metrics.getCounters() == null)
+                return null;
+            Map<String, Long> counters = metrics.getCounters();
+            return new long[] {counters.getOrDefault("input.mergedMoves", 0L),
+                    counters.getOrDefault("input.mergedWheels", 0L),
+                    counters.getOrDefault("input.delivered", 0L)};
+        }
+        try {
+            return N_GetInputCoalescerCounters();
+        } catch (UnsatisfiedLinkError ule) {
+            CefLog.Error("Failed to get input coalescer counters. %s", ule.getMessage());
+        }
+        return null;
+    }
+
+    /**
+     * Returns count of native (CEF) threads that were attached to the JVM to call java handlers. Threads stay
+     * attached for their lifetime, so the count grows only when new native threads appear. Returns -1 in remote
+     * mode (handlers are called via RPC) or on error.
+     */
+    public static long getThreadAttachCount() {
+        if (IS_REMOTE_ENABLED)
+            return -1;
+        try {
+            return N_GetThreadAttachCount();
+        } catch (UnsatisfiedLinkError ule) {
+            CefLog.Error("Failed to get thread attach count. %s", ule.getMessage());
+        }
+        return -1;
+    }
+
     /**
      * Returns the current state of CefApp.
      *
@@ -657,4 +697,8 @@ public class CefApp extends CefAppHandlerAdapter {
             String schemeName, String domainName, CefSchemeHandlerFactory factory);
 
     private native boolean N_ClearSchemeHandlerFactories();
+
+    private static native long[] N_GetInputCoalescerCounters();
+
+    private static native long N_GetThreadAttachCount();
 }
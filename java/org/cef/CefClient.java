@@ -1070,6 +1070,17 @@ public class CefClient extends CefClientHandler
             realHandler.onPaint(browser, popup, dirtyRects, buffer, width, height);
     }
 
+    @Override
+    public void onPaint(CefBrowser browser, boolean popup, int[] dirtyRects, int dirtyRectsCount,
+                        ByteBuffer buffer, int width, int height) {
+        if (remoteClient != null) CefLog.Error("mustn't be called.");
+        if (browser == null) return;
+
+        CefRenderHandler realHandler = browser.getRenderHandler();
+        if (realHandler != null)
+            realHandler.onPaint(browser, popup, dirtyRects, dirtyRectsCount, buffer, width, height);
+    }
+
     @Override
     public void addOnPaintListener(Consumer<CefPaintEvent> listener) {}
 
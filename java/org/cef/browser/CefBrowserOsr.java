@@ -378,6 +378,19 @@ class CefBrowserOsr extends CefBrowser_N implements CefRenderHandler {
     @Override
     public void onPaint(CefBrowser browser, boolean popup, Rectangle[] dirtyRects,
             ByteBuffer buffer, int width, int height) {
+        int[] packed = new int[dirtyRects.length*4];
+        for (int i = 0; i < dirtyRects.length; ++i) {
+            packed[i*4] = dirtyRects[i].x;
+            packed[i*4 + 1] = dirtyRects[i].y;
+            packed[i*4 + 2] = dirtyRects[i].width;
+            packed[i*4 + 3] = dirtyRects[i].height;
+        }
+        onPaint(browser, popup, packed, dirtyRects.length, buffer, width, height);
+    }
+
+    @Override
+    public void onPaint(CefBrowser browser, boolean popup, int[] dirtyRects, int dirtyRectsCount,
+            ByteBuffer buffer, int width, int height) {
         // if window is closing, canvas_ or opengl context could be null
         final GLContext context = canvas_ != null ? canvas_.getContext() : null;
 
@@ -390,7 +403,7 @@ class CefBrowserOsr extends CefBrowser_N implements CefRenderHandler {
             return;
         }
 
-        renderer_.onPaint(canvas_.getGL().getGL2(), popup, dirtyRects, buffer, width, height);
+        renderer_.onPaint(canvas_.getGL().getGL2(), popup, dirtyRects, dirtyRectsCount, buffer, width, height);
         context.release();
         SwingUtilities.invokeLater(new Runnable() {
             public void run() {
@@ -398,8 +411,12 @@ class CefBrowserOsr extends CefBrowser_N implements CefRenderHandler {
             }
         });
         if (!onPaintListeners.isEmpty()) {
+            // Listeners may retain the event, so rects are unpacked only here.
+            Rectangle[] rects = new Rectangle[dirtyRectsCount];
+            for (int i = 0; i < dirtyRectsCount; ++i)
+                rects[i] = new Rectangle(dirtyRects[i*4], dirtyRects[i*4 + 1], dirtyRects[i*4 + 2], dirtyRects[i*4 + 3]);
             CefPaintEvent paintEvent =
-                    new CefPaintEvent(browser, popup, dirtyRects, buffer, width, height);
+                    new CefPaintEvent(browser, popup, rects, buffer, width, height);
             for (Consumer<CefPaintEvent> l : onPaintListeners) {
                 l.accept(paintEvent);
             }
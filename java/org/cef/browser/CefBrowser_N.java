@@ -851,7 +851,7 @@ abstract class CefBrowser_N extends CefNativeAdapter implements CefBrowser, CefA
         try {
             checkNativeCtxInitialized();
             if (isNativeCtxInitialized_)
-                N_SendMouseEvent(e);
+                N_SendMouseEventPrimitive(e.getID(), e.getX(), e.getY(), e.getModifiersEx(), e.getClickCount(), e.getButton());
         } catch (UnsatisfiedLinkError ule) {
             ule.printStackTrace();
         }
@@ -866,7 +866,7 @@ abstract class CefBrowser_N extends CefNativeAdapter implements CefBrowser, CefA
         try {
             checkNativeCtxInitialized();
             if (isNativeCtxInitialized_)
-                N_SendMouseWheelEvent(e);
+                N_SendMouseWheelEventPrimitive(e.getScrollType(), e.getX(), e.getY(), e.getModifiersEx(), e.getWheelRotation(), e.getUnitsToScroll());
         } catch (UnsatisfiedLinkError ule) {
             ule.printStackTrace();
         }
@@ -1157,6 +1157,8 @@ abstract class CefBrowser_N extends CefNativeAdapter implements CefBrowser, CefA
     private final native void N_SendTouchEvent(CefTouchEvent e);
     private final native void N_SendMouseEvent(MouseEvent e);
     private final native void N_SendMouseWheelEvent(MouseWheelEvent e);
+    private final native void N_SendMouseEventPrimitive(int id, int x, int y, int modifiers, int clickCount, int button);
+    private final native void N_SendMouseWheelEventPrimitive(int scrollType, int x, int y, int modifiers, int delta, int unitsToScroll);
     private final native void N_DragTargetDragEnter(
             CefDragData dragData, Point pos, int modifiers, int allowed_ops);
     private final native void N_DragTargetDragOver(Point pos, int modifiers, int allowed_ops);
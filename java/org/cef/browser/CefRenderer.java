@@ -163,9 +163,22 @@ class CefRenderer {
         original_popup_rect_.setBounds(0, 0, 0, 0);
     }
 
-    @SuppressWarnings("static-access")
     protected void onPaint(GL2 gl2, boolean popup, Rectangle[] dirtyRects, ByteBuffer buffer,
             int width, int height) {
+        int[] packed = new int[dirtyRects.length*4];
+        for (int i = 0; i < dirtyRects.length; ++i) {
+            packed[i*4] = dirtyRects[i].x;
+            packed[i*4 + 1] = dirtyRects[i].y;
+            packed[i*4 + 2] = dirtyRects[i].width;
+            packed[i*4 + 3] = dirtyRects[i].height;
+        }
+        onPaint(gl2, popup, packed, dirtyRects.length, buffer, width, height);
+    }
+
+    // |dirtyRects| are packed as (x, y, width, height) quads.
+    @SuppressWarnings("static-access")
+    protected void onPaint(GL2 gl2, boolean popup, int[] dirtyRects, int dirtyRectsCount,
+            ByteBuffer buffer, int width, int height) {
         initialize(gl2);
 
         if (use_draw_pixels_) {
@@ -203,12 +216,13 @@ class CefRenderer {
                         gl2.GL_BGRA, gl2.GL_UNSIGNED_INT_8_8_8_8_REV, buffer);
             } else {
                 // Update just the dirty rectangles.
-                for (int i = 0; i < dirtyRects.length; ++i) {
-                    Rectangle rect = dirtyRects[i];
-                    gl2.glPixelStorei(gl2.GL_UNPACK_SKIP_PIXELS, rect.x);
-                    gl2.glPixelStorei(gl2.GL_UNPACK_SKIP_ROWS, rect.y);
-                    gl2.glTexSubImage2D(gl2.GL_TEXTURE_2D, 0, rect.x, rect.y, rect.width,
-                            rect.height, gl2.GL_BGRA, gl2.GL_UNSIGNED_INT_8_8_8_8_REV, buffer);
+                for (int i = 0; i < dirtyRectsCount; ++i) {
+                    final int x = dirtyRects[i*4];
+                    final int y = dirtyRects[i*4 + 1];
+                    gl2.glPixelStorei(gl2.GL_UNPACK_SKIP_PIXELS, x);
+                    gl2.glPixelStorei(gl2.GL_UNPACK_SKIP_ROWS, y);
+                    gl2.glTexSubImage2D(gl2.GL_TEXTURE_2D, 0, x, y, dirtyRects[i*4 + 2],
+                            dirtyRects[i*4 + 3], gl2.GL_BGRA, gl2.GL_UNSIGNED_INT_8_8_8_8_REV, buffer);
                 }
             }
         } else if (popup && popup_rect_.width > 0 && popup_rect_.height > 0) {
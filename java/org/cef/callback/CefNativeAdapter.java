@@ -4,8 +4,9 @@ import java.util.concurrent.locks.Lock;
 import java.util.concurrent.locks.ReentrantLock;
 
 public class CefNativeAdapter implements CefNative {
-    // Used internally to store a pointer to the CEF object.
-    private long N_CefHandle = 0;
+    // Used internally to store a pointer to the CEF object. Native code reads and
+    // writes this field directly (see GetNativeAdapterHandle in jni_scoped_helpers).
+    private volatile long N_CefHandle = 0;
     private final Lock lock = new ReentrantLock();
 
     // TODO: remove usages in Java: reimplement all native methods to obtain CefRefPtr safely (via JNI and lock)
@@ -0,0 +1,71 @@
+// Copyright (c) 2014 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+package org.cef.callback;
+
+import org.cef.network.CefURLRequest;
+
+import java.nio.ByteBuffer;
+
+/**
+ * CefURLRequest client for bulk downloads. Response data is copied into the direct buffer
+ * supplied by the client (so no Java objects are allocated per chunk) and progress
+ * notifications are rate-limited and carry 64-bit values.
+ */
+public interface CefStreamingURLRequestClient extends CefURLRequestClient {
+    /**
+     * Returns the direct buffer that receives response data. It's queried once when the request
+     * is created and must stay valid until the request completes.
+     */
+    ByteBuffer getDownloadBuffer();
+
+    /**
+     * Called when |length| bytes of the response were copied into the download buffer (starting
+     * at index 0). The data must be consumed (e.g. written into a file channel) before returning,
+     * the buffer is overwritten by the next call.
+     */
+    void onDownloadData(CefURLRequest request, int length);
+
+    /**
+     * Minimal interval between two progress notifications of the same kind, in milliseconds. The
+     * final notification (when |current| equals |total|) is always passed.
+     */
+    default long getProgressIntervalMs() {
+        return 100;
+    }
+
+    /**
+     * Notifies the client of upload progress, see
+     * {@link CefURLRequestClient#onUploadProgress(CefURLRequest, int, int)}.
+     */
+    void onUploadProgress(CefURLRequest request, long current, long total);
+
+    /**
+     * Notifies the client of download progress, see
+     * {@link CefURLRequestClient#onDownloadProgress(CefURLRequest, int, int)}.
+     */
+    void onDownloadProgress(CefURLRequest request, long current, long total);
+
+    @Override
+    default void onUploadProgress(CefURLRequest request, int current, int total) {
+        onUploadProgress(request, (long) current, (long) total);
+    }
+
+    @Override
+    default void onDownloadProgress(CefURLRequest request, int current, int total) {
+        onDownloadProgress(request, (long) current, (long) total);
+    }
+
+    @Override
+    default void onDownloadData(CefURLRequest request, byte[] data, int data_length) {
+        ByteBuffer buffer = getDownloadBuffer();
+        for (int offset = 0; offset < data_length;) {
+            final int length = Math.min(data_length - offset, buffer.capacity());
+            buffer.clear();
+            buffer.put(data, offset, length);
+            onDownloadData(request, length);
+            offset += length;
+        }
+    }
+}
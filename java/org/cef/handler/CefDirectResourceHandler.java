@@ -0,0 +1,38 @@
+// Copyright (c) 2014 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+package org.cef.handler;
+
+import org.cef.callback.CefCallback;
+import org.cef.misc.IntRef;
+
+import java.nio.ByteBuffer;
+
+/**
+ * Resource handler that receives response data buffers of CEF directly, so the data written by
+ * the handler isn't copied via intermediate Java arrays.
+ */
+public interface CefDirectResourceHandler extends CefResourceHandler {
+    /**
+     * Read response data. If data is available immediately put up to |bytesToRead| bytes into
+     * |dataOut| (starting at position 0), set |bytesRead| to the number of bytes written, and
+     * return true. To read the data at a later time set |bytesRead| to 0, return true and call
+     * CefCallback.Continue() when the data is available. To indicate response completion return
+     * false.
+     * @param dataOut Direct buffer wrapping the native buffer of CEF. Only valid within the scope
+     *         of this method, must not be retained.
+     * @param bytesToRead Size of the buffer.
+     * @param bytesRead Number of bytes written to the buffer.
+     * @param callback Callback to execute if data will be available asynchronously.
+     * @return True if more data is or will be available.
+     */
+    boolean readResponse(
+            ByteBuffer dataOut, int bytesToRead, IntRef bytesRead, CefCallback callback);
+
+    @Override
+    default boolean readResponse(
+            byte[] dataOut, int bytesToRead, IntRef bytesRead, CefCallback callback) {
+        return readResponse(ByteBuffer.wrap(dataOut), bytesToRead, bytesRead, callback);
+    }
+}
@@ -5,5 +5,16 @@ import org.cef.browser.CefBrowser;
 public interface CefNativeRenderHandler extends CefRenderHandler {
     void onPaintWithSharedMem(CefBrowser browser, boolean popup, int dirtyRectsCount,
                          String sharedMemName, long boostHandle, int width, int height);
+
+    /**
+     * Called when frame was published asynchronously (server doesn't wait for client). Frames that client
+     * didn't consume in time are dropped by server, so frameSeq can contain gaps. Implementations must acquire
+     * the frame (see SharedMemory.WithRaster.tryAcquireFrame) before reading the buffer. When this method isn't
+     * overridden, the legacy variant is called with the frame acquired by caller and with parameters of that frame.
+     */
+    default void onPaintWithSharedMem(CefBrowser browser, boolean popup, int dirtyRectsCount,
+                         String sharedMemName, long boostHandle, int width, int height, long frameSeq) {
+        onPaintWithSharedMem(browser, popup, dirtyRectsCount, sharedMemName, boostHandle, width, height);
+    }
     void disposeNativeResources();
 }
@@ -73,6 +73,27 @@ public interface CefRenderHandler {
     public void onPaint(CefBrowser browser, boolean popup, Rectangle[] dirtyRects,
             ByteBuffer buffer, int width, int height);
 
+    /**
+     * Handle painting. Called by the native code, default implementation unpacks
+     * dirty rects and calls {@link #onPaint(CefBrowser, boolean, Rectangle[], ByteBuffer, int, int)}.
+     * NOTE: |dirtyRects| and |buffer| are reused between frames, so they must not be
+     * retained after this method returns.
+     * @param browser The browser generating the event.
+     * @param popup True if painting a popup window.
+     * @param dirtyRects Dirty regions packed as (x, y, width, height) quads.
+     * @param dirtyRectsCount Count of dirty regions.
+     * @param buffer Pixel buffer for the whole window.
+     * @param width Width of the buffer.
+     * @param height Height of the buffer.
+     */
+    default void onPaint(CefBrowser browser, boolean popup, int[] dirtyRects, int dirtyRectsCount,
+            ByteBuffer buffer, int width, int height) {
+        Rectangle[] rects = new Rectangle[dirtyRectsCount];
+        for (int i = 0; i < dirtyRectsCount; ++i)
+            rects[i] = new Rectangle(dirtyRects[i*4], dirtyRects[i*4 + 1], dirtyRects[i*4 + 2], dirtyRects[i*4 + 3]);
+        onPaint(browser, popup, rects, buffer, width, height);
+    }
+
     /**
      * Add provided listener.
      * @param listener Code that gets executed after a frame was rendered.
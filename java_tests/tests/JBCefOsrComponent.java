@@ -68,6 +68,11 @@ class JBCefOsrComponent extends JPanel {
         myRenderHandler = renderHandler;
     }
 
+    void onLocationOnScreenChanged() {
+        if (myBrowser instanceof RemoteBrowser)
+            ((RemoteBrowser)myBrowser).updateViewGeometry();
+    }
+
     @Override
     public void addNotify() {
         super.addNotify();
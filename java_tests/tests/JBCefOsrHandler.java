@@ -81,6 +81,8 @@ public class JBCefOsrHandler implements CefNativeRenderHandler {
     private final CountDownLatch initLatch = new CountDownLatch(1);
 
     private final Map<String, SharedMemory.WithRaster> mySharedMemCache = new ConcurrentHashMap<>();
+    private long myLastFrameSeq = -1;
+    private long myDroppedFramesCount = 0;
     private boolean myIsDisposed = false;
 
     private JBCefFpsMeter myFpsMeter;
@@ -177,6 +179,11 @@ public class JBCefOsrHandler implements CefNativeRenderHandler {
 
     @Override
     public void onPaintWithSharedMem(CefBrowser browser, boolean popup, int dirtyRectsCount, String sharedMemName, long sharedMemHandle, int width, int height) {
+        onPaintWithSharedMem(browser, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, -1);
+    }
+
+    @Override
+    public void onPaintWithSharedMem(CefBrowser browser, boolean popup, int dirtyRectsCount, String sharedMemName, long sharedMemHandle, int width, int height, long frameSeq) {
         // TODO: support popups
         long startMs = System.currentTimeMillis();
 
@@ -187,62 +194,105 @@ public class JBCefOsrHandler implements CefNativeRenderHandler {
             mySharedMemCache.put(sharedMemName, mem);
         }
 
-        mem.setWidth(width);
-        mem.setHeight(height);
-        mem.setDirtyRectsCount(dirtyRectsCount);
-        mem.lasUsedMs = startMs;
+        // Frame was dropped by server (or already consumed), its dirty rects will be passed with the next frame.
+        if (frameSeq >= 0) {
+            mem = acquireNewestFrame();
+            if (mem == null)
+                return;
+        } else if (!mem.tryAcquire())
+            return;
 
-        BufferedImage bufImage = myImage;
-        VolatileImage volatileImage = myVolatileImage;
-        final double jreScale = myScale.getJreBiased();
-        final int scaledW = (int)(width / jreScale);
-        final int scaledH = (int)(height / jreScale);
-        if (volatileImage == null || volatileImage.getWidth() != scaledW || volatileImage.getHeight() != scaledH) {
-            try {
-                if (myComponent.getGraphicsConfiguration() == null)
-                    return; // TODO: hold more carefully
-
-                volatileImage = myComponent.getGraphicsConfiguration().createCompatibleVolatileImage(scaledW, scaledH, null, Transparency.TRANSLUCENT);
-                if (!JBR.isNativeRasterLoaderSupported())
-                    bufImage = new BufferedImage(width, height, BufferedImage.TYPE_INT_ARGB_PRE);
-            } catch (AWTException e) {
-                throw new RuntimeException(e);
+        try {
+            if (frameSeq >= 0) {
+                // Buffer can contain newer frame than the notified one (notifications are oneway, so they
+                // can describe frames that were already dropped or skipped)
+                final long seq = mem.getSeq();
+                if (seq > myLastFrameSeq + 1 && myLastFrameSeq >= 0)
+                    myDroppedFramesCount += seq - myLastFrameSeq - 1;
+                myLastFrameSeq = seq;
+                width = mem.getWidth();
+                height = mem.getHeight();
+            } else {
+                mem.setWidth(width);
+                mem.setHeight(height);
+                mem.setDirtyRectsCount(dirtyRectsCount);
             }
-            mem.setDirtyRectsCount(0);// will cause full raster loading
-        }
-        long midMs = System.currentTimeMillis();
+            mem.lasUsedMs = startMs;
+
+            BufferedImage bufImage = myImage;
+            VolatileImage volatileImage = myVolatileImage;
+            final double jreScale = myScale.getJreBiased();
+            final int scaledW = (int)(width / jreScale);
+            final int scaledH = (int)(height / jreScale);
+            if (volatileImage == null || volatileImage.getWidth() != scaledW || volatileImage.getHeight() != scaledH) {
+                try {
+                    if (myComponent.getGraphicsConfiguration() == null)
+                        return; // TODO: hold more carefully
+
+                    volatileImage = myComponent.getGraphicsConfiguration().createCompatibleVolatileImage(scaledW, scaledH, null, Transparency.TRANSLUCENT);
+                    if (!JBR.isNativeRasterLoaderSupported())
+                        bufImage = new BufferedImage(width, height, BufferedImage.TYPE_INT_ARGB_PRE);
+                } catch (AWTException e) {
+                    throw new RuntimeException(e);
+                }
+                mem.setDirtyRectsCount(0);// will cause full raster loading
+            }
+            long midMs = System.currentTimeMillis();
 
-        if (JBR.isNativeRasterLoaderSupported()) {
-            JBR.getNativeRasterLoader().loadNativeRaster(volatileImage, mem.getPtr(), mem.getWidth(), mem.getHeight(), mem.getPtr() + mem.getWidth()*mem.getHeight()*4, mem.getDirtyRectsCount());
-        } else {
-            // load buffered
-            loadBuffered(bufImage, mem);
+            if (JBR.isNativeRasterLoaderSupported()) {
+                JBR.getNativeRasterLoader().loadNativeRaster(volatileImage, mem.getPtr(), mem.getWidth(), mem.getHeight(), mem.getPtr() + mem.getWidth()*mem.getHeight()*4, mem.getDirtyRectsCount());
+            } else {
+                // load buffered
+                loadBuffered(bufImage, mem);
 
-            // draw buffered onto volatile
-            Graphics2D viGr = (Graphics2D)volatileImage.getGraphics().create();
-            try {
-                double sx = viGr.getTransform().getScaleX();
-                double sy = viGr.getTransform().getScaleY();
-                viGr.scale(1 / sx, 1 / sy);
-                viGr.drawImage(bufImage,
-                        0, 0, width, height,
-                        0, 0, width, height,
-                        null);
-            }
-            finally {
-                viGr.dispose();
+                // draw buffered onto volatile
+                Graphics2D viGr = (Graphics2D)volatileImage.getGraphics().create();
+                try {
+                    double sx = viGr.getTransform().getScaleX();
+                    double sy = viGr.getTransform().getScaleY();
+                    viGr.scale(1 / sx, 1 / sy);
+                    viGr.drawImage(bufImage,
+                            0, 0, width, height,
+                            0, 0, width, height,
+                            null);
+                }
+                finally {
+                    viGr.dispose();
+                }
             }
+            myVolatileImage = volatileImage;
+            myImage = bufImage;
+
+            // TODO: calculate outerRect
+            //Rectangle outerRect = findOuterRect(dirtyRects);
+            //SwingUtilities.invokeLater(() -> myComponent.repaint(scaleDown(outerRect)));
+            SwingUtilities.invokeLater(() -> myComponent.repaint());
+
+            long endMs = System.currentTimeMillis();
+            System.err.println("onPaintWithSharedMem spent " + (endMs - startMs) + " ms, load spent " + (endMs - midMs) + ", dropped frames " + myDroppedFramesCount);
+        } finally {
+            mem.release();
         }
-        myVolatileImage = volatileImage;
-        myImage = bufImage;
-
-        // TODO: calculate outerRect
-        //Rectangle outerRect = findOuterRect(dirtyRects);
-        //SwingUtilities.invokeLater(() -> myComponent.repaint(scaleDown(outerRect)));
-        SwingUtilities.invokeLater(() -> myComponent.repaint());
+    }
 
-        long endMs = System.currentTimeMillis();
-        System.err.println("onPaintWithSharedMem spent " + (endMs - startMs) + " ms, load spent " + (endMs - midMs));
+    // Acquires the newest published frame that is newer than the last loaded one. Older published frames are
+    // released without loading: server accumulates dirty rects of all unconsumed frames into the newest one.
+    private SharedMemory.WithRaster acquireNewestFrame() {
+        // NOTE: seq of the acquired frame can't be changed by server (it can only grow before acquiring)
+        ArrayList<SharedMemory.WithRaster> acquired = new ArrayList<>();
+        SharedMemory.WithRaster newest = null;
+        for (SharedMemory.WithRaster m: mySharedMemCache.values()) {
+            if (m.isClosed() || m.getSeq() <= myLastFrameSeq || !m.tryAcquireFrame())
+                continue;
+            acquired.add(m);
+            if (newest == null || m.getSeq() > newest.getSeq())
+                newest = m;
+        }
+        for (SharedMemory.WithRaster m: acquired) {
+            if (m != newest)
+                m.release();
+        }
+        return newest;
     }
 
     @Override
@@ -412,7 +462,9 @@ public class JBCefOsrHandler implements CefNativeRenderHandler {
 
     private void updateLocation() {
         // getLocationOnScreen() is an expensive op, so do not request it on every mouse move, but cache
-        myLocationOnScreenRef.set(myComponent.getLocationOnScreen());
+        Point loc = myComponent.getLocationOnScreen();
+        if (!loc.equals(myLocationOnScreenRef.getAndSet(loc)))
+            myComponent.onLocationOnScreenChanged();
     }
 
     private Point getLocation() {
@@ -0,0 +1,80 @@
+package tests.remote;
+
+import com.jetbrains.cef.remote.thrift_codegen.ClientHandlers;
+import com.jetbrains.cef.remote.thrift_codegen.Server;
+import org.apache.thrift.TBase;
+import org.apache.thrift.TException;
+import org.apache.thrift.protocol.TBinaryProtocol;
+import org.apache.thrift.protocol.TCompactProtocol;
+import org.apache.thrift.protocol.TProtocol;
+import org.apache.thrift.transport.TMemoryBuffer;
+import org.apache.thrift.transport.TTransport;
+import org.apache.thrift.transport.layered.TFramedTransport;
+
+import java.util.function.Supplier;
+
+/**
+ * Compares wire formats of cef_server channels (CEF_SERVER_PROTOCOL=binary|compact,
+ * CEF_SERVER_TRANSPORT=buffered|framed): size of typical small messages and time
+ * of their encoding + decoding (in memory, without socket io).
+ *
+ * Usage: WireFormatBenchmark [iterations]
+ */
+public class WireFormatBenchmark {
+    private static final int BATCH = 1000;
+
+    private interface Call {
+        void send(TProtocol protocol) throws TException;
+    }
+
+    public static void main(String[] args) throws TException {
+        final int iterations = args.length > 0 ? Integer.parseInt(args[0]) : 2000;
+        System.out.printf("%-8s %-9s %-34s %10s %10s%n", "protocol", "transport", "message", "bytes/msg", "ns/msg");
+        for (boolean compact : new boolean[]{false, true}) {
+            for (boolean framed : new boolean[]{false, true}) {
+                run(compact, framed, iterations, "Browser_SendMouseEvent",
+                        p -> new Server.Client(p).send_Browser_SendMouseEvent(1, 2, 512, 384, 0, 1, 0),
+                        Server.Browser_SendMouseEvent_args::new);
+                run(compact, framed, iterations, "LoadHandler_OnLoadingStateChange",
+                        p -> new ClientHandlers.Client(p).send_LoadHandler_OnLoadingStateChange(1, true, false, false),
+                        ClientHandlers.LoadHandler_OnLoadingStateChange_args::new);
+                run(compact, framed, iterations, "echo",
+                        p -> new Server.Client(p).send_echo("test_message786"),
+                        Server.echo_args::new);
+            }
+        }
+    }
+
+    private static void run(boolean compact, boolean framed, int iterations, String name, Call call, Supplier<TBase<?, ?>> args) throws TException {
+        // Warmup
+        runBatches(compact, framed, Math.max(iterations / 10, 1), call, args);
+
+        final long startNs = System.nanoTime();
+        final long bytes = runBatches(compact, framed, iterations, call, args);
+        final long elapsedNs = System.nanoTime() - startNs;
+
+        final long messages = (long)iterations * BATCH;
+        System.out.printf("%-8s %-9s %-34s %10.1f %10.1f%n",
+                compact ? "compact" : "binary", framed ? "framed" : "buffered", name,
+                (double)bytes / messages, (double)elapsedNs / messages);
+    }
+
+    // Returns count of encoded bytes
+    private static long runBatches(boolean compact, boolean framed, int batches, Call call, Supplier<TBase<?, ?>> args) throws TException {
+        long bytes = 0;
+        for (int c = 0; c < batches; ++c) {
+            TMemoryBuffer buffer = new TMemoryBuffer(64*1024);
+            TTransport transport = framed ? new TFramedTransport(buffer) : buffer;
+            TProtocol protocol = compact ? new TCompactProtocol(transport) : new TBinaryProtocol(transport);
+            for (int i = 0; i < BATCH; ++i)
+                call.send(protocol);
+            bytes += buffer.length();
+            for (int i = 0; i < BATCH; ++i) {
+                protocol.readMessageBegin();
+                args.get().read(protocol);
+                protocol.readMessageEnd();
+            }
+        }
+        return bytes;
+    }
+}
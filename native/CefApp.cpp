@@ -10,7 +10,9 @@
 #include "include/cef_version.h"
 
 #include "context.h"
+#include "input_coalescer.h"
 #include "jcef_version.h"
+#include "jni_scoped_helpers.h"
 #include "jni_util.h"
 #include "scheme_handler_factory.h"
 #include "util.h"
@@ -90,6 +92,22 @@ Java_org_cef_CefApp_N_1ClearSchemeHandlerFactories(JNIEnv*, jobject) {
   return CefClearSchemeHandlerFactories() ? JNI_TRUE : JNI_FALSE;
 }
 
+JNIEXPORT jlongArray JNICALL
+Java_org_cef_CefApp_N_1GetInputCoalescerCounters(JNIEnv* env, jclass) {
+  const jlong counters[] = {InputCoalescer::GetMergedMovesCount(),
+                            InputCoalescer::GetMergedWheelsCount(),
+                            InputCoalescer::GetDeliveredCount()};
+  jlongArray result = env->NewLongArray(3);
+  if (result)
+    env->SetLongArrayRegion(result, 0, 3, counters);
+  return result;
+}
+
+JNIEXPORT jlong JNICALL
+Java_org_cef_CefApp_N_1GetThreadAttachCount(JNIEnv*, jclass) {
+  return ScopedJNIEnv::GetAttachCount();
+}
+
 JNIEXPORT jboolean JNICALL
 Java_org_cef_CefApp_N_1Startup(JNIEnv* env,
                                jclass,
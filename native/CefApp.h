@@ -78,6 +78,22 @@ Java_org_cef_CefApp_N_1RegisterSchemeHandlerFactory(JNIEnv*,
 JNIEXPORT jboolean JNICALL
 Java_org_cef_CefApp_N_1ClearSchemeHandlerFactories(JNIEnv*, jobject);
 
+/*
+ * Class:     org_cef_CefApp
+ * Method:    N_GetInputCoalescerCounters
+ * Signature: ()[J
+ */
+JNIEXPORT jlongArray JNICALL
+Java_org_cef_CefApp_N_1GetInputCoalescerCounters(JNIEnv*, jclass);
+
+/*
+ * Class:     org_cef_CefApp
+ * Method:    N_GetThreadAttachCount
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL
+Java_org_cef_CefApp_N_1GetThreadAttachCount(JNIEnv*, jclass);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,7 @@
 #include "client_handler.h"
 #include "critical_wait.h"
 #include "devtools_message_observer.h"
+#include "input_coalescer.h"
 #include "int_callback.h"
 #include "jni_util.h"
 #include "keyboard_utils.h"
@@ -71,6 +72,20 @@ int GetCefModifiers(JNIEnv* env, jclass cls, int modifiers) {
   return cef_modifiers;
 }
 
+// Returns nullptr when input coalescing is disabled (jcef.input.coalesce.ms=0).
+CefRefPtr<InputCoalescer> GetInputCoalescer(JNIEnv* env,
+                                            CefRefPtr<CefBrowser> browser) {
+  static const int latency_ms =
+      (int)GetJavaSystemPropertyLong("jcef.input.coalesce.ms", env, 8);
+  return InputCoalescer::Get(browser, latency_ms);
+}
+
+void FlushCoalescedInput(JNIEnv* env, CefRefPtr<CefBrowser> browser) {
+  CefRefPtr<InputCoalescer> coalescer = GetInputCoalescer(env, browser);
+  if (coalescer)
+    coalescer->Flush();
+}
+
 struct JNIObjectsForCreate {
  public:
   ScopedJNIObjectGlobal jbrowser;
@@ -937,6 +952,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1SendKeyEvent(JNIEnv* env,
   cef_key_event.native_key_code = eventAttributes.native_key_code;
   cef_key_event.windows_key_code = eventAttributes.windows_key_code;
   cef_key_event.is_system_key = eventAttributes.is_system_key;
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->SendKeyEvent(cef_key_event);
 }
 
@@ -1006,6 +1022,7 @@ void Java_org_cef_browser_CefBrowser_1N_N_1SendTouchEvent(JNIEnv* env,
   event.modifiers = GetCefModifiers(env, cls, modifiers);
   event.pointer_type = GetPointerType(env, jPointerType);
 
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->SendTouchEvent(event);
 }
 
@@ -1041,6 +1058,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1SendMouseEvent(JNIEnv* env,
   cef_event.y = y;
 
   cef_event.modifiers = GetCefModifiers(env, cls, modifiers);
+  FlushCoalescedInput(env, browser);
 
   if (event_type == JNI_STATIC(MOUSE_PRESSED) ||
       event_type == JNI_STATIC(MOUSE_RELEASED)) {
@@ -1103,6 +1121,8 @@ Java_org_cef_browser_CefBrowser_1N_N_1SendMouseWheelEvent(
 
   cef_event.modifiers = GetCefModifiers(env, cls, modifiers);
 
+  FlushCoalescedInput(env, browser);
+
   if (scroll_type == JNI_STATIC(WHEEL_UNIT_SCROLL)) {
     // Use the smarter version that considers platform settings.
     CallJNIMethodI_V(env, cls, mouse_wheel_event, "getUnitsToScroll", &delta);
@@ -1121,6 +1141,109 @@ Java_org_cef_browser_CefBrowser_1N_N_1SendMouseWheelEvent(
   browser->GetHost()->SendMouseWheelEvent(cef_event, deltaX, deltaY);
 }
 
+JNIEXPORT void JNICALL
+Java_org_cef_browser_CefBrowser_1N_N_1SendMouseEventPrimitive(
+    JNIEnv* env,
+    jobject obj,
+    jint event_type,
+    jint x,
+    jint y,
+    jint modifiers,
+    jint click_count,
+    jint button) {
+  CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  ScopedJNIClass cls(env, "java/awt/event/MouseEvent");
+  if (!cls)
+    return;
+
+  JNI_STATIC_DEFINE_INT(env, cls, BUTTON1);
+  JNI_STATIC_DEFINE_INT(env, cls, BUTTON2);
+  JNI_STATIC_DEFINE_INT(env, cls, BUTTON3);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_DRAGGED);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_ENTERED);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_EXITED);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_MOVED);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_PRESSED);
+  JNI_STATIC_DEFINE_INT(env, cls, MOUSE_RELEASED);
+
+  CefMouseEvent cef_event;
+  cef_event.x = x;
+  cef_event.y = y;
+  cef_event.modifiers = GetCefModifiers(env, cls, modifiers);
+
+  if (event_type == JNI_STATIC(MOUSE_PRESSED) ||
+      event_type == JNI_STATIC(MOUSE_RELEASED)) {
+    CefBrowserHost::MouseButtonType cef_mbt;
+    if (button == JNI_STATIC(BUTTON1))
+      cef_mbt = MBT_LEFT;
+    else if (button == JNI_STATIC(BUTTON2))
+      cef_mbt = MBT_MIDDLE;
+    else if (button == JNI_STATIC(BUTTON3))
+      cef_mbt = MBT_RIGHT;
+    else
+      return;
+
+    FlushCoalescedInput(env, browser);
+    browser->GetHost()->SendMouseClickEvent(
+        cef_event, cef_mbt, (event_type == JNI_STATIC(MOUSE_RELEASED)),
+        click_count);
+  } else if (event_type == JNI_STATIC(MOUSE_MOVED) ||
+             event_type == JNI_STATIC(MOUSE_DRAGGED) ||
+             event_type == JNI_STATIC(MOUSE_ENTERED) ||
+             event_type == JNI_STATIC(MOUSE_EXITED)) {
+    const bool mouse_leave = (event_type == JNI_STATIC(MOUSE_EXITED));
+    CefRefPtr<InputCoalescer> coalescer = GetInputCoalescer(env, browser);
+    if (coalescer)
+      coalescer->SendMouseMoveEvent(cef_event, mouse_leave);
+    else
+      browser->GetHost()->SendMouseMoveEvent(cef_event, mouse_leave);
+  }
+}
+
+JNIEXPORT void JNICALL
+Java_org_cef_browser_CefBrowser_1N_N_1SendMouseWheelEventPrimitive(
+    JNIEnv* env,
+    jobject obj,
+    jint scroll_type,
+    jint x,
+    jint y,
+    jint modifiers,
+    jint delta,
+    jint units_to_scroll) {
+  CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  ScopedJNIClass cls(env, "java/awt/event/MouseWheelEvent");
+  if (!cls)
+    return;
+
+  JNI_STATIC_DEFINE_INT(env, cls, WHEEL_UNIT_SCROLL);
+
+  CefMouseEvent cef_event;
+  cef_event.x = x;
+  cef_event.y = y;
+  cef_event.modifiers = GetCefModifiers(env, cls, modifiers);
+
+  if (scroll_type == JNI_STATIC(WHEEL_UNIT_SCROLL)) {
+    // Use the smarter version that considers platform settings.
+    delta = units_to_scroll;
+  }
+
+  double deltaX = 0, deltaY = 0;
+  if (cef_event.modifiers & EVENTFLAG_SHIFT_DOWN)
+    deltaX = delta;
+  else
+#if defined(OS_WIN)
+    deltaY = delta * (-1);
+#else
+    deltaY = delta;
+#endif
+
+  CefRefPtr<InputCoalescer> coalescer = GetInputCoalescer(env, browser);
+  if (coalescer)
+    coalescer->SendMouseWheelEvent(cef_event, (int)deltaX, (int)deltaY);
+  else
+    browser->GetHost()->SendMouseWheelEvent(cef_event, deltaX, deltaY);
+}
+
 JNIEXPORT void JNICALL
 Java_org_cef_browser_CefBrowser_1N_N_1DragTargetDragEnter(JNIEnv* env,
                                                           jobject obj,
@@ -1141,6 +1264,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1DragTargetDragEnter(JNIEnv* env,
   cef_event.modifiers = GetCefModifiers(env, cls, jmodifiers);
 
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragTargetDragEnter(
       drag_data, cef_event, (CefBrowserHost::DragOperationsMask)allowedOps);
 }
@@ -1160,6 +1284,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1DragTargetDragOver(JNIEnv* env,
   cef_event.modifiers = GetCefModifiers(env, cls, jmodifiers);
 
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragTargetDragOver(
       cef_event, (CefBrowserHost::DragOperationsMask)allowedOps);
 }
@@ -1168,6 +1293,7 @@ JNIEXPORT void JNICALL
 Java_org_cef_browser_CefBrowser_1N_N_1DragTargetDragLeave(JNIEnv* env,
                                                           jobject obj) {
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragTargetDragLeave();
 }
 
@@ -1185,6 +1311,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1DragTargetDrop(JNIEnv* env,
   cef_event.modifiers = GetCefModifiers(env, cls, jmodifiers);
 
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragTargetDrop(cef_event);
 }
 
@@ -1196,6 +1323,7 @@ Java_org_cef_browser_CefBrowser_1N_N_1DragSourceEndedAt(JNIEnv* env,
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
   int x, y;
   GetJNIPoint(env, pos, &x, &y);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragSourceEndedAt(
       x, y, (CefBrowserHost::DragOperationsMask)operation);
 }
@@ -1204,6 +1332,7 @@ JNIEXPORT void JNICALL
 Java_org_cef_browser_CefBrowser_1N_N_1DragSourceSystemDragEnded(JNIEnv* env,
                                                                 jobject obj) {
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->DragSourceSystemDragEnded();
 }
 
@@ -1464,6 +1593,7 @@ void Java_org_cef_browser_CefBrowser_1N_N_1ImeSetComposition(
   CefRange selection_range{};
   GetJNIRange(env, jSelectionRange, selection_range);
 
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->ImeSetComposition(text, underlines, replacement_range, selection_range);
 }
 
@@ -1478,6 +1608,7 @@ void Java_org_cef_browser_CefBrowser_1N_N_1ImeCommitText(
   CefRange replacement_range;
   GetJNIRange(env, jReplacementRange, replacement_range);
 
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->ImeCommitText(text, replacement_range, jRelativePos);
 }
 
@@ -1486,12 +1617,14 @@ void Java_org_cef_browser_CefBrowser_1N_N_1ImeFinishComposingText(
     jobject obj,
     jboolean jKeepSelection) {
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->ImeFinishComposingText(jKeepSelection);
 }
 
 void Java_org_cef_browser_CefBrowser_1N_N_1ImeCancelComposing(JNIEnv* env,
                                                               jobject obj) {
   CefRefPtr<CefBrowser> browser = JNI_GET_BROWSER_OR_RETURN(env, obj);
+  FlushCoalescedInput(env, browser);
   browser->GetHost()->ImeCancelComposition();
 }
 
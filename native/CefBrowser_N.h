@@ -425,6 +425,22 @@ JNIEXPORT void JNICALL Java_org_cef_browser_CefBrowser_1N_N_1SendMouseEvent
 JNIEXPORT void JNICALL Java_org_cef_browser_CefBrowser_1N_N_1SendMouseWheelEvent
   (JNIEnv *, jobject, jobject);
 
+/*
+ * Class:     org_cef_browser_CefBrowser_N
+ * Method:    N_SendMouseEventPrimitive
+ * Signature: (IIIIII)V
+ */
+JNIEXPORT void JNICALL Java_org_cef_browser_CefBrowser_1N_N_1SendMouseEventPrimitive
+  (JNIEnv *, jobject, jint, jint, jint, jint, jint, jint);
+
+/*
+ * Class:     org_cef_browser_CefBrowser_N
+ * Method:    N_SendMouseWheelEventPrimitive
+ * Signature: (IIIIII)V
+ */
+JNIEXPORT void JNICALL Java_org_cef_browser_CefBrowser_1N_N_1SendMouseWheelEventPrimitive
+  (JNIEnv *, jobject, jint, jint, jint, jint, jint, jint);
+
 /*
  * Class:     org_cef_browser_CefBrowser_N
  * Method:    N_DragTargetDragEnter
@@ -18,6 +18,7 @@
 #include "download_handler.h"
 #include "drag_handler.h"
 #include "focus_handler.h"
+#include "input_coalescer.h"
 #include "permission_handler.h"
 #include "jsdialog_handler.h"
 #include "keyboard_handler.h"
@@ -83,8 +84,16 @@ CefRefPtr<T> ClientHandler::GetHandler(const char* class_name) {
 
   CefRefPtr<T> result = nullptr;
   ScopedJNIObjectResult jresult(env);
-  JNI_CALL_METHOD(env, handle_, methodName.c_str(), methodSig.c_str(), Object,
-                  jresult);
+  // Method name depends on the handler, so its id isn't cached.
+  ScopedJNIClass cls(env, env->GetObjectClass(handle_));
+  jmethodID methodId =
+      env->GetMethodID(cls, methodName.c_str(), methodSig.c_str());
+  if (methodId)
+    jresult = env->CallObjectMethod(handle_, methodId);
+  if (env->ExceptionOccurred()) {
+    env->ExceptionDescribe();
+    env->ExceptionClear();
+  }
   if (jresult) {
     ScopedJNIObject<T> jhandler(env, jresult.Release(),
                                 true /* should_delete */, className.c_str());
@@ -250,6 +259,11 @@ void ClientHandler::OnAfterCreated() {}
 void ClientHandler::OnBeforeClose(CefRefPtr<CefBrowser> browser) {
   REQUIRE_UI_THREAD();
 
+  CefRefPtr<CefRenderHandler> renderHandler = GetRenderHandler();
+  if (renderHandler)
+    static_cast<RenderHandler*>(renderHandler.get())->OnBeforeClose(browser);
+  InputCoalescer::Remove(browser);
+
   base::AutoLock lock_scope(message_router_lock_);
   for (auto& router : message_routers_) {
     router->OnBeforeClose(browser);
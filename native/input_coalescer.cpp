@@ -0,0 +1,170 @@
+// Copyright (c) 2024 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "input_coalescer.h"
+
+#include <atomic>
+#include <map>
+
+#include "include/base/cef_callback.h"
+#include "include/cef_task.h"
+#include "include/wrapper/cef_closure_task.h"
+
+namespace {
+
+base::Lock g_coalescers_lock;
+// Coalescers of removed browsers are kept (closed) while their browsers are
+// valid, so that late input (e.g. posted before the browser was closed)
+// doesn't create a new coalescer that is never removed.
+std::map<int, CefRefPtr<InputCoalescer>> g_coalescers;
+
+std::atomic<int64_t> g_merged_moves{0};
+std::atomic<int64_t> g_merged_wheels{0};
+std::atomic<int64_t> g_delivered{0};
+
+}  // namespace
+
+// static
+CefRefPtr<InputCoalescer> InputCoalescer::Get(CefRefPtr<CefBrowser> browser,
+                                              int latency_ms) {
+  if (latency_ms <= 0 || !browser || !browser->IsValid())
+    return nullptr;
+
+  base::AutoLock lock_scope(g_coalescers_lock);
+  CefRefPtr<InputCoalescer>& result = g_coalescers[browser->GetIdentifier()];
+  if (!result)
+    result = new InputCoalescer(browser, latency_ms);
+  else if (result->IsClosed())
+    return nullptr;
+  return result;
+}
+
+// static
+void InputCoalescer::Remove(CefRefPtr<CefBrowser> browser) {
+  base::AutoLock lock_scope(g_coalescers_lock);
+  for (auto it = g_coalescers.begin(); it != g_coalescers.end();) {
+    if (it->second->IsClosed() && !it->second->browser_->IsValid())
+      it = g_coalescers.erase(it);
+    else
+      ++it;
+  }
+
+  CefRefPtr<InputCoalescer>& coalescer =
+      g_coalescers[browser->GetIdentifier()];
+  if (!coalescer)
+    coalescer = new InputCoalescer(browser, 0);
+  coalescer->Close();
+}
+
+// static
+int64_t InputCoalescer::GetMergedMovesCount() {
+  return g_merged_moves;
+}
+
+// static
+int64_t InputCoalescer::GetMergedWheelsCount() {
+  return g_merged_wheels;
+}
+
+// static
+int64_t InputCoalescer::GetDeliveredCount() {
+  return g_delivered;
+}
+
+InputCoalescer::InputCoalescer(CefRefPtr<CefBrowser> browser, int latency_ms)
+    : browser_(browser), host_(browser->GetHost()), latency_ms_(latency_ms) {}
+
+void InputCoalescer::SendMouseMoveEvent(const CefMouseEvent& event,
+                                        bool mouse_leave) {
+  base::AutoLock lock_scope(lock_);
+  if (closed_) {
+    host_->SendMouseMoveEvent(event, mouse_leave);
+    ++g_delivered;
+    return;
+  }
+  if (pending_type_ == PENDING_MOVE &&
+      pending_event_.modifiers == event.modifiers &&
+      pending_mouse_leave_ == mouse_leave) {
+    ++g_merged_moves;
+  } else {
+    DeliverPending();
+    SchedulePending(PENDING_MOVE);
+  }
+  pending_event_ = event;
+  pending_mouse_leave_ = mouse_leave;
+}
+
+void InputCoalescer::SendMouseWheelEvent(const CefMouseEvent& event,
+                                         int delta_x,
+                                         int delta_y) {
+  base::AutoLock lock_scope(lock_);
+  if (closed_) {
+    host_->SendMouseWheelEvent(event, delta_x, delta_y);
+    ++g_delivered;
+    return;
+  }
+  if (pending_type_ == PENDING_WHEEL &&
+      pending_event_.modifiers == event.modifiers) {
+    ++g_merged_wheels;
+  } else {
+    DeliverPending();
+    SchedulePending(PENDING_WHEEL);
+    pending_delta_x_ = 0;
+    pending_delta_y_ = 0;
+  }
+  pending_event_ = event;
+  pending_delta_x_ += delta_x;
+  pending_delta_y_ += delta_y;
+}
+
+void InputCoalescer::Flush() {
+  base::AutoLock lock_scope(lock_);
+  DeliverPending();
+}
+
+void InputCoalescer::Close() {
+  base::AutoLock lock_scope(lock_);
+  DeliverPending();
+  closed_ = true;
+}
+
+bool InputCoalescer::IsClosed() {
+  base::AutoLock lock_scope(lock_);
+  return closed_;
+}
+
+void InputCoalescer::DeliverPending() {
+  // NOTE: events are delivered under the lock to keep the order of input sent
+  // from different threads (CefBrowserHost methods only post tasks).
+  if (pending_type_ == PENDING_MOVE) {
+    host_->SendMouseMoveEvent(pending_event_, pending_mouse_leave_);
+    ++g_delivered;
+  } else if (pending_type_ == PENDING_WHEEL) {
+    if (pending_delta_x_ != 0 || pending_delta_y_ != 0) {
+      host_->SendMouseWheelEvent(pending_event_, pending_delta_x_,
+                                 pending_delta_y_);
+      ++g_delivered;
+    }
+  }
+  pending_type_ = PENDING_NONE;
+  ++pending_gen_;
+}
+
+void InputCoalescer::SchedulePending(PendingType type) {
+  pending_type_ = type;
+  CefPostDelayedTask(
+      TID_UI,
+      base::BindOnce(&InputCoalescer::OnFlushTimer,
+                     CefRefPtr<InputCoalescer>(this), pending_gen_),
+      latency_ms_);
+}
+
+// static
+void InputCoalescer::OnFlushTimer(CefRefPtr<InputCoalescer> coalescer,
+                                  int64_t gen) {
+  base::AutoLock lock_scope(coalescer->lock_);
+  // Pending event could be already delivered by the direct Flush.
+  if (coalescer->pending_gen_ == gen)
+    coalescer->DeliverPending();
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2024 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef JCEF_NATIVE_INPUT_COALESCER_H_
+#define JCEF_NATIVE_INPUT_COALESCER_H_
+#pragma once
+
+#include <cstdint>
+
+#include "include/base/cef_lock.h"
+#include "include/cef_browser.h"
+
+// Merges high-rate mouse input of a browser: consecutive moves are replaced
+// by the latest one and wheel deltas are accumulated. Pending event is
+// delivered at most |latency_ms| after it was received, or immediately
+// before any non-mergeable event (so the order of input is preserved).
+// Used by both JNI (CefBrowser_N.cpp) and remote (cef_server) paths, methods
+// can be called from any thread.
+class InputCoalescer : public CefBaseRefCounted {
+ public:
+  // Returns coalescer of |browser| (created on demand) or nullptr when
+  // |latency_ms| <= 0 (coalescing is disabled) or |browser| was already
+  // removed.
+  static CefRefPtr<InputCoalescer> Get(CefRefPtr<CefBrowser> browser,
+                                       int latency_ms);
+  // Delivers pending input and closes coalescer of |browser|. Subsequent
+  // Get() calls for |browser| return nullptr. Closed coalescers are forgotten
+  // (by the next Remove call) when their browsers become invalid.
+  static void Remove(CefRefPtr<CefBrowser> browser);
+
+  void SendMouseMoveEvent(const CefMouseEvent& event, bool mouse_leave);
+  void SendMouseWheelEvent(const CefMouseEvent& event,
+                           int delta_x,
+                           int delta_y);
+
+  // Delivers pending event immediately. Must be called before sending of any
+  // other input event into the browser.
+  void Flush();
+
+  // Process-wide counters (summed over all browsers).
+  static int64_t GetMergedMovesCount();
+  static int64_t GetMergedWheelsCount();
+  static int64_t GetDeliveredCount();
+
+ private:
+  enum PendingType { PENDING_NONE, PENDING_MOVE, PENDING_WHEEL };
+
+  InputCoalescer(CefRefPtr<CefBrowser> browser, int latency_ms);
+
+  // Delivers pending event, subsequent input isn't coalesced.
+  void Close();
+  bool IsClosed();
+
+  // Must be called under |lock_|.
+  void DeliverPending();
+  void SchedulePending(PendingType type);
+  static void OnFlushTimer(CefRefPtr<InputCoalescer> coalescer, int64_t gen);
+
+  CefRefPtr<CefBrowser> browser_;
+  CefRefPtr<CefBrowserHost> host_;
+  const int latency_ms_;
+
+  base::Lock lock_;
+  bool closed_ = false;
+  PendingType pending_type_ = PENDING_NONE;
+  CefMouseEvent pending_event_;
+  bool pending_mouse_leave_ = false;
+  int pending_delta_x_ = 0;
+  int pending_delta_y_ = 0;
+  int64_t pending_gen_ = 0;
+
+  IMPLEMENT_REFCOUNTING(InputCoalescer);
+};
+
+#endif  // JCEF_NATIVE_INPUT_COALESCER_H_
@@ -3,7 +3,11 @@
 // can be found in the LICENSE file.
 
 #include <algorithm>
+#include <atomic>
+#include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <string>
 
 #include "jni_scoped_helpers.h"
 
@@ -12,12 +16,30 @@
 
 namespace {
 
+std::atomic<int64_t> attachCount_{0};
+
+// Detaches the current thread from the VM on thread exit if it was attached by
+// GetJNIEnv. Threads stay attached for their whole lifetime, because attaching
+// is expensive and callbacks often arrive on the same (pool) threads.
+struct ThreadAttachment {
+  bool attached = false;
+
+  ~ThreadAttachment() {
+    if (!attached)
+      return;
+    JavaVM* jvm = GetJVM();
+    if (jvm) {
+      jvm->DetachCurrentThread();
+    }
+  }
+};
+
+thread_local ThreadAttachment threadAttachment_;
+
 // Retrieves the JNIEnv for the current thread. Attaches the VM to the current
-// thread if necessary. Sets |mustDetach| to true if DetachJNIEnv must be
-// called.
-jint GetJNIEnv(JNIEnv** env, bool* mustDetach) {
+// thread if necessary (it's detached automatically when the thread exits).
+jint GetJNIEnv(JNIEnv** env) {
   *env = nullptr;
-  *mustDetach = false;
 
   JavaVM* jvm = GetJVM();
   if (!jvm)
@@ -27,44 +49,59 @@ jint GetJNIEnv(JNIEnv** env, bool* mustDetach) {
   if (result == JNI_EDETACHED) {
     result = jvm->AttachCurrentThreadAsDaemon((void**)env, nullptr);
     if (result == JNI_OK) {
-      *mustDetach = true;
+      threadAttachment_.attached = true;
+      attachCount_.fetch_add(1, std::memory_order_relaxed);
     }
   }
 
   return result;
 }
 
-// Detaches the current thread from the VM. Should only be called if
-// |mustDetach| was set to true by GetJNIEnv.
-void DetachJNIEnv() {
-  JavaVM* jvm = GetJVM();
-  if (jvm) {
-    jvm->DetachCurrentThread();
-  }
-}
-
 // Using a simple cache to store global refs to loaded classes, since we
 // need to load the same classes over and over, which should neither change
 // on the JVM side nor be GCed...
-std::map<std::string, jobject> classCache_;
-std::mutex classCacheMutex_;
+// Lookups take a shared lock and don't copy the name, so threads don't block
+// each other once the classes are loaded.
+std::map<std::string, jobject, std::less<>> classCache_;  // '/' as separator
+std::shared_mutex classCacheMutex_;
 // ...except if there's a change in the classloader to use by JCEF, in which
-// case the cache can be invalidated
+// case the cache is invalidated.
 jobject classCacheClassLoader_;
 
-// Returns a class with the given fully qualified |class_name| (with '/' as
-// separator).
-jclass FindClass(JNIEnv* env, const char* class_name) {
+jclass LoadClass(JNIEnv* env, jobject classLoader, const char* class_name) {
   std::string classNameSeparatedByDots(class_name);
   std::replace(classNameSeparatedByDots.begin(), classNameSeparatedByDots.end(),
                '/', '.');
+  ScopedJNIString classNameJString(env, classNameSeparatedByDots);
+  jobject result = nullptr;
+
+  JNI_CALL_METHOD(env, classLoader, "loadClass",
+                  "(Ljava/lang/String;)Ljava/lang/Class;", Object, result,
+                  classNameJString.get());
+  return static_cast<jclass>(result);
+}
 
+// Returns a class with the given fully qualified |class_name| (with '/' as
+// separator).
+jclass FindClass(JNIEnv* env, const char* class_name) {
   jobject classLoader = GetJavaClassLoader();
   ASSERT(classLoader);
 
-  // std::map is not thread-safe with regard to concurrent reading and writing
-  std::lock_guard<std::mutex> guard(classCacheMutex_);
+  {
+    std::shared_lock<std::shared_mutex> guard(classCacheMutex_);
+    if (classLoader == classCacheClassLoader_) {
+      auto it = classCache_.find(class_name);
+      if (it != classCache_.end())
+        return static_cast<jclass>(env->NewLocalRef(it->second));
+    }
+  }
+
+  // Class is loaded outside of the lock (it calls into java).
+  jclass result = LoadClass(env, classLoader, class_name);
+  if (!result)
+    return nullptr;
 
+  std::unique_lock<std::shared_mutex> guard(classCacheMutex_);
   if (classLoader != classCacheClassLoader_) {
     for (std::pair<const std::string, jobject>& entry : classCache_) {
       env->DeleteGlobalRef(entry.second);
@@ -73,29 +110,68 @@ jclass FindClass(JNIEnv* env, const char* class_name) {
     classCacheClassLoader_ = classLoader;
   }
 
-  std::map<std::string, jobject>::iterator it =
-      classCache_.find(classNameSeparatedByDots);
-  if (it != classCache_.end()) {
-    return static_cast<jclass>(env->NewLocalRef(it->second));
-  }
-
-  ScopedJNIString classNameJString(env, classNameSeparatedByDots);
-  jobject result = nullptr;
-
-  JNI_CALL_METHOD(env, classLoader, "loadClass",
-                  "(Ljava/lang/String;)Ljava/lang/Class;", Object, result,
-                  classNameJString.get());
-
   // Make a global reference out of the local reference to allow for caching.
   // This produces a non-garbage-collectable class, since this global ref is
   // never released! However, for the classes that are requested by JCEF via
   // this mechanism, that should be acceptable, because they aren't candidates
   // to be GCed anyway.
-  classCache_[classNameSeparatedByDots] = env->NewGlobalRef(result);
+  jobject& cached = classCache_[class_name];
+  if (!cached)
+    cached = env->NewGlobalRef(result);
 
-  return static_cast<jclass>(result);
+  return result;
 }
 
+// org.cef.callback.CefNativeAdapter and its N_CefHandle field, resolved once.
+struct NativeAdapterInfo {
+  jclass cls;  // global ref
+  jfieldID handle;
+};
+
+const NativeAdapterInfo& GetNativeAdapterInfo(JNIEnv* env) {
+  static const NativeAdapterInfo info = [env]() {
+    NativeAdapterInfo result{nullptr, nullptr};
+    jclass cls = FindClass(env, "org/cef/callback/CefNativeAdapter");
+    if (!cls)
+      return result;
+    result.handle = env->GetFieldID(cls, "N_CefHandle", "J");
+    if (result.handle)
+      result.cls = static_cast<jclass>(env->NewGlobalRef(cls));
+    env->DeleteLocalRef(cls);
+    return result;
+  }();
+  return info;
+}
+
+const size_t kNativeRefLocksCount = 64;
+std::mutex nativeRefLocks_[kNativeRefLocksCount];
+
+}  // namespace
+
+bool GetNativeAdapterHandle(JNIEnv* env, jobject obj, jlong* value) {
+  const NativeAdapterInfo& info = GetNativeAdapterInfo(env);
+  if (!info.cls || !env->IsInstanceOf(obj, info.cls))
+    return false;
+  *value = env->GetLongField(obj, info.handle);
+  return true;
+}
+
+bool SetNativeAdapterHandle(JNIEnv* env, jobject obj, jlong value) {
+  const NativeAdapterInfo& info = GetNativeAdapterInfo(env);
+  if (!info.cls || !env->IsInstanceOf(obj, info.cls))
+    return false;
+  env->SetLongField(obj, info.handle, value);
+  return true;
+}
+
+std::mutex& GetNativeRefLock(jlong value) {
+  // Objects are at least 16-byte aligned, so skip the low bits.
+  const uint64_t hash = (static_cast<uint64_t>(value) >> 4) * 0x9E3779B97F4A7C15ull;
+  return nativeRefLocks_[(hash >> 32) % kNativeRefLocksCount];
+}
+
+namespace {
+
 jobject NewJNIBoolRef(JNIEnv* env, bool initValue) {
   ScopedJNIObjectLocal jboolRef(env, "org/cef/misc/BoolRef");
   if (!jboolRef)
@@ -217,7 +293,7 @@ ScopedJNIEnv::ScopedJNIEnv(jint local_capacity)
 ScopedJNIEnv::ScopedJNIEnv(JNIEnv* env, jint local_capacity)
     : jenv_(env), local_capacity_(local_capacity) {
   if (!jenv_) {
-    if (GetJNIEnv(&jenv_, &should_detach_) != JNI_OK || !jenv_) {
+    if (GetJNIEnv(&jenv_) != JNI_OK || !jenv_) {
       NOTREACHED() << "Failed to retrieve JNIEnv";
       return;
     }
@@ -242,9 +318,11 @@ ScopedJNIEnv::~ScopedJNIEnv() {
       jenv_->PopLocalFrame(nullptr);
     }
   }
-  if (should_detach_) {
-    DetachJNIEnv();
-  }
+}
+
+// static
+int64_t ScopedJNIEnv::GetAttachCount() {
+  return attachCount_.load(std::memory_order_relaxed);
 }
 
 ScopedJNIObjectGlobal::ScopedJNIObjectGlobal(JNIEnv* env, jobject handle)
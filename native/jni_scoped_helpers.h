@@ -7,6 +7,7 @@
 
 #include <jni.h>
 
+#include <mutex>
 #include <string>
 
 #include "include/cef_auth_callback.h"
@@ -19,6 +20,7 @@
 #include "include/cef_resource_request_handler.h"
 #include "include/cef_response.h"
 #include "include/wrapper/cef_message_router.h"
+#include "jni_util.h"
 
 //
 // --------
@@ -457,7 +459,7 @@ class ScopedJNIEnv {
   static const int kDefaultLocalCapacity;
 
   // Retrieve the JNIEnv for the current thread or attach the VM to the current
-  // thread if necessary.
+  // thread if necessary. Attached threads stay attached until they exit.
   // If |local_capacity| > 0 a local frame will be created with the specified
   // maximum number of local references. Otherwise, no local frame will be
   // created.
@@ -468,6 +470,9 @@ class ScopedJNIEnv {
 
   ~ScopedJNIEnv();
 
+  // Number of times native threads were attached to the VM.
+  static int64_t GetAttachCount();
+
   // If a local frame was created, export |result| to the previous local
   // reference frame on destruction.
   void set_export_result(jobject* result) { export_result_ = result; }
@@ -487,7 +492,6 @@ class ScopedJNIEnv {
  private:
   JNIEnv* jenv_;
   jint local_capacity_;
-  bool should_detach_ = false;
   jobject* export_result_ = nullptr;
 };
 
@@ -853,12 +857,14 @@ class ScopedJNIStringRef : public ScopedJNIBase<jobject> {
   operator CefString() const;
 };
 
-// Helper macros to call a method on the java side.
+// Helper macros to call a method on the java side. |method| and |sig| must be
+// string literals: method id is cached per call site (see JNIMethodIdCache).
 #define JNI_CALL_METHOD(env, obj, method, sig, type, storeIn, ...)        \
   {                                                                       \
     if (env && obj) {                                                     \
       ScopedJNIClass _cls(env, env->GetObjectClass(obj));                 \
-      jmethodID _methodId = env->GetMethodID(_cls, method, sig);          \
+      static JNIMethodIdCache _idCache;                                   \
+      jmethodID _methodId = _idCache.Get(env, _cls, "" method, "" sig);   \
       if (_methodId != nullptr) {                                         \
         storeIn = env->Call##type##Method(obj, _methodId, ##__VA_ARGS__); \
       }                                                                   \
@@ -869,47 +875,64 @@ class ScopedJNIStringRef : public ScopedJNIBase<jobject> {
     }                                                                     \
   }
 
-#define JNI_CALL_VOID_METHOD_EX(env, obj, method, sig, ...)      \
-  {                                                              \
-    if (env && obj) {                                            \
-      ScopedJNIClass _cls(env, env->GetObjectClass(obj));        \
-      jmethodID _methodId = env->GetMethodID(_cls, method, sig); \
-      if (_methodId != nullptr) {                                \
-        env->CallVoidMethod(obj, _methodId, ##__VA_ARGS__);      \
-      }                                                          \
-    }                                                            \
+#define JNI_CALL_VOID_METHOD_EX(env, obj, method, sig, ...)             \
+  {                                                                     \
+    if (env && obj) {                                                   \
+      ScopedJNIClass _cls(env, env->GetObjectClass(obj));               \
+      static JNIMethodIdCache _idCache;                                 \
+      jmethodID _methodId = _idCache.Get(env, _cls, "" method, "" sig); \
+      if (_methodId != nullptr) {                                       \
+        env->CallVoidMethod(obj, _methodId, ##__VA_ARGS__);             \
+      }                                                                 \
+    }                                                                   \
   }
 
-#define JNI_CALL_VOID_METHOD(env, obj, method, sig, ...)         \
-  {                                                              \
-    if (env && obj) {                                            \
-      ScopedJNIClass _cls(env, env->GetObjectClass(obj));        \
-      jmethodID _methodId = env->GetMethodID(_cls, method, sig); \
-      if (_methodId != nullptr) {                                \
-        env->CallVoidMethod(obj, _methodId, ##__VA_ARGS__);      \
-      }                                                          \
-      if (env->ExceptionOccurred()) {                            \
-        env->ExceptionDescribe();                                \
-        env->ExceptionClear();                                   \
-      }                                                          \
-    }                                                            \
+#define JNI_CALL_VOID_METHOD(env, obj, method, sig, ...)                \
+  {                                                                     \
+    if (env && obj) {                                                   \
+      ScopedJNIClass _cls(env, env->GetObjectClass(obj));               \
+      static JNIMethodIdCache _idCache;                                 \
+      jmethodID _methodId = _idCache.Get(env, _cls, "" method, "" sig); \
+      if (_methodId != nullptr) {                                       \
+        env->CallVoidMethod(obj, _methodId, ##__VA_ARGS__);             \
+      }                                                                 \
+      if (env->ExceptionOccurred()) {                                   \
+        env->ExceptionDescribe();                                       \
+        env->ExceptionClear();                                          \
+      }                                                                 \
+    }                                                                   \
   }
 
-#define JNI_CALL_BOOLEAN_METHOD(out, env, obj, method, sig, ...)     \
-  {                                                                  \
-    if (env && obj) {                                                \
-      ScopedJNIClass _cls(env, env->GetObjectClass(obj));            \
-      jmethodID _methodId = env->GetMethodID(_cls, method, sig);     \
-      if (_methodId != nullptr) {                                    \
-        out = env->CallBooleanMethod(obj, _methodId, ##__VA_ARGS__); \
-      }                                                              \
-      if (env->ExceptionOccurred()) {                                \
-        env->ExceptionDescribe();                                    \
-        env->ExceptionClear();                                       \
-      }                                                              \
-    }                                                                \
+#define JNI_CALL_BOOLEAN_METHOD(out, env, obj, method, sig, ...)        \
+  {                                                                     \
+    if (env && obj) {                                                   \
+      ScopedJNIClass _cls(env, env->GetObjectClass(obj));               \
+      static JNIMethodIdCache _idCache;                                 \
+      jmethodID _methodId = _idCache.Get(env, _cls, "" method, "" sig); \
+      if (_methodId != nullptr) {                                       \
+        out = env->CallBooleanMethod(obj, _methodId, ##__VA_ARGS__);    \
+      }                                                                 \
+      if (env->ExceptionOccurred()) {                                   \
+        env->ExceptionDescribe();                                       \
+        env->ExceptionClear();                                          \
+      }                                                                 \
+    }                                                                   \
   }
 
+// Fast access to the native pointer of objects derived from
+// org.cef.callback.CefNativeAdapter: the N_CefHandle field is read/written
+// directly via cached field id instead of calling getNativeRef/setNativeRef.
+// Return false (and leave |value| untouched) for other objects (e.g.
+// CefNativeAdapterMulti), which must use the Java methods.
+bool GetNativeAdapterHandle(JNIEnv* env, jobject obj, jlong* value);
+bool SetNativeAdapterHandle(JNIEnv* env, jobject obj, jlong value);
+
+// Striped native lock associated with the native pointer |value|. Readers of
+// N_CefHandle hold it while adding a reference, writers hold the lock of the
+// previous pointer while replacing it, so the pointer can't be released
+// between reading and AddRef.
+std::mutex& GetNativeRefLock(jlong value);
+
 // Set the CEF base object for an existing JNI object. A reference will be
 // added to the base object. If a previous base object existed a reference
 // will be removed from that object.
@@ -925,8 +948,13 @@ bool SetCefForJNIObject_sync(JNIEnv* env,
   jlong previousValue = 0;
   JNI_CALL_METHOD(env, obj, "lockAndGetNativeRef", "(Ljava/lang/String;)J", Long,
                  previousValue, identifer.get());
-  JNI_CALL_VOID_METHOD(env, obj, "setNativeRef", "(Ljava/lang/String;J)V",
-                      identifer.get(), (jlong)base);
+  {
+    std::lock_guard<std::mutex> guard(GetNativeRefLock(previousValue));
+    if (!SetNativeAdapterHandle(env, obj, (jlong)base)) {
+      JNI_CALL_VOID_METHOD(env, obj, "setNativeRef", "(Ljava/lang/String;J)V",
+                           identifer.get(), (jlong)base);
+    }
+  }
 
   if (base) {
     // Add a reference to the new base object.
@@ -954,12 +982,16 @@ bool SetCefForJNIObject(JNIEnv* env,
   if (!obj)
     return false;
 
-  ScopedJNIString identifer(env, varName);
   jlong previousValue = 0;
-  JNI_CALL_METHOD(env, obj, "getNativeRef", "(Ljava/lang/String;)J", Long,
-                  previousValue, identifer.get());
-  JNI_CALL_VOID_METHOD(env, obj, "setNativeRef", "(Ljava/lang/String;J)V",
-                       identifer.get(), (jlong)base);
+  if (GetNativeAdapterHandle(env, obj, &previousValue)) {
+    SetNativeAdapterHandle(env, obj, (jlong)base);
+  } else {
+    ScopedJNIString identifer(env, varName);
+    JNI_CALL_METHOD(env, obj, "getNativeRef", "(Ljava/lang/String;)J", Long,
+                    previousValue, identifer.get());
+    JNI_CALL_VOID_METHOD(env, obj, "setNativeRef", "(Ljava/lang/String;J)V",
+                         identifer.get(), (jlong)base);
+  }
 
   if (base) {
     // Add a reference to the new base object.
@@ -980,10 +1012,12 @@ T* GetCefFromJNIObject(JNIEnv* env, jobject obj, const char* varName) {
   if (!obj)
     return nullptr;
 
-  ScopedJNIString identifer(env, varName);
   jlong previousValue = 0;
-  JNI_CALL_METHOD(env, obj, "getNativeRef", "(Ljava/lang/String;)J", Long,
-                  previousValue, identifer.get());
+  if (!GetNativeAdapterHandle(env, obj, &previousValue)) {
+    ScopedJNIString identifer(env, varName);
+    JNI_CALL_METHOD(env, obj, "getNativeRef", "(Ljava/lang/String;)J", Long,
+                    previousValue, identifer.get());
+  }
   if (previousValue != 0)
     return reinterpret_cast<T*>(previousValue);
   return nullptr;
@@ -994,8 +1028,21 @@ CefRefPtr<T> GetCefFromJNIObject_sync(JNIEnv* env, jobject obj, const char* varN
   if (!obj)
     return CefRefPtr<T>();
 
-  ScopedJNIString identifer(env, varName);
   jlong value = 0;
+  if (GetNativeAdapterHandle(env, obj, &value)) {
+    if (value == 0)
+      return CefRefPtr<T>();
+    std::lock_guard<std::mutex> guard(GetNativeRefLock(value));
+    // The field is re-read under the lock: while it still holds |value| the
+    // writer can't release the object (see SetCefForJNIObject_sync).
+    jlong actual = 0;
+    GetNativeAdapterHandle(env, obj, &actual);
+    if (actual == value)
+      return CefRefPtr<T>(reinterpret_cast<T*>(value));
+    // Concurrently replaced, fall back to the Java lock.
+  }
+
+  ScopedJNIString identifer(env, varName);
   JNI_CALL_METHOD(env, obj, "lockAndGetNativeRef", "(Ljava/lang/String;)J", Long,
                   value, identifer.get());
 
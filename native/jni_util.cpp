@@ -19,6 +19,36 @@ jobject g_javaClassLoader = nullptr;
 
 }  // namespace
 
+jmethodID JNIMethodIdCache::Get(JNIEnv* env,
+                                jclass cls,
+                                const char* name,
+                                const char* sig) {
+  for (Entry& entry : entries_) {
+    const int state = entry.state.load(std::memory_order_acquire);
+    if (state == kReady) {
+      if (env->IsSameObject(cls, entry.cls))
+        return entry.id;
+      continue;
+    }
+    if (state == kWriting)
+      continue;
+
+    jmethodID id = env->GetMethodID(cls, name, sig);
+    if (!id)
+      return id;
+    int expected = kEmpty;
+    if (entry.state.compare_exchange_strong(expected, kWriting,
+                                            std::memory_order_acquire)) {
+      entry.cls = env->NewWeakGlobalRef(cls);
+      entry.id = id;
+      entry.state.store(kReady, std::memory_order_release);
+    }
+    return id;
+  }
+  // Call site is megamorphic, resolve without caching.
+  return env->GetMethodID(cls, name, sig);
+}
+
 void SetJVM(JavaVM* jvm) {
   ASSERT(!g_jvm);
   g_jvm = jvm;
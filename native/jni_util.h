@@ -6,6 +6,7 @@
 #define JCEF_NATIVE_JNI_UTIL_H_
 
 #include <jni.h>
+#include <atomic>
 #include <vector>
 #include "include/cef_base.h"
 #include "include/cef_browser.h"
@@ -33,6 +34,25 @@ HWND GetHwndOfCanvas(jobject canvas, JNIEnv* env);
 unsigned long GetDrawableOfCanvas(jobject canvas, JNIEnv* env);
 #endif
 
+// Method id resolved at a single call site (see JNI_CALL_METHOD): ids of the
+// first classes seen at the site are kept. Entries are written once and never
+// replaced or freed (classes are held via weak global refs), so lookup is an
+// IsSameObject per cached class. Ids of other classes are resolved each call.
+class JNIMethodIdCache {
+ public:
+  // |name| and |sig| must be the same for all calls.
+  jmethodID Get(JNIEnv* env, jclass cls, const char* name, const char* sig);
+
+ private:
+  enum State { kEmpty, kWriting, kReady };
+  struct Entry {
+    std::atomic<int> state{kEmpty};
+    jweak cls = nullptr;
+    jmethodID id = nullptr;
+  };
+  Entry entries_[4];
+};
+
 // Create a new JNI object and call the default constructor.
 jobject NewJNIObject(JNIEnv* env, jclass cls);
 jobject NewJNIObject(JNIEnv* env, const char* class_name);
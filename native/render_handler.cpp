@@ -4,6 +4,8 @@
 
 #include "render_handler.h"
 
+#include <algorithm>
+
 #include "client_handler.h"
 #include "jni_util.h"
 
@@ -267,17 +269,66 @@ void RenderHandler::OnPaint(CefRefPtr<CefBrowser> browser,
   if (!env)
     return;
 
+  REQUIRE_UI_THREAD();
+
+  PaintBuffers& cache = paint_buffers_[browser->GetIdentifier()];
+
+  // Dirty rects are passed as primitive array that is reused between frames.
+  const int rectsCount = static_cast<int>(dirtyRects.size());
+  if (!cache.rects || cache.rectsCapacity < rectsCount * 4) {
+    const int capacity = std::max(rectsCount * 4, 64);
+    ScopedJNIObjectLocal jrects(env, env->NewIntArray(capacity));
+    if (!jrects)
+      return;
+    cache.rects.reset(new ScopedJNIObjectGlobal(env, jrects));
+    cache.rectsCapacity = capacity;
+  }
+  if (rectsCount > 0) {
+    jint* packed = static_cast<jint*>(
+        env->GetPrimitiveArrayCritical((jintArray)cache.rects->get(), nullptr));
+    if (packed == nullptr)
+      return;
+    for (int i = 0; i < rectsCount; ++i) {
+      packed[i * 4] = dirtyRects[i].x;
+      packed[i * 4 + 1] = dirtyRects[i].y;
+      packed[i * 4 + 2] = dirtyRects[i].width;
+      packed[i * 4 + 3] = dirtyRects[i].height;
+    }
+    env->ReleasePrimitiveArrayCritical((jintArray)cache.rects->get(), packed, 0);
+  }
+
+  // ByteBuffer wrapper is recreated only when the pixel buffer changes.
+  const int index = type == PET_VIEW ? 0 : 1;
+  const jlong size = (jlong)width * height * 4;
+  if (!cache.pixels[index] || cache.pixelsPtr[index] != buffer ||
+      cache.pixelsSize[index] != size) {
+    ScopedJNIObjectLocal jdirectBuffer(
+        env, env->NewDirectByteBuffer(const_cast<void*>(buffer), size));
+    if (!jdirectBuffer)
+      return;
+    cache.pixels[index].reset(new ScopedJNIObjectGlobal(env, jdirectBuffer));
+    cache.pixelsPtr[index] = buffer;
+    cache.pixelsSize[index] = size;
+  } else {
+    // Reset position and limit that could be changed by the previous frame.
+    ScopedJNIObjectResult jresult(env);
+    JNI_CALL_METHOD(env, cache.pixels[index]->get(), "clear",
+                    "()Ljava/nio/Buffer;", Object, jresult);
+  }
+
   ScopedJNIBrowser jbrowser(env, browser);
   jboolean jtype = type == PET_VIEW ? JNI_FALSE : JNI_TRUE;
-  ScopedJNIObjectLocal jrectArray(env, NewJNIRectArray(env, dirtyRects));
-  ScopedJNIObjectLocal jdirectBuffer(
-      env,
-      env->NewDirectByteBuffer(const_cast<void*>(buffer), width * height * 4));
   JNI_CALL_VOID_METHOD(env, handle_, "onPaint",
-                       "(Lorg/cef/browser/CefBrowser;Z[Ljava/awt/"
-                       "Rectangle;Ljava/nio/ByteBuffer;II)V",
-                       jbrowser.get(), jtype, jrectArray.get(),
-                       jdirectBuffer.get(), width, height);
+                       "(Lorg/cef/browser/CefBrowser;Z[IILjava/nio/"
+                       "ByteBuffer;II)V",
+                       jbrowser.get(), jtype, cache.rects->get(),
+                       (jint)rectsCount, cache.pixels[index]->get(), width,
+                       height);
+}
+
+void RenderHandler::OnBeforeClose(CefRefPtr<CefBrowser> browser) {
+  REQUIRE_UI_THREAD();
+  paint_buffers_.erase(browser->GetIdentifier());
 }
 
 bool RenderHandler::StartDragging(CefRefPtr<CefBrowser> browser,
@@ -372,10 +423,11 @@ void RenderHandler::OnImeCompositionRangeChanged(
 
   if (env && handle_) {
     ScopedJNIClass _cls(env, env->GetObjectClass(handle_));
+    static JNIMethodIdCache _idCache;
     jmethodID _methodId =
-        env->GetMethodID(_cls, "OnImeCompositionRangeChanged",
-                         "(Lorg/cef/browser/CefBrowser;Lorg/cef/misc/"
-                         "CefRange;[Ljava/awt/Rectangle;)V");
+        _idCache.Get(env, _cls, "OnImeCompositionRangeChanged",
+                     "(Lorg/cef/browser/CefBrowser;Lorg/cef/misc/"
+                     "CefRange;[Ljava/awt/Rectangle;)V");
     if (_methodId != nullptr) {
       env->CallVoidMethod(handle_, _methodId, jBrowser.get(),
                           jSelectionRange.get(), jCharBounds.get());
@@ -402,10 +454,11 @@ void RenderHandler::OnTextSelectionChanged(CefRefPtr<CefBrowser> browser,
 
   if (env && handle_) {
     ScopedJNIClass _cls(env, env->GetObjectClass(handle_));
+    static JNIMethodIdCache _idCache;
     jmethodID _methodId =
-        env->GetMethodID(_cls, "OnTextSelectionChanged",
-                         "(Lorg/cef/browser/CefBrowser;Ljava/lang/String;Lorg/"
-                         "cef/misc/CefRange;)V");
+        _idCache.Get(env, _cls, "OnTextSelectionChanged",
+                     "(Lorg/cef/browser/CefBrowser;Ljava/lang/String;Lorg/"
+                     "cef/misc/CefRange;)V");
     if (_methodId != nullptr) {
       env->CallVoidMethod(handle_, _methodId, jBrowser.get(),
                           jSelectedText.get(), jSelectionRange.get());
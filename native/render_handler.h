@@ -8,6 +8,9 @@
 
 #include <jni.h>
 
+#include <map>
+#include <memory>
+
 #include "include/cef_render_handler.h"
 #include "include/cef_display_handler.h"
 
@@ -63,9 +66,24 @@ class RenderHandler : public CefRenderHandler {
                               const CefString& selected_text,
                               const CefRange& selected_range) override;
 
+  // Releases java objects cached for |browser|.
+  void OnBeforeClose(CefRefPtr<CefBrowser> browser);
+
  protected:
   ScopedJNIObjectGlobal handle_;
 
+  // Java objects reused by OnPaint (accessed on the UI thread only).
+  struct PaintBuffers {
+    // int[] with dirty rects packed as (x, y, width, height) quads.
+    std::unique_ptr<ScopedJNIObjectGlobal> rects;
+    int rectsCapacity = 0;
+    // Direct ByteBuffer for every PaintElementType (view and popup).
+    std::unique_ptr<ScopedJNIObjectGlobal> pixels[2];
+    const void* pixelsPtr[2] = {nullptr, nullptr};
+    jlong pixelsSize[2] = {0, 0};
+  };
+  std::map<int, PaintBuffers> paint_buffers_;
+
   // Include the default reference counting implementation.
   IMPLEMENT_REFCOUNTING(RenderHandler);
 };
@@ -8,7 +8,11 @@
 #include "util.h"
 
 ResourceHandler::ResourceHandler(JNIEnv* env, jobject handler)
-    : handle_(env, handler) {}
+    : handle_(env, handler) {
+  ScopedJNIClass cls(env, "org/cef/handler/CefDirectResourceHandler");
+  if (cls && env->IsInstanceOf(handler, cls))
+    direct_ = true;
+}
 
 bool ResourceHandler::ProcessRequest(CefRefPtr<CefRequest> request,
                                      CefRefPtr<CefCallback> callback) {
@@ -65,6 +69,10 @@ bool ResourceHandler::ReadResponse(void* data_out,
   if (!env)
     return false;
 
+  if (direct_)
+    return ReadResponseDirect(env, data_out, bytes_to_read, bytes_read,
+                              callback);
+
   ScopedJNIIntRef jbytesRead(env, bytes_read);
   jbyteArray jbytes = env->NewByteArray(bytes_to_read);
   ScopedJNICallback jcallback(env, callback);
@@ -94,6 +102,39 @@ bool ResourceHandler::ReadResponse(void* data_out,
   return result;
 }
 
+bool ResourceHandler::ReadResponseDirect(JNIEnv* env,
+                                         void* data_out,
+                                         int bytes_to_read,
+                                         int& bytes_read,
+                                         CefRefPtr<CefCallback> callback) {
+  // The Java handler writes straight into |data_out|, the buffer is valid
+  // only within the scope of the call.
+  ScopedJNIObjectLocal jbuffer(
+      env, env->NewDirectByteBuffer(data_out, bytes_to_read));
+  if (!jbuffer)
+    return false;
+  ScopedJNIIntRef jbytesRead(env, bytes_read);
+  ScopedJNICallback jcallback(env, callback);
+  jboolean jresult = JNI_FALSE;
+
+  JNI_CALL_METHOD(env, handle_, "readResponse",
+                  "(Ljava/nio/ByteBuffer;ILorg/cef/misc/IntRef;"
+                  "Lorg/cef/callback/CefCallback;)Z",
+                  Boolean, jresult, jbuffer.get(), bytes_to_read,
+                  jbytesRead.get(), jcallback.get());
+
+  bytes_read = jbytesRead;
+  if (bytes_read > bytes_to_read)
+    bytes_read = bytes_to_read;
+
+  bool result = (jresult != JNI_FALSE);
+  if (!result || bytes_read > 0) {
+    // The callback won't be used and the reference can therefore be removed.
+    jcallback.SetTemporary();
+  }
+  return result;
+}
+
 void ResourceHandler::Cancel() {
   ScopedJNIEnv env;
   if (!env)
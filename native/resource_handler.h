@@ -30,7 +30,16 @@ class ResourceHandler : public CefResourceHandler {
   void Cancel() override;
 
  protected:
+  // Passes |data_out| to CefDirectResourceHandler as a direct ByteBuffer.
+  bool ReadResponseDirect(JNIEnv* env,
+                          void* data_out,
+                          int bytes_to_read,
+                          int& bytes_read,
+                          CefRefPtr<CefCallback> callback);
+
   ScopedJNIObjectGlobal handle_;
+  // True if the handler implements CefDirectResourceHandler.
+  bool direct_ = false;
 
   // Include the default reference counting implementation.
   IMPLEMENT_REFCOUNTING(ResourceHandler);
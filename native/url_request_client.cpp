@@ -4,6 +4,10 @@
 
 #include "url_request_client.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
 #include "jni_util.h"
 #include "util.h"
 
@@ -11,13 +15,57 @@ namespace {
 
 const char kCefClassName[] = "CefURLRequestClient";
 
+bool IsStreamingClient(JNIEnv* env, jobject jURLRequestClient) {
+  ScopedJNIClass cls(env, "org/cef/callback/CefStreamingURLRequestClient");
+  return cls && env->IsInstanceOf(jURLRequestClient, cls);
+}
+
+jobject GetDownloadBuffer(JNIEnv* env, jobject jURLRequestClient) {
+  jobject jbuffer = nullptr;
+  JNI_CALL_METHOD(env, jURLRequestClient, "getDownloadBuffer",
+                  "()Ljava/nio/ByteBuffer;", Object, jbuffer);
+  return jbuffer;
+}
+
+// Progress of the non-streaming clients is reported as int.
+jint ClampToInt(int64_t value) {
+  return (jint)std::min<int64_t>(std::max<int64_t>(value, INT32_MIN),
+                                 INT32_MAX);
+}
+
 }  // namespace
 
 URLRequestClient::URLRequestClient(JNIEnv* env,
                                    jobject jURLRequestClient,
                                    jobject jURLRequest)
     : client_handle_(env, jURLRequestClient),
-      request_handle_(env, jURLRequest) {}
+      request_handle_(env, jURLRequest),
+      streaming_(IsStreamingClient(env, jURLRequestClient)),
+      download_buffer_(
+          env,
+          ScopedJNIObjectLocal(env,
+                               streaming_
+                                   ? GetDownloadBuffer(env, jURLRequestClient)
+                                   : nullptr)
+              .get()) {
+  if (!streaming_)
+    return;
+
+  if (download_buffer_) {
+    download_data_ =
+        static_cast<char*>(env->GetDirectBufferAddress(download_buffer_));
+    const jlong capacity = env->GetDirectBufferCapacity(download_buffer_);
+    download_capacity_ = download_data_ && capacity > 0 ? (size_t)capacity : 0;
+  }
+  if (download_capacity_ == 0)
+    LOG(WARNING) << "CefStreamingURLRequestClient without direct download "
+                    "buffer, download data will be skipped";
+
+  jlong interval = 0;
+  JNI_CALL_METHOD(env, jURLRequestClient, "getProgressIntervalMs", "()J", Long,
+                  interval);
+  progress_interval_ms_ = interval;
+}
 
 CefRefPtr<URLRequestClient> URLRequestClient::Create(JNIEnv* env,
                                                      jobject jURLRequestClient,
@@ -42,6 +90,17 @@ URLRequestClient::~URLRequestClient() {
 
 // TODO(jcef): Solve jurlReques instead of using nullptr
 void URLRequestClient::OnRequestComplete(CefRefPtr<CefURLRequest> request) {
+  if (upload_progress_.pending) {
+    upload_progress_.pending = false;
+    NotifyProgress(true, upload_progress_.current,
+                   upload_progress_.total);
+  }
+  if (download_progress_.pending) {
+    download_progress_.pending = false;
+    NotifyProgress(false, download_progress_.current,
+                   download_progress_.total);
+  }
+
   ScopedJNIEnv env;
   if (!env)
     return;
@@ -51,37 +110,96 @@ void URLRequestClient::OnRequestComplete(CefRefPtr<CefURLRequest> request) {
                        request_handle_.get());
 }
 
-void URLRequestClient::OnUploadProgress(CefRefPtr<CefURLRequest> request,
-                                        int64_t current,
-                                        int64_t total) {
+bool URLRequestClient::ShouldNotifyProgress(ProgressState& state,
+                                            int64_t current,
+                                            int64_t total) {
+  state.pending = false;
+  if (!streaming_ || progress_interval_ms_ <= 0 || current == total)
+    return true;
+  const auto now = std::chrono::steady_clock::now();
+  if (now - state.last < std::chrono::milliseconds(progress_interval_ms_)) {
+    state.pending = true;
+    state.current = current;
+    state.total = total;
+    return false;
+  }
+  state.last = now;
+  return true;
+}
+
+void URLRequestClient::NotifyProgress(bool upload,
+                                      int64_t current,
+                                      int64_t total) {
   ScopedJNIEnv env;
   if (!env)
     return;
 
-  JNI_CALL_VOID_METHOD(env, client_handle_, "onUploadProgress",
-                       "(Lorg/cef/network/CefURLRequest;II)V",
-                       request_handle_.get(), (jint)current, (jint)total);
+  if (streaming_) {
+    if (upload) {
+      JNI_CALL_VOID_METHOD(env, client_handle_, "onUploadProgress",
+                           "(Lorg/cef/network/CefURLRequest;JJ)V",
+                           request_handle_.get(), (jlong)current,
+                           (jlong)total);
+    } else {
+      JNI_CALL_VOID_METHOD(env, client_handle_, "onDownloadProgress",
+                           "(Lorg/cef/network/CefURLRequest;JJ)V",
+                           request_handle_.get(), (jlong)current,
+                           (jlong)total);
+    }
+  } else {
+    if (upload) {
+      JNI_CALL_VOID_METHOD(env, client_handle_, "onUploadProgress",
+                           "(Lorg/cef/network/CefURLRequest;II)V",
+                           request_handle_.get(), ClampToInt(current),
+                           ClampToInt(total));
+    } else {
+      JNI_CALL_VOID_METHOD(env, client_handle_, "onDownloadProgress",
+                           "(Lorg/cef/network/CefURLRequest;II)V",
+                           request_handle_.get(), ClampToInt(current),
+                           ClampToInt(total));
+    }
+  }
+}
+
+void URLRequestClient::OnUploadProgress(CefRefPtr<CefURLRequest> request,
+                                        int64_t current,
+                                        int64_t total) {
+  if (ShouldNotifyProgress(upload_progress_, current, total))
+    NotifyProgress(true, current, total);
 }
 
 void URLRequestClient::OnDownloadProgress(CefRefPtr<CefURLRequest> request,
                                           int64_t current,
                                           int64_t total) {
-  ScopedJNIEnv env;
-  if (!env)
-    return;
-
-  JNI_CALL_VOID_METHOD(env, client_handle_, "onDownloadProgress",
-                       "(Lorg/cef/network/CefURLRequest;II)V",
-                       request_handle_.get(), (jint)current, (jint)total);
+  if (ShouldNotifyProgress(download_progress_, current, total))
+    NotifyProgress(false, current, total);
 }
 
 void URLRequestClient::OnDownloadData(CefRefPtr<CefURLRequest> request,
                                       const void* data,
                                       size_t data_length) {
+  if (streaming_ && download_capacity_ == 0)
+    return;
+
   ScopedJNIEnv env;
   if (!env)
     return;
 
+  if (streaming_) {
+    // Copy into the client's buffer, in several parts if the chunk is larger.
+    const char* src = static_cast<const char*>(data);
+    while (data_length > 0) {
+      const size_t length = std::min(data_length, download_capacity_);
+      memcpy(download_data_, src, length);
+      JNI_CALL_VOID_METHOD(env, client_handle_, "onDownloadData",
+                           "(Lorg/cef/network/CefURLRequest;I)V",
+                           request_handle_.get(), (jint)length);
+      src += length;
+      data_length -= length;
+    }
+    return;
+  }
+
   jbyteArray jbyteArray = env->NewByteArray((jsize)data_length);
   env->SetByteArrayRegion(jbyteArray, 0, (jsize)data_length,
                           (const jbyte*)data);
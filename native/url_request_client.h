@@ -7,6 +7,7 @@
 #pragma once
 
 #include <jni.h>
+#include <chrono>
 #include <deque>
 #include <set>
 
@@ -48,9 +49,34 @@ class URLRequestClient : public CefURLRequestClient {
                                   CefRefPtr<CefAuthCallback> callback) override;
 
  protected:
+  struct ProgressState {
+    std::chrono::steady_clock::time_point last;
+    // Last throttled notification, delivered from OnRequestComplete when no
+    // newer one was passed to the client (e.g. when |total| is unknown).
+    bool pending = false;
+    int64_t current = 0;
+    int64_t total = 0;
+  };
+
+  // Returns true if the progress notification should be passed to the
+  // client (CefStreamingURLRequestClient gets them at most once per interval).
+  bool ShouldNotifyProgress(ProgressState& state,
+                            int64_t current,
+                            int64_t total);
+  void NotifyProgress(bool upload, int64_t current, int64_t total);
+
   ScopedJNIObjectGlobal client_handle_;
   ScopedJNIObjectGlobal request_handle_;
 
+  // Members used when the client implements CefStreamingURLRequestClient.
+  const bool streaming_;
+  ScopedJNIObjectGlobal download_buffer_;  // direct ByteBuffer
+  char* download_data_ = nullptr;
+  size_t download_capacity_ = 0;
+  int64_t progress_interval_ms_ = 0;
+  ProgressState upload_progress_;
+  ProgressState download_progress_;
+
   // Include the default reference counting implementation.
   IMPLEMENT_REFCOUNTING(URLRequestClient);
 };
@@ -4,42 +4,108 @@
 
 #include "write_handler.h"
 
+#include <algorithm>
+
 #include "jni_util.h"
 #include "util.h"
 
+namespace {
+
+const long kDefaultBlockSize = 64 * 1024;
+const long kMinBlockSize = 4 * 1024;
+const long kMaxBlockSize = 16 * 1024 * 1024;
+
+size_t GetBlockSize(JNIEnv* env) {
+  static const long block_size = std::min(
+      std::max(GetJavaSystemPropertyLong("jcef.write.buffer.size", env,
+                                         kDefaultBlockSize),
+               kMinBlockSize),
+      kMaxBlockSize);
+  return (size_t)block_size;
+}
+
+}  // namespace
+
 WriteHandler::WriteHandler(JNIEnv* env, jobject jOutputStream)
-    : handle_(env, jOutputStream) {}
+    : handle_(env, jOutputStream),
+      block_size_(GetBlockSize(env)),
+      jblock_(env,
+              ScopedJNIObjectLocal(env, env->NewByteArray((jsize)block_size_))
+                  .get()) {
+  buffer_.reserve(block_size_);
+  if (!jblock_) {
+    env->ExceptionClear();
+    failed_ = true;
+  }
+}
 
 WriteHandler::~WriteHandler() {
   ScopedJNIEnv env;
   if (!env)
     return;
 
+  FlushBuffer(env);
   if (handle_) {
     JNI_CALL_VOID_METHOD(env, handle_, "close", "()V");
   }
 }
 
+bool WriteHandler::WriteToStream(JNIEnv* env, const char* data, size_t size) {
+  if (failed_)
+    return false;
+  while (size > 0) {
+    const jsize chunk = (jsize)std::min(size, block_size_);
+    env->SetByteArrayRegion((jbyteArray)jblock_.get(), 0, chunk,
+                            (const jbyte*)data);
+    JNI_CALL_VOID_METHOD_EX(env, handle_, "write", "([BII)V", jblock_.get(),
+                            0, chunk);
+    if (env->ExceptionOccurred()) {
+      env->ExceptionClear();
+      failed_ = true;
+      return false;
+    }
+    data += chunk;
+    size -= chunk;
+  }
+  return true;
+}
+
+bool WriteHandler::FlushBuffer(JNIEnv* env) {
+  if (buffer_.empty())
+    return !failed_;
+  const bool result = WriteToStream(env, buffer_.data(), buffer_.size());
+  buffer_.clear();
+  return result;
+}
+
 size_t WriteHandler::Write(const void* ptr, size_t size, size_t n) {
   base::AutoLock lock_scope(lock_);
-  size_t rv = n;
+  if (failed_)
+    return 0;
+
+  const size_t bytes = size * n;
+  if (buffer_.size() + bytes <= block_size_) {
+    // Fast path: no JNI calls until the block is full.
+    const char* data = static_cast<const char*>(ptr);
+    buffer_.insert(buffer_.end(), data, data + bytes);
+    offset_ += bytes;
+    return n;
+  }
 
   ScopedJNIEnv env;
   if (!env)
-    return rv;
-
-  jbyteArray jbyteArray = env->NewByteArray((jsize)(size * n));
-  env->SetByteArrayRegion(jbyteArray, 0, (jsize)(size * n), (const jbyte*)ptr);
+    return n;
 
-  JNI_CALL_VOID_METHOD_EX(env, handle_, "write", "([B)V", jbyteArray);
-  if (env->ExceptionOccurred()) {
-    env->ExceptionClear();
-    rv = 0;
+  if (!FlushBuffer(env))
+    return 0;
+  if (bytes < block_size_) {
+    const char* data = static_cast<const char*>(ptr);
+    buffer_.insert(buffer_.end(), data, data + bytes);
+  } else if (!WriteToStream(env, static_cast<const char*>(ptr), bytes)) {
+    return 0;
   }
-  offset_ += (rv * size);
-  env->DeleteLocalRef(jbyteArray);
-
-  return rv;
+  offset_ += bytes;
+  return n;
 }
 
 int WriteHandler::Seek(int64_t offset, int whence) {
@@ -52,10 +118,13 @@ int64_t WriteHandler::Tell() {
 }
 
 int WriteHandler::Flush() {
+  base::AutoLock lock_scope(lock_);
   ScopedJNIEnv env;
-  if (env) {
-    JNI_CALL_VOID_METHOD(env, handle_, "flush", "()V");
-  }
+  if (!env)
+    return 0;
+  if (!FlushBuffer(env))
+    return -1;
+  JNI_CALL_VOID_METHOD(env, handle_, "flush", "()V");
   return 0;
 }
 
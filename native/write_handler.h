@@ -8,12 +8,17 @@
 
 #include <jni.h>
 
+#include <vector>
+
 #include "include/base/cef_lock.h"
 #include "include/cef_stream.h"
 
 #include "jni_scoped_helpers.h"
 
-// WriteHandler implementation.
+// WriteHandler implementation. Small writes are accumulated into a native
+// block (its size is set by the jcef.write.buffer.size system property) and
+// passed to the Java OutputStream via single reused byte[] when the block is
+// full, on Flush() and on destruction.
 class WriteHandler : public CefWriteHandler {
  public:
   WriteHandler(JNIEnv* env, jobject jOutputStream);
@@ -27,8 +32,17 @@ class WriteHandler : public CefWriteHandler {
   virtual bool MayBlock() override;
 
  protected:
+  // Passes |size| bytes to the Java stream in chunks of the block size.
+  // Returns false if the stream has thrown an exception.
+  bool WriteToStream(JNIEnv* env, const char* data, size_t size);
+  bool FlushBuffer(JNIEnv* env);
+
   ScopedJNIObjectGlobal handle_;
+  const size_t block_size_;
+  ScopedJNIObjectGlobal jblock_;  // byte[] of |block_size_|
+  std::vector<char> buffer_;
   size_t offset_ = 0;
+  bool failed_ = false;
 
   base::Lock lock_;
 
@@ -0,0 +1,192 @@
+#include "Metrics.h"
+
+#include <algorithm>
+
+#include "Utils.h"
+#include "log/Log.h"
+
+MetricsRegistry Metrics::ourServerMethods;
+MetricsRegistry Metrics::ourClientCallbacks;
+std::mutex Metrics::ourConnectionsMutex;
+std::vector<std::weak_ptr<ConnectionMetrics>> Metrics::ourConnections;
+int Metrics::ourConnectionsCount = 0;
+
+int LatencyHistogram::bucketIndex(int64_t valueUs) {
+  if (valueUs < SUB_BUCKETS)
+    return valueUs < 0 ? 0 : (int)valueUs;
+  int exp = 63;
+  while ((valueUs >> exp) == 0)
+    --exp;
+  const int sub = (int)((valueUs >> (exp - SUB_BUCKETS_BITS)) & (SUB_BUCKETS - 1));
+  const int index = (exp - SUB_BUCKETS_BITS + 1) * SUB_BUCKETS + sub;
+  return std::min(index, BUCKETS - 1);
+}
+
+int64_t LatencyHistogram::bucketUpperBound(int index) {
+  if (index < SUB_BUCKETS)
+    return index;
+  const int exp = index / SUB_BUCKETS + SUB_BUCKETS_BITS - 1;
+  const int64_t sub = index % SUB_BUCKETS;
+  return ((SUB_BUCKETS + sub + 1) << (exp - SUB_BUCKETS_BITS)) - 1;
+}
+
+void LatencyHistogram::record(int64_t valueUs) {
+  myCounts[bucketIndex(valueUs)].fetch_add(1, std::memory_order_relaxed);
+  myCount.fetch_add(1, std::memory_order_relaxed);
+  myTotal.fetch_add(valueUs, std::memory_order_relaxed);
+  int64_t prevMax = myMax.load(std::memory_order_relaxed);
+  while (valueUs > prevMax && !myMax.compare_exchange_weak(prevMax, valueUs, std::memory_order_relaxed)) {}
+}
+
+int64_t LatencyHistogram::percentile(double p) const {
+  // NOTE: counters are read without synchronization with writers, so result
+  // is approximate while values are being recorded.
+  int64_t total = 0;
+  for (int c = 0; c < BUCKETS; ++c)
+    total += myCounts[c].load(std::memory_order_relaxed);
+  if (total == 0)
+    return 0;
+
+  const int64_t rank = std::max((int64_t)1, (int64_t)(p * total + 0.5));
+  int64_t accumulated = 0;
+  for (int c = 0; c < BUCKETS; ++c) {
+    accumulated += myCounts[c].load(std::memory_order_relaxed);
+    if (accumulated >= rank)
+      return std::min(bucketUpperBound(c), max());
+  }
+  return max();
+}
+
+void MethodMetrics::record(int64_t durationUs, bool failed) {
+  myLatency.record(durationUs);
+  if (failed)
+    myErrors.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MethodMetrics::enter() {
+  myIsDispatched.store(true, std::memory_order_relaxed);
+  const int32_t inFlight = myInFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+  int32_t prevMax = myMaxInFlight.load(std::memory_order_relaxed);
+  while (inFlight > prevMax && !myMaxInFlight.compare_exchange_weak(prevMax, inFlight, std::memory_order_relaxed)) {}
+}
+
+void MethodMetrics::exit(int64_t bytesIn, int64_t bytesOut) {
+  myInFlight.fetch_sub(1, std::memory_order_relaxed);
+  myBytesIn.fetch_add(bytesIn, std::memory_order_relaxed);
+  myBytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+}
+
+void MethodMetrics::toThrift(thrift_codegen::MethodMetrics& out) const {
+  out.name = myName;
+  out.calls = myLatency.count();
+  out.errors = myErrors.load(std::memory_order_relaxed);
+  out.totalUs = myLatency.total();
+  out.maxUs = myLatency.max();
+  out.p50Us = myLatency.percentile(0.5);
+  out.p99Us = myLatency.percentile(0.99);
+  out.p999Us = myLatency.percentile(0.999);
+  if (myIsDispatched.load(std::memory_order_relaxed)) {
+    out.__set_bytesIn(myBytesIn.load(std::memory_order_relaxed));
+    out.__set_bytesOut(myBytesOut.load(std::memory_order_relaxed));
+    out.__set_inFlight(myInFlight.load(std::memory_order_relaxed));
+    out.__set_maxInFlight(myMaxInFlight.load(std::memory_order_relaxed));
+  }
+}
+
+void ConnectionMetrics::record(int64_t bytesIn, int64_t bytesOut) {
+  myCalls.fetch_add(1, std::memory_order_relaxed);
+  myBytesIn.fetch_add(bytesIn, std::memory_order_relaxed);
+  myBytesOut.fetch_add(bytesOut, std::memory_order_relaxed);
+}
+
+void ConnectionMetrics::toThrift(thrift_codegen::ConnectionMetrics& out) const {
+  out.id = myId;
+  out.calls = myCalls.load(std::memory_order_relaxed);
+  out.bytesIn = myBytesIn.load(std::memory_order_relaxed);
+  out.bytesOut = myBytesOut.load(std::memory_order_relaxed);
+  out.ageMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - myStart).count();
+}
+
+MethodMetrics* MetricsRegistry::get(const std::string& name) {
+  std::lock_guard<std::mutex> lock(myMutex);
+  std::unique_ptr<MethodMetrics>& entry = myEntries[name];
+  if (entry == nullptr) {
+    if (myEntries.size() > MAX_SIZE) {
+      myEntries.erase(name);
+      return nullptr;
+    }
+    entry.reset(new MethodMetrics(name));
+  }
+  return entry.get();
+}
+
+std::vector<const MethodMetrics*> MetricsRegistry::all() const {
+  std::lock_guard<std::mutex> lock(myMutex);
+  std::vector<const MethodMetrics*> result;
+  result.reserve(myEntries.size());
+  for (const auto& entry : myEntries)
+    result.push_back(entry.second.get()); // sorted by name
+  return result;
+}
+
+namespace {
+  void fillMethods(const MetricsRegistry& registry, std::vector<thrift_codegen::MethodMetrics>& out) {
+    for (const MethodMetrics* m : registry.all()) {
+      out.emplace_back();
+      m->toThrift(out.back());
+    }
+  }
+
+  void dumpMethods(const char* title, const MetricsRegistry& registry) {
+    Log::info("%s:", title);
+    for (const MethodMetrics* m : registry.all()) {
+      thrift_codegen::MethodMetrics mm;
+      m->toThrift(mm);
+      if (mm.calls == 0)
+        continue;
+      Log::info("\t%s: calls=%lld errors=%lld avg=%lld p50=%lld p99=%lld p999=%lld max=%lld (mcs)%s",
+                mm.name.c_str(), (long long)mm.calls, (long long)mm.errors, (long long)(mm.totalUs / mm.calls),
+                (long long)mm.p50Us, (long long)mm.p99Us, (long long)mm.p999Us, (long long)mm.maxUs,
+                mm.__isset.bytesIn ? string_format(" bytesIn=%lld bytesOut=%lld maxInFlight=%d",
+                                                   (long long)mm.bytesIn, (long long)mm.bytesOut, mm.maxInFlight).c_str() : "");
+    }
+  }
+}
+
+std::shared_ptr<ConnectionMetrics> Metrics::createConnection() {
+  std::lock_guard<std::mutex> lock(ourConnectionsMutex);
+  ourConnections.erase(
+      std::remove_if(ourConnections.begin(), ourConnections.end(),
+                     [](const std::weak_ptr<ConnectionMetrics>& c) { return c.expired(); }),
+      ourConnections.end());
+  auto result = std::make_shared<ConnectionMetrics>(ourConnectionsCount++);
+  ourConnections.push_back(result);
+  return result;
+}
+
+void Metrics::toThrift(thrift_codegen::ServerMetrics& out) {
+  fillMethods(ourServerMethods, out.serverMethods);
+  fillMethods(ourClientCallbacks, out.clientCallbacks);
+  out.counters["log.droppedRecords"] = Log::getDroppedCount();
+
+  std::lock_guard<std::mutex> lock(ourConnectionsMutex);
+  for (const auto& c : ourConnections) {
+    std::shared_ptr<ConnectionMetrics> connection = c.lock();
+    if (connection) {
+      out.connections.emplace_back();
+      connection->toThrift(out.connections.back());
+    }
+  }
+}
+
+void Metrics::dump() {
+  dumpMethods("Server methods", ourServerMethods);
+  dumpMethods("Client callbacks", ourClientCallbacks);
+}
+
+ScopedMetrics::~ScopedMetrics() {
+  if (myMetrics == nullptr)
+    return;
+  const auto elapsed = std::chrono::steady_clock::now() - myStart;
+  myMetrics->record(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), myFailed);
+}
@@ -0,0 +1,196 @@
+#ifndef JCEF_METRICS_H
+#define JCEF_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <thrift/transport/TTransport.h>
+#include <thrift/transport/TVirtualTransport.h>
+
+#include "./gen-cpp/shared_types.h"
+
+// Log-linear latency histogram (HDR-style): values (microseconds) are counted
+// in buckets with 1/16 relative precision. Recording is lock-free.
+class LatencyHistogram {
+ public:
+  void record(int64_t valueUs);
+
+  int64_t count() const { return myCount.load(std::memory_order_relaxed); }
+  int64_t total() const { return myTotal.load(std::memory_order_relaxed); }
+  int64_t max() const { return myMax.load(std::memory_order_relaxed); }
+  // Returns upper bound of the bucket that contains the percentile p (0..1).
+  int64_t percentile(double p) const;
+
+  static int bucketIndex(int64_t valueUs);
+  static int64_t bucketUpperBound(int index);
+
+ private:
+  static const int SUB_BUCKETS_BITS = 4;
+  static const int SUB_BUCKETS = 1 << SUB_BUCKETS_BITS;
+  static const int BUCKETS = SUB_BUCKETS * 40;
+
+  std::atomic<int64_t> myCounts[BUCKETS] = {};
+  std::atomic<int64_t> myCount{0};
+  std::atomic<int64_t> myTotal{0};
+  std::atomic<int64_t> myMax{0};
+};
+
+class MethodMetrics {
+ public:
+  explicit MethodMetrics(const std::string& name) : myName(name) {}
+
+  const std::string& name() const { return myName; }
+  void record(int64_t durationUs, bool failed);
+  void toThrift(thrift_codegen::MethodMetrics& out) const;
+
+  // Dispatch of incoming calls (server methods only).
+  void enter();
+  void exit(int64_t bytesIn, int64_t bytesOut);
+
+ private:
+  const std::string myName;
+  LatencyHistogram myLatency;
+  std::atomic<int64_t> myErrors{0};
+  std::atomic<int64_t> myBytesIn{0};
+  std::atomic<int64_t> myBytesOut{0};
+  std::atomic<int32_t> myInFlight{0};
+  std::atomic<int32_t> myMaxInFlight{0};
+  std::atomic<bool> myIsDispatched{false};
+};
+
+// Traffic of a single client connection.
+class ConnectionMetrics {
+ public:
+  explicit ConnectionMetrics(int id) : myId(id), myStart(std::chrono::steady_clock::now()) {}
+
+  void record(int64_t bytesIn, int64_t bytesOut);
+  void toThrift(thrift_codegen::ConnectionMetrics& out) const;
+
+ private:
+  const int myId;
+  const std::chrono::steady_clock::time_point myStart;
+  std::atomic<int64_t> myCalls{0};
+  std::atomic<int64_t> myBytesIn{0};
+  std::atomic<int64_t> myBytesOut{0};
+};
+
+// Registry of per-method metrics. Metrics are never removed (the set of
+// methods is limited by thrift services), so returned pointers stay valid.
+class MetricsRegistry {
+ public:
+  // Returns nullptr when registry is overcrowded (unknown method names).
+  MethodMetrics* get(const std::string& name);
+  std::vector<const MethodMetrics*> all() const;
+
+ private:
+  static const size_t MAX_SIZE = 1024;
+  mutable std::mutex myMutex;
+  std::map<std::string, std::unique_ptr<MethodMetrics>> myEntries;
+};
+
+class Metrics {
+ public:
+  // Calls from clients (Server service).
+  static MetricsRegistry& serverMethods() { return ourServerMethods; }
+  // Backward calls into clients (ClientHandlers service).
+  static MetricsRegistry& clientCallbacks() { return ourClientCallbacks; }
+
+  // Metrics of the new client connection (alive while the returned object is
+  // referenced).
+  static std::shared_ptr<ConnectionMetrics> createConnection();
+
+  static void toThrift(thrift_codegen::ServerMetrics& out);
+  // Prints metrics of all methods into log.
+  static void dump();
+
+ private:
+  static MetricsRegistry ourServerMethods;
+  static MetricsRegistry ourClientCallbacks;
+  static std::mutex ourConnectionsMutex;
+  static std::vector<std::weak_ptr<ConnectionMetrics>> ourConnections;
+  static int ourConnectionsCount;
+};
+
+// Transport decorator that counts transferred bytes (used to measure payload
+// of incoming calls).
+class MeteredTransport : public apache::thrift::transport::TVirtualTransport<MeteredTransport> {
+ public:
+  explicit MeteredTransport(std::shared_ptr<apache::thrift::transport::TTransport> transport)
+      : myTransport(transport) {}
+
+  bool isOpen() const override { return myTransport->isOpen(); }
+  bool peek() override { return myTransport->peek(); }
+  void open() override { myTransport->open(); }
+  void close() override { myTransport->close(); }
+
+  uint32_t read(uint8_t* buf, uint32_t len) {
+    const uint32_t result = myTransport->read(buf, len);
+    myBytesRead += result;
+    return result;
+  }
+  uint32_t readAll(uint8_t* buf, uint32_t len) {
+    const uint32_t result = myTransport->readAll(buf, len);
+    myBytesRead += result;
+    return result;
+  }
+  void write(const uint8_t* buf, uint32_t len) {
+    myTransport->write(buf, len);
+    myBytesWritten += len;
+  }
+  const uint8_t* borrow(uint8_t* buf, uint32_t* len) { return myTransport->borrow(buf, len); }
+  void consume(uint32_t len) {
+    myTransport->consume(len);
+    myBytesRead += len;
+  }
+  uint32_t readEnd() override { return myTransport->readEnd(); }
+  uint32_t writeEnd() override { return myTransport->writeEnd(); }
+  void flush() override { myTransport->flush(); }
+
+  std::shared_ptr<apache::thrift::transport::TTransport> getUnderlyingTransport() { return myTransport; }
+
+  // Accessed only by the connection thread.
+  int64_t getBytesRead() const { return myBytesRead; }
+  int64_t getBytesWritten() const { return myBytesWritten; }
+
+ private:
+  std::shared_ptr<apache::thrift::transport::TTransport> myTransport;
+  int64_t myBytesRead = 0;
+  int64_t myBytesWritten = 0;
+};
+
+class MeteredTransportFactory : public apache::thrift::transport::TTransportFactory {
+ public:
+  explicit MeteredTransportFactory(std::shared_ptr<apache::thrift::transport::TTransportFactory> factory)
+      : myFactory(factory) {}
+
+  std::shared_ptr<apache::thrift::transport::TTransport> getTransport(
+      std::shared_ptr<apache::thrift::transport::TTransport> trans) override {
+    return std::make_shared<MeteredTransport>(myFactory->getTransport(trans));
+  }
+
+ private:
+  std::shared_ptr<apache::thrift::transport::TTransportFactory> myFactory;
+};
+
+// Records duration of the scope into the given metrics (if not null).
+class ScopedMetrics {
+ public:
+  explicit ScopedMetrics(MethodMetrics* metrics)
+      : myMetrics(metrics), myStart(std::chrono::steady_clock::now()) {}
+  ~ScopedMetrics();
+
+  void setFailed() { myFailed = true; }
+
+ private:
+  MethodMetrics* const myMetrics;
+  const std::chrono::steady_clock::time_point myStart;
+  bool myFailed = false;
+};
+
+#endif  // JCEF_METRICS_H
@@ -1,5 +1,7 @@
 #ifndef JCEF_REMOTEOBJECTS_H
 #define JCEF_REMOTEOBJECTS_H
+#include <atomic>
+#include <functional>
 #include <mutex>
 #include <vector>
 #include "Utils.h"
@@ -7,37 +9,172 @@
 #include "include/internal/cef_ptr.h"
 #include "log/Log.h"
 
-template <class T>
+// Registry of live server objects (slot map). Object id is a handle that
+// consists of slot index and slot generation (11 bits with default
+// LOCAL_BITS), so stale ids (of disposed objects) aren't resolved into new
+// objects that reuse the same slot. Freed slots are reused in FIFO order and
+// only when a shard has at least MIN_FREE_SLOTS of them (or is full), so
+// generation of a slot wraps (and stale id can match again) only after
+// ~2048*MIN_FREE_SLOTS disposals in the shard.
+// Slots are allocated by chunks on demand, when a shard is full the others are
+// used, so capacity is limited only by id bits (1M of live objects by default).
+// Lookup is lock-free, create/dispose lock only one of the shards.
+template <class T, int LOCAL_BITS = 16 /* slots per shard */>
 class ServerObjectsFactory {
  public:
-  T* create(std::function<T*(int)> creator) {
-    Lock lock(MUTEX);
+  static const int SHARD_BITS = 4;
+  static const int INDEX_BITS = SHARD_BITS + LOCAL_BITS;
 
-    static int id = 0;
-    const int newId = id++;
-    T* result = creator(newId);
-    INSTANCES[newId] = result;
-    return result;
+ private:
+  static const int CHUNK_BITS = 8;    // slots per chunk
+  static const int GEN_MASK = (1 << (31 - INDEX_BITS)) - 1; // keep ids positive
+  static const int MIN_FREE_SLOTS = 1024;
+  static_assert(LOCAL_BITS >= CHUNK_BITS && INDEX_BITS < 31, "Invalid slots count");
+
+  static const int SHARDS_COUNT = 1 << SHARD_BITS;
+  static const int CHUNK_SIZE = 1 << CHUNK_BITS;
+  static const int CHUNKS_COUNT = 1 << (LOCAL_BITS - CHUNK_BITS);
+
+  struct Slot {
+    std::atomic<T*> obj{nullptr};
+    std::atomic<int> gen{0};
+    int nextFree = -1;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::atomic<Slot*> chunks[CHUNKS_COUNT] = {};
+    int slotsCount = 0;
+    // FIFO queue of free slots (linked via Slot::nextFree)
+    int freeHead = -1;
+    int freeTail = -1;
+    int freeCount = 0;
+  };
+
+ public:
+  ~ServerObjectsFactory() {
+    for (Shard& shard : myShards)
+      for (auto& chunk : shard.chunks)
+        delete[] chunk.load();
+  }
+
+  // Returns nullptr only when all slots are used.
+  T* create(std::function<T*(int)> creator) {
+    const int firstShard = myNextShard++;
+    for (int c = 0; c < SHARDS_COUNT; ++c) {
+      const int shardIndex = (firstShard + c) & (SHARDS_COUNT - 1);
+      int local;
+      Slot* slot = _allocate(myShards[shardIndex], local);
+      if (slot == nullptr)
+        continue; // shard is full, try the next one
+
+      const int index = (local << SHARD_BITS) | shardIndex;
+      const int newId = (slot->gen.load(std::memory_order_relaxed) << INDEX_BITS) | index;
+      T* result = creator(newId);
+      slot->obj.store(result, std::memory_order_release);
+      myLiveCount++;
+      return result;
+    }
+    Log::error("Can't create remote object: all %d slots are used", SHARDS_COUNT << LOCAL_BITS);
+    return nullptr;
   }
 
   T* find(int id) {
-    Lock lock(MUTEX);
-    return INSTANCES[id];
+    Slot* slot = _find(id);
+    if (slot == nullptr)
+      return nullptr;
+    T* result = slot->obj.load(std::memory_order_acquire);
+    // Slot could be disposed (and reused) concurrently, so check generation after reading
+    if (slot->gen.load(std::memory_order_acquire) != _gen(id))
+      return nullptr;
+    return result;
   }
 
   void dispose(int id, bool doDelete) {
-    Lock lock(MUTEX);
-    T* r = INSTANCES[id];
-    if (r != nullptr) {
-      if (doDelete)
-        delete r;
-      INSTANCES.erase(id);
+    Slot* slot = _find(id);
+    if (slot == nullptr)
+      return;
+
+    T* r = nullptr;
+    {
+      Shard& shard = myShards[id & (SHARDS_COUNT - 1)];
+      std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+      _lock(lock);
+      if (slot->gen.load(std::memory_order_relaxed) != _gen(id))
+        return; // already disposed
+      r = slot->obj.exchange(nullptr, std::memory_order_acq_rel);
+      slot->gen.store((_gen(id) + 1) & GEN_MASK, std::memory_order_release);
+      const int local = (id & ((1 << INDEX_BITS) - 1)) >> SHARD_BITS;
+      slot->nextFree = -1;
+      if (shard.freeTail >= 0)
+        _slot(shard, shard.freeTail)->nextFree = local;
+      else
+        shard.freeHead = local;
+      shard.freeTail = local;
+      shard.freeCount++;
     }
+    if (r != nullptr)
+      myLiveCount--;
+    // NOTE: destructor calls dispose(id, false) that does nothing because slot generation is already changed
+    if (doDelete)
+      delete r;
   }
 
+  int getLiveCount() const { return myLiveCount; }
+  int64_t getLocksCount() const { return myLocksCount; }
+  int64_t getContendedLocksCount() const { return myContendedLocksCount; }
+
  private:
-  std::map<int, T*> INSTANCES;
-  std::recursive_mutex MUTEX;
+  Shard myShards[SHARDS_COUNT];
+  std::atomic<int> myNextShard{0};
+  std::atomic<int> myLiveCount{0};
+  std::atomic<int64_t> myLocksCount{0};
+  std::atomic<int64_t> myContendedLocksCount{0};
+
+  static int _gen(int id) { return (id >> INDEX_BITS) & GEN_MASK; }
+
+  // Returns free slot of the shard (or nullptr when shard is full).
+  Slot* _allocate(Shard& shard, int& local) {
+    std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+    _lock(lock);
+    const bool isFull = shard.slotsCount >= (1 << LOCAL_BITS);
+    if (shard.freeCount > 0 && (shard.freeCount >= MIN_FREE_SLOTS || isFull)) {
+      local = shard.freeHead;
+      Slot* slot = _slot(shard, local);
+      shard.freeHead = slot->nextFree;
+      if (shard.freeHead < 0)
+        shard.freeTail = -1;
+      shard.freeCount--;
+      return slot;
+    }
+    if (isFull)
+      return nullptr;
+    local = shard.slotsCount++;
+    std::atomic<Slot*>& chunk = shard.chunks[local >> CHUNK_BITS];
+    if (chunk.load(std::memory_order_relaxed) == nullptr)
+      chunk.store(new Slot[CHUNK_SIZE], std::memory_order_release);
+    return _slot(shard, local);
+  }
+
+  static Slot* _slot(Shard& shard, int local) {
+    return shard.chunks[local >> CHUNK_BITS].load(std::memory_order_relaxed) + (local & (CHUNK_SIZE - 1));
+  }
+
+  Slot* _find(int id) {
+    if (id < 0)
+      return nullptr;
+    const int local = (id & ((1 << INDEX_BITS) - 1)) >> SHARD_BITS;
+    Slot* chunk = myShards[id & (SHARDS_COUNT - 1)].chunks[local >> CHUNK_BITS].load(std::memory_order_acquire);
+    return chunk == nullptr ? nullptr : chunk + (local & (CHUNK_SIZE - 1));
+  }
+
+  void _lock(std::unique_lock<std::mutex>& lock) {
+    myLocksCount++;
+    if (!lock.try_lock()) {
+      myContendedLocksCount++;
+      lock.lock();
+    }
+  }
 };
 
 template <class T, class D>
@@ -105,27 +242,25 @@ class RemoteServerObjectUpdatable : public RemoteServerObject<T, D> {
   explicit RemoteServerObjectUpdatable(int id, CefRefPtr<D> delegate) : RemoteServerObject<T, D>(id, delegate) {}
   ~RemoteServerObjectUpdatable() override {}
 
-  thrift_codegen::RObject serverIdWithMap() {
+  thrift_codegen::RObject serverIdWithInfo() {
     thrift_codegen::RObject robj;
     robj.__set_objId(RemoteServerObject<T, D>::myId);
-    robj.__set_objInfo(toMap());
+    Lock lock(myMutex);
+    toThriftImpl(robj);
     return robj;
   }
 
-  void update(const std::map<std::string, std::string>& info) {
-    Lock lock(myMutex);
-    updateImpl(info);
-  }
-  std::map<std::string, std::string> toMap() {
+  // Applies (possibly partial) state received from client.
+  void update(const thrift_codegen::RObject& robj) {
     Lock lock(myMutex);
-    return toMapImpl();
+    updateImpl(robj);
   }
 
  protected:
   // Cache support
   std::recursive_mutex myMutex;
-  virtual void updateImpl(const std::map<std::string, std::string>&) {}
-  virtual std::map<std::string, std::string> toMapImpl() { return std::map<std::string, std::string>(); }
+  virtual void updateImpl(const thrift_codegen::RObject&) {}
+  virtual void toThriftImpl(thrift_codegen::RObject&) {}
 };
 
 template <class T>
@@ -162,7 +297,8 @@ class RemoteServerObjectHolder {
     myRemoteObj = RemoteServerObjectBase<T>::create([&](int id) -> T* {return new T(delegate, id);});
   }
   ~RemoteServerObjectHolder() {
-    RemoteServerObject<T, D>::dispose(myRemoteObj->getId());
+    if (myRemoteObj != nullptr)
+      RemoteServerObject<T, D>::dispose(myRemoteObj->getId());
   }
 
   T * get() { return myRemoteObj; }
@@ -174,18 +310,4 @@ class RemoteServerObjectHolder {
 template <typename T>
 ServerObjectsFactory<T> RemoteServerObjectBase<T>::FACTORY;
 
-#define SET_STR(map, key)                          \
-  if (map.count(#key) > 0)                         \
-    myDelegate->Set##key(map.at(#key))
-
-#define SET_INT(map, key)                          \
-  if (map.count(#key) > 0)                         \
-    myDelegate->Set##key(std::stoi(map.at(#key)))
-
-#define GET_STR(map, key)                          \
-  map[#key] = myDelegate->Get##key().ToString()
-
-#define GET_INT(map, key)                          \
-  map[#key] = std::to_string(myDelegate->Get##key())
-
 #endif  // JCEF_REMOTEOBJECTS_H
@@ -2,9 +2,11 @@
 
 #include "include/cef_version.h"
 
+#include "handlers/RemoteRenderHandler.h"
 #include "handlers/app/RemoteAppHandler.h"
 #include "network/RemotePostData.h"
 #include "network/RemoteRequest.h"
+#include "network/RemoteRequestHandler.h"
 #include "network/RemoteResponse.h"
 
 #include "RemoteObjects.h"
@@ -17,9 +19,11 @@
 #include "router/RemoteMessageRouterHandler.h"
 #include "router/RemoteQueryCallback.h"
 
+#include "Metrics.h"
 #include "ServerState.h"
 
 #include "../native/critical_wait.h"
+#include "../native/input_coalescer.h"
 
 using namespace apache::thrift;
 
@@ -60,14 +64,20 @@ void ServerHandler::closeBackwardTransport() {
 int ServerHandler::connectImpl(std::function<void()> openBackwardTransport) {
   static int s_counter = 0;
   const int counter = s_counter++;
-  setThreadName(string_format("ServerHandler_%d", counter));
+  // Workers of nonblocking server execute calls of all connections.
+  if (ServerState::instance().getCmdArgs().getServerMode() != CommandLineArgs::SM_NONBLOCKING)
+    setThreadName(string_format("ServerHandler_%d", counter));
 
   // Connect to client's side (for cef-callbacks execution on java side)
   try {
     openBackwardTransport();
     RemoteAppHandler::instance()->setService(myJavaService);
   } catch (TException& tx) {
-    Log::error(tx.what());
+    // Wire format isn't negotiated, so backward connection fails when it differs from client's one.
+    Log::error("Can't open backward connection to client (%s), check that client uses the same wire format (%s protocol, %s transport).",
+               tx.what(),
+               ServerState::instance().getCmdArgs().isCompactProtocol() ? "compact" : "binary",
+               ServerState::instance().getCmdArgs().isFramedTransport() ? "framed" : "buffered");
     closeBackwardTransport();
     return -1;
   }
@@ -84,8 +94,9 @@ int32_t ServerHandler::connect(const std::string& backwardConnectionPipe, bool i
   myIsMaster = isMaster;
 
   return connectImpl([&](){
-    myJavaService = std::make_shared<RpcExecutor>(backwardConnectionPipe);
-    myJavaServiceIO = std::make_shared<RpcExecutor>(backwardConnectionPipe);
+    const int maxConnections = ServerState::instance().getCmdArgs().getBackwardConnectionsCount();
+    myJavaService = std::make_shared<RpcExecutor>(backwardConnectionPipe, maxConnections);
+    myJavaServiceIO = std::make_shared<RpcExecutor>(backwardConnectionPipe, maxConnections);
   });
 }
 
@@ -98,8 +109,9 @@ int32_t ServerHandler::connectTcp(int backwardConnectionPort, bool isMaster) {
   myIsMaster = isMaster;
 
   return connectImpl([&](){
-    myJavaService = std::make_shared<RpcExecutor>(backwardConnectionPort);
-    myJavaServiceIO = std::make_shared<RpcExecutor>(backwardConnectionPort);
+    const int maxConnections = ServerState::instance().getCmdArgs().getBackwardConnectionsCount();
+    myJavaService = std::make_shared<RpcExecutor>(backwardConnectionPort, maxConnections);
+    myJavaServiceIO = std::make_shared<RpcExecutor>(backwardConnectionPort, maxConnections);
   });
 }
 
@@ -137,6 +149,18 @@ void ServerHandler::version(std::string& _return) {
   ));
 }
 
+void ServerHandler::metrics(thrift_codegen::ServerMetrics& _return) {
+  Metrics::toThrift(_return);
+  _return.counters["objects.request.live"] = RemoteRequest::FACTORY.getLiveCount();
+  _return.counters["objects.response.live"] = RemoteResponse::FACTORY.getLiveCount();
+  _return.counters["objects.callback.live"] = RemoteCallback::FACTORY.getLiveCount();
+  _return.counters["objects.request.contendedLocks"] = RemoteRequest::FACTORY.getContendedLocksCount();
+  _return.counters["objects.response.contendedLocks"] = RemoteResponse::FACTORY.getContendedLocksCount();
+  _return.counters["input.mergedMoves"] = InputCoalescer::GetMergedMovesCount();
+  _return.counters["input.mergedWheels"] = InputCoalescer::GetMergedWheelsCount();
+  _return.counters["input.delivered"] = InputCoalescer::GetDeliveredCount();
+}
+
 #define GET_BROWSER_OR_RETURN()                          \
   auto browser = myClientsManager->getCefBrowser(bid);   \
   if (browser == nullptr) {                              \
@@ -193,6 +217,62 @@ void ServerHandler::Browser_NotifyScreenInfoChanged(const int32_t bid) {
   browser->GetHost()->NotifyScreenInfoChanged();
 }
 
+void ServerHandler::Browser_SetResourceRules(const int32_t bid, const std::vector<thrift_codegen::ResourceRule>& rules) {
+  LNDCT();
+  CefRefPtr<RemoteClientHandler> client = myClientsManager->getClient(bid);
+  if (!client) {
+    Log::error("Browser_SetResourceRules: can't find client by bid %d", bid);
+    return;
+  }
+  CefRefPtr<RemoteRequestHandler> requestHandler = client->getRemoteRequestHandler();
+  if (!requestHandler)
+    return;
+
+  if (rules.empty()) {
+    requestHandler->setResourceRules(nullptr);
+    return;
+  }
+  std::vector<ResourceRules::Rule> converted;
+  for (const auto& r : rules) {
+    if (r.action < ResourceRules::CALL_CLIENT || r.action > ResourceRules::BLOCK_COOKIES) {
+      Log::error("Browser_SetResourceRules: unknown action %d for pattern '%s'", r.action, r.urlPattern.c_str());
+      continue;
+    }
+    converted.push_back({r.urlPattern, static_cast<ResourceRules::Action>(r.action)});
+  }
+  Log::trace("Browser_SetResourceRules: bid=%d, %d rules", bid, (int)converted.size());
+  requestHandler->setResourceRules(std::make_shared<const ResourceRules>(std::move(converted)));
+}
+
+void ServerHandler::Browser_SetViewGeometry(const int32_t bid, const thrift_codegen::Rect& viewRect, const thrift_codegen::ScreenInfo& screenInfo, const thrift_codegen::Point& screenPoint0, const thrift_codegen::Point& screenPoint100) {
+  LNDCT();
+  CefRefPtr<RemoteClientHandler> client = myClientsManager->getClient(bid);
+  if (!client) {
+    Log::error("Browser_SetViewGeometry: can't find client by bid %d", bid);
+    return;
+  }
+  CefRefPtr<RemoteRenderHandler> renderHandler = client->getRemoteRenderHandler();
+  if (!renderHandler)
+    return;
+
+  // Invalid values (see ClientHandlersImpl.INVALID_*) aren't cached.
+  CefRect rect(viewRect.x, viewRect.y, viewRect.w, viewRect.h);
+  CefScreenInfo si;
+  si.device_scale_factor = static_cast<float>(screenInfo.device_scale_factor);
+  si.depth = screenInfo.depth;
+  si.depth_per_component = screenInfo.depth_per_component;
+  si.is_monochrome = screenInfo.is_monochrome;
+  si.rect = CefRect(screenInfo.rect.x, screenInfo.rect.y, screenInfo.rect.w, screenInfo.rect.h);
+  si.available_rect = CefRect(screenInfo.available_rect.x, screenInfo.available_rect.y, screenInfo.available_rect.w, screenInfo.available_rect.h);
+  CefPoint pt0(screenPoint0.x, screenPoint0.y);
+  CefPoint pt100(screenPoint100.x, screenPoint100.y);
+  const bool validPoints = screenPoint0.x != INT32_MIN && screenPoint100.x != INT32_MIN;
+  renderHandler->setViewGeometry(viewRect.w >= 0 ? &rect : nullptr,
+                                 screenInfo.depth != -1 ? &si : nullptr,
+                                 validPoints ? &pt0 : nullptr,
+                                 validPoints ? &pt100 : nullptr);
+}
+
 extern void processKeyEvent(
     CefKeyEvent & cef_event,
     int event_type, // event.getID()
@@ -202,11 +282,14 @@ extern void processKeyEvent(
     int key_code   // event.getKeyCode()
 );
 
+extern void flushCoalescedInput(CefRefPtr<CefBrowser> browser);
+
 void ServerHandler::Browser_SendKeyEvent(const int32_t bid,const int32_t event_type,const int32_t modifiers,const int16_t key_char,const int64_t scanCode,const int32_t key_code) {
   LNDCT();
   GET_BROWSER_OR_RETURN()
   CefKeyEvent cef_event;
   processKeyEvent(cef_event, event_type, modifiers, key_char, scanCode, key_char);
+  flushCoalescedInput(browser);
   browser->GetHost()->SendKeyEvent(cef_event);
 }
 
@@ -395,7 +478,7 @@ void ServerHandler::Request_Update(const thrift_codegen::RObject & request) {
   if (rr == nullptr)
     return;
 
-  rr->update(request.objInfo);
+  rr->update(request);
 }
 
 void ServerHandler::Response_Update(const thrift_codegen::RObject& response) {
@@ -403,7 +486,7 @@ void ServerHandler::Response_Update(const thrift_codegen::RObject& response) {
   if (rr == nullptr)
     return;
 
-  rr->update(response.objInfo);
+  rr->update(response);
 }
 
 void ServerHandler::Request_GetHeaderByName(
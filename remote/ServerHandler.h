@@ -28,6 +28,7 @@ class ServerHandler : public thrift_codegen::ServerIf {
   void stop() override;
   void state(std::string& _return) override;
   void version(std::string& _return) override;
+  void metrics(thrift_codegen::ServerMetrics& _return) override;
 
   //
   // CefBrowser
@@ -43,6 +44,8 @@ class ServerHandler : public thrift_codegen::ServerIf {
   void Browser_ExecuteJavaScript(const int32_t bid,const std::string& code,const std::string& url,const int32_t line) override;
   void Browser_WasResized(const int32_t bid) override;
   void Browser_NotifyScreenInfoChanged(const int32_t bid) override;
+  void Browser_SetResourceRules(const int32_t bid, const std::vector<thrift_codegen::ResourceRule>& rules) override;
+  void Browser_SetViewGeometry(const int32_t bid, const thrift_codegen::Rect& viewRect, const thrift_codegen::ScreenInfo& screenInfo, const thrift_codegen::Point& screenPoint0, const thrift_codegen::Point& screenPoint100) override;
   void Browser_SendKeyEvent(const int32_t bid,const int32_t event_type,const int32_t modifiers,const int16_t key_char,const int64_t scanCode,const int32_t key_code) override;
   void Browser_SendMouseEvent(const int32_t bid,const int32_t event_type,const int32_t x,const int32_t y,const int32_t modifiers,const int32_t click_count,const int32_t button) override;
   void Browser_SendMouseWheelEvent(const int32_t bid,const int32_t scroll_type,const int32_t x,const int32_t y,const int32_t modifiers,const int32_t delta,const int32_t units_to_scroll) override;
@@ -44,7 +44,7 @@ ServerState::ServerState() : myFactory(std::make_shared<ServerHandlerFactory>())
 
 void ServerState::init(int argc, char* argv[]) {
   myCmdArgs.init(argc, argv);
-  Log::init(myCmdArgs.getLogLevel(), myCmdArgs.getLogFile());
+  Log::init(myCmdArgs.getLogLevel(), myCmdArgs.getLogFile(), myCmdArgs.isLogBinary());
 }
 
 // Called from ServerHandler::stop
@@ -130,6 +130,59 @@ void CommandLineArgs::init(int argc, char* argv[]) {
       myPathParamsFile = str.substr(tokenPos + 9);
     } else if (str.find("--testmode") != str.npos) {
       myIsTestMode = true;
+    } else if (str.find("--paint-dirty-rects-only") != str.npos) {
+      myIsPaintDirtyRectsOnly = true;
+    } else if ((tokenPos = str.find("--paint-buffers=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 16);
+      myPaintBuffersCount = std::stoi(sval);
+      if (myPaintBuffersCount < 2) myPaintBuffersCount = 2;
+      if (myPaintBuffersCount > 8) myPaintBuffersCount = 8;
+    } else if (str.find("--paint-backpressure") != str.npos) {
+      myIsPaintBackpressure = true;
+    } else if (str.find("--paint-sync") != str.npos) {
+      myIsPaintSync = true;
+    } else if ((tokenPos = str.find("--backward-connections=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 23);
+      myBackwardConnectionsCount = std::stoi(sval);
+      if (myBackwardConnectionsCount < 1) myBackwardConnectionsCount = 1;
+      if (myBackwardConnectionsCount > 8) myBackwardConnectionsCount = 8;
+    } else if (str.find("--response-read-shared-mem") != str.npos) {
+      myIsResponseReadSharedMem = true;
+    } else if ((tokenPos = str.find("--input-coalesce-ms=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 20);
+      myInputCoalesceMs = std::stoi(sval);
+      if (myInputCoalesceMs < 0) myInputCoalesceMs = 0;
+      if (myInputCoalesceMs > 100) myInputCoalesceMs = 100;
+    } else if (str.find("--log-sync") != str.npos) {
+      myIsLogSync = true;
+    } else if (str.find("--log-binary") != str.npos) {
+      myIsLogBinary = true;
+    } else if ((tokenPos = str.find("--decode-log=")) != str.npos) {
+      myPathDecodeLogFile = str.substr(tokenPos + 13);
+    } else if (str.find("--metrics-dump") != str.npos) {
+      myIsMetricsDump = true;
+    } else if ((tokenPos = str.find("--server-mode=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 14);
+      if (sval == "nonblocking")
+        myServerMode = SM_NONBLOCKING;
+      else
+        myServerMode = SM_THREADED;
+      // NOTE: thread-pool mode ("pool") isn't supported: every connection
+      // occupies a worker while alive, so extra clients hang in connect().
+    } else if ((tokenPos = str.find("--server-workers=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 17);
+      myServerWorkersCount = std::stoi(sval);
+      if (myServerWorkersCount < 1) myServerWorkersCount = 1;
+      if (myServerWorkersCount > 64) myServerWorkersCount = 64;
+    } else if ((tokenPos = str.find("--protocol=")) != str.npos) {
+      myIsCompactProtocol = str.substr(tokenPos + 11) == "compact";
+    } else if ((tokenPos = str.find("--transport=")) != str.npos) {
+      myIsFramedTransport = str.substr(tokenPos + 12) == "framed";
+    } else if ((tokenPos = str.find("--transport-buffer-size=")) != str.npos) {
+      std::string sval = str.substr(tokenPos + 24);
+      myTransportBufferSize = std::stoi(sval);
+      if (myTransportBufferSize < 512) myTransportBufferSize = 512;
+      if (myTransportBufferSize > 1024*1024) myTransportBufferSize = 1024*1024;
     }
   }
 }
@@ -23,6 +23,12 @@ class ServerHandlerFactory : virtual public thrift_codegen::ServerIfFactory {
 
 class CommandLineArgs {
  public:
+  // Thrift server implementation that serves client connections.
+  enum ServerMode {
+    SM_THREADED,    // thread per connection
+    SM_NONBLOCKING  // event-driven IO thread, calls are executed by fixed pool of workers (framed transport)
+  };
+
   CommandLineArgs();
   void init(int argc, char* argv[]);
 
@@ -34,6 +40,25 @@ class CommandLineArgs {
   bool isTestMode() const { return myIsTestMode; }
   int getLogLevel() const { return myLogLevel; }
   int getOpenTransportCooldownMs() const { return myOpenTransportCooldownMs; }
+  bool isPaintDirtyRectsOnly() const { return myIsPaintDirtyRectsOnly; }
+  int getPaintBuffersCount() const { return myPaintBuffersCount; }
+  bool isPaintBackpressure() const { return myIsPaintBackpressure; }
+  bool isPaintSync() const { return myIsPaintSync; }
+  int getBackwardConnectionsCount() const { return myBackwardConnectionsCount; }
+  bool isResponseReadSharedMem() const { return myIsResponseReadSharedMem; }
+  int getInputCoalesceMs() const { return myInputCoalesceMs; }
+  bool isLogSync() const { return myIsLogSync; }
+  bool isLogBinary() const { return myIsLogBinary; }
+  std::string getDecodeLogFile() const { return myPathDecodeLogFile; }
+  bool isMetricsDump() const { return myIsMetricsDump; }
+  ServerMode getServerMode() const { return myServerMode; }
+  // Count of workers that execute calls in nonblocking mode. It limits only
+  // concurrently executed calls, not the count of client connections.
+  int getServerWorkersCount() const { return myServerWorkersCount; }
+  bool isCompactProtocol() const { return myIsCompactProtocol; }
+  // Nonblocking server reads whole frames, so it always uses framed transport.
+  bool isFramedTransport() const { return myIsFramedTransport || myServerMode == SM_NONBLOCKING; }
+  int getTransportBufferSize() const { return myTransportBufferSize; }
 
  private:
   bool myUseTcp = false;
@@ -44,6 +69,22 @@ class CommandLineArgs {
   bool myIsTestMode = false;
   int myLogLevel = -1;
   int myOpenTransportCooldownMs = 3;
+  bool myIsPaintDirtyRectsOnly = false;
+  int myPaintBuffersCount = 3;
+  bool myIsPaintBackpressure = false;
+  bool myIsPaintSync = false;
+  int myBackwardConnectionsCount = 3;
+  bool myIsResponseReadSharedMem = false;
+  int myInputCoalesceMs = 8;
+  bool myIsLogSync = false;
+  bool myIsLogBinary = false;
+  std::string myPathDecodeLogFile;
+  bool myIsMetricsDump = false;
+  ServerMode myServerMode = SM_THREADED;
+  int myServerWorkersCount = 8;
+  bool myIsCompactProtocol = false;
+  bool myIsFramedTransport = false;
+  int myTransportBufferSize = 512;
 };
 
 class ServerState {
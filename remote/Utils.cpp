@@ -1,9 +1,15 @@
 #include "Utils.h"
 
+#include <algorithm>
+
 #include <thrift/transport/TSocket.h>
 #include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/protocol/TProtocolDecorator.h>
 #include <thrift/transport/TTransportUtils.h>
 
+#include "Metrics.h"
+#include "ServerState.h"
 #include "log/Log.h"
 #ifdef WIN32
 #include "windows/PipeTransport.h"
@@ -17,54 +23,210 @@ using namespace apache::thrift::transport;
 
 using namespace thrift_codegen;
 
-RpcExecutor::RpcExecutor(int port) {
-  myTransport = std::make_shared<TBufferedTransport>(std::make_shared<TSocket>("localhost", port));
-  myService = std::make_shared<ClientHandlersClient>(std::make_shared<TBinaryProtocol>(myTransport));
+namespace {
+  std::atomic<int64_t> ourRpcExecutorsCount{0};
+
+  // Connection of the RpcExecutor (identified by its id) that is used by the
+  // current thread. Entries of destroyed executors expire with their connections.
+  struct ConnectionPin {
+    int64_t executorId;
+    std::weak_ptr<void> connection;
+  };
+  thread_local std::vector<ConnectionPin> ourConnectionPins;
+
+  // Remembers name of the called method (the rpc passed into RpcExecutor::exec
+  // is an arbitrary lambda).
+  class MethodNameProtocol : public TProtocolDecorator {
+   public:
+    MethodNameProtocol(std::shared_ptr<TProtocol> protocol, std::string& method)
+        : TProtocolDecorator(protocol), myMethod(method) {}
+
+    uint32_t writeMessageBegin_virt(const std::string& name,
+                                    const TMessageType messageType,
+                                    const int32_t seqid) override {
+      myMethod.assign(name);
+      return TProtocolDecorator::writeMessageBegin_virt(name, messageType, seqid);
+    }
+
+   private:
+    std::string& myMethod;
+  };
+
+  class WireTransportFactory : public TTransportFactory {
+   public:
+    WireTransportFactory(bool isFramed, uint32_t bufferSize)
+        : myIsFramed(isFramed), myBufferSize(bufferSize) {}
+
+    std::shared_ptr<TTransport> getTransport(std::shared_ptr<TTransport> trans) override {
+      if (myIsFramed)
+        return std::make_shared<TFramedTransport>(trans, myBufferSize);
+      return std::make_shared<TBufferedTransport>(trans, myBufferSize);
+    }
+
+   private:
+    const bool myIsFramed;
+    const uint32_t myBufferSize;
+  };
+}
+
+std::shared_ptr<TTransportFactory> WireFormat::transportFactory() {
+  const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
+  return std::make_shared<WireTransportFactory>(cmdArgs.isFramedTransport(), cmdArgs.getTransportBufferSize());
+}
+
+std::shared_ptr<TProtocolFactory> WireFormat::protocolFactory() {
+  if (ServerState::instance().getCmdArgs().isCompactProtocol())
+    return std::make_shared<TCompactProtocolFactory>();
+  return std::make_shared<TBinaryProtocolFactory>();
+}
 
-  myTransport->open();
-  const int32_t backwardCid = myService->connect();
-  Log::trace("Backward tcp connection to client established, backwardCid=%d.", backwardCid);
+RpcExecutor::RpcExecutor(int port, int maxConnections)
+    : myTransportFactory([port]() -> std::shared_ptr<TTransport> {
+        return std::make_shared<TSocket>("localhost", port);
+      }),
+      myMaxConnections(std::max(maxConnections, 1)),
+      myId(ourRpcExecutorsCount++) {
+  myConnections.push_back(_openConnection());
 }
 
-RpcExecutor::RpcExecutor(std::string pipeName) {
+RpcExecutor::RpcExecutor(std::string pipeName, int maxConnections)
+    : myTransportFactory([pipeName]() -> std::shared_ptr<TTransport> {
 #ifdef WIN32
-  myTransport = std::make_shared<PipeTransport>("\\\\.\\pipe\\" + pipeName);
+        return std::make_shared<PipeTransport>("\\\\.\\pipe\\" + pipeName);
 #else
-  myTransport = std::make_shared<TSocket>(pipeName.c_str());
+        return std::make_shared<TSocket>(pipeName.c_str());
 #endif
-  myService = std::make_shared<ClientHandlersClient>(std::make_shared<TBinaryProtocol>(myTransport));
+      }),
+      myMaxConnections(std::max(maxConnections, 1)),
+      myId(ourRpcExecutorsCount++) {
+  myConnections.push_back(_openConnection());
+}
+
+std::shared_ptr<RpcExecutor::Connection> RpcExecutor::_openConnection() {
+  std::shared_ptr<Connection> connection = std::make_shared<Connection>();
+  connection->transport = WireFormat::transportFactory()->getTransport(myTransportFactory());
+  connection->service = std::make_shared<ClientHandlersClient>(std::make_shared<MethodNameProtocol>(
+      WireFormat::protocolFactory()->getProtocol(connection->transport), connection->method));
 
-  myTransport->open();
-  const int32_t backwardCid = myService->connect();
-  Log::trace("Backward pipe connection to client established, backwardCid=%d.", backwardCid);
+  connection->transport->open();
+  const int32_t backwardCid = connection->service->connect();
+  Log::trace("Backward connection to client established, backwardCid=%d.", backwardCid);
+  return connection;
 }
 
-void RpcExecutor::close() {
-  Lock lock(myMutex);
+std::shared_ptr<RpcExecutor::Connection> RpcExecutor::_getConnection() {
+  if (myIsClosed)
+    return nullptr;
 
-  if (myService != nullptr) {
-    myService = nullptr;
+  for (auto it = ourConnectionPins.begin(); it != ourConnectionPins.end();) {
+    if (it->connection.expired()) {
+      it = ourConnectionPins.erase(it);
+      continue;
+    }
+    if (it->executorId == myId)
+      return std::static_pointer_cast<Connection>(it->connection.lock());
+    ++it;
+  }
+
+  // New thread: use connection that isn't assigned yet (open new one if
+  // possible), otherwise share connections in round-robin manner. Connection
+  // is opened outside of the pool lock (it makes round trip to the client).
+  int index;
+  {
+    std::unique_lock<std::mutex> lock(myPoolMutex);
+    index = myAssignedCount++;
+  }
+  std::shared_ptr<Connection> opened;
+  if (index > 0 && index < myMaxConnections) {
     try {
-      myTransport->close();
+      opened = _openConnection();
     } catch (const TException& e) {
-      Log::error("Exception during rpc-executor transport closing, err: %s", e.what());
+      Log::error("Can't open additional backward connection, err: %s", e.what());
     }
-    myTransport = nullptr;
+  }
+
+  std::shared_ptr<Connection> result;
+  {
+    std::unique_lock<std::mutex> lock(myPoolMutex);
+    if (!myIsClosed) {
+      if (opened != nullptr) {
+        myConnections.push_back(opened);
+        result = opened;
+      } else {
+        result = myConnections[index % myConnections.size()];
+      }
+    }
+  }
+  if (result == nullptr) {
+    if (opened != nullptr)
+      _closeConnection(*opened);
+    return nullptr;
+  }
+  ourConnectionPins.push_back({myId, result});
+  return result;
+}
+
+void RpcExecutor::_closeIfNecessary(Connection& connection) {
+  if (myIsClosed && connection.service != nullptr)
+    _closeConnection(connection);
+}
+
+void RpcExecutor::_closeConnection(Connection& connection) {
+  connection.service = nullptr;
+  try {
+    connection.transport->close();
+  } catch (const TException& e) {
+    Log::error("Exception during rpc-executor transport closing, err: %s", e.what());
+  }
+  connection.transport = nullptr;
+}
+
+void RpcExecutor::close() {
+  std::vector<std::shared_ptr<Connection>> connections;
+  {
+    std::unique_lock<std::mutex> lock(myPoolMutex);
+    myIsClosed = true;
+    connections = myConnections;
+  }
+
+  // Busy connections will be closed by their users (see _closeIfNecessary).
+  for (const auto& connection : connections) {
+    std::unique_lock<std::recursive_mutex> lock(connection->mutex, std::try_to_lock);
+    if (lock.owns_lock() && connection->service != nullptr)
+      _closeConnection(*connection);
   }
 }
 
 void RpcExecutor::exec(std::function<void(Service)> rpc) {
-  Lock lock(myMutex);
+  std::shared_ptr<Connection> connection = _getConnection();
+  if (connection == nullptr)
+    return;
 
-  if (myService == nullptr) {
+  std::unique_lock<std::recursive_mutex> lock(connection->mutex);
+  if (connection->service == nullptr) {
     //Log::debug("null remote service");
     return;
   }
 
+  const auto start = std::chrono::steady_clock::now();
   try {
-    rpc(myService);
+    rpc(connection->service);
+    _recordCall(*connection, start, false);
   } catch (apache::thrift::TException& tx) {
+    _recordCall(*connection, start, true);
     Log::debug("thrift exception occured: %s", tx.what());
     close();
   }
+  _closeIfNecessary(*connection);
+}
+
+void RpcExecutor::_recordCall(Connection& connection, std::chrono::steady_clock::time_point start, bool failed) {
+  if (connection.method.empty())
+    return;
+  MethodMetrics* metrics = Metrics::clientCallbacks().get(connection.method);
+  if (metrics != nullptr) {
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    metrics->record(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), failed);
+  }
+  connection.method.clear();
 }
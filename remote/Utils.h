@@ -1,42 +1,91 @@
 #ifndef JCEF_UTILS_H
 #define JCEF_UTILS_H
 
+#include <atomic>
+#include <chrono>
+#include <map>
 #include <mutex>
+#include <thread>
+#include <vector>
 #include "./gen-cpp/ClientHandlers.h"
 #include "log/Log.h"
 
 class RpcExecutor {
  public:
   typedef std::shared_ptr<thrift_codegen::ClientHandlersClient> Service;
-  RpcExecutor(int port);
-  RpcExecutor(std::string pipeName);
+  // Opens the first backward connection immediately (throws on failure), other
+  // connections (up to maxConnections) are opened on demand.
+  RpcExecutor(int port, int maxConnections = 1);
+  RpcExecutor(std::string pipeName, int maxConnections = 1);
 
   void close();
-  bool isClosed() { return myService == nullptr; }
+  bool isClosed() { return myIsClosed; }
 
-  // Thread-safe RPC execution.
+  // Thread-safe RPC execution. Calls from different threads use separate
+  // backward connections (while connections count < maxConnections), so they
+  // can be in flight simultaneously. Calls from the same thread always use the
+  // same connection, so their order (important for oneway notifications) is kept.
   template<typename T>
   T exec(std::function<T(Service)> rpc, T defVal) {
-    std::unique_lock<std::recursive_mutex> lock(myMutex);
-    if (myService == nullptr) {
+    std::shared_ptr<Connection> connection = _getConnection();
+    if (connection == nullptr)
+      return defVal;
+
+    std::unique_lock<std::recursive_mutex> lock(connection->mutex);
+    if (connection->service == nullptr) {
       //Log::debug("null remote service");
       return defVal;
     }
+    const auto start = std::chrono::steady_clock::now();
     try {
-      return rpc(myService);
+      T result = rpc(connection->service);
+      _recordCall(*connection, start, false);
+      _closeIfNecessary(*connection);
+      return result;
     } catch (apache::thrift::TException& tx) {
+      _recordCall(*connection, start, true);
       Log::debug("thrift exception occured: %s", tx.what());
       close();
     }
+    _closeIfNecessary(*connection);
     return defVal;
   }
 
   void exec(std::function<void(Service)> rpc);
 
  private:
-  std::shared_ptr<thrift_codegen::ClientHandlersClient> myService = nullptr;
-  std::shared_ptr<apache::thrift::transport::TTransport> myTransport;
-  std::recursive_mutex myMutex;
+  struct Connection {
+    std::recursive_mutex mutex;
+    std::shared_ptr<apache::thrift::transport::TTransport> transport;
+    Service service = nullptr;
+    std::string method; // name of the last called method (for metrics)
+  };
+
+  const std::function<std::shared_ptr<apache::thrift::transport::TTransport>()> myTransportFactory;
+  const int myMaxConnections;
+  const int64_t myId; // key of the per-thread connection pins
+  std::atomic_bool myIsClosed{false};
+
+  std::mutex myPoolMutex;
+  std::vector<std::shared_ptr<Connection>> myConnections;
+  int myAssignedCount = 0; // count of threads that were assigned to connections
+
+  std::shared_ptr<Connection> _openConnection();
+  std::shared_ptr<Connection> _getConnection();
+  // Must be called under connection mutex.
+  void _closeIfNecessary(Connection& connection);
+  // Must be called under connection mutex.
+  static void _recordCall(Connection& connection, std::chrono::steady_clock::time_point start, bool failed);
+  static void _closeConnection(Connection& connection);
+};
+
+// Transport and protocol of both thrift channels (Server and ClientHandlers),
+// see --protocol, --transport and --transport-buffer-size. Java side is
+// configured with the same settings (see ThriftTransport.java).
+class WireFormat {
+ public:
+  static std::shared_ptr<apache::thrift::transport::TTransportFactory> transportFactory();
+  static std::shared_ptr<apache::thrift::protocol::TProtocolFactory> protocolFactory();
 };
 
 typedef std::unique_lock<std::recursive_mutex> Lock;
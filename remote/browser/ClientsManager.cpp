@@ -88,6 +88,10 @@ CefRefPtr<CefBrowser> ClientsManager::getCefBrowser(int bid) {
   return client->getCefBrowser();
 }
 
+CefRefPtr<RemoteClientHandler> ClientsManager::getClient(int bid) {
+  return myRemoteClients->get(bid);
+}
+
 int ClientsManager::findRemoteBrowser(CefRefPtr<CefBrowser> browser) {
   return myRemoteClients->findRemoteBrowser(browser);
 }
@@ -28,6 +28,7 @@ class ClientsManager {
   std::string closeAllBrowsers();
 
   CefRefPtr<CefBrowser> getCefBrowser(int bid);
+  CefRefPtr<RemoteClientHandler> getClient(int bid);
   int findRemoteBrowser(CefRefPtr<CefBrowser> browser); // returns bid
 
  private:
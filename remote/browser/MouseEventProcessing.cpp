@@ -1,6 +1,9 @@
 #include "include/cef_base.h"
 #include "include/cef_browser.h"
 
+#include "../ServerState.h"
+#include "../../native/input_coalescer.h"
+
 namespace {
 //
 // Constants from MouseEvent.java
@@ -27,6 +30,17 @@ const int JAVA_WHEEL_BLOCK_SCROLL = 1;
 
 extern int GetCefModifiers(int modifiers);
 
+// Returns nullptr when input coalescing is disabled (--input-coalesce-ms=0).
+CefRefPtr<InputCoalescer> getInputCoalescer(CefRefPtr<CefBrowser> browser) {
+  return InputCoalescer::Get(browser, ServerState::instance().getCmdArgs().getInputCoalesceMs());
+}
+
+void flushCoalescedInput(CefRefPtr<CefBrowser> browser) {
+  CefRefPtr<InputCoalescer> coalescer = getInputCoalescer(browser);
+  if (coalescer)
+    coalescer->Flush();
+}
+
 void processMouseEvent(
     CefRefPtr<CefBrowser> browser,
     int event_type, // getID
@@ -53,6 +67,7 @@ void processMouseEvent(
     else
       return;
 
+    flushCoalescedInput(browser);
     browser->GetHost()->SendMouseClickEvent(
         cef_event, cef_mbt, (event_type == JAVA_MOUSE_RELEASED),
         click_count);
@@ -60,7 +75,11 @@ void processMouseEvent(
              event_type == JAVA_MOUSE_DRAGGED ||
              event_type == JAVA_MOUSE_ENTERED ||
              event_type == JAVA_MOUSE_EXITED) {
-    browser->GetHost()->SendMouseMoveEvent(cef_event, (event_type == JAVA_MOUSE_EXITED));
+    CefRefPtr<InputCoalescer> coalescer = getInputCoalescer(browser);
+    if (coalescer)
+      coalescer->SendMouseMoveEvent(cef_event, (event_type == JAVA_MOUSE_EXITED));
+    else
+      browser->GetHost()->SendMouseMoveEvent(cef_event, (event_type == JAVA_MOUSE_EXITED));
   }
 }
 
@@ -94,5 +113,9 @@ void processMouseWheelEvent(
     deltaY = delta;
 #endif
 
-  browser->GetHost()->SendMouseWheelEvent(cef_event, deltaX, deltaY);
+  CefRefPtr<InputCoalescer> coalescer = getInputCoalescer(browser);
+  if (coalescer)
+    coalescer->SendMouseWheelEvent(cef_event, (int)deltaX, (int)deltaY);
+  else
+    browser->GetHost()->SendMouseWheelEvent(cef_event, deltaX, deltaY);
 }
\ No newline at end of file
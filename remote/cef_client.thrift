@@ -19,27 +19,6 @@ include "shared.thrift"
 namespace cpp thrift_codegen
 namespace java com.jetbrains.cef.remote.thrift_codegen
 
-struct Point {
-    1: required i32 x,
-    2: required i32 y,
-}
-
-struct Rect {
-    1: required i32 x,
-    2: required i32 y,
-    3: required i32 w,
-    4: required i32 h,
-}
-
-struct ScreenInfo {
-    1: required double device_scale_factor,
-    2: required i32 depth,
-    3: required i32 depth_per_component,
-    4: required bool is_monochrome,
-    5: required Rect rect,
-    6: required Rect available_rect,
-}
-
 service ClientHandlers {
     i32 connect(),
     oneway void log(1: string msg),
@@ -50,10 +29,11 @@ service ClientHandlers {
     //
     // CefRenderHandler
     //
-    Rect RenderHandler_GetViewRect(1: i32 bid),
-    ScreenInfo RenderHandler_GetScreenInfo(1: i32 bid),
-    Point RenderHandler_GetScreenPoint(1: i32 bid, 2: i32 viewX, 3: i32 viewY),
+    shared.Rect RenderHandler_GetViewRect(1: i32 bid),
+    shared.ScreenInfo RenderHandler_GetScreenInfo(1: i32 bid),
+    shared.Point RenderHandler_GetScreenPoint(1: i32 bid, 2: i32 viewX, 3: i32 viewY),
     void RenderHandler_OnPaint(1: i32 bid, 2: bool popup, 3: i32 dirtyRectsCount, 4: string sharedMemName, 5: i64 sharedMemHandle, 6: i32 width, 7: i32 height),
+    oneway void RenderHandler_OnPaintAsync(1: i32 bid, 2: bool popup, 3: i32 dirtyRectsCount, 4: string sharedMemName, 5: i64 sharedMemHandle, 6: i32 width, 7: i32 height, 8: i64 frameSeq),
     // TODO: implement
     // OnPopupShow(1:i32 bid, bool show)
     // OnPopupSize(1:i32 bid, const CefRect& rect)
@@ -115,6 +95,8 @@ service ClientHandlers {
     bool                   ResourceHandler_ProcessRequest(1:i32 resourceHandler, 2:shared.RObject request, 3:shared.RObject callback)
     shared.ResponseHeaders ResourceHandler_GetResponseHeaders(1:i32 resourceHandler, 2:shared.RObject response)
     shared.ResponseData    ResourceHandler_ReadResponse(1:i32 resourceHandler, 2:i32 bytes_to_read, 3:shared.RObject callback)
+    // Client writes data into shared memory segment (instead of ResponseData.data)
+    shared.ResponseData    ResourceHandler_ReadResponseShared(1:i32 resourceHandler, 2:i32 bytes_to_read, 3:shared.RObject callback, 4:string sharedMemName, 5:i64 sharedMemHandle)
     oneway void            ResourceHandler_Cancel(1:i32 resourceHandler)
     string            ResourceRequestHandler_OnResourceRedirect(1: i32 rrHandler, 2: i32 bid, 3: shared.RObject request, 4: shared.RObject response, 5: string new_url),
     bool              ResourceRequestHandler_OnResourceResponse(1: i32 rrHandler, 2: i32 bid, 3: shared.RObject request, 4: shared.RObject response),
@@ -28,6 +28,7 @@ service Server {
     string echo(1: string msg),
     string version(),
     string state(),
+    shared.ServerMetrics metrics(),
     oneway void stop(),
 
     //
@@ -44,6 +45,11 @@ service Server {
     oneway void Browser_ExecuteJavaScript(1: i32 bid, 2: string code, 3: string url, 4: i32 line),
     oneway void Browser_WasResized(1: i32 bid), // The browser will then call CefRenderHandler#GetViewRect to update the size of view area with the new values.
     oneway void Browser_NotifyScreenInfoChanged(1: i32 bid),  // The browser will then call CefRenderHandler#GetScreenInfo to update the screen information with the new values.
+    // Caches view geometry on server, so CefRenderHandler requests are answered without calls to client.
+    // Screen points of view points (0,0) and (100,100) are used to map view coordinates to screen.
+    oneway void Browser_SetViewGeometry(1: i32 bid, 2: shared.Rect viewRect, 3: shared.ScreenInfo screenInfo, 4: shared.Point screenPoint0, 5: shared.Point screenPoint100),
+    // Rules are evaluated on server before calls of RequestHandler_GetResourceRequestHandler, empty list disables them.
+    oneway void Browser_SetResourceRules(1: i32 bid, 2: list<shared.ResourceRule> rules),
     oneway void Browser_SendKeyEvent(1: i32 bid, 2: i32 event_type, 3: i32 modifiers, 4: i16 key_char, 5: i64 scanCode, 6: i32 key_code),
     oneway void Browser_SendMouseEvent(1: i32 bid, 2: i32 event_type, 3: i32 x, 4: i32 y, 5: i32 modifiers, 6: i32 click_count, 7: i32 button),
     oneway void Browser_SendMouseWheelEvent(1: i32 bid, 2: i32 scroll_type, 3: i32 x, 4: i32 y, 5: i32 modifiers, 6: i32 delta, 7: i32 units_to_scroll),
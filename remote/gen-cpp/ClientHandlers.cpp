@@ -1157,6 +1157,197 @@ uint32_t ClientHandlers_RenderHandler_OnPaint_presult::read(::apache::thrift::pr
 }
 
 
+ClientHandlers_RenderHandler_OnPaintAsync_args::~ClientHandlers_RenderHandler_OnPaintAsync_args() noexcept {
+}
+
+
+uint32_t ClientHandlers_RenderHandler_OnPaintAsync_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bid);
+          this->__isset.bid = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->popup);
+          this->__isset.popup = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->dirtyRectsCount);
+          this->__isset.dirtyRectsCount = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->sharedMemName);
+          this->__isset.sharedMemName = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->sharedMemHandle);
+          this->__isset.sharedMemHandle = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->width);
+          this->__isset.width = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->height);
+          this->__isset.height = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->frameSeq);
+          this->__isset.frameSeq = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientHandlers_RenderHandler_OnPaintAsync_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ClientHandlers_RenderHandler_OnPaintAsync_args");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->bid);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("popup", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->popup);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("dirtyRectsCount", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->dirtyRectsCount);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemName", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->sharedMemName);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemHandle", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->sharedMemHandle);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("width", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32(this->width);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("height", ::apache::thrift::protocol::T_I32, 7);
+  xfer += oprot->writeI32(this->height);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("frameSeq", ::apache::thrift::protocol::T_I64, 8);
+  xfer += oprot->writeI64(this->frameSeq);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+ClientHandlers_RenderHandler_OnPaintAsync_pargs::~ClientHandlers_RenderHandler_OnPaintAsync_pargs() noexcept {
+}
+
+
+uint32_t ClientHandlers_RenderHandler_OnPaintAsync_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ClientHandlers_RenderHandler_OnPaintAsync_pargs");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((*(this->bid)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("popup", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool((*(this->popup)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("dirtyRectsCount", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32((*(this->dirtyRectsCount)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemName", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString((*(this->sharedMemName)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemHandle", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64((*(this->sharedMemHandle)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("width", ::apache::thrift::protocol::T_I32, 6);
+  xfer += oprot->writeI32((*(this->width)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("height", ::apache::thrift::protocol::T_I32, 7);
+  xfer += oprot->writeI32((*(this->height)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("frameSeq", ::apache::thrift::protocol::T_I64, 8);
+  xfer += oprot->writeI64((*(this->frameSeq)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
 ClientHandlers_LifeSpanHandler_OnBeforePopup_args::~ClientHandlers_LifeSpanHandler_OnBeforePopup_args() noexcept {
 }
 
@@ -5499,14 +5690,14 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSendCookie_args::read(::apache::th
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cookie.clear();
-            uint32_t _size6;
-            ::apache::thrift::protocol::TType _etype9;
-            xfer += iprot->readListBegin(_etype9, _size6);
-            this->cookie.resize(_size6);
-            uint32_t _i10;
-            for (_i10 = 0; _i10 < _size6; ++_i10)
+            uint32_t _size0;
+            ::apache::thrift::protocol::TType _etype3;
+            xfer += iprot->readListBegin(_etype3, _size0);
+            this->cookie.resize(_size0);
+            uint32_t _i4;
+            for (_i4 = 0; _i4 < _size0; ++_i4)
             {
-              xfer += iprot->readString(this->cookie[_i10]);
+              xfer += iprot->readString(this->cookie[_i4]);
             }
             xfer += iprot->readListEnd();
           }
@@ -5547,10 +5738,10 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSendCookie_args::write(::apache::t
   xfer += oprot->writeFieldBegin("cookie", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->cookie.size()));
-    std::vector<std::string> ::const_iterator _iter11;
-    for (_iter11 = this->cookie.begin(); _iter11 != this->cookie.end(); ++_iter11)
+    std::vector<std::string> ::const_iterator _iter5;
+    for (_iter5 = this->cookie.begin(); _iter5 != this->cookie.end(); ++_iter5)
     {
-      xfer += oprot->writeString((*_iter11));
+      xfer += oprot->writeString((*_iter5));
     }
     xfer += oprot->writeListEnd();
   }
@@ -5586,10 +5777,10 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSendCookie_pargs::write(::apache::
   xfer += oprot->writeFieldBegin("cookie", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->cookie)).size()));
-    std::vector<std::string> ::const_iterator _iter12;
-    for (_iter12 = (*(this->cookie)).begin(); _iter12 != (*(this->cookie)).end(); ++_iter12)
+    std::vector<std::string> ::const_iterator _iter6;
+    for (_iter6 = (*(this->cookie)).begin(); _iter6 != (*(this->cookie)).end(); ++_iter6)
     {
-      xfer += oprot->writeString((*_iter12));
+      xfer += oprot->writeString((*_iter6));
     }
     xfer += oprot->writeListEnd();
   }
@@ -5770,14 +5961,14 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSaveCookie_args::read(::apache::th
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cookie.clear();
-            uint32_t _size13;
-            ::apache::thrift::protocol::TType _etype16;
-            xfer += iprot->readListBegin(_etype16, _size13);
-            this->cookie.resize(_size13);
-            uint32_t _i17;
-            for (_i17 = 0; _i17 < _size13; ++_i17)
+            uint32_t _size7;
+            ::apache::thrift::protocol::TType _etype10;
+            xfer += iprot->readListBegin(_etype10, _size7);
+            this->cookie.resize(_size7);
+            uint32_t _i11;
+            for (_i11 = 0; _i11 < _size7; ++_i11)
             {
-              xfer += iprot->readString(this->cookie[_i17]);
+              xfer += iprot->readString(this->cookie[_i11]);
             }
             xfer += iprot->readListEnd();
           }
@@ -5822,10 +6013,10 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSaveCookie_args::write(::apache::t
   xfer += oprot->writeFieldBegin("cookie", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->cookie.size()));
-    std::vector<std::string> ::const_iterator _iter18;
-    for (_iter18 = this->cookie.begin(); _iter18 != this->cookie.end(); ++_iter18)
+    std::vector<std::string> ::const_iterator _iter12;
+    for (_iter12 = this->cookie.begin(); _iter12 != this->cookie.end(); ++_iter12)
     {
-      xfer += oprot->writeString((*_iter18));
+      xfer += oprot->writeString((*_iter12));
     }
     xfer += oprot->writeListEnd();
   }
@@ -5865,10 +6056,10 @@ uint32_t ClientHandlers_CookieAccessFilter_CanSaveCookie_pargs::write(::apache::
   xfer += oprot->writeFieldBegin("cookie", ::apache::thrift::protocol::T_LIST, 5);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->cookie)).size()));
-    std::vector<std::string> ::const_iterator _iter19;
-    for (_iter19 = (*(this->cookie)).begin(); _iter19 != (*(this->cookie)).end(); ++_iter19)
+    std::vector<std::string> ::const_iterator _iter13;
+    for (_iter13 = (*(this->cookie)).begin(); _iter13 != (*(this->cookie)).end(); ++_iter13)
     {
-      xfer += oprot->writeString((*_iter19));
+      xfer += oprot->writeString((*_iter13));
     }
     xfer += oprot->writeListEnd();
   }
@@ -7038,11 +7229,262 @@ uint32_t ClientHandlers_ResourceHandler_ReadResponse_pargs::write(::apache::thri
 }
 
 
-ClientHandlers_ResourceHandler_ReadResponse_result::~ClientHandlers_ResourceHandler_ReadResponse_result() noexcept {
+ClientHandlers_ResourceHandler_ReadResponse_result::~ClientHandlers_ResourceHandler_ReadResponse_result() noexcept {
+}
+
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("ClientHandlers_ResourceHandler_ReadResponse_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+ClientHandlers_ResourceHandler_ReadResponse_presult::~ClientHandlers_ResourceHandler_ReadResponse_presult() noexcept {
+}
+
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponse_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+ClientHandlers_ResourceHandler_ReadResponseShared_args::~ClientHandlers_ResourceHandler_ReadResponseShared_args() noexcept {
+}
+
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->resourceHandler);
+          this->__isset.resourceHandler = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bytes_to_read);
+          this->__isset.bytes_to_read = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->callback.read(iprot);
+          this->__isset.callback = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->sharedMemName);
+          this->__isset.sharedMemName = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->sharedMemHandle);
+          this->__isset.sharedMemHandle = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ClientHandlers_ResourceHandler_ReadResponseShared_args");
+
+  xfer += oprot->writeFieldBegin("resourceHandler", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->resourceHandler);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("bytes_to_read", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->bytes_to_read);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("callback", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += this->callback.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemName", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString(this->sharedMemName);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemHandle", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->sharedMemHandle);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+ClientHandlers_ResourceHandler_ReadResponseShared_pargs::~ClientHandlers_ResourceHandler_ReadResponseShared_pargs() noexcept {
+}
+
+
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ClientHandlers_ResourceHandler_ReadResponseShared_pargs");
+
+  xfer += oprot->writeFieldBegin("resourceHandler", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((*(this->resourceHandler)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("bytes_to_read", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32((*(this->bytes_to_read)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("callback", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += (*(this->callback)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemName", ::apache::thrift::protocol::T_STRING, 4);
+  xfer += oprot->writeString((*(this->sharedMemName)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("sharedMemHandle", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64((*(this->sharedMemHandle)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+ClientHandlers_ResourceHandler_ReadResponseShared_result::~ClientHandlers_ResourceHandler_ReadResponseShared_result() noexcept {
 }
 
 
-uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_result::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -7083,11 +7525,11 @@ uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::read(::apache::thri
   return xfer;
 }
 
-uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
 
   uint32_t xfer = 0;
 
-  xfer += oprot->writeStructBegin("ClientHandlers_ResourceHandler_ReadResponse_result");
+  xfer += oprot->writeStructBegin("ClientHandlers_ResourceHandler_ReadResponseShared_result");
 
   if (this->__isset.success) {
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
@@ -7100,11 +7542,11 @@ uint32_t ClientHandlers_ResourceHandler_ReadResponse_result::write(::apache::thr
 }
 
 
-ClientHandlers_ResourceHandler_ReadResponse_presult::~ClientHandlers_ResourceHandler_ReadResponse_presult() noexcept {
+ClientHandlers_ResourceHandler_ReadResponseShared_presult::~ClientHandlers_ResourceHandler_ReadResponseShared_presult() noexcept {
 }
 
 
-uint32_t ClientHandlers_ResourceHandler_ReadResponse_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ClientHandlers_ResourceHandler_ReadResponseShared_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -8732,7 +9174,7 @@ void ClientHandlersClient::send_AppHandler_OnContextInitialized()
   oprot_->getTransport()->flush();
 }
 
-void ClientHandlersClient::RenderHandler_GetViewRect(Rect& _return, const int32_t bid)
+void ClientHandlersClient::RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid)
 {
   send_RenderHandler_GetViewRect(bid);
   recv_RenderHandler_GetViewRect(_return);
@@ -8752,7 +9194,7 @@ void ClientHandlersClient::send_RenderHandler_GetViewRect(const int32_t bid)
   oprot_->getTransport()->flush();
 }
 
-void ClientHandlersClient::recv_RenderHandler_GetViewRect(Rect& _return)
+void ClientHandlersClient::recv_RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return)
 {
 
   int32_t rseqid = 0;
@@ -8790,7 +9232,7 @@ void ClientHandlersClient::recv_RenderHandler_GetViewRect(Rect& _return)
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "RenderHandler_GetViewRect failed: unknown result");
 }
 
-void ClientHandlersClient::RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid)
+void ClientHandlersClient::RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid)
 {
   send_RenderHandler_GetScreenInfo(bid);
   recv_RenderHandler_GetScreenInfo(_return);
@@ -8810,7 +9252,7 @@ void ClientHandlersClient::send_RenderHandler_GetScreenInfo(const int32_t bid)
   oprot_->getTransport()->flush();
 }
 
-void ClientHandlersClient::recv_RenderHandler_GetScreenInfo(ScreenInfo& _return)
+void ClientHandlersClient::recv_RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return)
 {
 
   int32_t rseqid = 0;
@@ -8848,7 +9290,7 @@ void ClientHandlersClient::recv_RenderHandler_GetScreenInfo(ScreenInfo& _return)
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "RenderHandler_GetScreenInfo failed: unknown result");
 }
 
-void ClientHandlersClient::RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY)
+void ClientHandlersClient::RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY)
 {
   send_RenderHandler_GetScreenPoint(bid, viewX, viewY);
   recv_RenderHandler_GetScreenPoint(_return);
@@ -8870,7 +9312,7 @@ void ClientHandlersClient::send_RenderHandler_GetScreenPoint(const int32_t bid,
   oprot_->getTransport()->flush();
 }
 
-void ClientHandlersClient::recv_RenderHandler_GetScreenPoint(Point& _return)
+void ClientHandlersClient::recv_RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return)
 {
 
   int32_t rseqid = 0;
@@ -8967,6 +9409,32 @@ void ClientHandlersClient::recv_RenderHandler_OnPaint()
   return;
 }
 
+void ClientHandlersClient::RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq)
+{
+  send_RenderHandler_OnPaintAsync(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+}
+
+void ClientHandlersClient::send_RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("RenderHandler_OnPaintAsync", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  ClientHandlers_RenderHandler_OnPaintAsync_pargs args;
+  args.bid = &bid;
+  args.popup = &popup;
+  args.dirtyRectsCount = &dirtyRectsCount;
+  args.sharedMemName = &sharedMemName;
+  args.sharedMemHandle = &sharedMemHandle;
+  args.width = &width;
+  args.height = &height;
+  args.frameSeq = &frameSeq;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
 bool ClientHandlersClient::LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture)
 {
   send_LifeSpanHandler_OnBeforePopup(bid, url, frameName, gesture);
@@ -10475,6 +10943,68 @@ void ClientHandlersClient::recv_ResourceHandler_ReadResponse( ::thrift_codegen::
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ResourceHandler_ReadResponse failed: unknown result");
 }
 
+void ClientHandlersClient::ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle)
+{
+  send_ResourceHandler_ReadResponseShared(resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle);
+  recv_ResourceHandler_ReadResponseShared(_return);
+}
+
+void ClientHandlersClient::send_ResourceHandler_ReadResponseShared(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("ResourceHandler_ReadResponseShared", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_pargs args;
+  args.resourceHandler = &resourceHandler;
+  args.bytes_to_read = &bytes_to_read;
+  args.callback = &callback;
+  args.sharedMemName = &sharedMemName;
+  args.sharedMemHandle = &sharedMemHandle;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void ClientHandlersClient::recv_ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("ResourceHandler_ReadResponseShared") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  ClientHandlers_ResourceHandler_ReadResponseShared_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ResourceHandler_ReadResponseShared failed: unknown result");
+}
+
 void ClientHandlersClient::ResourceHandler_Cancel(const int32_t resourceHandler)
 {
   send_ResourceHandler_Cancel(resourceHandler);
@@ -11201,6 +11731,43 @@ void ClientHandlersProcessor::process_RenderHandler_OnPaint(int32_t seqid, ::apa
   }
 }
 
+void ClientHandlersProcessor::process_RenderHandler_OnPaintAsync(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("ClientHandlers.RenderHandler_OnPaintAsync", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "ClientHandlers.RenderHandler_OnPaintAsync");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "ClientHandlers.RenderHandler_OnPaintAsync");
+  }
+
+  ClientHandlers_RenderHandler_OnPaintAsync_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "ClientHandlers.RenderHandler_OnPaintAsync", bytes);
+  }
+
+  try {
+    iface_->RenderHandler_OnPaintAsync(args.bid, args.popup, args.dirtyRectsCount, args.sharedMemName, args.sharedMemHandle, args.width, args.height, args.frameSeq);
+  } catch (const std::exception&) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "ClientHandlers.RenderHandler_OnPaintAsync");
+    }
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->asyncComplete(ctx, "ClientHandlers.RenderHandler_OnPaintAsync");
+  }
+
+  return;
+}
+
 void ClientHandlersProcessor::process_LifeSpanHandler_OnBeforePopup(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = nullptr;
@@ -12836,6 +13403,60 @@ void ClientHandlersProcessor::process_ResourceHandler_ReadResponse(int32_t seqid
   }
 }
 
+void ClientHandlersProcessor::process_ResourceHandler_ReadResponseShared(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("ClientHandlers.ResourceHandler_ReadResponseShared", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "ClientHandlers.ResourceHandler_ReadResponseShared");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "ClientHandlers.ResourceHandler_ReadResponseShared");
+  }
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "ClientHandlers.ResourceHandler_ReadResponseShared", bytes);
+  }
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_result result;
+  try {
+    iface_->ResourceHandler_ReadResponseShared(result.success, args.resourceHandler, args.bytes_to_read, args.callback, args.sharedMemName, args.sharedMemHandle);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "ClientHandlers.ResourceHandler_ReadResponseShared");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("ResourceHandler_ReadResponseShared", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "ClientHandlers.ResourceHandler_ReadResponseShared");
+  }
+
+  oprot->writeMessageBegin("ResourceHandler_ReadResponseShared", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "ClientHandlers.ResourceHandler_ReadResponseShared", bytes);
+  }
+}
+
 void ClientHandlersProcessor::process_ResourceHandler_Cancel(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
 {
   void* ctx = nullptr;
@@ -13349,7 +13970,7 @@ void ClientHandlersConcurrentClient::send_AppHandler_OnContextInitialized()
   sentry.commit();
 }
 
-void ClientHandlersConcurrentClient::RenderHandler_GetViewRect(Rect& _return, const int32_t bid)
+void ClientHandlersConcurrentClient::RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid)
 {
   int32_t seqid = send_RenderHandler_GetViewRect(bid);
   recv_RenderHandler_GetViewRect(_return, seqid);
@@ -13373,7 +13994,7 @@ int32_t ClientHandlersConcurrentClient::send_RenderHandler_GetViewRect(const int
   return cseqid;
 }
 
-void ClientHandlersConcurrentClient::recv_RenderHandler_GetViewRect(Rect& _return, const int32_t seqid)
+void ClientHandlersConcurrentClient::recv_RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -13433,7 +14054,7 @@ void ClientHandlersConcurrentClient::recv_RenderHandler_GetViewRect(Rect& _retur
   } // end while(true)
 }
 
-void ClientHandlersConcurrentClient::RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid)
+void ClientHandlersConcurrentClient::RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid)
 {
   int32_t seqid = send_RenderHandler_GetScreenInfo(bid);
   recv_RenderHandler_GetScreenInfo(_return, seqid);
@@ -13457,7 +14078,7 @@ int32_t ClientHandlersConcurrentClient::send_RenderHandler_GetScreenInfo(const i
   return cseqid;
 }
 
-void ClientHandlersConcurrentClient::recv_RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t seqid)
+void ClientHandlersConcurrentClient::recv_RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -13517,7 +14138,7 @@ void ClientHandlersConcurrentClient::recv_RenderHandler_GetScreenInfo(ScreenInfo
   } // end while(true)
 }
 
-void ClientHandlersConcurrentClient::RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY)
+void ClientHandlersConcurrentClient::RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY)
 {
   int32_t seqid = send_RenderHandler_GetScreenPoint(bid, viewX, viewY);
   recv_RenderHandler_GetScreenPoint(_return, seqid);
@@ -13543,7 +14164,7 @@ int32_t ClientHandlersConcurrentClient::send_RenderHandler_GetScreenPoint(const
   return cseqid;
 }
 
-void ClientHandlersConcurrentClient::recv_RenderHandler_GetScreenPoint(Point& _return, const int32_t seqid)
+void ClientHandlersConcurrentClient::recv_RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t seqid)
 {
 
   int32_t rseqid = 0;
@@ -13687,6 +14308,35 @@ void ClientHandlersConcurrentClient::recv_RenderHandler_OnPaint(const int32_t se
   } // end while(true)
 }
 
+void ClientHandlersConcurrentClient::RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq)
+{
+  send_RenderHandler_OnPaintAsync(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+}
+
+void ClientHandlersConcurrentClient::send_RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq)
+{
+  int32_t cseqid = 0;
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("RenderHandler_OnPaintAsync", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  ClientHandlers_RenderHandler_OnPaintAsync_pargs args;
+  args.bid = &bid;
+  args.popup = &popup;
+  args.dirtyRectsCount = &dirtyRectsCount;
+  args.sharedMemName = &sharedMemName;
+  args.sharedMemHandle = &sharedMemHandle;
+  args.width = &width;
+  args.height = &height;
+  args.frameSeq = &frameSeq;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+}
+
 bool ClientHandlersConcurrentClient::LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture)
 {
   int32_t seqid = send_LifeSpanHandler_OnBeforePopup(bid, url, frameName, gesture);
@@ -15760,6 +16410,94 @@ void ClientHandlersConcurrentClient::recv_ResourceHandler_ReadResponse( ::thrift
   } // end while(true)
 }
 
+void ClientHandlersConcurrentClient::ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle)
+{
+  int32_t seqid = send_ResourceHandler_ReadResponseShared(resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle);
+  recv_ResourceHandler_ReadResponseShared(_return, seqid);
+}
+
+int32_t ClientHandlersConcurrentClient::send_ResourceHandler_ReadResponseShared(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("ResourceHandler_ReadResponseShared", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_pargs args;
+  args.resourceHandler = &resourceHandler;
+  args.bytes_to_read = &bytes_to_read;
+  args.callback = &callback;
+  args.sharedMemName = &sharedMemName;
+  args.sharedMemHandle = &sharedMemHandle;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void ClientHandlersConcurrentClient::recv_ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("ResourceHandler_ReadResponseShared") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      ClientHandlers_ResourceHandler_ReadResponseShared_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "ResourceHandler_ReadResponseShared failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 void ClientHandlersConcurrentClient::ResourceHandler_Cancel(const int32_t resourceHandler)
 {
   send_ResourceHandler_Cancel(resourceHandler);
@@ -25,10 +25,11 @@ class ClientHandlersIf {
   virtual int32_t connect() = 0;
   virtual void log(const std::string& msg) = 0;
   virtual void AppHandler_OnContextInitialized() = 0;
-  virtual void RenderHandler_GetViewRect(Rect& _return, const int32_t bid) = 0;
-  virtual void RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid) = 0;
-  virtual void RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) = 0;
+  virtual void RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid) = 0;
+  virtual void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid) = 0;
+  virtual void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) = 0;
   virtual void RenderHandler_OnPaint(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height) = 0;
+  virtual void RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq) = 0;
   virtual bool LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture) = 0;
   virtual void LifeSpanHandler_OnAfterCreated(const int32_t bid, const int32_t nativeBrowserIdentifier) = 0;
   virtual bool LifeSpanHandler_DoClose(const int32_t bid) = 0;
@@ -64,6 +65,7 @@ class ClientHandlersIf {
   virtual bool ResourceHandler_ProcessRequest(const int32_t resourceHandler, const  ::thrift_codegen::RObject& request, const  ::thrift_codegen::RObject& callback) = 0;
   virtual void ResourceHandler_GetResponseHeaders( ::thrift_codegen::ResponseHeaders& _return, const int32_t resourceHandler, const  ::thrift_codegen::RObject& response) = 0;
   virtual void ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback) = 0;
+  virtual void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle) = 0;
   virtual void ResourceHandler_Cancel(const int32_t resourceHandler) = 0;
   virtual void ResourceRequestHandler_OnResourceRedirect(std::string& _return, const int32_t rrHandler, const int32_t bid, const  ::thrift_codegen::RObject& request, const  ::thrift_codegen::RObject& response, const std::string& new_url) = 0;
   virtual bool ResourceRequestHandler_OnResourceResponse(const int32_t rrHandler, const int32_t bid, const  ::thrift_codegen::RObject& request, const  ::thrift_codegen::RObject& response) = 0;
@@ -111,18 +113,21 @@ class ClientHandlersNull : virtual public ClientHandlersIf {
   void AppHandler_OnContextInitialized() override {
     return;
   }
-  void RenderHandler_GetViewRect(Rect& /* _return */, const int32_t /* bid */) override {
+  void RenderHandler_GetViewRect( ::thrift_codegen::Rect& /* _return */, const int32_t /* bid */) override {
     return;
   }
-  void RenderHandler_GetScreenInfo(ScreenInfo& /* _return */, const int32_t /* bid */) override {
+  void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& /* _return */, const int32_t /* bid */) override {
     return;
   }
-  void RenderHandler_GetScreenPoint(Point& /* _return */, const int32_t /* bid */, const int32_t /* viewX */, const int32_t /* viewY */) override {
+  void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& /* _return */, const int32_t /* bid */, const int32_t /* viewX */, const int32_t /* viewY */) override {
     return;
   }
   void RenderHandler_OnPaint(const int32_t /* bid */, const bool /* popup */, const int32_t /* dirtyRectsCount */, const std::string& /* sharedMemName */, const int64_t /* sharedMemHandle */, const int32_t /* width */, const int32_t /* height */) override {
     return;
   }
+  void RenderHandler_OnPaintAsync(const int32_t /* bid */, const bool /* popup */, const int32_t /* dirtyRectsCount */, const std::string& /* sharedMemName */, const int64_t /* sharedMemHandle */, const int32_t /* width */, const int32_t /* height */, const int64_t /* frameSeq */) override {
+    return;
+  }
   bool LifeSpanHandler_OnBeforePopup(const int32_t /* bid */, const std::string& /* url */, const std::string& /* frameName */, const bool /* gesture */) override {
     bool _return = false;
     return _return;
@@ -243,6 +248,9 @@ class ClientHandlersNull : virtual public ClientHandlersIf {
   void ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& /* _return */, const int32_t /* resourceHandler */, const int32_t /* bytes_to_read */, const  ::thrift_codegen::RObject& /* callback */) override {
     return;
   }
+  void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& /* _return */, const int32_t /* resourceHandler */, const int32_t /* bytes_to_read */, const  ::thrift_codegen::RObject& /* callback */, const std::string& /* sharedMemName */, const int64_t /* sharedMemHandle */) override {
+    return;
+  }
   void ResourceHandler_Cancel(const int32_t /* resourceHandler */) override {
     return;
   }
@@ -516,11 +524,11 @@ class ClientHandlers_RenderHandler_GetViewRect_result {
   }
 
   virtual ~ClientHandlers_RenderHandler_GetViewRect_result() noexcept;
-  Rect success;
+   ::thrift_codegen::Rect success;
 
   _ClientHandlers_RenderHandler_GetViewRect_result__isset __isset;
 
-  void __set_success(const Rect& val);
+  void __set_success(const  ::thrift_codegen::Rect& val);
 
   bool operator == (const ClientHandlers_RenderHandler_GetViewRect_result & rhs) const
   {
@@ -549,7 +557,7 @@ class ClientHandlers_RenderHandler_GetViewRect_presult {
 
 
   virtual ~ClientHandlers_RenderHandler_GetViewRect_presult() noexcept;
-  Rect* success;
+   ::thrift_codegen::Rect* success;
 
   _ClientHandlers_RenderHandler_GetViewRect_presult__isset __isset;
 
@@ -621,11 +629,11 @@ class ClientHandlers_RenderHandler_GetScreenInfo_result {
   }
 
   virtual ~ClientHandlers_RenderHandler_GetScreenInfo_result() noexcept;
-  ScreenInfo success;
+   ::thrift_codegen::ScreenInfo success;
 
   _ClientHandlers_RenderHandler_GetScreenInfo_result__isset __isset;
 
-  void __set_success(const ScreenInfo& val);
+  void __set_success(const  ::thrift_codegen::ScreenInfo& val);
 
   bool operator == (const ClientHandlers_RenderHandler_GetScreenInfo_result & rhs) const
   {
@@ -654,7 +662,7 @@ class ClientHandlers_RenderHandler_GetScreenInfo_presult {
 
 
   virtual ~ClientHandlers_RenderHandler_GetScreenInfo_presult() noexcept;
-  ScreenInfo* success;
+   ::thrift_codegen::ScreenInfo* success;
 
   _ClientHandlers_RenderHandler_GetScreenInfo_presult__isset __isset;
 
@@ -742,11 +750,11 @@ class ClientHandlers_RenderHandler_GetScreenPoint_result {
   }
 
   virtual ~ClientHandlers_RenderHandler_GetScreenPoint_result() noexcept;
-  Point success;
+   ::thrift_codegen::Point success;
 
   _ClientHandlers_RenderHandler_GetScreenPoint_result__isset __isset;
 
-  void __set_success(const Point& val);
+  void __set_success(const  ::thrift_codegen::Point& val);
 
   bool operator == (const ClientHandlers_RenderHandler_GetScreenPoint_result & rhs) const
   {
@@ -775,7 +783,7 @@ class ClientHandlers_RenderHandler_GetScreenPoint_presult {
 
 
   virtual ~ClientHandlers_RenderHandler_GetScreenPoint_presult() noexcept;
-  Point* success;
+   ::thrift_codegen::Point* success;
 
   _ClientHandlers_RenderHandler_GetScreenPoint_presult__isset __isset;
 
@@ -918,6 +926,112 @@ class ClientHandlers_RenderHandler_OnPaint_presult {
 
 };
 
+typedef struct _ClientHandlers_RenderHandler_OnPaintAsync_args__isset {
+  _ClientHandlers_RenderHandler_OnPaintAsync_args__isset() : bid(false), popup(false), dirtyRectsCount(false), sharedMemName(false), sharedMemHandle(false), width(false), height(false), frameSeq(false) {}
+  bool bid :1;
+  bool popup :1;
+  bool dirtyRectsCount :1;
+  bool sharedMemName :1;
+  bool sharedMemHandle :1;
+  bool width :1;
+  bool height :1;
+  bool frameSeq :1;
+} _ClientHandlers_RenderHandler_OnPaintAsync_args__isset;
+
+class ClientHandlers_RenderHandler_OnPaintAsync_args {
+ public:
+
+  ClientHandlers_RenderHandler_OnPaintAsync_args(const ClientHandlers_RenderHandler_OnPaintAsync_args&);
+  ClientHandlers_RenderHandler_OnPaintAsync_args& operator=(const ClientHandlers_RenderHandler_OnPaintAsync_args&);
+  ClientHandlers_RenderHandler_OnPaintAsync_args() noexcept
+                                                 : bid(0),
+                                                   popup(0),
+                                                   dirtyRectsCount(0),
+                                                   sharedMemName(),
+                                                   sharedMemHandle(0),
+                                                   width(0),
+                                                   height(0),
+                                                   frameSeq(0) {
+  }
+
+  virtual ~ClientHandlers_RenderHandler_OnPaintAsync_args() noexcept;
+  int32_t bid;
+  bool popup;
+  int32_t dirtyRectsCount;
+  std::string sharedMemName;
+  int64_t sharedMemHandle;
+  int32_t width;
+  int32_t height;
+  int64_t frameSeq;
+
+  _ClientHandlers_RenderHandler_OnPaintAsync_args__isset __isset;
+
+  void __set_bid(const int32_t val);
+
+  void __set_popup(const bool val);
+
+  void __set_dirtyRectsCount(const int32_t val);
+
+  void __set_sharedMemName(const std::string& val);
+
+  void __set_sharedMemHandle(const int64_t val);
+
+  void __set_width(const int32_t val);
+
+  void __set_height(const int32_t val);
+
+  void __set_frameSeq(const int64_t val);
+
+  bool operator == (const ClientHandlers_RenderHandler_OnPaintAsync_args & rhs) const
+  {
+    if (!(bid == rhs.bid))
+      return false;
+    if (!(popup == rhs.popup))
+      return false;
+    if (!(dirtyRectsCount == rhs.dirtyRectsCount))
+      return false;
+    if (!(sharedMemName == rhs.sharedMemName))
+      return false;
+    if (!(sharedMemHandle == rhs.sharedMemHandle))
+      return false;
+    if (!(width == rhs.width))
+      return false;
+    if (!(height == rhs.height))
+      return false;
+    if (!(frameSeq == rhs.frameSeq))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientHandlers_RenderHandler_OnPaintAsync_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientHandlers_RenderHandler_OnPaintAsync_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class ClientHandlers_RenderHandler_OnPaintAsync_pargs {
+ public:
+
+
+  virtual ~ClientHandlers_RenderHandler_OnPaintAsync_pargs() noexcept;
+  const int32_t* bid;
+  const bool* popup;
+  const int32_t* dirtyRectsCount;
+  const std::string* sharedMemName;
+  const int64_t* sharedMemHandle;
+  const int32_t* width;
+  const int32_t* height;
+  const int64_t* frameSeq;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
 typedef struct _ClientHandlers_LifeSpanHandler_OnBeforePopup_args__isset {
   _ClientHandlers_LifeSpanHandler_OnBeforePopup_args__isset() : bid(false), url(false), frameName(false), gesture(false) {}
   bool bid :1;
@@ -4269,6 +4383,142 @@ class ClientHandlers_ResourceHandler_ReadResponse_presult {
 
 };
 
+typedef struct _ClientHandlers_ResourceHandler_ReadResponseShared_args__isset {
+  _ClientHandlers_ResourceHandler_ReadResponseShared_args__isset() : resourceHandler(false), bytes_to_read(false), callback(false), sharedMemName(false), sharedMemHandle(false) {}
+  bool resourceHandler :1;
+  bool bytes_to_read :1;
+  bool callback :1;
+  bool sharedMemName :1;
+  bool sharedMemHandle :1;
+} _ClientHandlers_ResourceHandler_ReadResponseShared_args__isset;
+
+class ClientHandlers_ResourceHandler_ReadResponseShared_args {
+ public:
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_args(const ClientHandlers_ResourceHandler_ReadResponseShared_args&);
+  ClientHandlers_ResourceHandler_ReadResponseShared_args& operator=(const ClientHandlers_ResourceHandler_ReadResponseShared_args&);
+  ClientHandlers_ResourceHandler_ReadResponseShared_args() noexcept
+                                                         : resourceHandler(0),
+                                                           bytes_to_read(0),
+                                                           sharedMemName(),
+                                                           sharedMemHandle(0) {
+  }
+
+  virtual ~ClientHandlers_ResourceHandler_ReadResponseShared_args() noexcept;
+  int32_t resourceHandler;
+  int32_t bytes_to_read;
+   ::thrift_codegen::RObject callback;
+  std::string sharedMemName;
+  int64_t sharedMemHandle;
+
+  _ClientHandlers_ResourceHandler_ReadResponseShared_args__isset __isset;
+
+  void __set_resourceHandler(const int32_t val);
+
+  void __set_bytes_to_read(const int32_t val);
+
+  void __set_callback(const  ::thrift_codegen::RObject& val);
+
+  void __set_sharedMemName(const std::string& val);
+
+  void __set_sharedMemHandle(const int64_t val);
+
+  bool operator == (const ClientHandlers_ResourceHandler_ReadResponseShared_args & rhs) const
+  {
+    if (!(resourceHandler == rhs.resourceHandler))
+      return false;
+    if (!(bytes_to_read == rhs.bytes_to_read))
+      return false;
+    if (!(callback == rhs.callback))
+      return false;
+    if (!(sharedMemName == rhs.sharedMemName))
+      return false;
+    if (!(sharedMemHandle == rhs.sharedMemHandle))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientHandlers_ResourceHandler_ReadResponseShared_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientHandlers_ResourceHandler_ReadResponseShared_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class ClientHandlers_ResourceHandler_ReadResponseShared_pargs {
+ public:
+
+
+  virtual ~ClientHandlers_ResourceHandler_ReadResponseShared_pargs() noexcept;
+  const int32_t* resourceHandler;
+  const int32_t* bytes_to_read;
+  const  ::thrift_codegen::RObject* callback;
+  const std::string* sharedMemName;
+  const int64_t* sharedMemHandle;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientHandlers_ResourceHandler_ReadResponseShared_result__isset {
+  _ClientHandlers_ResourceHandler_ReadResponseShared_result__isset() : success(false) {}
+  bool success :1;
+} _ClientHandlers_ResourceHandler_ReadResponseShared_result__isset;
+
+class ClientHandlers_ResourceHandler_ReadResponseShared_result {
+ public:
+
+  ClientHandlers_ResourceHandler_ReadResponseShared_result(const ClientHandlers_ResourceHandler_ReadResponseShared_result&);
+  ClientHandlers_ResourceHandler_ReadResponseShared_result& operator=(const ClientHandlers_ResourceHandler_ReadResponseShared_result&);
+  ClientHandlers_ResourceHandler_ReadResponseShared_result() noexcept {
+  }
+
+  virtual ~ClientHandlers_ResourceHandler_ReadResponseShared_result() noexcept;
+   ::thrift_codegen::ResponseData success;
+
+  _ClientHandlers_ResourceHandler_ReadResponseShared_result__isset __isset;
+
+  void __set_success(const  ::thrift_codegen::ResponseData& val);
+
+  bool operator == (const ClientHandlers_ResourceHandler_ReadResponseShared_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientHandlers_ResourceHandler_ReadResponseShared_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientHandlers_ResourceHandler_ReadResponseShared_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientHandlers_ResourceHandler_ReadResponseShared_presult__isset {
+  _ClientHandlers_ResourceHandler_ReadResponseShared_presult__isset() : success(false) {}
+  bool success :1;
+} _ClientHandlers_ResourceHandler_ReadResponseShared_presult__isset;
+
+class ClientHandlers_ResourceHandler_ReadResponseShared_presult {
+ public:
+
+
+  virtual ~ClientHandlers_ResourceHandler_ReadResponseShared_presult() noexcept;
+   ::thrift_codegen::ResponseData* success;
+
+  _ClientHandlers_ResourceHandler_ReadResponseShared_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _ClientHandlers_ResourceHandler_Cancel_args__isset {
   _ClientHandlers_ResourceHandler_Cancel_args__isset() : resourceHandler(false) {}
   bool resourceHandler :1;
@@ -5128,18 +5378,20 @@ class ClientHandlersClient : virtual public ClientHandlersIf {
   void send_log(const std::string& msg);
   void AppHandler_OnContextInitialized() override;
   void send_AppHandler_OnContextInitialized();
-  void RenderHandler_GetViewRect(Rect& _return, const int32_t bid) override;
+  void RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid) override;
   void send_RenderHandler_GetViewRect(const int32_t bid);
-  void recv_RenderHandler_GetViewRect(Rect& _return);
-  void RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid) override;
+  void recv_RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return);
+  void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid) override;
   void send_RenderHandler_GetScreenInfo(const int32_t bid);
-  void recv_RenderHandler_GetScreenInfo(ScreenInfo& _return);
-  void RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override;
+  void recv_RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return);
+  void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override;
   void send_RenderHandler_GetScreenPoint(const int32_t bid, const int32_t viewX, const int32_t viewY);
-  void recv_RenderHandler_GetScreenPoint(Point& _return);
+  void recv_RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return);
   void RenderHandler_OnPaint(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height) override;
   void send_RenderHandler_OnPaint(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height);
   void recv_RenderHandler_OnPaint();
+  void RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq) override;
+  void send_RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq);
   bool LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture) override;
   void send_LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture);
   bool recv_LifeSpanHandler_OnBeforePopup();
@@ -5230,6 +5482,9 @@ class ClientHandlersClient : virtual public ClientHandlersIf {
   void ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback) override;
   void send_ResourceHandler_ReadResponse(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback);
   void recv_ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& _return);
+  void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle) override;
+  void send_ResourceHandler_ReadResponseShared(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle);
+  void recv_ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return);
   void ResourceHandler_Cancel(const int32_t resourceHandler) override;
   void send_ResourceHandler_Cancel(const int32_t resourceHandler);
   void ResourceRequestHandler_OnResourceRedirect(std::string& _return, const int32_t rrHandler, const int32_t bid, const  ::thrift_codegen::RObject& request, const  ::thrift_codegen::RObject& response, const std::string& new_url) override;
@@ -5273,6 +5528,7 @@ class ClientHandlersProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_RenderHandler_GetScreenInfo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_RenderHandler_GetScreenPoint(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_RenderHandler_OnPaint(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_RenderHandler_OnPaintAsync(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_LifeSpanHandler_OnBeforePopup(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_LifeSpanHandler_OnAfterCreated(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_LifeSpanHandler_DoClose(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -5308,6 +5564,7 @@ class ClientHandlersProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_ResourceHandler_ProcessRequest(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ResourceHandler_GetResponseHeaders(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ResourceHandler_ReadResponse(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ResourceHandler_ReadResponseShared(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ResourceHandler_Cancel(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ResourceRequestHandler_OnResourceRedirect(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_ResourceRequestHandler_OnResourceResponse(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -5326,6 +5583,7 @@ class ClientHandlersProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["RenderHandler_GetScreenInfo"] = &ClientHandlersProcessor::process_RenderHandler_GetScreenInfo;
     processMap_["RenderHandler_GetScreenPoint"] = &ClientHandlersProcessor::process_RenderHandler_GetScreenPoint;
     processMap_["RenderHandler_OnPaint"] = &ClientHandlersProcessor::process_RenderHandler_OnPaint;
+    processMap_["RenderHandler_OnPaintAsync"] = &ClientHandlersProcessor::process_RenderHandler_OnPaintAsync;
     processMap_["LifeSpanHandler_OnBeforePopup"] = &ClientHandlersProcessor::process_LifeSpanHandler_OnBeforePopup;
     processMap_["LifeSpanHandler_OnAfterCreated"] = &ClientHandlersProcessor::process_LifeSpanHandler_OnAfterCreated;
     processMap_["LifeSpanHandler_DoClose"] = &ClientHandlersProcessor::process_LifeSpanHandler_DoClose;
@@ -5361,6 +5619,7 @@ class ClientHandlersProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["ResourceHandler_ProcessRequest"] = &ClientHandlersProcessor::process_ResourceHandler_ProcessRequest;
     processMap_["ResourceHandler_GetResponseHeaders"] = &ClientHandlersProcessor::process_ResourceHandler_GetResponseHeaders;
     processMap_["ResourceHandler_ReadResponse"] = &ClientHandlersProcessor::process_ResourceHandler_ReadResponse;
+    processMap_["ResourceHandler_ReadResponseShared"] = &ClientHandlersProcessor::process_ResourceHandler_ReadResponseShared;
     processMap_["ResourceHandler_Cancel"] = &ClientHandlersProcessor::process_ResourceHandler_Cancel;
     processMap_["ResourceRequestHandler_OnResourceRedirect"] = &ClientHandlersProcessor::process_ResourceRequestHandler_OnResourceRedirect;
     processMap_["ResourceRequestHandler_OnResourceResponse"] = &ClientHandlersProcessor::process_ResourceRequestHandler_OnResourceResponse;
@@ -5424,7 +5683,7 @@ class ClientHandlersMultiface : virtual public ClientHandlersIf {
     ifaces_[i]->AppHandler_OnContextInitialized();
   }
 
-  void RenderHandler_GetViewRect(Rect& _return, const int32_t bid) override {
+  void RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
@@ -5434,7 +5693,7 @@ class ClientHandlersMultiface : virtual public ClientHandlersIf {
     return;
   }
 
-  void RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid) override {
+  void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
@@ -5444,7 +5703,7 @@ class ClientHandlersMultiface : virtual public ClientHandlersIf {
     return;
   }
 
-  void RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override {
+  void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
     for (; i < (sz - 1); ++i) {
@@ -5463,6 +5722,15 @@ class ClientHandlersMultiface : virtual public ClientHandlersIf {
     ifaces_[i]->RenderHandler_OnPaint(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height);
   }
 
+  void RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->RenderHandler_OnPaintAsync(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+    }
+    ifaces_[i]->RenderHandler_OnPaintAsync(bid, popup, dirtyRectsCount, sharedMemName, sharedMemHandle, width, height, frameSeq);
+  }
+
   bool LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -5783,6 +6051,16 @@ class ClientHandlersMultiface : virtual public ClientHandlersIf {
     return;
   }
 
+  void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ResourceHandler_ReadResponseShared(_return, resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle);
+    }
+    ifaces_[i]->ResourceHandler_ReadResponseShared(_return, resourceHandler, bytes_to_read, callback, sharedMemName, sharedMemHandle);
+    return;
+  }
+
   void ResourceHandler_Cancel(const int32_t resourceHandler) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -5895,18 +6173,20 @@ class ClientHandlersConcurrentClient : virtual public ClientHandlersIf {
   void send_log(const std::string& msg);
   void AppHandler_OnContextInitialized() override;
   void send_AppHandler_OnContextInitialized();
-  void RenderHandler_GetViewRect(Rect& _return, const int32_t bid) override;
+  void RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid) override;
   int32_t send_RenderHandler_GetViewRect(const int32_t bid);
-  void recv_RenderHandler_GetViewRect(Rect& _return, const int32_t seqid);
-  void RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid) override;
+  void recv_RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t seqid);
+  void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid) override;
   int32_t send_RenderHandler_GetScreenInfo(const int32_t bid);
-  void recv_RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t seqid);
-  void RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override;
+  void recv_RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t seqid);
+  void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) override;
   int32_t send_RenderHandler_GetScreenPoint(const int32_t bid, const int32_t viewX, const int32_t viewY);
-  void recv_RenderHandler_GetScreenPoint(Point& _return, const int32_t seqid);
+  void recv_RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t seqid);
   void RenderHandler_OnPaint(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height) override;
   int32_t send_RenderHandler_OnPaint(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height);
   void recv_RenderHandler_OnPaint(const int32_t seqid);
+  void RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq) override;
+  void send_RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq);
   bool LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture) override;
   int32_t send_LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture);
   bool recv_LifeSpanHandler_OnBeforePopup(const int32_t seqid);
@@ -5997,6 +6277,9 @@ class ClientHandlersConcurrentClient : virtual public ClientHandlersIf {
   void ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback) override;
   int32_t send_ResourceHandler_ReadResponse(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback);
   void recv_ResourceHandler_ReadResponse( ::thrift_codegen::ResponseData& _return, const int32_t seqid);
+  void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle) override;
+  int32_t send_ResourceHandler_ReadResponseShared(const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle);
+  void recv_ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t seqid);
   void ResourceHandler_Cancel(const int32_t resourceHandler) override;
   void send_ResourceHandler_Cancel(const int32_t resourceHandler);
   void ResourceRequestHandler_OnResourceRedirect(std::string& _return, const int32_t rrHandler, const int32_t bid, const  ::thrift_codegen::RObject& request, const  ::thrift_codegen::RObject& response, const std::string& new_url) override;
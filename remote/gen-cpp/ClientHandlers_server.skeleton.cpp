@@ -35,17 +35,17 @@ class ClientHandlersHandler : virtual public ClientHandlersIf {
     printf("AppHandler_OnContextInitialized\n");
   }
 
-  void RenderHandler_GetViewRect(Rect& _return, const int32_t bid) {
+  void RenderHandler_GetViewRect( ::thrift_codegen::Rect& _return, const int32_t bid) {
     // Your implementation goes here
     printf("RenderHandler_GetViewRect\n");
   }
 
-  void RenderHandler_GetScreenInfo(ScreenInfo& _return, const int32_t bid) {
+  void RenderHandler_GetScreenInfo( ::thrift_codegen::ScreenInfo& _return, const int32_t bid) {
     // Your implementation goes here
     printf("RenderHandler_GetScreenInfo\n");
   }
 
-  void RenderHandler_GetScreenPoint(Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) {
+  void RenderHandler_GetScreenPoint( ::thrift_codegen::Point& _return, const int32_t bid, const int32_t viewX, const int32_t viewY) {
     // Your implementation goes here
     printf("RenderHandler_GetScreenPoint\n");
   }
@@ -55,6 +55,11 @@ class ClientHandlersHandler : virtual public ClientHandlersIf {
     printf("RenderHandler_OnPaint\n");
   }
 
+  void RenderHandler_OnPaintAsync(const int32_t bid, const bool popup, const int32_t dirtyRectsCount, const std::string& sharedMemName, const int64_t sharedMemHandle, const int32_t width, const int32_t height, const int64_t frameSeq) {
+    // Your implementation goes here
+    printf("RenderHandler_OnPaintAsync\n");
+  }
+
   bool LifeSpanHandler_OnBeforePopup(const int32_t bid, const std::string& url, const std::string& frameName, const bool gesture) {
     // Your implementation goes here
     printf("LifeSpanHandler_OnBeforePopup\n");
@@ -230,6 +235,11 @@ class ClientHandlersHandler : virtual public ClientHandlersIf {
     printf("ResourceHandler_ReadResponse\n");
   }
 
+  void ResourceHandler_ReadResponseShared( ::thrift_codegen::ResponseData& _return, const int32_t resourceHandler, const int32_t bytes_to_read, const  ::thrift_codegen::RObject& callback, const std::string& sharedMemName, const int64_t sharedMemHandle) {
+    // Your implementation goes here
+    printf("ResourceHandler_ReadResponseShared\n");
+  }
+
   void ResourceHandler_Cancel(const int32_t resourceHandler) {
     // Your implementation goes here
     printf("ResourceHandler_Cancel\n");
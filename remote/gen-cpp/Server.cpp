@@ -1013,6 +1013,172 @@ uint32_t Server_state_presult::read(::apache::thrift::protocol::TProtocol* iprot
 }
 
 
+Server_metrics_args::~Server_metrics_args() noexcept {
+}
+
+
+uint32_t Server_metrics_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    xfer += iprot->skip(ftype);
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Server_metrics_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_metrics_args");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_metrics_pargs::~Server_metrics_pargs() noexcept {
+}
+
+
+uint32_t Server_metrics_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_metrics_pargs");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_metrics_result::~Server_metrics_result() noexcept {
+}
+
+
+uint32_t Server_metrics_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->success.read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Server_metrics_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("Server_metrics_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_STRUCT, 0);
+    xfer += this->success.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_metrics_presult::~Server_metrics_presult() noexcept {
+}
+
+
+uint32_t Server_metrics_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += (*(this->success)).read(iprot);
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
 Server_stop_args::~Server_stop_args() noexcept {
 }
 
@@ -2173,6 +2339,272 @@ uint32_t Server_Browser_NotifyScreenInfoChanged_pargs::write(::apache::thrift::p
 }
 
 
+Server_Browser_SetViewGeometry_args::~Server_Browser_SetViewGeometry_args() noexcept {
+}
+
+
+uint32_t Server_Browser_SetViewGeometry_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bid);
+          this->__isset.bid = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->viewRect.read(iprot);
+          this->__isset.viewRect = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->screenInfo.read(iprot);
+          this->__isset.screenInfo = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->screenPoint0.read(iprot);
+          this->__isset.screenPoint0 = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->screenPoint100.read(iprot);
+          this->__isset.screenPoint100 = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Server_Browser_SetViewGeometry_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_Browser_SetViewGeometry_args");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->bid);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("viewRect", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += this->viewRect.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenInfo", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += this->screenInfo.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenPoint0", ::apache::thrift::protocol::T_STRUCT, 4);
+  xfer += this->screenPoint0.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenPoint100", ::apache::thrift::protocol::T_STRUCT, 5);
+  xfer += this->screenPoint100.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_Browser_SetViewGeometry_pargs::~Server_Browser_SetViewGeometry_pargs() noexcept {
+}
+
+
+uint32_t Server_Browser_SetViewGeometry_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_Browser_SetViewGeometry_pargs");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((*(this->bid)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("viewRect", ::apache::thrift::protocol::T_STRUCT, 2);
+  xfer += (*(this->viewRect)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenInfo", ::apache::thrift::protocol::T_STRUCT, 3);
+  xfer += (*(this->screenInfo)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenPoint0", ::apache::thrift::protocol::T_STRUCT, 4);
+  xfer += (*(this->screenPoint0)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("screenPoint100", ::apache::thrift::protocol::T_STRUCT, 5);
+  xfer += (*(this->screenPoint100)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_Browser_SetResourceRules_args::~Server_Browser_SetResourceRules_args() noexcept {
+}
+
+
+uint32_t Server_Browser_SetResourceRules_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bid);
+          this->__isset.bid = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->rules.clear();
+            uint32_t _size0;
+            ::apache::thrift::protocol::TType _etype3;
+            xfer += iprot->readListBegin(_etype3, _size0);
+            this->rules.resize(_size0);
+            uint32_t _i4;
+            for (_i4 = 0; _i4 < _size0; ++_i4)
+            {
+              xfer += this->rules[_i4].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.rules = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t Server_Browser_SetResourceRules_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_Browser_SetResourceRules_args");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->bid);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rules", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->rules.size()));
+    std::vector< ::thrift_codegen::ResourceRule> ::const_iterator _iter5;
+    for (_iter5 = this->rules.begin(); _iter5 != this->rules.end(); ++_iter5)
+    {
+      xfer += (*_iter5).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+Server_Browser_SetResourceRules_pargs::~Server_Browser_SetResourceRules_pargs() noexcept {
+}
+
+
+uint32_t Server_Browser_SetResourceRules_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("Server_Browser_SetResourceRules_pargs");
+
+  xfer += oprot->writeFieldBegin("bid", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32((*(this->bid)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rules", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>((*(this->rules)).size()));
+    std::vector< ::thrift_codegen::ResourceRule> ::const_iterator _iter6;
+    for (_iter6 = (*(this->rules)).begin(); _iter6 != (*(this->rules)).end(); ++_iter6)
+    {
+      xfer += (*_iter6).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
 Server_Browser_SendKeyEvent_args::~Server_Browser_SendKeyEvent_args() noexcept {
 }
 
@@ -6240,17 +6672,17 @@ uint32_t Server_Request_GetHeaderMap_result::read(::apache::thrift::protocol::TP
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->success.clear();
-            uint32_t _size0;
-            ::apache::thrift::protocol::TType _ktype1;
-            ::apache::thrift::protocol::TType _vtype2;
-            xfer += iprot->readMapBegin(_ktype1, _vtype2, _size0);
-            uint32_t _i4;
-            for (_i4 = 0; _i4 < _size0; ++_i4)
+            uint32_t _size7;
+            ::apache::thrift::protocol::TType _ktype8;
+            ::apache::thrift::protocol::TType _vtype9;
+            xfer += iprot->readMapBegin(_ktype8, _vtype9, _size7);
+            uint32_t _i11;
+            for (_i11 = 0; _i11 < _size7; ++_i11)
             {
-              std::string _key5;
-              xfer += iprot->readString(_key5);
-              std::string& _val6 = this->success[_key5];
-              xfer += iprot->readString(_val6);
+              std::string _key12;
+              xfer += iprot->readString(_key12);
+              std::string& _val13 = this->success[_key12];
+              xfer += iprot->readString(_val13);
             }
             xfer += iprot->readMapEnd();
           }
@@ -6281,11 +6713,11 @@ uint32_t Server_Request_GetHeaderMap_result::write(::apache::thrift::protocol::T
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
     {
       xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->success.size()));
-      std::map<std::string, std::string> ::const_iterator _iter7;
-      for (_iter7 = this->success.begin(); _iter7 != this->success.end(); ++_iter7)
+      std::map<std::string, std::string> ::const_iterator _iter14;
+      for (_iter14 = this->success.begin(); _iter14 != this->success.end(); ++_iter14)
       {
-        xfer += oprot->writeString(_iter7->first);
-        xfer += oprot->writeString(_iter7->second);
+        xfer += oprot->writeString(_iter14->first);
+        xfer += oprot->writeString(_iter14->second);
       }
       xfer += oprot->writeMapEnd();
     }
@@ -6326,17 +6758,17 @@ uint32_t Server_Request_GetHeaderMap_presult::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             (*(this->success)).clear();
-            uint32_t _size8;
-            ::apache::thrift::protocol::TType _ktype9;
-            ::apache::thrift::protocol::TType _vtype10;
-            xfer += iprot->readMapBegin(_ktype9, _vtype10, _size8);
-            uint32_t _i12;
-            for (_i12 = 0; _i12 < _size8; ++_i12)
+            uint32_t _size15;
+            ::apache::thrift::protocol::TType _ktype16;
+            ::apache::thrift::protocol::TType _vtype17;
+            xfer += iprot->readMapBegin(_ktype16, _vtype17, _size15);
+            uint32_t _i19;
+            for (_i19 = 0; _i19 < _size15; ++_i19)
             {
-              std::string _key13;
-              xfer += iprot->readString(_key13);
-              std::string& _val14 = (*(this->success))[_key13];
-              xfer += iprot->readString(_val14);
+              std::string _key20;
+              xfer += iprot->readString(_key20);
+              std::string& _val21 = (*(this->success))[_key20];
+              xfer += iprot->readString(_val21);
             }
             xfer += iprot->readMapEnd();
           }
@@ -6395,17 +6827,17 @@ uint32_t Server_Request_SetHeaderMap_args::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->headerMap.clear();
-            uint32_t _size15;
-            ::apache::thrift::protocol::TType _ktype16;
-            ::apache::thrift::protocol::TType _vtype17;
-            xfer += iprot->readMapBegin(_ktype16, _vtype17, _size15);
-            uint32_t _i19;
-            for (_i19 = 0; _i19 < _size15; ++_i19)
+            uint32_t _size22;
+            ::apache::thrift::protocol::TType _ktype23;
+            ::apache::thrift::protocol::TType _vtype24;
+            xfer += iprot->readMapBegin(_ktype23, _vtype24, _size22);
+            uint32_t _i26;
+            for (_i26 = 0; _i26 < _size22; ++_i26)
             {
-              std::string _key20;
-              xfer += iprot->readString(_key20);
-              std::string& _val21 = this->headerMap[_key20];
-              xfer += iprot->readString(_val21);
+              std::string _key27;
+              xfer += iprot->readString(_key27);
+              std::string& _val28 = this->headerMap[_key27];
+              xfer += iprot->readString(_val28);
             }
             xfer += iprot->readMapEnd();
           }
@@ -6438,11 +6870,11 @@ uint32_t Server_Request_SetHeaderMap_args::write(::apache::thrift::protocol::TPr
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->headerMap.size()));
-    std::map<std::string, std::string> ::const_iterator _iter22;
-    for (_iter22 = this->headerMap.begin(); _iter22 != this->headerMap.end(); ++_iter22)
+    std::map<std::string, std::string> ::const_iterator _iter29;
+    for (_iter29 = this->headerMap.begin(); _iter29 != this->headerMap.end(); ++_iter29)
     {
-      xfer += oprot->writeString(_iter22->first);
-      xfer += oprot->writeString(_iter22->second);
+      xfer += oprot->writeString(_iter29->first);
+      xfer += oprot->writeString(_iter29->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -6470,11 +6902,11 @@ uint32_t Server_Request_SetHeaderMap_pargs::write(::apache::thrift::protocol::TP
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->headerMap)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter23;
-    for (_iter23 = (*(this->headerMap)).begin(); _iter23 != (*(this->headerMap)).end(); ++_iter23)
+    std::map<std::string, std::string> ::const_iterator _iter30;
+    for (_iter30 = (*(this->headerMap)).begin(); _iter30 != (*(this->headerMap)).end(); ++_iter30)
     {
-      xfer += oprot->writeString(_iter23->first);
-      xfer += oprot->writeString(_iter23->second);
+      xfer += oprot->writeString(_iter30->first);
+      xfer += oprot->writeString(_iter30->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -6624,17 +7056,17 @@ uint32_t Server_Request_Set_args::read(::apache::thrift::protocol::TProtocol* ip
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->headerMap.clear();
-            uint32_t _size24;
-            ::apache::thrift::protocol::TType _ktype25;
-            ::apache::thrift::protocol::TType _vtype26;
-            xfer += iprot->readMapBegin(_ktype25, _vtype26, _size24);
-            uint32_t _i28;
-            for (_i28 = 0; _i28 < _size24; ++_i28)
+            uint32_t _size31;
+            ::apache::thrift::protocol::TType _ktype32;
+            ::apache::thrift::protocol::TType _vtype33;
+            xfer += iprot->readMapBegin(_ktype32, _vtype33, _size31);
+            uint32_t _i35;
+            for (_i35 = 0; _i35 < _size31; ++_i35)
             {
-              std::string _key29;
-              xfer += iprot->readString(_key29);
-              std::string& _val30 = this->headerMap[_key29];
-              xfer += iprot->readString(_val30);
+              std::string _key36;
+              xfer += iprot->readString(_key36);
+              std::string& _val37 = this->headerMap[_key36];
+              xfer += iprot->readString(_val37);
             }
             xfer += iprot->readMapEnd();
           }
@@ -6679,11 +7111,11 @@ uint32_t Server_Request_Set_args::write(::apache::thrift::protocol::TProtocol* o
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 5);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->headerMap.size()));
-    std::map<std::string, std::string> ::const_iterator _iter31;
-    for (_iter31 = this->headerMap.begin(); _iter31 != this->headerMap.end(); ++_iter31)
+    std::map<std::string, std::string> ::const_iterator _iter38;
+    for (_iter38 = this->headerMap.begin(); _iter38 != this->headerMap.end(); ++_iter38)
     {
-      xfer += oprot->writeString(_iter31->first);
-      xfer += oprot->writeString(_iter31->second);
+      xfer += oprot->writeString(_iter38->first);
+      xfer += oprot->writeString(_iter38->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -6723,11 +7155,11 @@ uint32_t Server_Request_Set_pargs::write(::apache::thrift::protocol::TProtocol*
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 5);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->headerMap)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter32;
-    for (_iter32 = (*(this->headerMap)).begin(); _iter32 != (*(this->headerMap)).end(); ++_iter32)
+    std::map<std::string, std::string> ::const_iterator _iter39;
+    for (_iter39 = (*(this->headerMap)).begin(); _iter39 != (*(this->headerMap)).end(); ++_iter39)
     {
-      xfer += oprot->writeString(_iter32->first);
-      xfer += oprot->writeString(_iter32->second);
+      xfer += oprot->writeString(_iter39->first);
+      xfer += oprot->writeString(_iter39->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -7487,17 +7919,17 @@ uint32_t Server_Response_GetHeaderMap_result::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->success.clear();
-            uint32_t _size33;
-            ::apache::thrift::protocol::TType _ktype34;
-            ::apache::thrift::protocol::TType _vtype35;
-            xfer += iprot->readMapBegin(_ktype34, _vtype35, _size33);
-            uint32_t _i37;
-            for (_i37 = 0; _i37 < _size33; ++_i37)
+            uint32_t _size40;
+            ::apache::thrift::protocol::TType _ktype41;
+            ::apache::thrift::protocol::TType _vtype42;
+            xfer += iprot->readMapBegin(_ktype41, _vtype42, _size40);
+            uint32_t _i44;
+            for (_i44 = 0; _i44 < _size40; ++_i44)
             {
-              std::string _key38;
-              xfer += iprot->readString(_key38);
-              std::string& _val39 = this->success[_key38];
-              xfer += iprot->readString(_val39);
+              std::string _key45;
+              xfer += iprot->readString(_key45);
+              std::string& _val46 = this->success[_key45];
+              xfer += iprot->readString(_val46);
             }
             xfer += iprot->readMapEnd();
           }
@@ -7528,11 +7960,11 @@ uint32_t Server_Response_GetHeaderMap_result::write(::apache::thrift::protocol::
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
     {
       xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->success.size()));
-      std::map<std::string, std::string> ::const_iterator _iter40;
-      for (_iter40 = this->success.begin(); _iter40 != this->success.end(); ++_iter40)
+      std::map<std::string, std::string> ::const_iterator _iter47;
+      for (_iter47 = this->success.begin(); _iter47 != this->success.end(); ++_iter47)
       {
-        xfer += oprot->writeString(_iter40->first);
-        xfer += oprot->writeString(_iter40->second);
+        xfer += oprot->writeString(_iter47->first);
+        xfer += oprot->writeString(_iter47->second);
       }
       xfer += oprot->writeMapEnd();
     }
@@ -7573,17 +8005,17 @@ uint32_t Server_Response_GetHeaderMap_presult::read(::apache::thrift::protocol::
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             (*(this->success)).clear();
-            uint32_t _size41;
-            ::apache::thrift::protocol::TType _ktype42;
-            ::apache::thrift::protocol::TType _vtype43;
-            xfer += iprot->readMapBegin(_ktype42, _vtype43, _size41);
-            uint32_t _i45;
-            for (_i45 = 0; _i45 < _size41; ++_i45)
+            uint32_t _size48;
+            ::apache::thrift::protocol::TType _ktype49;
+            ::apache::thrift::protocol::TType _vtype50;
+            xfer += iprot->readMapBegin(_ktype49, _vtype50, _size48);
+            uint32_t _i52;
+            for (_i52 = 0; _i52 < _size48; ++_i52)
             {
-              std::string _key46;
-              xfer += iprot->readString(_key46);
-              std::string& _val47 = (*(this->success))[_key46];
-              xfer += iprot->readString(_val47);
+              std::string _key53;
+              xfer += iprot->readString(_key53);
+              std::string& _val54 = (*(this->success))[_key53];
+              xfer += iprot->readString(_val54);
             }
             xfer += iprot->readMapEnd();
           }
@@ -7642,17 +8074,17 @@ uint32_t Server_Response_SetHeaderMap_args::read(::apache::thrift::protocol::TPr
         if (ftype == ::apache::thrift::protocol::T_MAP) {
           {
             this->headerMap.clear();
-            uint32_t _size48;
-            ::apache::thrift::protocol::TType _ktype49;
-            ::apache::thrift::protocol::TType _vtype50;
-            xfer += iprot->readMapBegin(_ktype49, _vtype50, _size48);
-            uint32_t _i52;
-            for (_i52 = 0; _i52 < _size48; ++_i52)
+            uint32_t _size55;
+            ::apache::thrift::protocol::TType _ktype56;
+            ::apache::thrift::protocol::TType _vtype57;
+            xfer += iprot->readMapBegin(_ktype56, _vtype57, _size55);
+            uint32_t _i59;
+            for (_i59 = 0; _i59 < _size55; ++_i59)
             {
-              std::string _key53;
-              xfer += iprot->readString(_key53);
-              std::string& _val54 = this->headerMap[_key53];
-              xfer += iprot->readString(_val54);
+              std::string _key60;
+              xfer += iprot->readString(_key60);
+              std::string& _val61 = this->headerMap[_key60];
+              xfer += iprot->readString(_val61);
             }
             xfer += iprot->readMapEnd();
           }
@@ -7685,11 +8117,11 @@ uint32_t Server_Response_SetHeaderMap_args::write(::apache::thrift::protocol::TP
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->headerMap.size()));
-    std::map<std::string, std::string> ::const_iterator _iter55;
-    for (_iter55 = this->headerMap.begin(); _iter55 != this->headerMap.end(); ++_iter55)
+    std::map<std::string, std::string> ::const_iterator _iter62;
+    for (_iter62 = this->headerMap.begin(); _iter62 != this->headerMap.end(); ++_iter62)
     {
-      xfer += oprot->writeString(_iter55->first);
-      xfer += oprot->writeString(_iter55->second);
+      xfer += oprot->writeString(_iter62->first);
+      xfer += oprot->writeString(_iter62->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -7717,11 +8149,11 @@ uint32_t Server_Response_SetHeaderMap_pargs::write(::apache::thrift::protocol::T
   xfer += oprot->writeFieldBegin("headerMap", ::apache::thrift::protocol::T_MAP, 2);
   {
     xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->headerMap)).size()));
-    std::map<std::string, std::string> ::const_iterator _iter56;
-    for (_iter56 = (*(this->headerMap)).begin(); _iter56 != (*(this->headerMap)).end(); ++_iter56)
+    std::map<std::string, std::string> ::const_iterator _iter63;
+    for (_iter63 = (*(this->headerMap)).begin(); _iter63 != (*(this->headerMap)).end(); ++_iter63)
     {
-      xfer += oprot->writeString(_iter56->first);
-      xfer += oprot->writeString(_iter56->second);
+      xfer += oprot->writeString(_iter63->first);
+      xfer += oprot->writeString(_iter63->second);
     }
     xfer += oprot->writeMapEnd();
   }
@@ -9975,12 +10407,69 @@ void ServerClient::version(std::string& _return)
   recv_version(_return);
 }
 
-void ServerClient::send_version()
+void ServerClient::send_version()
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("version", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Server_version_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void ServerClient::recv_version(std::string& _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("version") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  Server_version_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "version failed: unknown result");
+}
+
+void ServerClient::state(std::string& _return)
+{
+  send_state();
+  recv_state(_return);
+}
+
+void ServerClient::send_state()
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("version", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("state", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Server_version_pargs args;
+  Server_state_pargs args;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -9988,7 +10477,7 @@ void ServerClient::send_version()
   oprot_->getTransport()->flush();
 }
 
-void ServerClient::recv_version(std::string& _return)
+void ServerClient::recv_state(std::string& _return)
 {
 
   int32_t rseqid = 0;
@@ -10008,12 +10497,12 @@ void ServerClient::recv_version(std::string& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("version") != 0) {
+  if (fname.compare("state") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Server_version_presult result;
+  Server_state_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -10023,21 +10512,21 @@ void ServerClient::recv_version(std::string& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "version failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "state failed: unknown result");
 }
 
-void ServerClient::state(std::string& _return)
+void ServerClient::metrics( ::thrift_codegen::ServerMetrics& _return)
 {
-  send_state();
-  recv_state(_return);
+  send_metrics();
+  recv_metrics(_return);
 }
 
-void ServerClient::send_state()
+void ServerClient::send_metrics()
 {
   int32_t cseqid = 0;
-  oprot_->writeMessageBegin("state", ::apache::thrift::protocol::T_CALL, cseqid);
+  oprot_->writeMessageBegin("metrics", ::apache::thrift::protocol::T_CALL, cseqid);
 
-  Server_state_pargs args;
+  Server_metrics_pargs args;
   args.write(oprot_);
 
   oprot_->writeMessageEnd();
@@ -10045,7 +10534,7 @@ void ServerClient::send_state()
   oprot_->getTransport()->flush();
 }
 
-void ServerClient::recv_state(std::string& _return)
+void ServerClient::recv_metrics( ::thrift_codegen::ServerMetrics& _return)
 {
 
   int32_t rseqid = 0;
@@ -10065,12 +10554,12 @@ void ServerClient::recv_state(std::string& _return)
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  if (fname.compare("state") != 0) {
+  if (fname.compare("metrics") != 0) {
     iprot_->skip(::apache::thrift::protocol::T_STRUCT);
     iprot_->readMessageEnd();
     iprot_->getTransport()->readEnd();
   }
-  Server_state_presult result;
+  Server_metrics_presult result;
   result.success = &_return;
   result.read(iprot_);
   iprot_->readMessageEnd();
@@ -10080,7 +10569,7 @@ void ServerClient::recv_state(std::string& _return)
     // _return pointer has now been filled
     return;
   }
-  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "state failed: unknown result");
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "metrics failed: unknown result");
 }
 
 void ServerClient::stop()
@@ -10375,6 +10864,49 @@ void ServerClient::send_Browser_NotifyScreenInfoChanged(const int32_t bid)
   oprot_->getTransport()->flush();
 }
 
+void ServerClient::Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100)
+{
+  send_Browser_SetViewGeometry(bid, viewRect, screenInfo, screenPoint0, screenPoint100);
+}
+
+void ServerClient::send_Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Browser_SetViewGeometry", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  Server_Browser_SetViewGeometry_pargs args;
+  args.bid = &bid;
+  args.viewRect = &viewRect;
+  args.screenInfo = &screenInfo;
+  args.screenPoint0 = &screenPoint0;
+  args.screenPoint100 = &screenPoint100;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void ServerClient::Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules)
+{
+  send_Browser_SetResourceRules(bid, rules);
+}
+
+void ServerClient::send_Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("Browser_SetResourceRules", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  Server_Browser_SetResourceRules_pargs args;
+  args.bid = &bid;
+  args.rules = &rules;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
 void ServerClient::Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code)
 {
   send_Browser_SendKeyEvent(bid, event_type, modifiers, key_char, scanCode, key_code);
@@ -12695,6 +13227,60 @@ void ServerProcessor::process_state(int32_t seqid, ::apache::thrift::protocol::T
   }
 }
 
+void ServerProcessor::process_metrics(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("Server.metrics", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Server.metrics");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "Server.metrics");
+  }
+
+  Server_metrics_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "Server.metrics", bytes);
+  }
+
+  Server_metrics_result result;
+  try {
+    iface_->metrics(result.success);
+    result.__isset.success = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "Server.metrics");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("metrics", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preWrite(ctx, "Server.metrics");
+  }
+
+  oprot->writeMessageBegin("metrics", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postWrite(ctx, "Server.metrics", bytes);
+  }
+}
+
 void ServerProcessor::process_stop(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
 {
   void* ctx = nullptr;
@@ -13136,6 +13722,80 @@ void ServerProcessor::process_Browser_NotifyScreenInfoChanged(int32_t, ::apache:
   return;
 }
 
+void ServerProcessor::process_Browser_SetViewGeometry(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("Server.Browser_SetViewGeometry", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Server.Browser_SetViewGeometry");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "Server.Browser_SetViewGeometry");
+  }
+
+  Server_Browser_SetViewGeometry_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "Server.Browser_SetViewGeometry", bytes);
+  }
+
+  try {
+    iface_->Browser_SetViewGeometry(args.bid, args.viewRect, args.screenInfo, args.screenPoint0, args.screenPoint100);
+  } catch (const std::exception&) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "Server.Browser_SetViewGeometry");
+    }
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->asyncComplete(ctx, "Server.Browser_SetViewGeometry");
+  }
+
+  return;
+}
+
+void ServerProcessor::process_Browser_SetResourceRules(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
+{
+  void* ctx = nullptr;
+  if (this->eventHandler_.get() != nullptr) {
+    ctx = this->eventHandler_->getContext("Server.Browser_SetResourceRules", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "Server.Browser_SetResourceRules");
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->preRead(ctx, "Server.Browser_SetResourceRules");
+  }
+
+  Server_Browser_SetResourceRules_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->postRead(ctx, "Server.Browser_SetResourceRules", bytes);
+  }
+
+  try {
+    iface_->Browser_SetResourceRules(args.bid, args.rules);
+  } catch (const std::exception&) {
+    if (this->eventHandler_.get() != nullptr) {
+      this->eventHandler_->handlerError(ctx, "Server.Browser_SetResourceRules");
+    }
+    return;
+  }
+
+  if (this->eventHandler_.get() != nullptr) {
+    this->eventHandler_->asyncComplete(ctx, "Server.Browser_SetResourceRules");
+  }
+
+  return;
+}
+
 void ServerProcessor::process_Browser_SendKeyEvent(int32_t, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol*, void* callContext)
 {
   void* ctx = nullptr;
@@ -15938,6 +16598,89 @@ void ServerConcurrentClient::recv_state(std::string& _return, const int32_t seqi
   } // end while(true)
 }
 
+void ServerConcurrentClient::metrics( ::thrift_codegen::ServerMetrics& _return)
+{
+  int32_t seqid = send_metrics();
+  recv_metrics(_return, seqid);
+}
+
+int32_t ServerConcurrentClient::send_metrics()
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("metrics", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  Server_metrics_pargs args;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void ServerConcurrentClient::recv_metrics( ::thrift_codegen::ServerMetrics& _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("metrics") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      Server_metrics_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "metrics failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 void ServerConcurrentClient::stop()
 {
   send_stop();
@@ -16309,6 +17052,55 @@ void ServerConcurrentClient::send_Browser_NotifyScreenInfoChanged(const int32_t
   sentry.commit();
 }
 
+void ServerConcurrentClient::Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100)
+{
+  send_Browser_SetViewGeometry(bid, viewRect, screenInfo, screenPoint0, screenPoint100);
+}
+
+void ServerConcurrentClient::send_Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100)
+{
+  int32_t cseqid = 0;
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("Browser_SetViewGeometry", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  Server_Browser_SetViewGeometry_pargs args;
+  args.bid = &bid;
+  args.viewRect = &viewRect;
+  args.screenInfo = &screenInfo;
+  args.screenPoint0 = &screenPoint0;
+  args.screenPoint100 = &screenPoint100;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+}
+
+void ServerConcurrentClient::Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules)
+{
+  send_Browser_SetResourceRules(bid, rules);
+}
+
+void ServerConcurrentClient::send_Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules)
+{
+  int32_t cseqid = 0;
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("Browser_SetResourceRules", ::apache::thrift::protocol::T_ONEWAY, cseqid);
+
+  Server_Browser_SetResourceRules_pargs args;
+  args.bid = &bid;
+  args.rules = &rules;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+}
+
 void ServerConcurrentClient::Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code)
 {
   send_Browser_SendKeyEvent(bid, event_type, modifiers, key_char, scanCode, key_code);
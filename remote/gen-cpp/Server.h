@@ -28,6 +28,7 @@ class ServerIf {
   virtual void echo(std::string& _return, const std::string& msg) = 0;
   virtual void version(std::string& _return) = 0;
   virtual void state(std::string& _return) = 0;
+  virtual void metrics( ::thrift_codegen::ServerMetrics& _return) = 0;
   virtual void stop() = 0;
   virtual int32_t createBrowser(const int32_t cid, const int32_t handlersMask) = 0;
   virtual void startBrowserCreation(const int32_t bid, const std::string& url) = 0;
@@ -39,6 +40,8 @@ class ServerIf {
   virtual void Browser_ExecuteJavaScript(const int32_t bid, const std::string& code, const std::string& url, const int32_t line) = 0;
   virtual void Browser_WasResized(const int32_t bid) = 0;
   virtual void Browser_NotifyScreenInfoChanged(const int32_t bid) = 0;
+  virtual void Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100) = 0;
+  virtual void Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules) = 0;
   virtual void Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code) = 0;
   virtual void Browser_SendMouseEvent(const int32_t bid, const int32_t event_type, const int32_t x, const int32_t y, const int32_t modifiers, const int32_t click_count, const int32_t button) = 0;
   virtual void Browser_SendMouseWheelEvent(const int32_t bid, const int32_t scroll_type, const int32_t x, const int32_t y, const int32_t modifiers, const int32_t delta, const int32_t units_to_scroll) = 0;
@@ -140,6 +143,9 @@ class ServerNull : virtual public ServerIf {
   void state(std::string& /* _return */) override {
     return;
   }
+  void metrics( ::thrift_codegen::ServerMetrics& /* _return */) override {
+    return;
+  }
   void stop() override {
     return;
   }
@@ -174,6 +180,12 @@ class ServerNull : virtual public ServerIf {
   void Browser_NotifyScreenInfoChanged(const int32_t /* bid */) override {
     return;
   }
+  void Browser_SetViewGeometry(const int32_t /* bid */, const  ::thrift_codegen::Rect& /* viewRect */, const  ::thrift_codegen::ScreenInfo& /* screenInfo */, const  ::thrift_codegen::Point& /* screenPoint0 */, const  ::thrift_codegen::Point& /* screenPoint100 */) override {
+    return;
+  }
+  void Browser_SetResourceRules(const int32_t /* bid */, const std::vector< ::thrift_codegen::ResourceRule> & /* rules */) override {
+    return;
+  }
   void Browser_SendKeyEvent(const int32_t /* bid */, const int32_t /* event_type */, const int32_t /* modifiers */, const int16_t /* key_char */, const int64_t /* scanCode */, const int32_t /* key_code */) override {
     return;
   }
@@ -910,6 +922,98 @@ class Server_state_presult {
 };
 
 
+class Server_metrics_args {
+ public:
+
+  Server_metrics_args(const Server_metrics_args&) noexcept;
+  Server_metrics_args& operator=(const Server_metrics_args&) noexcept;
+  Server_metrics_args() noexcept {
+  }
+
+  virtual ~Server_metrics_args() noexcept;
+
+  bool operator == (const Server_metrics_args & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const Server_metrics_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Server_metrics_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Server_metrics_pargs {
+ public:
+
+
+  virtual ~Server_metrics_pargs() noexcept;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Server_metrics_result__isset {
+  _Server_metrics_result__isset() : success(false) {}
+  bool success :1;
+} _Server_metrics_result__isset;
+
+class Server_metrics_result {
+ public:
+
+  Server_metrics_result(const Server_metrics_result&);
+  Server_metrics_result& operator=(const Server_metrics_result&);
+  Server_metrics_result() noexcept {
+  }
+
+  virtual ~Server_metrics_result() noexcept;
+   ::thrift_codegen::ServerMetrics success;
+
+  _Server_metrics_result__isset __isset;
+
+  void __set_success(const  ::thrift_codegen::ServerMetrics& val);
+
+  bool operator == (const Server_metrics_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const Server_metrics_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Server_metrics_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Server_metrics_presult__isset {
+  _Server_metrics_presult__isset() : success(false) {}
+  bool success :1;
+} _Server_metrics_presult__isset;
+
+class Server_metrics_presult {
+ public:
+
+
+  virtual ~Server_metrics_presult() noexcept;
+   ::thrift_codegen::ServerMetrics* success;
+
+  _Server_metrics_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
+
 class Server_stop_args {
  public:
 
@@ -1606,6 +1710,141 @@ class Server_Browser_NotifyScreenInfoChanged_pargs {
 
 };
 
+typedef struct _Server_Browser_SetViewGeometry_args__isset {
+  _Server_Browser_SetViewGeometry_args__isset() : bid(false), viewRect(false), screenInfo(false), screenPoint0(false), screenPoint100(false) {}
+  bool bid :1;
+  bool viewRect :1;
+  bool screenInfo :1;
+  bool screenPoint0 :1;
+  bool screenPoint100 :1;
+} _Server_Browser_SetViewGeometry_args__isset;
+
+class Server_Browser_SetViewGeometry_args {
+ public:
+
+  Server_Browser_SetViewGeometry_args(const Server_Browser_SetViewGeometry_args&) noexcept;
+  Server_Browser_SetViewGeometry_args& operator=(const Server_Browser_SetViewGeometry_args&) noexcept;
+  Server_Browser_SetViewGeometry_args() noexcept
+                                      : bid(0) {
+  }
+
+  virtual ~Server_Browser_SetViewGeometry_args() noexcept;
+  int32_t bid;
+   ::thrift_codegen::Rect viewRect;
+   ::thrift_codegen::ScreenInfo screenInfo;
+   ::thrift_codegen::Point screenPoint0;
+   ::thrift_codegen::Point screenPoint100;
+
+  _Server_Browser_SetViewGeometry_args__isset __isset;
+
+  void __set_bid(const int32_t val);
+
+  void __set_viewRect(const  ::thrift_codegen::Rect& val);
+
+  void __set_screenInfo(const  ::thrift_codegen::ScreenInfo& val);
+
+  void __set_screenPoint0(const  ::thrift_codegen::Point& val);
+
+  void __set_screenPoint100(const  ::thrift_codegen::Point& val);
+
+  bool operator == (const Server_Browser_SetViewGeometry_args & rhs) const
+  {
+    if (!(bid == rhs.bid))
+      return false;
+    if (!(viewRect == rhs.viewRect))
+      return false;
+    if (!(screenInfo == rhs.screenInfo))
+      return false;
+    if (!(screenPoint0 == rhs.screenPoint0))
+      return false;
+    if (!(screenPoint100 == rhs.screenPoint100))
+      return false;
+    return true;
+  }
+  bool operator != (const Server_Browser_SetViewGeometry_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Server_Browser_SetViewGeometry_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Server_Browser_SetViewGeometry_pargs {
+ public:
+
+
+  virtual ~Server_Browser_SetViewGeometry_pargs() noexcept;
+  const int32_t* bid;
+  const  ::thrift_codegen::Rect* viewRect;
+  const  ::thrift_codegen::ScreenInfo* screenInfo;
+  const  ::thrift_codegen::Point* screenPoint0;
+  const  ::thrift_codegen::Point* screenPoint100;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _Server_Browser_SetResourceRules_args__isset {
+  _Server_Browser_SetResourceRules_args__isset() : bid(false), rules(false) {}
+  bool bid :1;
+  bool rules :1;
+} _Server_Browser_SetResourceRules_args__isset;
+
+class Server_Browser_SetResourceRules_args {
+ public:
+
+  Server_Browser_SetResourceRules_args(const Server_Browser_SetResourceRules_args&);
+  Server_Browser_SetResourceRules_args& operator=(const Server_Browser_SetResourceRules_args&);
+  Server_Browser_SetResourceRules_args() noexcept
+                                       : bid(0) {
+  }
+
+  virtual ~Server_Browser_SetResourceRules_args() noexcept;
+  int32_t bid;
+  std::vector< ::thrift_codegen::ResourceRule>  rules;
+
+  _Server_Browser_SetResourceRules_args__isset __isset;
+
+  void __set_bid(const int32_t val);
+
+  void __set_rules(const std::vector< ::thrift_codegen::ResourceRule> & val);
+
+  bool operator == (const Server_Browser_SetResourceRules_args & rhs) const
+  {
+    if (!(bid == rhs.bid))
+      return false;
+    if (!(rules == rhs.rules))
+      return false;
+    return true;
+  }
+  bool operator != (const Server_Browser_SetResourceRules_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Server_Browser_SetResourceRules_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class Server_Browser_SetResourceRules_pargs {
+ public:
+
+
+  virtual ~Server_Browser_SetResourceRules_pargs() noexcept;
+  const int32_t* bid;
+  const std::vector< ::thrift_codegen::ResourceRule> * rules;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
 typedef struct _Server_Browser_SendKeyEvent_args__isset {
   _Server_Browser_SendKeyEvent_args__isset() : bid(false), event_type(false), modifiers(false), key_char(false), scanCode(false), key_code(false) {}
   bool bid :1;
@@ -5871,6 +6110,9 @@ class ServerClient : virtual public ServerIf {
   void state(std::string& _return) override;
   void send_state();
   void recv_state(std::string& _return);
+  void metrics( ::thrift_codegen::ServerMetrics& _return) override;
+  void send_metrics();
+  void recv_metrics( ::thrift_codegen::ServerMetrics& _return);
   void stop() override;
   void send_stop();
   int32_t createBrowser(const int32_t cid, const int32_t handlersMask) override;
@@ -5895,6 +6137,10 @@ class ServerClient : virtual public ServerIf {
   void send_Browser_WasResized(const int32_t bid);
   void Browser_NotifyScreenInfoChanged(const int32_t bid) override;
   void send_Browser_NotifyScreenInfoChanged(const int32_t bid);
+  void Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100) override;
+  void send_Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100);
+  void Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules) override;
+  void send_Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules);
   void Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code) override;
   void send_Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code);
   void Browser_SendMouseEvent(const int32_t bid, const int32_t event_type, const int32_t x, const int32_t y, const int32_t modifiers, const int32_t click_count, const int32_t button) override;
@@ -6046,6 +6292,7 @@ class ServerProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_echo(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_version(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_state(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_metrics(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_stop(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_createBrowser(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_startBrowserCreation(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -6057,6 +6304,8 @@ class ServerProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_Browser_ExecuteJavaScript(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Browser_WasResized(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Browser_NotifyScreenInfoChanged(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Browser_SetViewGeometry(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_Browser_SetResourceRules(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Browser_SendKeyEvent(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Browser_SendMouseEvent(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Browser_SendMouseWheelEvent(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -6118,6 +6367,7 @@ class ServerProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["echo"] = &ServerProcessor::process_echo;
     processMap_["version"] = &ServerProcessor::process_version;
     processMap_["state"] = &ServerProcessor::process_state;
+    processMap_["metrics"] = &ServerProcessor::process_metrics;
     processMap_["stop"] = &ServerProcessor::process_stop;
     processMap_["createBrowser"] = &ServerProcessor::process_createBrowser;
     processMap_["startBrowserCreation"] = &ServerProcessor::process_startBrowserCreation;
@@ -6129,6 +6379,8 @@ class ServerProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["Browser_ExecuteJavaScript"] = &ServerProcessor::process_Browser_ExecuteJavaScript;
     processMap_["Browser_WasResized"] = &ServerProcessor::process_Browser_WasResized;
     processMap_["Browser_NotifyScreenInfoChanged"] = &ServerProcessor::process_Browser_NotifyScreenInfoChanged;
+    processMap_["Browser_SetViewGeometry"] = &ServerProcessor::process_Browser_SetViewGeometry;
+    processMap_["Browser_SetResourceRules"] = &ServerProcessor::process_Browser_SetResourceRules;
     processMap_["Browser_SendKeyEvent"] = &ServerProcessor::process_Browser_SendKeyEvent;
     processMap_["Browser_SendMouseEvent"] = &ServerProcessor::process_Browser_SendMouseEvent;
     processMap_["Browser_SendMouseWheelEvent"] = &ServerProcessor::process_Browser_SendMouseWheelEvent;
@@ -6266,6 +6518,16 @@ class ServerMultiface : virtual public ServerIf {
     return;
   }
 
+  void metrics( ::thrift_codegen::ServerMetrics& _return) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->metrics(_return);
+    }
+    ifaces_[i]->metrics(_return);
+    return;
+  }
+
   void stop() override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -6366,6 +6628,24 @@ class ServerMultiface : virtual public ServerIf {
     ifaces_[i]->Browser_NotifyScreenInfoChanged(bid);
   }
 
+  void Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Browser_SetViewGeometry(bid, viewRect, screenInfo, screenPoint0, screenPoint100);
+    }
+    ifaces_[i]->Browser_SetViewGeometry(bid, viewRect, screenInfo, screenPoint0, screenPoint100);
+  }
+
+  void Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->Browser_SetResourceRules(bid, rules);
+    }
+    ifaces_[i]->Browser_SetResourceRules(bid, rules);
+  }
+
   void Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -6889,6 +7169,9 @@ class ServerConcurrentClient : virtual public ServerIf {
   void state(std::string& _return) override;
   int32_t send_state();
   void recv_state(std::string& _return, const int32_t seqid);
+  void metrics( ::thrift_codegen::ServerMetrics& _return) override;
+  int32_t send_metrics();
+  void recv_metrics( ::thrift_codegen::ServerMetrics& _return, const int32_t seqid);
   void stop() override;
   void send_stop();
   int32_t createBrowser(const int32_t cid, const int32_t handlersMask) override;
@@ -6913,6 +7196,10 @@ class ServerConcurrentClient : virtual public ServerIf {
   void send_Browser_WasResized(const int32_t bid);
   void Browser_NotifyScreenInfoChanged(const int32_t bid) override;
   void send_Browser_NotifyScreenInfoChanged(const int32_t bid);
+  void Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100) override;
+  void send_Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100);
+  void Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules) override;
+  void send_Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules);
   void Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code) override;
   void send_Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code);
   void Browser_SendMouseEvent(const int32_t bid, const int32_t event_type, const int32_t x, const int32_t y, const int32_t modifiers, const int32_t click_count, const int32_t button) override;
@@ -50,6 +50,11 @@ class ServerHandler : virtual public ServerIf {
     printf("state\n");
   }
 
+  void metrics( ::thrift_codegen::ServerMetrics& _return) {
+    // Your implementation goes here
+    printf("metrics\n");
+  }
+
   void stop() {
     // Your implementation goes here
     printf("stop\n");
@@ -105,6 +110,16 @@ class ServerHandler : virtual public ServerIf {
     printf("Browser_NotifyScreenInfoChanged\n");
   }
 
+  void Browser_SetViewGeometry(const int32_t bid, const  ::thrift_codegen::Rect& viewRect, const  ::thrift_codegen::ScreenInfo& screenInfo, const  ::thrift_codegen::Point& screenPoint0, const  ::thrift_codegen::Point& screenPoint100) {
+    // Your implementation goes here
+    printf("Browser_SetViewGeometry\n");
+  }
+
+  void Browser_SetResourceRules(const int32_t bid, const std::vector< ::thrift_codegen::ResourceRule> & rules) {
+    // Your implementation goes here
+    printf("Browser_SetResourceRules\n");
+  }
+
   void Browser_SendKeyEvent(const int32_t bid, const int32_t event_type, const int32_t modifiers, const int16_t key_char, const int64_t scanCode, const int32_t key_code) {
     // Your implementation goes here
     printf("Browser_SendKeyEvent\n");
@@ -14,31 +14,25 @@
 namespace thrift_codegen {
 
 
-RObject::~RObject() noexcept {
+Point::~Point() noexcept {
 }
 
 
-void RObject::__set_objId(const int32_t val) {
-  this->objId = val;
-}
-
-void RObject::__set_flags(const int32_t val) {
-  this->flags = val;
-__isset.flags = true;
+void Point::__set_x(const int32_t val) {
+  this->x = val;
 }
 
-void RObject::__set_objInfo(const std::map<std::string, std::string> & val) {
-  this->objInfo = val;
-__isset.objInfo = true;
+void Point::__set_y(const int32_t val) {
+  this->y = val;
 }
-std::ostream& operator<<(std::ostream& out, const RObject& obj)
+std::ostream& operator<<(std::ostream& out, const Point& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t RObject::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t Point::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -50,7 +44,8 @@ uint32_t RObject::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
-  bool isset_objId = false;
+  bool isset_x = false;
+  bool isset_y = false;
 
   while (true)
   {
@@ -62,39 +57,16 @@ uint32_t RObject::read(::apache::thrift::protocol::TProtocol* iprot) {
     {
       case 1:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->objId);
-          isset_objId = true;
+          xfer += iprot->readI32(this->x);
+          isset_x = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->flags);
-          this->__isset.flags = true;
-        } else {
-          xfer += iprot->skip(ftype);
-        }
-        break;
-      case 3:
-        if (ftype == ::apache::thrift::protocol::T_MAP) {
-          {
-            this->objInfo.clear();
-            uint32_t _size0;
-            ::apache::thrift::protocol::TType _ktype1;
-            ::apache::thrift::protocol::TType _vtype2;
-            xfer += iprot->readMapBegin(_ktype1, _vtype2, _size0);
-            uint32_t _i4;
-            for (_i4 = 0; _i4 < _size0; ++_i4)
-            {
-              std::string _key5;
-              xfer += iprot->readString(_key5);
-              std::string& _val6 = this->objInfo[_key5];
-              xfer += iprot->readString(_val6);
-            }
-            xfer += iprot->readMapEnd();
-          }
-          this->__isset.objInfo = true;
+          xfer += iprot->readI32(this->y);
+          isset_y = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -108,96 +80,82 @@ uint32_t RObject::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
-  if (!isset_objId)
+  if (!isset_x)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_y)
     throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t RObject::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t Point::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("RObject");
+  xfer += oprot->writeStructBegin("Point");
 
-  xfer += oprot->writeFieldBegin("objId", ::apache::thrift::protocol::T_I32, 1);
-  xfer += oprot->writeI32(this->objId);
+  xfer += oprot->writeFieldBegin("x", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->x);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("y", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->y);
   xfer += oprot->writeFieldEnd();
 
-  if (this->__isset.flags) {
-    xfer += oprot->writeFieldBegin("flags", ::apache::thrift::protocol::T_I32, 2);
-    xfer += oprot->writeI32(this->flags);
-    xfer += oprot->writeFieldEnd();
-  }
-  if (this->__isset.objInfo) {
-    xfer += oprot->writeFieldBegin("objInfo", ::apache::thrift::protocol::T_MAP, 3);
-    {
-      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->objInfo.size()));
-      std::map<std::string, std::string> ::const_iterator _iter7;
-      for (_iter7 = this->objInfo.begin(); _iter7 != this->objInfo.end(); ++_iter7)
-      {
-        xfer += oprot->writeString(_iter7->first);
-        xfer += oprot->writeString(_iter7->second);
-      }
-      xfer += oprot->writeMapEnd();
-    }
-    xfer += oprot->writeFieldEnd();
-  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(RObject &a, RObject &b) {
+void swap(Point &a, Point &b) {
   using ::std::swap;
-  swap(a.objId, b.objId);
-  swap(a.flags, b.flags);
-  swap(a.objInfo, b.objInfo);
-  swap(a.__isset, b.__isset);
+  swap(a.x, b.x);
+  swap(a.y, b.y);
 }
 
-RObject::RObject(const RObject& other8) {
-  objId = other8.objId;
-  flags = other8.flags;
-  objInfo = other8.objInfo;
-  __isset = other8.__isset;
+Point::Point(const Point& other0) noexcept {
+  x = other0.x;
+  y = other0.y;
 }
-RObject& RObject::operator=(const RObject& other9) {
-  objId = other9.objId;
-  flags = other9.flags;
-  objInfo = other9.objInfo;
-  __isset = other9.__isset;
+Point& Point::operator=(const Point& other1) noexcept {
+  x = other1.x;
+  y = other1.y;
   return *this;
 }
-void RObject::printTo(std::ostream& out) const {
+void Point::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "RObject(";
-  out << "objId=" << to_string(objId);
-  out << ", " << "flags="; (__isset.flags ? (out << to_string(flags)) : (out << "<null>"));
-  out << ", " << "objInfo="; (__isset.objInfo ? (out << to_string(objInfo)) : (out << "<null>"));
+  out << "Point(";
+  out << "x=" << to_string(x);
+  out << ", " << "y=" << to_string(y);
   out << ")";
 }
 
 
-ResponseHeaders::~ResponseHeaders() noexcept {
+Rect::~Rect() noexcept {
 }
 
 
-void ResponseHeaders::__set_length(const int32_t val) {
-  this->length = val;
-__isset.length = true;
+void Rect::__set_x(const int32_t val) {
+  this->x = val;
 }
 
-void ResponseHeaders::__set_redirectUrl(const std::string& val) {
-  this->redirectUrl = val;
-__isset.redirectUrl = true;
+void Rect::__set_y(const int32_t val) {
+  this->y = val;
 }
-std::ostream& operator<<(std::ostream& out, const ResponseHeaders& obj)
+
+void Rect::__set_w(const int32_t val) {
+  this->w = val;
+}
+
+void Rect::__set_h(const int32_t val) {
+  this->h = val;
+}
+std::ostream& operator<<(std::ostream& out, const Rect& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t ResponseHeaders::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t Rect::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -209,6 +167,10 @@ uint32_t ResponseHeaders::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
+  bool isset_x = false;
+  bool isset_y = false;
+  bool isset_w = false;
+  bool isset_h = false;
 
   while (true)
   {
@@ -220,16 +182,32 @@ uint32_t ResponseHeaders::read(::apache::thrift::protocol::TProtocol* iprot) {
     {
       case 1:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->length);
-          this->__isset.length = true;
+          xfer += iprot->readI32(this->x);
+          isset_x = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
-        if (ftype == ::apache::thrift::protocol::T_STRING) {
-          xfer += iprot->readString(this->redirectUrl);
-          this->__isset.redirectUrl = true;
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->y);
+          isset_y = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->w);
+          isset_w = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->h);
+          isset_h = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -243,82 +221,110 @@ uint32_t ResponseHeaders::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
+  if (!isset_x)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_y)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_w)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_h)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t ResponseHeaders::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t Rect::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("ResponseHeaders");
+  xfer += oprot->writeStructBegin("Rect");
+
+  xfer += oprot->writeFieldBegin("x", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->x);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("y", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->y);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("w", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->w);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("h", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->h);
+  xfer += oprot->writeFieldEnd();
 
-  if (this->__isset.length) {
-    xfer += oprot->writeFieldBegin("length", ::apache::thrift::protocol::T_I32, 1);
-    xfer += oprot->writeI32(this->length);
-    xfer += oprot->writeFieldEnd();
-  }
-  if (this->__isset.redirectUrl) {
-    xfer += oprot->writeFieldBegin("redirectUrl", ::apache::thrift::protocol::T_STRING, 2);
-    xfer += oprot->writeString(this->redirectUrl);
-    xfer += oprot->writeFieldEnd();
-  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(ResponseHeaders &a, ResponseHeaders &b) {
+void swap(Rect &a, Rect &b) {
   using ::std::swap;
-  swap(a.length, b.length);
-  swap(a.redirectUrl, b.redirectUrl);
-  swap(a.__isset, b.__isset);
-}
-
-ResponseHeaders::ResponseHeaders(const ResponseHeaders& other10) {
-  length = other10.length;
-  redirectUrl = other10.redirectUrl;
-  __isset = other10.__isset;
-}
-ResponseHeaders& ResponseHeaders::operator=(const ResponseHeaders& other11) {
-  length = other11.length;
-  redirectUrl = other11.redirectUrl;
-  __isset = other11.__isset;
+  swap(a.x, b.x);
+  swap(a.y, b.y);
+  swap(a.w, b.w);
+  swap(a.h, b.h);
+}
+
+Rect::Rect(const Rect& other2) noexcept {
+  x = other2.x;
+  y = other2.y;
+  w = other2.w;
+  h = other2.h;
+}
+Rect& Rect::operator=(const Rect& other3) noexcept {
+  x = other3.x;
+  y = other3.y;
+  w = other3.w;
+  h = other3.h;
   return *this;
 }
-void ResponseHeaders::printTo(std::ostream& out) const {
+void Rect::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "ResponseHeaders(";
-  out << "length="; (__isset.length ? (out << to_string(length)) : (out << "<null>"));
-  out << ", " << "redirectUrl="; (__isset.redirectUrl ? (out << to_string(redirectUrl)) : (out << "<null>"));
+  out << "Rect(";
+  out << "x=" << to_string(x);
+  out << ", " << "y=" << to_string(y);
+  out << ", " << "w=" << to_string(w);
+  out << ", " << "h=" << to_string(h);
   out << ")";
 }
 
 
-ResponseData::~ResponseData() noexcept {
+ScreenInfo::~ScreenInfo() noexcept {
 }
 
 
-void ResponseData::__set_continueRead(const bool val) {
-  this->continueRead = val;
-__isset.continueRead = true;
+void ScreenInfo::__set_device_scale_factor(const double val) {
+  this->device_scale_factor = val;
 }
 
-void ResponseData::__set_data(const std::string& val) {
-  this->data = val;
-__isset.data = true;
+void ScreenInfo::__set_depth(const int32_t val) {
+  this->depth = val;
 }
 
-void ResponseData::__set_bytes_read(const int32_t val) {
-  this->bytes_read = val;
-__isset.bytes_read = true;
+void ScreenInfo::__set_depth_per_component(const int32_t val) {
+  this->depth_per_component = val;
 }
-std::ostream& operator<<(std::ostream& out, const ResponseData& obj)
+
+void ScreenInfo::__set_is_monochrome(const bool val) {
+  this->is_monochrome = val;
+}
+
+void ScreenInfo::__set_rect(const Rect& val) {
+  this->rect = val;
+}
+
+void ScreenInfo::__set_available_rect(const Rect& val) {
+  this->available_rect = val;
+}
+std::ostream& operator<<(std::ostream& out, const ScreenInfo& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t ResponseData::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ScreenInfo::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -330,6 +336,12 @@ uint32_t ResponseData::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
+  bool isset_device_scale_factor = false;
+  bool isset_depth = false;
+  bool isset_depth_per_component = false;
+  bool isset_is_monochrome = false;
+  bool isset_rect = false;
+  bool isset_available_rect = false;
 
   while (true)
   {
@@ -340,25 +352,49 @@ uint32_t ResponseData::read(::apache::thrift::protocol::TProtocol* iprot) {
     switch (fid)
     {
       case 1:
-        if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->continueRead);
-          this->__isset.continueRead = true;
+        if (ftype == ::apache::thrift::protocol::T_DOUBLE) {
+          xfer += iprot->readDouble(this->device_scale_factor);
+          isset_device_scale_factor = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
-        if (ftype == ::apache::thrift::protocol::T_STRING) {
-          xfer += iprot->readBinary(this->data);
-          this->__isset.data = true;
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->depth);
+          isset_depth = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 3:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->bytes_read);
-          this->__isset.bytes_read = true;
+          xfer += iprot->readI32(this->depth_per_component);
+          isset_depth_per_component = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->is_monochrome);
+          isset_is_monochrome = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->rect.read(iprot);
+          isset_rect = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->available_rect.read(iprot);
+          isset_available_rect = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -372,90 +408,114 @@ uint32_t ResponseData::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
+  if (!isset_device_scale_factor)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_depth)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_depth_per_component)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_is_monochrome)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_rect)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_available_rect)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t ResponseData::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ScreenInfo::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("ResponseData");
+  xfer += oprot->writeStructBegin("ScreenInfo");
+
+  xfer += oprot->writeFieldBegin("device_scale_factor", ::apache::thrift::protocol::T_DOUBLE, 1);
+  xfer += oprot->writeDouble(this->device_scale_factor);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("depth", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->depth);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("depth_per_component", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->depth_per_component);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("is_monochrome", ::apache::thrift::protocol::T_BOOL, 4);
+  xfer += oprot->writeBool(this->is_monochrome);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("rect", ::apache::thrift::protocol::T_STRUCT, 5);
+  xfer += this->rect.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("available_rect", ::apache::thrift::protocol::T_STRUCT, 6);
+  xfer += this->available_rect.write(oprot);
+  xfer += oprot->writeFieldEnd();
 
-  if (this->__isset.continueRead) {
-    xfer += oprot->writeFieldBegin("continueRead", ::apache::thrift::protocol::T_BOOL, 1);
-    xfer += oprot->writeBool(this->continueRead);
-    xfer += oprot->writeFieldEnd();
-  }
-  if (this->__isset.data) {
-    xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 2);
-    xfer += oprot->writeBinary(this->data);
-    xfer += oprot->writeFieldEnd();
-  }
-  if (this->__isset.bytes_read) {
-    xfer += oprot->writeFieldBegin("bytes_read", ::apache::thrift::protocol::T_I32, 3);
-    xfer += oprot->writeI32(this->bytes_read);
-    xfer += oprot->writeFieldEnd();
-  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(ResponseData &a, ResponseData &b) {
+void swap(ScreenInfo &a, ScreenInfo &b) {
   using ::std::swap;
-  swap(a.continueRead, b.continueRead);
-  swap(a.data, b.data);
-  swap(a.bytes_read, b.bytes_read);
-  swap(a.__isset, b.__isset);
-}
-
-ResponseData::ResponseData(const ResponseData& other12) {
-  continueRead = other12.continueRead;
-  data = other12.data;
-  bytes_read = other12.bytes_read;
-  __isset = other12.__isset;
-}
-ResponseData& ResponseData::operator=(const ResponseData& other13) {
-  continueRead = other13.continueRead;
-  data = other13.data;
-  bytes_read = other13.bytes_read;
-  __isset = other13.__isset;
+  swap(a.device_scale_factor, b.device_scale_factor);
+  swap(a.depth, b.depth);
+  swap(a.depth_per_component, b.depth_per_component);
+  swap(a.is_monochrome, b.is_monochrome);
+  swap(a.rect, b.rect);
+  swap(a.available_rect, b.available_rect);
+}
+
+ScreenInfo::ScreenInfo(const ScreenInfo& other4) noexcept {
+  device_scale_factor = other4.device_scale_factor;
+  depth = other4.depth;
+  depth_per_component = other4.depth_per_component;
+  is_monochrome = other4.is_monochrome;
+  rect = other4.rect;
+  available_rect = other4.available_rect;
+}
+ScreenInfo& ScreenInfo::operator=(const ScreenInfo& other5) noexcept {
+  device_scale_factor = other5.device_scale_factor;
+  depth = other5.depth;
+  depth_per_component = other5.depth_per_component;
+  is_monochrome = other5.is_monochrome;
+  rect = other5.rect;
+  available_rect = other5.available_rect;
   return *this;
 }
-void ResponseData::printTo(std::ostream& out) const {
+void ScreenInfo::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "ResponseData(";
-  out << "continueRead="; (__isset.continueRead ? (out << to_string(continueRead)) : (out << "<null>"));
-  out << ", " << "data="; (__isset.data ? (out << to_string(data)) : (out << "<null>"));
-  out << ", " << "bytes_read="; (__isset.bytes_read ? (out << to_string(bytes_read)) : (out << "<null>"));
+  out << "ScreenInfo(";
+  out << "device_scale_factor=" << to_string(device_scale_factor);
+  out << ", " << "depth=" << to_string(depth);
+  out << ", " << "depth_per_component=" << to_string(depth_per_component);
+  out << ", " << "is_monochrome=" << to_string(is_monochrome);
+  out << ", " << "rect=" << to_string(rect);
+  out << ", " << "available_rect=" << to_string(available_rect);
   out << ")";
 }
 
 
-PostDataElement::~PostDataElement() noexcept {
+ResourceRule::~ResourceRule() noexcept {
 }
 
 
-void PostDataElement::__set_isReadOnly(const bool val) {
-  this->isReadOnly = val;
-}
-
-void PostDataElement::__set_file(const std::string& val) {
-  this->file = val;
-__isset.file = true;
+void ResourceRule::__set_urlPattern(const std::string& val) {
+  this->urlPattern = val;
 }
 
-void PostDataElement::__set_bytes(const std::string& val) {
-  this->bytes = val;
-__isset.bytes = true;
+void ResourceRule::__set_action(const int32_t val) {
+  this->action = val;
 }
-std::ostream& operator<<(std::ostream& out, const PostDataElement& obj)
+std::ostream& operator<<(std::ostream& out, const ResourceRule& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t PostDataElement::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ResourceRule::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -467,7 +527,8 @@ uint32_t PostDataElement::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
-  bool isset_isReadOnly = false;
+  bool isset_urlPattern = false;
+  bool isset_action = false;
 
   while (true)
   {
@@ -478,25 +539,17 @@ uint32_t PostDataElement::read(::apache::thrift::protocol::TProtocol* iprot) {
     switch (fid)
     {
       case 1:
-        if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->isReadOnly);
-          isset_isReadOnly = true;
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->urlPattern);
+          isset_urlPattern = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
-        if (ftype == ::apache::thrift::protocol::T_STRING) {
-          xfer += iprot->readString(this->file);
-          this->__isset.file = true;
-        } else {
-          xfer += iprot->skip(ftype);
-        }
-        break;
-      case 3:
-        if (ftype == ::apache::thrift::protocol::T_STRING) {
-          xfer += iprot->readBinary(this->bytes);
-          this->__isset.bytes = true;
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->action);
+          isset_action = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -510,90 +563,116 @@ uint32_t PostDataElement::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
-  if (!isset_isReadOnly)
+  if (!isset_urlPattern)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_action)
     throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t PostDataElement::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ResourceRule::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("PostDataElement");
+  xfer += oprot->writeStructBegin("ResourceRule");
 
-  xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 1);
-  xfer += oprot->writeBool(this->isReadOnly);
+  xfer += oprot->writeFieldBegin("urlPattern", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->urlPattern);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("action", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->action);
   xfer += oprot->writeFieldEnd();
 
-  if (this->__isset.file) {
-    xfer += oprot->writeFieldBegin("file", ::apache::thrift::protocol::T_STRING, 2);
-    xfer += oprot->writeString(this->file);
-    xfer += oprot->writeFieldEnd();
-  }
-  if (this->__isset.bytes) {
-    xfer += oprot->writeFieldBegin("bytes", ::apache::thrift::protocol::T_STRING, 3);
-    xfer += oprot->writeBinary(this->bytes);
-    xfer += oprot->writeFieldEnd();
-  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-void swap(PostDataElement &a, PostDataElement &b) {
+void swap(ResourceRule &a, ResourceRule &b) {
   using ::std::swap;
-  swap(a.isReadOnly, b.isReadOnly);
-  swap(a.file, b.file);
-  swap(a.bytes, b.bytes);
-  swap(a.__isset, b.__isset);
+  swap(a.urlPattern, b.urlPattern);
+  swap(a.action, b.action);
 }
 
-PostDataElement::PostDataElement(const PostDataElement& other14) {
-  isReadOnly = other14.isReadOnly;
-  file = other14.file;
-  bytes = other14.bytes;
-  __isset = other14.__isset;
+ResourceRule::ResourceRule(const ResourceRule& other6) {
+  urlPattern = other6.urlPattern;
+  action = other6.action;
 }
-PostDataElement& PostDataElement::operator=(const PostDataElement& other15) {
-  isReadOnly = other15.isReadOnly;
-  file = other15.file;
-  bytes = other15.bytes;
-  __isset = other15.__isset;
+ResourceRule& ResourceRule::operator=(const ResourceRule& other7) {
+  urlPattern = other7.urlPattern;
+  action = other7.action;
   return *this;
 }
-void PostDataElement::printTo(std::ostream& out) const {
+void ResourceRule::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "PostDataElement(";
-  out << "isReadOnly=" << to_string(isReadOnly);
-  out << ", " << "file="; (__isset.file ? (out << to_string(file)) : (out << "<null>"));
-  out << ", " << "bytes="; (__isset.bytes ? (out << to_string(bytes)) : (out << "<null>"));
+  out << "ResourceRule(";
+  out << "urlPattern=" << to_string(urlPattern);
+  out << ", " << "action=" << to_string(action);
   out << ")";
 }
 
 
-PostData::~PostData() noexcept {
+RequestInfo::~RequestInfo() noexcept {
 }
 
 
-void PostData::__set_isReadOnly(const bool val) {
+void RequestInfo::__set_identifier(const int64_t val) {
+  this->identifier = val;
+__isset.identifier = true;
+}
+
+void RequestInfo::__set_isReadOnly(const bool val) {
   this->isReadOnly = val;
+__isset.isReadOnly = true;
 }
 
-void PostData::__set_hasExcludedElements(const bool val) {
-  this->hasExcludedElements = val;
+void RequestInfo::__set_url(const std::string& val) {
+  this->url = val;
+__isset.url = true;
 }
 
-void PostData::__set_elements(const std::vector<PostDataElement> & val) {
-  this->elements = val;
-__isset.elements = true;
+void RequestInfo::__set_method(const std::string& val) {
+  this->method = val;
+__isset.method = true;
 }
-std::ostream& operator<<(std::ostream& out, const PostData& obj)
+
+void RequestInfo::__set_referrerUrl(const std::string& val) {
+  this->referrerUrl = val;
+__isset.referrerUrl = true;
+}
+
+void RequestInfo::__set_referrerPolicy(const int32_t val) {
+  this->referrerPolicy = val;
+__isset.referrerPolicy = true;
+}
+
+void RequestInfo::__set_flags(const int32_t val) {
+  this->flags = val;
+__isset.flags = true;
+}
+
+void RequestInfo::__set_firstPartyForCookies(const std::string& val) {
+  this->firstPartyForCookies = val;
+__isset.firstPartyForCookies = true;
+}
+
+void RequestInfo::__set_resourceType(const int32_t val) {
+  this->resourceType = val;
+__isset.resourceType = true;
+}
+
+void RequestInfo::__set_transitionType(const int32_t val) {
+  this->transitionType = val;
+__isset.transitionType = true;
+}
+std::ostream& operator<<(std::ostream& out, const RequestInfo& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t PostData::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t RequestInfo::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -605,8 +684,6 @@ uint32_t PostData::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
-  bool isset_isReadOnly = false;
-  bool isset_hasExcludedElements = false;
 
   while (true)
   {
@@ -617,37 +694,81 @@ uint32_t PostData::read(::apache::thrift::protocol::TProtocol* iprot) {
     switch (fid)
     {
       case 1:
-        if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->isReadOnly);
-          isset_isReadOnly = true;
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->identifier);
+          this->__isset.identifier = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
         if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->hasExcludedElements);
-          isset_hasExcludedElements = true;
+          xfer += iprot->readBool(this->isReadOnly);
+          this->__isset.isReadOnly = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 3:
-        if (ftype == ::apache::thrift::protocol::T_LIST) {
-          {
-            this->elements.clear();
-            uint32_t _size16;
-            ::apache::thrift::protocol::TType _etype19;
-            xfer += iprot->readListBegin(_etype19, _size16);
-            this->elements.resize(_size16);
-            uint32_t _i20;
-            for (_i20 = 0; _i20 < _size16; ++_i20)
-            {
-              xfer += this->elements[_i20].read(iprot);
-            }
-            xfer += iprot->readListEnd();
-          }
-          this->__isset.elements = true;
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->url);
+          this->__isset.url = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->method);
+          this->__isset.method = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->referrerUrl);
+          this->__isset.referrerUrl = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->referrerPolicy);
+          this->__isset.referrerPolicy = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->flags);
+          this->__isset.flags = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->firstPartyForCookies);
+          this->__isset.firstPartyForCookies = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->resourceType);
+          this->__isset.resourceType = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 10:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->transitionType);
+          this->__isset.transitionType = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -661,37 +782,62 @@ uint32_t PostData::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
-  if (!isset_isReadOnly)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_hasExcludedElements)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t PostData::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t RequestInfo::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("PostData");
-
-  xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 1);
-  xfer += oprot->writeBool(this->isReadOnly);
-  xfer += oprot->writeFieldEnd();
-
-  xfer += oprot->writeFieldBegin("hasExcludedElements", ::apache::thrift::protocol::T_BOOL, 2);
-  xfer += oprot->writeBool(this->hasExcludedElements);
-  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeStructBegin("RequestInfo");
 
-  if (this->__isset.elements) {
-    xfer += oprot->writeFieldBegin("elements", ::apache::thrift::protocol::T_LIST, 3);
-    {
-      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->elements.size()));
-      std::vector<PostDataElement> ::const_iterator _iter21;
-      for (_iter21 = this->elements.begin(); _iter21 != this->elements.end(); ++_iter21)
-      {
-        xfer += (*_iter21).write(oprot);
-      }
-      xfer += oprot->writeListEnd();
-    }
+  if (this->__isset.identifier) {
+    xfer += oprot->writeFieldBegin("identifier", ::apache::thrift::protocol::T_I64, 1);
+    xfer += oprot->writeI64(this->identifier);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.isReadOnly) {
+    xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 2);
+    xfer += oprot->writeBool(this->isReadOnly);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.url) {
+    xfer += oprot->writeFieldBegin("url", ::apache::thrift::protocol::T_STRING, 3);
+    xfer += oprot->writeString(this->url);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.method) {
+    xfer += oprot->writeFieldBegin("method", ::apache::thrift::protocol::T_STRING, 4);
+    xfer += oprot->writeString(this->method);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.referrerUrl) {
+    xfer += oprot->writeFieldBegin("referrerUrl", ::apache::thrift::protocol::T_STRING, 5);
+    xfer += oprot->writeString(this->referrerUrl);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.referrerPolicy) {
+    xfer += oprot->writeFieldBegin("referrerPolicy", ::apache::thrift::protocol::T_I32, 6);
+    xfer += oprot->writeI32(this->referrerPolicy);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.flags) {
+    xfer += oprot->writeFieldBegin("flags", ::apache::thrift::protocol::T_I32, 7);
+    xfer += oprot->writeI32(this->flags);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.firstPartyForCookies) {
+    xfer += oprot->writeFieldBegin("firstPartyForCookies", ::apache::thrift::protocol::T_STRING, 8);
+    xfer += oprot->writeString(this->firstPartyForCookies);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.resourceType) {
+    xfer += oprot->writeFieldBegin("resourceType", ::apache::thrift::protocol::T_I32, 9);
+    xfer += oprot->writeI32(this->resourceType);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.transitionType) {
+    xfer += oprot->writeFieldBegin("transitionType", ::apache::thrift::protocol::T_I32, 10);
+    xfer += oprot->writeI32(this->transitionType);
     xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
@@ -699,80 +845,101 @@ uint32_t PostData::write(::apache::thrift::protocol::TProtocol* oprot) const {
   return xfer;
 }
 
-void swap(PostData &a, PostData &b) {
+void swap(RequestInfo &a, RequestInfo &b) {
   using ::std::swap;
+  swap(a.identifier, b.identifier);
   swap(a.isReadOnly, b.isReadOnly);
-  swap(a.hasExcludedElements, b.hasExcludedElements);
-  swap(a.elements, b.elements);
+  swap(a.url, b.url);
+  swap(a.method, b.method);
+  swap(a.referrerUrl, b.referrerUrl);
+  swap(a.referrerPolicy, b.referrerPolicy);
+  swap(a.flags, b.flags);
+  swap(a.firstPartyForCookies, b.firstPartyForCookies);
+  swap(a.resourceType, b.resourceType);
+  swap(a.transitionType, b.transitionType);
   swap(a.__isset, b.__isset);
 }
 
-PostData::PostData(const PostData& other22) {
-  isReadOnly = other22.isReadOnly;
-  hasExcludedElements = other22.hasExcludedElements;
-  elements = other22.elements;
-  __isset = other22.__isset;
+RequestInfo::RequestInfo(const RequestInfo& other8) {
+  identifier = other8.identifier;
+  isReadOnly = other8.isReadOnly;
+  url = other8.url;
+  method = other8.method;
+  referrerUrl = other8.referrerUrl;
+  referrerPolicy = other8.referrerPolicy;
+  flags = other8.flags;
+  firstPartyForCookies = other8.firstPartyForCookies;
+  resourceType = other8.resourceType;
+  transitionType = other8.transitionType;
+  __isset = other8.__isset;
 }
-PostData& PostData::operator=(const PostData& other23) {
-  isReadOnly = other23.isReadOnly;
-  hasExcludedElements = other23.hasExcludedElements;
-  elements = other23.elements;
-  __isset = other23.__isset;
+RequestInfo& RequestInfo::operator=(const RequestInfo& other9) {
+  identifier = other9.identifier;
+  isReadOnly = other9.isReadOnly;
+  url = other9.url;
+  method = other9.method;
+  referrerUrl = other9.referrerUrl;
+  referrerPolicy = other9.referrerPolicy;
+  flags = other9.flags;
+  firstPartyForCookies = other9.firstPartyForCookies;
+  resourceType = other9.resourceType;
+  transitionType = other9.transitionType;
+  __isset = other9.__isset;
   return *this;
 }
-void PostData::printTo(std::ostream& out) const {
+void RequestInfo::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "PostData(";
-  out << "isReadOnly=" << to_string(isReadOnly);
-  out << ", " << "hasExcludedElements=" << to_string(hasExcludedElements);
-  out << ", " << "elements="; (__isset.elements ? (out << to_string(elements)) : (out << "<null>"));
+  out << "RequestInfo(";
+  out << "identifier="; (__isset.identifier ? (out << to_string(identifier)) : (out << "<null>"));
+  out << ", " << "isReadOnly="; (__isset.isReadOnly ? (out << to_string(isReadOnly)) : (out << "<null>"));
+  out << ", " << "url="; (__isset.url ? (out << to_string(url)) : (out << "<null>"));
+  out << ", " << "method="; (__isset.method ? (out << to_string(method)) : (out << "<null>"));
+  out << ", " << "referrerUrl="; (__isset.referrerUrl ? (out << to_string(referrerUrl)) : (out << "<null>"));
+  out << ", " << "referrerPolicy="; (__isset.referrerPolicy ? (out << to_string(referrerPolicy)) : (out << "<null>"));
+  out << ", " << "flags="; (__isset.flags ? (out << to_string(flags)) : (out << "<null>"));
+  out << ", " << "firstPartyForCookies="; (__isset.firstPartyForCookies ? (out << to_string(firstPartyForCookies)) : (out << "<null>"));
+  out << ", " << "resourceType="; (__isset.resourceType ? (out << to_string(resourceType)) : (out << "<null>"));
+  out << ", " << "transitionType="; (__isset.transitionType ? (out << to_string(transitionType)) : (out << "<null>"));
   out << ")";
 }
 
 
-KeyEvent::~KeyEvent() noexcept {
-}
-
-
-void KeyEvent::__set_type(const std::string& val) {
-  this->type = val;
-}
-
-void KeyEvent::__set_modifiers(const int32_t val) {
-  this->modifiers = val;
+ResponseInfo::~ResponseInfo() noexcept {
 }
 
-void KeyEvent::__set_windows_key_code(const int32_t val) {
-  this->windows_key_code = val;
-}
 
-void KeyEvent::__set_native_key_code(const int32_t val) {
-  this->native_key_code = val;
+void ResponseInfo::__set_isReadOnly(const bool val) {
+  this->isReadOnly = val;
+__isset.isReadOnly = true;
 }
 
-void KeyEvent::__set_is_system_key(const bool val) {
-  this->is_system_key = val;
+void ResponseInfo::__set_status(const int32_t val) {
+  this->status = val;
+__isset.status = true;
 }
 
-void KeyEvent::__set_character(const int16_t val) {
-  this->character = val;
+void ResponseInfo::__set_statusText(const std::string& val) {
+  this->statusText = val;
+__isset.statusText = true;
 }
 
-void KeyEvent::__set_unmodified_character(const int16_t val) {
-  this->unmodified_character = val;
+void ResponseInfo::__set_mimeType(const std::string& val) {
+  this->mimeType = val;
+__isset.mimeType = true;
 }
 
-void KeyEvent::__set_focus_on_editable_field(const bool val) {
-  this->focus_on_editable_field = val;
+void ResponseInfo::__set_error(const int32_t val) {
+  this->error = val;
+__isset.error = true;
 }
-std::ostream& operator<<(std::ostream& out, const KeyEvent& obj)
+std::ostream& operator<<(std::ostream& out, const ResponseInfo& obj)
 {
   obj.printTo(out);
   return out;
 }
 
 
-uint32_t KeyEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
+uint32_t ResponseInfo::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
   uint32_t xfer = 0;
@@ -784,14 +951,6 @@ uint32_t KeyEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   using ::apache::thrift::protocol::TProtocolException;
 
-  bool isset_type = false;
-  bool isset_modifiers = false;
-  bool isset_windows_key_code = false;
-  bool isset_native_key_code = false;
-  bool isset_is_system_key = false;
-  bool isset_character = false;
-  bool isset_unmodified_character = false;
-  bool isset_focus_on_editable_field = false;
 
   while (true)
   {
@@ -802,65 +961,41 @@ uint32_t KeyEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
     switch (fid)
     {
       case 1:
-        if (ftype == ::apache::thrift::protocol::T_STRING) {
-          xfer += iprot->readString(this->type);
-          isset_type = true;
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->isReadOnly);
+          this->__isset.isReadOnly = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 2:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->modifiers);
-          isset_modifiers = true;
+          xfer += iprot->readI32(this->status);
+          this->__isset.status = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 3:
-        if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->windows_key_code);
-          isset_windows_key_code = true;
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->statusText);
+          this->__isset.statusText = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 4:
-        if (ftype == ::apache::thrift::protocol::T_I32) {
-          xfer += iprot->readI32(this->native_key_code);
-          isset_native_key_code = true;
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->mimeType);
+          this->__isset.mimeType = true;
         } else {
           xfer += iprot->skip(ftype);
         }
         break;
       case 5:
-        if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->is_system_key);
-          isset_is_system_key = true;
-        } else {
-          xfer += iprot->skip(ftype);
-        }
-        break;
-      case 6:
-        if (ftype == ::apache::thrift::protocol::T_I16) {
-          xfer += iprot->readI16(this->character);
-          isset_character = true;
-        } else {
-          xfer += iprot->skip(ftype);
-        }
-        break;
-      case 7:
-        if (ftype == ::apache::thrift::protocol::T_I16) {
-          xfer += iprot->readI16(this->unmodified_character);
-          isset_unmodified_character = true;
-        } else {
-          xfer += iprot->skip(ftype);
-        }
-        break;
-      case 8:
-        if (ftype == ::apache::thrift::protocol::T_BOOL) {
-          xfer += iprot->readBool(this->focus_on_editable_field);
-          isset_focus_on_editable_field = true;
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->error);
+          this->__isset.error = true;
         } else {
           xfer += iprot->skip(ftype);
         }
@@ -874,60 +1009,1818 @@ uint32_t KeyEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   xfer += iprot->readStructEnd();
 
-  if (!isset_type)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_modifiers)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_windows_key_code)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_native_key_code)
-    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t ResponseInfo::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ResponseInfo");
+
+  if (this->__isset.isReadOnly) {
+    xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 1);
+    xfer += oprot->writeBool(this->isReadOnly);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.status) {
+    xfer += oprot->writeFieldBegin("status", ::apache::thrift::protocol::T_I32, 2);
+    xfer += oprot->writeI32(this->status);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.statusText) {
+    xfer += oprot->writeFieldBegin("statusText", ::apache::thrift::protocol::T_STRING, 3);
+    xfer += oprot->writeString(this->statusText);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.mimeType) {
+    xfer += oprot->writeFieldBegin("mimeType", ::apache::thrift::protocol::T_STRING, 4);
+    xfer += oprot->writeString(this->mimeType);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.error) {
+    xfer += oprot->writeFieldBegin("error", ::apache::thrift::protocol::T_I32, 5);
+    xfer += oprot->writeI32(this->error);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ResponseInfo &a, ResponseInfo &b) {
+  using ::std::swap;
+  swap(a.isReadOnly, b.isReadOnly);
+  swap(a.status, b.status);
+  swap(a.statusText, b.statusText);
+  swap(a.mimeType, b.mimeType);
+  swap(a.error, b.error);
+  swap(a.__isset, b.__isset);
+}
+
+ResponseInfo::ResponseInfo(const ResponseInfo& other10) {
+  isReadOnly = other10.isReadOnly;
+  status = other10.status;
+  statusText = other10.statusText;
+  mimeType = other10.mimeType;
+  error = other10.error;
+  __isset = other10.__isset;
+}
+ResponseInfo& ResponseInfo::operator=(const ResponseInfo& other11) {
+  isReadOnly = other11.isReadOnly;
+  status = other11.status;
+  statusText = other11.statusText;
+  mimeType = other11.mimeType;
+  error = other11.error;
+  __isset = other11.__isset;
+  return *this;
+}
+void ResponseInfo::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ResponseInfo(";
+  out << "isReadOnly="; (__isset.isReadOnly ? (out << to_string(isReadOnly)) : (out << "<null>"));
+  out << ", " << "status="; (__isset.status ? (out << to_string(status)) : (out << "<null>"));
+  out << ", " << "statusText="; (__isset.statusText ? (out << to_string(statusText)) : (out << "<null>"));
+  out << ", " << "mimeType="; (__isset.mimeType ? (out << to_string(mimeType)) : (out << "<null>"));
+  out << ", " << "error="; (__isset.error ? (out << to_string(error)) : (out << "<null>"));
+  out << ")";
+}
+
+
+RObject::~RObject() noexcept {
+}
+
+
+void RObject::__set_objId(const int32_t val) {
+  this->objId = val;
+}
+
+void RObject::__set_flags(const int32_t val) {
+  this->flags = val;
+__isset.flags = true;
+}
+
+void RObject::__set_objInfo(const std::map<std::string, std::string> & val) {
+  this->objInfo = val;
+__isset.objInfo = true;
+}
+
+void RObject::__set_requestInfo(const RequestInfo& val) {
+  this->requestInfo = val;
+__isset.requestInfo = true;
+}
+
+void RObject::__set_responseInfo(const ResponseInfo& val) {
+  this->responseInfo = val;
+__isset.responseInfo = true;
+}
+std::ostream& operator<<(std::ostream& out, const RObject& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t RObject::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_objId = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->objId);
+          isset_objId = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->flags);
+          this->__isset.flags = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->objInfo.clear();
+            uint32_t _size12;
+            ::apache::thrift::protocol::TType _ktype13;
+            ::apache::thrift::protocol::TType _vtype14;
+            xfer += iprot->readMapBegin(_ktype13, _vtype14, _size12);
+            uint32_t _i16;
+            for (_i16 = 0; _i16 < _size12; ++_i16)
+            {
+              std::string _key17;
+              xfer += iprot->readString(_key17);
+              std::string& _val18 = this->objInfo[_key17];
+              xfer += iprot->readString(_val18);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.objInfo = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->requestInfo.read(iprot);
+          this->__isset.requestInfo = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->responseInfo.read(iprot);
+          this->__isset.responseInfo = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_objId)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t RObject::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("RObject");
+
+  xfer += oprot->writeFieldBegin("objId", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->objId);
+  xfer += oprot->writeFieldEnd();
+
+  if (this->__isset.flags) {
+    xfer += oprot->writeFieldBegin("flags", ::apache::thrift::protocol::T_I32, 2);
+    xfer += oprot->writeI32(this->flags);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.objInfo) {
+    xfer += oprot->writeFieldBegin("objInfo", ::apache::thrift::protocol::T_MAP, 3);
+    {
+      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->objInfo.size()));
+      std::map<std::string, std::string> ::const_iterator _iter19;
+      for (_iter19 = this->objInfo.begin(); _iter19 != this->objInfo.end(); ++_iter19)
+      {
+        xfer += oprot->writeString(_iter19->first);
+        xfer += oprot->writeString(_iter19->second);
+      }
+      xfer += oprot->writeMapEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.requestInfo) {
+    xfer += oprot->writeFieldBegin("requestInfo", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->requestInfo.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.responseInfo) {
+    xfer += oprot->writeFieldBegin("responseInfo", ::apache::thrift::protocol::T_STRUCT, 5);
+    xfer += this->responseInfo.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(RObject &a, RObject &b) {
+  using ::std::swap;
+  swap(a.objId, b.objId);
+  swap(a.flags, b.flags);
+  swap(a.objInfo, b.objInfo);
+  swap(a.requestInfo, b.requestInfo);
+  swap(a.responseInfo, b.responseInfo);
+  swap(a.__isset, b.__isset);
+}
+
+RObject::RObject(const RObject& other20) {
+  objId = other20.objId;
+  flags = other20.flags;
+  objInfo = other20.objInfo;
+  requestInfo = other20.requestInfo;
+  responseInfo = other20.responseInfo;
+  __isset = other20.__isset;
+}
+RObject& RObject::operator=(const RObject& other21) {
+  objId = other21.objId;
+  flags = other21.flags;
+  objInfo = other21.objInfo;
+  requestInfo = other21.requestInfo;
+  responseInfo = other21.responseInfo;
+  __isset = other21.__isset;
+  return *this;
+}
+void RObject::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "RObject(";
+  out << "objId=" << to_string(objId);
+  out << ", " << "flags="; (__isset.flags ? (out << to_string(flags)) : (out << "<null>"));
+  out << ", " << "objInfo="; (__isset.objInfo ? (out << to_string(objInfo)) : (out << "<null>"));
+  out << ", " << "requestInfo="; (__isset.requestInfo ? (out << to_string(requestInfo)) : (out << "<null>"));
+  out << ", " << "responseInfo="; (__isset.responseInfo ? (out << to_string(responseInfo)) : (out << "<null>"));
+  out << ")";
+}
+
+
+ResponseHeaders::~ResponseHeaders() noexcept {
+}
+
+
+void ResponseHeaders::__set_length(const int32_t val) {
+  this->length = val;
+__isset.length = true;
+}
+
+void ResponseHeaders::__set_redirectUrl(const std::string& val) {
+  this->redirectUrl = val;
+__isset.redirectUrl = true;
+}
+std::ostream& operator<<(std::ostream& out, const ResponseHeaders& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ResponseHeaders::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->length);
+          this->__isset.length = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->redirectUrl);
+          this->__isset.redirectUrl = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ResponseHeaders::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ResponseHeaders");
+
+  if (this->__isset.length) {
+    xfer += oprot->writeFieldBegin("length", ::apache::thrift::protocol::T_I32, 1);
+    xfer += oprot->writeI32(this->length);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.redirectUrl) {
+    xfer += oprot->writeFieldBegin("redirectUrl", ::apache::thrift::protocol::T_STRING, 2);
+    xfer += oprot->writeString(this->redirectUrl);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ResponseHeaders &a, ResponseHeaders &b) {
+  using ::std::swap;
+  swap(a.length, b.length);
+  swap(a.redirectUrl, b.redirectUrl);
+  swap(a.__isset, b.__isset);
+}
+
+ResponseHeaders::ResponseHeaders(const ResponseHeaders& other22) {
+  length = other22.length;
+  redirectUrl = other22.redirectUrl;
+  __isset = other22.__isset;
+}
+ResponseHeaders& ResponseHeaders::operator=(const ResponseHeaders& other23) {
+  length = other23.length;
+  redirectUrl = other23.redirectUrl;
+  __isset = other23.__isset;
+  return *this;
+}
+void ResponseHeaders::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ResponseHeaders(";
+  out << "length="; (__isset.length ? (out << to_string(length)) : (out << "<null>"));
+  out << ", " << "redirectUrl="; (__isset.redirectUrl ? (out << to_string(redirectUrl)) : (out << "<null>"));
+  out << ")";
+}
+
+
+ResponseData::~ResponseData() noexcept {
+}
+
+
+void ResponseData::__set_continueRead(const bool val) {
+  this->continueRead = val;
+__isset.continueRead = true;
+}
+
+void ResponseData::__set_data(const std::string& val) {
+  this->data = val;
+__isset.data = true;
+}
+
+void ResponseData::__set_bytes_read(const int32_t val) {
+  this->bytes_read = val;
+__isset.bytes_read = true;
+}
+std::ostream& operator<<(std::ostream& out, const ResponseData& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ResponseData::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->continueRead);
+          this->__isset.continueRead = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->data);
+          this->__isset.data = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bytes_read);
+          this->__isset.bytes_read = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ResponseData::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ResponseData");
+
+  if (this->__isset.continueRead) {
+    xfer += oprot->writeFieldBegin("continueRead", ::apache::thrift::protocol::T_BOOL, 1);
+    xfer += oprot->writeBool(this->continueRead);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.data) {
+    xfer += oprot->writeFieldBegin("data", ::apache::thrift::protocol::T_STRING, 2);
+    xfer += oprot->writeBinary(this->data);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.bytes_read) {
+    xfer += oprot->writeFieldBegin("bytes_read", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->bytes_read);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ResponseData &a, ResponseData &b) {
+  using ::std::swap;
+  swap(a.continueRead, b.continueRead);
+  swap(a.data, b.data);
+  swap(a.bytes_read, b.bytes_read);
+  swap(a.__isset, b.__isset);
+}
+
+ResponseData::ResponseData(const ResponseData& other24) {
+  continueRead = other24.continueRead;
+  data = other24.data;
+  bytes_read = other24.bytes_read;
+  __isset = other24.__isset;
+}
+ResponseData& ResponseData::operator=(const ResponseData& other25) {
+  continueRead = other25.continueRead;
+  data = other25.data;
+  bytes_read = other25.bytes_read;
+  __isset = other25.__isset;
+  return *this;
+}
+void ResponseData::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ResponseData(";
+  out << "continueRead="; (__isset.continueRead ? (out << to_string(continueRead)) : (out << "<null>"));
+  out << ", " << "data="; (__isset.data ? (out << to_string(data)) : (out << "<null>"));
+  out << ", " << "bytes_read="; (__isset.bytes_read ? (out << to_string(bytes_read)) : (out << "<null>"));
+  out << ")";
+}
+
+
+PostDataElement::~PostDataElement() noexcept {
+}
+
+
+void PostDataElement::__set_isReadOnly(const bool val) {
+  this->isReadOnly = val;
+}
+
+void PostDataElement::__set_file(const std::string& val) {
+  this->file = val;
+__isset.file = true;
+}
+
+void PostDataElement::__set_bytes(const std::string& val) {
+  this->bytes = val;
+__isset.bytes = true;
+}
+std::ostream& operator<<(std::ostream& out, const PostDataElement& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t PostDataElement::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_isReadOnly = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->isReadOnly);
+          isset_isReadOnly = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->file);
+          this->__isset.file = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readBinary(this->bytes);
+          this->__isset.bytes = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_isReadOnly)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t PostDataElement::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("PostDataElement");
+
+  xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 1);
+  xfer += oprot->writeBool(this->isReadOnly);
+  xfer += oprot->writeFieldEnd();
+
+  if (this->__isset.file) {
+    xfer += oprot->writeFieldBegin("file", ::apache::thrift::protocol::T_STRING, 2);
+    xfer += oprot->writeString(this->file);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.bytes) {
+    xfer += oprot->writeFieldBegin("bytes", ::apache::thrift::protocol::T_STRING, 3);
+    xfer += oprot->writeBinary(this->bytes);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(PostDataElement &a, PostDataElement &b) {
+  using ::std::swap;
+  swap(a.isReadOnly, b.isReadOnly);
+  swap(a.file, b.file);
+  swap(a.bytes, b.bytes);
+  swap(a.__isset, b.__isset);
+}
+
+PostDataElement::PostDataElement(const PostDataElement& other26) {
+  isReadOnly = other26.isReadOnly;
+  file = other26.file;
+  bytes = other26.bytes;
+  __isset = other26.__isset;
+}
+PostDataElement& PostDataElement::operator=(const PostDataElement& other27) {
+  isReadOnly = other27.isReadOnly;
+  file = other27.file;
+  bytes = other27.bytes;
+  __isset = other27.__isset;
+  return *this;
+}
+void PostDataElement::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "PostDataElement(";
+  out << "isReadOnly=" << to_string(isReadOnly);
+  out << ", " << "file="; (__isset.file ? (out << to_string(file)) : (out << "<null>"));
+  out << ", " << "bytes="; (__isset.bytes ? (out << to_string(bytes)) : (out << "<null>"));
+  out << ")";
+}
+
+
+PostData::~PostData() noexcept {
+}
+
+
+void PostData::__set_isReadOnly(const bool val) {
+  this->isReadOnly = val;
+}
+
+void PostData::__set_hasExcludedElements(const bool val) {
+  this->hasExcludedElements = val;
+}
+
+void PostData::__set_elements(const std::vector<PostDataElement> & val) {
+  this->elements = val;
+__isset.elements = true;
+}
+std::ostream& operator<<(std::ostream& out, const PostData& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t PostData::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_isReadOnly = false;
+  bool isset_hasExcludedElements = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->isReadOnly);
+          isset_isReadOnly = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->hasExcludedElements);
+          isset_hasExcludedElements = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->elements.clear();
+            uint32_t _size28;
+            ::apache::thrift::protocol::TType _etype31;
+            xfer += iprot->readListBegin(_etype31, _size28);
+            this->elements.resize(_size28);
+            uint32_t _i32;
+            for (_i32 = 0; _i32 < _size28; ++_i32)
+            {
+              xfer += this->elements[_i32].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.elements = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_isReadOnly)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_hasExcludedElements)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t PostData::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("PostData");
+
+  xfer += oprot->writeFieldBegin("isReadOnly", ::apache::thrift::protocol::T_BOOL, 1);
+  xfer += oprot->writeBool(this->isReadOnly);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("hasExcludedElements", ::apache::thrift::protocol::T_BOOL, 2);
+  xfer += oprot->writeBool(this->hasExcludedElements);
+  xfer += oprot->writeFieldEnd();
+
+  if (this->__isset.elements) {
+    xfer += oprot->writeFieldBegin("elements", ::apache::thrift::protocol::T_LIST, 3);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->elements.size()));
+      std::vector<PostDataElement> ::const_iterator _iter33;
+      for (_iter33 = this->elements.begin(); _iter33 != this->elements.end(); ++_iter33)
+      {
+        xfer += (*_iter33).write(oprot);
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(PostData &a, PostData &b) {
+  using ::std::swap;
+  swap(a.isReadOnly, b.isReadOnly);
+  swap(a.hasExcludedElements, b.hasExcludedElements);
+  swap(a.elements, b.elements);
+  swap(a.__isset, b.__isset);
+}
+
+PostData::PostData(const PostData& other34) {
+  isReadOnly = other34.isReadOnly;
+  hasExcludedElements = other34.hasExcludedElements;
+  elements = other34.elements;
+  __isset = other34.__isset;
+}
+PostData& PostData::operator=(const PostData& other35) {
+  isReadOnly = other35.isReadOnly;
+  hasExcludedElements = other35.hasExcludedElements;
+  elements = other35.elements;
+  __isset = other35.__isset;
+  return *this;
+}
+void PostData::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "PostData(";
+  out << "isReadOnly=" << to_string(isReadOnly);
+  out << ", " << "hasExcludedElements=" << to_string(hasExcludedElements);
+  out << ", " << "elements="; (__isset.elements ? (out << to_string(elements)) : (out << "<null>"));
+  out << ")";
+}
+
+
+KeyEvent::~KeyEvent() noexcept {
+}
+
+
+void KeyEvent::__set_type(const std::string& val) {
+  this->type = val;
+}
+
+void KeyEvent::__set_modifiers(const int32_t val) {
+  this->modifiers = val;
+}
+
+void KeyEvent::__set_windows_key_code(const int32_t val) {
+  this->windows_key_code = val;
+}
+
+void KeyEvent::__set_native_key_code(const int32_t val) {
+  this->native_key_code = val;
+}
+
+void KeyEvent::__set_is_system_key(const bool val) {
+  this->is_system_key = val;
+}
+
+void KeyEvent::__set_character(const int16_t val) {
+  this->character = val;
+}
+
+void KeyEvent::__set_unmodified_character(const int16_t val) {
+  this->unmodified_character = val;
+}
+
+void KeyEvent::__set_focus_on_editable_field(const bool val) {
+  this->focus_on_editable_field = val;
+}
+std::ostream& operator<<(std::ostream& out, const KeyEvent& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t KeyEvent::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_type = false;
+  bool isset_modifiers = false;
+  bool isset_windows_key_code = false;
+  bool isset_native_key_code = false;
+  bool isset_is_system_key = false;
+  bool isset_character = false;
+  bool isset_unmodified_character = false;
+  bool isset_focus_on_editable_field = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->type);
+          isset_type = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->modifiers);
+          isset_modifiers = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->windows_key_code);
+          isset_windows_key_code = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->native_key_code);
+          isset_native_key_code = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->is_system_key);
+          isset_is_system_key = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I16) {
+          xfer += iprot->readI16(this->character);
+          isset_character = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I16) {
+          xfer += iprot->readI16(this->unmodified_character);
+          isset_unmodified_character = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->focus_on_editable_field);
+          isset_focus_on_editable_field = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_type)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_modifiers)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_windows_key_code)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_native_key_code)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
   if (!isset_is_system_key)
     throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_character)
+  if (!isset_character)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_unmodified_character)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_focus_on_editable_field)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t KeyEvent::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("KeyEvent");
+
+  xfer += oprot->writeFieldBegin("type", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->type);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("modifiers", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->modifiers);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("windows_key_code", ::apache::thrift::protocol::T_I32, 3);
+  xfer += oprot->writeI32(this->windows_key_code);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("native_key_code", ::apache::thrift::protocol::T_I32, 4);
+  xfer += oprot->writeI32(this->native_key_code);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("is_system_key", ::apache::thrift::protocol::T_BOOL, 5);
+  xfer += oprot->writeBool(this->is_system_key);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("character", ::apache::thrift::protocol::T_I16, 6);
+  xfer += oprot->writeI16(this->character);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("unmodified_character", ::apache::thrift::protocol::T_I16, 7);
+  xfer += oprot->writeI16(this->unmodified_character);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("focus_on_editable_field", ::apache::thrift::protocol::T_BOOL, 8);
+  xfer += oprot->writeBool(this->focus_on_editable_field);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(KeyEvent &a, KeyEvent &b) {
+  using ::std::swap;
+  swap(a.type, b.type);
+  swap(a.modifiers, b.modifiers);
+  swap(a.windows_key_code, b.windows_key_code);
+  swap(a.native_key_code, b.native_key_code);
+  swap(a.is_system_key, b.is_system_key);
+  swap(a.character, b.character);
+  swap(a.unmodified_character, b.unmodified_character);
+  swap(a.focus_on_editable_field, b.focus_on_editable_field);
+}
+
+KeyEvent::KeyEvent(const KeyEvent& other36) {
+  type = other36.type;
+  modifiers = other36.modifiers;
+  windows_key_code = other36.windows_key_code;
+  native_key_code = other36.native_key_code;
+  is_system_key = other36.is_system_key;
+  character = other36.character;
+  unmodified_character = other36.unmodified_character;
+  focus_on_editable_field = other36.focus_on_editable_field;
+}
+KeyEvent& KeyEvent::operator=(const KeyEvent& other37) {
+  type = other37.type;
+  modifiers = other37.modifiers;
+  windows_key_code = other37.windows_key_code;
+  native_key_code = other37.native_key_code;
+  is_system_key = other37.is_system_key;
+  character = other37.character;
+  unmodified_character = other37.unmodified_character;
+  focus_on_editable_field = other37.focus_on_editable_field;
+  return *this;
+}
+void KeyEvent::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "KeyEvent(";
+  out << "type=" << to_string(type);
+  out << ", " << "modifiers=" << to_string(modifiers);
+  out << ", " << "windows_key_code=" << to_string(windows_key_code);
+  out << ", " << "native_key_code=" << to_string(native_key_code);
+  out << ", " << "is_system_key=" << to_string(is_system_key);
+  out << ", " << "character=" << to_string(character);
+  out << ", " << "unmodified_character=" << to_string(unmodified_character);
+  out << ", " << "focus_on_editable_field=" << to_string(focus_on_editable_field);
+  out << ")";
+}
+
+
+MethodMetrics::~MethodMetrics() noexcept {
+}
+
+
+void MethodMetrics::__set_name(const std::string& val) {
+  this->name = val;
+}
+
+void MethodMetrics::__set_calls(const int64_t val) {
+  this->calls = val;
+}
+
+void MethodMetrics::__set_errors(const int64_t val) {
+  this->errors = val;
+}
+
+void MethodMetrics::__set_totalUs(const int64_t val) {
+  this->totalUs = val;
+}
+
+void MethodMetrics::__set_maxUs(const int64_t val) {
+  this->maxUs = val;
+}
+
+void MethodMetrics::__set_p50Us(const int64_t val) {
+  this->p50Us = val;
+}
+
+void MethodMetrics::__set_p99Us(const int64_t val) {
+  this->p99Us = val;
+}
+
+void MethodMetrics::__set_p999Us(const int64_t val) {
+  this->p999Us = val;
+}
+
+void MethodMetrics::__set_bytesIn(const int64_t val) {
+  this->bytesIn = val;
+__isset.bytesIn = true;
+}
+
+void MethodMetrics::__set_bytesOut(const int64_t val) {
+  this->bytesOut = val;
+__isset.bytesOut = true;
+}
+
+void MethodMetrics::__set_inFlight(const int32_t val) {
+  this->inFlight = val;
+__isset.inFlight = true;
+}
+
+void MethodMetrics::__set_maxInFlight(const int32_t val) {
+  this->maxInFlight = val;
+__isset.maxInFlight = true;
+}
+std::ostream& operator<<(std::ostream& out, const MethodMetrics& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t MethodMetrics::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_name = false;
+  bool isset_calls = false;
+  bool isset_errors = false;
+  bool isset_totalUs = false;
+  bool isset_maxUs = false;
+  bool isset_p50Us = false;
+  bool isset_p99Us = false;
+  bool isset_p999Us = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->name);
+          isset_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->calls);
+          isset_calls = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->errors);
+          isset_errors = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->totalUs);
+          isset_totalUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->maxUs);
+          isset_maxUs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->p50Us);
+          isset_p50Us = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 7:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->p99Us);
+          isset_p99Us = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->p999Us);
+          isset_p999Us = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 9:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->bytesIn);
+          this->__isset.bytesIn = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 10:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->bytesOut);
+          this->__isset.bytesOut = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 11:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->inFlight);
+          this->__isset.inFlight = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 12:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->maxInFlight);
+          this->__isset.maxInFlight = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_name)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_calls)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_errors)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_totalUs)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_maxUs)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_p50Us)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_p99Us)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_p999Us)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t MethodMetrics::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("MethodMetrics");
+
+  xfer += oprot->writeFieldBegin("name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("calls", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->calls);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("errors", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->errors);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("totalUs", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->totalUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("maxUs", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->maxUs);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("p50Us", ::apache::thrift::protocol::T_I64, 6);
+  xfer += oprot->writeI64(this->p50Us);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("p99Us", ::apache::thrift::protocol::T_I64, 7);
+  xfer += oprot->writeI64(this->p99Us);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("p999Us", ::apache::thrift::protocol::T_I64, 8);
+  xfer += oprot->writeI64(this->p999Us);
+  xfer += oprot->writeFieldEnd();
+
+  if (this->__isset.bytesIn) {
+    xfer += oprot->writeFieldBegin("bytesIn", ::apache::thrift::protocol::T_I64, 9);
+    xfer += oprot->writeI64(this->bytesIn);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.bytesOut) {
+    xfer += oprot->writeFieldBegin("bytesOut", ::apache::thrift::protocol::T_I64, 10);
+    xfer += oprot->writeI64(this->bytesOut);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.inFlight) {
+    xfer += oprot->writeFieldBegin("inFlight", ::apache::thrift::protocol::T_I32, 11);
+    xfer += oprot->writeI32(this->inFlight);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.maxInFlight) {
+    xfer += oprot->writeFieldBegin("maxInFlight", ::apache::thrift::protocol::T_I32, 12);
+    xfer += oprot->writeI32(this->maxInFlight);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(MethodMetrics &a, MethodMetrics &b) {
+  using ::std::swap;
+  swap(a.name, b.name);
+  swap(a.calls, b.calls);
+  swap(a.errors, b.errors);
+  swap(a.totalUs, b.totalUs);
+  swap(a.maxUs, b.maxUs);
+  swap(a.p50Us, b.p50Us);
+  swap(a.p99Us, b.p99Us);
+  swap(a.p999Us, b.p999Us);
+  swap(a.bytesIn, b.bytesIn);
+  swap(a.bytesOut, b.bytesOut);
+  swap(a.inFlight, b.inFlight);
+  swap(a.maxInFlight, b.maxInFlight);
+  swap(a.__isset, b.__isset);
+}
+
+MethodMetrics::MethodMetrics(const MethodMetrics& other38) {
+  name = other38.name;
+  calls = other38.calls;
+  errors = other38.errors;
+  totalUs = other38.totalUs;
+  maxUs = other38.maxUs;
+  p50Us = other38.p50Us;
+  p99Us = other38.p99Us;
+  p999Us = other38.p999Us;
+  bytesIn = other38.bytesIn;
+  bytesOut = other38.bytesOut;
+  inFlight = other38.inFlight;
+  maxInFlight = other38.maxInFlight;
+  __isset = other38.__isset;
+}
+MethodMetrics& MethodMetrics::operator=(const MethodMetrics& other39) {
+  name = other39.name;
+  calls = other39.calls;
+  errors = other39.errors;
+  totalUs = other39.totalUs;
+  maxUs = other39.maxUs;
+  p50Us = other39.p50Us;
+  p99Us = other39.p99Us;
+  p999Us = other39.p999Us;
+  bytesIn = other39.bytesIn;
+  bytesOut = other39.bytesOut;
+  inFlight = other39.inFlight;
+  maxInFlight = other39.maxInFlight;
+  __isset = other39.__isset;
+  return *this;
+}
+void MethodMetrics::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "MethodMetrics(";
+  out << "name=" << to_string(name);
+  out << ", " << "calls=" << to_string(calls);
+  out << ", " << "errors=" << to_string(errors);
+  out << ", " << "totalUs=" << to_string(totalUs);
+  out << ", " << "maxUs=" << to_string(maxUs);
+  out << ", " << "p50Us=" << to_string(p50Us);
+  out << ", " << "p99Us=" << to_string(p99Us);
+  out << ", " << "p999Us=" << to_string(p999Us);
+  out << ", " << "bytesIn="; (__isset.bytesIn ? (out << to_string(bytesIn)) : (out << "<null>"));
+  out << ", " << "bytesOut="; (__isset.bytesOut ? (out << to_string(bytesOut)) : (out << "<null>"));
+  out << ", " << "inFlight="; (__isset.inFlight ? (out << to_string(inFlight)) : (out << "<null>"));
+  out << ", " << "maxInFlight="; (__isset.maxInFlight ? (out << to_string(maxInFlight)) : (out << "<null>"));
+  out << ")";
+}
+
+
+ConnectionMetrics::~ConnectionMetrics() noexcept {
+}
+
+
+void ConnectionMetrics::__set_id(const int32_t val) {
+  this->id = val;
+}
+
+void ConnectionMetrics::__set_calls(const int64_t val) {
+  this->calls = val;
+}
+
+void ConnectionMetrics::__set_bytesIn(const int64_t val) {
+  this->bytesIn = val;
+}
+
+void ConnectionMetrics::__set_bytesOut(const int64_t val) {
+  this->bytesOut = val;
+}
+
+void ConnectionMetrics::__set_ageMs(const int64_t val) {
+  this->ageMs = val;
+}
+std::ostream& operator<<(std::ostream& out, const ConnectionMetrics& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ConnectionMetrics::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_id = false;
+  bool isset_calls = false;
+  bool isset_bytesIn = false;
+  bool isset_bytesOut = false;
+  bool isset_ageMs = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->id);
+          isset_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->calls);
+          isset_calls = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->bytesIn);
+          isset_bytesIn = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->bytesOut);
+          isset_bytesOut = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->ageMs);
+          isset_ageMs = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_id)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_calls)
     throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_unmodified_character)
+  if (!isset_bytesIn)
     throw TProtocolException(TProtocolException::INVALID_DATA);
-  if (!isset_focus_on_editable_field)
+  if (!isset_bytesOut)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_ageMs)
     throw TProtocolException(TProtocolException::INVALID_DATA);
   return xfer;
 }
 
-uint32_t KeyEvent::write(::apache::thrift::protocol::TProtocol* oprot) const {
+uint32_t ConnectionMetrics::write(::apache::thrift::protocol::TProtocol* oprot) const {
   uint32_t xfer = 0;
   ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
-  xfer += oprot->writeStructBegin("KeyEvent");
+  xfer += oprot->writeStructBegin("ConnectionMetrics");
 
-  xfer += oprot->writeFieldBegin("type", ::apache::thrift::protocol::T_STRING, 1);
-  xfer += oprot->writeString(this->type);
+  xfer += oprot->writeFieldBegin("id", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->id);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("modifiers", ::apache::thrift::protocol::T_I32, 2);
-  xfer += oprot->writeI32(this->modifiers);
+  xfer += oprot->writeFieldBegin("calls", ::apache::thrift::protocol::T_I64, 2);
+  xfer += oprot->writeI64(this->calls);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("windows_key_code", ::apache::thrift::protocol::T_I32, 3);
-  xfer += oprot->writeI32(this->windows_key_code);
+  xfer += oprot->writeFieldBegin("bytesIn", ::apache::thrift::protocol::T_I64, 3);
+  xfer += oprot->writeI64(this->bytesIn);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("native_key_code", ::apache::thrift::protocol::T_I32, 4);
-  xfer += oprot->writeI32(this->native_key_code);
+  xfer += oprot->writeFieldBegin("bytesOut", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->bytesOut);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("is_system_key", ::apache::thrift::protocol::T_BOOL, 5);
-  xfer += oprot->writeBool(this->is_system_key);
+  xfer += oprot->writeFieldBegin("ageMs", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->ageMs);
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("character", ::apache::thrift::protocol::T_I16, 6);
-  xfer += oprot->writeI16(this->character);
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ConnectionMetrics &a, ConnectionMetrics &b) {
+  using ::std::swap;
+  swap(a.id, b.id);
+  swap(a.calls, b.calls);
+  swap(a.bytesIn, b.bytesIn);
+  swap(a.bytesOut, b.bytesOut);
+  swap(a.ageMs, b.ageMs);
+}
+
+ConnectionMetrics::ConnectionMetrics(const ConnectionMetrics& other40) noexcept {
+  id = other40.id;
+  calls = other40.calls;
+  bytesIn = other40.bytesIn;
+  bytesOut = other40.bytesOut;
+  ageMs = other40.ageMs;
+}
+ConnectionMetrics& ConnectionMetrics::operator=(const ConnectionMetrics& other41) noexcept {
+  id = other41.id;
+  calls = other41.calls;
+  bytesIn = other41.bytesIn;
+  bytesOut = other41.bytesOut;
+  ageMs = other41.ageMs;
+  return *this;
+}
+void ConnectionMetrics::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ConnectionMetrics(";
+  out << "id=" << to_string(id);
+  out << ", " << "calls=" << to_string(calls);
+  out << ", " << "bytesIn=" << to_string(bytesIn);
+  out << ", " << "bytesOut=" << to_string(bytesOut);
+  out << ", " << "ageMs=" << to_string(ageMs);
+  out << ")";
+}
+
+
+ServerMetrics::~ServerMetrics() noexcept {
+}
+
+
+void ServerMetrics::__set_serverMethods(const std::vector<MethodMetrics> & val) {
+  this->serverMethods = val;
+}
+
+void ServerMetrics::__set_clientCallbacks(const std::vector<MethodMetrics> & val) {
+  this->clientCallbacks = val;
+}
+
+void ServerMetrics::__set_counters(const std::map<std::string, int64_t> & val) {
+  this->counters = val;
+}
+
+void ServerMetrics::__set_connections(const std::vector<ConnectionMetrics> & val) {
+  this->connections = val;
+}
+std::ostream& operator<<(std::ostream& out, const ServerMetrics& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ServerMetrics::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->serverMethods.clear();
+            uint32_t _size42;
+            ::apache::thrift::protocol::TType _etype45;
+            xfer += iprot->readListBegin(_etype45, _size42);
+            this->serverMethods.resize(_size42);
+            uint32_t _i46;
+            for (_i46 = 0; _i46 < _size42; ++_i46)
+            {
+              xfer += this->serverMethods[_i46].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.serverMethods = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->clientCallbacks.clear();
+            uint32_t _size47;
+            ::apache::thrift::protocol::TType _etype50;
+            xfer += iprot->readListBegin(_etype50, _size47);
+            this->clientCallbacks.resize(_size47);
+            uint32_t _i51;
+            for (_i51 = 0; _i51 < _size47; ++_i51)
+            {
+              xfer += this->clientCallbacks[_i51].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.clientCallbacks = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->counters.clear();
+            uint32_t _size52;
+            ::apache::thrift::protocol::TType _ktype53;
+            ::apache::thrift::protocol::TType _vtype54;
+            xfer += iprot->readMapBegin(_ktype53, _vtype54, _size52);
+            uint32_t _i56;
+            for (_i56 = 0; _i56 < _size52; ++_i56)
+            {
+              std::string _key57;
+              xfer += iprot->readString(_key57);
+              int64_t& _val58 = this->counters[_key57];
+              xfer += iprot->readI64(_val58);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.counters = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->connections.clear();
+            uint32_t _size59;
+            ::apache::thrift::protocol::TType _etype62;
+            xfer += iprot->readListBegin(_etype62, _size59);
+            this->connections.resize(_size59);
+            uint32_t _i63;
+            for (_i63 = 0; _i63 < _size59; ++_i63)
+            {
+              xfer += this->connections[_i63].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.connections = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ServerMetrics::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ServerMetrics");
+
+  xfer += oprot->writeFieldBegin("serverMethods", ::apache::thrift::protocol::T_LIST, 1);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->serverMethods.size()));
+    std::vector<MethodMetrics> ::const_iterator _iter64;
+    for (_iter64 = this->serverMethods.begin(); _iter64 != this->serverMethods.end(); ++_iter64)
+    {
+      xfer += (*_iter64).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("unmodified_character", ::apache::thrift::protocol::T_I16, 7);
-  xfer += oprot->writeI16(this->unmodified_character);
+  xfer += oprot->writeFieldBegin("clientCallbacks", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->clientCallbacks.size()));
+    std::vector<MethodMetrics> ::const_iterator _iter65;
+    for (_iter65 = this->clientCallbacks.begin(); _iter65 != this->clientCallbacks.end(); ++_iter65)
+    {
+      xfer += (*_iter65).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
   xfer += oprot->writeFieldEnd();
 
-  xfer += oprot->writeFieldBegin("focus_on_editable_field", ::apache::thrift::protocol::T_BOOL, 8);
-  xfer += oprot->writeBool(this->focus_on_editable_field);
+  xfer += oprot->writeFieldBegin("counters", ::apache::thrift::protocol::T_MAP, 3);
+  {
+    xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_STRING, ::apache::thrift::protocol::T_I64, static_cast<uint32_t>(this->counters.size()));
+    std::map<std::string, int64_t> ::const_iterator _iter66;
+    for (_iter66 = this->counters.begin(); _iter66 != this->counters.end(); ++_iter66)
+    {
+      xfer += oprot->writeString(_iter66->first);
+      xfer += oprot->writeI64(_iter66->second);
+    }
+    xfer += oprot->writeMapEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("connections", ::apache::thrift::protocol::T_LIST, 4);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->connections.size()));
+    std::vector<ConnectionMetrics> ::const_iterator _iter67;
+    for (_iter67 = this->connections.begin(); _iter67 != this->connections.end(); ++_iter67)
+    {
+      xfer += (*_iter67).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
   xfer += oprot->writeFieldEnd();
 
   xfer += oprot->writeFieldStop();
@@ -935,50 +2828,37 @@ uint32_t KeyEvent::write(::apache::thrift::protocol::TProtocol* oprot) const {
   return xfer;
 }
 
-void swap(KeyEvent &a, KeyEvent &b) {
+void swap(ServerMetrics &a, ServerMetrics &b) {
   using ::std::swap;
-  swap(a.type, b.type);
-  swap(a.modifiers, b.modifiers);
-  swap(a.windows_key_code, b.windows_key_code);
-  swap(a.native_key_code, b.native_key_code);
-  swap(a.is_system_key, b.is_system_key);
-  swap(a.character, b.character);
-  swap(a.unmodified_character, b.unmodified_character);
-  swap(a.focus_on_editable_field, b.focus_on_editable_field);
+  swap(a.serverMethods, b.serverMethods);
+  swap(a.clientCallbacks, b.clientCallbacks);
+  swap(a.counters, b.counters);
+  swap(a.connections, b.connections);
+  swap(a.__isset, b.__isset);
 }
 
-KeyEvent::KeyEvent(const KeyEvent& other24) {
-  type = other24.type;
-  modifiers = other24.modifiers;
-  windows_key_code = other24.windows_key_code;
-  native_key_code = other24.native_key_code;
-  is_system_key = other24.is_system_key;
-  character = other24.character;
-  unmodified_character = other24.unmodified_character;
-  focus_on_editable_field = other24.focus_on_editable_field;
-}
-KeyEvent& KeyEvent::operator=(const KeyEvent& other25) {
-  type = other25.type;
-  modifiers = other25.modifiers;
-  windows_key_code = other25.windows_key_code;
-  native_key_code = other25.native_key_code;
-  is_system_key = other25.is_system_key;
-  character = other25.character;
-  unmodified_character = other25.unmodified_character;
-  focus_on_editable_field = other25.focus_on_editable_field;
+ServerMetrics::ServerMetrics(const ServerMetrics& other68) {
+  serverMethods = other68.serverMethods;
+  clientCallbacks = other68.clientCallbacks;
+  counters = other68.counters;
+  connections = other68.connections;
+  __isset = other68.__isset;
+}
+ServerMetrics& ServerMetrics::operator=(const ServerMetrics& other69) {
+  serverMethods = other69.serverMethods;
+  clientCallbacks = other69.clientCallbacks;
+  counters = other69.counters;
+  connections = other69.connections;
+  __isset = other69.__isset;
   return *this;
 }
-void KeyEvent::printTo(std::ostream& out) const {
+void ServerMetrics::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
-  out << "KeyEvent(";
-  out << "type=" << to_string(type);
-  out << ", " << "modifiers=" << to_string(modifiers);
-  out << ", " << "windows_key_code=" << to_string(windows_key_code);
-  out << ", " << "native_key_code=" << to_string(native_key_code);
-  out << ", " << "is_system_key=" << to_string(is_system_key);
-  out << ", " << "character=" << to_string(character);
-  out << ", " << "unmodified_character=" << to_string(unmodified_character);
-  out << ", " << "focus_on_editable_field=" << to_string(focus_on_editable_field);
+  out << "ServerMetrics(";
+  out << "serverMethods=" << to_string(serverMethods);
+  out << ", " << "clientCallbacks=" << to_string(clientCallbacks);
+  out << ", " << "counters=" << to_string(counters);
+  out << ", " << "connections=" << to_string(connections);
   out << ")";
 }
 
@@ -21,6 +21,18 @@
 
 namespace thrift_codegen {
 
+class Point;
+
+class Rect;
+
+class ScreenInfo;
+
+class ResourceRule;
+
+class RequestInfo;
+
+class ResponseInfo;
+
 class RObject;
 
 class ResponseHeaders;
@@ -33,10 +45,431 @@ class PostData;
 
 class KeyEvent;
 
+class MethodMetrics;
+
+class ConnectionMetrics;
+
+class ServerMetrics;
+
+
+class Point : public virtual ::apache::thrift::TBase {
+ public:
+
+  Point(const Point&) noexcept;
+  Point& operator=(const Point&) noexcept;
+  Point() noexcept
+        : x(0),
+          y(0) {
+  }
+
+  virtual ~Point() noexcept;
+  int32_t x;
+  int32_t y;
+
+  void __set_x(const int32_t val);
+
+  void __set_y(const int32_t val);
+
+  bool operator == (const Point & rhs) const
+  {
+    if (!(x == rhs.x))
+      return false;
+    if (!(y == rhs.y))
+      return false;
+    return true;
+  }
+  bool operator != (const Point &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Point & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(Point &a, Point &b);
+
+std::ostream& operator<<(std::ostream& out, const Point& obj);
+
+
+class Rect : public virtual ::apache::thrift::TBase {
+ public:
+
+  Rect(const Rect&) noexcept;
+  Rect& operator=(const Rect&) noexcept;
+  Rect() noexcept
+       : x(0),
+         y(0),
+         w(0),
+         h(0) {
+  }
+
+  virtual ~Rect() noexcept;
+  int32_t x;
+  int32_t y;
+  int32_t w;
+  int32_t h;
+
+  void __set_x(const int32_t val);
+
+  void __set_y(const int32_t val);
+
+  void __set_w(const int32_t val);
+
+  void __set_h(const int32_t val);
+
+  bool operator == (const Rect & rhs) const
+  {
+    if (!(x == rhs.x))
+      return false;
+    if (!(y == rhs.y))
+      return false;
+    if (!(w == rhs.w))
+      return false;
+    if (!(h == rhs.h))
+      return false;
+    return true;
+  }
+  bool operator != (const Rect &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const Rect & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(Rect &a, Rect &b);
+
+std::ostream& operator<<(std::ostream& out, const Rect& obj);
+
+
+class ScreenInfo : public virtual ::apache::thrift::TBase {
+ public:
+
+  ScreenInfo(const ScreenInfo&) noexcept;
+  ScreenInfo& operator=(const ScreenInfo&) noexcept;
+  ScreenInfo() noexcept
+             : device_scale_factor(0),
+               depth(0),
+               depth_per_component(0),
+               is_monochrome(0) {
+  }
+
+  virtual ~ScreenInfo() noexcept;
+  double device_scale_factor;
+  int32_t depth;
+  int32_t depth_per_component;
+  bool is_monochrome;
+  Rect rect;
+  Rect available_rect;
+
+  void __set_device_scale_factor(const double val);
+
+  void __set_depth(const int32_t val);
+
+  void __set_depth_per_component(const int32_t val);
+
+  void __set_is_monochrome(const bool val);
+
+  void __set_rect(const Rect& val);
+
+  void __set_available_rect(const Rect& val);
+
+  bool operator == (const ScreenInfo & rhs) const
+  {
+    if (!(device_scale_factor == rhs.device_scale_factor))
+      return false;
+    if (!(depth == rhs.depth))
+      return false;
+    if (!(depth_per_component == rhs.depth_per_component))
+      return false;
+    if (!(is_monochrome == rhs.is_monochrome))
+      return false;
+    if (!(rect == rhs.rect))
+      return false;
+    if (!(available_rect == rhs.available_rect))
+      return false;
+    return true;
+  }
+  bool operator != (const ScreenInfo &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ScreenInfo & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ScreenInfo &a, ScreenInfo &b);
+
+std::ostream& operator<<(std::ostream& out, const ScreenInfo& obj);
+
+
+class ResourceRule : public virtual ::apache::thrift::TBase {
+ public:
+
+  ResourceRule(const ResourceRule&);
+  ResourceRule& operator=(const ResourceRule&);
+  ResourceRule() noexcept
+               : urlPattern(),
+                 action(0) {
+  }
+
+  virtual ~ResourceRule() noexcept;
+  std::string urlPattern;
+  int32_t action;
+
+  void __set_urlPattern(const std::string& val);
+
+  void __set_action(const int32_t val);
+
+  bool operator == (const ResourceRule & rhs) const
+  {
+    if (!(urlPattern == rhs.urlPattern))
+      return false;
+    if (!(action == rhs.action))
+      return false;
+    return true;
+  }
+  bool operator != (const ResourceRule &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ResourceRule & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ResourceRule &a, ResourceRule &b);
+
+std::ostream& operator<<(std::ostream& out, const ResourceRule& obj);
+
+typedef struct _RequestInfo__isset {
+  _RequestInfo__isset() : identifier(false), isReadOnly(false), url(false), method(false), referrerUrl(false), referrerPolicy(false), flags(false), firstPartyForCookies(false), resourceType(false), transitionType(false) {}
+  bool identifier :1;
+  bool isReadOnly :1;
+  bool url :1;
+  bool method :1;
+  bool referrerUrl :1;
+  bool referrerPolicy :1;
+  bool flags :1;
+  bool firstPartyForCookies :1;
+  bool resourceType :1;
+  bool transitionType :1;
+} _RequestInfo__isset;
+
+class RequestInfo : public virtual ::apache::thrift::TBase {
+ public:
+
+  RequestInfo(const RequestInfo&);
+  RequestInfo& operator=(const RequestInfo&);
+  RequestInfo() noexcept
+              : identifier(0),
+                isReadOnly(0),
+                url(),
+                method(),
+                referrerUrl(),
+                referrerPolicy(0),
+                flags(0),
+                firstPartyForCookies(),
+                resourceType(0),
+                transitionType(0) {
+  }
+
+  virtual ~RequestInfo() noexcept;
+  int64_t identifier;
+  bool isReadOnly;
+  std::string url;
+  std::string method;
+  std::string referrerUrl;
+  int32_t referrerPolicy;
+  int32_t flags;
+  std::string firstPartyForCookies;
+  int32_t resourceType;
+  int32_t transitionType;
+
+  _RequestInfo__isset __isset;
+
+  void __set_identifier(const int64_t val);
+
+  void __set_isReadOnly(const bool val);
+
+  void __set_url(const std::string& val);
+
+  void __set_method(const std::string& val);
+
+  void __set_referrerUrl(const std::string& val);
+
+  void __set_referrerPolicy(const int32_t val);
+
+  void __set_flags(const int32_t val);
+
+  void __set_firstPartyForCookies(const std::string& val);
+
+  void __set_resourceType(const int32_t val);
+
+  void __set_transitionType(const int32_t val);
+
+  bool operator == (const RequestInfo & rhs) const
+  {
+    if (__isset.identifier != rhs.__isset.identifier)
+      return false;
+    else if (__isset.identifier && !(identifier == rhs.identifier))
+      return false;
+    if (__isset.isReadOnly != rhs.__isset.isReadOnly)
+      return false;
+    else if (__isset.isReadOnly && !(isReadOnly == rhs.isReadOnly))
+      return false;
+    if (__isset.url != rhs.__isset.url)
+      return false;
+    else if (__isset.url && !(url == rhs.url))
+      return false;
+    if (__isset.method != rhs.__isset.method)
+      return false;
+    else if (__isset.method && !(method == rhs.method))
+      return false;
+    if (__isset.referrerUrl != rhs.__isset.referrerUrl)
+      return false;
+    else if (__isset.referrerUrl && !(referrerUrl == rhs.referrerUrl))
+      return false;
+    if (__isset.referrerPolicy != rhs.__isset.referrerPolicy)
+      return false;
+    else if (__isset.referrerPolicy && !(referrerPolicy == rhs.referrerPolicy))
+      return false;
+    if (__isset.flags != rhs.__isset.flags)
+      return false;
+    else if (__isset.flags && !(flags == rhs.flags))
+      return false;
+    if (__isset.firstPartyForCookies != rhs.__isset.firstPartyForCookies)
+      return false;
+    else if (__isset.firstPartyForCookies && !(firstPartyForCookies == rhs.firstPartyForCookies))
+      return false;
+    if (__isset.resourceType != rhs.__isset.resourceType)
+      return false;
+    else if (__isset.resourceType && !(resourceType == rhs.resourceType))
+      return false;
+    if (__isset.transitionType != rhs.__isset.transitionType)
+      return false;
+    else if (__isset.transitionType && !(transitionType == rhs.transitionType))
+      return false;
+    return true;
+  }
+  bool operator != (const RequestInfo &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const RequestInfo & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(RequestInfo &a, RequestInfo &b);
+
+std::ostream& operator<<(std::ostream& out, const RequestInfo& obj);
+
+typedef struct _ResponseInfo__isset {
+  _ResponseInfo__isset() : isReadOnly(false), status(false), statusText(false), mimeType(false), error(false) {}
+  bool isReadOnly :1;
+  bool status :1;
+  bool statusText :1;
+  bool mimeType :1;
+  bool error :1;
+} _ResponseInfo__isset;
+
+class ResponseInfo : public virtual ::apache::thrift::TBase {
+ public:
+
+  ResponseInfo(const ResponseInfo&);
+  ResponseInfo& operator=(const ResponseInfo&);
+  ResponseInfo() noexcept
+               : isReadOnly(0),
+                 status(0),
+                 statusText(),
+                 mimeType(),
+                 error(0) {
+  }
+
+  virtual ~ResponseInfo() noexcept;
+  bool isReadOnly;
+  int32_t status;
+  std::string statusText;
+  std::string mimeType;
+  int32_t error;
+
+  _ResponseInfo__isset __isset;
+
+  void __set_isReadOnly(const bool val);
+
+  void __set_status(const int32_t val);
+
+  void __set_statusText(const std::string& val);
+
+  void __set_mimeType(const std::string& val);
+
+  void __set_error(const int32_t val);
+
+  bool operator == (const ResponseInfo & rhs) const
+  {
+    if (__isset.isReadOnly != rhs.__isset.isReadOnly)
+      return false;
+    else if (__isset.isReadOnly && !(isReadOnly == rhs.isReadOnly))
+      return false;
+    if (__isset.status != rhs.__isset.status)
+      return false;
+    else if (__isset.status && !(status == rhs.status))
+      return false;
+    if (__isset.statusText != rhs.__isset.statusText)
+      return false;
+    else if (__isset.statusText && !(statusText == rhs.statusText))
+      return false;
+    if (__isset.mimeType != rhs.__isset.mimeType)
+      return false;
+    else if (__isset.mimeType && !(mimeType == rhs.mimeType))
+      return false;
+    if (__isset.error != rhs.__isset.error)
+      return false;
+    else if (__isset.error && !(error == rhs.error))
+      return false;
+    return true;
+  }
+  bool operator != (const ResponseInfo &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ResponseInfo & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ResponseInfo &a, ResponseInfo &b);
+
+std::ostream& operator<<(std::ostream& out, const ResponseInfo& obj);
+
 typedef struct _RObject__isset {
-  _RObject__isset() : flags(false), objInfo(false) {}
+  _RObject__isset() : flags(false), objInfo(false), requestInfo(false), responseInfo(false) {}
   bool flags :1;
   bool objInfo :1;
+  bool requestInfo :1;
+  bool responseInfo :1;
 } _RObject__isset;
 
 class RObject : public virtual ::apache::thrift::TBase {
@@ -53,6 +486,8 @@ class RObject : public virtual ::apache::thrift::TBase {
   int32_t objId;
   int32_t flags;
   std::map<std::string, std::string>  objInfo;
+  RequestInfo requestInfo;
+  ResponseInfo responseInfo;
 
   _RObject__isset __isset;
 
@@ -62,6 +497,10 @@ class RObject : public virtual ::apache::thrift::TBase {
 
   void __set_objInfo(const std::map<std::string, std::string> & val);
 
+  void __set_requestInfo(const RequestInfo& val);
+
+  void __set_responseInfo(const ResponseInfo& val);
+
   bool operator == (const RObject & rhs) const
   {
     if (!(objId == rhs.objId))
@@ -74,6 +513,14 @@ class RObject : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.objInfo && !(objInfo == rhs.objInfo))
       return false;
+    if (__isset.requestInfo != rhs.__isset.requestInfo)
+      return false;
+    else if (__isset.requestInfo && !(requestInfo == rhs.requestInfo))
+      return false;
+    if (__isset.responseInfo != rhs.__isset.responseInfo)
+      return false;
+    else if (__isset.responseInfo && !(responseInfo == rhs.responseInfo))
+      return false;
     return true;
   }
   bool operator != (const RObject &rhs) const {
@@ -404,6 +851,247 @@ void swap(KeyEvent &a, KeyEvent &b);
 
 std::ostream& operator<<(std::ostream& out, const KeyEvent& obj);
 
+typedef struct _MethodMetrics__isset {
+  _MethodMetrics__isset() : bytesIn(false), bytesOut(false), inFlight(false), maxInFlight(false) {}
+  bool bytesIn :1;
+  bool bytesOut :1;
+  bool inFlight :1;
+  bool maxInFlight :1;
+} _MethodMetrics__isset;
+
+class MethodMetrics : public virtual ::apache::thrift::TBase {
+ public:
+
+  MethodMetrics(const MethodMetrics&);
+  MethodMetrics& operator=(const MethodMetrics&);
+  MethodMetrics() noexcept
+                : name(),
+                  calls(0),
+                  errors(0),
+                  totalUs(0),
+                  maxUs(0),
+                  p50Us(0),
+                  p99Us(0),
+                  p999Us(0),
+                  bytesIn(0),
+                  bytesOut(0),
+                  inFlight(0),
+                  maxInFlight(0) {
+  }
+
+  virtual ~MethodMetrics() noexcept;
+  std::string name;
+  int64_t calls;
+  int64_t errors;
+  int64_t totalUs;
+  int64_t maxUs;
+  int64_t p50Us;
+  int64_t p99Us;
+  int64_t p999Us;
+  int64_t bytesIn;
+  int64_t bytesOut;
+  int32_t inFlight;
+  int32_t maxInFlight;
+
+  _MethodMetrics__isset __isset;
+
+  void __set_name(const std::string& val);
+
+  void __set_calls(const int64_t val);
+
+  void __set_errors(const int64_t val);
+
+  void __set_totalUs(const int64_t val);
+
+  void __set_maxUs(const int64_t val);
+
+  void __set_p50Us(const int64_t val);
+
+  void __set_p99Us(const int64_t val);
+
+  void __set_p999Us(const int64_t val);
+
+  void __set_bytesIn(const int64_t val);
+
+  void __set_bytesOut(const int64_t val);
+
+  void __set_inFlight(const int32_t val);
+
+  void __set_maxInFlight(const int32_t val);
+
+  bool operator == (const MethodMetrics & rhs) const
+  {
+    if (!(name == rhs.name))
+      return false;
+    if (!(calls == rhs.calls))
+      return false;
+    if (!(errors == rhs.errors))
+      return false;
+    if (!(totalUs == rhs.totalUs))
+      return false;
+    if (!(maxUs == rhs.maxUs))
+      return false;
+    if (!(p50Us == rhs.p50Us))
+      return false;
+    if (!(p99Us == rhs.p99Us))
+      return false;
+    if (!(p999Us == rhs.p999Us))
+      return false;
+    if (__isset.bytesIn != rhs.__isset.bytesIn)
+      return false;
+    else if (__isset.bytesIn && !(bytesIn == rhs.bytesIn))
+      return false;
+    if (__isset.bytesOut != rhs.__isset.bytesOut)
+      return false;
+    else if (__isset.bytesOut && !(bytesOut == rhs.bytesOut))
+      return false;
+    if (__isset.inFlight != rhs.__isset.inFlight)
+      return false;
+    else if (__isset.inFlight && !(inFlight == rhs.inFlight))
+      return false;
+    if (__isset.maxInFlight != rhs.__isset.maxInFlight)
+      return false;
+    else if (__isset.maxInFlight && !(maxInFlight == rhs.maxInFlight))
+      return false;
+    return true;
+  }
+  bool operator != (const MethodMetrics &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const MethodMetrics & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(MethodMetrics &a, MethodMetrics &b);
+
+std::ostream& operator<<(std::ostream& out, const MethodMetrics& obj);
+
+
+class ConnectionMetrics : public virtual ::apache::thrift::TBase {
+ public:
+
+  ConnectionMetrics(const ConnectionMetrics&) noexcept;
+  ConnectionMetrics& operator=(const ConnectionMetrics&) noexcept;
+  ConnectionMetrics() noexcept
+                    : id(0),
+                      calls(0),
+                      bytesIn(0),
+                      bytesOut(0),
+                      ageMs(0) {
+  }
+
+  virtual ~ConnectionMetrics() noexcept;
+  int32_t id;
+  int64_t calls;
+  int64_t bytesIn;
+  int64_t bytesOut;
+  int64_t ageMs;
+
+  void __set_id(const int32_t val);
+
+  void __set_calls(const int64_t val);
+
+  void __set_bytesIn(const int64_t val);
+
+  void __set_bytesOut(const int64_t val);
+
+  void __set_ageMs(const int64_t val);
+
+  bool operator == (const ConnectionMetrics & rhs) const
+  {
+    if (!(id == rhs.id))
+      return false;
+    if (!(calls == rhs.calls))
+      return false;
+    if (!(bytesIn == rhs.bytesIn))
+      return false;
+    if (!(bytesOut == rhs.bytesOut))
+      return false;
+    if (!(ageMs == rhs.ageMs))
+      return false;
+    return true;
+  }
+  bool operator != (const ConnectionMetrics &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ConnectionMetrics & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ConnectionMetrics &a, ConnectionMetrics &b);
+
+std::ostream& operator<<(std::ostream& out, const ConnectionMetrics& obj);
+
+typedef struct _ServerMetrics__isset {
+  _ServerMetrics__isset() : serverMethods(false), clientCallbacks(false), counters(false), connections(false) {}
+  bool serverMethods :1;
+  bool clientCallbacks :1;
+  bool counters :1;
+  bool connections :1;
+} _ServerMetrics__isset;
+
+class ServerMetrics : public virtual ::apache::thrift::TBase {
+ public:
+
+  ServerMetrics(const ServerMetrics&);
+  ServerMetrics& operator=(const ServerMetrics&);
+  ServerMetrics() noexcept {
+  }
+
+  virtual ~ServerMetrics() noexcept;
+  std::vector<MethodMetrics>  serverMethods;
+  std::vector<MethodMetrics>  clientCallbacks;
+  std::map<std::string, int64_t>  counters;
+  std::vector<ConnectionMetrics>  connections;
+
+  _ServerMetrics__isset __isset;
+
+  void __set_serverMethods(const std::vector<MethodMetrics> & val);
+
+  void __set_clientCallbacks(const std::vector<MethodMetrics> & val);
+
+  void __set_counters(const std::map<std::string, int64_t> & val);
+
+  void __set_connections(const std::vector<ConnectionMetrics> & val);
+
+  bool operator == (const ServerMetrics & rhs) const
+  {
+    if (!(serverMethods == rhs.serverMethods))
+      return false;
+    if (!(clientCallbacks == rhs.clientCallbacks))
+      return false;
+    if (!(counters == rhs.counters))
+      return false;
+    if (!(connections == rhs.connections))
+      return false;
+    return true;
+  }
+  bool operator != (const ServerMetrics &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ServerMetrics & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ServerMetrics &a, ServerMetrics &b);
+
+std::ostream& operator<<(std::ostream& out, const ServerMetrics& obj);
+
 } // namespace
 
 #endif
@@ -45,9 +45,10 @@ RemoteClientHandler::RemoteClientHandler(
       myRoutersManager(routersManager),
       myRemoteLisfespanHandler(new RemoteLifespanHandler(bid, service, routersManager, onClosedCallback))
 {
-  if (handlersMask & HandlerMasks::NativeRender)
-    myRemoteRenderHandler = new RemoteRenderHandler(bid, service);
-  else {
+  if (handlersMask & HandlerMasks::NativeRender) {
+    myNativeRenderHandler = new RemoteRenderHandler(bid, service);
+    myRemoteRenderHandler = myNativeRenderHandler;
+  } else {
     myRemoteRenderHandler = new DummyRenderHandler();
     Log::trace("Bid %d hasn't renderer.", bid);
   }
@@ -58,8 +59,10 @@ RemoteClientHandler::RemoteClientHandler(
   if (handlersMask & HandlerMasks::Display)
     myRemoteDisplayHandler = new RemoteDisplayHandler(bid, service);
 
-  if (handlersMask & HandlerMasks::Request)
-    myRemoteRequestHandler = new RemoteRequestHandler(bid, service, serviceIO, routersManager);
+  if (handlersMask & HandlerMasks::Request) {
+    myRequestHandlerImpl = new RemoteRequestHandler(bid, service, serviceIO, routersManager);
+    myRemoteRequestHandler = myRequestHandlerImpl;
+  }
 
   if (handlersMask & HandlerMasks::Keyboard)
     myRemoteKeyboardHandler = new RemoteKeyboardHandler(bid, service);
@@ -149,6 +152,14 @@ CefRefPtr<CefBrowser> RemoteClientHandler::getCefBrowser() {
   return ((RemoteLifespanHandler *)(myRemoteLisfespanHandler.get()))->getBrowser();
 }
 
+CefRefPtr<RemoteRenderHandler> RemoteClientHandler::getRemoteRenderHandler() {
+  return myNativeRenderHandler;
+}
+
+CefRefPtr<RemoteRequestHandler> RemoteClientHandler::getRemoteRequestHandler() {
+  return myRequestHandlerImpl;
+}
+
 void RemoteClientHandler::closeBrowser() {
   if (myIsClosing)
     return;
@@ -8,6 +8,8 @@
 #include "include/cef_client.h"
 
 class ServerHandler;
+class RemoteRenderHandler;
+class RemoteRequestHandler;
 
 class RemoteClientHandler : public CefClient {
 public:
@@ -50,6 +52,10 @@ public:
     std::shared_ptr<RpcExecutor> getService() { return myService; }
     std::shared_ptr<MessageRoutersManager> getRoutersManager() { return myRoutersManager; }
     CefRefPtr<CefBrowser> getCefBrowser();
+    // Returns nullptr when browser doesn't use native rendering
+    CefRefPtr<RemoteRenderHandler> getRemoteRenderHandler();
+    // Returns nullptr when client hasn't request handler
+    CefRefPtr<RemoteRequestHandler> getRemoteRequestHandler();
 
     // Convenience methods
     template<typename T>
@@ -67,9 +73,11 @@ public:
     const CefRefPtr<CefLifeSpanHandler> myRemoteLisfespanHandler; // always presented
 
     CefRefPtr<CefRenderHandler> myRemoteRenderHandler;
+    RemoteRenderHandler * myNativeRenderHandler = nullptr; // owned by myRemoteRenderHandler
     CefRefPtr<CefLoadHandler> myRemoteLoadHandler;
     CefRefPtr<CefDisplayHandler> myRemoteDisplayHandler;
     CefRefPtr<CefRequestHandler> myRemoteRequestHandler;
+    RemoteRequestHandler * myRequestHandlerImpl = nullptr; // owned by myRemoteRequestHandler
     CefRefPtr<CefKeyboardHandler> myRemoteKeyboardHandler;
     CefRefPtr<CefFocusHandler> myRemoteFocusHandler;
 
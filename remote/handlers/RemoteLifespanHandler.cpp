@@ -2,6 +2,7 @@
 #include "RemoteClientHandler.h"
 
 #include "../log/Log.h"
+#include "../../native/input_coalescer.h"
 
 RemoteLifespanHandler::RemoteLifespanHandler(
     int bid,
@@ -53,6 +54,7 @@ void RemoteLifespanHandler::OnBeforeClose(CefRefPtr<CefBrowser> browser) {
   myBrowser = nullptr;
   myOnClosedCallback(myBid);
   myRoutersManager->OnBeforeClose(browser);
+  InputCoalescer::Remove(browser);
   myService->exec([&](const RpcExecutor::Service& s){
     s->LifeSpanHandler_OnBeforeClose(myBid);
   });
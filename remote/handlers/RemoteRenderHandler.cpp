@@ -1,9 +1,12 @@
 #include "RemoteRenderHandler.h"
 #include "RemoteClientHandler.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include "../CefUtils.h"
+#include "../ServerState.h"
 #include "../log/Log.h"
 
 using namespace std::chrono;
@@ -19,7 +22,14 @@ using namespace boost::interprocess;
 #define LNDCT()
 #endif
 
-RemoteRenderHandler::RemoteRenderHandler(int bid, std::shared_ptr<RpcExecutor> service) : myBid(bid), myService(service), myBufferManager(bid) {}
+RemoteRenderHandler::RemoteRenderHandler(int bid, std::shared_ptr<RpcExecutor> service)
+    : myBid(bid),
+      myService(service),
+      myBufferManager(bid,
+                      ServerState::instance().getCmdArgs().getPaintBuffersCount(),
+                      ServerState::instance().getCmdArgs().isPaintBackpressure() ? SharedBufferManager::BACKPRESSURE : SharedBufferManager::DROP_OLDEST),
+      myIsDirtyRectsOnly(ServerState::instance().getCmdArgs().isPaintDirtyRectsOnly()),
+      myIsPaintSync(ServerState::instance().getCmdArgs().isPaintSync()) {}
 
 bool RemoteRenderHandler::GetRootScreenRect(CefRefPtr<CefBrowser> browser,
                                       CefRect& rect) {
@@ -34,9 +44,39 @@ void fillDummy(CefRect& rect) {
     rect.height = 200;
 }
 
+void RemoteRenderHandler::setViewGeometry(const CefRect* viewRect,
+                                          const CefScreenInfo* screenInfo,
+                                          const CefPoint* screenPoint0,
+                                          const CefPoint* screenPoint100) {
+    std::lock_guard<std::mutex> lock(myGeometryMutex);
+    if (viewRect != nullptr) {
+      myViewRect = *viewRect;
+      myHasViewRect = true;
+    }
+    if (screenInfo != nullptr) {
+      myScreenInfo = *screenInfo;
+      myHasScreenInfo = true;
+    }
+    if (screenPoint0 != nullptr && screenPoint100 != nullptr) {
+      myScreenPoint0 = *screenPoint0;
+      myScreenScaleX = (screenPoint100->x - screenPoint0->x)/100.0;
+      myScreenScaleY = (screenPoint100->y - screenPoint0->y)/100.0;
+      myHasScreenPoints = true;
+    }
+}
+
 void RemoteRenderHandler::GetViewRect(CefRefPtr<CefBrowser> browser, CefRect& rect) {
     LNDCT();
     fillDummy(rect);
+    {
+      std::lock_guard<std::mutex> lock(myGeometryMutex);
+      if (myHasViewRect) {
+        if (myViewRect.width >= 1 && myViewRect.height >= 1)
+          rect = myViewRect;
+        return;
+      }
+    }
+
     Rect result;
     result.w = -1; // invalidate
     myService->exec([&](const RpcExecutor::Service& s){
@@ -85,6 +125,14 @@ void fillDummy(CefScreenInfo& screen_info) {
 bool RemoteRenderHandler::GetScreenInfo(CefRefPtr<CefBrowser> browser,
                                   CefScreenInfo& screen_info) {
     LNDCT();
+    {
+      std::lock_guard<std::mutex> lock(myGeometryMutex);
+      if (myHasScreenInfo) {
+        screen_info = myScreenInfo;
+        return true;
+      }
+    }
+
     fillDummy(screen_info);
     ScreenInfo result;
     result.depth = -1;// invalidate
@@ -117,6 +165,15 @@ bool RemoteRenderHandler::GetScreenPoint(CefRefPtr<CefBrowser> browser,
                                    int& screenX,
                                    int& screenY) {
     LNDCT();
+    {
+      std::lock_guard<std::mutex> lock(myGeometryMutex);
+      if (myHasScreenPoints) {
+        screenX = myScreenPoint0.x + static_cast<int>(std::lround(viewX*myScreenScaleX));
+        screenY = myScreenPoint0.y + static_cast<int>(std::lround(viewY*myScreenScaleY));
+        return true;
+      }
+    }
+
     Point result;
     result.x = INT32_MIN;// invalidate
     myService->exec([&](const RpcExecutor::Service& s){
@@ -237,6 +294,28 @@ inline void semifillRect(unsigned char * dst, int stride, int y, int x, int widt
     drawLineY(dst, stride, y, x, height, r, g, b, a, totalWidth, totalHeight);
 }
 
+// Copies rect (clipped by raster bounds) from src raster into dst.
+inline void copyRect(char * dst, const char * src, const CefRect& r, int width, int height) {
+  const int x0 = std::max(r.x, 0);
+  const int y0 = std::max(r.y, 0);
+  const int x1 = std::min(r.x + r.width, width);
+  const int y1 = std::min(r.y + r.height, height);
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  const int stride = width*4;
+  if (x0 == 0 && x1 == width) {
+    // optimized for a buffer wide dirty rect
+    ::memcpy(dst + y0*stride, src + y0*stride, (y1 - y0)*stride);
+    return;
+  }
+  const int lineLen = (x1 - x0)*4;
+  for (int y = y0; y < y1; ++y) {
+    const int offset = y*stride + x0*4;
+    ::memcpy(dst + offset, src + offset, lineLen);
+  }
+}
+
 void RemoteRenderHandler::OnPaint(CefRefPtr<CefBrowser> browser,
                             PaintElementType type,
                             const RectList& dirtyRects,
@@ -245,16 +324,37 @@ void RemoteRenderHandler::OnPaint(CefRefPtr<CefBrowser> browser,
                             int height) {
     const int rasterPixCount = width*height;
     const size_t extendedRectsCount = dirtyRects.size() < 10 ? 10 : dirtyRects.size();
-    SharedBuffer & buff = myBufferManager.getLockedBuffer(rasterPixCount*4 + 4*4*extendedRectsCount);
+    // Client must also repaint regions of the frames that were dropped (i.e.
+    // overwritten before client consumed them) or skipped (client loads only
+    // the newest published frame), so they are passed with current frame.
+    std::vector<CefRect> rects(dirtyRects.begin(), dirtyRects.end());
+    SharedBuffer & buff = myBufferManager.acquireBuffer(rasterPixCount*4 + 4*4*extendedRectsCount, rects);
     if (buff.ptr() == nullptr) {
       Log::error("SharedBuffer is empty.");
       return;
     }
+    if (rects.size() > extendedRectsCount) {
+      rects.clear();
+      rects.emplace_back(0, 0, width, height);
+    }
 
-    ::memcpy((char*)buff.ptr(), (char*)buffer, rasterPixCount*4);
+    // Every buffer of the pool is kept as actual copy of the whole raster, so
+    // client can read any region from it. In dirty-rects mode only the regions
+    // that were changed since the last write into this buffer are copied.
+    if (!myIsDirtyRectsOnly || buff.isStaleAll() || buff.rasterWidth() != width || buff.rasterHeight() != height) {
+      ::memcpy((char*)buff.ptr(), (char*)buffer, rasterPixCount*4);
+    } else {
+      for (const CefRect& r : buff.staleRects())
+        copyRect((char*)buff.ptr(), (const char*)buffer, r, width, height);
+      for (const CefRect& r : dirtyRects)
+        copyRect((char*)buff.ptr(), (const char*)buffer, r, width, height);
+    }
+    buff.markActual(width, height);
+    if (myIsDirtyRectsOnly)
+      myBufferManager.invalidateOthers(buff, dirtyRects);
 
     int32_t * sharedRects = (int32_t *)buff.ptr() + rasterPixCount;
-    for (const CefRect& r : dirtyRects) {
+    for (const CefRect& r : rects) {
       *(sharedRects++) = r.x;
       *(sharedRects++) = r.y;
       *(sharedRects++) = r.width;
@@ -270,12 +370,24 @@ void RemoteRenderHandler::OnPaint(CefRefPtr<CefBrowser> browser,
     fillRect((unsigned char *)buff.ptr(), stride, height - th, 0, th, th, 255, 0, 255, 255, width, height);
 #endif //DRAW_DEBUG
 
-    buff.unlock();
+    const int64_t seq = myBufferManager.publish(buff, rects, width, height);
+
+    if (myIsPaintSync) {
+      myService->exec([&](const RpcExecutor::Service& s){
+        s->RenderHandler_OnPaint(myBid, type != PET_VIEW, static_cast<int>(rects.size()),
+                   buff.uid(), buff.handle(),
+                   width, height);
+      });
+      return;
+    }
 
+    // Oneway notification: UI thread doesn't wait for client. When client is
+    // slow, unconsumed frames are dropped (see SharedBufferManager), client
+    // detects it by gaps in sequence numbers.
     myService->exec([&](const RpcExecutor::Service& s){
-      s->RenderHandler_OnPaint(myBid, type != PET_VIEW, static_cast<int>(dirtyRects.size()),
+      s->RenderHandler_OnPaintAsync(myBid, type != PET_VIEW, static_cast<int>(rects.size()),
                  buff.uid(), buff.handle(),
-                 width, height);
+                 width, height, seq);
     });
 }
 
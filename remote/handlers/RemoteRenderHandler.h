@@ -1,6 +1,7 @@
 #ifndef IPC_JAVARENDERHANDLER_H
 #define IPC_JAVARENDERHANDLER_H
 
+#include <mutex>
 #include "include/cef_render_handler.h"
 #include "SharedBufferManager.h"
 
@@ -12,6 +13,16 @@ class RemoteRenderHandler : public CefRenderHandler {
 public:
   explicit RemoteRenderHandler(int bid, std::shared_ptr<RpcExecutor> service);
 
+  // Caches view geometry pushed by client (invalid values are skipped, so
+  // corresponding requests will be passed to client). Screen points of view
+  // points (0,0) and (100,100) define mapping of view coordinates to screen,
+  // client sends them only when embedder tracks moves of the view (see
+  // RemoteBrowser.updateViewGeometry).
+  void setViewGeometry(const CefRect* viewRect,
+                       const CefScreenInfo* screenInfo,
+                       const CefPoint* screenPoint0,
+                       const CefPoint* screenPoint100);
+
   bool GetRootScreenRect(CefRefPtr<CefBrowser> browser,
                                    CefRect &rect) override;
 
@@ -52,6 +63,19 @@ protected:
   const int myBid;
   std::shared_ptr<RpcExecutor> myService;
   SharedBufferManager myBufferManager;
+  const bool myIsDirtyRectsOnly;
+  const bool myIsPaintSync;
+
+  // View geometry cache (written by server thread, read by UI thread).
+  std::mutex myGeometryMutex;
+  bool myHasViewRect = false;
+  CefRect myViewRect;
+  bool myHasScreenInfo = false;
+  CefScreenInfo myScreenInfo;
+  bool myHasScreenPoints = false;
+  CefPoint myScreenPoint0;
+  double myScreenScaleX = 1;
+  double myScreenScaleY = 1;
 
 private:
   IMPLEMENT_REFCOUNTING(RemoteRenderHandler);
@@ -1,5 +1,10 @@
 #include "SharedBufferManager.h"
 
+#include <algorithm>
+#include <thread>
+
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+
 #include "../Utils.h"
 #include "../log/Log.h"
 
@@ -10,6 +15,35 @@ namespace {
     constexpr int latticeSizeBits = 19; // i.e. 512 Kb
     return ((len >> latticeSizeBits) + 1) << latticeSizeBits;
   }
+
+  // When there are too many stale rects it's cheaper to copy whole raster.
+  constexpr size_t MAX_STALE_RECTS = 32;
+
+  // Max time of waiting for free buffer (in BACKPRESSURE mode), after that
+  // the oldest frame will be dropped.
+  constexpr int MAX_BACKPRESSURE_WAIT_MCS = 50*1000;
+
+  // Growth strategy: buffers are over-allocated and aren't shrunk until they are
+  // used by much smaller frames for a long time, so resizing (window dragging,
+  // popups, shrink/grow cycles) doesn't re-create shared segments after warm-up.
+  size_t growCapacity(size_t requested, size_t current) {
+    return nearestMemorySize(std::max(requested + requested/4, current + current/2));
+  }
+  constexpr size_t SHRINK_RATIO = 4;
+  constexpr int SHRINK_AFTER_FRAMES = 300;
+
+  // Touch every page so the first raster copy doesn't page-fault.
+  void prefault(void * ptr, size_t len) {
+    constexpr size_t pageSize = 4096;
+    volatile char * p = (volatile char *)ptr;
+    for (size_t offset = 0; offset < len; offset += pageSize)
+      p[offset] = 0;
+  }
+}
+
+std::string SharedBuffer::uniqueName(const std::string& name) {
+  const long pid = (long)ipcdetail::get_current_process_id();
+  return string_format("Cef%ld_", pid) + name;
 }
 
 SharedBuffer::SharedBuffer(std::string uid, size_t len)
@@ -30,12 +64,12 @@ SharedBuffer::SharedBuffer(std::string uid, size_t len)
   const Clock::time_point t2 = Clock::now();
   mySharedMem = mySharedSegment->allocate(len);
   mySharedMemHandle = mySharedSegment->get_handle_from_address(mySharedMem);
+  prefault(mySharedMem, len);
 
   const Clock::time_point t3 = Clock::now();
-  named_mutex::remove(myUid.c_str());
+  mySlot = mySharedSegment->construct<SharedBufferSlot>(SharedBufferSlot::NAME)();
 
   const Clock::time_point t4 = Clock::now();
-  myMutex = new named_mutex(create_only, myUid.c_str());
 
   if (Log::isTraceEnabled()) {
     const Clock::time_point entTime = Clock::now();
@@ -46,7 +80,7 @@ SharedBuffer::SharedBuffer(std::string uid, size_t len)
       Duration d3 = std::chrono::duration_cast<std::chrono::microseconds>(t3 - t2);
       Duration d4 = std::chrono::duration_cast<std::chrono::microseconds>(t4 - t3);
       Duration d5 = std::chrono::duration_cast<std::chrono::microseconds>(entTime - t4);
-      Log::trace("\t SharedBuffer '%s' (%d bytes), ctor spent mcs: remove mem %d; ctor %d; alloc %d; remove mutex %d; mutex ctor %d",
+      Log::trace("\t SharedBuffer '%s' (%d bytes), ctor spent mcs: remove mem %d; ctor %d; alloc and prefault %d; slot ctor %d; rest %d",
                  uid.c_str(), len, (int)d1.count(), (int)d2.count(), (int)d3.count(), (int)d4.count(), (int)d5.count());
     }
   }
@@ -61,66 +95,161 @@ void SharedBuffer::_releaseShared() {
 
     mySharedSegment = nullptr;
     mySharedMem = nullptr;
-  }
-  if (myMutex != nullptr) {
-    delete myMutex;
-    myMutex = nullptr;
+    mySlot = nullptr;
   }
   shared_memory_object::remove(myUid.c_str());
-  named_mutex::remove(myUid.c_str());
 }
 
-void SharedBuffer::lock() {
-  if (myMutex != nullptr)
-    myMutex->lock();
+bool SharedBuffer::tryAcquire(SharedBufferSlot::State from) {
+  return mySlot != nullptr && mySlot->transit(from, SharedBufferSlot::WRITING);
+}
+
+void SharedBuffer::publish(int64_t seq, int width, int height, int rectsCount) {
+  if (mySlot == nullptr)
+    return;
+  mySlot->width = width;
+  mySlot->height = height;
+  mySlot->rectsCount = rectsCount;
+  mySlot->seq.store(seq, std::memory_order_relaxed);
+  mySlot->state.store(SharedBufferSlot::READY, std::memory_order_release);
 }
 
-bool SharedBuffer::tryLock() {
-  return myMutex != nullptr ? myMutex->try_lock() : false;
+int32_t SharedBuffer::state() const {
+  return mySlot != nullptr ? mySlot->state.load(std::memory_order_acquire) : SharedBufferSlot::FREE;
 }
 
-void SharedBuffer::unlock() {
-  if (myMutex != nullptr)
-    myMutex->unlock();
+int64_t SharedBuffer::seq() const {
+  return mySlot != nullptr ? mySlot->seq.load(std::memory_order_relaxed) : -1;
 }
 
 SharedBuffer::~SharedBuffer() {
   _releaseShared();
 }
 
-SharedBufferManager::SharedBufferManager(int bid) {
-  myPrefix = string_format("CefRasterB%d_", bid);
+void SharedBuffer::invalidate(const CefRect& rect) {
+  if (myIsStaleAll || rect.IsEmpty())
+    return;
+  if (myStaleRects.size() >= MAX_STALE_RECTS) {
+    invalidateAll();
+    return;
+  }
+  myStaleRects.push_back(rect);
+}
+
+void SharedBuffer::markActual(int rasterWidth, int rasterHeight) {
+  myIsStaleAll = false;
+  myStaleRects.clear();
+  myRasterWidth = rasterWidth;
+  myRasterHeight = rasterHeight;
+}
+
+SharedBufferManager::SharedBufferManager(int bid, int slotsCount, OverflowPolicy policy)
+    : myPolicy(policy), myPool(std::max(slotsCount, 2), nullptr) {
+  myPrefix = SharedBuffer::uniqueName(string_format("RasterB%d_", bid));
 }
 
-SharedBuffer* SharedBufferManager::_getOrCreateBuffer(size_t size, int index) {
+SharedBuffer* SharedBufferManager::_ensureCapacity(size_t size, int index) {
+  // NOTE: buffer must be acquired by producer (or absent)
   SharedBuffer* buf = myPool[index];
-  if (buf == nullptr || buf->size() < size) {
-    if (buf != nullptr)
-      delete buf;
-    myPool[index] = buf =
-        new SharedBuffer(myPrefix + string_format("%d_%d", size, index), nearestMemorySize(size));
+  size_t capacity;
+  if (buf == nullptr) {
+    capacity = growCapacity(size, 0);
+  } else if (buf->size() < size) {
+    capacity = growCapacity(size, buf->size());
+  } else {
+    if (size*SHRINK_RATIO >= buf->size()) {
+      buf->underusedFrames() = 0;
+      return buf;
+    }
+    if (++buf->underusedFrames() < SHRINK_AFTER_FRAMES)
+      return buf;
+    capacity = growCapacity(size, 0);
+    Log::trace("Shrink shared buffer '%s' (was underused for %d frames)", buf->uid().c_str(), buf->underusedFrames());
   }
+
+  if (buf != nullptr)
+    delete buf;
+  // NOTE: name must be unique because client caches opened segments by name
+  myPool[index] = buf =
+      new SharedBuffer(myPrefix + string_format("%d_%d_%d", (int)capacity, index, myCreatedCount++), capacity);
   return buf;
 }
 
-SharedBuffer& SharedBufferManager::getLockedBuffer(size_t size) {
-  myLastUsed = (myLastUsed + 1) % POOL_SIZE;
-  SharedBuffer* buf = _getOrCreateBuffer(size, myLastUsed);
+SharedBuffer& SharedBufferManager::acquireBuffer(size_t size, std::vector<CefRect>& droppedRects) {
+  const int count = (int)myPool.size();
+  const Clock::time_point startTime = Clock::now();
+  while (true) {
+    // 1. Find free buffer (starting from the next after last used).
+    for (int c = 1; c <= count; ++c) {
+      const int index = (myLastUsed + c) % count;
+      SharedBuffer* buf = myPool[index];
+      if (buf == nullptr || buf->tryAcquire(SharedBufferSlot::FREE)) {
+        myLastUsed = index;
+        _appendUnconsumedRects(index, droppedRects);
+        return *_ensureCapacity(size, index);
+      }
+    }
 
-  if (!buf->tryLock()) {
-    // It seems that selected buffer is used now. Select another.
-    myLastUsed = (myLastUsed + 1) % POOL_SIZE;
-    buf = _getOrCreateBuffer(size, myLastUsed);
-    buf->lock();
+    if (myPolicy == BACKPRESSURE) {
+      const long spentMcs = (long)std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime).count();
+      if (spentMcs < MAX_BACKPRESSURE_WAIT_MCS) {
+        std::this_thread::yield();
+        continue;
+      }
+    }
+
+    // 2. All buffers are busy, drop the oldest frame that wasn't consumed yet.
+    int oldest = -1;
+    for (int c = 0; c < count; ++c) {
+      SharedBuffer* buf = myPool[c];
+      if (buf->state() == SharedBufferSlot::READY && (oldest < 0 || buf->seq() < myPool[oldest]->seq()))
+        oldest = c;
+    }
+    if (oldest >= 0 && myPool[oldest]->tryAcquire(SharedBufferSlot::READY)) {
+      SharedBuffer* buf = myPool[oldest];
+      droppedRects.insert(droppedRects.end(), buf->publishedRects().begin(), buf->publishedRects().end());
+      ++myDroppedFrames;
+      Log::trace("Dropped frame %lld (not consumed by client), total dropped %lld", (long long)buf->seq(), (long long)myDroppedFrames);
+      myLastUsed = oldest;
+      _appendUnconsumedRects(oldest, droppedRects);
+      return *_ensureCapacity(size, oldest);
+    }
+    // Consumer has just taken the oldest frame, try again.
+    std::this_thread::yield();
   }
+}
+
+void SharedBufferManager::_appendUnconsumedRects(int acquiredIndex, std::vector<CefRect>& rects) {
+  // Client loads only the newest published frame and releases older ones
+  // without loading, so the newest frame must carry their dirty rects too.
+  for (int c = 0; c < (int)myPool.size(); ++c) {
+    SharedBuffer* buf = myPool[c];
+    if (c == acquiredIndex || buf == nullptr || buf->state() != SharedBufferSlot::READY)
+      continue;
+    rects.insert(rects.end(), buf->publishedRects().begin(), buf->publishedRects().end());
+  }
+}
 
-  return *buf;
+int64_t SharedBufferManager::publish(SharedBuffer& buffer, const std::vector<CefRect>& rects, int width, int height) {
+  buffer.publishedRects() = rects;
+  const int64_t seq = ++myFrameSeq;
+  buffer.publish(seq, width, height, static_cast<int>(rects.size()));
+  return seq;
+}
+
+void SharedBufferManager::invalidateOthers(const SharedBuffer& actual, const std::vector<CefRect>& rects) {
+  for (SharedBuffer* buf : myPool) {
+    if (buf == nullptr || buf == &actual)
+      continue;
+    for (const CefRect& r : rects)
+      buf->invalidate(r);
+  }
 }
 
 SharedBufferManager::~SharedBufferManager() {
-  for (int c = 0; c < POOL_SIZE; ++c)
-    if (myPool[c] != nullptr) {
-      delete myPool[c];
-      myPool[c] = nullptr;
+  for (SharedBuffer*& buf : myPool)
+    if (buf != nullptr) {
+      delete buf;
+      buf = nullptr;
     }
 }
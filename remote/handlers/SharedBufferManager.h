@@ -7,22 +7,49 @@
 #include <boost/interprocess/managed_shared_memory.hpp>
 #endif
 
-#include <boost/interprocess/sync/named_mutex.hpp>
+#include <vector>
+#include "include/internal/cef_types_wrappers.h"
+
+#include "SharedBufferSlot.h"
 
 class SharedBuffer {
  public:
+  // New buffer is created in WRITING state.
   SharedBuffer(std::string uid, size_t len);
   ~SharedBuffer();
 
-  void lock();
-  void unlock();
-  bool tryLock();
+  // Segment name that is unique among running servers (constructor removes
+  // existing segment with the same name, so names mustn't clash).
+  static std::string uniqueName(const std::string& name);
+
+  bool tryAcquire(SharedBufferSlot::State from);
+  void publish(int64_t seq, int width, int height, int rectsCount);
+  int32_t state() const;
+  int64_t seq() const;
 
   void* ptr() { return mySharedMem; }
   const std::string& uid() { return myUid; }
   int64_t handle() { return mySharedMemHandle; }
   size_t size() { return myLen; }
 
+  // Dirty rects of the last published frame (passed to the next frame when
+  // this one is dropped).
+  std::vector<CefRect>& publishedRects() { return myPublishedRects; }
+
+  // Count of consecutive frames that were much smaller than this buffer.
+  int& underusedFrames() { return myUnderusedFrames; }
+
+  // Damage tracking (used when only dirty rects are copied into raster).
+  // Stale rects are regions that were painted into other buffers of the pool
+  // and must be copied into this buffer before it becomes actual again.
+  void invalidate(const CefRect& rect);
+  void invalidateAll() { myIsStaleAll = true; myStaleRects.clear(); }
+  bool isStaleAll() const { return myIsStaleAll; }
+  const std::vector<CefRect>& staleRects() const { return myStaleRects; }
+  void markActual(int rasterWidth, int rasterHeight);
+  int rasterWidth() const { return myRasterWidth; }
+  int rasterHeight() const { return myRasterHeight; }
+
  private:
   const std::string myUid;
   const size_t myLen;
@@ -35,25 +62,58 @@ class SharedBuffer {
   boost::interprocess::managed_shared_memory::handle_t mySharedMemHandle{};
 #endif
   void * mySharedMem = nullptr;
+  SharedBufferSlot * mySlot = nullptr;
+
+  std::vector<CefRect> myPublishedRects;
+  int myUnderusedFrames = 0;
+
+  bool myIsStaleAll = true;
+  std::vector<CefRect> myStaleRects;
+  int myRasterWidth = 0;
+  int myRasterHeight = 0;
 
-  boost::interprocess::named_mutex * myMutex;
   void _releaseShared();
 };
 
+// Single-producer/single-consumer ring of shared raster buffers. Producer
+// (CEF UI thread) and consumer (java client) synchronize via atomic slot
+// states (see SharedBufferSlot), so no kernel mutex is used on the fast path.
 class SharedBufferManager {
  public:
-  SharedBufferManager(int bid);
+  enum OverflowPolicy {
+    // Overwrite the oldest frame that wasn't consumed yet.
+    DROP_OLDEST,
+    // Wait (bounded by timeout) until consumer releases some buffer.
+    BACKPRESSURE
+  };
+
+  SharedBufferManager(int bid, int slotsCount, OverflowPolicy policy);
   ~SharedBufferManager();
 
-  SharedBuffer & getLockedBuffer(size_t size);
+  // Returns buffer (in WRITING state) that can hold at least size bytes.
+  // Dirty rects of the dropped frames and of the frames that weren't consumed
+  // yet (client may skip them) are appended into droppedRects.
+  SharedBuffer & acquireBuffer(size_t size, std::vector<CefRect>& droppedRects);
+
+  // Makes buffer available to consumer, returns sequence number of the frame.
+  int64_t publish(SharedBuffer & buffer, const std::vector<CefRect>& rects, int width, int height);
+
+  // Marks rects as stale in all buffers except the specified one.
+  void invalidateOthers(const SharedBuffer& actual, const std::vector<CefRect>& rects);
+
+  int64_t getDroppedFramesCount() const { return myDroppedFrames; }
 
  private:
-  static constexpr int POOL_SIZE = 2;
+  const OverflowPolicy myPolicy;
   std::string myPrefix;
-  SharedBuffer * myPool[POOL_SIZE] = {nullptr, nullptr};
-  int myLastUsed = 1;
+  std::vector<SharedBuffer*> myPool;
+  int myLastUsed = 0;
+  int64_t myFrameSeq = 0;
+  int64_t myDroppedFrames = 0;
+  int myCreatedCount = 0;
 
-  SharedBuffer* _getOrCreateBuffer(size_t size, int index);
+  SharedBuffer* _ensureCapacity(size_t size, int index);
+  void _appendUnconsumedRects(int acquiredIndex, std::vector<CefRect>& rects);
 };
 
 #endif  // JCEF_SHAREDBUFFERMANAGER_H
@@ -0,0 +1,43 @@
+#ifndef JCEF_SHAREDBUFFERSLOT_H
+#define JCEF_SHAREDBUFFERSLOT_H
+
+#include <atomic>
+#include <cstdint>
+
+// State of the shared raster buffer. It's placed into the same shared segment
+// (as named object) and used by both cef_server (producer) and
+// shared_mem_helper (consumer), so it must contain only lock-free atomics.
+//
+// Producer:  FREE -> WRITING -> READY (publish frame)
+//            READY -> WRITING (drop frame that wasn't consumed yet)
+// Consumer:  READY -> READING -> FREE
+struct SharedBufferSlot {
+  static constexpr const char* NAME = "JcefSlot";
+
+  enum State : int32_t {
+    FREE = 0,
+    WRITING = 1,
+    READY = 2,
+    READING = 3
+  };
+
+  std::atomic<int32_t> state{WRITING};
+  std::atomic<int64_t> seq{-1}; // sequence number of the published frame
+
+  // Parameters of the published frame. Written by producer before the slot
+  // becomes READY (release), so consumer can read them after acquiring the slot
+  // (paint notification may describe an older frame that was dropped).
+  int32_t width{0};
+  int32_t height{0};
+  int32_t rectsCount{0};
+
+  bool transit(State from, State to) {
+    int32_t expected = from;
+    return state.compare_exchange_strong(expected, to, std::memory_order_acq_rel);
+  }
+};
+
+static_assert(std::atomic<int32_t>::is_always_lock_free, "SharedBufferSlot requires lock-free atomics");
+static_assert(std::atomic<int64_t>::is_always_lock_free, "SharedBufferSlot requires lock-free atomics");
+
+#endif  // JCEF_SHAREDBUFFERSLOT_H
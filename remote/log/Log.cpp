@@ -2,11 +2,15 @@
 #include "../Utils.h"
 
 #include <stdio.h>
+#include <algorithm>
+#include <condition_variable>
 #include <cstdarg>
+#include <cstring>
 #include <stdexcept>
 #include <vector>
 #include <thread>
 
+#include <boost/date_time/c_local_time_adjustor.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 namespace {
@@ -18,21 +22,330 @@ namespace {
   bool ourDoFlush = false;
   bool ourAddNewLine = true;
   bool ourPureMsg = false;
+  bool ourIsBinary = false;
   const std::string ourFinishedMsg = "Finished.";
+
+  // Binary log: magic (written every time when file is opened) followed by
+  // records: BinaryHeader, thread name, ndc, message.
+  const char ourBinaryMagic[8] = {'J', 'C', 'E', 'F', 'L', 'O', 'G', '1'};
+#pragma pack(push, 1)
+  struct BinaryHeader {
+    int64_t timeUs;  // since epoch (UTC)
+    int32_t level;
+    uint16_t threadLen;
+    uint16_t ndcLen;
+    uint32_t msgLen;
+  };
+#pragma pack(pop)
+
+  int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+  }
+
+  // Formats local time of day. The timezone lookup is done once per second,
+  // only milliseconds are formatted per record.
+  class TimeFormatter {
+   public:
+    const char* format(int64_t timeUs) {
+      const int64_t sec = timeUs / 1000000;
+      if (sec != myCachedSec) {
+        myCachedSec = sec;
+        const boost::posix_time::ptime local =
+            boost::date_time::c_local_adjustor<boost::posix_time::ptime>::utc_to_local(
+                boost::posix_time::from_time_t((time_t)sec));
+        const boost::posix_time::time_duration td = local.time_of_day();
+        snprintf(myBuf, sizeof(myBuf), "%02ld:%02ld:%02ld.", (long)td.hours(), (long)td.minutes(), (long)td.seconds());
+      }
+      snprintf(myBuf + 9, sizeof(myBuf) - 9, "%03d", (int)((timeUs / 1000) % 1000));
+      return myBuf;
+    }
+
+   private:
+    int64_t myCachedSec = -1;
+    char myBuf[16] = {};
+  };
+
+  void writeRecord(FILE* out, TimeFormatter& timeFormatter, int64_t timeUs, int level,
+                   const char* thread, size_t threadLen,
+                   const char* ndc, size_t ndcLen,
+                   const char* msg, size_t msgLen) {
+    if (ourIsBinary) {
+      BinaryHeader header{timeUs, level, (uint16_t)threadLen, (uint16_t)ndcLen, (uint32_t)msgLen};
+      fwrite(&header, sizeof(header), 1, out);
+      fwrite(thread, 1, threadLen, out);
+      fwrite(ndc, 1, ndcLen, out);
+      fwrite(msg, 1, msgLen, out);
+      return;
+    }
+    const char * end = ourAddNewLine ? "\n" : "";
+    if (ourPureMsg)
+      fprintf(out, "%.*s%s", (int)msgLen, msg, end);
+    else if (ndcLen == 0)
+      fprintf(out, "%s [%.*s] %.*s%s", timeFormatter.format(timeUs), (int)threadLen, thread, (int)msgLen, msg, end);
+    else
+      fprintf(out, "%s [%.*s %.*s] %.*s%s", timeFormatter.format(timeUs), (int)threadLen, thread, (int)ndcLen, ndc, (int)msgLen, msg, end);
+  }
+
+  const std::string& currentThreadName() {
+    if (ourThreadName.empty()) {
+      // TODO: pass thread name
+      static std::atomic<int> tidLocal{0};
+      ourThreadName.assign(string_format("th%d", tidLocal++));
+    }
+    return ourThreadName;
+  }
+
+  // Appends ndc of the current thread into buf, returns new length.
+  size_t appendNdc(char* buf, size_t len, size_t capacity) {
+    for (const auto& s: ourNDC) {
+      if (len > 0 && len + ourNdcSeparator.size() < capacity) {
+        memcpy(buf + len, ourNdcSeparator.data(), ourNdcSeparator.size());
+        len += ourNdcSeparator.size();
+      }
+      const size_t n = std::min(s.size(), capacity - len);
+      memcpy(buf + len, s.data(), n);
+      len += n;
+    }
+    return len;
+  }
+
+  //
+  // Asynchronous backend: every thread writes records into its own lock-free
+  // single-producer/single-consumer ring, the writer thread drains all rings,
+  // formats records (ordered by time) and writes them into the log file. When
+  // a ring is full the record is dropped (and counted), so logging never
+  // blocks the calling thread.
+  //
+  const uint32_t RING_SIZE = 512; // power of 2
+  const size_t RECORD_TEXT_SIZE = 480;
+
+  struct LogRecord {
+    int64_t timeUs;
+    int32_t level;
+    uint16_t threadLen;
+    uint16_t ndcLen;
+    uint32_t msgLen;
+    std::string* longMsg; // message that doesn't fit into text (rare)
+    char text[RECORD_TEXT_SIZE]; // thread name, ndc, message
+  };
+
+  struct LogRing {
+    std::atomic<uint32_t> head{0}; // modified by writer
+    std::atomic<uint32_t> tail{0}; // modified by owner thread
+    std::atomic<bool> owned{true};
+    LogRing* next = nullptr;
+    LogRecord records[RING_SIZE];
+  };
+
+  // Rings are never freed, the ring of the finished thread is reused by the
+  // next new thread.
+  std::atomic<LogRing*> ourRings{nullptr};
+  std::atomic<bool> ourIsAsync{false};
+  std::atomic<int64_t> ourDroppedCount{0};
+
+  struct RingHolder {
+    LogRing* ring = nullptr;
+    ~RingHolder() {
+      if (ring)
+        ring->owned.store(false, std::memory_order_release);
+    }
+  };
+  thread_local RingHolder ourRing;
+
+  LogRing* getThreadRing() {
+    if (ourRing.ring)
+      return ourRing.ring;
+    for (LogRing* r = ourRings.load(std::memory_order_acquire); r; r = r->next) {
+      bool expected = false;
+      if (r->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        if (r->head.load(std::memory_order_acquire) == r->tail.load(std::memory_order_relaxed))
+          return ourRing.ring = r;
+        // Not drained yet, keep looking for the empty one.
+        r->owned.store(false, std::memory_order_release);
+      }
+    }
+    LogRing* r = new LogRing();
+    LogRing* head = ourRings.load(std::memory_order_acquire);
+    do {
+      r->next = head;
+    } while (!ourRings.compare_exchange_weak(head, r, std::memory_order_acq_rel));
+    return ourRing.ring = r;
+  }
+
+  // Returns count of records in the ring (after adding) or 0 when the ring is
+  // full.
+  uint32_t enqueue(int level, int64_t timeUs, const char* format, va_list args) {
+    LogRing* ring = getThreadRing();
+    const uint32_t tail = ring->tail.load(std::memory_order_relaxed);
+    const uint32_t size = tail - ring->head.load(std::memory_order_acquire);
+    if (size >= RING_SIZE)
+      return 0;
+
+    LogRecord& r = ring->records[tail & (RING_SIZE - 1)];
+    r.timeUs = timeUs;
+    r.level = level;
+    const std::string& thread = currentThreadName();
+    r.threadLen = (uint16_t)std::min(thread.size(), (size_t)64);
+    memcpy(r.text, thread.data(), r.threadLen);
+    r.ndcLen = (uint16_t)(appendNdc(r.text + r.threadLen, 0, RECORD_TEXT_SIZE / 2));
+
+    char* msg = r.text + r.threadLen + r.ndcLen;
+    const size_t capacity = RECORD_TEXT_SIZE - r.threadLen - r.ndcLen;
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    const int status = vsnprintf(msg, capacity, format, argsCopy);
+    va_end(argsCopy);
+    r.longMsg = nullptr;
+    if (status < 0) {
+      r.msgLen = 0;
+    } else if ((size_t)status < capacity) {
+      r.msgLen = (uint32_t)status;
+    } else {
+      r.longMsg = new std::string((size_t)status, '\0');
+      vsnprintf(&(*r.longMsg)[0], (size_t)status + 1, format, args);
+      r.msgLen = (uint32_t)status;
+    }
+
+    ring->tail.store(tail + 1, std::memory_order_release);
+    return size + 1;
+  }
+
+  class AsyncWriter {
+   public:
+    ~AsyncWriter() { stop(); }
+
+    void start() {
+      std::lock_guard<std::mutex> lock(myMutex);
+      if (myThread.joinable())
+        return;
+      myStop = false;
+      myThread = std::thread([this]() { run(); });
+      ourIsAsync.store(true, std::memory_order_release);
+    }
+
+    void stop() {
+      {
+        std::lock_guard<std::mutex> lock(myMutex);
+        if (!myThread.joinable())
+          return;
+        ourIsAsync.store(false, std::memory_order_release);
+        myStop = true;
+      }
+      myCondition.notify_all();
+      myThread.join();
+    }
+
+    void wakeUp() { myCondition.notify_all(); }
+
+    // Waits (bounded) until all records enqueued before the call are written.
+    void flush() {
+      std::unique_lock<std::mutex> lock(myMutex);
+      if (!myThread.joinable())
+        return;
+      const int64_t request = ++myFlushRequested;
+      myCondition.notify_all();
+      myFlushedCondition.wait_for(lock, std::chrono::seconds(1),
+                                  [&]() { return myFlushed >= request; });
+    }
+
+   private:
+    struct Pending {
+      LogRing* ring;
+      uint32_t index;
+    };
+
+    void run() {
+      setThreadName("LogWriter");
+      TimeFormatter timeFormatter;
+      std::vector<Pending> pending;
+      int64_t reportedDropped = 0;
+      while (true) {
+        int64_t flushRequest;
+        bool stopping;
+        {
+          std::lock_guard<std::mutex> lock(myMutex);
+          flushRequest = myFlushRequested;
+          stopping = myStop;
+        }
+
+        drain(timeFormatter, pending);
+        const int64_t dropped = ourDroppedCount.load(std::memory_order_relaxed);
+        if (dropped != reportedDropped && ourLogFile != nullptr && !ourIsBinary) {
+          fprintf(ourLogFile, "%s [LogWriter] %lld log records were dropped (log rings overflow)\n",
+                  timeFormatter.format(nowUs()), (long long)(dropped - reportedDropped));
+          reportedDropped = dropped;
+        }
+        if (ourLogFile != nullptr)
+          fflush(ourLogFile);
+
+        std::unique_lock<std::mutex> lock(myMutex);
+        myFlushed = flushRequest;
+        myFlushedCondition.notify_all();
+        if (stopping)
+          break;
+        if (!myStop && myFlushRequested == myFlushed)
+          myCondition.wait_for(lock, std::chrono::milliseconds(20));
+      }
+    }
+
+    void drain(TimeFormatter& timeFormatter, std::vector<Pending>& pending) {
+      pending.clear();
+      std::vector<std::pair<LogRing*, uint32_t>> tails;
+      for (LogRing* r = ourRings.load(std::memory_order_acquire); r; r = r->next) {
+        const uint32_t head = r->head.load(std::memory_order_relaxed);
+        const uint32_t tail = r->tail.load(std::memory_order_acquire);
+        for (uint32_t i = head; i != tail; ++i)
+          pending.push_back({r, i});
+        tails.emplace_back(r, tail);
+      }
+      if (pending.empty())
+        return;
+
+      std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.ring->records[a.index & (RING_SIZE - 1)].timeUs < b.ring->records[b.index & (RING_SIZE - 1)].timeUs;
+      });
+      for (const Pending& p: pending) {
+        LogRecord& r = p.ring->records[p.index & (RING_SIZE - 1)];
+        const char* msg = r.longMsg ? r.longMsg->data() : r.text + r.threadLen + r.ndcLen;
+        if (ourLogFile != nullptr)
+          writeRecord(ourLogFile, timeFormatter, r.timeUs, r.level, r.text, r.threadLen,
+                      r.text + r.threadLen, r.ndcLen, msg, r.msgLen);
+        delete r.longMsg;
+        r.longMsg = nullptr;
+      }
+      for (const auto& t: tails)
+        t.first->head.store(t.second, std::memory_order_release);
+    }
+
+    std::thread myThread;
+    std::mutex myMutex;
+    std::condition_variable myCondition;
+    std::condition_variable myFlushedCondition;
+    bool myStop = false;
+    int64_t myFlushRequested = 0;
+    int64_t myFlushed = 0;
+  };
+
+  AsyncWriter ourAsyncWriter;
 }
 
 void setThreadName(std::string name) {
   ourThreadName.assign(name);
 }
 
-void Log::init(int level, std::string logfile) {
+void Log::init(int level, std::string logfile, bool binary) {
   if (level < 0) level = 0; // max verbose
   if (level > LEVEL_DISABLED) level = LEVEL_DISABLED;
 
   fprintf(stdout, "Initialize logger: level=%d file='%s'", level, logfile.c_str());
   if (!logfile.empty()) {
-    FILE* flog = fopen(logfile.c_str(), "a");
+    FILE* flog = fopen(logfile.c_str(), binary ? "ab" : "a");
     if (flog != nullptr) {
+      if (binary) {
+        ourIsBinary = true;
+        fwrite(ourBinaryMagic, sizeof(ourBinaryMagic), 1, flog);
+      }
       initImpl(level, flog);
     } else {
       fprintf(stderr,
@@ -53,6 +366,22 @@ void Log::initImpl(int level, FILE* logFile) {
     ourLogFile = stderr;
 }
 
+void Log::startAsync() {
+  ourAsyncWriter.start();
+}
+
+void Log::stopAsync() {
+  ourAsyncWriter.stop();
+}
+
+void Log::flush() {
+  ourAsyncWriter.flush();
+}
+
+int64_t Log::getDroppedCount() {
+  return ourDroppedCount.load(std::memory_order_relaxed);
+}
+
 bool Log::isDebugEnabled() {
   return ourLogLevel <= LEVEL_DEBUG;
 }
@@ -65,57 +394,97 @@ void Log::log(int level, const char *const format, ...) {
   if (level < ourLogLevel)
     return;
 
-  auto temp = std::vector<char>{};
-  auto length = std::size_t {63};
+  const int64_t timeUs = nowUs();
   std::va_list args;
-  while (temp.size() <= length)
-  {
-    temp.resize(length + 1);
+  if (ourIsAsync.load(std::memory_order_acquire)) {
     va_start(args, format);
-    const auto status = std::vsnprintf(temp.data(), temp.size(), format, args);
+    const uint32_t queued = enqueue(level, timeUs, format, args);
     va_end(args);
-    if (status < 0)
-      throw std::runtime_error {"string formatting error"};
-    length = static_cast<std::size_t>(status);
-  }
-
-  std::string msg(temp.data(), length);
-  std::string ndc;
-  if (!ourNDC.empty()) {
-    for (auto s: ourNDC) {
-      if (!ndc.empty())
-        ndc.append(ourNdcSeparator);
-      ndc.append(s);
+    if (queued > 0) {
+      if (level >= LEVEL_FATAL)
+        ourAsyncWriter.flush();
+      else if (level >= LEVEL_ERROR || queued == RING_SIZE / 2)
+        ourAsyncWriter.wakeUp();
+      return;
+    }
+    if (level < LEVEL_ERROR) {
+      ourDroppedCount.fetch_add(1, std::memory_order_relaxed);
+      return;
     }
+    // Ring is full, errors are written synchronously (out of order).
   }
 
-  if (ourThreadName.empty()) {
-    // TODO: pass thread name
-    // size_t tidHash = std::hash<std::thread::id>()(std::this_thread::get_id());
-    static int tidLocal = 0;
-    ourThreadName.assign(string_format("th%d", tidLocal++));
+  char buf[512];
+  auto temp = std::vector<char>{};
+  char* msg = buf;
+  va_start(args, format);
+  int status = std::vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (status < 0)
+    throw std::runtime_error {"string formatting error"};
+  if ((size_t)status >= sizeof(buf)) {
+    temp.resize((size_t)status + 1);
+    va_start(args, format);
+    status = std::vsnprintf(temp.data(), temp.size(), format, args);
+    va_end(args);
+    if (status < 0)
+      throw std::runtime_error {"string formatting error"};
+    msg = temp.data();
   }
 
-  const boost::posix_time::ptime now =  boost::posix_time::microsec_clock::local_time();
-  const boost::posix_time::time_duration td = now.time_of_day();
-  const long hours        = td.hours();
-  const long minutes      = td.minutes();
-  const long seconds      = td.seconds();
-  const long milliseconds = td.total_milliseconds() - ((hours * 3600 + minutes * 60 + seconds) * 1000);
-  char timeBuf[64];
-  sprintf(timeBuf, "%02ld:%02ld:%02ld.%03ld", hours, minutes, seconds, milliseconds);
-
-  const char * end = ourAddNewLine ? "\n" : "";
-  if (ourPureMsg)
-    fprintf(ourLogFile, "%s%s", msg.c_str(), end);
-  else if (ndc.empty())
-    fprintf(ourLogFile, "%s [%s] %s%s", timeBuf, ourThreadName.c_str(), msg.c_str(), end);
-  else
-    fprintf(ourLogFile, "%s [%s %s] %s%s", timeBuf, ourThreadName.c_str(), ndc.c_str(), msg.c_str(), end);
+  char ndc[RECORD_TEXT_SIZE];
+  const size_t ndcLen = appendNdc(ndc, 0, sizeof(ndc));
+  const std::string& thread = currentThreadName();
+
+  thread_local TimeFormatter timeFormatter;
+  writeRecord(ourLogFile, timeFormatter, timeUs, level, thread.data(), thread.size(), ndc, ndcLen, msg, (size_t)status);
   if (ourDoFlush)
     fflush(ourLogFile);
 }
 
+bool Log::decodeBinaryLog(const std::string& path, FILE* out) {
+  FILE* in = fopen(path.c_str(), "rb");
+  if (in == nullptr) {
+    fprintf(stderr, "Can't open binary log '%s'\n", path.c_str());
+    return false;
+  }
+
+  TimeFormatter timeFormatter;
+  std::vector<char> text;
+  bool result = true;
+  while (true) {
+    BinaryHeader header;
+    const size_t read = fread(&header, 1, sizeof(header), in);
+    if (read == 0)
+      break;
+    if (read >= sizeof(ourBinaryMagic) && memcmp(&header, ourBinaryMagic, sizeof(ourBinaryMagic)) == 0) {
+      // Start of the next session: skip magic and continue with the rest.
+      fseek(in, (long)sizeof(ourBinaryMagic) - (long)read, SEEK_CUR);
+      continue;
+    }
+    if (read < sizeof(header)) {
+      fprintf(stderr, "Truncated record in binary log '%s'\n", path.c_str());
+      result = false;
+      break;
+    }
+    const size_t len = (size_t)header.threadLen + header.ndcLen + header.msgLen;
+    text.resize(len);
+    if (fread(text.data(), 1, len, in) != len) {
+      fprintf(stderr, "Truncated record in binary log '%s'\n", path.c_str());
+      result = false;
+      break;
+    }
+    const char* p = text.data();
+    const bool wasBinary = ourIsBinary;
+    ourIsBinary = false;
+    writeRecord(out, timeFormatter, header.timeUs, header.level, p, header.threadLen,
+                p + header.threadLen, header.ndcLen, p + header.threadLen + header.ndcLen, header.msgLen);
+    ourIsBinary = wasBinary;
+  }
+  fclose(in);
+  return result;
+}
+
 Measurer::Measurer(const std::string & msg):
       myStartTime(Clock::now()),
       myMsg(msg) {}
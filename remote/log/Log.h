@@ -2,6 +2,8 @@
 #define JCEF_LOG_H
 
 #include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <string>
 
 #include "include/cef_base.h"
@@ -16,7 +18,21 @@ const int LEVEL_TRACE = 5;
 
 class Log {
 public:
-  static void init(int level, std::string logfile);
+  // When |binary| is true records are written in binary format (without
+  // formatting of time, thread and ndc), use decodeBinaryLog to read them.
+  static void init(int level, std::string logfile, bool binary = false);
+  // Moves writing of the log into the background thread: log calls only put
+  // records into the lock-free ring of the calling thread (records are dropped
+  // when the ring is full). Must be called in the browser process only (after
+  // CefExecuteProcess), the zygote process must stay single-threaded.
+  static void startAsync();
+  static void stopAsync();
+  // Waits until records of the async backend are written.
+  static void flush();
+  // Count of records dropped by the async backend.
+  static int64_t getDroppedCount();
+  // Prints records of the binary log as text.
+  static bool decodeBinaryLog(const std::string& path, FILE* out);
   static bool isDebugEnabled();
   static bool isTraceEnabled();
   
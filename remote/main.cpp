@@ -4,20 +4,31 @@
 #include "include/cef_app.h"
 #endif //WIN32
 
-#include <thrift/protocol/TBinaryProtocol.h>
+#include <algorithm>
+#include <cctype>
+
 #include <thrift/server/TThreadedServer.h>
 #include <thrift/transport/TServerSocket.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TTransportUtils.h>
+#ifdef JCEF_WITH_NONBLOCKING_SERVER
+#include <thrift/concurrency/ThreadFactory.h>
+#include <thrift/concurrency/ThreadManager.h>
+#include <thrift/server/TNonblockingServer.h>
+#include <thrift/transport/TNonblockingServerSocket.h>
+#endif //JCEF_WITH_NONBLOCKING_SERVER
 
 #include "CefUtils.h"
+#include "Metrics.h"
 #include "ServerHandler.h"
 #include "ServerState.h"
+#include "Utils.h"
 #include "log/Log.h"
 
 #include "handlers/app/HelperApp.h"
 
 using namespace apache::thrift;
+using namespace apache::thrift::concurrency;
 using namespace apache::thrift::protocol;
 using namespace apache::thrift::transport;
 using namespace apache::thrift::server;
@@ -30,15 +41,53 @@ extern void initMacApplication();
 
 class MyServerProcessor : public ServerProcessor {
  public:
-  MyServerProcessor(::std::shared_ptr<ServerIf> iface) : ServerProcessor(iface) {}
+  MyServerProcessor(::std::shared_ptr<ServerIf> iface)
+      : ServerProcessor(iface), myConnection(Metrics::createConnection()) {}
 
   bool process(std::shared_ptr<protocol::TProtocol> in,
                std::shared_ptr<protocol::TProtocol> out,
                void* connectionContext) override {
+    // Processor is created per connection, protocols are the same for all calls.
+    if (in.get() != myIn) {
+      myIn = in.get();
+      myInTransport = dynamic_cast<MeteredTransport*>(in->getTransport().get());
+    }
+    if (out.get() != myOut) {
+      myOut = out.get();
+      myOutTransport = dynamic_cast<MeteredTransport*>(out->getTransport().get());
+    }
+    const int64_t readBefore = myInTransport ? myInTransport->getBytesRead() : 0;
+    const int64_t writtenBefore = myOutTransport ? myOutTransport->getBytesWritten() : 0;
+
     std::string fname;
     protocol::TMessageType mtype;
     int32_t seqid;
-    in->readMessageBegin(fname, mtype, seqid);
+    if (myIsFirstMessage) {
+      // Client and server are configured separately (--protocol, --transport), so
+      // connection with mismatched wire format is rejected before dispatching.
+      myIsFirstMessage = false;
+      if (!_checkFirstBytes(in.get()))
+        return false;
+      try {
+        in->readMessageBegin(fname, mtype, seqid);
+      } catch (const transport::TTransportException& e) {
+        if (e.getType() != transport::TTransportException::END_OF_FILE)
+          _logWireFormatMismatch(e.what());
+        throw;
+      } catch (const protocol::TProtocolException& e) {
+        _logWireFormatMismatch(e.what());
+        throw;
+      }
+      // Non-strict binary protocol can read a frame header as a method name.
+      const bool isValidName = !fname.empty() && std::all_of(fname.begin(), fname.end(), [](char c) {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+      });
+      if (!isValidName) {
+        _logWireFormatMismatch("invalid method name");
+        return false;
+      }
+    } else
+      in->readMessageBegin(fname, mtype, seqid);
 
     if (mtype != protocol::T_CALL && mtype != protocol::T_ONEWAY) {
       Log::error("received invalid message type %d from client", mtype);
@@ -46,7 +95,78 @@ class MyServerProcessor : public ServerProcessor {
     }
 
     //Log::trace("\t process %s", fname.c_str());
-    return dispatchCall(in.get(), out.get(), fname, seqid, connectionContext);
+    MethodMetrics* metrics = Metrics::serverMethods().get(fname);
+    if (metrics != nullptr)
+      metrics->enter();
+    bool result = false;
+    {
+      ScopedMetrics scoped(metrics);
+      try {
+        result = dispatchCall(in.get(), out.get(), fname, seqid, connectionContext);
+      } catch (...) {
+        scoped.setFailed();
+        _recordTraffic(metrics, readBefore, writtenBefore);
+        throw;
+      }
+      if (!result)
+        scoped.setFailed();
+    }
+    _recordTraffic(metrics, readBefore, writtenBefore);
+    return result;
+  }
+
+ private:
+  const std::shared_ptr<ConnectionMetrics> myConnection;
+  protocol::TProtocol* myIn = nullptr;
+  protocol::TProtocol* myOut = nullptr;
+  MeteredTransport* myInTransport = nullptr;
+  MeteredTransport* myOutTransport = nullptr;
+  bool myIsFirstMessage = true;
+
+  static void _logWireFormatMismatch(const char* err) {
+    const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
+    Log::error("Can't read the first message from client (%s), probably wire format mismatch: "
+               "server uses %s protocol and %s transport, client must be configured with the same "
+               "CEF_SERVER_PROTOCOL and CEF_SERVER_TRANSPORT.",
+               err,
+               cmdArgs.isCompactProtocol() ? "compact" : "binary",
+               cmdArgs.isFramedTransport() ? "framed" : "buffered");
+  }
+
+  // Unframed message starts with 0x80 0x01 (strict binary protocol) or 0x82
+  // (compact protocol), anything else is a frame length. Framed transport
+  // reads the frame itself (and rejects unframed data as invalid frame size),
+  // so only unframed connections are checked here.
+  static bool _checkFirstBytes(protocol::TProtocol* in) {
+    const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
+    if (cmdArgs.isFramedTransport())
+      return true;
+
+    std::shared_ptr<transport::TTransport> trans = in->getTransport();
+    if (!trans->peek())
+      return true; // client disconnected, nothing to check
+    uint8_t buf[2];
+    uint32_t len = 2;
+    const uint8_t* bytes = trans->borrow(buf, &len);
+    if (bytes == nullptr)
+      return true; // too few bytes are buffered, protocol validates the message
+
+    const bool isBinary = bytes[0] == 0x80 && bytes[1] == 0x01;
+    const bool isCompact = bytes[0] == 0x82;
+    if (cmdArgs.isCompactProtocol() ? isCompact : isBinary)
+      return true;
+    _logWireFormatMismatch(isBinary ? "client uses binary protocol"
+                           : isCompact ? "client uses compact protocol"
+                           : "client uses framed transport");
+    return false;
+  }
+
+  void _recordTraffic(MethodMetrics* metrics, int64_t readBefore, int64_t writtenBefore) {
+    const int64_t bytesIn = myInTransport ? myInTransport->getBytesRead() - readBefore : 0;
+    const int64_t bytesOut = myOutTransport ? myOutTransport->getBytesWritten() - writtenBefore : 0;
+    if (metrics != nullptr)
+      metrics->exit(bytesIn, bytesOut);
+    myConnection->record(bytesIn, bytesOut);
   }
 };
 
@@ -66,8 +186,96 @@ class MyServerProcessorFactory : public ::apache::thrift::TProcessorFactory {
   ::std::shared_ptr< ServerIfFactory > handlerFactory_;
 };
 
+#ifdef JCEF_WITH_NONBLOCKING_SERVER
+static std::shared_ptr<ThreadManager> createWorkers(int count) {
+  std::shared_ptr<ThreadManager> threadManager = ThreadManager::newSimpleThreadManager(count);
+  threadManager->threadFactory(std::make_shared<ThreadFactory>());
+  threadManager->start();
+  return threadManager;
+}
+#endif //JCEF_WITH_NONBLOCKING_SERVER
+
+// Returns nullptr when server transport can't be created.
+static std::shared_ptr<TServer> createServer(std::shared_ptr<TProcessorFactory> processorFactory) {
+  const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
+  std::string pipePath;
+  if (cmdArgs.useTcp()) {
+    Log::info("TCP transport will be used, port=%d", cmdArgs.getPort());
+  } else {
+    pipePath = cmdArgs.getPipe();
+    if (pipePath.empty()) {
+      Log::error("Pipe path is empty, exit.");
+      return nullptr;
+    }
+#ifdef WIN32
+    if (pipePath.rfind("\\\\.\\pipe\\", 0) != 0)
+      pipePath = "\\\\.\\pipe\\" + pipePath;
+    Log::info("Windows-pipe transport will be used, path=%s", pipePath.c_str());
+#else
+    Log::info("Pipe transport will be used, path=%s", pipePath.c_str());
+    std::remove(pipePath.c_str());
+#endif //WIN32
+  }
+
+  // NOTE: client uses framed transport when nonblocking mode is requested, so
+  // framing is kept (see isFramedTransport) even if we fall back to the thread per connection.
+  CommandLineArgs::ServerMode mode = cmdArgs.getServerMode();
+  if (mode == CommandLineArgs::SM_NONBLOCKING) {
+#ifndef JCEF_WITH_NONBLOCKING_SERVER
+    Log::warn("cef_server is built without nonblocking server, thread per connection will be used.");
+    mode = CommandLineArgs::SM_THREADED;
+#elif defined(WIN32)
+    if (!cmdArgs.useTcp()) {
+      Log::warn("Nonblocking server doesn't support windows-pipe transport, thread per connection will be used.");
+      mode = CommandLineArgs::SM_THREADED;
+    }
+#endif
+  }
+
+  Log::info("Wire format: %s protocol, %s transport (buffer %d bytes)",
+            cmdArgs.isCompactProtocol() ? "compact" : "binary",
+            cmdArgs.isFramedTransport() ? "framed" : "buffered",
+            cmdArgs.getTransportBufferSize());
+  std::shared_ptr<TProtocolFactory> protocolFactory = WireFormat::protocolFactory();
+#ifdef JCEF_WITH_NONBLOCKING_SERVER
+  if (mode == CommandLineArgs::SM_NONBLOCKING) {
+    const int workers = cmdArgs.getServerWorkersCount();
+    Log::info("Nonblocking server will be used, workers=%d", workers);
+    std::shared_ptr<TNonblockingServerSocket> socket = cmdArgs.useTcp()
+        ? std::make_shared<TNonblockingServerSocket>(cmdArgs.getPort())
+        : std::make_shared<TNonblockingServerSocket>(pipePath);
+    // Server reads whole frames itself, so transports are applied to the memory buffers of calls.
+    std::shared_ptr<TTransportFactory> transportFactory = std::make_shared<MeteredTransportFactory>(std::make_shared<TTransportFactory>());
+    return std::make_shared<TNonblockingServer>(
+        processorFactory,
+        transportFactory, transportFactory,
+        protocolFactory, protocolFactory,
+        socket,
+        createWorkers(workers));
+  }
+#endif //JCEF_WITH_NONBLOCKING_SERVER
+
+  std::shared_ptr<TServerTransport> serverTransport;
+  if (cmdArgs.useTcp())
+    serverTransport = std::make_shared<TServerSocket>(cmdArgs.getPort());
+  else
+#ifdef WIN32
+    serverTransport = std::make_shared<PipeTransportServer>(pipePath);
+#else
+    serverTransport = std::make_shared<TServerSocket>(pipePath.c_str());
+#endif //WIN32
+
+  std::shared_ptr<TTransportFactory> transportFactory = std::make_shared<MeteredTransportFactory>(WireFormat::transportFactory());
+
+  return std::make_shared<TThreadedServer>(
+      processorFactory, serverTransport, transportFactory, protocolFactory);
+}
+
 int main(int argc, char* argv[]) {
   ServerState::instance().init(argc, argv);
+  const std::string decodeLogFile = ServerState::instance().getCmdArgs().getDecodeLogFile();
+  if (!decodeLogFile.empty())
+    return Log::decodeBinaryLog(decodeLogFile, stdout) ? 0 : -4;
 
   setThreadName("main");
 #if defined(OS_LINUX)
@@ -102,6 +310,10 @@ int main(int argc, char* argv[]) {
 #elif OS_MAC
   initMacApplication();
 #endif
+  // Only the browser process gets here (helper processes, e.g. zygote, must
+  // stay single-threaded).
+  if (!ServerState::instance().getCmdArgs().isLogSync())
+    Log::startAsync();
   const Clock::time_point startTime = Clock::now();
 
   const bool success = CefUtils::initializeCef();
@@ -110,35 +322,11 @@ int main(int argc, char* argv[]) {
     return -2;
   }
 
-  const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
-  std::shared_ptr<TServerTransport> serverTransport;
-  if (cmdArgs.useTcp()) {
-    Log::info("TCP transport will be used, port=%d", cmdArgs.getPort());
-    serverTransport = std::make_shared<TServerSocket>(cmdArgs.getPort());
-  } else {
-    std::string pipePath = cmdArgs.getPipe();
-    if (pipePath.empty()) {
-      Log::error("Pipe path is empty, exit.");
-      return -3;
-    }
-#ifdef WIN32
-    if (pipePath.rfind("\\\\.\\pipe\\", 0) != 0)
-      pipePath = "\\\\.\\pipe\\" + pipePath;
-    Log::info("Windows-pipe transport will be used, path=%s", pipePath.c_str());
-    serverTransport = std::make_shared<PipeTransportServer>(pipePath);
-#else
-    Log::info("Pipe transport will be used, path=%s", pipePath.c_str());
-    std::remove(pipePath.c_str());
-    serverTransport = std::make_shared<TServerSocket>(pipePath.c_str());
-#endif //WIN32
-  }
   std::shared_ptr<ServerHandlerFactory> handlersFactory = ServerState::instance().getServerHandlerFactory();
   std::shared_ptr<apache::thrift::TProcessorFactory> processorFactory = std::make_shared<MyServerProcessorFactory>(handlersFactory);
-  std::shared_ptr<TThreadedServer> server = std::make_shared<TThreadedServer>(
-      processorFactory,
-      serverTransport,
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
+  std::shared_ptr<TServer> server = createServer(processorFactory);
+  if (!server)
+    return -3;
 
   if (Log::isDebugEnabled()) {
     const Clock::time_point endTime = Clock::now();
@@ -159,6 +347,7 @@ int main(int argc, char* argv[]) {
     Log::debug("Done, server stopped.");
   });
 
+  const CommandLineArgs& cmdArgs = ServerState::instance().getCmdArgs();
   std::thread testThread;
   if (cmdArgs.isTestMode()) {
     const int timeoutSec = 30;
@@ -183,6 +372,9 @@ int main(int argc, char* argv[]) {
   Log::debug("Finished message loop.");
   server->stop();
   servThread.join();
+  if (cmdArgs.isMetricsDump())
+    Metrics::dump();
   Log::debug("Buy!");
+  Log::stopAsync();
   return 0;
 }
@@ -41,7 +41,7 @@ bool RemoteCookieAccessFilter::CanSendCookie(CefRefPtr<CefBrowser> browser,
   LNDCT();
   RemoteRequest::Holder req(request);
   return myService->exec<bool>([&](RpcExecutor::Service s){
-    return s->CookieAccessFilter_CanSendCookie(myPeerId, myBid, req.get()->serverIdWithMap(), cookie2list(cookie));
+    return s->CookieAccessFilter_CanSendCookie(myPeerId, myBid, req.get()->serverIdWithInfo(), cookie2list(cookie));
   }, true);
 }
 
@@ -64,8 +64,8 @@ bool RemoteCookieAccessFilter::CanSaveCookie(CefRefPtr<CefBrowser> browser,
   RemoteRequest::Holder req(request);
   RemoteResponse::Holder resp(response);
   return myService->exec<bool>([&](RpcExecutor::Service s){
-    return s->CookieAccessFilter_CanSaveCookie(myPeerId, myBid, req.get()->serverIdWithMap(),
-                                               resp.get()->serverIdWithMap(), cookie2list(cookie));
+    return s->CookieAccessFilter_CanSaveCookie(myPeerId, myBid, req.get()->serverIdWithInfo(),
+                                               resp.get()->serverIdWithInfo(), cookie2list(cookie));
   }, true);
 }
 
@@ -8,8 +8,8 @@
 
 class RemoteRequest : public virtual CefBaseRefCounted, public RemoteServerObjectUpdatable<RemoteRequest, CefRequest> {
  public:
-  void updateImpl(const std::map<std::string, std::string>& requestInfo) override;
-  std::map<std::string, std::string> toMapImpl() override;
+  void updateImpl(const thrift_codegen::RObject& robj) override;
+  void toThriftImpl(thrift_codegen::RObject& robj) override;
 
  private:
   explicit RemoteRequest(CefRefPtr<CefRequest> delegate, int id) : RemoteServerObjectUpdatable(id, delegate) {}
@@ -59,7 +59,7 @@ bool RemoteRequestHandler::OnBeforeBrowse(CefRefPtr<CefBrowser> browser,
 
   RemoteRequest::Holder req(request);
   return myService->exec<bool>([&](RpcExecutor::Service s){
-    return s->RequestHandler_OnBeforeBrowse(myBid, req.get()->serverIdWithMap(), user_gesture, is_redirect);
+    return s->RequestHandler_OnBeforeBrowse(myBid, req.get()->serverIdWithInfo(), user_gesture, is_redirect);
   }, false);
 }
 
@@ -102,18 +102,34 @@ CefRefPtr<CefResourceRequestHandler> RemoteRequestHandler::GetResourceRequestHan
   // Called on the browser process IO thread before a resource request is initiated.
   LogNdc ndc(__FILE_NAME__, __FUNCTION__, 500, false, false, "ChromeIO");
 
+  std::shared_ptr<const ResourceRules> rules;
+  {
+    std::lock_guard<std::mutex> lock(myResourceRulesMutex);
+    rules = myResourceRules;
+  }
+  if (rules) {
+    const ResourceRules::Action action = rules->match(request->GetURL().ToString());
+    if (action != ResourceRules::CALL_CLIENT)
+      return ResourceRules::getLocalHandler(action);
+  }
+
   RemoteRequest::Holder req(request);
   thrift_codegen::RObject peer;
   peer.__set_objId(-1);
   myServiceIO->exec([&](RpcExecutor::Service s){
     s->RequestHandler_GetResourceRequestHandler(
-        peer, myBid, req.get()->serverIdWithMap(), is_navigation, is_download, request_initiator.ToString());
+        peer, myBid, req.get()->serverIdWithInfo(), is_navigation, is_download, request_initiator.ToString());
   });
 
   disable_default_handling = peer.__isset.flags ? peer.flags != 0 : false;
   return peer.objId != -1 ? new RemoteResourceRequestHandler(myBid, myServiceIO, peer) : nullptr;
 }
 
+void RemoteRequestHandler::setResourceRules(std::shared_ptr<const ResourceRules> rules) {
+  std::lock_guard<std::mutex> lock(myResourceRulesMutex);
+  myResourceRules = rules;
+}
+
 ///
 /// Called on the IO thread when the browser needs credentials from the user.
 /// |origin_url| is the origin making this authentication request. |isProxy|
@@ -2,6 +2,7 @@
 #define JCEF_REMOTEREQUESTHANDLER_H
 
 #include "../Utils.h"
+#include "ResourceRules.h"
 #include "include/cef_request_handler.h"
 
 class RemoteClientHandler;
@@ -66,6 +67,9 @@ class RemoteRequestHandler : public CefRequestHandler {
   void OnRenderProcessTerminated(CefRefPtr<CefBrowser> browser,
                                  TerminationStatus status) override;
 
+  // Rules are evaluated in GetResourceRequestHandler (nullptr disables them).
+  void setResourceRules(std::shared_ptr<const ResourceRules> rules);
+
  private:
   const int myBid;
   std::shared_ptr<RpcExecutor> myService;
@@ -76,6 +80,9 @@ class RemoteRequestHandler : public CefRequestHandler {
   std::set<int> myCallbacks;
   std::set<int> myAuthCallbacks;
 
+  std::mutex myResourceRulesMutex;
+  std::shared_ptr<const ResourceRules> myResourceRules;
+
   IMPLEMENT_REFCOUNTING(RemoteRequestHandler);
 };
 
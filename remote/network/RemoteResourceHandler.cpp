@@ -1,11 +1,43 @@
 #include "RemoteResourceHandler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
 #include "../CefUtils.h"
+#include "../ServerState.h"
 #include "../handlers/RemoteClientHandler.h"
 #include "../network/RemoteRequest.h"
 #include "../network/RemoteResponse.h"
 #include "../callback/RemoteCallback.h"
+#include "../handlers/SharedBufferManager.h"
 #include "../log/Log.h"
 
+namespace {
+  // Smaller chunks are passed via thrift (ResponseData.data).
+  constexpr int SHARED_READ_MIN_BYTES = 16*1024;
+  constexpr size_t SHARED_READ_MIN_CAPACITY = 256*1024;
+
+  // ReadResponse is called on the IO thread, so every thread has single buffer
+  // that is reused by all resource handlers (client writes data into it
+  // during ResourceHandler_ReadResponseShared, so it's free after the call).
+  SharedBuffer* getReadBuffer(int bytesToRead) {
+    static std::atomic<int> ourCounter{0};
+    thread_local std::unique_ptr<SharedBuffer> ourBuffer;
+    if (!ourBuffer || ourBuffer->size() < (size_t)bytesToRead) {
+      ourBuffer.reset();
+      const size_t capacity = std::max((size_t)bytesToRead, SHARED_READ_MIN_CAPACITY);
+      try {
+        ourBuffer.reset(new SharedBuffer(SharedBuffer::uniqueName(string_format("ReadB%d", ourCounter++)), capacity));
+      } catch (const std::exception& e) {
+        Log::error("Can't allocate shared buffer for response data, err: %s", e.what());
+        return nullptr;
+      }
+    }
+    return ourBuffer->ptr() != nullptr ? ourBuffer.get() : nullptr;
+  }
+}
+
 RemoteResourceHandler::RemoteResourceHandler(
     int bid,
     std::shared_ptr<RpcExecutor> service,
@@ -15,7 +47,7 @@ RemoteResourceHandler::RemoteResourceHandler(
           peer.objId,
           [=](std::shared_ptr<thrift_codegen::ClientHandlersClient> service) {
             service->ResourceHandler_Dispose(peer.objId);
-          }), myBid(bid) {}
+          }), myBid(bid), myUseSharedMem(ServerState::instance().getCmdArgs().isResponseReadSharedMem()) {}
 
 RemoteResourceHandler::~RemoteResourceHandler() {
   // Log::trace("Disposed RemoteResourceHandler %d", myBid);
@@ -90,16 +122,27 @@ bool RemoteResourceHandler::ReadResponse(void* data_out,
   RemoteCallback* rc = RemoteCallback::wrapDelegate(callback);
   thrift_codegen::ResponseData _return;
   _return.bytes_read = 0;
-  myService->exec([&](RpcExecutor::Service s){
-    s->ResourceHandler_ReadResponse(_return, myPeerId, bytes_to_read, rc->serverId());
-  });
+  SharedBuffer* buffer = myUseSharedMem && bytes_to_read >= SHARED_READ_MIN_BYTES ? getReadBuffer(bytes_to_read) : nullptr;
+  if (buffer != nullptr) {
+    myService->exec([&](RpcExecutor::Service s){
+      s->ResourceHandler_ReadResponseShared(_return, myPeerId, bytes_to_read, rc->serverId(), buffer->uid(), buffer->handle());
+    });
+  } else {
+    myService->exec([&](RpcExecutor::Service s){
+      s->ResourceHandler_ReadResponse(_return, myPeerId, bytes_to_read, rc->serverId());
+    });
+  }
   if (!_return.continueRead)
     RemoteCallback::dispose(rc->getId());
   else
     myCallbacks.insert(rc->getId());
-  bytes_read = _return.bytes_read;
-  if (bytes_read > 0)
-    memcpy(data_out, _return.data.c_str(), _return.data.size());
+  bytes_read = std::min(_return.bytes_read, bytes_to_read);
+  if (bytes_read > 0) {
+    if (buffer != nullptr)
+      memcpy(data_out, buffer->ptr(), bytes_read);
+    else
+      memcpy(data_out, _return.data.c_str(), std::min((size_t)bytes_read, _return.data.size()));
+  }
   return _return.continueRead;
 }
 
@@ -22,6 +22,7 @@ class RemoteResourceHandler : public CefResourceHandler, public RemoteJavaObject
 
  private:
   const int myBid;
+  const bool myUseSharedMem;
   std::set<int> myCallbacks;
   IMPLEMENT_REFCOUNTING(RemoteResourceHandler);
 };
@@ -47,7 +47,7 @@ CefRefPtr<CefCookieAccessFilter> RemoteResourceRequestHandler::GetCookieAccessFi
   thrift_codegen::RObject remoteHandler;
   
   myService->exec([&](RpcExecutor::Service s){
-    s->ResourceRequestHandler_GetCookieAccessFilter(remoteHandler, myPeerId, myBid, req.get()->serverIdWithMap());
+    s->ResourceRequestHandler_GetCookieAccessFilter(remoteHandler, myPeerId, myBid, req.get()->serverIdWithInfo());
   });
   return remoteHandler.objId != -1 ? new RemoteCookieAccessFilter(myBid, myService, remoteHandler) : nullptr;
 }
@@ -74,7 +74,7 @@ CefResourceRequestHandler::ReturnValue RemoteResourceRequestHandler::OnBeforeRes
   RemoteRequest::Holder req(request);
   CefResourceRequestHandler::ReturnValue result = RV_CONTINUE;
   myService->exec([&](RpcExecutor::Service s){
-    bool boolRes = s->ResourceRequestHandler_OnBeforeResourceLoad(myPeerId, myBid, req.get()->serverIdWithMap());
+    bool boolRes = s->ResourceRequestHandler_OnBeforeResourceLoad(myPeerId, myBid, req.get()->serverIdWithInfo());
     result = (boolRes ? RV_CANCEL : RV_CONTINUE);
   });
   return result;
@@ -99,7 +99,7 @@ CefRefPtr<CefResourceHandler> RemoteResourceRequestHandler::GetResourceHandler(
   RemoteRequest::Holder req(request);
   thrift_codegen::RObject remoteHandler;
   myService->exec([&](RpcExecutor::Service s){
-    s->ResourceRequestHandler_GetResourceHandler(remoteHandler, myPeerId, myBid, req.get()->serverIdWithMap());
+    s->ResourceRequestHandler_GetResourceHandler(remoteHandler, myPeerId, myBid, req.get()->serverIdWithInfo());
   });
   return remoteHandler.objId != -1 ? new RemoteResourceHandler(myBid, myService, remoteHandler) : nullptr;
 }
@@ -127,8 +127,8 @@ void RemoteResourceRequestHandler::OnResourceRedirect(
   RemoteResponse::Holder resp(response);
   std::string result;
   myService->exec([&](RpcExecutor::Service s){
-    s->ResourceRequestHandler_OnResourceRedirect(result, myPeerId, myBid, req.get()->serverIdWithMap(),
-                                                 resp.get()->serverIdWithMap(), new_url.ToString());
+    s->ResourceRequestHandler_OnResourceRedirect(result, myPeerId, myBid, req.get()->serverIdWithInfo(),
+                                                 resp.get()->serverIdWithInfo(), new_url.ToString());
   });
   CefString tmp(result);
   new_url.swap(tmp);
@@ -158,8 +158,8 @@ bool RemoteResourceRequestHandler::OnResourceResponse(
   RemoteRequest::Holder req(request);
   RemoteResponse::Holder resp(response);
   return myService->exec<bool>([&](RpcExecutor::Service s){
-    return s->ResourceRequestHandler_OnResourceResponse(myPeerId, myBid, req.get()->serverIdWithMap(),
-                                                        resp.get()->serverIdWithMap());
+    return s->ResourceRequestHandler_OnResourceResponse(myPeerId, myBid, req.get()->serverIdWithInfo(),
+                                                        resp.get()->serverIdWithInfo());
   }, false);
 }
 
@@ -192,8 +192,8 @@ void RemoteResourceRequestHandler::OnResourceLoadComplete(
   RemoteRequest::Holder req(request);
   RemoteResponse::Holder resp(response);
   myService->exec([&](RpcExecutor::Service s){
-    s->ResourceRequestHandler_OnResourceLoadComplete(myPeerId, myBid, req.get()->serverIdWithMap(),
-                                                     resp.get()->serverIdWithMap(), status2str(status), received_content_length);
+    s->ResourceRequestHandler_OnResourceLoadComplete(myPeerId, myBid, req.get()->serverIdWithInfo(),
+                                                     resp.get()->serverIdWithInfo(), status2str(status), received_content_length);
   });
 }
 
@@ -216,7 +216,7 @@ void RemoteResourceRequestHandler::OnProtocolExecution(
   LNDCT();
   RemoteRequest::Holder req(request);
   myService->exec([&](RpcExecutor::Service s){
-    allow_os_execution = s->ResourceRequestHandler_OnProtocolExecution(myPeerId, myBid, req.get()->serverIdWithMap(), allow_os_execution);
+    allow_os_execution = s->ResourceRequestHandler_OnProtocolExecution(myPeerId, myBid, req.get()->serverIdWithInfo(), allow_os_execution);
   });
 }
 
@@ -1,26 +1,26 @@
 #include "RemoteResponse.h"
 
-extern std::string err2str(cef_errorcode_t errorcode);
-extern cef_errorcode_t str2err(std::string err);
+void RemoteResponse::updateImpl(const thrift_codegen::RObject& robj) {
+  if (!robj.__isset.responseInfo)
+    return;
 
-void RemoteResponse::updateImpl(const std::map<std::string, std::string>& requestInfo) {
-  SET_INT(requestInfo, Status);
-  SET_STR(requestInfo, StatusText);
-  SET_STR(requestInfo, MimeType);
-
-  if (requestInfo.count("Error") > 0) {
-    myDelegate->SetError(str2err(requestInfo.at("Error")));
-  }
+  const thrift_codegen::ResponseInfo& info = robj.responseInfo;
+  if (info.__isset.status)
+    myDelegate->SetStatus(info.status);
+  if (info.__isset.statusText)
+    myDelegate->SetStatusText(info.statusText);
+  if (info.__isset.mimeType)
+    myDelegate->SetMimeType(info.mimeType);
+  if (info.__isset.error)
+    myDelegate->SetError(static_cast<cef_errorcode_t>(info.error));
 }
 
-std::map<std::string, std::string> RemoteResponse::toMapImpl() {
-  std::map<std::string, std::string> result;
-  result["IsReadOnly"] = std::to_string(myDelegate->IsReadOnly());
-
-  GET_INT(result, Status);
-  GET_STR(result, StatusText);
-  GET_STR(result, MimeType);
-
-  result["Error"] = err2str(myDelegate->GetError());
-  return result;
+void RemoteResponse::toThriftImpl(thrift_codegen::RObject& robj) {
+  thrift_codegen::ResponseInfo info;
+  info.__set_isReadOnly(myDelegate->IsReadOnly());
+  info.__set_status(myDelegate->GetStatus());
+  info.__set_statusText(myDelegate->GetStatusText().ToString());
+  info.__set_mimeType(myDelegate->GetMimeType().ToString());
+  info.__set_error(myDelegate->GetError());
+  robj.__set_responseInfo(info);
 }
@@ -8,8 +8,8 @@
 
 class RemoteResponse : public virtual CefBaseRefCounted, public RemoteServerObjectUpdatable<RemoteResponse, CefResponse> {
  public:
-  void updateImpl(const std::map<std::string, std::string>& requestInfo) override;
-  std::map<std::string, std::string> toMapImpl() override;
+  void updateImpl(const thrift_codegen::RObject& robj) override;
+  void toThriftImpl(thrift_codegen::RObject& robj) override;
 
  private:
   explicit RemoteResponse(CefRefPtr<CefResponse> delegate, int id)
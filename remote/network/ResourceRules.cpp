@@ -0,0 +1,97 @@
+#include "ResourceRules.h"
+
+namespace {
+  class CancelResourceRequestHandler : public CefResourceRequestHandler {
+   public:
+    ReturnValue OnBeforeResourceLoad(CefRefPtr<CefBrowser> browser,
+                                     CefRefPtr<CefFrame> frame,
+                                     CefRefPtr<CefRequest> request,
+                                     CefRefPtr<CefCallback> callback) override {
+      return RV_CANCEL;
+    }
+
+   private:
+    IMPLEMENT_REFCOUNTING(CancelResourceRequestHandler);
+  };
+
+  class BlockCookiesFilter : public CefCookieAccessFilter {
+   public:
+    bool CanSendCookie(CefRefPtr<CefBrowser> browser,
+                       CefRefPtr<CefFrame> frame,
+                       CefRefPtr<CefRequest> request,
+                       const CefCookie& cookie) override {
+      return false;
+    }
+
+    bool CanSaveCookie(CefRefPtr<CefBrowser> browser,
+                       CefRefPtr<CefFrame> frame,
+                       CefRefPtr<CefRequest> request,
+                       CefRefPtr<CefResponse> response,
+                       const CefCookie& cookie) override {
+      return false;
+    }
+
+   private:
+    IMPLEMENT_REFCOUNTING(BlockCookiesFilter);
+  };
+
+  class BlockCookiesResourceRequestHandler : public CefResourceRequestHandler {
+   public:
+    BlockCookiesResourceRequestHandler() : myFilter(new BlockCookiesFilter()) {}
+
+    CefRefPtr<CefCookieAccessFilter> GetCookieAccessFilter(
+        CefRefPtr<CefBrowser> browser,
+        CefRefPtr<CefFrame> frame,
+        CefRefPtr<CefRequest> request) override {
+      return myFilter;
+    }
+
+   private:
+    const CefRefPtr<CefCookieAccessFilter> myFilter;
+    IMPLEMENT_REFCOUNTING(BlockCookiesResourceRequestHandler);
+  };
+}
+
+ResourceRules::Action ResourceRules::match(const std::string& url) const {
+  for (const Rule& rule : myRules) {
+    if (matchPattern(rule.urlPattern, url))
+      return rule.action;
+  }
+  return CALL_CLIENT;
+}
+
+bool ResourceRules::matchPattern(const std::string& pattern, const std::string& str) {
+  // Greedy wildcard matching with backtracking to the last '*'.
+  size_t p = 0, s = 0;
+  size_t starP = std::string::npos, starS = 0;
+  while (s < str.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == str[s])) {
+      ++p;
+      ++s;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      starP = p++;
+      starS = s;
+    } else if (starP != std::string::npos) {
+      p = starP + 1;
+      s = ++starS;
+    } else
+      return false;
+  }
+  while (p < pattern.size() && pattern[p] == '*')
+    ++p;
+  return p == pattern.size();
+}
+
+CefRefPtr<CefResourceRequestHandler> ResourceRules::getLocalHandler(Action action) {
+  // Handlers are stateless, so they are shared between all requests.
+  static CefRefPtr<CefResourceRequestHandler> cancelHandler = new CancelResourceRequestHandler();
+  static CefRefPtr<CefResourceRequestHandler> blockCookiesHandler = new BlockCookiesResourceRequestHandler();
+  switch (action) {
+    case CANCEL:
+      return cancelHandler;
+    case BLOCK_COOKIES:
+      return blockCookiesHandler;
+    default:
+      return nullptr;
+  }
+}
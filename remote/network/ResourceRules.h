@@ -0,0 +1,43 @@
+#ifndef JCEF_RESOURCERULES_H
+#define JCEF_RESOURCERULES_H
+
+#include <string>
+#include <vector>
+
+#include "include/cef_resource_request_handler.h"
+
+// Declarative rules for resource requests (pushed by client via
+// Browser_SetResourceRules). They are evaluated on server, so only requests
+// that match CALL_CLIENT rules (or don't match any rule) are passed to java.
+// The first matching rule is applied.
+class ResourceRules {
+ public:
+  // Must be synchronized with java constants in ResourceRules.java
+  enum Action {
+    CALL_CLIENT = 0,   // pass request to java handlers (as without rules)
+    DEFAULT = 1,       // default handling, java isn't called
+    CANCEL = 2,        // cancel request
+    BLOCK_COOKIES = 3  // default handling without sending and saving cookies
+  };
+
+  struct Rule {
+    std::string urlPattern; // wildcards: '*' - any substring, '?' - any char
+    Action action;
+  };
+
+  explicit ResourceRules(std::vector<Rule> rules) : myRules(std::move(rules)) {}
+
+  // Returns CALL_CLIENT when no rule matches.
+  Action match(const std::string& url) const;
+
+  static bool matchPattern(const std::string& pattern, const std::string& str);
+
+  // Returns handler that processes request on server according to action
+  // (nullptr for default handling).
+  static CefRefPtr<CefResourceRequestHandler> getLocalHandler(Action action);
+
+ private:
+  const std::vector<Rule> myRules;
+};
+
+#endif  // JCEF_RESOURCERULES_H
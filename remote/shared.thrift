@@ -1,10 +1,63 @@
 namespace cpp thrift_codegen
 namespace java com.jetbrains.cef.remote.thrift_codegen
 
+struct Point {
+    1: required i32 x,
+    2: required i32 y,
+}
+
+struct Rect {
+    1: required i32 x,
+    2: required i32 y,
+    3: required i32 w,
+    4: required i32 h,
+}
+
+struct ScreenInfo {
+    1: required double device_scale_factor,
+    2: required i32 depth,
+    3: required i32 depth_per_component,
+    4: required bool is_monochrome,
+    5: required Rect rect,
+    6: required Rect available_rect,
+}
+
+// Declarative rule for resource requests, evaluated on server (see Browser_SetResourceRules)
+struct ResourceRule {
+    1: required string urlPattern, // wildcards: '*' - any substring, '?' - any char
+    2: required i32 action,        // see ResourceRules.java
+}
+
+// State of CefRequest. Server sends all fields, client sends only modified
+// fields (unset field means 'unchanged').
+struct RequestInfo {
+    1: optional i64 identifier,
+    2: optional bool isReadOnly,
+    3: optional string url,
+    4: optional string method,
+    5: optional string referrerUrl,
+    6: optional i32 referrerPolicy,        // cef_referrer_policy_t
+    7: optional i32 flags,
+    8: optional string firstPartyForCookies,
+    9: optional i32 resourceType,          // ordinal of CefRequest.ResourceType
+    10: optional i32 transitionType,       // cef_transition_type_t (with qualifiers)
+}
+
+// State of CefResponse (delta semantics are the same as for RequestInfo).
+struct ResponseInfo {
+    1: optional bool isReadOnly,
+    2: optional i32 status,
+    3: optional string statusText,
+    4: optional string mimeType,
+    5: optional i32 error,                 // cef_errorcode_t
+}
+
 struct RObject {
     1: required i32 objId,
     2: optional i32 flags,
     3: optional map<string, string> objInfo,
+    4: optional RequestInfo requestInfo,
+    5: optional ResponseInfo responseInfo,
 }
 
 struct ResponseHeaders {
@@ -40,3 +93,34 @@ struct KeyEvent {
     7: required i16 unmodified_character,
     8: required bool focus_on_editable_field
 }
+
+struct MethodMetrics {
+    1: required string name,
+    2: required i64 calls,
+    3: required i64 errors,
+    4: required i64 totalUs,
+    5: required i64 maxUs,
+    6: required i64 p50Us,
+    7: required i64 p99Us,
+    8: required i64 p999Us,
+    // Only for server methods:
+    9: optional i64 bytesIn,      // total size of requests
+    10: optional i64 bytesOut,    // total size of responses
+    11: optional i32 inFlight,    // calls being dispatched now
+    12: optional i32 maxInFlight,
+}
+
+struct ConnectionMetrics {
+    1: required i32 id,
+    2: required i64 calls,
+    3: required i64 bytesIn,
+    4: required i64 bytesOut,
+    5: required i64 ageMs,
+}
+
+struct ServerMetrics {
+    1: list<MethodMetrics> serverMethods,   // calls from clients
+    2: list<MethodMetrics> clientCallbacks, // backward calls into clients
+    3: map<string, i64> counters,
+    4: list<ConnectionMetrics> connections,
+}
@@ -5,7 +5,8 @@
 #else
 #include <boost/interprocess/managed_shared_memory.hpp>
 #endif
-#include <boost/interprocess/sync/named_mutex.hpp>
+
+#include "handlers/SharedBufferSlot.h"
 
 using namespace boost::interprocess;
 
@@ -97,47 +98,59 @@ Java_com_jetbrains_cef_remote_SharedMemory_readByte(JNIEnv* env,
 }
 
 JNIEXPORT jlong JNICALL
-Java_com_jetbrains_cef_remote_SharedMemory_openSharedMutex(JNIEnv* env,
-                                                             jclass clazz,
-                                                             jstring uid) {
-  if (!uid)
+Java_com_jetbrains_cef_remote_SharedMemory_findSlot(JNIEnv* env,
+                                                    jclass clazz,
+                                                    jlong segment) {
+  if (!segment)
     return 0;
-  named_mutex * mutex = nullptr;
-  const char* strSid = env->GetStringUTFChars(uid, nullptr);
-  if (strSid)
-    mutex = new named_mutex(open_only, strSid);
-  env->ReleaseStringUTFChars(uid, strSid);
-  return (jlong)mutex;
+#ifdef WIN32
+  managed_windows_shared_memory * segm = (managed_windows_shared_memory*)segment;
+#else
+  managed_shared_memory * segm = (managed_shared_memory*)segment;
+#endif
+  return (jlong)segm->find<SharedBufferSlot>(SharedBufferSlot::NAME).first;
 }
 
-JNIEXPORT void JNICALL
-Java_com_jetbrains_cef_remote_SharedMemory_lockSharedMutex(JNIEnv* env,
-                                                      jclass clazz,
-                                                      jlong mutex) {
-  if (!mutex)
-    return;
-  named_mutex * m = (named_mutex*)mutex;
-  m->lock();
+JNIEXPORT jboolean JNICALL
+Java_com_jetbrains_cef_remote_SharedMemory_tryAcquireSlot(JNIEnv* env,
+                                                          jclass clazz,
+                                                          jlong slot) {
+  if (!slot)
+    return JNI_FALSE;
+  SharedBufferSlot * s = (SharedBufferSlot*)slot;
+  return s->transit(SharedBufferSlot::READY, SharedBufferSlot::READING) ? JNI_TRUE : JNI_FALSE;
 }
 
 JNIEXPORT void JNICALL
-Java_com_jetbrains_cef_remote_SharedMemory_unlockSharedMutex(JNIEnv* env,
-                                                           jclass clazz,
-                                                           jlong mutex) {
-  if (!mutex)
+Java_com_jetbrains_cef_remote_SharedMemory_releaseSlot(JNIEnv* env,
+                                                       jclass clazz,
+                                                       jlong slot) {
+  if (!slot)
     return;
-  named_mutex * m = (named_mutex*)mutex;
-  m->unlock();
+  SharedBufferSlot * s = (SharedBufferSlot*)slot;
+  s->transit(SharedBufferSlot::READING, SharedBufferSlot::FREE);
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_jetbrains_cef_remote_SharedMemory_getSlotSeq(JNIEnv* env,
+                                                      jclass clazz,
+                                                      jlong slot) {
+  if (!slot)
+    return -1;
+  SharedBufferSlot * s = (SharedBufferSlot*)slot;
+  return (jlong)s->seq.load(std::memory_order_relaxed);
 }
 
 JNIEXPORT void JNICALL
-Java_com_jetbrains_cef_remote_SharedMemory_closeSharedMutex(JNIEnv* env,
-                                                              jclass clazz,
-                                                              jlong mutex) {
-  if (!mutex)
+Java_com_jetbrains_cef_remote_SharedMemory_readSlotFrame(JNIEnv* env,
+                                                         jclass clazz,
+                                                         jlong slot,
+                                                         jintArray info) {
+  if (!slot || !info)
     return;
-  named_mutex * m = (named_mutex*)mutex;
-  delete m;
+  SharedBufferSlot * s = (SharedBufferSlot*)slot;
+  const jint vals[3] = {s->width, s->height, s->rectsCount};
+  env->SetIntArrayRegion(info, 0, 3, vals);
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,182 @@
+#include "Tests.h"
+
+#include <set>
+#include <vector>
+
+#include "../RemoteObjects.h"
+
+namespace {
+  struct TestObject {
+    explicit TestObject(int id) : myId(id) { ++ourLiveCount; }
+    ~TestObject() { --ourLiveCount; }
+
+    const int myId;
+    static int ourLiveCount;
+  };
+
+  int TestObject::ourLiveCount = 0;
+
+  typedef ServerObjectsFactory<TestObject> Factory;
+  // Small factory (256 slots per shard) to test the full shards.
+  typedef ServerObjectsFactory<TestObject, 8> SmallFactory;
+
+  const int INDEX_MASK = (1 << Factory::INDEX_BITS) - 1; // shard and local bits of id
+  const int GEN_STEP = 1 << Factory::INDEX_BITS;
+
+  template <class F>
+  TestObject* createObject(F& factory) {
+    return factory.create([](int id) { return new TestObject(id); });
+  }
+}
+
+SERVER_TEST(testCreateAndFind) {
+  Factory factory;
+  std::vector<TestObject*> objects;
+  std::set<int> ids;
+  for (int c = 0; c < 1000; ++c) {
+    TestObject* obj = createObject(factory);
+    EXPECT(obj != nullptr);
+    EXPECT(obj->myId >= 0);
+    objects.push_back(obj);
+    ids.insert(obj->myId);
+  }
+  EXPECT(ids.size() == objects.size());
+  EXPECT(factory.getLiveCount() == 1000);
+  for (TestObject* obj : objects)
+    EXPECT(factory.find(obj->myId) == obj);
+
+  for (TestObject* obj : objects)
+    factory.dispose(obj->myId, true);
+  EXPECT(factory.getLiveCount() == 0);
+  EXPECT(TestObject::ourLiveCount == 0);
+}
+
+SERVER_TEST(testFindInvalidIds) {
+  Factory factory;
+  EXPECT(factory.find(-1) == nullptr);
+  EXPECT(factory.find(0) == nullptr);
+  EXPECT(factory.find(INDEX_MASK) == nullptr);
+
+  TestObject* obj = createObject(factory);
+  // Id with the same slot but other generation.
+  EXPECT(factory.find(obj->myId + GEN_STEP) == nullptr);
+  // Disposing of unknown ids does nothing.
+  factory.dispose(-1, true);
+  factory.dispose(obj->myId + GEN_STEP, true);
+  EXPECT(factory.find(obj->myId) == obj);
+  EXPECT(factory.getLiveCount() == 1);
+  factory.dispose(obj->myId, true);
+}
+
+SERVER_TEST(testDispose) {
+  Factory factory;
+  TestObject* obj = createObject(factory);
+  const int id = obj->myId;
+  factory.dispose(id, false);
+  EXPECT(factory.find(id) == nullptr);
+  EXPECT(factory.getLiveCount() == 0);
+  EXPECT(TestObject::ourLiveCount == 1); // not deleted
+  // Second dispose is ignored (object isn't deleted twice).
+  factory.dispose(id, true);
+  EXPECT(TestObject::ourLiveCount == 1);
+  delete obj;
+
+  obj = createObject(factory);
+  factory.dispose(obj->myId, true);
+  EXPECT(TestObject::ourLiveCount == 0);
+}
+
+SERVER_TEST(testStaleIdsAreRejected) {
+  Factory factory;
+  std::set<int> staleIds;
+  std::set<int> staleIndices;
+  for (int c = 0; c < 1000; ++c) {
+    TestObject* obj = createObject(factory);
+    staleIds.insert(obj->myId);
+    staleIndices.insert(obj->myId & INDEX_MASK);
+    factory.dispose(obj->myId, true);
+  }
+
+  // Slots are reused, but ids of new objects never match disposed ones.
+  int reused = 0;
+  for (int c = 0; c < 100000; ++c) {
+    TestObject* obj = createObject(factory);
+    if (staleIndices.count(obj->myId & INDEX_MASK))
+      ++reused;
+    EXPECT(staleIds.count(obj->myId) == 0);
+    factory.dispose(obj->myId, true);
+  }
+  EXPECT(reused > 0);
+  for (int id : staleIds)
+    EXPECT(factory.find(id) == nullptr);
+
+  // Live object in a reused slot is found only by its own id.
+  TestObject* obj = nullptr;
+  while (obj == nullptr) {
+    TestObject* created = createObject(factory);
+    if (staleIndices.count(created->myId & INDEX_MASK))
+      obj = created;
+    else
+      factory.dispose(created->myId, true);
+  }
+  EXPECT(factory.find(obj->myId) == obj);
+  for (int id : staleIds)
+    EXPECT(factory.find(id) == nullptr);
+  factory.dispose(obj->myId, true);
+  EXPECT(factory.getLiveCount() == 0);
+  EXPECT(TestObject::ourLiveCount == 0);
+}
+
+SERVER_TEST(testFullShards) {
+  SmallFactory factory;
+  const int capacity = 1 << SmallFactory::INDEX_BITS;
+  std::vector<TestObject*> objects;
+  std::set<int> ids;
+  for (int c = 0; c < capacity; ++c) {
+    TestObject* obj = createObject(factory);
+    EXPECT(obj != nullptr);
+    if (obj == nullptr)
+      break;
+    objects.push_back(obj);
+    ids.insert(obj->myId);
+  }
+  EXPECT(ids.size() == (size_t)capacity);
+  EXPECT(factory.getLiveCount() == capacity);
+
+  // All slots are used.
+  EXPECT(createObject(factory) == nullptr);
+  EXPECT(factory.getLiveCount() == capacity);
+
+  // Free slots of a full shard are reused immediately, other shards fall
+  // through to it.
+  const int shard = 3;
+  const int shardMask = (1 << SmallFactory::SHARD_BITS) - 1;
+  std::set<int> freedIds;
+  for (TestObject*& obj : objects) {
+    if ((obj->myId & shardMask) == shard && freedIds.size() < 16) {
+      freedIds.insert(obj->myId);
+      factory.dispose(obj->myId, true);
+      obj = nullptr;
+    }
+  }
+  EXPECT(freedIds.size() == 16);
+  for (int c = 0; c < 16; ++c) {
+    TestObject* obj = createObject(factory);
+    EXPECT(obj != nullptr);
+    if (obj == nullptr)
+      continue;
+    EXPECT((obj->myId & shardMask) == shard);
+    EXPECT(freedIds.count(obj->myId) == 0);
+    objects.push_back(obj);
+  }
+  EXPECT(createObject(factory) == nullptr);
+  for (int id : freedIds)
+    EXPECT(factory.find(id) == nullptr);
+
+  for (TestObject* obj : objects) {
+    if (obj != nullptr)
+      factory.dispose(obj->myId, true);
+  }
+  EXPECT(factory.getLiveCount() == 0);
+  EXPECT(TestObject::ourLiveCount == 0);
+}
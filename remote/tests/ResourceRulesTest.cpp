@@ -0,0 +1,95 @@
+#include "Tests.h"
+
+#include "../network/ResourceRules.h"
+
+SERVER_TEST(testMatchPatternWithoutWildcards) {
+  EXPECT(ResourceRules::matchPattern("https://example.com/", "https://example.com/"));
+  EXPECT(!ResourceRules::matchPattern("https://example.com/", "https://example.com/a"));
+  EXPECT(!ResourceRules::matchPattern("https://example.com/a", "https://example.com/"));
+  EXPECT(ResourceRules::matchPattern("", ""));
+  EXPECT(!ResourceRules::matchPattern("", "a"));
+}
+
+SERVER_TEST(testMatchPatternWithStar) {
+  EXPECT(ResourceRules::matchPattern("*", ""));
+  EXPECT(ResourceRules::matchPattern("*", "https://example.com/"));
+  EXPECT(ResourceRules::matchPattern("https://*", "https://example.com/"));
+  EXPECT(ResourceRules::matchPattern("*.png", "https://example.com/img/a.png"));
+  EXPECT(!ResourceRules::matchPattern("*.png", "https://example.com/img/a.png?x=1"));
+  EXPECT(ResourceRules::matchPattern("https://*.example.com/*", "https://cdn.example.com/lib.js"));
+  EXPECT(!ResourceRules::matchPattern("https://*.example.com/*", "https://example.com/lib.js"));
+  // '*' matches an empty substring
+  EXPECT(ResourceRules::matchPattern("a*b", "ab"));
+  EXPECT(ResourceRules::matchPattern("a**b", "ab"));
+  // backtracking to the last '*'
+  EXPECT(ResourceRules::matchPattern("*a*b", "xaxxb"));
+  EXPECT(ResourceRules::matchPattern("*ab", "aab"));
+  EXPECT(!ResourceRules::matchPattern("*a*b", "xaxxbx"));
+  EXPECT(!ResourceRules::matchPattern("*a*b", "xbxxa"));
+}
+
+SERVER_TEST(testMatchPatternWithQuestionMark) {
+  EXPECT(ResourceRules::matchPattern("http?://example.com/", "https://example.com/"));
+  EXPECT(ResourceRules::matchPattern("?", "a"));
+  EXPECT(!ResourceRules::matchPattern("?", ""));
+  EXPECT(!ResourceRules::matchPattern("?", "ab"));
+  EXPECT(ResourceRules::matchPattern("*/a?c/*", "https://example.com/abc/index.html"));
+  EXPECT(!ResourceRules::matchPattern("*/a?c/*", "https://example.com/ac/index.html"));
+}
+
+SERVER_TEST(testNoMatchingRule) {
+  EXPECT(ResourceRules({}).match("https://example.com/") == ResourceRules::CALL_CLIENT);
+
+  ResourceRules rules({{"https://example.com/*", ResourceRules::CANCEL}});
+  EXPECT(rules.match("https://other.com/") == ResourceRules::CALL_CLIENT);
+}
+
+SERVER_TEST(testFirstMatchingRuleIsApplied) {
+  ResourceRules rules({{"*/ads/*", ResourceRules::CANCEL},
+                       {"https://example.com/*", ResourceRules::DEFAULT},
+                       {"*", ResourceRules::BLOCK_COOKIES}});
+  EXPECT(rules.match("https://example.com/ads/banner.png") == ResourceRules::CANCEL);
+  EXPECT(rules.match("https://example.com/index.html") == ResourceRules::DEFAULT);
+  EXPECT(rules.match("https://other.com/index.html") == ResourceRules::BLOCK_COOKIES);
+
+  // Catch-all rule first shadows the rest.
+  ResourceRules reversed({{"*", ResourceRules::BLOCK_COOKIES},
+                          {"*/ads/*", ResourceRules::CANCEL}});
+  EXPECT(reversed.match("https://example.com/ads/banner.png") == ResourceRules::BLOCK_COOKIES);
+}
+
+SERVER_TEST(testEachAction) {
+  ResourceRules rules({{"*/client/*", ResourceRules::CALL_CLIENT},
+                       {"*/default/*", ResourceRules::DEFAULT},
+                       {"*/cancel/*", ResourceRules::CANCEL},
+                       {"*/cookies/*", ResourceRules::BLOCK_COOKIES}});
+  EXPECT(rules.match("https://example.com/client/") == ResourceRules::CALL_CLIENT);
+  EXPECT(rules.match("https://example.com/default/") == ResourceRules::DEFAULT);
+  EXPECT(rules.match("https://example.com/cancel/") == ResourceRules::CANCEL);
+  EXPECT(rules.match("https://example.com/cookies/") == ResourceRules::BLOCK_COOKIES);
+
+  // CALL_CLIENT and DEFAULT have no local handler.
+  EXPECT(ResourceRules::getLocalHandler(ResourceRules::CALL_CLIENT) == nullptr);
+  EXPECT(ResourceRules::getLocalHandler(ResourceRules::DEFAULT) == nullptr);
+
+  CefRefPtr<CefResourceRequestHandler> cancel = ResourceRules::getLocalHandler(ResourceRules::CANCEL);
+  EXPECT(cancel != nullptr);
+  if (cancel)
+    EXPECT(cancel->OnBeforeResourceLoad(nullptr, nullptr, nullptr, nullptr) == RV_CANCEL);
+
+  CefRefPtr<CefResourceRequestHandler> blockCookies = ResourceRules::getLocalHandler(ResourceRules::BLOCK_COOKIES);
+  EXPECT(blockCookies != nullptr);
+  if (blockCookies) {
+    EXPECT(blockCookies->OnBeforeResourceLoad(nullptr, nullptr, nullptr, nullptr) == RV_CONTINUE);
+    CefRefPtr<CefCookieAccessFilter> filter = blockCookies->GetCookieAccessFilter(nullptr, nullptr, nullptr);
+    EXPECT(filter != nullptr);
+    if (filter) {
+      CefCookie cookie;
+      EXPECT(!filter->CanSendCookie(nullptr, nullptr, nullptr, cookie));
+      EXPECT(!filter->CanSaveCookie(nullptr, nullptr, nullptr, nullptr, cookie));
+    }
+  }
+
+  // Handlers are stateless and shared.
+  EXPECT(ResourceRules::getLocalHandler(ResourceRules::CANCEL) == cancel);
+}
@@ -0,0 +1,45 @@
+#include "Tests.h"
+
+#include <stdio.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../log/Log.h"
+
+namespace {
+  std::vector<std::pair<std::string, std::function<void()>>>& allTests() {
+    static std::vector<std::pair<std::string, std::function<void()>>> tests;
+    return tests;
+  }
+
+  int ourFailures = 0;
+}
+
+Tests::Registrar::Registrar(const char* name, std::function<void()> test) {
+  allTests().emplace_back(name, std::move(test));
+}
+
+void Tests::fail(const char* file, int line, const char* expr) {
+  fprintf(stderr, "%s:%d: check failed: %s\n", file, line, expr);
+  ++ourFailures;
+}
+
+int Tests::runAll() {
+  int failedTests = 0;
+  for (const auto& test : allTests()) {
+    const int failuresBefore = ourFailures;
+    test.second();
+    const bool passed = ourFailures == failuresBefore;
+    if (!passed)
+      ++failedTests;
+    fprintf(stdout, "[%s] %s\n", passed ? "  OK  " : "FAILED", test.first.c_str());
+  }
+  fprintf(stdout, "%d of %d tests failed\n", failedTests, (int)allTests().size());
+  return failedTests;
+}
+
+int main(int argc, char* argv[]) {
+  Log::init(LEVEL_WARN, "");
+  return Tests::runAll() == 0 ? 0 : 1;
+}
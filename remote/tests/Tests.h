@@ -0,0 +1,30 @@
+#ifndef JCEF_TESTS_H
+#define JCEF_TESTS_H
+
+#include <functional>
+
+// Minimal harness for unit tests of server internals (cef_server_tests), the
+// server build doesn't depend on any test framework.
+class Tests {
+ public:
+  struct Registrar {
+    Registrar(const char* name, std::function<void()> test);
+  };
+
+  static void fail(const char* file, int line, const char* expr);
+  // Returns count of failed tests.
+  static int runAll();
+};
+
+#define SERVER_TEST(name)                                   \
+  static void name();                                       \
+  static Tests::Registrar name##Registrar(#name, name);     \
+  static void name()
+
+#define EXPECT(cond)                             \
+  do {                                           \
+    if (!(cond))                                 \
+      Tests::fail(__FILE__, __LINE__, #cond);    \
+  } while (false)
+
+#endif  // JCEF_TESTS_H